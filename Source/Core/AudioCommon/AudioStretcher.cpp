@@ -8,7 +8,6 @@
 #include <cstddef>
 
 #include "Common/Logging/Log.h"
-#include "Core/Config/MainSettings.h"
 
 namespace AudioCommon
 {
@@ -25,14 +24,14 @@ void AudioStretcher::Clear()
   m_sound_touch.clear();
 }
 
-void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out)
+void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out,
+                                    int max_latency)
 {
   const double time_delta = static_cast<double>(num_out) / m_sample_rate;  // seconds
 
   // We were given actual_samples number of samples, and num_samples were requested from us.
   double current_ratio = static_cast<double>(num_in) / static_cast<double>(num_out);
 
-  const double max_latency = Config::Get(Config::MAIN_AUDIO_STRETCH_LATENCY);
   const double max_backlog = m_sample_rate * max_latency / 1000.0 / m_stretch_ratio;
   const double backlog_fullness = m_sound_touch.numSamples() / max_backlog;
   if (backlog_fullness > 5.0)
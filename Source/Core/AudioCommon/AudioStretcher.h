@@ -13,7 +13,9 @@ class AudioStretcher
 {
 public:
   explicit AudioStretcher(unsigned int sample_rate);
-  void ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out);
+  // max_latency is in ms.
+  void ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out,
+                      int max_latency);
   void GetStretchedSamples(short* out, unsigned int num_out);
   void Clear();
 
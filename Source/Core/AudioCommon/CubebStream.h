@@ -6,7 +6,6 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <vector>
 
 #include "AudioCommon/SoundStream.h"
 #include "Common/WorkQueueThread.h"
@@ -31,9 +30,6 @@ private:
   std::shared_ptr<cubeb> m_ctx;
   cubeb_stream* m_stream = nullptr;
 
-  std::vector<short> m_short_buffer;
-  std::vector<float> m_floatstereo_buffer;
-
 #ifdef _WIN32
   Common::WorkQueueThread<std::function<void()>> m_work_queue;
   bool m_coinit_success = false;
@@ -12,4 +12,12 @@ enum class DPL2Quality
   High = 2,
   Highest = 3
 };
+
+// Selects the filter the mixer resamples its inputs with.
+enum class ResamplingQuality
+{
+  Linear = 0,
+  Medium = 1,
+  High = 2
+};
 }  // namespace AudioCommon
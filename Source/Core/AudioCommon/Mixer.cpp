@@ -8,9 +8,11 @@
 #include <cstring>
 
 #include "AudioCommon/Enums.h"
+#include "AudioCommon/RealtimeCheck.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -32,14 +34,16 @@ static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 }
 
 Mixer::Mixer(unsigned int BackendSampleRate)
-    : m_sampleRate(BackendSampleRate), m_stretcher(BackendSampleRate),
+    : m_fifo_samples(GetFifoSamples()), m_sampleRate(BackendSampleRate),
+      m_stretcher(BackendSampleRate),
       m_surround_decoder(BackendSampleRate,
-                         DPL2QualityToFrameBlockSize(Config::Get(Config::MAIN_DPL2_QUALITY)))
+                         DPL2QualityToFrameBlockSize(Config::Get(Config::MAIN_DPL2_QUALITY))),
+      m_scratch_buffer(m_fifo_samples * 2), m_mix_buffer(m_fifo_samples * 2)
 {
   m_config_changed_callback_id = Config::AddConfigChangedCallback([this] { RefreshConfig(); });
   RefreshConfig();
 
-  INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer is initialized");
+  INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer is initialized with {} samples per FIFO", m_fifo_samples);
 }
 
 Mixer::~Mixer()
@@ -57,13 +61,18 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
+u32 Mixer::GetFifoSamples()
+{
+  const u32 size_ms = std::clamp<u32>(Config::Get(Config::MAIN_AUDIO_MIXER_BUFFER_SIZE),
+                                      MIN_FIFO_SIZE_MS, MAX_FIFO_SIZE_MS);
+  return MathUtil::NextPowerOf2(size_ms * 32);
+}
+
 // Executed from sound stream thread
-unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
+unsigned int Mixer::MixerFifo::Mix(float* samples, unsigned int numSamples,
                                    bool consider_framelimit, float emulationspeed,
-                                   int timing_variance)
+                                   int target_latency, AudioCommon::ResamplingQuality quality)
 {
-  unsigned int currentSample = 0;
-
   // Cache access in non-volatile variable
   // This is the only function changing the read value, so it's safe to
   // cache it locally although it's written here.
@@ -71,143 +80,181 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   // so we will just ignore new written data while interpolating.
   // Without this cache, the compiler wouldn't be allowed to optimize the
   // interpolation loop.
-  u32 indexR = m_indexR.load();
-  u32 indexW = m_indexW.load();
+  u32 indexR = m_indexR.load(std::memory_order_relaxed);
+  const u32 indexW = m_indexW.load(std::memory_order_acquire);
 
   // render numleft sample pairs to samples[]
   // advance indexR with sample position
   // remember fractional offset
 
-  float aid_sample_rate =
+  const float input_sample_rate =
       FIXED_SAMPLE_RATE_DIVIDEND / static_cast<float>(m_input_sample_rate_divisor);
+  float aid_sample_rate = input_sample_rate;
   if (consider_framelimit && emulationspeed > 0.0f)
   {
-    float numLeft = static_cast<float>(((indexW - indexR) & INDEX_MASK) / 2);
-
-    u32 low_watermark = (FIXED_SAMPLE_RATE_DIVIDEND * timing_variance) /
-                        (static_cast<u64>(m_input_sample_rate_divisor) * 1000);
-    low_watermark = std::min(low_watermark, MAX_SAMPLES / 2);
-
-    m_numLeftI = (numLeft + m_numLeftI * (CONTROL_AVG - 1)) / CONTROL_AVG;
-    float offset = (m_numLeftI - low_watermark) * CONTROL_FACTOR;
-    if (offset > MAX_FREQ_SHIFT)
-      offset = MAX_FREQ_SHIFT;
-    if (offset < -MAX_FREQ_SHIFT)
-      offset = -MAX_FREQ_SHIFT;
-
-    aid_sample_rate = (aid_sample_rate + offset) * emulationspeed;
+    // Smooth the fill level over a fixed time rather than a fixed number of calls, so that the
+    // controller behaves the same regardless of the buffer size of the backend.
+    const float dt = numSamples / static_cast<float>(m_mixer->m_sampleRate);
+    const float num_left = static_cast<float>(((indexW - indexR) & m_index_mask) / 2);
+    m_fill_average += (num_left - m_fill_average) * std::min(dt / CONTROL_SMOOTHING_TIME, 1.0f);
+
+    const float target = std::min(target_latency * input_sample_rate / 1000.0f,
+                                  static_cast<float>(m_mixer->m_fifo_samples / 2));
+    const float error = (m_fill_average - target) / input_sample_rate;
+
+    // The integral term removes the steady state error a pure P controller has when the emulated
+    // and host clocks drift apart, which is what makes low targets underrun.
+    m_error_integral = std::clamp(m_error_integral + error * dt, -MAX_RATE_ADJUSTMENT / CONTROL_I,
+                                  MAX_RATE_ADJUSTMENT / CONTROL_I);
+    m_rate_adjustment = std::clamp(CONTROL_P * error + CONTROL_I * m_error_integral,
+                                   -MAX_RATE_ADJUSTMENT, MAX_RATE_ADJUSTMENT);
+
+    aid_sample_rate = input_sample_rate * (1.0f + m_rate_adjustment) * emulationspeed;
+  }
+  else
+  {
+    m_error_integral = 0.0f;
+    m_rate_adjustment = 0.0f;
   }
 
   const u32 ratio = (u32)(65536.0f * aid_sample_rate / (float)m_mixer->m_sampleRate);
 
-  s32 lvolume = m_LVolume.load();
-  s32 rvolume = m_RVolume.load();
+  // Only the nominal rates are used for the filter, so that it doesn't get rebuilt all the time.
+  const float max_cutoff = std::min(1.0f, m_mixer->m_sampleRate / input_sample_rate);
+  if (quality != m_resampler.GetQuality() || max_cutoff != m_resampler.GetMaxCutoff())
+    m_resampler.SetFilter(quality, max_cutoff);
 
-  const auto read_buffer = [this](auto index) {
-    return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
-  };
+  const float lvolume = m_LVolume.load() / 256.0f;
+  const float rvolume = m_RVolume.load() / 256.0f;
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  const u32 ring_frames = (m_index_mask + 1) / 2;
+  const u32 history = m_resampler.GetHistory() * 2;
+  unsigned int currentSample = 0;
+  while (currentSample < numSamples)
   {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
-
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
+    // The frames before indexR are still in the ring, since PushSamples keeps MAX_TAPS of them.
+    const u32 window_start = indexR - history;
+    const u32 first_frame = (window_start & m_index_mask) / 2;
+    const u32 available = std::min(((indexW - window_start) & m_index_mask) / 2,
+                                   ring_frames + AudioCommon::Resampler::MAX_TAPS - first_frame);
+
+    u32 position = m_frac;
+    const u32 mixed = m_resampler.Process(&m_buffer[first_frame * 2], available, &position, ratio,
+                                          &samples[currentSample * 2], numSamples - currentSample,
+                                          rvolume, lvolume);
+    indexR += (position >> 16) * 2;
+    m_frac = position & 0xffff;
+
+    // Nothing can be mixed if the FIFO ran dry, rather than the window reaching the mirrored end.
+    if (mixed == 0)
+      break;
+    currentSample += mixed;
   }
 
   // Actual number of samples written to the buffer without padding.
-  unsigned int actual_sample_count = currentSample / 2;
+  const unsigned int actual_sample_count = currentSample;
 
   // Padding
-  short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
-  s[0] = (s[0] * rvolume) >> 8;
-  s[1] = (s[1] * lvolume) >> 8;
-  for (; currentSample < numSamples * 2; currentSample += 2)
+  const float pad_r = m_buffer[(indexR - 2) & m_index_mask] * rvolume;
+  const float pad_l = m_buffer[(indexR - 1) & m_index_mask] * lvolume;
+  for (; currentSample < numSamples; ++currentSample)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
-
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+    samples[currentSample * 2 + 0] += pad_r;
+    samples[currentSample * 2 + 1] += pad_l;
   }
 
   // Flush cached variable
-  m_indexR.store(indexR);
+  m_indexR.store(indexR, std::memory_order_release);
 
   return actual_sample_count;
 }
 
+unsigned int Mixer::MixAll(short* samples, unsigned int num_samples, bool consider_framelimit)
+{
+  // TODO: Determine how emulation speed will be used in audio
+  // const float emulation_speed = g_perf_metrics.GetSpeed();
+  const float emulation_speed = m_config_emulation_speed;
+  const int target_latency =
+      m_config_mixer_latency > 0 ? m_config_mixer_latency : m_config_timing_variance;
+
+  // m_mix_buffer is never resized here, so that mixing doesn't allocate. Requests which don't fit
+  // in it are mixed in several passes.
+  const unsigned int max_chunk = static_cast<unsigned int>(m_mix_buffer.size() / 2);
+  float* const buffer = m_mix_buffer.data();
+
+  unsigned int dma_samples = 0;
+  for (unsigned int offset = 0; offset < num_samples;)
+  {
+    const unsigned int count = std::min(num_samples - offset, max_chunk);
+    std::fill_n(buffer, count * 2, 0.0f);
+
+    const auto mix = [&](MixerFifo& fifo) {
+      return fifo.Mix(buffer, count, consider_framelimit, emulation_speed, target_latency,
+                      m_config_resampling_quality);
+    };
+
+    const bool dma_had_samples = m_dma_mixer.AvailableSamples() != 0;
+    const unsigned int dma_mixed = mix(m_dma_mixer);
+    mix(m_streaming_mixer);
+    mix(m_wiimote_speaker_mixer);
+    mix(m_skylander_portal_mixer);
+    for (auto& mixer : m_gba_mixers)
+      mix(mixer);
+
+    // Only clamp once all sources have been added, so that one loud source can't clip the others.
+    short* const out = &samples[offset * 2];
+    for (unsigned int i = 0; i < count * 2; ++i)
+      out[i] = static_cast<short>(std::clamp(buffer[i], -32767.0f, 32767.0f));
+
+    // An empty FIFO only counts as an underrun if it ran dry while playing, not if nothing is
+    // being pushed to it, e.g. while paused.
+    if (consider_framelimit && dma_had_samples && dma_mixed < count)
+      g_perf_metrics.CountAudioUnderrun();
+
+    dma_samples += dma_mixed;
+    offset += count;
+  }
+
+  const DT_s buffered(static_cast<double>(m_dma_mixer.AvailableSamples()) / m_sampleRate);
+  g_perf_metrics.SetAudioMixerState(m_dma_mixer.GetRateAdjustment(),
+                                    std::chrono::duration_cast<DT>(buffered));
+
+  return dma_samples;
+}
+
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
   if (!samples)
     return 0;
 
-  memset(samples, 0, num_samples * 2 * sizeof(short));
+  AudioCommon::RealtimeScope realtime_scope;
 
-  // TODO: Determine how emulation speed will be used in audio
-  // const float emulation_speed = g_perf_metrics.GetSpeed();
-  const float emulation_speed = m_config_emulation_speed;
-  const int timing_variance = m_config_timing_variance;
   if (m_config_audio_stretch)
   {
     unsigned int available_samples =
         std::min(m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples());
 
-    ASSERT_MSG(AUDIO, available_samples <= MAX_SAMPLES,
+    ASSERT_MSG(AUDIO, available_samples <= m_fifo_samples,
                "Audio stretching would overflow m_scratch_buffer: min({}, {}) -> {} > {} ({})",
                m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples(),
-               available_samples, MAX_SAMPLES, num_samples);
-
-    m_scratch_buffer.fill(0);
-
-    m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
-    m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
-    m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                timing_variance);
-    m_skylander_portal_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                 timing_variance);
-    for (auto& mixer : m_gba_mixers)
-    {
-      mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                timing_variance);
-    }
+               available_samples, m_fifo_samples, num_samples);
+
+    MixAll(m_scratch_buffer.data(), available_samples, false);
 
+    // SoundTouch grows its buffers as needed, so stretching can't be checked.
+    AudioCommon::NonRealtimeScope non_realtime_scope;
     if (!m_is_stretching)
     {
       m_stretcher.Clear();
       m_is_stretching = true;
     }
-    m_stretcher.ProcessSamples(m_scratch_buffer.data(), available_samples, num_samples);
+    m_stretcher.ProcessSamples(m_scratch_buffer.data(), available_samples, num_samples,
+                               m_config_audio_stretch_latency);
     m_stretcher.GetStretchedSamples(samples, num_samples);
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    MixAll(samples, num_samples, true);
     m_is_stretching = false;
   }
 
@@ -219,15 +266,17 @@ unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
   if (!num_samples)
     return 0;
 
+  AudioCommon::RealtimeScope realtime_scope;
+
   memset(samples, 0, num_samples * SURROUND_CHANNELS * sizeof(float));
 
   size_t needed_frames = m_surround_decoder.QueryFramesNeededForSurroundOutput(num_samples);
 
   // Mix() may also use m_scratch_buffer internally, but is safe because it alternates reads
   // and writes.
-  ASSERT_MSG(AUDIO, needed_frames <= MAX_SAMPLES,
+  ASSERT_MSG(AUDIO, needed_frames <= m_fifo_samples,
              "needed_frames would overflow m_scratch_buffer: {} -> {} > {}", num_samples,
-             needed_frames, MAX_SAMPLES);
+             needed_frames, m_fifo_samples);
   size_t available_frames = Mix(m_scratch_buffer.data(), static_cast<u32>(needed_frames));
   if (available_frames != needed_frames)
   {
@@ -248,28 +297,43 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
   // Cache access in non-volatile variable
   // indexR isn't allowed to cache in the audio throttling loop as it
   // needs to get updates to not deadlock.
-  u32 indexW = m_indexW.load();
+  const u32 indexW = m_indexW.load(std::memory_order_relaxed);
+  const u32 ring_size = m_index_mask + 1;
 
   // Check if we have enough free space
-  // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW
-  if (num_samples * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >= MAX_SAMPLES * 2)
+  // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW.
+  // The frames right before indexR must be left alone too, since they're the history of the
+  // resampler.
+  constexpr u32 MIRROR_SIZE = AudioCommon::Resampler::MAX_TAPS * 2;
+  const u32 used = (indexW - m_indexR.load(std::memory_order_acquire)) & m_index_mask;
+  if (num_samples * 2 + used + MIRROR_SIZE >= ring_size)
     return;
 
   // AyuanX: Actual re-sampling work has been moved to sound thread
   // to alleviate the workload on main thread
-  // and we simply store raw data here to make fast mem copy
-  int over_bytes = num_samples * 4 - (MAX_SAMPLES * 2 - (indexW & INDEX_MASK)) * sizeof(short);
-  if (over_bytes > 0)
-  {
-    memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4 - over_bytes);
-    memcpy(&m_buffer[0], samples + (num_samples * 4 - over_bytes) / sizeof(short), over_bytes);
-  }
-  else
+  // and we simply store raw data here
+  for (unsigned int i = 0; i < num_samples; ++i)
   {
-    memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4);
+    short first = samples[i * 2];
+    short second = samples[i * 2 + 1];
+    if (!m_little_endian)
+    {
+      first = Common::swap16(first);
+      second = Common::swap16(second);
+    }
+
+    const u32 index = (indexW + i * 2) & m_index_mask;
+    m_buffer[index] = second;
+    m_buffer[index + 1] = first;
+    if (index < MIRROR_SIZE)
+    {
+      m_buffer[ring_size + index] = second;
+      m_buffer[ring_size + index + 1] = first;
+    }
   }
 
-  m_indexW.fetch_add(num_samples * 2);
+  // Publish the samples only after they have been copied.
+  m_indexW.store(indexW + num_samples * 2, std::memory_order_release);
 }
 
 void Mixer::PushSamples(const short* samples, unsigned int num_samples)
@@ -457,7 +521,10 @@ void Mixer::RefreshConfig()
 {
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
+  m_config_mixer_latency = Config::Get(Config::MAIN_AUDIO_MIXER_LATENCY);
+  m_config_resampling_quality = Config::Get(Config::MAIN_AUDIO_RESAMPLING_QUALITY);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+  m_config_audio_stretch_latency = Config::Get(Config::MAIN_AUDIO_STRETCH_LATENCY);
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -490,9 +557,11 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
 
 unsigned int Mixer::MixerFifo::AvailableSamples() const
 {
-  unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
-  if (samples_in_fifo <= 1)
-    return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
-  return (samples_in_fifo - 1) * static_cast<u64>(m_mixer->m_sampleRate) *
+  unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & m_index_mask) / 2;
+  // Mixer::MixerFifo::Mix always keeps the samples after the current one which the resampler reads.
+  const unsigned int lookahead = m_resampler.GetTaps() / 2;
+  if (samples_in_fifo <= lookahead)
+    return 0;
+  return (samples_in_fifo - lookahead) * static_cast<u64>(m_mixer->m_sampleRate) *
          m_input_sample_rate_divisor / FIXED_SAMPLE_RATE_DIVIDEND;
 }
@@ -5,8 +5,11 @@
 
 #include <array>
 #include <atomic>
+#include <vector>
 
 #include "AudioCommon/AudioStretcher.h"
+#include "AudioCommon/Enums.h"
+#include "AudioCommon/Resampler.h"
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
@@ -54,11 +57,15 @@ public:
   static constexpr u64 FIXED_SAMPLE_RATE_DIVIDEND = 54000000 * 2;
 
 private:
-  static constexpr u32 MAX_SAMPLES = 1024 * 4;  // 128 ms
-  static constexpr u32 INDEX_MASK = MAX_SAMPLES * 2 - 1;
-  static constexpr int MAX_FREQ_SHIFT = 200;  // Per 32000 Hz
-  static constexpr float CONTROL_FACTOR = 0.2f;
-  static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
+  // The FIFO size setting is in ms of 32 kHz audio, rounded up to a power of two samples.
+  static constexpr u32 MIN_FIFO_SIZE_MS = 16;
+  static constexpr u32 MAX_FIFO_SIZE_MS = 1024;
+  // The latency controller is a PI controller on the smoothed FIFO fill level. The rate
+  // adjustment is relative to the input sample rate, with the error in seconds of audio.
+  static constexpr float MAX_RATE_ADJUSTMENT = 200.0f / 32000.0f;
+  static constexpr float CONTROL_P = 0.2f;
+  static constexpr float CONTROL_I = CONTROL_P * CONTROL_P / 4;  // Critically damped
+  static constexpr float CONTROL_SMOOTHING_TIME = 0.1f;          // In seconds
 
   const unsigned int SURROUND_CHANNELS = 6;
 
@@ -67,35 +74,58 @@ private:
   public:
     MixerFifo(Mixer* mixer, unsigned sample_rate_divisor, bool little_endian)
         : m_mixer(mixer), m_input_sample_rate_divisor(sample_rate_divisor),
-          m_little_endian(little_endian)
+          m_little_endian(little_endian),
+          m_buffer((mixer->m_fifo_samples + AudioCommon::Resampler::MAX_TAPS) * 2),
+          m_index_mask(mixer->m_fifo_samples * 2 - 1)
     {
     }
     void DoState(PointerWrap& p);
     void PushSamples(const short* samples, unsigned int num_samples);
-    unsigned int Mix(short* samples, unsigned int numSamples, bool consider_framelimit,
-                     float emulationspeed, int timing_variance);
+    // Adds the resampled FIFO contents to samples, and returns how many samples could be mixed
+    // before the FIFO ran dry. target_latency is the FIFO fill level to aim for, in ms.
+    unsigned int Mix(float* samples, unsigned int numSamples, bool consider_framelimit,
+                     float emulationspeed, int target_latency,
+                     AudioCommon::ResamplingQuality quality);
     void SetInputSampleRateDivisor(unsigned int rate_divisor);
     unsigned int GetInputSampleRateDivisor() const;
     void SetVolume(unsigned int lvolume, unsigned int rvolume);
     std::pair<s32, s32> GetVolume() const;
     unsigned int AvailableSamples() const;
+    // The factor the latency controller last scaled the input sample rate by.
+    float GetRateAdjustment() const { return 1.0f + m_rate_adjustment; }
 
   private:
     Mixer* m_mixer;
     unsigned m_input_sample_rate_divisor;
     bool m_little_endian;
-    std::array<short, MAX_SAMPLES * 2> m_buffer{};
+    // Single producer, single consumer ring of interleaved stereo samples. Its size is a power of
+    // two, so the indices can wrap around freely. The samples are stored in host byte order, with
+    // the two channels in the order they're output in. The first Resampler::MAX_TAPS frames are
+    // repeated after the end, so that the resampler never has to wrap around within a window.
+    std::vector<short> m_buffer;
+    const u32 m_index_mask;
     std::atomic<u32> m_indexW{0};
     std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
-    float m_numLeftI = 0.0f;
+    // Only used by the audio thread.
+    float m_fill_average = 0.0f;
+    float m_error_integral = 0.0f;
+    float m_rate_adjustment = 0.0f;
     u32 m_frac = 0;
+    AudioCommon::Resampler m_resampler;
   };
 
+  static u32 GetFifoSamples();
+  // Mixes all FIFOs in float and writes the clamped result to samples. Returns how many samples
+  // the DMA FIFO could provide.
+  unsigned int MixAll(short* samples, unsigned int num_samples, bool consider_framelimit);
   void RefreshConfig();
 
+  // In stereo sample pairs. Must be initialized before the FIFOs.
+  const u32 m_fifo_samples;
+
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
   MixerFifo m_wiimote_speaker_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 3000, true};
@@ -109,7 +139,8 @@ private:
   bool m_is_stretching = false;
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
-  std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  std::vector<short> m_scratch_buffer;
+  std::vector<float> m_mix_buffer;
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
@@ -119,7 +150,10 @@ private:
 
   float m_config_emulation_speed;
   int m_config_timing_variance;
+  int m_config_mixer_latency;
+  AudioCommon::ResamplingQuality m_config_resampling_quality;
   bool m_config_audio_stretch;
+  int m_config_audio_stretch_latency;
 
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
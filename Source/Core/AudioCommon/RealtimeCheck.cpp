@@ -0,0 +1,121 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/RealtimeCheck.h"
+
+#ifdef _DEBUG
+
+#include <cstdlib>
+#include <new>
+
+#include "Common/Assert.h"
+
+namespace
+{
+thread_local int s_realtime_depth = 0;
+thread_local bool s_reported = false;
+
+void CheckAllocation(std::size_t size)
+{
+  if (s_realtime_depth == 0 || s_reported)
+    return;
+
+  // Reporting allocates too, so the check is disabled while doing so.
+  s_reported = true;
+  const int depth = s_realtime_depth;
+  s_realtime_depth = 0;
+  ASSERT_MSG(AUDIO, false, "Allocated {} bytes on a real-time audio thread", size);
+  s_realtime_depth = depth;
+}
+
+void* Allocate(std::size_t size)
+{
+  CheckAllocation(size);
+  if (void* ptr = std::malloc(size != 0 ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void* AllocateNoThrow(std::size_t size) noexcept
+{
+  CheckAllocation(size);
+  return std::malloc(size != 0 ? size : 1);
+}
+}  // namespace
+
+namespace AudioCommon
+{
+RealtimeScope::RealtimeScope()
+{
+  ++s_realtime_depth;
+}
+
+RealtimeScope::~RealtimeScope()
+{
+  --s_realtime_depth;
+}
+
+NonRealtimeScope::NonRealtimeScope() : m_saved_depth(s_realtime_depth)
+{
+  s_realtime_depth = 0;
+}
+
+NonRealtimeScope::~NonRealtimeScope()
+{
+  s_realtime_depth = m_saved_depth;
+}
+}  // namespace AudioCommon
+
+// The replacements of the global allocation functions which the checks hook into. Over-aligned
+// allocations keep using the default implementations, since nothing on the audio path makes them.
+void* operator new(std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return AllocateNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return AllocateNoThrow(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+#endif
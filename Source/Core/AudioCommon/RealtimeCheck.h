@@ -0,0 +1,48 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace AudioCommon
+{
+// Marks code which runs on the thread of an audio device, where blocking can make the output
+// glitch. In debug builds, allocating memory on a thread with an active RealtimeScope triggers an
+// assertion (once per thread). Scopes can be nested. In release builds, they do nothing.
+class RealtimeScope
+{
+public:
+#ifdef _DEBUG
+  RealtimeScope();
+  ~RealtimeScope();
+#else
+  RealtimeScope() = default;
+  // Not defaulted, so that unused scopes don't trigger warnings.
+  ~RealtimeScope() {}
+#endif
+
+  RealtimeScope(const RealtimeScope&) = delete;
+  RealtimeScope& operator=(const RealtimeScope&) = delete;
+};
+
+// Suspends the checks of the enclosing RealtimeScopes, for code which is known to allocate and
+// hasn't been made real-time safe yet.
+class NonRealtimeScope
+{
+public:
+#ifdef _DEBUG
+  NonRealtimeScope();
+  ~NonRealtimeScope();
+#else
+  NonRealtimeScope() = default;
+  ~NonRealtimeScope() {}
+#endif
+
+  NonRealtimeScope(const NonRealtimeScope&) = delete;
+  NonRealtimeScope& operator=(const NonRealtimeScope&) = delete;
+
+#ifdef _DEBUG
+private:
+  int m_saved_depth;
+#endif
+};
+}  // namespace AudioCommon
@@ -0,0 +1,210 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/Resampler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "Common/MathUtil.h"
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace AudioCommon
+{
+namespace
+{
+// Gives about 63 dB of stopband attenuation.
+constexpr double KAISER_BETA = 6.0;
+constexpr double KAISER_ATTENUATION = 63.0;
+
+u32 GetTapsForQuality(ResamplingQuality quality)
+{
+  switch (quality)
+  {
+  case ResamplingQuality::Medium:
+    return 16;
+  case ResamplingQuality::High:
+    return Resampler::MAX_TAPS;
+  default:
+    return 2;
+  }
+}
+
+// Zeroth order modified Bessel function of the first kind, which the Kaiser window is built from.
+// std::cyl_bessel_i isn't available on every standard library.
+double BesselI0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; k < 50 && term > sum * 1e-12; ++k)
+  {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+double WindowedSinc(double x, double half_width, double cutoff)
+{
+  const double t = x * cutoff * MathUtil::PI;
+  const double sinc = t == 0.0 ? 1.0 : std::sin(t) / t;
+  const double w = x / half_width;
+  const double window = BesselI0(KAISER_BETA * std::sqrt(std::max(0.0, 1.0 - w * w)));
+  return cutoff * sinc * window / BesselI0(KAISER_BETA);
+}
+}  // namespace
+
+void Resampler::SetFilter(ResamplingQuality quality, float max_cutoff)
+{
+  m_quality = quality;
+  m_max_cutoff = max_cutoff;
+  m_taps = GetTapsForQuality(quality);
+
+  const double history = GetHistory();
+  const double half_width = m_taps / 2.0;
+
+  // Center the transition band of the window, whose width follows from the tap count, so that it
+  // ends at max_cutoff.
+  const double transition = (KAISER_ATTENUATION - 8.0) / (2.285 * (m_taps - 1) * MathUtil::PI);
+  const double cutoff = max_cutoff * std::max(0.5, 1.0 - transition / 2);
+
+  const auto compute_row = [&](u32 phase, float* row) {
+    const double frac = static_cast<double>(phase) / NUM_PHASES;
+
+    std::array<double, MAX_TAPS> h;
+    for (u32 tap = 0; tap < m_taps; ++tap)
+    {
+      // Distance of this tap from the position being interpolated, in input frames.
+      const double x = tap - history - frac;
+      h[tap] = quality == ResamplingQuality::Linear ? std::max(0.0, 1.0 - std::abs(x)) :
+                                                      WindowedSinc(x, half_width, cutoff);
+    }
+
+    // Give every phase a DC gain of exactly 1, so the gain doesn't vary with the position.
+    double sum = 0.0;
+    for (u32 tap = 0; tap < m_taps; ++tap)
+      sum += h[tap];
+    for (u32 tap = 0; tap < m_taps; ++tap)
+      row[tap] = static_cast<float>(h[tap] / sum);
+  };
+
+  for (u32 phase = 0; phase < NUM_PHASES; ++phase)
+    compute_row(phase, &m_coefficients[phase * m_taps]);
+
+  // The last phase is interpolated towards one more phase than the table has.
+  std::array<float, MAX_TAPS> last;
+  compute_row(NUM_PHASES, last.data());
+  for (u32 phase = 0; phase < NUM_PHASES; ++phase)
+  {
+    const float* row = &m_coefficients[phase * m_taps];
+    const float* next_row = phase + 1 < NUM_PHASES ? row + m_taps : last.data();
+    for (u32 tap = 0; tap < m_taps; ++tap)
+      m_deltas[phase * m_taps + tap] = next_row[tap] - row[tap];
+  }
+}
+
+u32 Resampler::Process(const s16* input, u32 input_frames, u32* position, u32 step,
+                       float* output, u32 count, float volume0, float volume1) const
+{
+  const u32 taps = m_taps;
+  u32 pos = *position;
+
+#if defined(_M_X86_64)
+  const __m128 volumes = _mm_setr_ps(volume0, volume1, 0.0f, 0.0f);
+#elif defined(_M_ARM_64)
+  const float volume_array[2] = {volume0, volume1};
+  const float32x2_t volumes = vld1_f32(volume_array);
+#endif
+
+  u32 n = 0;
+  for (; n < count; ++n)
+  {
+    const u32 first = pos >> 16;
+    if (first + taps > input_frames)
+      break;
+
+    const s16* in = &input[first * 2];
+    const u32 row = ((pos & 0xFFFF) >> (16 - PHASE_BITS)) * taps;
+    const float* c = &m_coefficients[row];
+    const float* d = &m_deltas[row];
+    const float blend =
+        static_cast<float>(pos & ((1 << (16 - PHASE_BITS)) - 1)) / (1 << (16 - PHASE_BITS));
+    float* out = &output[n * 2];
+
+#if defined(_M_X86_64)
+    // Four frames at a time, with the lanes alternating between the two channels.
+    const __m128 blend_vec = _mm_set1_ps(blend);
+    __m128 acc = _mm_setzero_ps();
+    u32 t = 0;
+    for (; t + 4 <= taps; t += 4)
+    {
+      const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + t * 2));
+      const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+      const __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+      const __m128 coeffs =
+          _mm_add_ps(_mm_loadu_ps(c + t), _mm_mul_ps(_mm_loadu_ps(d + t), blend_vec));
+      acc = _mm_add_ps(acc, _mm_mul_ps(lo, _mm_unpacklo_ps(coeffs, coeffs)));
+      acc = _mm_add_ps(acc, _mm_mul_ps(hi, _mm_unpackhi_ps(coeffs, coeffs)));
+    }
+    if (t < taps)
+    {
+      // The tap count is always even, so at most two frames are left.
+      const __m128i s = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + t * 2));
+      const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+      const __m128 coeffs = _mm_add_ps(
+          _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(c + t))),
+          _mm_mul_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(d + t))),
+                     blend_vec));
+      acc = _mm_add_ps(acc, _mm_mul_ps(lo, _mm_unpacklo_ps(coeffs, coeffs)));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+
+    __m128 mixed = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(out)));
+    mixed = _mm_add_ps(mixed, _mm_mul_ps(acc, volumes));
+    _mm_storel_pi(reinterpret_cast<__m64*>(out), mixed);
+#elif defined(_M_ARM_64)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    u32 t = 0;
+    for (; t + 4 <= taps; t += 4)
+    {
+      const int16x8_t s = vld1q_s16(in + t * 2);
+      const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+      const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+      const float32x4_t coeffs = vmlaq_n_f32(vld1q_f32(c + t), vld1q_f32(d + t), blend);
+      acc = vmlaq_f32(acc, lo, vzip1q_f32(coeffs, coeffs));
+      acc = vmlaq_f32(acc, hi, vzip2q_f32(coeffs, coeffs));
+    }
+    if (t < taps)
+    {
+      const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vld1_s16(in + t * 2)));
+      const float32x2_t coeffs = vmla_n_f32(vld1_f32(c + t), vld1_f32(d + t), blend);
+      acc = vmlaq_f32(acc, lo, vcombine_f32(vzip1_f32(coeffs, coeffs), vzip2_f32(coeffs, coeffs)));
+    }
+    const float32x2_t sum = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    vst1_f32(out, vmla_f32(vld1_f32(out), sum, volumes));
+#else
+    float acc0 = 0.0f;
+    float acc1 = 0.0f;
+    for (u32 t = 0; t < taps; ++t)
+    {
+      const float coeff = c[t] + d[t] * blend;
+      acc0 += in[t * 2] * coeff;
+      acc1 += in[t * 2 + 1] * coeff;
+    }
+    out[0] += acc0 * volume0;
+    out[1] += acc1 * volume1;
+#endif
+
+    pos += step;
+  }
+
+  *position = pos;
+  return n;
+}
+}  // namespace AudioCommon
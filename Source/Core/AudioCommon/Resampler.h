@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "AudioCommon/Enums.h"
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// Polyphase FIR resampler for interleaved stereo s16 samples. Linear quality is a two tap
+// triangle filter, the other qualities are Kaiser windowed sincs. The coefficients are linearly
+// interpolated between the phases of the table, and the filter is evaluated in float with SSE2
+// or NEON.
+class Resampler
+{
+public:
+  static constexpr u32 PHASE_BITS = 7;
+  static constexpr u32 NUM_PHASES = 1 << PHASE_BITS;
+  static constexpr u32 MAX_TAPS = 32;
+
+  Resampler() { SetFilter(ResamplingQuality::Linear, 1.0f); }
+
+  // max_cutoff is the frequency the stopband starts at, relative to the Nyquist frequency of the
+  // input. It should be lowered below 1 when the output sample rate is lower than the input one.
+  void SetFilter(ResamplingQuality quality, float max_cutoff);
+  ResamplingQuality GetQuality() const { return m_quality; }
+  float GetMaxCutoff() const { return m_max_cutoff; }
+
+  // Number of input frames the filter covers for each output frame.
+  u32 GetTaps() const { return m_taps; }
+  // Number of those frames which come before the position being interpolated.
+  u32 GetHistory() const { return m_taps / 2 - 1; }
+
+  // Adds up to count resampled frames, scaled by the volume of each channel, to output.
+  //
+  // position is the 16.16 fixed point position of the next output frame, relative to input plus
+  // GetHistory() frames, and is advanced by step after every output frame. Output stops early
+  // once the filter would read past input_frames. Returns the number of frames added.
+  u32 Process(const s16* input, u32 input_frames, u32* position, u32 step, float* output,
+              u32 count, float volume0, float volume1) const;
+
+private:
+  ResamplingQuality m_quality{};
+  float m_max_cutoff = 0.0f;
+  u32 m_taps = 0;
+  // NUM_PHASES rows of m_taps coefficients, and the difference of each to the next phase. They
+  // have a fixed size, so that changing the filter doesn't allocate on the audio thread.
+  std::array<float, NUM_PHASES * MAX_TAPS> m_coefficients{};
+  std::array<float, NUM_PHASES * MAX_TAPS> m_deltas{};
+};
+}  // namespace AudioCommon
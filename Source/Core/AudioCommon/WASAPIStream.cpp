@@ -316,6 +316,11 @@ bool WASAPIStream::SetRunning(bool running)
   return true;
 }
 
+void WASAPIStream::SetVolume(int volume)
+{
+  m_volume.store(volume, std::memory_order_relaxed);
+}
+
 void WASAPIStream::SoundLoop()
 {
   Common::SetCurrentThreadName("WASAPI Handler");
@@ -333,16 +338,16 @@ void WASAPIStream::SoundLoop()
     s16* audio_data = reinterpret_cast<s16*>(data);
     GetMixer()->Mix(audio_data, m_frames_in_buffer);
 
-    const bool is_muted =
-        Config::Get(Config::MAIN_AUDIO_MUTED) || Config::Get(Config::MAIN_AUDIO_VOLUME) == 0;
-    const bool need_volume_adjustment = Config::Get(Config::MAIN_AUDIO_VOLUME) != 100 && !is_muted;
+    // Reading the config takes a lock, so the volume is only updated through SetVolume.
+    const int volume = m_volume.load(std::memory_order_relaxed);
+    const bool is_muted = volume == 0;
 
-    if (need_volume_adjustment)
+    if (volume != 100 && !is_muted)
     {
-      const float volume = Config::Get(Config::MAIN_AUDIO_VOLUME) / 100.0f;
+      const float factor = volume / 100.0f;
 
       for (u32 i = 0; i < m_frames_in_buffer * 2; i++)
-        *audio_data++ *= volume;
+        *audio_data++ *= factor;
     }
 
     m_audio_renderer->ReleaseBuffer(m_frames_in_buffer, is_muted ? AUDCLNT_BUFFERFLAGS_SILENT : 0);
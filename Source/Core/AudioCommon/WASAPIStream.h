@@ -35,6 +35,7 @@ public:
   ~WASAPIStream();
   bool Init() override;
   bool SetRunning(bool running) override;
+  void SetVolume(int volume) override;
 
   static bool IsValid();
   static std::vector<std::string> GetAvailableDevices();
@@ -45,6 +46,8 @@ private:
 
   u32 m_frames_in_buffer = 0;
   std::atomic<bool> m_running = false;
+  // 0 while muted.
+  std::atomic<int> m_volume = 100;
   std::thread m_thread;
 
   // CoUninitialize must be called after all WASAPI COM objects have been destroyed,
@@ -4,6 +4,8 @@
 #include "AudioCommon/WaveFile.h"
 #include "AudioCommon/Mixer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 
 #include <fmt/format.h>
@@ -13,13 +15,29 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/System.h"
 
 constexpr size_t WaveFileWriter::BUFFER_SIZE;
 
+namespace
+{
+// Layout of the header: RIFF, bext, fmt and data chunks.
+constexpr u32 BEXT_SIZE = 602;
+constexpr u32 BEXT_ORIGINATOR_OFFSET = 256;
+constexpr u32 BEXT_VERSION_OFFSET = 346;
+constexpr u32 TIME_REFERENCE_POS = 20 + 338;
+constexpr u32 DATA_SIZE_POS = 20 + BEXT_SIZE + 24 + 4;
+constexpr u32 HEADER_SIZE = DATA_SIZE_POS + 4;
+}  // namespace
+
 WaveFileWriter::WaveFileWriter()
 {
 }
@@ -30,6 +48,55 @@ WaveFileWriter::~WaveFileWriter()
 }
 
 bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
+{
+  if (thread.joinable())
+  {
+    PanicAlertFmtT("The file {0} was already open, the file header will not be written.", filename);
+    return false;
+  }
+
+  if (!OpenFile(filename, sample_rate_divisor))
+    return false;
+
+  ticks_per_second = Core::System::GetInstance().GetSystemTimers().GetTicksPerSecond();
+  ring.resize(RING_SIZE);
+  write_pos.store(0, std::memory_order_relaxed);
+  read_pos.store(0, std::memory_order_relaxed);
+  dropped_samples.store(0, std::memory_order_relaxed);
+  thread = std::thread(&WaveFileWriter::WriterThread, this);
+  accepting.store(true);
+  return true;
+}
+
+void WaveFileWriter::Stop()
+{
+  if (thread.joinable())
+  {
+    accepting.store(false);
+    while (active_producers.load() != 0)
+      std::this_thread::yield();
+
+    // The writer thread stops once it reaches an empty record.
+    const RecordHeader end{};
+    const u64 pos = write_pos.load(std::memory_order_relaxed);
+    while (pos + sizeof(end) - read_pos.load(std::memory_order_acquire) > RING_SIZE)
+      Common::SleepCurrentThread(1);
+    WriteToRing(pos, &end, sizeof(end));
+    write_pos.store(pos + sizeof(end), std::memory_order_release);
+    write_pos.notify_one();
+    thread.join();
+
+    if (const u32 dropped = dropped_samples.load(std::memory_order_relaxed))
+    {
+      WARN_LOG_FMT(AUDIO, "WaveFileWriter - dropped {} samples, writing the file was too slow.",
+                   dropped);
+    }
+  }
+
+  CloseFile();
+}
+
+bool WaveFileWriter::OpenFile(const std::string& filename, u32 sample_rate_divisor)
 {
   // Ask to delete file
   if (File::Exists(filename))
@@ -64,6 +131,7 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
   }
 
   audio_size = 0;
+  has_start_ticks = false;
 
   if (basename.empty())
     SplitPath(filename, nullptr, &basename, nullptr);
@@ -76,8 +144,16 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
   Write4("RIFF");
   Write(100 * 1000 * 1000);  // write big value in case the file gets truncated
   Write4("WAVE");
-  Write4("fmt ");
 
+  // Broadcast wave extension, only for the time reference, which is filled in on closing.
+  Write4("bext");
+  Write(BEXT_SIZE);
+  std::array<char, BEXT_SIZE> bext{};
+  std::memcpy(&bext[BEXT_ORIGINATOR_OFFSET], "Dolphin", 7);
+  bext[BEXT_VERSION_OFFSET] = 1;
+  file.WriteBytes(bext.data(), bext.size());
+
+  Write4("fmt ");
   Write(16);          // size of fmt block
   Write(0x00020001);  // two channels, uncompressed
 
@@ -87,23 +163,36 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
 
   Write(0x00100004);
   Write4("data");
-  Write(100 * 1000 * 1000 - 32);
+  Write(100 * 1000 * 1000 - (HEADER_SIZE - 8));
 
-  // We are now at offset 44
-  if (file.Tell() != 44)
+  if (file.Tell() != HEADER_SIZE)
     PanicAlertFmt("Wrong offset: {}", file.Tell());
 
   return true;
 }
 
-void WaveFileWriter::Stop()
+void WaveFileWriter::CloseFile()
 {
+  if (!file)
+    return;
+
   file.Seek(4, File::SeekOrigin::Begin);
-  Write(audio_size + 36);
+  Write(audio_size + HEADER_SIZE - 8);
 
-  file.Seek(40, File::SeekOrigin::Begin);
+  file.Seek(DATA_SIZE_POS, File::SeekOrigin::Begin);
   Write(audio_size);
 
+  if (has_start_ticks)
+  {
+    // In samples since the emulated system started, split to not overflow.
+    const u64 sample_rate = Mixer::FIXED_SAMPLE_RATE_DIVIDEND / current_sample_rate_divisor;
+    const u64 time_reference = start_ticks / ticks_per_second * sample_rate +
+                               start_ticks % ticks_per_second * sample_rate / ticks_per_second;
+    file.Seek(TIME_REFERENCE_POS, File::SeekOrigin::Begin);
+    Write(static_cast<u32>(time_reference));
+    Write(static_cast<u32>(time_reference >> 32));
+  }
+
   file.Close();
 }
 
@@ -117,10 +206,30 @@ void WaveFileWriter::Write4(const char* ptr)
   file.WriteBytes(ptr, 4);
 }
 
+void WaveFileWriter::WriteToRing(u64 pos, const void* data, size_t size)
+{
+  const size_t offset = pos % RING_SIZE;
+  const size_t first = std::min(size, RING_SIZE - offset);
+  std::memcpy(&ring[offset], data, first);
+  std::memcpy(ring.data(), static_cast<const u8*>(data) + first, size - first);
+}
+
+void WaveFileWriter::ReadFromRing(u64 pos, void* data, size_t size) const
+{
+  const size_t offset = pos % RING_SIZE;
+  const size_t first = std::min(size, RING_SIZE - offset);
+  std::memcpy(data, &ring[offset], first);
+  std::memcpy(static_cast<u8*>(data) + first, ring.data(), size - first);
+}
+
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
                                         u32 sample_rate_divisor, int l_volume, int r_volume)
 {
-  if (!file)
+  // Stop waits for the calls which got past this check, so that there is only ever one thread
+  // writing to the ring.
+  active_producers.fetch_add(1);
+  Common::ScopeGuard producer_guard([this] { active_producers.fetch_sub(1); });
+  if (!accepting.load())
   {
     ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
     return;
@@ -132,6 +241,9 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
     return;
   }
 
+  if (count == 0)
+    return;
+
   if (skip_silence)
   {
     bool all_zero = true;
@@ -146,27 +258,88 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
       return;
   }
 
-  for (u32 i = 0; i < count; i++)
+  const RecordHeader header{count, sample_rate_divisor, l_volume, r_volume,
+                            Core::System::GetInstance().GetCoreTiming().GetTicks()};
+  const size_t size = sizeof(header) + count * 4;
+  const u64 pos = write_pos.load(std::memory_order_relaxed);
+
+  // Never wait for the disk here, this is called while emulating.
+  if (pos + size - read_pos.load(std::memory_order_acquire) > RING_SIZE)
   {
-    // Flip the audio channels from RL to LR
-    conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
-    conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
+    dropped_samples.fetch_add(count, std::memory_order_relaxed);
+    return;
+  }
 
-    // Apply volume (volume ranges from 0 to 256)
-    conv_buffer[2 * i] = conv_buffer[2 * i] * l_volume / 256;
-    conv_buffer[2 * i + 1] = conv_buffer[2 * i + 1] * r_volume / 256;
+  WriteToRing(pos, &header, sizeof(header));
+  WriteToRing(pos + sizeof(header), sample_data, count * 4);
+  write_pos.store(pos + size, std::memory_order_release);
+  write_pos.notify_one();
+}
+
+void WaveFileWriter::WriterThread()
+{
+  Common::SetCurrentThreadName("Audio dump");
+
+  u64 pos = read_pos.load(std::memory_order_relaxed);
+  while (true)
+  {
+    const u64 end = write_pos.load(std::memory_order_acquire);
+    if (pos == end)
+    {
+      write_pos.wait(end, std::memory_order_acquire);
+      continue;
+    }
+
+    RecordHeader header;
+    ReadFromRing(pos, &header, sizeof(header));
+    pos += sizeof(header);
+    if (header.count == 0)
+      break;
+
+    // Copied out first, so that the ring has room again while the file is being written.
+    ReadFromRing(pos, raw_buffer.data(), header.count * 4);
+    pos += header.count * 4;
+    read_pos.store(pos, std::memory_order_release);
+
+    WriteSamples(header);
   }
 
-  if (sample_rate_divisor != current_sample_rate_divisor)
+  read_pos.store(pos, std::memory_order_release);
+}
+
+void WaveFileWriter::WriteSamples(const RecordHeader& header)
+{
+  if (header.sample_rate_divisor != current_sample_rate_divisor)
   {
-    Stop();
+    CloseFile();
     file_index++;
     const std::string filename =
         fmt::format("{}{}{}.wav", File::GetUserPath(D_DUMPAUDIO_IDX), basename, file_index);
-    Start(filename, sample_rate_divisor);
-    current_sample_rate_divisor = sample_rate_divisor;
+    OpenFile(filename, header.sample_rate_divisor);
+    current_sample_rate_divisor = header.sample_rate_divisor;
+  }
+
+  if (!file)
+    return;
+
+  if (!has_start_ticks)
+  {
+    has_start_ticks = true;
+    start_ticks = header.ticks;
+  }
+
+  const short* sample_data = raw_buffer.data();
+  for (u32 i = 0; i < header.count; i++)
+  {
+    // Flip the audio channels from RL to LR
+    conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
+    conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
+
+    // Apply volume (volume ranges from 0 to 256)
+    conv_buffer[2 * i] = conv_buffer[2 * i] * header.l_volume / 256;
+    conv_buffer[2 * i + 1] = conv_buffer[2 * i + 1] * header.r_volume / 256;
   }
 
-  file.WriteBytes(conv_buffer.data(), count * 4);
-  audio_size += count * 4;
+  file.WriteBytes(conv_buffer.data(), header.count * 4);
+  audio_size += header.count * 4;
 }
@@ -5,16 +5,21 @@
 // Class: WaveFileWriter
 // Description: Simple utility class to make it easy to write long 16-bit stereo
 // audio streams to disk.
-// Use Start() to start recording to a file, and AddStereoSamples to add wave data.
-// The float variant will convert from -1.0-1.0 range and clamp.
-// Alternatively, AddSamplesBE for big endian wave data.
+// Use Start() to start recording to a file, and AddStereoSamplesBE to add wave data.
+// The samples are only copied to a ring buffer there; converting and writing them
+// happens on a thread of the writer, so that dumping doesn't stall emulation.
+// Each file gets a bext chunk whose time reference is the emulated time of its first
+// sample, in samples since the emulated system started, to line it up with frame dumps.
 // If Stop is not called when it destructs, the destructor will call Stop().
 // ---------------------------------------------------------------------------------
 
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -37,10 +42,29 @@ public:
   // big endian
   void AddStereoSamplesBE(const short* sample_data, u32 count, u32 sample_rate_divisor,
                           int l_volume, int r_volume);
-  u32 GetAudioSize() const { return audio_size; }
 
 private:
   static constexpr size_t BUFFER_SIZE = 32 * 1024;
+  // About 10 seconds of 48 kHz audio.
+  static constexpr size_t RING_SIZE = 4 * 1024 * 1024;
+
+  // Precedes the samples of every AddStereoSamplesBE call in the ring. A count of 0 tells the
+  // writer thread to stop.
+  struct RecordHeader
+  {
+    u32 count;
+    u32 sample_rate_divisor;
+    s32 l_volume;
+    s32 r_volume;
+    u64 ticks;
+  };
+
+  bool OpenFile(const std::string& filename, u32 sample_rate_divisor);
+  void CloseFile();
+  void WriterThread();
+  void WriteSamples(const RecordHeader& header);
+  void WriteToRing(u64 pos, const void* data, size_t size);
+  void ReadFromRing(u64 pos, void* data, size_t size) const;
 
   void Write(u32 value);
   void Write4(const char* ptr);
@@ -49,9 +73,23 @@ private:
   std::string basename;
   u32 file_index = 0;
   u32 audio_size = 0;
+  u32 ticks_per_second = 0;
+  // The emulated time of the first sample in the file, if it has one.
+  bool has_start_ticks = false;
+  u64 start_ticks = 0;
 
   u32 current_sample_rate_divisor;
   std::array<short, BUFFER_SIZE> conv_buffer{};
+  std::array<short, BUFFER_SIZE> raw_buffer{};
 
   bool skip_silence = false;
+
+  // Single producer single consumer ring. The positions only ever increase.
+  std::vector<u8> ring;
+  std::atomic<u64> write_pos = 0;
+  std::atomic<u64> read_pos = 0;
+  std::atomic<u32> dropped_samples = 0;
+  std::atomic<bool> accepting = false;
+  std::atomic<u32> active_producers = 0;
+  std::thread thread;
 };
@@ -12,6 +12,7 @@
 // - Zero backwards/forwards compatibility
 // - Serialization code for anything complex has to be manually written.
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
@@ -48,15 +49,34 @@ public:
 
 private:
   u8** m_ptr_current;
+  u8* m_ptr_start;
   u8* m_ptr_end;
   Mode m_mode;
 
+  // Only set in growable write mode
+  std::vector<u8>* m_growable_buffer = nullptr;
+  u8* m_growable_ptr = nullptr;
+
 public:
   PointerWrap(u8** ptr, size_t size, Mode mode)
-      : m_ptr_current(ptr), m_ptr_end(*ptr + size), m_mode(mode)
+      : m_ptr_current(ptr), m_ptr_start(*ptr), m_ptr_end(*ptr + size), m_mode(mode)
+  {
+  }
+
+  // Write mode which grows the buffer when it runs out of room, so that the size doesn't have to
+  // be measured first. Afterwards, the buffer has to be resized to GetPosition(). Pointers into
+  // the buffer are invalidated whenever it grows, so use positions to refer back to earlier data.
+  explicit PointerWrap(std::vector<u8>* buffer)
+      : m_ptr_current(&m_growable_ptr), m_ptr_start(buffer->data()),
+        m_ptr_end(buffer->data() + buffer->size()), m_mode(Mode::Write), m_growable_buffer(buffer),
+        m_growable_ptr(buffer->data())
   {
   }
 
+  // m_ptr_current may point into the object itself.
+  PointerWrap(const PointerWrap&) = delete;
+  PointerWrap& operator=(const PointerWrap&) = delete;
+
   void SetMeasureMode() { m_mode = Mode::Measure; }
   void SetVerifyMode() { m_mode = Mode::Verify; }
   bool IsReadMode() const { return m_mode == Mode::Read; }
@@ -219,32 +239,32 @@ public:
   [[nodiscard]] u8* DoExternal(u32& count)
   {
     Do(count);
+    CheckRoom(count);
     u8* current = *m_ptr_current;
     *m_ptr_current += count;
-    if (!IsMeasureMode() && *m_ptr_current > m_ptr_end)
-    {
-      // trying to read/write past the end of the buffer, prevent this
-      SetMeasureMode();
-    }
     return current;
   }
 
-  // The reserved u32 is set to 0, and a pointer to it is returned.
-  // The caller needs to fill in the reserved u32 with the appropriate value later on, if they
+  // The reserved u32 is set to 0, and its position is returned.
+  // The caller needs to fill in the reserved u32 with WriteReservedU32 later on, if they
   // want a non-zero value there.
-  [[nodiscard]] u8* ReserveU32()
+  [[nodiscard]] size_t ReserveU32()
   {
     u32 temp = 0;
-    u8* previous_pointer = *m_ptr_current;
+    const size_t position = GetPosition();
     Do(temp);
-    return previous_pointer;
+    return position;
   }
 
-  u32 GetOffsetFromPreviousPosition(u8* previous_pointer)
+  void WriteReservedU32(size_t position, u32 value)
   {
-    return static_cast<u32>((*m_ptr_current) - previous_pointer);
+    if (IsWriteMode())
+      std::memcpy(m_ptr_start + position, &value, sizeof(u32));
   }
 
+  // The number of bytes read, written or measured so far
+  size_t GetPosition() const { return static_cast<size_t>(*m_ptr_current - m_ptr_start); }
+
   void Do(Common::Flag& flag)
   {
     bool s = flag.IsSet();
@@ -343,13 +363,37 @@ private:
     DoEachElement(x, [](PointerWrap& p, typename T::value_type& elem) { p.Do(elem); });
   }
 
-  DOLPHIN_FORCE_INLINE void DoVoid(void* data, u32 size)
+  DOLPHIN_FORCE_INLINE void CheckRoom(u32 size)
   {
-    if (!IsMeasureMode() && (*m_ptr_current + size) > m_ptr_end)
+    if (!IsMeasureMode() && size > static_cast<size_t>(m_ptr_end - *m_ptr_current))
     {
-      // trying to read/write past the end of the buffer, prevent this
-      SetMeasureMode();
+      if (m_growable_buffer)
+      {
+        Grow(size);
+      }
+      else
+      {
+        // trying to read/write past the end of the buffer, prevent this
+        SetMeasureMode();
+      }
     }
+  }
+
+  void Grow(u32 size)
+  {
+    // Doubling keeps the cost of copying the buffer when it grows proportional to its final size.
+    constexpr size_t MIN_GROWABLE_SIZE = 0x10000;
+    const size_t position = GetPosition();
+    m_growable_buffer->resize(std::max({position + size, m_growable_buffer->capacity(),
+                                        m_growable_buffer->size() * 2, MIN_GROWABLE_SIZE}));
+    m_ptr_start = m_growable_buffer->data();
+    m_ptr_end = m_ptr_start + m_growable_buffer->size();
+    *m_ptr_current = m_ptr_start + position;
+  }
+
+  DOLPHIN_FORCE_INLINE void DoVoid(void* data, u32 size)
+  {
+    CheckRoom(size);
 
     switch (m_mode)
     {
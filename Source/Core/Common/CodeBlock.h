@@ -49,11 +49,12 @@ public:
   CodeBlock& operator=(CodeBlock&&) = delete;
 
   // Call this before you generate any code.
-  void AllocCodeSpace(size_t size)
+  void AllocCodeSpace(size_t size, bool use_large_pages = false)
   {
     region_size = size;
     total_region_size = size;
-    region = static_cast<u8*>(Common::AllocateExecutableMemory(total_region_size));
+    region =
+        static_cast<u8*>(Common::AllocateExecutableMemory(total_region_size, use_large_pages));
     T::SetCodePtr(region, region + size);
   }
 
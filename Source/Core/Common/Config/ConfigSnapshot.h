@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <utility>
+
+#include "Common/Config/Config.h"
+
+namespace Config
+{
+// Refreshes a Snapshot on whichever thread changed the config.
+struct AnyThreadCallbacks
+{
+  static ConfigChangedCallbackID Add(ConfigChangedCallback callback)
+  {
+    return AddConfigChangedCallback(std::move(callback));
+  }
+  static void Remove(ConfigChangedCallbackID callback_id)
+  {
+    RemoveConfigChangedCallback(callback_id);
+  }
+};
+
+// A struct of config values which is reloaded every time the config changes, for code that reads
+// config values too often for Config::Get, which checks the config version and takes a lock every
+// time. Reading a snapshot is a plain memory access, like reading g_ActiveConfig.
+//
+// Callbacks decides which thread the values are reloaded on. Code that runs on the CPU thread
+// should use CPUThreadConfigCallback::Callbacks, so that the values can't change under it.
+template <typename T, typename Callbacks = AnyThreadCallbacks>
+class Snapshot final
+{
+public:
+  // Fills in every field of the struct, using Config::Get.
+  using Loader = void (*)(T&);
+
+  Snapshot() = default;
+  ~Snapshot() { Shutdown(); }
+
+  Snapshot(const Snapshot&) = delete;
+  Snapshot(Snapshot&&) = delete;
+  Snapshot& operator=(const Snapshot&) = delete;
+  Snapshot& operator=(Snapshot&&) = delete;
+
+  void Init(Loader load)
+  {
+    Shutdown();
+    m_load = load;
+    m_load(m_values);
+    m_callback_id = Callbacks::Add([this] { m_load(m_values); });
+  }
+
+  void Shutdown()
+  {
+    if (!m_load)
+      return;
+    Callbacks::Remove(m_callback_id);
+    m_load = nullptr;
+  }
+
+  const T& operator*() const { return m_values; }
+  const T* operator->() const { return &m_values; }
+
+private:
+  T m_values{};
+  Loader m_load = nullptr;
+  decltype(Callbacks::Add({})) m_callback_id{};
+};
+}  // namespace Config
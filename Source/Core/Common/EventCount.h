@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// An event count lets threads wait for a condition that other threads make true without a lock,
+// for example for a lock-free queue to become non-empty. Notifying is just an atomic load as
+// long as nobody is waiting, so producers can notify after every change without paying for a
+// system call each time.
+//
+// A waiter does:
+//   while (true)
+//   {
+//     const auto key = event_count.PrepareWait();
+//     if (condition)
+//     {
+//       event_count.CancelWait();
+//       break;
+//     }
+//     event_count.Wait(key);
+//   }
+// and a notifier makes the condition true, then calls NotifyAll(). Since a notification that
+// happens after PrepareWait() changes the key, it can't be lost between checking the condition
+// and waiting.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+class EventCount final
+{
+public:
+  using Key = u32;
+
+  Key PrepareWait()
+  {
+    m_waiters.fetch_add(1, std::memory_order_relaxed);
+    // Pairs with the fence in NotifyAll: either the notifier sees this waiter, or the waiter sees
+    // the change the notifier made before notifying.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return m_epoch.load(std::memory_order_relaxed);
+  }
+
+  void CancelWait() { m_waiters.fetch_sub(1, std::memory_order_relaxed); }
+
+  void Wait(Key key)
+  {
+    std::unique_lock lk(m_mutex);
+    m_condvar.wait(lk, [&] { return m_epoch.load(std::memory_order_relaxed) != key; });
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Returns false on timeout. Like Wait, this ends the wait either way.
+  template <class Rep, class Period>
+  bool WaitFor(Key key, const std::chrono::duration<Rep, Period>& rel_time)
+  {
+    std::unique_lock lk(m_mutex);
+    const bool notified = m_condvar.wait_for(
+        lk, rel_time, [&] { return m_epoch.load(std::memory_order_relaxed) != key; });
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    return notified;
+  }
+
+  void NotifyAll()
+  {
+    // Orders the change the waiters are waiting for before checking for waiters.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiters.load(std::memory_order_relaxed) == 0)
+      return;
+
+    {
+      std::lock_guard lk(m_mutex);
+      m_epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_condvar.notify_all();
+  }
+
+private:
+  std::atomic<Key> m_epoch = 0;
+  std::atomic<u32> m_waiters = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_condvar;
+};
+}  // namespace Common
@@ -6,9 +6,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -606,8 +608,52 @@ bool SyncSDFolderToSDImage(const std::function<bool()>& cancelled, bool determin
   return true;
 }
 
+namespace
+{
+struct UnpackState
+{
+  std::vector<u8> tmp_buffer = std::vector<u8>(MAX_CLUSTER_SIZE);
+  std::vector<u8> compare_buffer = std::vector<u8>(MAX_CLUSTER_SIZE);
+
+  // Files that were moved over from the previous SD folder because they hadn't changed, as pairs
+  // of their previous and new paths. They are moved back if unpacking fails.
+  std::vector<std::pair<std::string, std::string>> reused_files;
+};
+}  // namespace
+
+// Returns whether the host file has the same contents as the open file in the SD image.
+static bool IsFileUnchanged(const std::function<bool()>& cancelled, FIL* src,
+                            const std::string& host_path, UnpackState& state)
+{
+  File::IOFile host_file(host_path, "rb");
+  if (!host_file || host_file.GetSize() != f_size(src))
+    return false;
+
+  u32 size = f_size(src);
+  while (size > 0)
+  {
+    if (cancelled())
+      return false;
+
+    const u32 chunk_size = std::min(size, static_cast<u32>(state.tmp_buffer.size()));
+    u32 read_size;
+    if (f_read(src, state.tmp_buffer.data(), chunk_size, &read_size) != FR_OK ||
+        read_size != chunk_size ||
+        !host_file.ReadBytes(state.compare_buffer.data(), chunk_size) ||
+        std::memcmp(state.tmp_buffer.data(), state.compare_buffer.data(), chunk_size) != 0)
+    {
+      return false;
+    }
+
+    size -= chunk_size;
+  }
+
+  return true;
+}
+
 static bool Unpack(const std::function<bool()>& cancelled, const std::string path,
-                   bool is_directory, const char* name, std::vector<u8>& tmp_buffer)
+                   const std::string& previous_path, bool is_directory, const char* name,
+                   UnpackState& state)
 {
   if (cancelled())
     return false;
@@ -623,6 +669,30 @@ static bool Unpack(const std::function<bool()>& cancelled, const std::string pat
       return false;
     }
 
+    // Rewriting every file on each sync is slow for large folders and needlessly touches files on
+    // the host, so files that are unchanged since the last sync are moved over instead.
+    if (!previous_path.empty() && IsFileUnchanged(cancelled, &src, previous_path, state) &&
+        File::Rename(previous_path, path))
+    {
+      state.reused_files.emplace_back(previous_path, path);
+      const auto close_error_code = f_close(&src);
+      if (close_error_code != FR_OK)
+      {
+        ERROR_LOG_FMT(COMMON, "Failed to close file {} in SD image: {}", path,
+                      FatFsErrorToString(close_error_code));
+        return false;
+      }
+      return true;
+    }
+
+    const auto seek_error_code = f_lseek(&src, 0);
+    if (seek_error_code != FR_OK)
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to seek in file {} in SD image: {}", path,
+                    FatFsErrorToString(seek_error_code));
+      return false;
+    }
+
     File::IOFile dst(path, "wb");
     if (!dst)
     {
@@ -636,9 +706,9 @@ static bool Unpack(const std::function<bool()>& cancelled, const std::string pat
       if (cancelled())
         return false;
 
-      u32 chunk_size = std::min(size, static_cast<u32>(tmp_buffer.size()));
+      u32 chunk_size = std::min(size, static_cast<u32>(state.tmp_buffer.size()));
       u32 read_size;
-      const auto read_error_code = f_read(&src, tmp_buffer.data(), chunk_size, &read_size);
+      const auto read_error_code = f_read(&src, state.tmp_buffer.data(), chunk_size, &read_size);
       if (read_error_code != FR_OK)
       {
         ERROR_LOG_FMT(COMMON, "Failed to read from file {} in SD image: {}", path,
@@ -653,7 +723,7 @@ static bool Unpack(const std::function<bool()>& cancelled, const std::string pat
         return false;
       }
 
-      if (!dst.WriteBytes(tmp_buffer.data(), chunk_size))
+      if (!dst.WriteBytes(state.tmp_buffer.data(), chunk_size))
       {
         ERROR_LOG_FMT(COMMON, "Failed to write to file {}", path);
         return false;
@@ -739,8 +809,10 @@ static bool Unpack(const std::function<bool()>& cancelled, const std::string pat
       return false;
     }
 
-    if (!Unpack(cancelled, fmt::format("{}/{}", path, childname), entry.fattrib & AM_DIR,
-                entry.fname, tmp_buffer))
+    const std::string previous_child_path =
+        previous_path.empty() ? std::string() : fmt::format("{}/{}", previous_path, childname);
+    if (!Unpack(cancelled, fmt::format("{}/{}", path, childname), previous_child_path,
+                entry.fattrib & AM_DIR, entry.fname, state))
     {
       return false;
     }
@@ -821,10 +893,13 @@ bool SyncSDImageToSDFolder(const std::function<bool()>& cancelled)
     }
   }
 
-  std::vector<u8> tmp_buffer(MAX_CLUSTER_SIZE);
-  if (!Unpack(cancelled, target_dir_without_slash, true, "", tmp_buffer))
+  UnpackState state;
+  if (!Unpack(cancelled, target_dir_without_slash,
+              target_dir_exists ? backup_target_dir_without_slash : std::string(), true, "", state))
   {
     ERROR_LOG_FMT(COMMON, "Failed to unpack SD image {} to {}", image_path, target_dir);
+    for (const auto& [previous_path, path] : state.reused_files)
+      File::Rename(path, previous_path);
     File::DeleteDirRecursively(target_dir_without_slash);
     if (target_dir_exists)
       File::Rename(backup_target_dir_without_slash, target_dir_without_slash);
@@ -124,28 +124,45 @@ bool IniFile::Section::GetLines(std::vector<std::string>* lines, const bool remo
 
 IniFile::IniFile() = default;
 
-IniFile::~IniFile() = default;
+IniFile::IniFile(const IniFile& other) : sections(other.sections)
+{
+  RebuildSectionIndex();
+}
 
-const IniFile::Section* IniFile::GetSection(std::string_view section_name) const
+// Moving a std::list keeps its elements where they are, so the index stays valid.
+IniFile::IniFile(IniFile&& other) = default;
+
+IniFile& IniFile::operator=(const IniFile& other)
 {
-  for (const Section& sect : sections)
+  if (this != &other)
   {
-    if (CaseInsensitiveStringCompare::IsEqual(sect.name, section_name))
-      return &sect;
+    sections = other.sections;
+    RebuildSectionIndex();
   }
+  return *this;
+}
+
+IniFile& IniFile::operator=(IniFile&& other) = default;
+
+IniFile::~IniFile() = default;
+
+void IniFile::RebuildSectionIndex()
+{
+  m_section_index.clear();
+  for (Section& section : sections)
+    m_section_index.emplace(section.name, &section);
+}
 
-  return nullptr;
+const IniFile::Section* IniFile::GetSection(std::string_view section_name) const
+{
+  const auto it = m_section_index.find(section_name);
+  return it != m_section_index.end() ? it->second : nullptr;
 }
 
 IniFile::Section* IniFile::GetSection(std::string_view section_name)
 {
-  for (Section& sect : sections)
-  {
-    if (CaseInsensitiveStringCompare::IsEqual(sect.name, section_name))
-      return &sect;
-  }
-
-  return nullptr;
+  const auto it = m_section_index.find(section_name);
+  return it != m_section_index.end() ? it->second : nullptr;
 }
 
 IniFile::Section* IniFile::GetOrCreateSection(std::string_view section_name)
@@ -153,28 +170,22 @@ IniFile::Section* IniFile::GetOrCreateSection(std::string_view section_name)
   Section* section = GetSection(section_name);
   if (!section)
   {
-    sections.emplace_back(std::string(section_name));
-    section = &sections.back();
+    section = &sections.emplace_back(std::string(section_name));
+    m_section_index.emplace(section->name, section);
   }
   return section;
 }
 
 bool IniFile::DeleteSection(std::string_view section_name)
 {
-  Section* s = GetSection(section_name);
-  if (!s)
+  const auto index_it = m_section_index.find(section_name);
+  if (index_it == m_section_index.end())
     return false;
 
-  for (auto iter = sections.begin(); iter != sections.end(); ++iter)
-  {
-    if (&(*iter) == s)
-    {
-      sections.erase(iter);
-      return true;
-    }
-  }
-
-  return false;
+  const Section* s = index_it->second;
+  m_section_index.erase(index_it);
+  sections.remove_if([s](const Section& section) { return &section == s; });
+  return true;
 }
 
 bool IniFile::Exists(std::string_view section_name) const
@@ -238,41 +249,33 @@ void IniFile::SortSections()
 bool IniFile::Load(const std::string& filename, bool keep_current_data)
 {
   if (!keep_current_data)
+  {
     sections.clear();
+    m_section_index.clear();
+  }
   // first section consists of the comments before the first real section
 
-  // Open file
-  std::ifstream in;
-  File::OpenFStream(in, filename, std::ios::in);
-
-  if (in.fail())
+  // Read the whole file at once and split it into lines in place, rather than copying every line.
+  std::string contents;
+  if (!File::ReadFileToString(filename, contents))
     return false;
 
-  Section* current_section = nullptr;
-  bool first_line = true;
-  while (!in.eof())
-  {
-    std::string line_str;
-    if (!std::getline(in, line_str))
-    {
-      if (in.eof())
-        return true;
-      else
-        return false;
-    }
+  std::string_view remaining = contents;
 
-    std::string_view line = line_str;
+  // Skips the UTF-8 BOM at the start of files. Notepad likes to add this.
+  if (remaining.starts_with("\xEF\xBB\xBF"))
+    remaining.remove_prefix(3);
 
-    // Skips the UTF-8 BOM at the start of files. Notepad likes to add this.
-    if (first_line && line.substr(0, 3) == "\xEF\xBB\xBF")
-      line.remove_prefix(3);
-    first_line = false;
+  Section* current_section = nullptr;
+  while (!remaining.empty())
+  {
+    const size_t line_end = remaining.find('\n');
+    std::string_view line = remaining.substr(0, line_end);
+    remaining.remove_prefix(line_end == std::string_view::npos ? remaining.size() : line_end + 1);
 
-#ifndef _WIN32
     // Check for CRLF eol and convert it to LF
     if (!line.empty() && line.back() == '\r')
       line.remove_suffix(1);
-#endif
 
     if (!line.empty())
     {
@@ -304,17 +307,28 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
           }
           else
           {
-            current_section->Set(key, value);
+            current_section->Set(key, std::move(value));
           }
         }
       }
     }
   }
 
-  in.close();
   return true;
 }
 
+void IniFile::Merge(const IniFile& other)
+{
+  for (const Section& other_section : other.sections)
+  {
+    Section* section = GetOrCreateSection(other_section.name);
+    for (const std::string& key : other_section.keys_order)
+      section->Set(key, other_section.values.find(key)->second);
+    section->m_lines.insert(section->m_lines.end(), other_section.m_lines.begin(),
+                            other_section.m_lines.end());
+  }
+}
+
 bool IniFile::Save(const std::string& filename)
 {
   std::ofstream out;
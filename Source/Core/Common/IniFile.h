@@ -102,6 +102,10 @@ public:
   };
 
   IniFile();
+  IniFile(const IniFile& other);
+  IniFile(IniFile&& other);
+  IniFile& operator=(const IniFile& other);
+  IniFile& operator=(IniFile&& other);
   ~IniFile();
 
   /**
@@ -116,6 +120,10 @@ public:
    */
   bool Load(const std::string& filename, bool keep_current_data = false);
 
+  // Merges other into this the same way as Load does with keep_current_data, as if the file other
+  // was loaded from was loaded again.
+  void Merge(const IniFile& other);
+
   bool Save(const std::string& filename);
 
   bool Exists(std::string_view section_name) const;
@@ -164,7 +172,12 @@ public:
   const std::list<Section>& GetSections() const { return sections; }
 
 private:
+  void RebuildSectionIndex();
+
   std::list<Section> sections;
+  // Sections by name, for lookups that don't compare against every section. The names point into
+  // the sections, which std::list never moves.
+  std::map<std::string_view, Section*, CaseInsensitiveStringCompare> m_section_index;
 
   static const std::string& NULL_STRING;
 };
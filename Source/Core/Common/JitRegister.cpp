@@ -8,6 +8,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -40,6 +41,12 @@ namespace Common::JitRegister
 {
 static bool s_is_enabled = false;
 
+static std::string FormatPerfMapEntry(const void* base_address, u32 code_size,
+                                      const std::string& symbol_name)
+{
+  return fmt::format("{} {:x} {}\n", fmt::ptr(base_address), code_size, symbol_name);
+}
+
 void Init(const std::string& perf_dir)
 {
 #if defined USE_OPROFILE && USE_OPROFILE
@@ -105,7 +112,22 @@ void Register(const void* base_address, u32 code_size, const std::string& symbol
   if (!s_perf_map_file.IsOpen())
     return;
 
-  const auto entry = fmt::format("{} {:x} {}\n", fmt::ptr(base_address), code_size, symbol_name);
+  const auto entry = FormatPerfMapEntry(base_address, code_size, symbol_name);
   s_perf_map_file.WriteBytes(entry.data(), entry.size());
 }
+
+bool WritePerfMap(const std::string& path, const std::vector<PerfMapEntry>& entries)
+{
+  File::IOFile file(path, "w");
+  if (!file)
+    return false;
+
+  for (const PerfMapEntry& entry : entries)
+  {
+    const auto line = FormatPerfMapEntry(entry.base_address, entry.code_size, entry.symbol_name);
+    if (!file.WriteBytes(line.data(), line.size()))
+      return false;
+  }
+  return true;
+}
 }  // namespace Common::JitRegister
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -16,6 +17,17 @@ void Shutdown();
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name);
 bool IsEnabled();
 
+struct PerfMapEntry
+{
+  const void* base_address;
+  u32 code_size;
+  std::string symbol_name;
+};
+
+// Writes a standalone perf map containing only the given entries. Unlike the map written by
+// Register(), this can be produced on demand without having enabled JitRegister at startup.
+bool WritePerfMap(const std::string& path, const std::vector<PerfMapEntry>& entries);
+
 template <typename... Args>
 inline void Register(const void* base_address, u32 code_size, fmt::format_string<Args...> format,
                      Args&&... args)
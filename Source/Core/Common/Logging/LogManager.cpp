@@ -11,6 +11,7 @@
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -21,6 +22,7 @@
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common::Log
 {
@@ -169,10 +171,20 @@ LogManager::LogManager()
   }
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_dispatch_thread = std::thread(&LogManager::DispatchThread, this);
 }
 
 LogManager::~LogManager()
 {
+  {
+    std::lock_guard lk(m_queue_mutex);
+    m_exit_dispatch_thread = true;
+  }
+  m_queue_changed.notify_one();
+  // The thread only exits once everything that was queued has been dispatched.
+  m_dispatch_thread.join();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -221,14 +233,52 @@ std::string LogManager::GetTimestamp()
 void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                                  const char* message)
 {
-  const std::string msg =
+  std::string msg =
       fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
                   LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
 
+  std::unique_lock lk(m_queue_mutex);
+  m_queue.push_back({level, std::move(msg)});
+  const u64 message_id = ++m_queued_count;
+  m_queue_changed.notify_one();
+
+  // Notices and errors are waited for, so that they are out before a crash that might follow
+  // them. The dispatch thread itself mustn't wait, in case a listener logs something.
+  if (level <= LogLevel::LERROR && std::this_thread::get_id() != m_dispatch_thread.get_id())
+    m_queue_dispatched.wait(lk, [&] { return m_dispatched_count >= message_id; });
+}
+
+void LogManager::Dispatch(LogLevel level, const char* msg) const
+{
   for (const auto listener_id : m_listener_ids)
   {
     if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+      m_listeners[listener_id]->Log(level, msg);
+  }
+}
+
+void LogManager::DispatchThread()
+{
+  Common::SetCurrentThreadName("Log Dispatcher");
+
+  std::vector<QueuedMessage> messages;
+  std::unique_lock lk(m_queue_mutex);
+  while (true)
+  {
+    m_queue_changed.wait(lk, [this] { return !m_queue.empty() || m_exit_dispatch_thread; });
+    if (m_queue.empty())
+      return;
+
+    std::swap(messages, m_queue);
+    lk.unlock();
+
+    for (const QueuedMessage& message : messages)
+      Dispatch(message.level, message.text.c_str());
+
+    lk.lock();
+    m_dispatched_count += messages.size();
+    messages.clear();
+    m_queue_dispatched.notify_all();
   }
 }
 
@@ -4,9 +4,13 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <cstdarg>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/BitSet.h"
 #include "Common/EnumMap.h"
@@ -67,6 +71,12 @@ private:
     bool m_enable = false;
   };
 
+  struct QueuedMessage
+  {
+    LogLevel level;
+    std::string text;
+  };
+
   LogManager();
   ~LogManager();
 
@@ -77,10 +87,24 @@ private:
 
   static std::string GetTimestamp();
 
+  void DispatchThread();
+  void Dispatch(LogLevel level, const char* msg) const;
+
   LogLevel m_level;
   EnumMap<LogContainer, LAST_LOG_TYPE> m_log{};
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Lines are formatted on the thread that logs them, but the listeners (which write to the log
+  // file, the console and the log window) are called from m_dispatch_thread.
+  std::mutex m_queue_mutex;
+  std::condition_variable m_queue_changed;
+  std::condition_variable m_queue_dispatched;
+  std::vector<QueuedMessage> m_queue;
+  u64 m_queued_count = 0;
+  u64 m_dispatched_count = 0;
+  bool m_exit_dispatch_thread = false;
+  std::thread m_dispatch_thread;
 };
 }  // namespace Common::Log
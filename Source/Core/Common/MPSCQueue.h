@@ -0,0 +1,110 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// A bounded, lock-free, multiple producer, single consumer queue.
+//
+// Producers don't allocate and never block each other for longer than a compare-and-swap takes.
+// Every slot carries a sequence number, which tells a producer whether the slot is free and the
+// consumer whether it has been filled, so the consumer doesn't need any read-modify-write
+// operations at all.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Common
+{
+template <typename T, size_t Capacity>
+class MPSCQueue
+{
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "MPSCQueue capacity must be a power of two");
+
+public:
+  MPSCQueue()
+  {
+    for (size_t i = 0; i < Capacity; ++i)
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue(MPSCQueue&&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(MPSCQueue&&) = delete;
+
+  // Can be called from any thread. Returns false (and leaves value alone) if the queue is full.
+  template <typename Arg>
+  bool TryPush(Arg&& value)
+  {
+    size_t pos = m_write_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      Slot& slot = m_slots[pos & MASK];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::make_signed_t<size_t>>(sequence - pos);
+      if (diff == 0)
+      {
+        if (m_write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          slot.value = std::forward<Arg>(value);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        // The consumer hasn't gotten to this slot yet.
+        return false;
+      }
+      else
+      {
+        // Another producer took this slot.
+        pos = m_write_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Must only be called from the consumer thread.
+  bool Pop(T& value)
+  {
+    Slot& slot = m_slots[m_read_pos & MASK];
+    if (slot.sequence.load(std::memory_order_acquire) != m_read_pos + 1)
+      return false;
+
+    value = std::move(slot.value);
+    // Don't keep whatever the element owns alive until the slot gets reused.
+    slot.value = T{};
+    slot.sequence.store(m_read_pos + Capacity, std::memory_order_release);
+    ++m_read_pos;
+    return true;
+  }
+
+  // Must only be called from the consumer thread. Pushes that are still in progress may or may
+  // not be seen.
+  bool Empty() const
+  {
+    return m_slots[m_read_pos & MASK].sequence.load(std::memory_order_acquire) != m_read_pos + 1;
+  }
+
+  static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+  static constexpr size_t MASK = Capacity - 1;
+
+  // Keep slots, and the producer and consumer positions, on separate cache lines so that threads
+  // working on different elements don't invalidate each others' caches.
+  struct alignas(64) Slot
+  {
+    std::atomic<size_t> sequence;
+    T value{};
+  };
+
+  std::array<Slot, Capacity> m_slots;
+  alignas(64) std::atomic<size_t> m_write_pos = 0;
+  alignas(64) size_t m_read_pos = 0;
+};
+}  // namespace Common
@@ -6,6 +6,18 @@
 #include <algorithm>
 #include <cmath>
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#endif
+
+#if defined(USE_SSE)
+#include <xmmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "Common/MathUtil.h"
 
 namespace
@@ -351,7 +363,37 @@ Matrix44 Matrix44::Perspective(float fov_y, float aspect_ratio, float z_near, fl
 
 void Matrix44::Multiply(const Matrix44& a, const Matrix44& b, Matrix44* result)
 {
+  // Each row of the result is a sum of the rows of b, scaled by the elements of that row of a.
+  // The products are added up in the same order as in MatrixMultiply.
+#if defined(USE_SSE)
+  const __m128 b_rows[4] = {_mm_loadu_ps(&b.data[0]), _mm_loadu_ps(&b.data[4]),
+                            _mm_loadu_ps(&b.data[8]), _mm_loadu_ps(&b.data[12])};
+  __m128 rows[4];
+  for (int n = 0; n < 4; ++n)
+  {
+    __m128 row = _mm_setzero_ps();
+    for (int m = 0; m < 4; ++m)
+      row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a.data[n * 4 + m]), b_rows[m]));
+    rows[n] = row;
+  }
+  for (int n = 0; n < 4; ++n)
+    _mm_storeu_ps(&result->data[n * 4], rows[n]);
+#elif defined(USE_NEON)
+  const float32x4_t b_rows[4] = {vld1q_f32(&b.data[0]), vld1q_f32(&b.data[4]),
+                                 vld1q_f32(&b.data[8]), vld1q_f32(&b.data[12])};
+  float32x4_t rows[4];
+  for (int n = 0; n < 4; ++n)
+  {
+    float32x4_t row = vdupq_n_f32(0.0f);
+    for (int m = 0; m < 4; ++m)
+      row = vaddq_f32(row, vmulq_n_f32(b_rows[m], a.data[n * 4 + m]));
+    rows[n] = row;
+  }
+  for (int n = 0; n < 4; ++n)
+    vst1q_f32(&result->data[n * 4], rows[n]);
+#else
   result->data = MatrixMultiply<4, 4, 4>(a.data, b.data);
+#endif
 }
 
 Vec3 Matrix44::Transform(const Vec3& v, float w) const
@@ -46,8 +46,11 @@ public:
   /// @param size The amount of bytes that should be allocated in this region.
   /// @param base_name A base name for the shared memory region, if applicable for this platform.
   /// Will be extended with the process ID.
+  /// @param use_large_pages Whether views of the segment should be backed by large pages, where
+  /// the platform supports it. Currently only has an effect on Linux (transparent huge pages for
+  /// shared memory have to be enabled in /sys/kernel/mm/transparent_hugepage/shmem_enabled).
   ///
-  void GrabSHMSegment(size_t size, std::string_view base_name);
+  void GrabSHMSegment(size_t size, std::string_view base_name, bool use_large_pages = false);
 
   ///
   /// Release the memory segment previously allocated with GrabSHMSegment().
@@ -111,6 +114,11 @@ public:
   ///
   void UnmapFromMemoryRegion(void* view, size_t size);
 
+  ///
+  /// Get the granularity that offsets and sizes passed to MapInMemoryRegion() must be aligned to.
+  ///
+  size_t GetMappingGranularity() const;
+
 private:
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
@@ -124,6 +132,7 @@ private:
   int m_shm_fd = 0;
   void* m_reserved_region = nullptr;
   std::size_t m_reserved_region_size = 0;
+  bool m_use_large_pages = false;
 #endif
 };
 
@@ -23,6 +23,7 @@
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
@@ -65,8 +66,9 @@ static int AshmemCreateFileMapping(const char* name, size_t size)
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name, bool use_large_pages)
 {
+  m_use_large_pages = use_large_pages;
   const std::string name = fmt::format("{}.{}", base_name, getpid());
   m_shm_fd = AshmemCreateFileMapping(name.c_str(), size);
   if (m_shm_fd < 0)
@@ -88,6 +90,8 @@ void* MemArena::CreateView(s64 offset, size_t size)
   }
   else
   {
+    if (m_use_large_pages)
+      AdviseLargePages(retval, size);
     return retval;
   }
 }
@@ -133,6 +137,8 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
   }
   else
   {
+    if (m_use_large_pages)
+      AdviseLargePages(retval, size);
     return retval;
   }
 }
@@ -144,6 +150,11 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
 
+size_t MemArena::GetMappingGranularity() const
+{
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
@@ -20,6 +20,7 @@
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
@@ -28,8 +29,9 @@ namespace Common
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name, bool use_large_pages)
 {
+  m_use_large_pages = use_large_pages;
   const std::string file_name = fmt::format("/{}.{}", base_name, getpid());
   m_shm_fd = shm_open(file_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
   if (m_shm_fd == -1)
@@ -57,6 +59,8 @@ void* MemArena::CreateView(s64 offset, size_t size)
   }
   else
   {
+    if (m_use_large_pages)
+      AdviseLargePages(retval, size);
     return retval;
   }
 }
@@ -99,6 +103,8 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
   }
   else
   {
+    if (m_use_large_pages)
+      AdviseLargePages(retval, size);
     return retval;
   }
 }
@@ -110,6 +116,11 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
 
+size_t MemArena::GetMappingGranularity() const
+{
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
@@ -117,8 +117,10 @@ static DWORD GetLowDWORD(u64 value)
   return static_cast<DWORD>(value);
 }
 
-void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
+void MemArena::GrabSHMSegment(size_t size, std::string_view base_name,
+                              [[maybe_unused]] bool use_large_pages)
 {
+  // Large pages can't be combined with the placeholder mappings used for the views.
   const std::string name = fmt::format("{}.{}", base_name, GetCurrentProcessId());
   m_memory_handle =
       CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, GetHighDWORD(size),
@@ -442,6 +444,15 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   UnmapViewOfFile(view);
 }
 
+size_t MemArena::GetMappingGranularity() const
+{
+  // File mapping views must start on an allocation granularity boundary, which is larger than the
+  // page size.
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwAllocationGranularity;
+}
+
 LazyMemoryRegion::LazyMemoryRegion()
 {
   InitWindowsMemoryFunctions(&m_memory_functions);
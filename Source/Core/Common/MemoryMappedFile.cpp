@@ -0,0 +1,138 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MemoryMappedFile.h"
+
+#include <algorithm>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+MemoryMappedFile::~MemoryMappedFile()
+{
+  Close();
+}
+
+#ifdef _WIN32
+bool MemoryMappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const HANDLE file = CreateFileW(UTF8ToWString(filename).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  // The mapping keeps the file open, so the file handle isn't needed after this.
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+    return false;
+
+  void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view)
+  {
+    CloseHandle(mapping);
+    return false;
+  }
+
+  m_mapping_handle = mapping;
+  m_data = static_cast<const u8*>(view);
+  m_size = static_cast<size_t>(size.QuadPart);
+  return true;
+}
+
+void MemoryMappedFile::Advise(size_t offset, size_t size, AccessHint) const
+{
+  if (offset >= m_size)
+    return;
+
+  // Windows has no separate hint for sequential access.
+  WIN32_MEMORY_RANGE_ENTRY range;
+  range.VirtualAddress = const_cast<u8*>(m_data + offset);
+  range.NumberOfBytes = std::min(size, m_size - offset);
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+void MemoryMappedFile::Close()
+{
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping_handle)
+    CloseHandle(m_mapping_handle);
+
+  m_mapping_handle = nullptr;
+  m_data = nullptr;
+  m_size = 0;
+}
+#else
+bool MemoryMappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat file_info;
+  if (fstat(fd, &file_info) != 0 || file_info.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  // The mapping stays valid after the file descriptor is closed.
+  const size_t size = static_cast<size_t>(file_info.st_size);
+  void* const data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return false;
+
+  m_data = static_cast<const u8*>(data);
+  m_size = size;
+  return true;
+}
+
+void MemoryMappedFile::Advise(size_t offset, size_t size, AccessHint hint) const
+{
+  if (offset >= m_size)
+    return;
+
+  // madvise needs a page-aligned start address. The mapping itself is page-aligned.
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t aligned_offset = offset - offset % page_size;
+  const size_t aligned_size = std::min(size, m_size - offset) + (offset - aligned_offset);
+  madvise(const_cast<u8*>(m_data + aligned_offset), aligned_size,
+          hint == AccessHint::Sequential ? MADV_SEQUENTIAL : MADV_WILLNEED);
+}
+
+void MemoryMappedFile::Close()
+{
+  if (m_data)
+    munmap(const_cast<u8*>(m_data), m_size);
+
+  m_data = nullptr;
+  m_size = 0;
+}
+#endif
+}  // namespace File
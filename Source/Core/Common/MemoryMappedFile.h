@@ -0,0 +1,50 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+// Maps a whole file into memory for reading. The contents are paged in by the OS on access, so
+// opening even a very large file is cheap.
+class MemoryMappedFile
+{
+public:
+  MemoryMappedFile() = default;
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  bool Open(const std::string& filename);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  const u8* GetData() const { return m_data; }
+  size_t GetSize() const { return m_size; }
+
+  enum class AccessHint
+  {
+    // The range will be read from start to end soon.
+    Sequential,
+    // The range will be read soon, in no particular order.
+    WillNeed,
+  };
+
+  // Lets the OS start paging in the given range ahead of time. This is only a hint.
+  void Advise(size_t offset, size_t size, AccessHint hint) const;
+
+private:
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
+};
+}  // namespace File
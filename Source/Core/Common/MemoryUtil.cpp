@@ -34,10 +34,25 @@ namespace Common
 // This is purposely not a full wrapper for virtualalloc/mmap, but it
 // provides exactly the primitive operations that Dolphin needs.
 
-void* AllocateExecutableMemory(size_t size)
+void* AllocateExecutableMemory(size_t size, bool use_large_pages)
 {
 #if defined(_WIN32)
-  void* ptr = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+  void* ptr = nullptr;
+  if (use_large_pages)
+  {
+    // This needs SeLockMemoryPrivilege, which most users don't have, so failing isn't an error.
+    const size_t large_page_size = GetLargePageMinimum();
+    if (large_page_size != 0)
+    {
+      const size_t large_size = (size + large_page_size - 1) & ~(large_page_size - 1);
+      ptr = VirtualAlloc(nullptr, large_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                         PAGE_EXECUTE_READWRITE);
+    }
+    if (ptr == nullptr)
+      INFO_LOG_FMT(MEMMAP, "Large pages unavailable: {}", GetLastErrorString());
+  }
+  if (ptr == nullptr)
+    ptr = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
 #else
   int map_flags = MAP_ANON | MAP_PRIVATE;
 #if defined(__APPLE__)
@@ -46,6 +61,8 @@ void* AllocateExecutableMemory(size_t size)
   void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, map_flags, -1, 0);
   if (ptr == MAP_FAILED)
     ptr = nullptr;
+  else if (use_large_pages)
+    AdviseLargePages(ptr, size);
 #endif
 
   if (ptr == nullptr)
@@ -289,4 +306,12 @@ size_t MemPhysical()
 #endif
 }
 
+void AdviseLargePages(void* ptr, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (madvise(ptr, size, MADV_HUGEPAGE) != 0)
+    INFO_LOG_FMT(MEMMAP, "madvise(MADV_HUGEPAGE) failed: {}", LastStrerrorString());
+#endif
+}
+
 }  // namespace Common
@@ -8,7 +8,9 @@
 
 namespace Common
 {
-void* AllocateExecutableMemory(size_t size);
+// If use_large_pages is set, tries to back the allocation with large pages (which reduces TLB
+// misses for big JIT code regions), silently falling back to normal pages.
+void* AllocateExecutableMemory(size_t size, bool use_large_pages = false);
 
 // These two functions control the executable/writable state of the W^X memory
 // allocations. More detailed documentation about them is in the .cpp file.
@@ -35,4 +37,8 @@ bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
 size_t MemPhysical();
 
+// Asks the OS to back an existing mapping with large pages where possible (transparent huge pages
+// on Linux). This is only a hint; nothing happens on platforms that don't support it.
+void AdviseLargePages(void* ptr, size_t size);
+
 }  // namespace Common
@@ -3,7 +3,9 @@
 
 #include "Common/SymbolDB.h"
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <map>
 #include <string>
 #include <utility>
@@ -52,15 +54,55 @@ void SymbolDB::Clear(const char* prefix)
   // TODO: honor prefix
   m_functions.clear();
   m_checksum_to_function.clear();
+  InvalidateIndex();
 }
 
 void SymbolDB::Index()
 {
+  m_index_addresses.clear();
+  m_index_symbols.clear();
+  m_index_addresses.reserve(m_functions.size());
+  m_index_symbols.reserve(m_functions.size());
+
   int i = 0;
   for (auto& func : m_functions)
   {
     func.second.index = i++;
+    m_index_addresses.push_back(func.first);
+    m_index_symbols.push_back(&func.second);
   }
+  m_index_valid = true;
+}
+
+void SymbolDB::InvalidateIndex()
+{
+  m_index_valid = false;
+}
+
+Symbol* SymbolDB::FindSymbolContaining(u32 addr)
+{
+  Symbol* symbol = nullptr;
+  if (m_index_valid)
+  {
+    // The last symbol that starts at or before addr.
+    const auto it = std::upper_bound(m_index_addresses.begin(), m_index_addresses.end(), addr);
+    if (it == m_index_addresses.begin())
+      return nullptr;
+    symbol = m_index_symbols[it - m_index_addresses.begin() - 1];
+  }
+  else
+  {
+    auto it = m_functions.upper_bound(addr);
+    if (it == m_functions.begin())
+      return nullptr;
+    symbol = &std::prev(it)->second;
+  }
+
+  // If the address is exactly the start address of a symbol, we're done. Otherwise, check whether
+  // the address is within the bounds of the symbol.
+  if (symbol->address == addr || (addr >= symbol->address && addr < symbol->address + symbol->size))
+    return symbol;
+  return nullptr;
 }
 
 Symbol* SymbolDB::GetSymbolFromName(std::string_view name)
@@ -108,6 +150,7 @@ std::vector<Symbol*> SymbolDB::GetSymbolsFromHash(u32 hash)
 
 void SymbolDB::AddCompleteSymbol(const Symbol& symbol)
 {
-  m_functions.emplace(symbol.address, symbol);
+  if (m_functions.emplace(symbol.address, symbol).second)
+    InvalidateIndex();
 }
 }  // namespace Common
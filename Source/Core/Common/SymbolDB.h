@@ -92,7 +92,17 @@ public:
   void Index();
 
 protected:
+  // Returns the symbol that starts at or contains addr, using the flat index when it is up to date.
+  Symbol* FindSymbolContaining(u32 addr);
+  void InvalidateIndex();
+
   XFuncMap m_functions;
   XFuncPtrMap m_checksum_to_function;
+
+  // Start addresses of m_functions and their symbols, in order. Built by Index(), which is called
+  // after every bulk change, and dropped whenever symbols are added or removed until the next one.
+  std::vector<u32> m_index_addresses;
+  std::vector<Symbol*> m_index_symbols;
+  bool m_index_valid = false;
 };
 }  // namespace Common
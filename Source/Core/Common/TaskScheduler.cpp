@@ -0,0 +1,126 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/TaskScheduler.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+// The index of the worker the current thread is, if it is one.
+static thread_local const TaskScheduler* tls_scheduler = nullptr;
+static thread_local size_t tls_worker_index = 0;
+
+TaskScheduler& TaskScheduler::GetInstance()
+{
+  // Leave cores for the emulated CPU and GPU threads.
+  static TaskScheduler s_instance(std::max(std::thread::hardware_concurrency(), 3u) - 2);
+  return s_instance;
+}
+
+TaskScheduler::TaskScheduler(size_t num_workers)
+{
+  num_workers = std::max<size_t>(num_workers, 1);
+  m_workers.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i)
+    m_workers.push_back(std::make_unique<Worker>());
+  for (size_t i = 0; i < num_workers; ++i)
+    m_workers[i]->thread = std::thread(&TaskScheduler::WorkerLoop, this, i);
+}
+
+TaskScheduler::~TaskScheduler()
+{
+  {
+    std::lock_guard lk(m_wake_lock);
+    m_shutdown = true;
+  }
+  m_wake.notify_all();
+
+  for (const auto& worker : m_workers)
+    worker->thread.join();
+}
+
+void TaskScheduler::Push(TaskPriority priority, Task task)
+{
+  // Count the task before it can be popped, so that the count never goes below zero.
+  {
+    std::lock_guard lk(m_wake_lock);
+    ++m_num_queued;
+  }
+
+  const size_t queue = static_cast<size_t>(priority);
+  if (tls_scheduler == this)
+  {
+    Worker& worker = *m_workers[tls_worker_index];
+    std::lock_guard lk(worker.lock);
+    worker.queues[queue].push_front(std::move(task));
+  }
+  else
+  {
+    Worker& worker = *m_workers[m_next_worker++ % m_workers.size()];
+    std::lock_guard lk(worker.lock);
+    worker.queues[queue].push_back(std::move(task));
+  }
+
+  m_wake.notify_one();
+}
+
+bool TaskScheduler::TryPop(size_t worker_index, Task* task)
+{
+  for (size_t queue = 0; queue < NUM_PRIORITIES; ++queue)
+  {
+    {
+      Worker& worker = *m_workers[worker_index];
+      std::lock_guard lk(worker.lock);
+      if (!worker.queues[queue].empty())
+      {
+        *task = std::move(worker.queues[queue].front());
+        worker.queues[queue].pop_front();
+        --m_num_queued;
+        return true;
+      }
+    }
+
+    for (size_t i = 1; i < m_workers.size(); ++i)
+    {
+      Worker& victim = *m_workers[(worker_index + i) % m_workers.size()];
+      std::lock_guard lk(victim.lock);
+      if (!victim.queues[queue].empty())
+      {
+        *task = std::move(victim.queues[queue].back());
+        victim.queues[queue].pop_back();
+        --m_num_queued;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void TaskScheduler::WorkerLoop(size_t worker_index)
+{
+  SetCurrentThreadName(fmt::format("Task worker {}", worker_index).c_str());
+  SetCurrentThreadBackgroundPriority();
+  tls_scheduler = this;
+  tls_worker_index = worker_index;
+
+  while (true)
+  {
+    Task task;
+    if (TryPop(worker_index, &task))
+    {
+      task();
+      continue;
+    }
+
+    std::unique_lock lk(m_wake_lock);
+    m_wake.wait(lk, [this] { return m_shutdown || m_num_queued != 0; });
+    if (m_shutdown && m_num_queued == 0)
+      return;
+  }
+}
+}  // namespace Common
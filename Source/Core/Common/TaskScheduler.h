@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Common
+{
+enum class TaskPriority
+{
+  // Work that something is waiting for, like a disc verification the user started.
+  Normal,
+  // Work that is only done ahead of time.
+  Background,
+};
+
+// A pool of worker threads shared by everything that needs to run CPU-bound work in the
+// background, so that such work doesn't start more threads than there are cores to run them.
+// The workers run at a lowered OS priority so that they don't compete with the emulated CPU and
+// GPU threads, which on hybrid CPUs also lets the OS move them to efficiency cores.
+//
+// Every worker has its own queues. A task submitted from a worker is put at the front of that
+// worker's queue, and other tasks are spread over the workers. Workers run tasks from the front
+// of their own queues, and steal from the back of the others' queues when theirs are empty.
+// Normal priority tasks always go before background tasks.
+//
+// Tasks must not wait for other tasks, since all workers could end up waiting.
+class TaskScheduler
+{
+public:
+  // The scheduler shared by the whole program, created on first use.
+  static TaskScheduler& GetInstance();
+
+  explicit TaskScheduler(size_t num_workers);
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler(TaskScheduler&&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(TaskScheduler&&) = delete;
+  // Runs the tasks that are still queued, then stops the workers.
+  ~TaskScheduler();
+
+  template <typename F>
+  std::future<std::invoke_result_t<F>> Submit(TaskPriority priority, F&& function)
+  {
+    using Result = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+    std::future<Result> future = task->get_future();
+    Push(priority, [task = std::move(task)] { (*task)(); });
+    return future;
+  }
+
+  size_t GetWorkerCount() const { return m_workers.size(); }
+
+private:
+  using Task = std::function<void()>;
+
+  static constexpr size_t NUM_PRIORITIES = 2;
+
+  struct Worker
+  {
+    std::mutex lock;
+    std::array<std::deque<Task>, NUM_PRIORITIES> queues;
+    std::thread thread;
+  };
+
+  void Push(TaskPriority priority, Task task);
+  bool TryPop(size_t worker_index, Task* task);
+  void WorkerLoop(size_t worker_index);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::atomic<size_t> m_next_worker = 0;
+
+  std::mutex m_wake_lock;
+  std::condition_variable m_wake;
+  std::atomic<size_t> m_num_queued = 0;
+  bool m_shutdown = false;
+};
+}  // namespace Common
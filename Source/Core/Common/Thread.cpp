@@ -11,6 +11,12 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined BSD4_4 || defined __FreeBSD__ || defined __OpenBSD__
@@ -26,12 +32,48 @@
 #pragma comment(lib, "libittnotify.lib")
 #endif
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
 
 namespace Common
 {
+// Takes (logical processor, relative speed) pairs and returns the processors that are within 80%
+// of the fastest one. Turbo boosting can make single cores of an otherwise uniform CPU report a
+// slightly higher speed, which shouldn't make us pin threads to those cores alone.
+static u32 GetFastCoreMask(const std::vector<std::pair<u32, u64>>& cores)
+{
+  if (cores.empty())
+    return 0;
+
+  u64 fastest = 0;
+  for (const auto& [processor, speed] : cores)
+    fastest = std::max(fastest, speed);
+
+  u32 mask = 0;
+  bool all_fast = true;
+  for (const auto& [processor, speed] : cores)
+  {
+    if (speed * 5 >= fastest * 4)
+    {
+      if (processor < 32)
+        mask |= 1U << processor;
+    }
+    else
+    {
+      all_fast = false;
+    }
+  }
+  return all_fast ? 0 : mask;
+}
+
 int CurrentThreadId()
 {
 #ifdef _WIN32
@@ -116,6 +158,64 @@ void SetCurrentThreadName(const char* name)
   SetCurrentThreadNameViaApi(name);
 }
 
+void SetCurrentThreadBackgroundPriority()
+{
+  SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+#ifdef THREAD_POWER_THROTTLING_CURRENT_VERSION
+  // EcoQoS, which makes the scheduler prefer efficiency cores.
+  THREAD_POWER_THROTTLING_STATE state{};
+  state.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+  state.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  state.StateMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &state, sizeof(state));
+#endif
+}
+
+u32 GetPerformanceCoreMask()
+{
+  static const u32 s_mask = [] {
+    ULONG size = 0;
+    GetSystemCpuSetInformation(nullptr, 0, &size, GetCurrentProcess(), 0);
+    std::vector<u8> buffer(size);
+    if (size == 0 ||
+        !GetSystemCpuSetInformation(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.data()),
+                                    size, &size, GetCurrentProcess(), 0))
+    {
+      return 0U;
+    }
+
+    // A higher efficiency class means a faster, less power efficient core.
+    std::vector<std::pair<u32, u64>> cores;
+    for (ULONG offset = 0; offset < size;)
+    {
+      const auto* info = reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION*>(&buffer[offset]);
+      if (info->Type == CpuSetInformation && info->CpuSet.Group == 0)
+        cores.emplace_back(info->CpuSet.LogicalProcessorIndex, info->CpuSet.EfficiencyClass);
+      offset += info->Size;
+    }
+    return GetFastCoreMask(cores);
+  }();
+  return s_mask;
+}
+
+std::string SetCurrentThreadPerformancePriority()
+{
+#ifdef THREAD_POWER_THROTTLING_CURRENT_VERSION
+  // Opt out of EcoQoS, which the OS may otherwise apply to threads of background windows.
+  THREAD_POWER_THROTTLING_STATE state{};
+  state.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+  state.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  state.StateMask = 0;
+  SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &state, sizeof(state));
+#endif
+
+  const u32 mask = GetPerformanceCoreMask();
+  if (mask == 0 || !SetThreadAffinityMask(GetCurrentThread(), mask))
+    return "any core";
+  return fmt::format("performance cores (mask {:#x})", mask);
+}
+
 #else  // !WIN32, so must be POSIX threads
 
 void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask)
@@ -186,6 +286,82 @@ void SetCurrentThreadName(const char* name)
 #endif
 }
 
+void SetCurrentThreadBackgroundPriority()
+{
+#ifdef __APPLE__
+  // The utility QoS class also makes the scheduler prefer efficiency cores.
+  pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif defined __linux__
+  // On Linux, nice values apply to individual threads.
+  setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+}
+
+u32 GetPerformanceCoreMask()
+{
+#ifdef __linux__
+  static const u32 s_mask = [] {
+    // ARM kernels describe the relative speed of every core in cpu_capacity. Elsewhere, the
+    // maximum frequency is the best indication we have.
+    std::vector<std::pair<u32, u64>> cores;
+    for (u32 processor = 0; processor < 32; ++processor)
+    {
+      const std::string path = fmt::format("/sys/devices/system/cpu/cpu{}/", processor);
+      std::string text;
+      u64 speed;
+      if ((File::ReadFileToString(path + "cpu_capacity", text) ||
+           File::ReadFileToString(path + "cpufreq/cpuinfo_max_freq", text)) &&
+          TryParse(std::string(StripWhitespace(text)), &speed))
+      {
+        cores.emplace_back(processor, speed);
+      }
+    }
+    return GetFastCoreMask(cores);
+  }();
+  return s_mask;
+#else
+  return 0;
+#endif
+}
+
+std::string SetCurrentThreadPerformancePriority()
+{
+#ifdef __APPLE__
+  // Threads can't be pinned to cores on macOS, but the scheduler keeps threads of the highest QoS
+  // class on the performance cores.
+  pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+  return "user-interactive QoS";
+#elif defined __linux__
+  // sched_setaffinity is used directly since pthread_setaffinity_np is missing on Android. The
+  // mask is limited to the cores the thread may already run on, to respect e.g. taskset.
+  const u32 mask = GetPerformanceCoreMask();
+  cpu_set_t cpu_set;
+  if (mask == 0 || sched_getaffinity(0, sizeof(cpu_set), &cpu_set) != 0)
+    return "any core";
+
+  u32 allowed_mask = 0;
+  for (u32 i = 0; i < 32; ++i)
+  {
+    if (((mask >> i) & 1) != 0 && CPU_ISSET(i, &cpu_set))
+      allowed_mask |= 1U << i;
+  }
+  if (allowed_mask == 0)
+    return "any core";
+
+  CPU_ZERO(&cpu_set);
+  for (u32 i = 0; i < 32; ++i)
+  {
+    if ((allowed_mask >> i) & 1)
+      CPU_SET(i, &cpu_set);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0)
+    return "any core";
+  return fmt::format("performance cores (mask {:#x})", allowed_mask);
+#else
+  return "any core";
+#endif
+}
+
 std::tuple<void*, size_t> GetCurrentThreadStack()
 {
   void* stack_addr;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <string>
 #include <thread>
 
 #ifndef _WIN32
@@ -39,6 +40,19 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+// Lowers the OS priority of the current thread, for threads that only do background work. Where
+// the OS supports it, this also lets it prefer efficiency cores for the thread on hybrid CPUs.
+void SetCurrentThreadBackgroundPriority();
+
+// The logical processors that belong to the fastest cores of a hybrid CPU, as a mask. Returns 0 if
+// all cores are about equally fast, or if the topology can't be determined.
+u32 GetPerformanceCoreMask();
+
+// For threads that the emulation speed depends on. Keeps the OS from throttling the current thread
+// to save power and, on hybrid CPUs, restricts it to the performance cores. Returns a short
+// description of where the thread was placed, for logs.
+std::string SetCurrentThreadPerformancePriority();
+
 #ifndef _WIN32
 // Returns the lowest address of the stack and the size of the stack
 std::tuple<void*, size_t> GetCurrentThreadStack();
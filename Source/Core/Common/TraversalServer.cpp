@@ -1,23 +1,48 @@
 // SPDX-License-Identifier: CC0-1.0
 
 // The central server implementation.
+//
+// Every worker thread has its own pair of sockets bound to the traversal ports with SO_REUSEPORT,
+// so that the kernel spreads clients over them, and waits for them with epoll or kqueue. The host
+// and outgoing packet tables are shared between the workers and split into shards, each with its
+// own lock.
+//
+// If a public relay address is given, connections are relayed through a pair of UDP sockets on
+// the server, which lets clients behind symmetric NATs connect. The game host is asked to punch
+// a hole towards one socket of the pair, and the connecting client is told to connect to the
+// other one, so this works without any changes to clients.
 #include <arpa/inet.h>
+#include <array>
+#include <atomic>
 #include <cerrno>
 #include <chrono>
+#include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <fcntl.h>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <netinet/in.h>
-#include <sys/select.h>
+#include <optional>
+#include <string>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <thread>
 #include <tuple>
 #include <unistd.h>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <sys/event.h>
+#endif
+
 #include <fmt/format.h>
 
 #ifdef HAVE_LIBSYSTEMD
@@ -31,8 +56,13 @@
 #define NUMBER_OF_TRIES 5
 #define PORT 6262
 #define PORT_ALT 6226
+#define SHARD_COUNT 64
+
+static constexpr u64 HOST_EXPIRY_TIME = 30 * 1000000;   // 30s
+static constexpr u64 RELAY_EXPIRY_TIME = 60 * 1000000;  // 60s
+static constexpr u64 MAINTENANCE_INTERVAL = 100000;     // 100ms
 
-static u64 currentTime;
+static thread_local u64 currentTime;
 
 struct OutgoingPacketInfo
 {
@@ -42,6 +72,9 @@ struct OutgoingPacketInfo
   sockaddr_in6 dest;
   int tries;
   u64 sendTime;
+  // For a relayed PleaseSendPacket, the connecting client and the relay address it should use.
+  std::optional<sockaddr_in6> relayClient;
+  std::optional<sockaddr_in6> relayAddr;
 };
 
 template <typename T>
@@ -63,7 +96,6 @@ EvictFindResult<V> EvictFind(std::unordered_map<K, EvictEntry<V>>& map, const K&
                              bool refresh = false)
 {
 retry:
-  const u64 expiryTime = 30 * 1000000;  // 30s
   EvictFindResult<V> result;
   if (map.bucket_count())
   {
@@ -71,7 +103,7 @@ retry:
     auto it = map.begin(bucket);
     for (; it != map.end(bucket); ++it)
     {
-      if (currentTime - it->second.updateTime > expiryTime)
+      if (currentTime - it->second.updateTime > HOST_EXPIRY_TIME)
       {
         map.erase(it->first);
         goto retry;
@@ -124,10 +156,73 @@ using ConnectedClients =
     std::unordered_map<Common::TraversalHostId, EvictEntry<Common::TraversalInetAddress>>;
 using OutgoingPackets = std::unordered_map<Common::TraversalRequestId, OutgoingPacketInfo>;
 
-static int sock;
-static int sockAlt;
-static OutgoingPackets outgoingPackets;
-static ConnectedClients connectedClients;
+struct HostShard
+{
+  std::mutex mutex;
+  ConnectedClients clients;
+};
+
+struct PacketShard
+{
+  std::mutex mutex;
+  OutgoingPackets packets;
+};
+
+struct RelaySession
+{
+  // The socket the connecting client sends to, and the one the game host sends to.
+  int clientSock;
+  int hostSock;
+  // Learned from the first packet on each socket, which must come from the expected IP.
+  in6_addr expectedClientIp;
+  in6_addr expectedHostIp;
+  std::optional<sockaddr_in6> clientAddr;
+  std::optional<sockaddr_in6> hostAddr;
+  u64 lastActivity;
+};
+
+struct Worker
+{
+  size_t index;
+  int sock;
+  int sockAlt;
+  int poller;
+  // Packets allocated while handling a packet, which are sent once it has been handled.
+  std::deque<OutgoingPacketInfo> pendingPackets;
+  std::list<RelaySession> relays;
+  std::unordered_map<int, RelaySession*> relayFds;
+};
+
+static std::array<HostShard, SHARD_COUNT> hostShards;
+static std::array<PacketShard, SHARD_COUNT> packetShards;
+static std::vector<std::unique_ptr<Worker>> workers;
+static thread_local Worker* currentWorker;
+
+static std::optional<sockaddr_in6> relayAddress;
+
+static std::atomic<u64> packetsReceived;
+static std::atomic<u64> packetsSent;
+static std::atomic<u64> packetsPerSecond;
+static std::atomic<u64> relayedPackets;
+static std::atomic<u64> relayedBytes;
+static std::atomic<u64> activeRelays;
+
+static HostShard& GetHostShard(const Common::TraversalHostId& hostId)
+{
+  return hostShards[std::hash<Common::TraversalHostId>{}(hostId) % SHARD_COUNT];
+}
+
+static PacketShard& GetPacketShard(Common::TraversalRequestId requestId)
+{
+  return packetShards[requestId % SHARD_COUNT];
+}
+
+static void UpdateCurrentTime()
+{
+  currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+}
 
 static Common::TraversalInetAddress MakeInetAddress(const sockaddr_in6& addr)
 {
@@ -187,7 +282,7 @@ static void GetRandomHostId(Common::TraversalHostId* hostId)
 
 static const char* SenderName(sockaddr_in6* addr)
 {
-  static char buf[INET6_ADDRSTRLEN + 10]{};
+  static thread_local char buf[INET6_ADDRSTRLEN + 10]{};
   inet_ntop(PF_INET6, &addr->sin6_addr, buf, sizeof(buf));
   fmt::format_to(buf + strlen(buf), ":{}", ntohs(addr->sin6_port));
   return buf;
@@ -200,28 +295,34 @@ static void TrySend(const void* buffer, size_t size, sockaddr_in6* addr, bool fr
   fmt::print("{}-> {} {} {}\n", fromAlt ? "alt " : "", static_cast<int>(packet->type),
              static_cast<long long>(packet->requestId), SenderName(addr));
 #endif
-  if ((size_t)sendto(fromAlt ? sockAlt : sock, buffer, size, 0, (sockaddr*)addr, sizeof(*addr)) !=
-      size)
+  const int sendSock = fromAlt ? currentWorker->sockAlt : currentWorker->sock;
+  if ((size_t)sendto(sendSock, buffer, size, 0, (sockaddr*)addr, sizeof(*addr)) != size)
   {
     perror("sendto");
   }
+  packetsSent++;
 }
 
-static Common::TraversalPacket* AllocPacket(const sockaddr_in6& dest, bool fromAlt,
-                                            Common::TraversalRequestId misc = 0)
+static OutgoingPacketInfo* AllocPacketInfo(const sockaddr_in6& dest, bool fromAlt,
+                                           Common::TraversalRequestId misc = 0)
 {
   Common::TraversalRequestId requestId{};
   Common::Random::Generate(&requestId, sizeof(requestId));
-  OutgoingPacketInfo* info = &outgoingPackets[requestId];
+  OutgoingPacketInfo* info = &currentWorker->pendingPackets.emplace_back();
   info->fromAlt = fromAlt;
   info->dest = dest;
   info->misc = misc;
   info->tries = 0;
   info->sendTime = currentTime;
-  Common::TraversalPacket* result = &info->packet;
-  memset(result, 0, sizeof(*result));
-  result->requestId = requestId;
-  return result;
+  memset(&info->packet, 0, sizeof(info->packet));
+  info->packet.requestId = requestId;
+  return info;
+}
+
+static Common::TraversalPacket* AllocPacket(const sockaddr_in6& dest, bool fromAlt,
+                                            Common::TraversalRequestId misc = 0)
+{
+  return &AllocPacketInfo(dest, fromAlt, misc)->packet;
 }
 
 static void SendPacket(OutgoingPacketInfo* info)
@@ -231,32 +332,56 @@ static void SendPacket(OutgoingPacketInfo* info)
   TrySend(&info->packet, sizeof(info->packet), &info->dest, info->fromAlt);
 }
 
+static sockaddr_in6 GetConnectingClient(const OutgoingPacketInfo& info)
+{
+  return info.relayClient.value_or(MakeSinAddr(info.packet.pleaseSendPacket.address));
+}
+
+static void FlushPendingPackets()
+{
+  for (OutgoingPacketInfo& pending : currentWorker->pendingPackets)
+  {
+    PacketShard& shard = GetPacketShard(pending.packet.requestId);
+    std::lock_guard lk(shard.mutex);
+    OutgoingPacketInfo* info = &shard.packets[pending.packet.requestId];
+    *info = pending;
+    SendPacket(info);
+  }
+  currentWorker->pendingPackets.clear();
+}
+
 static void ResendPackets()
 {
   std::vector<std::tuple<Common::TraversalInetAddress, bool, Common::TraversalRequestId>>
       todoFailures;
   todoFailures.clear();
-  for (auto it = outgoingPackets.begin(); it != outgoingPackets.end();)
+  // Every shard is resent by one worker.
+  for (size_t i = currentWorker->index; i < SHARD_COUNT; i += workers.size())
   {
-    OutgoingPacketInfo* info = &it->second;
-    if (currentTime - info->sendTime >= (u64)(300000 * info->tries))
+    PacketShard& shard = packetShards[i];
+    std::lock_guard lk(shard.mutex);
+    for (auto it = shard.packets.begin(); it != shard.packets.end();)
     {
-      if (info->tries >= NUMBER_OF_TRIES)
+      OutgoingPacketInfo* info = &it->second;
+      if (currentTime - info->sendTime >= (u64)(300000 * info->tries))
       {
-        if (info->packet.type == Common::TraversalPacketType::PleaseSendPacket)
+        if (info->tries >= NUMBER_OF_TRIES)
         {
-          todoFailures.push_back(
-              std::make_tuple(info->packet.pleaseSendPacket.address, info->fromAlt, info->misc));
+          if (info->packet.type == Common::TraversalPacketType::PleaseSendPacket)
+          {
+            todoFailures.push_back(std::make_tuple(MakeInetAddress(GetConnectingClient(*info)),
+                                                   info->fromAlt, info->misc));
+          }
+          it = shard.packets.erase(it);
+          continue;
+        }
+        else
+        {
+          SendPacket(info);
         }
-        it = outgoingPackets.erase(it);
-        continue;
-      }
-      else
-      {
-        SendPacket(info);
       }
+      ++it;
     }
-    ++it;
   }
 
   for (const auto& p : todoFailures)
@@ -268,6 +393,226 @@ static void ResendPackets()
   }
 }
 
+static void ExpireHosts()
+{
+  for (size_t i = currentWorker->index; i < SHARD_COUNT; i += workers.size())
+  {
+    HostShard& shard = hostShards[i];
+    std::lock_guard lk(shard.mutex);
+    std::erase_if(shard.clients, [](const auto& entry) {
+      return currentTime - entry.second.updateTime > HOST_EXPIRY_TIME;
+    });
+  }
+}
+
+static int MakeSocket(u16 port, bool reusePort)
+{
+  int s = socket(PF_INET6, SOCK_DGRAM, 0);
+  if (s == -1)
+  {
+    perror("socket");
+    return -1;
+  }
+  int no = 0;
+  if (setsockopt(s, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no)) < 0)
+  {
+    perror("setsockopt IPV6_V6ONLY");
+    close(s);
+    return -1;
+  }
+  int yes = 1;
+  if (reusePort && setsockopt(s, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes)) < 0)
+  {
+    perror("setsockopt SO_REUSEPORT");
+    close(s);
+    return -1;
+  }
+  if (fcntl(s, F_SETFL, fcntl(s, F_GETFL) | O_NONBLOCK) < 0)
+  {
+    perror("fcntl O_NONBLOCK");
+    close(s);
+    return -1;
+  }
+  in6_addr any = IN6ADDR_ANY_INIT;
+  sockaddr_in6 addr;
+#ifdef SIN6_LEN
+  addr.sin6_len = sizeof(addr);
+#endif
+  addr.sin6_family = AF_INET6;
+  addr.sin6_port = htons(port);
+  addr.sin6_flowinfo = 0;
+  addr.sin6_addr = any;
+  addr.sin6_scope_id = 0;
+  if (bind(s, (sockaddr*)&addr, sizeof(addr)) < 0)
+  {
+    perror("bind");
+    close(s);
+    return -1;
+  }
+  return s;
+}
+
+static int CreatePoller()
+{
+#ifdef __linux__
+  return epoll_create1(0);
+#else
+  return kqueue();
+#endif
+}
+
+static bool AddToPoller(int poller, int fd)
+{
+#ifdef __linux__
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  return epoll_ctl(poller, EPOLL_CTL_ADD, fd, &event) == 0;
+#else
+  struct kevent event;
+  EV_SET(&event, fd, EVFILT_READ, EV_ADD, 0, 0, nullptr);
+  return kevent(poller, &event, 1, nullptr, 0, nullptr) == 0;
+#endif
+}
+
+static int WaitForPoller(int poller, int* fds, int maxFds, int timeoutMs)
+{
+#ifdef __linux__
+  epoll_event events[64];
+  const int count = epoll_wait(poller, events, std::min(maxFds, 64), timeoutMs);
+  for (int i = 0; i < count; i++)
+    fds[i] = events[i].data.fd;
+#else
+  struct kevent events[64];
+  timespec timeout;
+  timeout.tv_sec = timeoutMs / 1000;
+  timeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+  const int count = kevent(poller, nullptr, 0, events, std::min(maxFds, 64), &timeout);
+  for (int i = 0; i < count; i++)
+    fds[i] = static_cast<int>(events[i].ident);
+#endif
+  return count;
+}
+
+static std::optional<sockaddr_in6> GetRelayAddress(int s)
+{
+  sockaddr_in6 local;
+  socklen_t len = sizeof(local);
+  if (getsockname(s, (sockaddr*)&local, &len) < 0)
+  {
+    perror("getsockname");
+    return std::nullopt;
+  }
+  sockaddr_in6 result = *relayAddress;
+  result.sin6_port = local.sin6_port;
+  return result;
+}
+
+// Returns the address the game host should punch towards, and the one the client should use.
+static std::optional<std::pair<sockaddr_in6, sockaddr_in6>>
+CreateRelay(const sockaddr_in6& clientAddr, const sockaddr_in6& hostAddr)
+{
+  const int clientSock = MakeSocket(0, false);
+  if (clientSock == -1)
+    return std::nullopt;
+  const int hostSock = MakeSocket(0, false);
+  if (hostSock == -1)
+  {
+    close(clientSock);
+    return std::nullopt;
+  }
+
+  const auto hostFacing = GetRelayAddress(hostSock);
+  const auto clientFacing = GetRelayAddress(clientSock);
+  if (!hostFacing || !clientFacing || !AddToPoller(currentWorker->poller, clientSock) ||
+      !AddToPoller(currentWorker->poller, hostSock))
+  {
+    close(clientSock);
+    close(hostSock);
+    return std::nullopt;
+  }
+
+  RelaySession& relay = currentWorker->relays.emplace_back();
+  relay.clientSock = clientSock;
+  relay.hostSock = hostSock;
+  relay.expectedClientIp = clientAddr.sin6_addr;
+  relay.expectedHostIp = hostAddr.sin6_addr;
+  relay.lastActivity = currentTime;
+  currentWorker->relayFds[clientSock] = &relay;
+  currentWorker->relayFds[hostSock] = &relay;
+  activeRelays++;
+  return std::make_pair(*hostFacing, *clientFacing);
+}
+
+static bool IsSameAddress(const sockaddr_in6& a, const sockaddr_in6& b)
+{
+  return a.sin6_port == b.sin6_port && memcmp(&a.sin6_addr, &b.sin6_addr, sizeof(in6_addr)) == 0;
+}
+
+static void HandleRelayPackets(RelaySession* relay, int fd)
+{
+  const bool fromHost = fd == relay->hostSock;
+  std::optional<sockaddr_in6>& source = fromHost ? relay->hostAddr : relay->clientAddr;
+  const std::optional<sockaddr_in6>& dest = fromHost ? relay->clientAddr : relay->hostAddr;
+  const in6_addr& expectedIp = fromHost ? relay->expectedHostIp : relay->expectedClientIp;
+
+  // Bounded so that one busy relay can't starve the rest of the worker.
+  for (int i = 0; i < 64; i++)
+  {
+    u8 buffer[2048];
+    sockaddr_in6 raddr;
+    socklen_t addrLen = sizeof(raddr);
+    const ssize_t rv = recvfrom(fd, buffer, sizeof(buffer), 0, (sockaddr*)&raddr, &addrLen);
+    if (rv < 0)
+      break;
+
+    if (!source)
+    {
+      if (memcmp(&raddr.sin6_addr, &expectedIp, sizeof(in6_addr)) != 0)
+        continue;
+      source = raddr;
+    }
+    else if (!IsSameAddress(raddr, *source))
+    {
+      continue;
+    }
+
+    relay->lastActivity = currentTime;
+    // The game host's hole punching packet arrives before the client has sent anything.
+    if (!dest)
+      continue;
+
+    sockaddr_in6 destAddr = *dest;
+    const int sendSock = fromHost ? relay->clientSock : relay->hostSock;
+    if (sendto(sendSock, buffer, rv, 0, (sockaddr*)&destAddr, sizeof(destAddr)) == rv)
+    {
+      relayedPackets++;
+      relayedBytes += rv;
+    }
+  }
+}
+
+static void ExpireRelays()
+{
+  auto& relays = currentWorker->relays;
+  for (auto it = relays.begin(); it != relays.end();)
+  {
+    if (currentTime - it->lastActivity <= RELAY_EXPIRY_TIME)
+    {
+      ++it;
+      continue;
+    }
+
+    // Closing the sockets also removes them from the poller.
+    currentWorker->relayFds.erase(it->clientSock);
+    currentWorker->relayFds.erase(it->hostSock);
+    close(it->clientSock);
+    close(it->hostSock);
+    it = relays.erase(it);
+    activeRelays--;
+  }
+}
+
 static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bool toAlt)
 {
 #if DEBUG
@@ -279,20 +624,25 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   {
   case Common::TraversalPacketType::Ack:
   {
-    auto it = outgoingPackets.find(packet->requestId);
-    if (it == outgoingPackets.end())
-      break;
-
-    OutgoingPacketInfo* info = &it->second;
+    std::optional<OutgoingPacketInfo> info;
+    {
+      PacketShard& shard = GetPacketShard(packet->requestId);
+      std::lock_guard lk(shard.mutex);
+      auto it = shard.packets.find(packet->requestId);
+      if (it == shard.packets.end())
+        break;
+      info = it->second;
+      shard.packets.erase(it);
+    }
 
     if (info->packet.type == Common::TraversalPacketType::PleaseSendPacket)
     {
-      auto* ready = AllocPacket(MakeSinAddr(info->packet.pleaseSendPacket.address), toAlt);
+      auto* ready = AllocPacket(GetConnectingClient(*info), toAlt);
       if (packet->ack.ok)
       {
         ready->type = Common::TraversalPacketType::ConnectReady;
         ready->connectReady.requestId = info->misc;
-        ready->connectReady.address = MakeInetAddress(info->dest);
+        ready->connectReady.address = MakeInetAddress(info->relayAddr.value_or(info->dest));
       }
       else
       {
@@ -301,13 +651,13 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
         ready->connectFailed.reason = Common::TraversalConnectFailedReason::ClientFailure;
       }
     }
-
-    outgoingPackets.erase(it);
     break;
   }
   case Common::TraversalPacketType::Ping:
   {
-    auto r = EvictFind(connectedClients, packet->ping.hostId, true);
+    HostShard& shard = GetHostShard(packet->ping.hostId);
+    std::lock_guard lk(shard.mutex);
+    auto r = EvictFind(shard.clients, packet->ping.hostId, true);
     packetOk = r.found;
     break;
   }
@@ -320,23 +670,23 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
     if (ok)
     {
       Common::TraversalHostId hostId{};
-      Common::TraversalInetAddress* iaddr{};
+      const Common::TraversalInetAddress iaddr = MakeInetAddress(*addr);
       // not that there is any significant change of
       // duplication, but...
       while (true)
       {
         GetRandomHostId(&hostId);
-        auto r = EvictFind(connectedClients, hostId);
+        HostShard& shard = GetHostShard(hostId);
+        std::lock_guard lk(shard.mutex);
+        auto r = EvictFind(shard.clients, hostId);
         if (!r.found)
         {
-          iaddr = EvictSet(connectedClients, hostId);
+          *EvictSet(shard.clients, hostId) = iaddr;
           break;
         }
       }
 
-      *iaddr = MakeInetAddress(*addr);
-
-      reply->helloFromServer.yourAddress = *iaddr;
+      reply->helloFromServer.yourAddress = iaddr;
       reply->helloFromServer.yourHostId = hostId;
     }
     break;
@@ -344,8 +694,15 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   case Common::TraversalPacketType::ConnectPlease:
   {
     Common::TraversalHostId& hostId = packet->connectPlease.hostId;
-    auto r = EvictFind(connectedClients, hostId);
-    if (!r.found)
+    std::optional<Common::TraversalInetAddress> hostAddr;
+    {
+      HostShard& shard = GetHostShard(hostId);
+      std::lock_guard lk(shard.mutex);
+      auto r = EvictFind(shard.clients, hostId);
+      if (r.found)
+        hostAddr = *r.value;
+    }
+    if (!hostAddr)
     {
       Common::TraversalPacket* reply = AllocPacket(*addr, toAlt);
       reply->type = Common::TraversalPacketType::ConnectFailed;
@@ -354,24 +711,40 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
     }
     else
     {
-      Common::TraversalPacket* please =
-          AllocPacket(MakeSinAddr(*r.value), toAlt, packet->requestId);
-      please->type = Common::TraversalPacketType::PleaseSendPacket;
-      please->pleaseSendPacket.address = MakeInetAddress(*addr);
+      const sockaddr_in6 hostSinAddr = MakeSinAddr(*hostAddr);
+      OutgoingPacketInfo* please = AllocPacketInfo(hostSinAddr, toAlt, packet->requestId);
+      please->packet.type = Common::TraversalPacketType::PleaseSendPacket;
+      please->packet.pleaseSendPacket.address = MakeInetAddress(*addr);
+      if (relayAddress)
+      {
+        if (const auto relay = CreateRelay(*addr, hostSinAddr))
+        {
+          please->packet.pleaseSendPacket.address = MakeInetAddress(relay->first);
+          please->relayClient = *addr;
+          please->relayAddr = relay->second;
+        }
+      }
     }
     break;
   }
   case Common::TraversalPacketType::TestPlease:
   {
     Common::TraversalHostId& hostId = packet->testPlease.hostId;
-    auto r = EvictFind(connectedClients, hostId);
-    if (r.found)
+    std::optional<Common::TraversalInetAddress> hostAddr;
+    {
+      HostShard& shard = GetHostShard(hostId);
+      std::lock_guard lk(shard.mutex);
+      auto r = EvictFind(shard.clients, hostId);
+      if (r.found)
+        hostAddr = *r.value;
+    }
+    if (hostAddr)
     {
       Common::TraversalPacket ack = {};
       ack.type = Common::TraversalPacketType::Ack;
       ack.requestId = packet->requestId;
       ack.ack.ok = true;
-      sockaddr_in6 mainAddr = MakeSinAddr(*r.value);
+      sockaddr_in6 mainAddr = MakeSinAddr(*hostAddr);
       TrySend(&ack, sizeof(ack), &mainAddr, toAlt);
     }
     break;
@@ -392,139 +765,289 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   }
 }
 
-int main()
+static void ReceivePackets(int recvsock, bool isAlt)
 {
-  int rv;
-  sock = socket(PF_INET6, SOCK_DGRAM, 0);
-  if (sock == -1)
+  // Bounded so that a flood on one socket can't starve the others.
+  for (int i = 0; i < 64; i++)
   {
-    perror("socket");
-    return 1;
+    sockaddr_in6 raddr;
+    socklen_t addrLen = sizeof(raddr);
+    Common::TraversalPacket packet{};
+    // note: switch to recvmmsg (yes, mmsg) if this becomes
+    // expensive
+    const ssize_t rv = recvfrom(recvsock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
+    if (rv < 0)
+    {
+      if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+        perror("recvfrom");
+      return;
+    }
+
+    packetsReceived++;
+    if ((size_t)rv < sizeof(packet))
+    {
+      fmt::print(stderr, "received short packet from {}\n", SenderName(&raddr));
+    }
+    else
+    {
+      HandlePacket(&packet, &raddr, isAlt);
+    }
   }
-  sockAlt = socket(PF_INET6, SOCK_DGRAM, 0);
-  if (sockAlt == -1)
+}
+
+static void WorkerThread(Worker* worker)
+{
+  currentWorker = worker;
+  u64 lastMaintenance = 0;
+  int readyFds[64];
+  while (true)
   {
-    perror("socket alt");
-    return 1;
+    const int count = WaitForPoller(worker->poller, readyFds, 64, 300);
+    if (count < 0 && errno != EINTR)
+    {
+      perror("poll");
+      exit(1);
+    }
+    UpdateCurrentTime();
+
+    for (int i = 0; i < count; i++)
+    {
+      const int fd = readyFds[i];
+      if (fd == worker->sock || fd == worker->sockAlt)
+      {
+        ReceivePackets(fd, fd == worker->sockAlt);
+      }
+      else
+      {
+        auto it = worker->relayFds.find(fd);
+        if (it != worker->relayFds.end())
+          HandleRelayPackets(it->second, fd);
+      }
+    }
+    FlushPendingPackets();
+
+    if (currentTime - lastMaintenance >= MAINTENANCE_INTERVAL)
+    {
+      lastMaintenance = currentTime;
+      ResendPackets();
+      FlushPendingPackets();
+      ExpireHosts();
+      ExpireRelays();
+#ifdef HAVE_LIBSYSTEMD
+      if (worker->index == 0)
+        sd_notify(0, "WATCHDOG=1");
+#endif
+    }
   }
-  int no = 0;
-  rv = setsockopt(sock, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no));
-  if (rv < 0)
+}
+
+static std::string FormatMetrics()
+{
+  u64 activeHosts = 0;
+  for (HostShard& shard : hostShards)
   {
-    perror("setsockopt IPV6_V6ONLY");
-    return 1;
+    std::lock_guard lk(shard.mutex);
+    activeHosts += shard.clients.size();
   }
-  rv = setsockopt(sockAlt, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no));
-  if (rv < 0)
+
+  return fmt::format("# TYPE traversal_active_hosts gauge\n"
+                     "traversal_active_hosts {}\n"
+                     "# TYPE traversal_packets_received_total counter\n"
+                     "traversal_packets_received_total {}\n"
+                     "# TYPE traversal_packets_sent_total counter\n"
+                     "traversal_packets_sent_total {}\n"
+                     "# TYPE traversal_packets_per_second gauge\n"
+                     "traversal_packets_per_second {}\n"
+                     "# TYPE traversal_relay_sessions gauge\n"
+                     "traversal_relay_sessions {}\n"
+                     "# TYPE traversal_relayed_packets_total counter\n"
+                     "traversal_relayed_packets_total {}\n"
+                     "# TYPE traversal_relayed_bytes_total counter\n"
+                     "traversal_relayed_bytes_total {}\n"
+                     "# TYPE traversal_worker_threads gauge\n"
+                     "traversal_worker_threads {}\n",
+                     activeHosts, packetsReceived.load(), packetsSent.load(),
+                     packetsPerSecond.load(), activeRelays.load(), relayedPackets.load(),
+                     relayedBytes.load(), workers.size());
+}
+
+static void MetricsThread(int listenSock)
+{
+  while (true)
   {
-    perror("setsockopt IPV6_V6ONLY alt");
-    return 1;
+    const int conn = accept(listenSock, nullptr, nullptr);
+    if (conn < 0)
+    {
+      if (errno != EINTR)
+        perror("accept");
+      continue;
+    }
+
+    timeval tv;
+    tv.tv_sec = 1;
+    tv.tv_usec = 0;
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    char request[1024]{};
+    const ssize_t len = recv(conn, request, sizeof(request) - 1, 0);
+
+    std::string response;
+    if (len > 0 && strncmp(request, "GET /metrics", strlen("GET /metrics")) == 0)
+    {
+      const std::string body = FormatMetrics();
+      response = fmt::format("HTTP/1.0 200 OK\r\n"
+                             "Content-Type: text/plain; version=0.0.4\r\n"
+                             "Content-Length: {}\r\n"
+                             "\r\n{}",
+                             body.size(), body);
+    }
+    else
+    {
+      response = "HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+    }
+    send(conn, response.data(), response.size(), 0);
+    close(conn);
   }
+}
+
+static int MakeMetricsSocket(u16 port)
+{
+  int s = socket(PF_INET6, SOCK_STREAM, 0);
+  if (s == -1)
+  {
+    perror("socket metrics");
+    return -1;
+  }
+  int no = 0;
+  int yes = 1;
+  setsockopt(s, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no));
+  setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
   in6_addr any = IN6ADDR_ANY_INIT;
-  sockaddr_in6 addr;
+  sockaddr_in6 addr{};
 #ifdef SIN6_LEN
   addr.sin6_len = sizeof(addr);
 #endif
   addr.sin6_family = AF_INET6;
-  addr.sin6_port = htons(PORT);
-  addr.sin6_flowinfo = 0;
+  addr.sin6_port = htons(port);
   addr.sin6_addr = any;
-  addr.sin6_scope_id = 0;
-
-  rv = bind(sock, (sockaddr*)&addr, sizeof(addr));
-  if (rv < 0)
-  {
-    perror("bind");
-    return 1;
-  }
-  addr.sin6_port = htons(PORT_ALT);
-  rv = bind(sockAlt, (sockaddr*)&addr, sizeof(addr));
-  if (rv < 0)
+  if (bind(s, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(s, 16) < 0)
   {
-    perror("bind alt");
-    return 1;
+    perror("bind metrics");
+    close(s);
+    return -1;
   }
+  return s;
+}
 
-  timeval tv;
-  tv.tv_sec = 0;
-  tv.tv_usec = 300000;
-  rv = setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-  if (rv < 0)
-  {
-    perror("setsockopt SO_RCVTIMEO");
-    return 1;
-  }
-  rv = setsockopt(sockAlt, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-  if (rv < 0)
+static std::optional<sockaddr_in6> ParseRelayAddress(const char* str)
+{
+  sockaddr_in6 result{};
+#ifdef SIN6_LEN
+  result.sin6_len = sizeof(result);
+#endif
+  result.sin6_family = AF_INET6;
+  in_addr v4;
+  if (inet_pton(AF_INET, str, &v4) == 1)
   {
-    perror("setsockopt SO_RCVTIMEO alt");
-    return 1;
+    u32* words = (u32*)result.sin6_addr.s6_addr;
+    words[2] = 0xffff0000;
+    words[3] = v4.s_addr;
+    return result;
   }
+  if (inet_pton(AF_INET6, str, &result.sin6_addr) == 1)
+    return result;
+  return std::nullopt;
+}
 
-#ifdef HAVE_LIBSYSTEMD
-  sd_notifyf(0, "READY=1\nSTATUS=Listening on port %d (alt port: %d)", PORT, PORT_ALT);
+static void PrintUsage(const char* name)
+{
+  fmt::print(stderr,
+             "usage: {} [--threads N] [--relay-address PUBLIC_IP] [--metrics-port PORT]\n"
+             "  --threads        number of worker threads (default: one per core on Linux)\n"
+             "  --relay-address  relay all connections through this server, whose public\n"
+             "                   address is PUBLIC_IP\n"
+             "  --metrics-port   serve metrics for Prometheus at http://*:PORT/metrics\n",
+             name);
+}
+
+int main(int argc, char** argv)
+{
+#ifdef __linux__
+  // Only Linux spreads the packets to a port over all sockets which are bound to it.
+  size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+#else
+  size_t threadCount = 1;
 #endif
+  int metricsPort = 0;
 
-  while (true)
+  for (int i = 1; i < argc; i++)
   {
-    tv.tv_sec = 0;
-    tv.tv_usec = 300000;
-    fd_set readSet;
-    FD_ZERO(&readSet);
-    FD_SET(sock, &readSet);
-    FD_SET(sockAlt, &readSet);
-    rv = select(std::max(sock, sockAlt) + 1, &readSet, nullptr, nullptr, &tv);
-    if (rv < 0)
+    if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
     {
-      if (errno != EINTR && errno != EAGAIN)
-      {
-        perror("recvfrom");
-        return 1;
-      }
+      threadCount = std::max(atoi(argv[++i]), 1);
     }
-
-    int recvsock;
-    if (FD_ISSET(sock, &readSet))
-    {
-      recvsock = sock;
-    }
-    else if (FD_ISSET(sockAlt, &readSet))
-    {
-      recvsock = sockAlt;
-    }
-    else
-    {
-      ResendPackets();
-      continue;
-    }
-    sockaddr_in6 raddr;
-    socklen_t addrLen = sizeof(raddr);
-    Common::TraversalPacket packet{};
-    // note: switch to recvmmsg (yes, mmsg) if this becomes
-    // expensive
-    rv = recvfrom(recvsock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
-    currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
-                      std::chrono::system_clock::now().time_since_epoch())
-                      .count();
-    if (rv < 0)
+    else if (strcmp(argv[i], "--relay-address") == 0 && i + 1 < argc)
     {
-      if (errno != EINTR && errno != EAGAIN)
+      relayAddress = ParseRelayAddress(argv[++i]);
+      if (!relayAddress)
       {
-        perror("recvfrom");
+        fmt::print(stderr, "invalid relay address {}\n", argv[i]);
         return 1;
       }
     }
-    else if ((size_t)rv < sizeof(packet))
+    else if (strcmp(argv[i], "--metrics-port") == 0 && i + 1 < argc)
     {
-      fmt::print(stderr, "received short packet from {}\n", SenderName(&raddr));
+      metricsPort = atoi(argv[++i]);
     }
     else
     {
-      HandlePacket(&packet, &raddr, recvsock == sockAlt);
+      PrintUsage(argv[0]);
+      return 1;
     }
-    ResendPackets();
+  }
+
+  // Metrics clients which disconnect early mustn't kill the server.
+  signal(SIGPIPE, SIG_IGN);
+
+  for (size_t i = 0; i < threadCount; i++)
+  {
+    auto worker = std::make_unique<Worker>();
+    worker->index = i;
+    worker->sock = MakeSocket(PORT, threadCount > 1);
+    worker->sockAlt = MakeSocket(PORT_ALT, threadCount > 1);
+    worker->poller = CreatePoller();
+    if (worker->sock == -1 || worker->sockAlt == -1)
+      return 1;
+    if (worker->poller == -1 || !AddToPoller(worker->poller, worker->sock) ||
+        !AddToPoller(worker->poller, worker->sockAlt))
+    {
+      perror("poller");
+      return 1;
+    }
+    workers.push_back(std::move(worker));
+  }
+
+  if (metricsPort != 0)
+  {
+    const int metricsSock = MakeMetricsSocket(static_cast<u16>(metricsPort));
+    if (metricsSock == -1)
+      return 1;
+    std::thread(MetricsThread, metricsSock).detach();
+  }
+
+  for (const auto& worker : workers)
+    std::thread(WorkerThread, worker.get()).detach();
+
 #ifdef HAVE_LIBSYSTEMD
-    sd_notify(0, "WATCHDOG=1");
+  sd_notifyf(0, "READY=1\nSTATUS=Listening on port %d (alt port: %d) with %zu threads", PORT,
+             PORT_ALT, threadCount);
 #endif
+
+  u64 lastPacketsReceived = 0;
+  while (true)
+  {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    const u64 received = packetsReceived.load();
+    packetsPerSecond = received - lastPacketsReceived;
+    lastPacketsReceived = received;
   }
 }
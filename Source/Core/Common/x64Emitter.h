@@ -1107,6 +1107,18 @@ public:
     ABI_CallFunction(func);
   }
 
+  template <typename FunctionPointer>
+  void ABI_CallFunctionPPCA(int bits, FunctionPointer func, const void* param1, const void* param2,
+                            u32 param3, const Gen::OpArg& arg4)
+  {
+    if (!arg4.IsSimpleReg(ABI_PARAM4))
+      MOV(bits, R(ABI_PARAM4), arg4);
+    MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(param1)));
+    MOV(64, R(ABI_PARAM2), Imm64(reinterpret_cast<u64>(param2)));
+    MOV(32, R(ABI_PARAM3), Imm32(param3));
+    ABI_CallFunction(func);
+  }
+
   // Pass a register as a parameter.
   template <typename FunctionPointer>
   void ABI_CallFunctionR(FunctionPointer func, X64Reg reg1)
@@ -1199,6 +1211,14 @@ public:
     auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
     ABI_CallFunctionPPC(trampoline, reinterpret_cast<const void*>(f), p1, p2);
   }
+
+  template <typename T, typename... Args>
+  void ABI_CallLambdaPCA(int bits, const std::function<T(Args...)>* f, void* p1, u32 p2,
+                         const Gen::OpArg& arg3)
+  {
+    auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
+    ABI_CallFunctionPPCA(bits, trampoline, reinterpret_cast<const void*>(f), p1, p2, arg3);
+  }
 };  // class XEmitter
 
 class X64CodeBlock : public Common::CodeBlock<XEmitter>
@@ -6,6 +6,7 @@
 #include "Core/AchievementManager.h"
 
 #include <cctype>
+#include <cstring>
 #include <memory>
 
 #include <fmt/format.h>
@@ -27,6 +28,7 @@
 #include "Core/HW/Memmap.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
 #include "UICommon/DiscordPresence.h"
@@ -1017,6 +1019,33 @@ u32 AchievementManager::MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_
     return 0;
   }
   Core::CPUThreadGuard threadguard(system);
+
+  // rc_client reads every memory reference of every condition each frame, so copy straight out of
+  // MEM1 or MEM2 when we can. This is only equivalent to reading through the MMU if the data cache
+  // isn't being emulated.
+  auto& memory = system.GetMemory();
+  if (!system.GetPPCState().m_enable_dcache)
+  {
+    const u8* source = nullptr;
+    if (memory.GetRAM() && address < memory.GetRamSizeReal() &&
+        num_bytes <= memory.GetRamSizeReal() - address)
+    {
+      source = memory.GetRAM() + address;
+    }
+    else if (memory.GetEXRAM() && (address >> 28) == 0x1 &&
+             (address & 0x0FFFFFFF) < memory.GetExRamSizeReal() &&
+             num_bytes <= memory.GetExRamSizeReal() - (address & 0x0FFFFFFF))
+    {
+      source = memory.GetEXRAM() + (address & 0x0FFFFFFF);
+    }
+
+    if (source)
+    {
+      std::memcpy(buffer, source, num_bytes);
+      return num_bytes;
+    }
+  }
+
   for (u32 num_read = 0; num_read < num_bytes; num_read++)
   {
     auto value = system.GetMMU().HostTryReadU8(threadguard, address + num_read,
@@ -21,10 +21,13 @@
 #include "Core/ActionReplay.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <bit>
 #include <iterator>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <variant>
@@ -81,9 +84,24 @@ enum
   SUB_MASTER_CODE = 0x03,
 };
 
+// Bytes that a code writes to consecutive addresses.
+struct WriteRun
+{
+  u32 address;
+  std::vector<u8> data;
+};
+// Codes that only write constant values (which covers most widescreen, frame rate and quality of
+// life codes) compiled into the runs of bytes they write, so that they don't need to be
+// interpreted every frame.
+using CompiledCode = std::optional<std::vector<WriteRun>>;
+
 // General lock. Protects codes list and internal log.
 static std::mutex s_lock;
 static std::vector<ARCode> s_active_codes;
+// Compiled versions of s_active_codes, or nullopt for codes that must be interpreted. Only valid
+// while s_compiled_codes_dirty is false.
+static std::vector<CompiledCode> s_compiled_codes;
+static bool s_compiled_codes_dirty = true;
 static std::vector<ARCode> s_synced_codes;
 static std::vector<std::string> s_internal_log;
 static std::atomic<bool> s_use_internal_log{false};
@@ -119,6 +137,7 @@ void ApplyCodes(std::span<const ARCode> codes)
 
   std::lock_guard guard(s_lock);
   s_disable_logging = false;
+  s_compiled_codes_dirty = true;
   s_active_codes.clear();
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [](const ARCode& code) { return code.enabled; });
@@ -127,6 +146,7 @@ void ApplyCodes(std::span<const ARCode> codes)
 
 void SetSyncedCodesAsActive()
 {
+  s_compiled_codes_dirty = true;
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
@@ -147,6 +167,7 @@ std::vector<ARCode> ApplyAndReturnCodes(std::span<const ARCode> codes)
   {
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
+    s_compiled_codes_dirty = true;
     s_active_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.enabled; });
@@ -165,6 +186,7 @@ void AddCode(ARCode code)
   {
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
+    s_compiled_codes_dirty = true;
     s_active_codes.emplace_back(std::move(code));
   }
 }
@@ -988,6 +1010,101 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   return true;
 }
 
+static void AppendWrite(std::vector<WriteRun>* runs, u32 address, std::span<const u8> data)
+{
+  if (runs->empty() || runs->back().address + runs->back().data.size() != address)
+    runs->push_back({address, {}});
+  runs->back().data.insert(runs->back().data.end(), data.begin(), data.end());
+}
+
+// Returns nullopt if the code does anything other than RAM writes and fills.
+static CompiledCode CompileCode(const ARCode& arcode)
+{
+  std::vector<WriteRun> runs;
+  for (const AREntry& entry : arcode.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+    const u32 data = entry.value;
+
+    if (0x0 == addr)
+    {
+      const u8 zcode = data >> 29;
+      if (zcode == ZCODE_END)
+        break;
+      if (zcode == ZCODE_NORM)
+        continue;
+      return std::nullopt;
+    }
+
+    if ((addr >= 0x00002000 && addr < 0x00003000) || addr.type != 0x00 ||
+        addr.subtype != SUB_RAM_WRITE)
+    {
+      return std::nullopt;
+    }
+
+    const u32 new_addr = addr.GCAddress();
+    switch (addr.size)
+    {
+    case DATATYPE_8BIT:
+    {
+      const std::vector<u8> bytes((data >> 8) + 1, static_cast<u8>(data));
+      AppendWrite(&runs, new_addr, bytes);
+      break;
+    }
+    case DATATYPE_16BIT:
+    {
+      const u32 repeat = data >> 16;
+      std::vector<u8> bytes;
+      bytes.reserve((repeat + 1) * 2);
+      for (u32 i = 0; i <= repeat; ++i)
+      {
+        bytes.push_back(static_cast<u8>(data >> 8));
+        bytes.push_back(static_cast<u8>(data));
+      }
+      AppendWrite(&runs, new_addr, bytes);
+      break;
+    }
+    case DATATYPE_32BIT_FLOAT:
+    case DATATYPE_32BIT:
+    {
+      const std::array<u8, 4> bytes{static_cast<u8>(data >> 24), static_cast<u8>(data >> 16),
+                                    static_cast<u8>(data >> 8), static_cast<u8>(data)};
+      AppendWrite(&runs, new_addr, bytes);
+      break;
+    }
+    default:
+      return std::nullopt;
+    }
+  }
+  return runs;
+}
+
+static void RunCompiledCode(const Core::CPUThreadGuard& guard, std::span<const WriteRun> runs)
+{
+  for (const WriteRun& run : runs)
+  {
+    u32 address = run.address;
+    std::span<const u8> data = run.data;
+
+    // Write whole words wherever the run is aligned.
+    while (!data.empty() && ((address & 3) != 0 || data.size() < 4))
+    {
+      PowerPC::MMU::HostWrite_U8(guard, data[0], address++);
+      data = data.subspan(1);
+    }
+    while (data.size() >= 4)
+    {
+      PowerPC::MMU::HostWrite_U32(guard, u32{data[0]} << 24 | u32{data[1]} << 16 |
+                                             u32{data[2]} << 8 | data[3],
+                                  address);
+      address += 4;
+      data = data.subspan(4);
+    }
+    for (const u8 byte : data)
+      PowerPC::MMU::HostWrite_U8(guard, byte, address++);
+  }
+}
+
 void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
 {
   if (!Config::AreCheatsEnabled())
@@ -997,12 +1114,39 @@ void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
+
+  // Codes are interpreted the first time they run, so that they get logged, and compiled after.
+  if (!s_disable_logging || s_compiled_codes_dirty)
+  {
+    std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
+      const bool success = RunCodeLocked(cpu_guard, code);
+      LogInfo("\n");
+      return !success;
+    });
+    s_disable_logging = true;
+
+    s_compiled_codes.clear();
+    s_compiled_codes.reserve(s_active_codes.size());
+    for (const ARCode& code : s_active_codes)
+      s_compiled_codes.push_back(CompileCode(code));
+    s_compiled_codes_dirty = false;
+    return;
+  }
+
+  std::size_t index = 0;
+  std::erase_if(s_active_codes, [&cpu_guard, &index](const ARCode& code) {
+    const CompiledCode& compiled = s_compiled_codes[index++];
+    if (compiled)
+    {
+      RunCompiledCode(cpu_guard, *compiled);
+      return false;
+    }
+
     const bool success = RunCodeLocked(cpu_guard, code);
-    LogInfo("\n");
+    if (!success)
+      s_compiled_codes_dirty = true;
     return !success;
   });
-  s_disable_logging = true;
 }
 
 }  // namespace ActionReplay
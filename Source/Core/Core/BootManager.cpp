@@ -31,6 +31,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Boot/Boot.h"
+#include "Core/BootProfile.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Config/SYSCONFSettings.h"
 #include "Core/ConfigLoaders/BaseConfigLoader.h"
@@ -61,10 +62,14 @@ bool BootCore(Core::System& system, std::unique_ptr<BootParameters> boot,
   if (!boot)
     return false;
 
+  Core::BootProfile::Start();
+  Core::BootProfile::PhaseTimer boot_phases;
+
   SConfig& StartUp = SConfig::GetInstance();
 
   if (!StartUp.SetPathsAndGameMetadata(system, *boot))
     return false;
+  boot_phases.Lap("Game metadata");
 
   // Movie settings
   auto& movie = system.GetMovie();
@@ -144,13 +149,15 @@ bool BootCore(Core::System& system, std::unique_ptr<BootParameters> boot,
   if (!boot->riivolution_patches.empty())
     Config::SetCurrent(Config::MAIN_FAST_DISC_SPEED, true);
 
+  boot_phases.Lap("Settings");
+
   system.Initialize();
 
   Core::UpdateWantDeterminism(system, /*initial*/ true);
 
   if (system.IsWii())
   {
-    Core::InitializeWiiRoot(Core::WantsDeterminism());
+    Core::InitializeWiiRoot(Core::WantsDeterminism(), Config::Get(Config::MAIN_WII_IN_MEMORY_NAND));
 
     // Ensure any new settings are written to the SYSCONF
     if (!Core::WantsDeterminism())
@@ -166,6 +173,8 @@ bool BootCore(Core::System& system, std::unique_ptr<BootParameters> boot,
     }
   }
 
+  boot_phases.Lap("System and NAND setup");
+
   AchievementManager::GetInstance().CloseGame();
 
   const bool load_ipl = !system.IsWii() && !Config::Get(Config::MAIN_SKIP_IPL) &&
@@ -0,0 +1,109 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/BootProfile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <picojson.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/JsonUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "VideoCommon/OnScreenDisplay.h"
+
+namespace Core::BootProfile
+{
+static std::mutex s_mutex;
+static std::atomic<bool> s_active = false;
+static Clock::time_point s_start;
+static std::vector<Phase> s_phases;
+
+static double ToMilliseconds(Clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void Start()
+{
+  std::lock_guard lk(s_mutex);
+  s_start = Clock::now();
+  s_phases.clear();
+  s_active.store(true, std::memory_order_relaxed);
+}
+
+void AddPhase(std::string name, Clock::time_point start, Clock::time_point end)
+{
+  if (!s_active.load(std::memory_order_relaxed))
+    return;
+
+  std::lock_guard lk(s_mutex);
+  s_phases.push_back({std::move(name), start - s_start, end - start});
+}
+
+static void WriteJSON(const std::vector<Phase>& phases, Clock::duration total)
+{
+  picojson::array phase_array;
+  for (const Phase& phase : phases)
+  {
+    picojson::object object;
+    object.emplace("name", phase.name);
+    object.emplace("start_ms", ToMilliseconds(phase.start));
+    object.emplace("duration_ms", ToMilliseconds(phase.duration));
+    phase_array.emplace_back(std::move(object));
+  }
+
+  picojson::object root;
+  root.emplace("total_ms", ToMilliseconds(total));
+  root.emplace("phases", std::move(phase_array));
+
+  const std::string path = File::GetUserPath(D_LOGS_IDX) + "BootProfile.json";
+  if (!JsonToFile(path, picojson::value{std::move(root)}, true))
+    WARN_LOG_FMT(BOOT, "Failed to write boot profile to {}", path);
+}
+
+void OnFrameEnd()
+{
+  if (!s_active.load(std::memory_order_relaxed))
+    return;
+
+  std::vector<Phase> phases;
+  Clock::duration total;
+  {
+    std::lock_guard lk(s_mutex);
+    if (!s_active.exchange(false, std::memory_order_relaxed))
+      return;
+
+    // Whatever happens between the last recorded phase and the end of the first frame.
+    total = Clock::now() - s_start;
+    Clock::duration last_end{};
+    for (const Phase& phase : s_phases)
+      last_end = std::max(last_end, phase.start + phase.duration);
+    s_phases.push_back({"First frame", last_end, total - last_end});
+
+    phases = std::move(s_phases);
+  }
+
+  for (const Phase& phase : phases)
+  {
+    INFO_LOG_FMT(BOOT, "Boot phase {}: {:.1f} ms (at {:.1f} ms)", phase.name,
+                 ToMilliseconds(phase.duration), ToMilliseconds(phase.start));
+  }
+  NOTICE_LOG_FMT(BOOT, "Time to first frame: {:.1f} ms", ToMilliseconds(total));
+  WriteJSON(phases, total);
+
+  if (Config::Get(Config::GFX_SHOW_FPS) || Config::Get(Config::GFX_SHOW_SPEED))
+  {
+    OSD::AddMessage(fmt::format("Time to first frame: {:.0f} ms", ToMilliseconds(total)),
+                    OSD::Duration::NORMAL);
+  }
+}
+}  // namespace Core::BootProfile
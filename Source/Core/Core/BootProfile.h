@@ -0,0 +1,48 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+// Records how long each step of booting takes, from BootManager::BootCore until the end of the
+// first emulated frame. When the first frame ends, the steps are logged and written to
+// BootProfile.json in the Logs directory.
+namespace Core::BootProfile
+{
+using Clock = std::chrono::steady_clock;
+
+struct Phase
+{
+  std::string name;
+  // Relative to the start of the boot.
+  Clock::duration start;
+  Clock::duration duration;
+};
+
+void Start();
+void AddPhase(std::string name, Clock::time_point start, Clock::time_point end);
+
+// Must be called at the end of every frame. The first call after Start() finishes the profile.
+void OnFrameEnd();
+
+// Records consecutive phases: each call to Lap() adds a phase covering the time since the previous
+// one (or since the timer was created).
+class PhaseTimer
+{
+public:
+  PhaseTimer() : m_start(Clock::now()) {}
+
+  void Lap(std::string name)
+  {
+    const Clock::time_point now = Clock::now();
+    AddPhase(std::move(name), m_start, now);
+    m_start = now;
+  }
+
+private:
+  Clock::time_point m_start;
+};
+}  // namespace Core::BootProfile
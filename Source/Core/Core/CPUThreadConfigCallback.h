@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "Common/Config/Config.h"
 
 // This file lets you register callbacks like in Common/Config/Config.h, with the difference that
@@ -27,4 +29,17 @@ void RemoveConfigChangedCallback(ConfigChangedCallbackID callback_id);
 // Should be called regularly from the CPU thread
 void CheckForConfigChanges();
 
+// For Config::Snapshot, to reload the snapshot on the CPU thread.
+struct Callbacks
+{
+  static ConfigChangedCallbackID Add(Config::ConfigChangedCallback callback)
+  {
+    return AddConfigChangedCallback(std::move(callback));
+  }
+  static void Remove(ConfigChangedCallbackID callback_id)
+  {
+    RemoveConfigChangedCallback(callback_id);
+  }
+};
+
 };  // namespace CPUThreadConfigCallback
@@ -4,6 +4,7 @@
 #include "Core/CheatSearch.h"
 
 #include <bit>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -15,6 +16,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -198,6 +200,80 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 {
   return PowerPC::MMU::HostTryReadF64(guard, addr, space);
 }
+
+// Reads values straight from the host memory that backs emulated RAM, translating each page only
+// once, rather than going through the MMU for every single value. Addresses which aren't backed by
+// MEM1 or MEM2 and values which cross a page boundary are read through the MMU. The searches read
+// addresses in ascending order, so remembering the last page is enough.
+class HostPageReader
+{
+public:
+  HostPageReader(const Core::CPUThreadGuard& guard, PowerPC::RequestedAddressSpace space)
+      : m_guard(guard), m_space(space),
+        m_translate(space != PowerPC::RequestedAddressSpace::Physical &&
+                    guard.GetSystem().GetPPCState().msr.DR)
+  {
+  }
+
+  template <typename T>
+  std::optional<PowerPC::ReadResult<T>> TryRead(u32 addr)
+  {
+    const u32 offset = addr & PowerPC::HW_PAGE_MASK;
+    if (offset + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+    {
+      const u32 page = addr & ~PowerPC::HW_PAGE_MASK;
+      if (!m_has_page || page != m_page)
+        LoadPage(page);
+
+      if (m_host_page)
+      {
+        T value;
+        std::memcpy(&value, m_host_page + offset, sizeof(T));
+        return PowerPC::ReadResult<T>(m_translate, Common::FromBigEndian(value));
+      }
+    }
+
+    return TryReadValueFromEmulatedMemory<T>(m_guard, addr, m_space);
+  }
+
+private:
+  void LoadPage(u32 page)
+  {
+    m_page = page;
+    m_has_page = true;
+    m_host_page = nullptr;
+
+    u32 physical_page = page;
+    if (m_translate)
+    {
+      const std::optional<u32> translated = m_guard.GetSystem().GetMMU().GetTranslatedAddress(page);
+      if (!translated)
+        return;
+      physical_page = *translated;
+    }
+
+    auto& memory = m_guard.GetSystem().GetMemory();
+    const u32 offset = physical_page & 0x0FFFFFFF;
+    switch (physical_page >> 28)
+    {
+    case 0x0:
+      if (memory.GetRAM() && offset < memory.GetRamSizeReal())
+        m_host_page = memory.GetRAM() + offset;
+      break;
+    case 0x1:
+      if (memory.GetEXRAM() && offset < memory.GetExRamSizeReal())
+        m_host_page = memory.GetEXRAM() + offset;
+      break;
+    }
+  }
+
+  const Core::CPUThreadGuard& m_guard;
+  const PowerPC::RequestedAddressSpace m_space;
+  const bool m_translate;
+  u32 m_page = 0;
+  bool m_has_page = false;
+  const u8* m_host_page = nullptr;
+};
 }  // namespace
 
 template <typename T>
@@ -219,6 +295,7 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  HostPageReader reader(guard, address_space);
   for (const Cheats::MemoryRange& range : memory_ranges)
   {
     if (range.m_length < sizeof(T))
@@ -235,7 +312,7 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
     for (u64 i = 0; i < length; i += increment_per_loop)
     {
       const u32 addr = start_address + i;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+      const auto current_value = reader.TryRead<T>(addr);
       if (!current_value)
         continue;
 
@@ -272,10 +349,11 @@ Cheats::NextSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  HostPageReader reader(guard, address_space);
   for (const auto& previous_result : previous_results)
   {
     const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+    const auto current_value = reader.TryRead<T>(addr);
     if (!current_value)
     {
       auto& r = results.emplace_back();
@@ -30,6 +30,7 @@ enum class CPUCore;
 namespace AudioCommon
 {
 enum class DPL2Quality;
+enum class ResamplingQuality;
 }
 
 namespace ExpansionInterface
@@ -55,10 +56,24 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+// Inlines conditional branches that are likely to be taken, turning the fallthrough path into a
+// side exit. Only has an effect when MAIN_JIT_FOLLOW_BRANCH is enabled.
+extern const Info<bool> MAIN_JIT_FOLLOW_CONDITIONAL_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
+// Also use fastmem for pages translated through the guest's page table, not just BATs.
+extern const Info<bool> MAIN_PAGE_TABLE_FASTMEM;
+// Back emulated memory and JIT code with large pages where the OS allows it, to reduce TLB misses.
+extern const Info<bool> MAIN_LARGE_PAGES;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
+extern const Info<bool> MAIN_JIT_PERSISTENT_CACHE;
+// Number of times a block has to be reached before the JIT compiles it. Until then, it is run
+// through the interpreter. 0 compiles every block the first time it is reached.
+extern const Info<int> MAIN_JIT_COMPILE_THRESHOLD;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
+// Replace memcpy, memset, strlen and a few OS and matrix functions with host code whenever they
+// would only touch RAM. Speeds up games at the cost of the time these functions take on console.
+extern const Info<bool> MAIN_FAST_LIBRARY_HLE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_MAX_FALLBACK;
@@ -74,6 +89,10 @@ extern const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY;
 extern const Info<int> MAIN_AUDIO_LATENCY;
 extern const Info<bool> MAIN_AUDIO_STRETCH;
 extern const Info<int> MAIN_AUDIO_STRETCH_LATENCY;
+// In ms. The mixer latency falls back to MAIN_TIMING_VARIANCE if it is 0.
+extern const Info<int> MAIN_AUDIO_MIXER_BUFFER_SIZE;
+extern const Info<int> MAIN_AUDIO_MIXER_LATENCY;
+extern const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -115,6 +134,7 @@ extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const Info<bool> MAIN_SYNC_GPU_ON_DEMAND;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
@@ -150,17 +170,29 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+// 0 means LZ4 is used instead
+extern const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL;
+extern const Info<bool> MAIN_REWIND_ENABLE;
+// In frames
+extern const Info<u32> MAIN_REWIND_INTERVAL;
+// In MiB
+extern const Info<u32> MAIN_REWIND_BUFFER_SIZE;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
 extern const Info<std::string> MAIN_WII_NUS_SHOP_URL;
 extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
+// Keep the NAND of emulation sessions in memory and discard all changes made to it.
+extern const Info<bool> MAIN_WII_IN_MEMORY_NAND;
 
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_THREAD;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
+// Number of extra threads which DSP HLE processes AX and Zelda UCode voices on. 0 processes them on
+// the emulation thread only.
+extern const Info<int> MAIN_DSP_HLE_VOICE_THREADS;
 extern const Info<bool> MAIN_DUMP_AUDIO;
 extern const Info<bool> MAIN_DUMP_AUDIO_SILENT;
 extern const Info<bool> MAIN_DUMP_UCODE;
@@ -299,6 +331,8 @@ extern const Info<bool> MAIN_GAMELIST_COLUMN_TAGS;
 // Main.FifoPlayer
 
 extern const Info<bool> MAIN_FIFOPLAYER_LOOP_REPLAY;
+// How many times to play the log when looping, or 0 to loop until stopped.
+extern const Info<u32> MAIN_FIFOPLAYER_LOOP_COUNT;
 extern const Info<bool> MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES;
 
 // Main.AutoUpdate
@@ -319,6 +353,7 @@ extern const Info<bool> MAIN_MOVIE_SHOW_RERECORD;
 // Main.Input
 
 extern const Info<bool> MAIN_INPUT_BACKGROUND_INPUT;
+extern const Info<bool> MAIN_INPUT_LATE_INPUT;
 
 // Main.Debug
 
@@ -336,6 +371,7 @@ extern const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING;
+extern const Info<bool> MAIN_DEBUG_MMIO_ACCESS_COUNTING;
 
 // Main.BluetoothPassthrough
 
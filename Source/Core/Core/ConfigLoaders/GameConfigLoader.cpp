@@ -5,8 +5,10 @@
 
 #include <algorithm>
 #include <array>
+#include <filesystem>
 #include <list>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -60,6 +62,56 @@ std::vector<std::string> GetGameIniFilenames(const std::string& id, std::optiona
   return filenames;
 }
 
+namespace
+{
+struct CachedIniFile
+{
+  std::filesystem::file_time_type last_write_time;
+  u64 size;
+  Common::IniFile ini;
+};
+
+std::mutex s_ini_cache_lock;
+std::map<std::string, CachedIniFile> s_ini_cache;
+}  // namespace
+
+// Merges the INI file at path into ini. Like IniFile::Load, missing files are skipped.
+static void MergeCachedIniFile(Common::IniFile* ini, const std::string& path)
+{
+  std::error_code error;
+  const auto last_write_time = std::filesystem::last_write_time(StringToPath(path), error);
+  if (error)
+    return;
+  const u64 size = File::GetSize(path);
+
+  std::lock_guard lk(s_ini_cache_lock);
+  auto [it, inserted] = s_ini_cache.try_emplace(path);
+  CachedIniFile& cached = it->second;
+  if (inserted || cached.last_write_time != last_write_time || cached.size != size)
+  {
+    cached.last_write_time = last_write_time;
+    cached.size = size;
+    cached.ini.Load(path);
+  }
+  ini->Merge(cached.ini);
+}
+
+Common::IniFile LoadGlobalGameIni(const std::string& id, std::optional<u16> revision)
+{
+  Common::IniFile ini;
+  for (const std::string& filename : GetGameIniFilenames(id, revision))
+    MergeCachedIniFile(&ini, File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename);
+  return ini;
+}
+
+Common::IniFile LoadLocalGameIni(const std::string& id, std::optional<u16> revision)
+{
+  Common::IniFile ini;
+  for (const std::string& filename : GetGameIniFilenames(id, revision))
+    MergeCachedIniFile(&ini, File::GetUserPath(D_GAMESETTINGS_IDX) + filename);
+  return ini;
+}
+
 using Location = Config::Location;
 using INIToLocationMap = std::map<std::pair<std::string, std::string>, Location>;
 using INIToSectionMap = std::map<std::string, std::pair<Config::System, std::string>>;
@@ -175,17 +227,9 @@ public:
 
   void Load(Config::Layer* layer) override
   {
-    Common::IniFile ini;
-    if (layer->GetLayer() == Config::LayerType::GlobalGame)
-    {
-      for (const std::string& filename : GetGameIniFilenames(m_id, m_revision))
-        ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
-    }
-    else
-    {
-      for (const std::string& filename : GetGameIniFilenames(m_id, m_revision))
-        ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
-    }
+    const Common::IniFile ini = layer->GetLayer() == Config::LayerType::GlobalGame ?
+                                    LoadGlobalGameIni(m_id, m_revision) :
+                                    LoadLocalGameIni(m_id, m_revision);
 
     const auto& system_sections = ini.GetSections();
 
@@ -281,9 +325,7 @@ void INIGameConfigLayerLoader::Save(Config::Layer* layer)
   if (layer->GetLayer() != Config::LayerType::LocalGame)
     return;
 
-  Common::IniFile ini;
-  for (const std::string& file_name : GetGameIniFilenames(m_id, m_revision))
-    ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + file_name, true);
+  Common::IniFile ini = LoadLocalGameIni(m_id, m_revision);
 
   for (const auto& config : layer->GetLayerMap())
   {
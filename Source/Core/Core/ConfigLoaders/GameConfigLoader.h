@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/IniFile.h"
 
 namespace Config
 {
@@ -20,6 +21,12 @@ namespace ConfigLoaders
 {
 std::vector<std::string> GetGameIniFilenames(const std::string& id, std::optional<u16> revision);
 
+// Load the game INIs of a game from the Sys folder (global) or the User folder (local), merged in
+// ascending order of priority. Each file is only parsed once per session, and again when it
+// changes on disk.
+Common::IniFile LoadGlobalGameIni(const std::string& id, std::optional<u16> revision);
+Common::IniFile LoadLocalGameIni(const std::string& id, std::optional<u16> revision);
+
 std::unique_ptr<Config::ConfigLayerLoader> GenerateGlobalGameConfigLoader(const std::string& id,
                                                                           u16 revision);
 std::unique_ptr<Config::ConfigLayerLoader> GenerateLocalGameConfigLoader(const std::string& id,
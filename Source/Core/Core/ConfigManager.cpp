@@ -422,27 +422,18 @@ Common::IniFile SConfig::LoadGameIni() const
 
 Common::IniFile SConfig::LoadDefaultGameIni(const std::string& id, std::optional<u16> revision)
 {
-  Common::IniFile game_ini;
-  for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
-  return game_ini;
+  return ConfigLoaders::LoadGlobalGameIni(id, revision);
 }
 
 Common::IniFile SConfig::LoadLocalGameIni(const std::string& id, std::optional<u16> revision)
 {
-  Common::IniFile game_ini;
-  for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
-  return game_ini;
+  return ConfigLoaders::LoadLocalGameIni(id, revision);
 }
 
 Common::IniFile SConfig::LoadGameIni(const std::string& id, std::optional<u16> revision)
 {
-  Common::IniFile game_ini;
-  for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
-  for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
+  Common::IniFile game_ini = ConfigLoaders::LoadGlobalGameIni(id, revision);
+  game_ini.Merge(ConfigLoaders::LoadLocalGameIni(id, revision));
   return game_ini;
 }
 
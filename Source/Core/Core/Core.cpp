@@ -9,6 +9,8 @@
 #include <functional>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 
@@ -26,6 +28,7 @@
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/EventCount.h"
 #include "Common/FPURoundMode.h"
 #include "Common/FatFsUtil.h"
 #include "Common/FileUtil.h"
@@ -42,8 +45,10 @@
 #include "Core/AchievementManager.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/BootProfile.h"
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
@@ -125,7 +130,7 @@ struct HostJob
 };
 static std::mutex s_host_jobs_lock;
 static std::queue<HostJob> s_host_jobs_queue;
-static Common::Event s_cpu_thread_job_finished;
+static Common::EventCount s_cpu_thread_job_finished;
 
 static thread_local bool tls_is_cpu_thread = false;
 static thread_local bool tls_is_gpu_thread = false;
@@ -177,6 +182,9 @@ void OnFrameEnd(Core::System& system)
     s_memory_watcher->Step(guard);
   }
 #endif
+
+  ::State::UpdateRewind(system);
+  BootProfile::OnFrameEnd();
 }
 
 // Display messages and return values
@@ -360,16 +368,25 @@ static void CPUSetInitialExecutionState(bool force_paused = false)
   });
 }
 
+// Gives a thread that the emulation speed depends on a higher priority than the rest, and reports
+// where it was placed.
+static void PlaceEmulationThread(std::string_view name)
+{
+  const std::string placement = Common::SetCurrentThreadPerformancePriority();
+  NOTICE_LOG_FMT(CORE, "{} placed on {}", name, placement);
+  if (Config::Get(Config::GFX_SHOW_FPS) || Config::Get(Config::GFX_SHOW_SPEED))
+    OSD::AddMessage(fmt::format("{}: {}", name, placement), OSD::Duration::NORMAL);
+}
+
 // Create the CPU thread, which is a CPU + Video thread in Single Core mode.
 static void CpuThread(Core::System& system, const std::optional<std::string>& savestate_path,
                       bool delete_savestate)
 {
   DeclareAsCPUThread();
 
-  if (system.IsDualCoreMode())
-    Common::SetCurrentThreadName("CPU thread");
-  else
-    Common::SetCurrentThreadName("CPU-GPU thread");
+  const char* const thread_name = system.IsDualCoreMode() ? "CPU thread" : "CPU-GPU thread";
+  Common::SetCurrentThreadName(thread_name);
+  PlaceEmulationThread(thread_name);
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
@@ -445,10 +462,10 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
 {
   DeclareAsCPUThread();
 
-  if (system.IsDualCoreMode())
-    Common::SetCurrentThreadName("FIFO player thread");
-  else
-    Common::SetCurrentThreadName("FIFO-GPU thread");
+  const char* const thread_name =
+      system.IsDualCoreMode() ? "FIFO player thread" : "FIFO-GPU thread";
+  Common::SetCurrentThreadName(thread_name);
+  PlaceEmulationThread(thread_name);
 
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = system.GetFifoPlayer().GetCPUCore())
@@ -506,6 +523,8 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   ASSERT(g_controller_interface.IsInit());
   g_controller_interface.ChangeWindow(wsi.render_window);
 
+  BootProfile::PhaseTimer boot_phases;
+
   Pad::LoadConfig();
   Pad::LoadGBAConfig();
   Keyboard::LoadConfig();
@@ -544,6 +563,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   FreeLook::LoadInputConfig();
+  boot_phases.Lap("Input configuration and SD card");
 
   system.GetCustomAssetLoader().Init();
   Common::ScopeGuard asset_loader_guard([&system] { system.GetCustomAssetLoader().Shutdown(); });
@@ -553,6 +573,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
   AudioCommon::InitSoundStream(system);
   Common::ScopeGuard audio_guard([&system] { AudioCommon::ShutdownSoundStream(system); });
+  boot_phases.Lap("Assets, movie and audio");
 
   HW::Init(system,
            NetPlay::IsNetPlayRunning() ? &(boot_session_data.GetNetplaySettings()->sram) : nullptr);
@@ -573,6 +594,8 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     system.GetPowerPC().GetDebugInterface().Clear(guard);
   }};
 
+  boot_phases.Lap("Hardware");
+
   VideoBackendBase::PopulateBackendInfo(wsi);
 
   if (!g_video_backend->Initialize(wsi))
@@ -586,6 +609,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
     g_video_backend->Shutdown();
   }};
+  boot_phases.Lap("Video backend");
 
   if (cpu_info.HTT)
     Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 4);
@@ -600,6 +624,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   AudioCommon::PostInitSoundStream(system);
+  boot_phases.Lap("DSP");
 
   // Set execution state to known values (CPU/FIFO/Audio Paused)
   system.GetCPU().Break();
@@ -625,6 +650,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     if (!CBoot::BootUp(system, guard, std::move(boot)))
       return;
   }
+  boot_phases.Lap("Loading the executable");
 
   // Initialise Wii filesystem contents.
   // This is done here after Boot and not in BootManager to ensure that we operate
@@ -637,6 +663,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     Core::InitializeWiiFileSystemContents(savegame_redirect, boot_session_data);
   else
     wiifs_guard.Dismiss();
+  boot_phases.Lap("Wii file system contents");
 
   // This adds the SyncGPU handler to CoreTiming, so now CoreTiming::Advance might block.
   system.GetFifo().Prepare();
@@ -659,6 +686,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    PlaceEmulationThread("Video thread");
     UndeclareAsCPUThread();
     Common::FPU::LoadDefaultSIMDState();
 
@@ -841,13 +869,15 @@ void RunOnCPUThread(Core::System& system, std::function<void()> function, bool w
   const bool was_running = PauseAndLock(system, true, true);
 
   // Queue the job function.
+  std::atomic<bool> finished = false;
   if (wait_for_completion)
   {
-    // Trigger the event after executing the function.
-    s_cpu_thread_job_finished.Reset();
-    system.GetCPU().AddCPUThreadJob([&function]() {
+    // Notify the waiters after executing the function. Every caller waits for its own flag, so
+    // concurrent callers can't take each other's notifications.
+    system.GetCPU().AddCPUThreadJob([&function, &finished]() {
       function();
-      s_cpu_thread_job_finished.Set();
+      finished.store(true, std::memory_order_release);
+      s_cpu_thread_job_finished.NotifyAll();
     });
   }
   else
@@ -861,9 +891,19 @@ void RunOnCPUThread(Core::System& system, std::function<void()> function, bool w
   // If we're waiting for completion, block until the event fires.
   if (wait_for_completion)
   {
-    // Periodically yield to the UI thread, so we don't deadlock.
-    while (!s_cpu_thread_job_finished.WaitFor(std::chrono::milliseconds(10)))
-      Host_YieldToUI();
+    while (true)
+    {
+      const Common::EventCount::Key key = s_cpu_thread_job_finished.PrepareWait();
+      if (finished.load(std::memory_order_acquire))
+      {
+        s_cpu_thread_job_finished.CancelWait();
+        break;
+      }
+
+      // Periodically yield to the UI thread, so we don't deadlock.
+      if (!s_cpu_thread_job_finished.WaitFor(key, std::chrono::milliseconds(10)))
+        Host_YieldToUI();
+    }
   }
 }
 
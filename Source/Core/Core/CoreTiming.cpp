@@ -4,9 +4,11 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
+#include <bit>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -20,6 +22,7 @@
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/AchievementSettings.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -33,10 +36,6 @@
 namespace CoreTiming
 {
 // Sort by time, unless the times are the same, in which case sort by the order added to the queue
-static bool operator>(const Event& left, const Event& right)
-{
-  return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-}
 static bool operator<(const Event& left, const Event& right)
 {
   return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
@@ -44,6 +43,251 @@ static bool operator<(const Event& left, const Event& right)
 
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
+void EventQueue::Push(const Event& event)
+{
+  u32 index = m_first_free;
+  if (index != NO_EVENT)
+  {
+    m_first_free = m_nodes[index].next;
+  }
+  else
+  {
+    index = static_cast<u32>(m_nodes.size());
+    m_nodes.emplace_back();
+  }
+
+  Node& node = m_nodes[index];
+  node.event = event;
+
+  EventType* type = event.type;
+  node.prev_of_type = NO_EVENT;
+  node.next_of_type = type->first_pending_event;
+  if (node.next_of_type != NO_EVENT)
+    m_nodes[node.next_of_type].prev_of_type = index;
+  type->first_pending_event = index;
+
+  ++m_size;
+  Insert(index);
+}
+
+void EventQueue::Insert(u32 index)
+{
+  const s64 time = m_nodes[index].event.time;
+
+  if (time < m_wheel_time)
+  {
+    // Keep the ready list sorted. This only happens when scheduling into the past, so the list is
+    // almost always empty.
+    u32 prev = NO_EVENT;
+    for (u32 i = m_list_heads[READY_LIST]; i != NO_EVENT; i = m_nodes[i].next)
+    {
+      if (m_nodes[index].event < m_nodes[i].event)
+        break;
+      prev = i;
+    }
+    LinkToList(index, READY_LIST, prev);
+    return;
+  }
+
+  const u64 differing_bits = static_cast<u64>(time) ^ static_cast<u64>(m_wheel_time);
+  const u32 level = differing_bits == 0 ? 0 : (std::bit_width(differing_bits) - 1) / SLOT_BITS;
+  if (level >= LEVELS)
+  {
+    LinkToList(index, OVERFLOW_LIST, NO_EVENT);
+    return;
+  }
+
+  const u32 slot = (static_cast<u64>(time) >> (level * SLOT_BITS)) & (SLOTS_PER_LEVEL - 1);
+  LinkToList(index, level * SLOTS_PER_LEVEL + slot, NO_EVENT);
+  m_occupied_slots[level] |= u64(1) << slot;
+}
+
+void EventQueue::LinkToList(u32 index, u32 list, u32 prev)
+{
+  Node& node = m_nodes[index];
+  node.list = list;
+  node.prev = prev;
+  node.next = prev == NO_EVENT ? m_list_heads[list] : m_nodes[prev].next;
+
+  if (node.next != NO_EVENT)
+    m_nodes[node.next].prev = index;
+  if (prev == NO_EVENT)
+    m_list_heads[list] = index;
+  else
+    m_nodes[prev].next = index;
+}
+
+void EventQueue::UnlinkFromList(u32 index)
+{
+  const Node& node = m_nodes[index];
+  if (node.next != NO_EVENT)
+    m_nodes[node.next].prev = node.prev;
+
+  if (node.prev != NO_EVENT)
+  {
+    m_nodes[node.prev].next = node.next;
+  }
+  else
+  {
+    m_list_heads[node.list] = node.next;
+    if (node.next == NO_EVENT && node.list < READY_LIST)
+    {
+      m_occupied_slots[node.list / SLOTS_PER_LEVEL] &= ~(u64(1) << (node.list % SLOTS_PER_LEVEL));
+    }
+  }
+}
+
+void EventQueue::Free(u32 index)
+{
+  Node& node = m_nodes[index];
+  UnlinkFromList(index);
+
+  if (node.next_of_type != NO_EVENT)
+    m_nodes[node.next_of_type].prev_of_type = node.prev_of_type;
+  if (node.prev_of_type != NO_EVENT)
+    m_nodes[node.prev_of_type].next_of_type = node.next_of_type;
+  else
+    node.event.type->first_pending_event = node.next_of_type;
+
+  node.next = m_first_free;
+  m_first_free = index;
+  --m_size;
+}
+
+u32 EventQueue::FindEarliestInList(u32 list) const
+{
+  u32 earliest = m_list_heads[list];
+  if (earliest == NO_EVENT)
+    return NO_EVENT;
+
+  for (u32 i = m_nodes[earliest].next; i != NO_EVENT; i = m_nodes[i].next)
+  {
+    if (m_nodes[i].event < m_nodes[earliest].event)
+      earliest = i;
+  }
+  return earliest;
+}
+
+u32 EventQueue::FindDueInWheel(s64 now)
+{
+  while (true)
+  {
+    if (m_occupied_slots[0] != 0)
+    {
+      const u32 slot = std::countr_zero(m_occupied_slots[0]);
+      const s64 time = (m_wheel_time & ~s64(SLOTS_PER_LEVEL - 1)) | slot;
+      if (time > now)
+        return NO_EVENT;
+
+      m_wheel_time = time;
+      return FindEarliestInList(slot);
+    }
+
+    u32 level = 1;
+    while (level < LEVELS && m_occupied_slots[level] == 0)
+      ++level;
+
+    if (level == LEVELS)
+    {
+      // The wheel is empty. Move it to the earliest far away event, if that one is due.
+      const u32 earliest = FindEarliestInList(OVERFLOW_LIST);
+      if (earliest == NO_EVENT || m_nodes[earliest].event.time > now)
+        return NO_EVENT;
+
+      m_wheel_time = m_nodes[earliest].event.time;
+      u32 i = std::exchange(m_list_heads[OVERFLOW_LIST], NO_EVENT);
+      while (i != NO_EVENT)
+        Insert(std::exchange(i, m_nodes[i].next));
+      continue;
+    }
+
+    // Move the wheel to the start of the earliest occupied slot and cascade its events.
+    const u32 slot = std::countr_zero(m_occupied_slots[level]);
+    const u32 shift = level * SLOT_BITS;
+    const s64 slot_time = (m_wheel_time & ~((s64(1) << (shift + SLOT_BITS)) - 1)) |
+                          (s64(slot) << shift);
+    if (slot_time > now)
+      return NO_EVENT;
+
+    m_wheel_time = slot_time;
+    m_occupied_slots[level] &= ~(u64(1) << slot);
+    u32 i = std::exchange(m_list_heads[level * SLOTS_PER_LEVEL + slot], NO_EVENT);
+    while (i != NO_EVENT)
+      Insert(std::exchange(i, m_nodes[i].next));
+  }
+}
+
+bool EventQueue::PopDue(s64 now, Event* event)
+{
+  // Everything on the ready list is earlier than the wheel time, and thus earlier than any event
+  // in the wheel.
+  u32 index = m_list_heads[READY_LIST];
+  if (index == NO_EVENT)
+    index = FindDueInWheel(now);
+  if (index == NO_EVENT)
+    return false;
+
+  *event = m_nodes[index].event;
+  Free(index);
+  return true;
+}
+
+s64 EventQueue::GetEarliestTime() const
+{
+  if (m_list_heads[READY_LIST] != NO_EVENT)
+    return m_nodes[m_list_heads[READY_LIST]].event.time;
+
+  if (m_occupied_slots[0] != 0)
+    return (m_wheel_time & ~s64(SLOTS_PER_LEVEL - 1)) | std::countr_zero(m_occupied_slots[0]);
+
+  for (u32 level = 1; level < LEVELS; ++level)
+  {
+    if (m_occupied_slots[level] != 0)
+    {
+      const u32 slot = std::countr_zero(m_occupied_slots[level]);
+      return m_nodes[FindEarliestInList(level * SLOTS_PER_LEVEL + slot)].event.time;
+    }
+  }
+
+  return m_nodes[FindEarliestInList(OVERFLOW_LIST)].event.time;
+}
+
+void EventQueue::RemoveAll(EventType* event_type)
+{
+  while (event_type->first_pending_event != NO_EVENT)
+    Free(event_type->first_pending_event);
+}
+
+void EventQueue::Clear(s64 time)
+{
+  for (u32 list = 0; list < LIST_COUNT; ++list)
+  {
+    for (u32 i = m_list_heads[list]; i != NO_EVENT; i = m_nodes[i].next)
+      m_nodes[i].event.type->first_pending_event = NO_EVENT;
+  }
+
+  m_nodes.clear();
+  m_first_free = NO_EVENT;
+  m_size = 0;
+  m_wheel_time = time;
+  m_list_heads.fill(NO_EVENT);
+  m_occupied_slots.fill(0);
+}
+
+std::vector<Event> EventQueue::GetSortedEvents() const
+{
+  std::vector<Event> events;
+  events.reserve(m_size);
+  for (u32 list = 0; list < LIST_COUNT; ++list)
+  {
+    for (u32 i = m_list_heads[list]; i != NO_EVENT; i = m_nodes[i].next)
+      events.push_back(m_nodes[i].event);
+  }
+
+  std::sort(events.begin(), events.end());
+  return events;
+}
+
 static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLate)
 {
 }
@@ -86,7 +330,7 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.IsEmpty(), "Cannot unregister events with events pending");
   m_event_types.clear();
 }
 
@@ -102,6 +346,7 @@ void CoreTimingManager::Init()
   m_globals.slice_length = MAX_SLICE_LENGTH;
   m_globals.global_timer = 0;
   m_idled_cycles = 0;
+  m_idle_skip_count = 0;
 
   // The time between CoreTiming being intialized and the first call to Advance() is considered
   // the slice boundary between slice -1 and slice 0. Dispatcher loops must call Advance() before
@@ -118,6 +363,14 @@ void CoreTimingManager::Init()
 
 void CoreTimingManager::Shutdown()
 {
+  if (m_idle_skip_count != 0)
+  {
+    const u64 total_cycles = std::max<u64>(GetTicks(), 1);
+    NOTICE_LOG_FMT(POWERPC, "Idle skipping in {}: {} loops skipped, {} of {} cycles ({:.1f}%)",
+                   SConfig::GetInstance().GetGameID(), m_idle_skip_count, m_idled_cycles,
+                   total_cycles, 100.0 * m_idled_cycles / total_cycles);
+  }
+
   std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
@@ -167,7 +420,10 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
-  p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
+  std::vector<Event> events;
+  if (!p.IsReadMode())
+    events = m_event_queue.GetSortedEvents();
+  p.DoEachElement(events, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
 
@@ -202,10 +458,9 @@ void CoreTimingManager::DoState(PointerWrap& p)
 
   if (p.IsReadMode())
   {
-    // When loading from a save state, we must assume the Event order is random and meaningless.
-    // The exact layout of the heap in memory is implementation defined, therefore it is platform
-    // and library version specific.
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_event_queue.Clear(m_globals.global_timer);
+    for (const Event& ev : events)
+      m_event_queue.Push(ev);
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -233,7 +488,7 @@ u64 CoreTimingManager::GetIdleTicks() const
 
 void CoreTimingManager::ClearPendingEvents()
 {
-  m_event_queue.clear();
+  m_event_queue.Clear(m_globals.global_timer);
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -262,8 +517,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_event_queue.Push(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -282,15 +536,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  auto itr = std::remove_if(m_event_queue.begin(), m_event_queue.end(),
-                            [&](const Event& e) { return e.type == event_type; });
-
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (itr != m_event_queue.end())
-  {
-    m_event_queue.erase(itr, m_event_queue.end());
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-  }
+  m_event_queue.RemoveAll(event_type);
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -317,8 +563,7 @@ void CoreTimingManager::MoveEvents()
   for (Event ev; m_ts_queue.Pop(ev);)
   {
     ev.fifo_order = m_event_fifo_id++;
-    m_event_queue.emplace_back(std::move(ev));
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_event_queue.Push(ev);
   }
 }
 
@@ -339,12 +584,8 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = true;
 
-  while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
+  for (Event evt; m_event_queue.PopDue(m_globals.global_timer, &evt);)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::pop_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-    m_event_queue.pop_back();
-
     Throttle(evt.time);
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
@@ -352,10 +593,10 @@ void CoreTimingManager::Advance()
   m_is_global_timer_sane = false;
 
   // Still events left (scheduled in the future)
-  if (!m_event_queue.empty())
+  if (!m_event_queue.IsEmpty())
   {
     m_globals.slice_length = static_cast<int>(
-        std::min<s64>(m_event_queue.front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
+        std::min<s64>(m_event_queue.GetEarliestTime() - m_globals.global_timer, MAX_SLICE_LENGTH));
   }
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
@@ -413,13 +654,37 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
     // Count amount of time sleeping for analytics
     const TimePoint time_after_sleep = Clock::now();
     g_perf_metrics.CountThrottleSleep(time_after_sleep - time);
+    m_throttle_frame_sleep += time_after_sleep - time;
+  }
+}
+
+void CoreTimingManager::DelayFrameStart()
+{
+  // Leave some of the idle time at the end of the frame, as the time it takes to emulate a frame
+  // varies, and a frame which finishes late is worse than the latency we're trying to save.
+  const DT delay = std::exchange(m_throttle_frame_sleep, DT::zero()) * 3 / 4;
+  if (delay <= std::chrono::duration_cast<DT>(DT_ms(1)))
+  {
+    g_perf_metrics.CountFrameDelay(DT::zero());
+    return;
   }
+
+  // The throttle deadline doesn't move, so the throttle catches up by not sleeping until the time
+  // spent here has been made up. Stay well clear of the lag which would make it skip VI interrupts.
+  const DT max_delay = std::min(m_max_fallback, m_max_variance) / 4;
+  const TimePoint time = Clock::now();
+  std::this_thread::sleep_until(time + std::min(delay, max_delay));
+  const DT slept = Clock::now() - time;
+  g_perf_metrics.CountThrottleSleep(slept);
+  g_perf_metrics.CountFrameDelay(slept);
+  m_throttle_frame_sleep = slept;
 }
 
 void CoreTimingManager::ResetThrottle(s64 cycle)
 {
   m_throttle_last_cycle = cycle;
   m_throttle_deadline = Clock::now();
+  m_throttle_frame_sleep = DT::zero();
 }
 
 TimePoint CoreTimingManager::GetCPUTimePoint(s64 cyclesLate) const
@@ -440,9 +705,7 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 
 void CoreTimingManager::LogPendingEvents() const
 {
-  auto clone = m_event_queue;
-  std::sort(clone.begin(), clone.end());
-  for (const Event& ev : clone)
+  for (const Event& ev : m_event_queue.GetSortedEvents())
   {
     INFO_LOG_FMT(POWERPC, "PENDING: Now: {} Pending: {} Type: {}", m_globals.global_timer, ev.time,
                  *ev.type->name);
@@ -455,10 +718,13 @@ void CoreTimingManager::AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clo
   m_throttle_clock_per_sec = new_ppc_clock;
   m_throttle_min_clock_per_sleep = new_ppc_clock / 1200;
 
-  for (Event& ev : m_event_queue)
+  std::vector<Event> events = m_event_queue.GetSortedEvents();
+  m_event_queue.Clear(m_globals.global_timer);
+  for (Event& ev : events)
   {
     const s64 ticks = (ev.time - m_globals.global_timer) * new_ppc_clock / old_ppc_clock;
     ev.time = m_globals.global_timer + ticks;
+    m_event_queue.Push(ev);
   }
 }
 
@@ -475,6 +741,7 @@ void CoreTimingManager::Idle()
   auto& ppc_state = m_system.GetPPCState();
   PowerPC::UpdatePerformanceMonitor(ppc_state.downcount, 0, 0, ppc_state);
   m_idled_cycles += DowncountToCycles(ppc_state.downcount);
+  ++m_idle_skip_count;
   ppc_state.downcount = 0;
 }
 
@@ -483,9 +750,7 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   std::string text = "Scheduled events\n";
   text.reserve(1000);
 
-  auto clone = m_event_queue;
-  std::sort(clone.begin(), clone.end());
-  for (const Event& ev : clone)
+  for (const Event& ev : m_event_queue.GetSortedEvents())
   {
     text += fmt::format("{} : {} {:016x}\n", *ev.type->name, ev.time, ev.userdata);
   }
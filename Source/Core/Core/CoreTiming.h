@@ -16,6 +16,7 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <array>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -50,6 +51,9 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+
+  // Used by EventQueue to find the pending events of this type without searching the whole queue.
+  u32 first_pending_event = UINT32_MAX;
 };
 
 struct Event
@@ -60,6 +64,79 @@ struct Event
   EventType* type;
 };
 
+// A hierarchical timing wheel with O(1) insertion and removal.
+//
+// Each level has 64 slots, and level n covers 64^(n+1) cycles. An event is stored on the lowest
+// level at which its time has the same digits as the wheel time above that level, so the events
+// in a level 0 slot all share the same time and the slots of each level are ordered after those
+// of the level below. When the wheel time reaches a slot on a higher level, its events get
+// redistributed ("cascaded") onto the lower levels.
+//
+// Events that are earlier than the wheel time (scheduled into the past) are kept in a small
+// sorted list, and events that are too far away for the wheel are kept in an unsorted overflow
+// list until the wheel time gets close enough.
+//
+// Events with the same time are always popped in fifo_order.
+class EventQueue
+{
+public:
+  static constexpr u32 NO_EVENT = UINT32_MAX;
+
+  EventQueue() { m_list_heads.fill(NO_EVENT); }
+
+  bool IsEmpty() const { return m_size == 0; }
+  size_t GetSize() const { return m_size; }
+
+  void Push(const Event& event);
+
+  // Removes the earliest event if it's due at or before the given time.
+  bool PopDue(s64 now, Event* event);
+
+  // Requires the queue to not be empty.
+  s64 GetEarliestTime() const;
+
+  void RemoveAll(EventType* event_type);
+
+  // Removes all events and restarts the wheel at the given time.
+  void Clear(s64 time);
+
+  // Returns all events, sorted by time and then fifo_order.
+  std::vector<Event> GetSortedEvents() const;
+
+private:
+  static constexpr u32 SLOT_BITS = 6;
+  static constexpr u32 SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+  static constexpr u32 LEVELS = 6;
+  static constexpr u32 READY_LIST = LEVELS * SLOTS_PER_LEVEL;
+  static constexpr u32 OVERFLOW_LIST = READY_LIST + 1;
+  static constexpr u32 LIST_COUNT = OVERFLOW_LIST + 1;
+
+  struct Node
+  {
+    Event event;
+    u32 list;
+    u32 prev;
+    u32 next;
+    u32 prev_of_type;
+    u32 next_of_type;
+  };
+
+  void Insert(u32 index);
+  void LinkToList(u32 index, u32 list, u32 prev);
+  void UnlinkFromList(u32 index);
+  void Free(u32 index);
+  u32 FindEarliestInList(u32 list) const;
+  u32 FindDueInWheel(s64 now);
+
+  std::vector<Node> m_nodes;
+  u32 m_first_free = NO_EVENT;
+  size_t m_size = 0;
+
+  s64 m_wheel_time = 0;
+  std::array<u32, LIST_COUNT> m_list_heads;
+  std::array<u64, LEVELS> m_occupied_slots{};
+};
+
 enum class FromThread
 {
   CPU,
@@ -148,6 +225,11 @@ public:
   // in order to allow custom throttling implementations to be tested.
   void Throttle(const s64 target_cycle);
 
+  // Called at the end of each emulated frame. Spends the time the throttle slept for during the
+  // previous frame up front instead, so that the next frame reads input as late as possible while
+  // still finishing at the same time.
+  void DelayFrameStart();
+
   TimePoint GetCPUTimePoint(s64 cyclesLate) const;  // Used by Dolphin Analytics
   bool GetVISkip() const;                           // Used By VideoInterface
 
@@ -163,11 +245,7 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::make_heap/push_heap/pop_heap.
-  // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-  // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accomodated
-  // by the standard adaptor class.
-  std::vector<Event> m_event_queue;
+  EventQueue m_event_queue;
   u64 m_event_fifo_id = 0;
   std::mutex m_ts_write_lock;
   Common::SPSCQueue<Event, false> m_ts_queue;
@@ -175,6 +253,8 @@ private:
   float m_last_oc_factor = 0.0f;
 
   s64 m_idled_cycles = 0;
+  // Not saved, only used for the statistics logged on shutdown.
+  u64 m_idle_skip_count = 0;
   u32 m_fake_dec_start_value = 0;
   u64 m_fake_dec_start_ticks = 0;
 
@@ -193,6 +273,8 @@ private:
   s64 m_throttle_clock_per_sec = 0;
   s64 m_throttle_min_clock_per_sleep = 0;
   bool m_throttle_disable_vi_int = false;
+  // Time spent sleeping since the last call to DelayFrameStart().
+  DT m_throttle_frame_sleep = {};
 
   DT m_max_fallback = {};
   DT m_max_variance = {};
@@ -11,6 +11,60 @@
 
 namespace DSP
 {
+namespace
+{
+// Decodes count samples from address onwards which need none of the special cases of
+// Accelerator::Read. read_byte returns the byte at an address.
+template <typename ReadByte>
+void DecodeSamples(u16 format, const s16* coefs, u16 pred_scale, u32 address, s16* yn1, s16* yn2,
+                   s16* out, u32 count, ReadByte read_byte)
+{
+  s16 hist1 = *yn1;
+  s16 hist2 = *yn2;
+
+  switch (format)
+  {
+  case 0x00:  // ADPCM audio
+  {
+    const int scale = 1 << (pred_scale & 0xF);
+    const int coef_idx = (pred_scale >> 4) & 0x7;
+    const s32 coef1 = coefs[coef_idx * 2 + 0];
+    const s32 coef2 = coefs[coef_idx * 2 + 1];
+
+    for (u32 i = 0; i < count; ++i, ++address)
+    {
+      const u8 byte = read_byte(address >> 1);
+      int temp = (address & 1) ? (byte & 0xF) : (byte >> 4);
+      if (temp >= 8)
+        temp -= 16;
+
+      const s32 val32 = (scale * temp) + ((0x400 + coef1 * hist1 + coef2 * hist2) >> 11);
+      hist2 = hist1;
+      hist1 = out[i] = static_cast<s16>(std::clamp<s32>(val32, -0x7FFF, 0x7FFF));
+    }
+    break;
+  }
+  case 0x0A:  // 16-bit PCM audio
+    for (u32 i = 0; i < count; ++i, ++address)
+    {
+      hist2 = hist1;
+      hist1 = out[i] = static_cast<s16>((read_byte(address * 2) << 8) | read_byte(address * 2 + 1));
+    }
+    break;
+  case 0x19:  // 8-bit PCM audio
+    for (u32 i = 0; i < count; ++i, ++address)
+    {
+      hist2 = hist1;
+      hist1 = out[i] = static_cast<s16>(read_byte(address) << 8);
+    }
+    break;
+  }
+
+  *yn1 = hist1;
+  *yn2 = hist2;
+}
+}  // namespace
+
 u16 Accelerator::ReadD3()
 {
   u16 val = 0;
@@ -160,6 +214,85 @@ u16 Accelerator::Read(const s16* coefs)
   return val;
 }
 
+void Accelerator::ReadSamples(const s16* coefs, std::span<s16> out)
+{
+  size_t i = 0;
+  while (i < out.size())
+  {
+    if (m_reads_stopped)
+    {
+      std::fill(out.begin() + i, out.end(), 0);
+      return;
+    }
+
+    const u32 count = static_cast<u32>(std::min<size_t>(GetPlainReadCount(), out.size() - i));
+    if (count != 0)
+    {
+      ReadPlainSamples(coefs, &out[i], count);
+      i += count;
+    }
+    else
+    {
+      // Let Read deal with the end address and the frame headers.
+      out[i++] = static_cast<s16>(Read(coefs));
+    }
+  }
+}
+
+// Returns how many reads from the current address on neither reach the end address nor, for
+// ADPCM, the header of the next frame. None of them changes anything but the current address and
+// the history, so ReadPlainSamples can decode them in one go.
+u32 Accelerator::GetPlainReadCount() const
+{
+  if (m_current_address >= m_end_address)
+    return 0;
+
+  const u32 count = m_end_address - m_current_address;
+  switch (m_sample_format)
+  {
+  case 0x00:
+    // The read of the last nibble of a frame moves on to the next header.
+    return std::min<u32>(count, 15 - (m_current_address & 15));
+  case 0x0A:
+  case 0x19:
+    return count;
+  default:
+    return 0;
+  }
+}
+
+void Accelerator::ReadPlainSamples(const s16* coefs, s16* out, u32 count)
+{
+  u32 first_byte = m_current_address;
+  u32 size = count;
+  if (m_sample_format == 0x00)
+  {
+    first_byte = m_current_address >> 1;
+    size = ((m_current_address + count - 1) >> 1) - first_byte + 1;
+  }
+  else if (m_sample_format == 0x0A)
+  {
+    first_byte = m_current_address * 2;
+    size = count * 2;
+  }
+
+  if (const u8* memory = GetMemoryRange(first_byte, size))
+  {
+    const auto read_byte = [memory, first_byte](u32 address) {
+      return memory[address - first_byte];
+    };
+    DecodeSamples(m_sample_format, coefs, m_pred_scale, m_current_address, &m_yn1, &m_yn2, out,
+                  count, read_byte);
+  }
+  else
+  {
+    DecodeSamples(m_sample_format, coefs, m_pred_scale, m_current_address, &m_yn1, &m_yn2, out,
+                  count, [this](u32 address) { return ReadMemory(address); });
+  }
+
+  m_current_address += count;
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
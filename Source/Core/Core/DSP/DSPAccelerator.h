@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -15,6 +17,9 @@ public:
   virtual ~Accelerator() = default;
 
   u16 Read(const s16* coefs);
+  // Same as calling Read once for every sample in out, but decodes the samples between two
+  // wraparounds, loop points or ADPCM frame headers in bulk.
+  void ReadSamples(const s16* coefs, std::span<s16> out);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadD3();
   void WriteD3(u16 value);
@@ -40,6 +45,9 @@ protected:
   virtual void OnEndException() = 0;
   virtual u8 ReadMemory(u32 address) = 0;
   virtual void WriteMemory(u32 address, u8 value) = 0;
+  // Returns a pointer to the size bytes which ReadMemory would return from address onwards, or
+  // nullptr if they aren't contiguous in host memory.
+  virtual const u8* GetMemoryRange(u32 address, u32 size) { return nullptr; }
 
   // DSP accelerator registers.
   u32 m_start_address = 0;
@@ -54,5 +62,9 @@ protected:
   // and updating the current address register, unless the YN2 register is written to.
   // This is kept track of internally; this state is not exposed via any register.
   bool m_reads_stopped = false;
+
+private:
+  u32 GetPlainReadCount() const;
+  void ReadPlainSamples(const s16* coefs, s16* out, u32 count);
 };
 }  // namespace DSP
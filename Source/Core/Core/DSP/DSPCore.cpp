@@ -417,6 +417,8 @@ bool DSPCore::Initialize(const DSPInitOptions& opts)
     return false;
 
   m_init_hax = false;
+  // The IROM may have changed.
+  m_dsp_interpreter->ClearDecodedInstructions();
 
   // Initialize JIT, if necessary
   if (opts.core_type == DSPInitOptions::CoreType::JIT64)
@@ -493,6 +495,8 @@ void DSPCore::Reset()
 
 void DSPCore::ClearIRAM()
 {
+  m_dsp_interpreter->ClearDecodedInstructions();
+
   if (!m_dsp_jit)
     return;
 
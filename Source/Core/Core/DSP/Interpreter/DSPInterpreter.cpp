@@ -65,6 +65,36 @@ void Interpreter::ExecuteInstruction(const UDSPInstruction inst)
   }
 }
 
+const Interpreter::DecodedInstruction* Interpreter::GetDecodedInstruction(u16 address)
+{
+  std::size_t index;
+  switch (address >> 12)
+  {
+  case 0:
+    index = address & DSP_IRAM_MASK;
+    break;
+  case 8:
+    index = DSP_IRAM_SIZE + (address & DSP_IROM_MASK);
+    break;
+  default:
+    return nullptr;
+  }
+
+  DecodedInstruction& decoded = m_decoded_instructions[index];
+  if (decoded.op == nullptr)
+  {
+    decoded.inst = m_dsp_core.DSPState().ReadIMEM(address);
+    decoded.op = GetOp(decoded.inst);
+    decoded.ext_op = GetOpTemplate(decoded.inst)->extended ? GetExtOp(decoded.inst) : nullptr;
+  }
+  return &decoded;
+}
+
+void Interpreter::ClearDecodedInstructions()
+{
+  m_decoded_instructions.fill({});
+}
+
 void Interpreter::Step()
 {
   auto& state = m_dsp_core.DSPState();
@@ -72,8 +102,25 @@ void Interpreter::Step()
   m_dsp_core.CheckExceptions();
   state.AdvanceStepCounter();
 
-  const u16 opc = state.FetchInstruction();
-  ExecuteInstruction(UDSPInstruction{opc});
+  if (const DecodedInstruction* decoded = GetDecodedInstruction(state.pc))
+  {
+    state.pc++;
+    if (decoded->ext_op)
+    {
+      (this->*decoded->ext_op)(decoded->inst);
+      (this->*decoded->op)(decoded->inst);
+      ApplyWriteBackLog();
+    }
+    else
+    {
+      (this->*decoded->op)(decoded->inst);
+    }
+  }
+  else
+  {
+    const u16 opc = state.FetchInstruction();
+    ExecuteInstruction(UDSPInstruction{opc});
+  }
 
   const auto pc = state.pc;
   if (state.GetAnalyzer().IsLoopEnd(static_cast<u16>(pc - 1)))
@@ -8,6 +8,7 @@
 
 #include "Core/DSP/DSPCommon.h"
 #include "Core/DSP/DSPCore.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
 
 namespace DSP::Interpreter
 {
@@ -40,6 +41,9 @@ public:
 
   void ApplyWriteBackLog();
 
+  // Must be called whenever IRAM or IROM changes.
+  void ClearDecodedInstructions();
+
   // All the opcode functions.
   void abs(UDSPInstruction opc);
   void add(UDSPInstruction opc);
@@ -190,7 +194,20 @@ public:
   void nop_ext(UDSPInstruction opc);
 
 private:
+  // An instruction of IRAM or IROM with its handlers already looked up, so that running it again
+  // doesn't have to go through the opcode tables.
+  struct DecodedInstruction
+  {
+    // nullptr until the instruction has been decoded.
+    InterpreterFunction op = nullptr;
+    // nullptr for instructions without an extended opcode.
+    InterpreterFunction ext_op = nullptr;
+    UDSPInstruction inst = 0;
+  };
+
   void ExecuteInstruction(UDSPInstruction inst);
+  // Returns nullptr for addresses outside of IRAM and IROM.
+  const DecodedInstruction* GetDecodedInstruction(u16 address);
 
   bool CheckCondition(u8 condition) const;
 
@@ -240,6 +257,9 @@ private:
 
   DSPCore& m_dsp_core;
 
+  // IRAM followed by IROM.
+  std::array<DecodedInstruction, DSP_IRAM_SIZE + DSP_IROM_SIZE> m_decoded_instructions{};
+
   static constexpr size_t WRITEBACK_LOG_SIZE = 5;
   std::array<u16, WRITEBACK_LOG_SIZE> m_write_back_log{};
   std::array<int, WRITEBACK_LOG_SIZE> m_write_back_log_idx{-1, -1, -1, -1, -1};
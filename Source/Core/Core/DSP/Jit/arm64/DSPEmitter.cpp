@@ -0,0 +1,320 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/Assert.h"
+#include "Common/BitSet.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
+
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::Arm64
+{
+constexpr size_t COMPILED_CODE_SIZE = 4194304;
+constexpr size_t MAX_BLOCK_SIZE = 250;
+constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+// Generous upper bound for the code emitted for a single block, so that Compile() never runs out
+// of space in the middle of a block.
+constexpr size_t MAX_BLOCK_CODE_SIZE = MAX_BLOCK_SIZE * 128;
+
+// Callee-saved registers, valid for the whole block.
+constexpr ARM64Reg INTERPRETER_REG = ARM64Reg::X19;
+constexpr ARM64Reg STATE_REG = ARM64Reg::X20;
+const BitSet32 SAVED_REGISTERS{DecodeReg(INTERPRETER_REG), DecodeReg(STATE_REG), 30};
+
+DSPEmitter::DSPEmitter(DSPCore& dsp)
+    : m_blocks(MAX_BLOCKS), m_block_size(MAX_BLOCKS), m_dsp_core{dsp}
+{
+  AllocCodeSpace(COMPILED_CODE_SIZE);
+}
+
+DSPEmitter::~DSPEmitter()
+{
+  FreeCodeSpace();
+}
+
+u16 DSPEmitter::RunCycles(u16 cycles)
+{
+  auto& state = m_dsp_core.DSPState();
+
+  if (state.external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+  {
+    m_dsp_core.CheckExternalInterrupt();
+    m_dsp_core.CheckExceptions();
+  }
+
+  m_cycles_left = cycles;
+  while (true)
+  {
+    if (Host::OnThread() && state.external_interrupt_waiting.load(std::memory_order_relaxed))
+      break;
+
+    // Check for DSP halt
+    if ((state.control_reg & CR_HALT) != 0)
+      break;
+
+    DSPCompiledCode block = m_blocks[state.pc];
+    if (!block)
+    {
+      Compile(state.pc);
+      block = m_blocks[state.pc];
+    }
+
+    // Same as the x64 dispatcher: keep going while there are cycles left after this block, and
+    // let the counter wrap around otherwise.
+    const u16 executed = static_cast<u16>(block());
+    const bool cycles_remain = m_cycles_left > executed;
+    m_cycles_left -= executed;
+    if (!cycles_remain)
+      break;
+  }
+
+  if (state.reset_dspjit_codespace)
+    ClearIRAMandDSPJITCodespaceReset();
+
+  return m_cycles_left;
+}
+
+void DSPEmitter::DoState(PointerWrap& p)
+{
+  p.Do(m_cycles_left);
+}
+
+void DSPEmitter::ClearIRAM()
+{
+  for (size_t i = 0; i < DSP_IRAM_SIZE; i++)
+  {
+    m_blocks[i] = nullptr;
+    m_block_size[i] = 0;
+  }
+  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+}
+
+void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
+{
+  ClearCodeSpace();
+
+  std::fill(m_blocks.begin(), m_blocks.end(), nullptr);
+  std::fill(m_block_size.begin(), m_block_size.end(), 0);
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+static void CheckExceptionsThunk(DSPCore& dsp)
+{
+  dsp.CheckExceptions();
+}
+
+static void FallbackThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetOp(inst))(inst);
+}
+
+static void FallbackExtThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetExtOp(inst))(inst);
+}
+
+static void ApplyWriteBackLogThunk(Interpreter::Interpreter& interpreter)
+{
+  interpreter.ApplyWriteBackLog();
+}
+
+// Same as Interpreter::HandleLoop, for when the loop address and counter are both non-zero.
+static void HandleLoopThunk(SDSP& state, u16 loop_end)
+{
+  if (state.r.st[2] != loop_end)
+    return;
+
+  u16& loop_counter = state.r.st[3];
+  loop_counter--;
+  if (loop_counter > 0)
+  {
+    state.pc = state.r.st[0];
+  }
+  else
+  {
+    // end of loop
+    state.PopStack(StackRegister::Call);
+    state.PopStack(StackRegister::LoopAddress);
+    state.PopStack(StackRegister::LoopCounter);
+  }
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+void DSPEmitter::EmitStorePC(u16 pc)
+{
+  MOVI2R(ARM64Reg::W0, pc);
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, offsetof(SDSP, pc));
+}
+
+// Must go out of block if exception is detected
+void DSPEmitter::EmitCheckExceptions(u16 cycles)
+{
+  LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, offsetof(SDSP, exceptions));
+  FixupBranch skip_check = CBZ(ARM64Reg::W0);
+
+  EmitStorePC(m_compile_pc);
+  ABI_CallFunction(&CheckExceptionsThunk, &m_dsp_core);
+  EmitBlockExit(cycles);
+
+  SetJumpTarget(skip_check);
+}
+
+void DSPEmitter::EmitLoopEnd(u16 cycles, bool is_branch)
+{
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, offsetof(SDSP, r.st) + 2 * sizeof(u16));
+  FixupBranch loop_address_exit = CBZ(ARM64Reg::W0);
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, offsetof(SDSP, r.st) + 3 * sizeof(u16));
+  FixupBranch loop_counter_exit = CBZ(ARM64Reg::W0);
+
+  // branch insns update the pc
+  if (!is_branch)
+    EmitStorePC(m_compile_pc);
+
+  ABI_CallFunction(&HandleLoopThunk, STATE_REG, static_cast<u16>(m_compile_pc - 1));
+  EmitBlockExit(cycles);
+
+  SetJumpTarget(loop_address_exit);
+  SetJumpTarget(loop_counter_exit);
+}
+
+void DSPEmitter::EmitBranchTaken(u16 cycles)
+{
+  // Look at the pc to see if we actually branched
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, offsetof(SDSP, pc));
+  CMPI2R(ARM64Reg::W0, m_compile_pc, ARM64Reg::W1);
+  FixupBranch no_branch = B(CC_EQ);
+  EmitBlockExit(cycles);
+  SetJumpTarget(no_branch);
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+void DSPEmitter::EmitBlockExit(u16 cycles)
+{
+  MOVI2R(ARM64Reg::W0, cycles);
+  ABI_PopRegisters(SAVED_REGISTERS);
+  RET();
+}
+
+void DSPEmitter::EmitInstruction(UDSPInstruction inst)
+{
+  const DSPOPCTemplate* const op_template = GetOpTemplate(inst);
+
+  if (op_template->extended)
+    ABI_CallFunction(&FallbackExtThunk, INTERPRETER_REG, inst);
+
+  // The interpreter expects the pc to point past the opcode, both for fetching immediates and for
+  // branching relative to it.
+  if (op_template->reads_pc || op_template->branch)
+    EmitStorePC(m_compile_pc + 1);
+
+  ASSERT_MSG(DSPLLE, Interpreter::GetOp(inst) != nullptr, "No function for {:04x}", inst);
+  ABI_CallFunction(&FallbackThunk, INTERPRETER_REG, inst);
+
+  if (op_template->extended)
+    ABI_CallFunction(&ApplyWriteBackLogThunk, INTERPRETER_REG);
+}
+
+u16 DSPEmitter::GetBlockCycles(u16 start_addr) const
+{
+  if (!Host::OnThread() && m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(start_addr))
+    return DSP_IDLE_SKIP_CYCLES;
+  return m_block_size[start_addr];
+}
+
+void DSPEmitter::Compile(u16 start_addr)
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+
+  if (GetSpaceLeft() < MAX_BLOCK_CODE_SIZE)
+  {
+    WARN_LOG_FMT(DSPLLE, "DSP JIT code space full, clearing it");
+    ClearIRAMandDSPJITCodespaceReset();
+  }
+
+  AlignCode16();
+  const u8* entry_point = GetCodePtr();
+
+  ABI_PushRegisters(SAVED_REGISTERS);
+  MOVP2R(INTERPRETER_REG, &m_dsp_core.GetInterpreter());
+  MOVP2R(STATE_REG, &m_dsp_core.DSPState());
+
+  m_compile_pc = start_addr;
+  bool fixup_pc = false;
+  m_block_size[start_addr] = 0;
+
+  const auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
+  while (m_compile_pc < start_addr + MAX_BLOCK_SIZE)
+  {
+    if (analyzer.IsCheckExceptions(m_compile_pc))
+      EmitCheckExceptions(m_block_size[start_addr]);
+
+    const UDSPInstruction inst = m_dsp_core.DSPState().ReadIMEM(m_compile_pc);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+
+    EmitInstruction(inst);
+
+    m_block_size[start_addr]++;
+    m_compile_pc += opcode->size;
+
+    fixup_pc = true;
+
+    // Handle loop condition, only if current instruction was flagged as a loop destination
+    // by the analyzer.
+    if (analyzer.IsLoopEnd(static_cast<u16>(m_compile_pc - 1u)))
+      EmitLoopEnd(GetBlockCycles(start_addr), opcode->branch);
+
+    if (opcode->branch)
+    {
+      // don't update the pc -- the branch insn already did
+      fixup_pc = false;
+      if (opcode->uncond_branch)
+        break;
+
+      EmitBranchTaken(GetBlockCycles(start_addr));
+    }
+
+    // End the block if we're before an idle skip address
+    if (analyzer.IsIdleSkip(m_compile_pc))
+      break;
+  }
+
+  if (fixup_pc)
+    EmitStorePC(m_compile_pc);
+
+  if (m_block_size[start_addr] == 0)
+  {
+    // just a safeguard, should never happen.
+    // if it does we might get stuck over in RunCycles.
+    ERROR_LOG_FMT(DSPLLE, "Block at {:#06x} has zero size", start_addr);
+    m_block_size[start_addr] = 1;
+  }
+
+  EmitBlockExit(GetBlockCycles(start_addr));
+
+  FlushIcache();
+  m_blocks[start_addr] = reinterpret_cast<DSPCompiledCode>(entry_point);
+}
+}  // namespace DSP::JIT::Arm64
@@ -0,0 +1,59 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP::JIT::Arm64
+{
+// A threaded-code recompiler: every block is a straight sequence of calls into the interpreter's
+// opcode handlers, with the loop, branch and exception checks compiled in. Compared to the
+// interpreter, this removes instruction fetching, decoding and the per-instruction analyzer
+// lookups from the hot path.
+class DSPEmitter final : public JIT::DSPEmitter, public Arm64Gen::ARM64CodeBlock
+{
+public:
+  explicit DSPEmitter(DSPCore& dsp);
+  ~DSPEmitter() override;
+
+  u16 RunCycles(u16 cycles) override;
+  void DoState(PointerWrap& p) override;
+  void ClearIRAM() override;
+
+private:
+  // Returns the number of cycles executed.
+  using DSPCompiledCode = u32 (*)();
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+
+  void ClearIRAMandDSPJITCodespaceReset();
+
+  void Compile(u16 start_addr);
+  void EmitInstruction(UDSPInstruction inst);
+  void EmitCheckExceptions(u16 cycles);
+  void EmitLoopEnd(u16 cycles, bool is_branch);
+  void EmitBranchTaken(u16 cycles);
+  void EmitStorePC(u16 pc);
+  void EmitBlockExit(u16 cycles);
+
+  u16 GetBlockCycles(u16 start_addr) const;
+
+  std::vector<DSPCompiledCode> m_blocks;
+  std::vector<u16> m_block_size;
+
+  u16 m_compile_pc = 0;
+  u16 m_cycles_left = 0;
+
+  DSPCore& m_dsp_core;
+};
+}  // namespace DSP::JIT::Arm64
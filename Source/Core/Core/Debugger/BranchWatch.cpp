@@ -25,10 +25,28 @@ void BranchWatch::Clear(const CPUThreadGuard&)
   m_collection_vf.clear();
   m_collection_pt.clear();
   m_collection_pf.clear();
+  m_hit_cache_vt.fill({});
+  m_hit_cache_vf.fill({});
+  m_hit_cache_pt.fill({});
+  m_hit_cache_pf.fill({});
   m_recording_phase = Phase::Blacklist;
   m_blacklist_size = 0;
 }
 
+std::pair<std::size_t, std::size_t>
+BranchWatch::GetConditionalBranchHits(u32 origin, u32 destination, UGeckoInstruction inst) const
+{
+  const auto get_hits = [](const Collection& collection, const BranchWatchCollectionKey& key) {
+    const auto it = collection.find(key);
+    return it != collection.end() ? it->second.total_hits : 0;
+  };
+
+  const BranchWatchCollectionKey taken_key{{origin, destination}, inst};
+  const BranchWatchCollectionKey not_taken_key{{origin, origin + 4}, inst};
+  return {get_hits(m_collection_vt, taken_key) + get_hits(m_collection_pt, taken_key),
+          get_hits(m_collection_vf, not_taken_key) + get_hits(m_collection_pf, not_taken_key)};
+}
+
 // This is a bitfield aggregate of metadata required to reconstruct a BranchWatch's Collections and
 // Selection from a text file (a snapshot). For maximum forward compatibility, should that ever be
 // required, the StorageType is an unsigned long long instead of something more reasonable like an
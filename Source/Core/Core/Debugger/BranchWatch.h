@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <bit>
 #include <cstddef>
 #include <cstdio>
 #include <functional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -144,6 +146,11 @@ public:
   std::size_t GetBlacklistSize() const { return m_blacklist_size; }
   Phase GetRecordingPhase() const { return m_recording_phase; };
 
+  // Returns how often the branch at origin was recorded jumping to destination and how often it
+  // was recorded falling through, summed over both address spaces. For the CPUThread only.
+  std::pair<std::size_t, std::size_t> GetConditionalBranchHits(u32 origin, u32 destination,
+                                                               UGeckoInstruction inst) const;
+
   // An empty selection in reduction mode can't be reconstructed when loading from a file.
   bool CanSave() const { return !(m_recording_phase == Phase::Reduction && m_selection.empty()); }
 
@@ -154,38 +161,32 @@ public:
   // but also increment the total_hits by N (see dcbx JIT code).
   static void HitVirtualTrue_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_vt[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    Hit(branch_watch->m_collection_vt, branch_watch->m_hit_cache_vt, fake_key, inst, 1);
   }
 
   static void HitPhysicalTrue_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_pt[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    Hit(branch_watch->m_collection_pt, branch_watch->m_hit_cache_pt, fake_key, inst, 1);
   }
 
   static void HitVirtualFalse_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_vf[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    Hit(branch_watch->m_collection_vf, branch_watch->m_hit_cache_vf, fake_key, inst, 1);
   }
 
   static void HitPhysicalFalse_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_pf[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    Hit(branch_watch->m_collection_pf, branch_watch->m_hit_cache_pf, fake_key, inst, 1);
   }
 
   static void HitVirtualTrue_fk_n(BranchWatch* branch_watch, u64 fake_key, u32 inst, u32 n)
   {
-    branch_watch->m_collection_vt[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += n;
+    Hit(branch_watch->m_collection_vt, branch_watch->m_hit_cache_vt, fake_key, inst, n);
   }
 
   static void HitPhysicalTrue_fk_n(BranchWatch* branch_watch, u64 fake_key, u32 inst, u32 n)
   {
-    branch_watch->m_collection_pt[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += n;
+    Hit(branch_watch->m_collection_pt, branch_watch->m_hit_cache_pt, fake_key, inst, n);
   }
 
   // HitVirtualFalse_fk_n and HitPhysicalFalse_fk_n are never used, so they are omitted here.
@@ -240,6 +241,33 @@ public:
   }
 
 private:
+  // A direct-mapped cache in front of each Collection, so that repeated hits of the same branch
+  // skip the hash table lookup. Pointers to the elements of an std::unordered_map survive rehashing
+  // and elements are only ever removed by Clear(), which also clears the caches.
+  struct HitCacheEntry
+  {
+    u64 fake_key = 0;
+    u32 inst = 0;
+    BranchWatchCollectionValue* value = nullptr;
+  };
+  static constexpr u32 HIT_CACHE_BITS = 9;
+  using HitCache = std::array<HitCacheEntry, 1u << HIT_CACHE_BITS>;
+
+  static void Hit(Collection& collection, HitCache& cache, u64 fake_key, u32 inst, u32 n)
+  {
+    // Fibonacci hashing of the two addresses, whose lowest two bits are always zero.
+    const u32 hash = (static_cast<u32>(fake_key >> 2) ^ static_cast<u32>(fake_key >> 34)) *
+                     0x9E3779B1u;
+    HitCacheEntry& entry = cache[hash >> (32 - HIT_CACHE_BITS)];
+    if (entry.value == nullptr || entry.fake_key != fake_key || entry.inst != inst)
+    {
+      entry.fake_key = fake_key;
+      entry.inst = inst;
+      entry.value = &collection[{std::bit_cast<FakeBranchWatchCollectionKey>(fake_key), inst}];
+    }
+    entry.value->total_hits += n;
+  }
+
   Collection& GetCollectionV(bool condition)
   {
     if (condition)
@@ -269,6 +297,10 @@ private:
   Collection m_collection_pt;  // physical address space | true path
   Collection m_collection_pf;  // physical address space | false path
   Selection m_selection;
+  HitCache m_hit_cache_vt{};
+  HitCache m_hit_cache_vf{};
+  HitCache m_hit_cache_pt{};
+  HitCache m_hit_cache_pf{};
 };
 
 #if _M_X86_64
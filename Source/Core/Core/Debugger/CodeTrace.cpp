@@ -11,6 +11,7 @@
 #include "Core/Core.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/HW/CPU.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -63,21 +64,14 @@ bool CompareMemoryTargetToTracked(const std::string& instr, const u32 mem_target
   // If the base value doesn't hit, still need to check if longer values overlap.
   return *it_lower < mem_target + GetMemoryTargetSize(instr);
 }
-}  // namespace
 
-void CodeTrace::SetRegTracked(const std::string& reg)
+// Slower process of breaking down saved instruction. Only used when stepping through code if a
+// decision has to be made, otherwise used afterwards on a log file.
+InstructionAttributes ParseInstruction(const std::string& instruction)
 {
-  m_reg_autotrack.push_back(reg);
-}
-
-InstructionAttributes CodeTrace::GetInstructionAttributes(const TraceOutput& instruction) const
-{
-  // Slower process of breaking down saved instruction. Only used when stepping through code if a
-  // decision has to be made, otherwise used afterwards on a log file.
   InstructionAttributes tmp_attributes;
-  tmp_attributes.instruction = instruction.instruction;
-  tmp_attributes.address = instruction.address;
-  std::string instr = instruction.instruction;
+  tmp_attributes.instruction = instruction;
+  std::string instr = instruction;
   std::smatch match;
 
   // Convert sp, rtoc, and ps to r1, r2, and F#. ps is handled like a float operation.
@@ -105,22 +99,46 @@ InstructionAttributes CodeTrace::GetInstructionAttributes(const TraceOutput& ins
     if (match[4].matched)
       tmp_attributes.reg3 = match.str(4);
 
-    if (instruction.memory_target)
-    {
-      tmp_attributes.memory_target = instruction.memory_target;
-      tmp_attributes.memory_target_size = GetMemoryTargetSize(instr);
+    // Whether this is actually a memory access is only known once the memory target is known.
+    tmp_attributes.memory_target_size = GetMemoryTargetSize(instr);
+    if (instr.starts_with("st") || instr.starts_with("psq_s"))
+      tmp_attributes.is_store = true;
+    else
+      tmp_attributes.is_load = true;
+  }
 
-      if (instr.starts_with("st") || instr.starts_with("psq_s"))
-        tmp_attributes.is_store = true;
-      else
-        tmp_attributes.is_load = true;
-    }
+  return tmp_attributes;
+}
+}  // namespace
+
+void CodeTrace::SetRegTracked(const std::string& reg)
+{
+  m_reg_autotrack.push_back(reg);
+}
+
+InstructionAttributes CodeTrace::GetInstructionAttributes(const TraceOutput& instruction)
+{
+  auto [iter, inserted] = m_attributes_cache.try_emplace(instruction.instruction);
+  if (inserted)
+    iter->second = ParseInstruction(instruction.instruction);
+
+  InstructionAttributes tmp_attributes = iter->second;
+  tmp_attributes.address = instruction.address;
+  if (instruction.memory_target && !tmp_attributes.reg0.empty())
+  {
+    tmp_attributes.memory_target = instruction.memory_target;
+  }
+  else
+  {
+    tmp_attributes.memory_target_size = 4;
+    tmp_attributes.is_store = false;
+    tmp_attributes.is_load = false;
   }
 
   return tmp_attributes;
 }
 
-TraceOutput CodeTrace::SaveCurrentInstruction(const Core::CPUThreadGuard& guard) const
+TraceOutput CodeTrace::SaveCurrentInstruction(const Core::CPUThreadGuard& guard)
 {
   auto& system = guard.GetSystem();
   auto& power_pc = system.GetPowerPC();
@@ -129,12 +147,24 @@ TraceOutput CodeTrace::SaveCurrentInstruction(const Core::CPUThreadGuard& guard)
 
   // Quickly save instruction and memory target for fast logging.
   TraceOutput output;
-  const std::string instr = debug_interface.Disassemble(&guard, ppc_state.pc);
-  output.instruction = instr;
   output.address = ppc_state.pc;
 
+  const auto op = PowerPC::MMU::HostTryReadInstruction(guard, ppc_state.pc);
+  if (op)
+  {
+    const u64 key = (u64{ppc_state.pc} << 32) | op->value;
+    auto [iter, inserted] = m_disassembly_cache.try_emplace(key);
+    if (inserted)
+      iter->second = debug_interface.Disassemble(&guard, ppc_state.pc);
+    output.instruction = iter->second;
+  }
+  else
+  {
+    output.instruction = debug_interface.Disassemble(&guard, ppc_state.pc);
+  }
+
   if (IsInstructionLoadStore(output.instruction))
-    output.memory_target = debug_interface.GetMemoryAddressFromInstruction(instr);
+    output.memory_target = debug_interface.GetMemoryAddressFromInstruction(output.instruction);
 
   return output;
 }
@@ -147,6 +177,9 @@ AutoStepResults CodeTrace::AutoStepping(const Core::CPUThreadGuard& guard, bool
   if (m_recording)
     return results;
 
+  m_disassembly_cache.clear();
+  m_attributes_cache.clear();
+
   TraceOutput pc_instr = SaveCurrentInstruction(guard);
   const InstructionAttributes instr = GetInstructionAttributes(pc_instr);
 
@@ -6,6 +6,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -72,11 +73,17 @@ public:
                                AutoStop stop_on = AutoStop::Always);
 
 private:
-  InstructionAttributes GetInstructionAttributes(const TraceOutput& line) const;
-  TraceOutput SaveCurrentInstruction(const Core::CPUThreadGuard& guard) const;
+  InstructionAttributes GetInstructionAttributes(const TraceOutput& line);
+  TraceOutput SaveCurrentInstruction(const Core::CPUThreadGuard& guard);
   HitType TraceLogic(const TraceOutput& current_instr, bool first_hit = false);
 
   bool m_recording = false;
   std::vector<std::string> m_reg_autotrack;
   std::set<u32> m_mem_autotrack;
+
+  // Autostepping mostly runs the same loops over and over, so the disassembly of each instruction
+  // (keyed by address and opcode) and the registers parsed out of it are only computed once.
+  // Cleared whenever autostepping starts.
+  std::unordered_map<u64, std::string> m_disassembly_cache;
+  std::unordered_map<std::string, InstructionAttributes> m_attributes_cache;
 };
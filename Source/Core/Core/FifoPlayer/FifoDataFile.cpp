@@ -9,18 +9,23 @@
 #include <string>
 #include <vector>
 
+#include <zstd.h>
+
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
-constexpr u32 MIN_LOADER_VERSION = 1;
-// This value is only used if the DFF file was created with overridden RAM sizes.
-// If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
-constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 VERSION_NUMBER = 6;
+// Version 6 stores frames as compressed chunks, which older loaders can't read.
+constexpr u32 MIN_LOADER_VERSION = 6;
+
+constexpr int FRAME_COMPRESSION_LEVEL = 5;
+// Enough for sequential playback, and for the FIFO analyzer to look at another frame meanwhile.
+constexpr size_t FRAME_CACHE_SIZE = 4;
 
 #pragma pack(push, 1)
 
@@ -50,7 +55,7 @@ struct FileHeader
 };
 static_assert(sizeof(FileHeader) == 128, "FileHeader should be 128 bytes");
 
-struct FileFrameInfo
+struct FifoDataFile::FileFrameInfo
 {
   u64 fifoDataOffset;
   u32 fifoDataSize;
@@ -58,9 +63,15 @@ struct FileFrameInfo
   u32 fifoEnd;
   u64 memoryUpdatesOffset;
   u32 numMemoryUpdates;
-  u8 reserved[32];
+  // Added in version 6. The frame's FIFO data, memory update list and memory update data are
+  // stored together as one zstd-compressed chunk, and the offsets above are relative to the start
+  // of the decompressed chunk.
+  u64 chunkOffset;
+  u32 chunkSize;
+  u32 chunkUncompressedSize;
+  u8 reserved[16];
 };
-static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
+static_assert(sizeof(FifoDataFile::FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
 
 struct FileMemoryUpdate
 {
@@ -101,7 +112,69 @@ bool FifoDataFile::GetIsWii() const
 
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  m_Frames.push_back(std::make_shared<const FifoFrameInfo>(frameInfo));
+  m_frame_count++;
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  if (m_frame_index.empty())
+    return m_Frames[frame];
+
+  std::lock_guard lk(m_file_mutex);
+
+  const auto it = std::ranges::find(m_frame_cache, frame,
+                                    [](const auto& cached_frame) { return cached_frame.first; });
+  if (it != m_frame_cache.end())
+  {
+    auto cached_frame = std::move(*it);
+    m_frame_cache.erase(it);
+    return m_frame_cache.emplace_front(std::move(cached_frame)).second;
+  }
+
+  if (m_frame_cache.size() == FRAME_CACHE_SIZE)
+    m_frame_cache.pop_back();
+  return m_frame_cache.emplace_front(frame, ReadFrame(frame)).second;
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::ReadFrame(u32 frame) const
+{
+  const FileFrameInfo& srcFrame = m_frame_index[frame];
+  auto dstFrame = std::make_shared<FifoFrameInfo>();
+
+  bool success;
+  if (m_Version >= 6)
+  {
+    std::vector<u8> chunk(srcFrame.chunkSize);
+    m_file->Seek(srcFrame.chunkOffset, File::SeekOrigin::Begin);
+    success = m_file->ReadBytes(chunk.data(), chunk.size()) &&
+              DecompressFrame(srcFrame, chunk, dstFrame.get());
+  }
+  else
+  {
+    dstFrame->fifoData.resize(srcFrame.fifoDataSize);
+    dstFrame->fifoStart = srcFrame.fifoStart;
+    dstFrame->fifoEnd = srcFrame.fifoEnd;
+
+    m_file->Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
+    m_file->ReadBytes(dstFrame->fifoData.data(), srcFrame.fifoDataSize);
+
+    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
+                      dstFrame->memoryUpdates, *m_file);
+    success = m_file->IsGood();
+  }
+
+  if (!success)
+  {
+    // Play an empty frame instead, so that one bad frame doesn't stop playback.
+    ERROR_LOG_FMT(VIDEO, "Failed to read frame {} of the DFF file", frame);
+    m_file->ClearError();
+    *dstFrame = FifoFrameInfo{};
+    dstFrame->fifoStart = srcFrame.fifoStart;
+    dstFrame->fifoEnd = srcFrame.fifoEnd;
+  }
+
+  return dstFrame;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
@@ -115,7 +188,7 @@ bool FifoDataFile::Save(const std::string& filename)
 
   // Add space for frame list
   u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  PadFile(m_frame_count * sizeof(FileFrameInfo), file);
 
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
@@ -136,11 +209,7 @@ bool FifoDataFile::Save(const std::string& filename)
   FileHeader header;
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
-    header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
-  else
-    header.min_loader_version = MIN_LOADER_VERSION;
+  header.min_loader_version = MIN_LOADER_VERSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -158,7 +227,7 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = m_frame_count;
 
   header.flags = m_Flags;
 
@@ -171,24 +240,19 @@ bool FifoDataFile::Save(const std::string& filename)
   file.WriteBytes(&header, sizeof(FileHeader));
 
   // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
+  for (u32 i = 0; i < m_frame_count; ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
+    const std::shared_ptr<const FifoFrameInfo> srcFrame = GetFrame(i);
 
-    // Write FIFO data
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
+    FileFrameInfo dstFrame{};
+    const std::vector<u8> chunk = CompressFrame(*srcFrame, &dstFrame);
+    if (chunk.empty())
+      return false;
 
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
+    // Write frame data
+    file.Seek(0, File::SeekOrigin::End);
+    dstFrame.chunkOffset = file.Tell();
+    file.WriteBytes(chunk.data(), chunk.size());
 
     // Write frame info
     u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
@@ -316,32 +380,35 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
-  {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    FileFrameInfo srcFrame;
-    if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
-      return panic_failed_to_read();
-
-    FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-
-    file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
+  // Read the frame index. The frames themselves are read when they're needed.
+  if (header.frameCount == 0)
+    return dataFile;
 
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+  dataFile->m_frame_index.resize(header.frameCount);
+  file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+  if (!file.ReadArray(dataFile->m_frame_index.data(), header.frameCount))
+    return panic_failed_to_read();
 
-    if (!file.IsGood())
+  // Before version 6, the reserved part of the frame info wasn't initialized.
+  const u64 file_size = file.GetSize();
+  for (FileFrameInfo& frame : dataFile->m_frame_index)
+  {
+    if (dataFile->m_Version < 6)
+    {
+      frame.chunkOffset = 0;
+      frame.chunkSize = 0;
+      frame.chunkUncompressedSize = 0;
+      if (frame.fifoDataOffset > file_size || frame.fifoDataSize > file_size - frame.fifoDataOffset)
+        return panic_failed_to_read();
+    }
+    else if (frame.chunkOffset > file_size || frame.chunkSize > file_size - frame.chunkOffset)
+    {
       return panic_failed_to_read();
-
-    dataFile->AddFrame(dstFrame);
+    }
   }
 
+  dataFile->m_frame_count = header.frameCount;
+  dataFile->m_file = std::make_unique<File::IOFile>(std::move(file));
   return dataFile;
 }
 
@@ -364,56 +431,108 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
-u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
+void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
 {
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
+  memUpdates.resize(numUpdates);
 
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
+  for (u32 i = 0; i < numUpdates; ++i)
   {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
+    u64 updateOffset = fileOffset + (i * sizeof(FileMemoryUpdate));
+    file.Seek(updateOffset, File::SeekOrigin::Begin);
+    FileMemoryUpdate srcUpdate;
+    file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate));
 
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+    MemoryUpdate& dstUpdate = memUpdates[i];
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.data.resize(srcUpdate.dataSize);
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
 
-    FileMemoryUpdate dstUpdate;
+    file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
+    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+  }
+}
+
+std::vector<u8> FifoDataFile::CompressFrame(const FifoFrameInfo& frame, FileFrameInfo* frame_info)
+{
+  std::vector<u8> data = frame.fifoData;
+  frame_info->fifoDataOffset = 0;
+  frame_info->fifoDataSize = static_cast<u32>(frame.fifoData.size());
+  frame_info->fifoStart = frame.fifoStart;
+  frame_info->fifoEnd = frame.fifoEnd;
+
+  frame_info->memoryUpdatesOffset = data.size();
+  frame_info->numMemoryUpdates = static_cast<u32>(frame.memoryUpdates.size());
+  data.resize(data.size() + frame.memoryUpdates.size() * sizeof(FileMemoryUpdate));
+
+  for (size_t i = 0; i < frame.memoryUpdates.size(); ++i)
+  {
+    const MemoryUpdate& srcUpdate = frame.memoryUpdates[i];
+
+    FileMemoryUpdate dstUpdate{};
     dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
+    dstUpdate.dataOffset = data.size();
     dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
     dstUpdate.type = static_cast<u8>(srcUpdate.type);
+    std::memcpy(&data[frame_info->memoryUpdatesOffset + i * sizeof(FileMemoryUpdate)], &dstUpdate,
+                sizeof(FileMemoryUpdate));
 
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
+    data.insert(data.end(), srcUpdate.data.begin(), srcUpdate.data.end());
   }
 
-  return updateListOffset;
+  std::vector<u8> chunk(ZSTD_compressBound(data.size()));
+  const size_t chunk_size =
+      ZSTD_compress(chunk.data(), chunk.size(), data.data(), data.size(), FRAME_COMPRESSION_LEVEL);
+  if (ZSTD_isError(chunk_size))
+    return {};
+
+  chunk.resize(chunk_size);
+  frame_info->chunkSize = static_cast<u32>(chunk_size);
+  frame_info->chunkUncompressedSize = static_cast<u32>(data.size());
+  return chunk;
 }
 
-void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
+bool FifoDataFile::DecompressFrame(const FileFrameInfo& frame_info, const std::vector<u8>& chunk,
+                                   FifoFrameInfo* frame)
 {
-  memUpdates.resize(numUpdates);
+  std::vector<u8> data(frame_info.chunkUncompressedSize);
+  const size_t size = ZSTD_decompress(data.data(), data.size(), chunk.data(), chunk.size());
+  if (ZSTD_isError(size) || size != data.size())
+    return false;
 
-  for (u32 i = 0; i < numUpdates; ++i)
+  const auto in_bounds = [&data](u64 offset, u64 length) {
+    return offset <= data.size() && length <= data.size() - offset;
+  };
+  if (!in_bounds(frame_info.fifoDataOffset, frame_info.fifoDataSize) ||
+      !in_bounds(frame_info.memoryUpdatesOffset,
+                 u64{frame_info.numMemoryUpdates} * sizeof(FileMemoryUpdate)))
+  {
+    return false;
+  }
+
+  const auto fifo_data = data.begin() + frame_info.fifoDataOffset;
+  frame->fifoData.assign(fifo_data, fifo_data + frame_info.fifoDataSize);
+  frame->fifoStart = frame_info.fifoStart;
+  frame->fifoEnd = frame_info.fifoEnd;
+
+  frame->memoryUpdates.resize(frame_info.numMemoryUpdates);
+  for (u32 i = 0; i < frame_info.numMemoryUpdates; ++i)
   {
-    u64 updateOffset = fileOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
     FileMemoryUpdate srcUpdate;
-    file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate));
+    std::memcpy(&srcUpdate, &data[frame_info.memoryUpdatesOffset + i * sizeof(FileMemoryUpdate)],
+                sizeof(FileMemoryUpdate));
+    if (!in_bounds(srcUpdate.dataOffset, srcUpdate.dataSize))
+      return false;
 
-    MemoryUpdate& dstUpdate = memUpdates[i];
+    MemoryUpdate& dstUpdate = frame->memoryUpdates[i];
     dstUpdate.address = srcUpdate.address;
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.data.resize(srcUpdate.dataSize);
     dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
-
-    file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    const auto update_data = data.begin() + srcUpdate.dataOffset;
+    dstUpdate.data.assign(update_data, update_data + srcUpdate.dataSize);
   }
+
+  return true;
 }
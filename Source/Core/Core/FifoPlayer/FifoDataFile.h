@@ -4,8 +4,11 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -56,6 +59,9 @@ public:
   };
   static_assert((XF_MEM_SIZE + XF_REGS_SIZE) * sizeof(u32) == sizeof(XFMemory));
 
+  // Where a frame is stored in a DFF file.
+  struct FileFrameInfo;
+
   FifoDataFile();
   ~FifoDataFile();
 
@@ -73,8 +79,10 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // Frames of loaded files are read from disk when they are first needed, and only a few of them
+  // are kept in memory. The returned frame stays valid for as long as it's referenced.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const { return m_frame_count; }
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
@@ -90,9 +98,12 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  static std::vector<u8> CompressFrame(const FifoFrameInfo& frame, FileFrameInfo* frame_info);
+  static bool DecompressFrame(const FileFrameInfo& frame_info, const std::vector<u8>& chunk,
+                              FifoFrameInfo* frame);
+  std::shared_ptr<const FifoFrameInfo> ReadFrame(u32 frame) const;
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
@@ -105,5 +116,14 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  u32 m_frame_count = 0;
+  // Recorded frames, which are always in memory.
+  std::vector<std::shared_ptr<const FifoFrameInfo>> m_Frames;
+
+  // For loaded files, where each frame is stored, and the most recently used frames.
+  // The player and the FIFO analyzer can read frames from different threads.
+  std::vector<FileFrameInfo> m_frame_index;
+  std::unique_ptr<File::IOFile> m_file;
+  mutable std::mutex m_file_mutex;
+  mutable std::deque<std::pair<u32, std::shared_ptr<const FifoFrameInfo>>> m_frame_cache;
 };
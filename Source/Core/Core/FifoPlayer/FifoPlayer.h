@@ -184,6 +184,8 @@ private:
   Core::System& m_system;
 
   bool m_Loop = true;
+  u32 m_LoopCount = 0;
+  u32 m_LoopsPlayed = 0;
   // If enabled then all memory updates happen at once before the first frame
   bool m_EarlyMemoryUpdates = false;
 
@@ -13,6 +13,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE_Fast.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
@@ -27,7 +28,7 @@ namespace HLE
 static std::map<u32, u32> s_hooked_addresses;
 
 // clang-format off
-constexpr std::array<Hook, 23> os_patches{{
+constexpr std::array<Hook, 31> os_patches{{
     // Placeholder, os_patches[0] is the "non-existent function" index
     {"FAKE_TO_SKIP_0",               HLE_Misc::UnimplementedFunction,       HookType::Replace, HookFlag::Generic},
 
@@ -57,6 +58,16 @@ constexpr std::array<Hook, 23> os_patches{{
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // Library functions that are worth replacing, but only while they touch nothing but RAM
+    {"memcpy",                       nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::Memcpy},
+    {"memset",                       nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::Memset},
+    {"strlen",                       nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::Strlen},
+    {"OSDisableInterrupts",          nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::OSDisableInterrupts},
+    {"OSEnableInterrupts",           nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::OSEnableInterrupts},
+    {"OSRestoreInterrupts",          nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::OSRestoreInterrupts},
+    {"PSMTXIdentity",                nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::PSMTXIdentity},
+    {"PSMTXCopy",                    nullptr,                               HookType::Fast,    HookFlag::Fast, HLE_Fast::PSMTXCopy},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
     {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed} // apploader needs OSReport-like function
@@ -178,6 +189,23 @@ void ExecuteFromJIT(u32 current_pc, u32 hook_index, Core::System& system)
   Execute(guard, current_pc, hook_index);
 }
 
+bool ExecuteFast(const Core::CPUThreadGuard& guard, u32 hook_index)
+{
+  hook_index &= 0xFFFFF;
+  if (hook_index > 0 && hook_index < os_patches.size() && os_patches[hook_index].fast_function)
+    return os_patches[hook_index].fast_function(guard);
+
+  PanicAlertFmt("HLE system tried to call an undefined fast HLE function {}.", hook_index);
+  return false;
+}
+
+bool ExecuteFastFromJIT(u32 current_pc, u32 hook_index, Core::System& system)
+{
+  ASSERT(Core::IsCPUThread());
+  Core::CPUThreadGuard guard(system);
+  return ExecuteFast(guard, hook_index);
+}
+
 u32 GetHookByAddress(u32 address)
 {
   auto iter = s_hooked_addresses.find(address);
@@ -213,7 +241,7 @@ TryReplaceFunctionResult TryReplaceFunction(PPCSymbolDB& ppc_symbol_db, u32 addr
     return {};
 
   const HookType type = GetHookTypeByIndex(hook_index);
-  if (type != HookType::Start && type != HookType::Replace)
+  if (type != HookType::Start && type != HookType::Replace && type != HookType::Fast)
     return {};
 
   const HookFlag flags = GetHookFlagsByIndex(hook_index);
@@ -225,6 +253,9 @@ TryReplaceFunctionResult TryReplaceFunction(PPCSymbolDB& ppc_symbol_db, u32 addr
 
 bool IsEnabled(HookFlag flag, PowerPC::CoreMode mode)
 {
+  if (flag == HLE::HookFlag::Fast)
+    return Config::Get(Config::MAIN_FAST_LIBRARY_HLE);
+
   return flag != HLE::HookFlag::Debug || Config::IsDebuggingEnabled() ||
          mode == PowerPC::CoreMode::Interpreter;
 }
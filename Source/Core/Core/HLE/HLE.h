@@ -23,12 +23,15 @@ class PPCSymbolDB;
 namespace HLE
 {
 using HookFunction = void (*)(const Core::CPUThreadGuard&);
+// Returns whether the call was handled. If it wasn't, the original function has to run.
+using FastHookFunction = bool (*)(const Core::CPUThreadGuard&);
 
 enum class HookType
 {
   None,     // Do not hook the function
   Start,    // Hook the beginning of the function and execute the function afterwards
   Replace,  // Replace the function with the HLE version
+  Fast,     // Replace the function with the HLE version whenever that can handle the call
 };
 
 enum class HookFlag
@@ -36,6 +39,7 @@ enum class HookFlag
   Generic,  // Miscellaneous function
   Debug,    // Debug output function
   Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  Fast,     // Faster equivalent of a library function, see MAIN_FAST_LIBRARY_HLE
 };
 
 struct Hook
@@ -44,6 +48,7 @@ struct Hook
   HookFunction function;
   HookType type;
   HookFlag flags;
+  FastHookFunction fast_function = nullptr;
 };
 
 struct TryReplaceFunctionResult
@@ -64,6 +69,8 @@ u32 UnPatch(Core::System& system, std::string_view patch_name);
 u32 UnpatchRange(Core::System& system, u32 start_addr, u32 end_addr);
 void Execute(const Core::CPUThreadGuard& guard, u32 current_pc, u32 hook_index);
 void ExecuteFromJIT(u32 current_pc, u32 hook_index, Core::System& system);
+bool ExecuteFast(const Core::CPUThreadGuard& guard, u32 hook_index);
+bool ExecuteFastFromJIT(u32 current_pc, u32 hook_index, Core::System& system);
 
 // Returns the HLE hook index of the address
 u32 GetHookByAddress(u32 address);
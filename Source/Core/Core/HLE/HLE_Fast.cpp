@@ -0,0 +1,250 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HLE/HLE_Fast.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+#include <span>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+// These only handle a call when the guest code would have accessed nothing but plain RAM, so that
+// the result can't be told apart from running it. Like any EABI function, they are free to leave
+// the volatile registers in a different state than the guest code would have.
+namespace HLE_Fast
+{
+// Returns a host pointer to a range of RAM that the data BATs map contiguously, or nullptr if the
+// range can't be accessed directly, e.g. because memory checks are set, the data cache is emulated
+// or part of the range is translated through the page table.
+static u8* GetContiguousRAM(Core::System& system, u32 address, u32 size)
+{
+  auto& mmu = system.GetMMU();
+  auto& memory = system.GetMemory();
+
+  const u32 last_address = address + size - 1;
+  if (last_address < address)
+    return nullptr;
+
+  u8* first = nullptr;
+  for (u32 block = address >> PowerPC::BAT_INDEX_SHIFT;
+       block <= last_address >> PowerPC::BAT_INDEX_SHIFT; ++block)
+  {
+    const u32 piece_address = std::max(address, block << PowerPC::BAT_INDEX_SHIFT);
+    if (!mmu.IsOptimizableRAMAddress(piece_address, 8))
+      return nullptr;
+
+    const std::optional<u32> physical_address = mmu.GetTranslatedAddress(piece_address);
+    if (!physical_address)
+      return nullptr;
+
+    const std::span<u8> span = memory.GetSpanForAddress(*physical_address);
+    if (!first)
+    {
+      // The rest of the range has to follow in the same memory region.
+      if (span.size() < size)
+        return nullptr;
+      first = span.data();
+    }
+    else if (span.data() != first + (piece_address - address))
+    {
+      return nullptr;
+    }
+  }
+
+  return first;
+}
+
+static bool Overlaps(const u8* a, const u8* b, u32 size)
+{
+  return a < b + size && b < a + size;
+}
+
+static void Return(PowerPC::PowerPCState& ppc_state, u32 value)
+{
+  ppc_state.gpr[3] = value;
+  ppc_state.npc = LR(ppc_state);
+}
+
+bool Memcpy(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 dst = ppc_state.gpr[3];
+  const u32 src = ppc_state.gpr[4];
+  const u32 size = ppc_state.gpr[5];
+
+  if (size != 0)
+  {
+    u8* const dst_ptr = GetContiguousRAM(system, dst, size);
+    const u8* const src_ptr = GetContiguousRAM(system, src, size);
+
+    // The order in which the guest copies the bytes is only unobservable without overlap.
+    if (!dst_ptr || !src_ptr || Overlaps(dst_ptr, src_ptr, size))
+      return false;
+
+    std::memcpy(dst_ptr, src_ptr, size);
+  }
+
+  Return(ppc_state, dst);
+  return true;
+}
+
+bool Memset(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 dst = ppc_state.gpr[3];
+  const u8 value = static_cast<u8>(ppc_state.gpr[4]);
+  const u32 size = ppc_state.gpr[5];
+
+  if (size != 0)
+  {
+    u8* const dst_ptr = GetContiguousRAM(system, dst, size);
+    if (!dst_ptr)
+      return false;
+
+    std::memset(dst_ptr, value, size);
+  }
+
+  Return(ppc_state, dst);
+  return true;
+}
+
+bool Strlen(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 str = ppc_state.gpr[3];
+
+  // Search one BAT block at a time, as the string may cross into memory that isn't plain RAM.
+  u32 address = str;
+  while (true)
+  {
+    const u32 block_end = ((address >> PowerPC::BAT_INDEX_SHIFT) + 1) << PowerPC::BAT_INDEX_SHIFT;
+    const u32 size = block_end - address;
+    const u8* const ptr = GetContiguousRAM(system, address, size);
+    if (!ptr)
+      return false;
+
+    const void* const terminator = std::memchr(ptr, 0, size);
+    if (terminator)
+    {
+      const u32 offset = static_cast<u32>(static_cast<const u8*>(terminator) - ptr);
+      Return(ppc_state, address + offset - str);
+      return true;
+    }
+
+    // Strings wrapping around the address space are left to the guest.
+    if (block_end == 0)
+      return false;
+    address = block_end;
+  }
+}
+
+// The guest versions go through mfmsr/mtmsr, so they raise a program exception in user mode.
+static bool SetInterruptsEnabled(const Core::CPUThreadGuard& guard, bool enabled)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  if (ppc_state.msr.PR)
+    return false;
+
+  const bool was_enabled = ppc_state.msr.EE;
+  Return(ppc_state, was_enabled);
+
+  if (enabled != was_enabled)
+  {
+    ppc_state.msr.EE = enabled;
+    PowerPC::MSRUpdated(ppc_state);
+
+    // An interrupt that became pending in the meantime is taken on the way back to the caller,
+    // which is where it would have been taken after the guest's mtmsr.
+    if (enabled)
+      system.GetPowerPC().CheckExceptions();
+  }
+
+  return true;
+}
+
+bool OSDisableInterrupts(const Core::CPUThreadGuard& guard)
+{
+  return SetInterruptsEnabled(guard, false);
+}
+
+bool OSEnableInterrupts(const Core::CPUThreadGuard& guard)
+{
+  return SetInterruptsEnabled(guard, true);
+}
+
+bool OSRestoreInterrupts(const Core::CPUThreadGuard& guard)
+{
+  return SetInterruptsEnabled(guard, guard.GetSystem().GetPPCState().gpr[3] != 0);
+}
+
+// The guest versions use psq_l/psq_st with GQR0, so they only move plain floats if the OS has
+// left GQR0 at its default.
+static bool CanUsePairedSingles(const PowerPC::PowerPCState& ppc_state)
+{
+  const UGQR gqr(GQR(ppc_state, 0));
+  return ppc_state.msr.FP && HID2(ppc_state).LSQE && gqr.ld_type == QUANTIZE_FLOAT &&
+         gqr.st_type == QUANTIZE_FLOAT;
+}
+
+constexpr u32 MATRIX_SIZE = 3 * 4 * sizeof(u32);
+
+bool PSMTXIdentity(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  if (!CanUsePairedSingles(ppc_state))
+    return false;
+
+  u8* const dst_ptr = GetContiguousRAM(system, ppc_state.gpr[3], MATRIX_SIZE);
+  if (!dst_ptr)
+    return false;
+
+  const u32 zero = 0;
+  const u32 one = Common::swap32(0x3f800000);
+  const std::array<u32, 12> identity{one,  zero, zero, zero,  //
+                                     zero, one,  zero, zero,  //
+                                     zero, zero, one,  zero};
+  std::memcpy(dst_ptr, identity.data(), MATRIX_SIZE);
+
+  ppc_state.npc = LR(ppc_state);
+  return true;
+}
+
+bool PSMTXCopy(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  if (!CanUsePairedSingles(ppc_state))
+    return false;
+
+  const u8* const src_ptr = GetContiguousRAM(system, ppc_state.gpr[3], MATRIX_SIZE);
+  u8* const dst_ptr = GetContiguousRAM(system, ppc_state.gpr[4], MATRIX_SIZE);
+  if (!src_ptr || !dst_ptr || (src_ptr != dst_ptr && Overlaps(src_ptr, dst_ptr, MATRIX_SIZE)))
+    return false;
+
+  // Going through the FPRs flushes denormals, so do the same conversions as psq_l and psq_st.
+  std::array<u32, 12> matrix;
+  std::memcpy(matrix.data(), src_ptr, MATRIX_SIZE);
+  for (u32& value : matrix)
+    value = Common::swap32(ConvertToSingleFTZ(ConvertToDouble(Common::swap32(value))));
+  std::memcpy(dst_ptr, matrix.data(), MATRIX_SIZE);
+
+  ppc_state.npc = LR(ppc_state);
+  return true;
+}
+}  // namespace HLE_Fast
@@ -0,0 +1,23 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace Core
+{
+class CPUThreadGuard;
+};
+
+// Replacements for small, frequently called library functions. Each one returns whether it handled
+// the call. If it didn't, it hasn't touched the CPU state and the guest code has to run instead.
+namespace HLE_Fast
+{
+bool Memcpy(const Core::CPUThreadGuard& guard);
+bool Memset(const Core::CPUThreadGuard& guard);
+bool Strlen(const Core::CPUThreadGuard& guard);
+bool OSDisableInterrupts(const Core::CPUThreadGuard& guard);
+bool OSEnableInterrupts(const Core::CPUThreadGuard& guard);
+bool OSRestoreInterrupts(const Core::CPUThreadGuard& guard);
+bool PSMTXIdentity(const Core::CPUThreadGuard& guard);
+bool PSMTXCopy(const Core::CPUThreadGuard& guard);
+}  // namespace HLE_Fast
@@ -53,14 +53,34 @@ void CPUManager::FlushStepSyncEventLocked()
 
 void CPUManager::ExecutePendingJobs(std::unique_lock<std::mutex>& state_lock)
 {
-  while (!m_pending_jobs.empty())
+  if (m_pending_jobs.Empty() && !m_has_overflow_jobs.load(std::memory_order_acquire))
+    return;
+
+  state_lock.unlock();
+  std::function<void()> callback;
+  while (true)
   {
-    auto callback = m_pending_jobs.front();
-    m_pending_jobs.pop();
-    state_lock.unlock();
-    callback();
-    state_lock.lock();
+    if (m_pending_jobs.Pop(callback))
+    {
+      callback();
+      callback = nullptr;
+      continue;
+    }
+
+    // Everything in the overflow queue was added after the jobs we have just run.
+    if (!m_has_overflow_jobs.load(std::memory_order_acquire))
+      break;
+
+    std::queue<std::function<void()>> overflow_jobs;
+    {
+      std::lock_guard lk(m_overflow_jobs_lock);
+      std::swap(overflow_jobs, m_overflow_jobs);
+      m_has_overflow_jobs.store(false, std::memory_order_relaxed);
+    }
+    for (; !overflow_jobs.empty(); overflow_jobs.pop())
+      overflow_jobs.front()();
   }
+  state_lock.lock();
 }
 
 void CPUManager::Run()
@@ -359,8 +379,15 @@ bool CPUManager::PauseAndLock(bool do_lock, bool unpause_on_unlock, bool control
 
 void CPUManager::AddCPUThreadJob(std::function<void()> function)
 {
-  std::unique_lock state_lock(m_state_change_lock);
-  m_pending_jobs.push(std::move(function));
+  if (!m_has_overflow_jobs.load(std::memory_order_acquire) &&
+      m_pending_jobs.TryPush(std::move(function)))
+  {
+    return;
+  }
+
+  std::lock_guard lk(m_overflow_jobs_lock);
+  m_overflow_jobs.push(std::move(function));
+  m_has_overflow_jobs.store(true, std::memory_order_release);
 }
 
 }  // namespace CPU
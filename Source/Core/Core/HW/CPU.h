@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <queue>
 
+#include "Common/MPSCQueue.h"
+
 namespace Common
 {
 class Event;
@@ -97,6 +100,7 @@ public:
 
   // Adds a job to be executed during on the CPU thread. This should be combined with
   // PauseAndLock(), as while the CPU is in the run loop, it won't execute the function.
+  // Can be called from any thread, and doesn't take the state lock.
   void AddCPUThreadJob(std::function<void()> function);
 
 private:
@@ -132,7 +136,14 @@ private:
   bool m_state_system_request_stepping = false;
   bool m_state_cpu_step_instruction = false;
   Common::Event* m_state_cpu_step_instruction_sync = nullptr;
-  std::queue<std::function<void()>> m_pending_jobs;
+
+  // Jobs for the CPU thread. Producers only fall back to the locked overflow queue when the
+  // lock-free queue is full, and keep using it until the CPU thread has emptied it, so that jobs
+  // from the same thread run in order.
+  Common::MPSCQueue<std::function<void()>, 64> m_pending_jobs;
+  std::mutex m_overflow_jobs_lock;
+  std::queue<std::function<void()>> m_overflow_jobs;
+  std::atomic<bool> m_has_overflow_jobs = false;
 
   Core::System& m_system;
 };
@@ -592,6 +592,23 @@ u8 DSPManager::ReadARAM(u32 address) const
   }
 }
 
+const u8* DSPManager::GetARAMRange(u32 address, u32 size) const
+{
+  if (m_aram.wii_mode && !(address & 0x10000000))
+  {
+    auto& memory = m_system.GetMemory();
+    const u32 offset = address & memory.GetRamMask();
+    if (size > memory.GetRamMask() - offset + 1)
+      return nullptr;
+    return memory.GetPointerForRange(offset, size);
+  }
+
+  const u32 offset = address & m_aram.mask;
+  if (size > m_aram.mask - offset + 1)
+    return nullptr;
+  return m_aram.ptr + offset;
+}
+
 void DSPManager::WriteARAM(u8 value, u32 address)
 {
   // TODO: verify this on Wii
@@ -94,6 +94,9 @@ public:
   // Audio/DSP Helper
   u8 ReadARAM(u32 address) const;
   void WriteARAM(u8 value, u32 address);
+  // Returns a pointer to the size bytes which ReadARAM reads from address onwards, or nullptr if
+  // they wrap around.
+  const u8* GetARAMRange(u32 address, u32 size) const;
 
   // Debugger Helper
   u8* GetARAMPtr() const;
@@ -36,6 +36,7 @@ AXUCode::AXUCode(DSPHLE* dsphle, u32 crc) : AXUCode(dsphle, crc, false)
   INFO_LOG_FMT(DSPHLE, "Instantiating AXUCode: crc={:08x}", crc);
 
   m_accelerator = std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP());
+  m_voice_workers = CreateVoiceWorkers(dsphle->GetSystem().GetDSP());
 }
 
 AXUCode::~AXUCode() = default;
@@ -418,16 +419,16 @@ void AXUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
-  AXPB pb;
+  const AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+                              m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                              m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
+  auto* const accelerator = static_cast<HLEAccelerator*>(m_accelerator.get());
 
   auto& memory = m_dsphle->GetSystem().GetMemory();
-  while (pb_addr)
-  {
-    AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
-
-    ReadPB(memory, pb_addr, pb, m_crc);
+  // Returns the address of the next PB.
+  const auto process_pb = [&](HLEAccelerator* pb_accelerator, AXBuffers pb_buffers, u32 addr) {
+    AXPB pb;
+    ReadPB(memory, addr, pb, m_crc);
 
     u32 updates_addr = HILO_TO_32(pb.updates.data);
     u16* updates = (u16*)HLEMemory_Get_Pointer(memory, updates_addr);
@@ -436,18 +437,44 @@ void AXUCode::ProcessPBList(u32 pb_addr)
     {
       ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
 
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
-                   ConvertMixerControl(pb.mixer_control),
+      ProcessVoice(pb_accelerator, pb, pb_buffers, spms, ConvertMixerControl(pb.mixer_control),
                    m_coeffs_checksum ? m_coeffs.data() : nullptr);
 
       // Forward the buffers
-      for (auto& ptr : buffers.ptrs)
+      for (auto& ptr : pb_buffers.ptrs)
         ptr += spms;
     }
 
-    WritePB(memory, pb_addr, pb, m_crc);
-    pb_addr = HILO_TO_32(pb.next_pb);
+    WritePB(memory, addr, pb, m_crc);
+    return HILO_TO_32(pb.next_pb);
+  };
+
+  if (m_voice_workers && pb_addr)
+  {
+    m_batched_pb_addrs.clear();
+    for (u32 addr = pb_addr; addr && m_batched_pb_addrs.size() <= MAX_BATCHED_PBS;)
+    {
+      m_batched_pb_addrs.push_back(addr);
+
+      // The updates of a PB can change which PB follows it.
+      AXPB pb;
+      ReadPB(memory, addr, pb, m_crc);
+      u16* updates = (u16*)HLEMemory_Get_Pointer(memory, HILO_TO_32(pb.updates.data));
+      for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+        ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
+      addr = HILO_TO_32(pb.next_pb);
+    }
+
+    if (m_batched_pb_addrs.size() <= MAX_BATCHED_PBS)
+    {
+      ProcessPBsInParallel(*m_voice_workers, m_batched_pb_addrs, accelerator, buffers,
+                           process_pb);
+      return;
+    }
   }
+
+  while (pb_addr)
+    pb_addr = process_pb(accelerator, buffers, pb_addr);
 }
 
 void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
@@ -14,6 +14,7 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
@@ -30,6 +31,7 @@ class Accelerator;
 
 namespace DSP::HLE
 {
+class AXVoiceWorkers;
 class DSPHLE;
 
 // We can't directly use the mixer_control field from the PB because it does
@@ -110,6 +112,10 @@ protected:
 
   std::unique_ptr<Accelerator> m_accelerator;
 
+  // Only set up when MAIN_DSP_HLE_VOICE_THREADS is enabled.
+  std::unique_ptr<AXVoiceWorkers> m_voice_workers;
+  std::vector<u32> m_batched_pb_addrs;
+
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
   AXUCode(DSPHLE* dsphle, u32 crc, bool dummy);
 
@@ -0,0 +1,325 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/MathUtil.h"
+
+#if defined(_M_X86_64)
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE::AXMixing
+{
+namespace
+{
+s32 MixSample(s16 input, u16 volume)
+{
+  // A sample times a volume always fits in 32 bits.
+  return std::clamp((s32(input) * s32(volume)) >> 15, -32767, 32767);  // -32768 ?
+}
+
+s16 InterpolateLinear(const s16* input, u32 pos)
+{
+  // When the fraction is 0, this is simply the first sample.
+  const s32 frac = pos & 0xFFFF;
+  const s32 s0 = input[pos >> 16];
+  const s32 s1 = input[(pos >> 16) + 1];
+  return static_cast<s16>((s0 * (0x10000 - frac) + s1 * frac) >> 16);
+}
+
+s16 InterpolatePolyphase(const s16* input, u32 pos, const s16* coeffs)
+{
+  const s16* t = &input[pos >> 16];
+  const s16* c = &coeffs[((pos & 0xFFFF) >> 9) << 2];
+  const s64 sample = s64(t[0]) * c[0] + s64(t[1]) * c[1] + s64(t[2]) * c[2] + s64(t[3]) * c[3];
+  return MathUtil::SaturatingCast<s16>(sample >> 15);
+}
+
+#if defined(_M_X86_64)
+FUNCTION_TARGET_AVX2
+u32 MixAddAVX2(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta)
+{
+  const __m256i mask = _mm256_set1_epi32(0xFFFF);
+  const __m256i min = _mm256_set1_epi32(-32767);
+  const __m256i max = _mm256_set1_epi32(32767);
+  const __m256i step = _mm256_set1_epi32(volume_delta * 8);
+  __m256i volumes = _mm256_and_si256(
+      _mm256_add_epi32(_mm256_set1_epi32(volume),
+                       _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                          _mm256_set1_epi32(volume_delta))),
+      mask);
+
+  u32 i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256i samples = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+    __m256i mixed = _mm256_srai_epi32(_mm256_mullo_epi32(samples, volumes), 15);
+    mixed = _mm256_min_epi32(_mm256_max_epi32(mixed, min), max);
+
+    __m256i* dest = reinterpret_cast<__m256i*>(out + i);
+    _mm256_storeu_si256(dest, _mm256_add_epi32(_mm256_loadu_si256(dest), mixed));
+    volumes = _mm256_and_si256(_mm256_add_epi32(volumes, step), mask);
+  }
+  return i;
+}
+
+FUNCTION_TARGET_SSR41
+u32 MixAddSSE41(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta)
+{
+  const __m128i mask = _mm_set1_epi32(0xFFFF);
+  const __m128i min = _mm_set1_epi32(-32767);
+  const __m128i max = _mm_set1_epi32(32767);
+  const __m128i step = _mm_set1_epi32(volume_delta * 4);
+  __m128i volumes = _mm_and_si128(
+      _mm_add_epi32(_mm_set1_epi32(volume),
+                    _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(volume_delta))),
+      mask);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i samples =
+        _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i)));
+    __m128i mixed = _mm_srai_epi32(_mm_mullo_epi32(samples, volumes), 15);
+    mixed = _mm_min_epi32(_mm_max_epi32(mixed, min), max);
+
+    __m128i* dest = reinterpret_cast<__m128i*>(out + i);
+    _mm_storeu_si128(dest, _mm_add_epi32(_mm_loadu_si128(dest), mixed));
+    volumes = _mm_and_si128(_mm_add_epi32(volumes, step), mask);
+  }
+  return i;
+}
+
+FUNCTION_TARGET_SSR41
+u32 ResampleLinearSSE41(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio)
+{
+  const __m128i one = _mm_set1_epi32(0x10000);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    alignas(16) s32 pairs[4];
+    alignas(16) s32 fracs[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      curr_pos += ratio;
+      std::memcpy(&pairs[j], &input[curr_pos >> 16], sizeof(s32));
+      fracs[j] = curr_pos & 0xFFFF;
+    }
+
+    const __m128i pair = _mm_load_si128(reinterpret_cast<const __m128i*>(pairs));
+    const __m128i frac = _mm_load_si128(reinterpret_cast<const __m128i*>(fracs));
+    const __m128i s0 = _mm_srai_epi32(_mm_slli_epi32(pair, 16), 16);
+    const __m128i s1 = _mm_srai_epi32(pair, 16);
+    const __m128i sum = _mm_add_epi32(_mm_mullo_epi32(s0, _mm_sub_epi32(one, frac)),
+                                      _mm_mullo_epi32(s1, frac));
+    const __m128i result = _mm_srai_epi32(sum, 16);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(result, result));
+  }
+  return i;
+}
+
+FUNCTION_TARGET_SSR41
+u32 ResamplePolyphaseSSE41(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                           const s16* coeffs)
+{
+  const __m128i low_mask = _mm_set1_epi32(0x7FFF);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i taps[4];
+    __m128i c[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      curr_pos += ratio;
+      taps[j] = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&input[curr_pos >> 16]));
+      c[j] = _mm_loadl_epi64(
+          reinterpret_cast<const __m128i*>(&coeffs[((curr_pos & 0xFFFF) >> 9) << 2]));
+    }
+
+    const __m128i t01 = _mm_unpacklo_epi64(taps[0], taps[1]);
+    const __m128i t23 = _mm_unpacklo_epi64(taps[2], taps[3]);
+    const __m128i c01 = _mm_unpacklo_epi64(c[0], c[1]);
+    const __m128i c23 = _mm_unpacklo_epi64(c[2], c[3]);
+    const __m128i lo01 = _mm_mullo_epi16(t01, c01);
+    const __m128i hi01 = _mm_mulhi_epi16(t01, c01);
+    const __m128i lo23 = _mm_mullo_epi16(t23, c23);
+    const __m128i hi23 = _mm_mulhi_epi16(t23, c23);
+    const __m128i p0 = _mm_unpacklo_epi16(lo01, hi01);
+    const __m128i p1 = _mm_unpackhi_epi16(lo01, hi01);
+    const __m128i p2 = _mm_unpacklo_epi16(lo23, hi23);
+    const __m128i p3 = _mm_unpackhi_epi16(lo23, hi23);
+
+    // The sum of the four products doesn't always fit in 32 bits, so the bits above and below the
+    // shift are summed separately.
+    const __m128i high =
+        _mm_hadd_epi32(_mm_hadd_epi32(_mm_srai_epi32(p0, 15), _mm_srai_epi32(p1, 15)),
+                       _mm_hadd_epi32(_mm_srai_epi32(p2, 15), _mm_srai_epi32(p3, 15)));
+    const __m128i low =
+        _mm_hadd_epi32(_mm_hadd_epi32(_mm_and_si128(p0, low_mask), _mm_and_si128(p1, low_mask)),
+                       _mm_hadd_epi32(_mm_and_si128(p2, low_mask), _mm_and_si128(p3, low_mask)));
+    const __m128i result = _mm_add_epi32(high, _mm_srai_epi32(low, 15));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(result, result));
+  }
+  return i;
+}
+#elif defined(_M_ARM_64)
+u32 MixAddNEON(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta)
+{
+  alignas(16) static constexpr s32 lanes[4] = {0, 1, 2, 3};
+  const int32x4_t mask = vdupq_n_s32(0xFFFF);
+  const int32x4_t min = vdupq_n_s32(-32767);
+  const int32x4_t max = vdupq_n_s32(32767);
+  const int32x4_t step = vdupq_n_s32(volume_delta * 4);
+  int32x4_t volumes =
+      vandq_s32(vmlaq_n_s32(vdupq_n_s32(volume), vld1q_s32(lanes), volume_delta), mask);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const int32x4_t samples = vmovl_s16(vld1_s16(input + i));
+    int32x4_t mixed = vshrq_n_s32(vmulq_s32(samples, volumes), 15);
+    mixed = vminq_s32(vmaxq_s32(mixed, min), max);
+
+    vst1q_s32(out + i, vaddq_s32(vld1q_s32(out + i), mixed));
+    volumes = vandq_s32(vaddq_s32(volumes, step), mask);
+  }
+  return i;
+}
+
+u32 ResampleLinearNEON(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio)
+{
+  const int32x4_t one = vdupq_n_s32(0x10000);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    alignas(16) s32 pairs[4];
+    alignas(16) s32 fracs[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      curr_pos += ratio;
+      std::memcpy(&pairs[j], &input[curr_pos >> 16], sizeof(s32));
+      fracs[j] = curr_pos & 0xFFFF;
+    }
+
+    const int32x4_t pair = vld1q_s32(pairs);
+    const int32x4_t frac = vld1q_s32(fracs);
+    const int32x4_t s0 = vshrq_n_s32(vshlq_n_s32(pair, 16), 16);
+    const int32x4_t s1 = vshrq_n_s32(pair, 16);
+    const int32x4_t sum = vmlaq_s32(vmulq_s32(s0, vsubq_s32(one, frac)), s1, frac);
+    vst1_s16(output + i, vmovn_s32(vshrq_n_s32(sum, 16)));
+  }
+  return i;
+}
+
+u32 ResamplePolyphaseNEON(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                          const s16* coeffs)
+{
+  const int32x4_t low_mask = vdupq_n_s32(0x7FFF);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    int32x4_t high[4];
+    int32x4_t low[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      curr_pos += ratio;
+      const int16x4_t taps = vld1_s16(&input[curr_pos >> 16]);
+      const int16x4_t c = vld1_s16(&coeffs[((curr_pos & 0xFFFF) >> 9) << 2]);
+      const int32x4_t products = vmull_s16(taps, c);
+      // The sum of the four products doesn't always fit in 32 bits, so the bits above and below
+      // the shift are summed separately.
+      high[j] = vshrq_n_s32(products, 15);
+      low[j] = vandq_s32(products, low_mask);
+    }
+
+    const int32x4_t high_sum =
+        vpaddq_s32(vpaddq_s32(high[0], high[1]), vpaddq_s32(high[2], high[3]));
+    const int32x4_t low_sum = vpaddq_s32(vpaddq_s32(low[0], low[1]), vpaddq_s32(low[2], low[3]));
+    vst1_s16(output + i, vqmovn_s32(vaddq_s32(high_sum, vshrq_n_s32(low_sum, 15))));
+  }
+  return i;
+}
+#endif
+}  // namespace
+
+void MixAdd(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta, s16* dpop)
+{
+  if (count == 0)
+    return;
+
+  u32 i = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    i = MixAddAVX2(out, input, count, *volume, volume_delta);
+  else if (cpu_info.bSSE4_1)
+    i = MixAddSSE41(out, input, count, *volume, volume_delta);
+#elif defined(_M_ARM_64)
+  i = MixAddNEON(out, input, count, *volume, volume_delta);
+#endif
+
+  const u16 start_volume = *volume;
+  u16 curr_volume = static_cast<u16>(start_volume + i * volume_delta);
+  for (; i < count; ++i)
+  {
+    out[i] += MixSample(input[i], curr_volume);
+    curr_volume += volume_delta;
+  }
+
+  *volume = curr_volume;
+  *dpop = static_cast<s16>(
+      MixSample(input[count - 1], static_cast<u16>(start_volume + (count - 1) * volume_delta)));
+}
+
+u32 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio)
+{
+  const u64 end_pos = curr_pos + u64(ratio) * count;
+  return static_cast<u32>(std::min<u64>(end_pos >> 16, UINT32_MAX));
+}
+
+void ResampleLinear(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio)
+{
+  u32 i = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bSSE4_1)
+    i = ResampleLinearSSE41(input, output, count, curr_pos, ratio);
+#elif defined(_M_ARM_64)
+  i = ResampleLinearNEON(input, output, count, curr_pos, ratio);
+#endif
+
+  for (curr_pos += i * ratio; i < count; ++i)
+  {
+    curr_pos += ratio;
+    output[i] = InterpolateLinear(input, curr_pos);
+  }
+}
+
+void ResamplePolyphase(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                       const s16* coeffs)
+{
+  u32 i = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bSSE4_1)
+    i = ResamplePolyphaseSSE41(input, output, count, curr_pos, ratio, coeffs);
+#elif defined(_M_ARM_64)
+  i = ResamplePolyphaseNEON(input, output, count, curr_pos, ratio, coeffs);
+#endif
+
+  for (curr_pos += i * ratio; i < count; ++i)
+  {
+    curr_pos += ratio;
+    output[i] = InterpolatePolyphase(input, curr_pos, coeffs);
+  }
+}
+}  // namespace DSP::HLE::AXMixing
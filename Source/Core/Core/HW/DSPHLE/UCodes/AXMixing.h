@@ -0,0 +1,30 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Per-sample loops of the AX voice processing, shared by AX GC and AX Wii. They use SIMD where the
+// host supports it, and give exactly the same results as the scalar integer math on every host.
+namespace DSP::HLE::AXMixing
+{
+// The most input samples the resamplers can use for one call, not counting the four samples kept
+// from the previous call.
+constexpr u32 MAX_RESAMPLE_INPUT = 1024;
+
+// Adds (input * volume) >> 15, clamped to +/-32767, to out. The volume is increased by
+// volume_delta after every sample, and dpop is set to the last mixed sample.
+void MixAdd(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta, s16* dpop);
+
+// The number of input samples which resampling count output samples reads.
+u32 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio);
+
+// Resamples input into count output samples. input starts with the four last samples of the
+// previous call, followed by GetResampleInputCount(count, curr_pos, ratio) new samples.
+// curr_pos and ratio are 16.16 fixed point, see ResampleAudio in AXVoice.h.
+void ResampleLinear(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio);
+// coeffs points to the 512 coefficients selected by the PB.
+void ResamplePolyphase(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                       const s16* coeffs);
+}  // namespace DSP::HLE::AXMixing
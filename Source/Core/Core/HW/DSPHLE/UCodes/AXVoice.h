@@ -12,15 +12,21 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
@@ -87,6 +93,20 @@ union AXBuffers
 #endif
 };
 
+// The number of samples of each of the AXBuffers.
+#ifdef AX_GC
+constexpr std::array<size_t, 9> BUFFER_SIZES = {32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 5,
+                                                32 * 5, 32 * 5, 32 * 5, 32 * 5};
+#else
+constexpr std::array<size_t, 20> BUFFER_SIZES = {
+    32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 5, 32 * 3,
+    32 * 3, 32 * 3, 6 * 3,  6 * 3,  6 * 3,  6 * 3,  6 * 3,  6 * 3,  6 * 3,  6 * 3};
+#endif
+
+// PB lists longer than this are processed one voice at a time even when there are voice workers.
+// A list which loops back on itself would otherwise be gathered forever.
+constexpr size_t MAX_BATCHED_PBS = 0x10000;
+
 // Determines if this version of the UCode has a PBLowPassFilter in its AXPB layout.
 bool HasLpf(u32 crc)
 {
@@ -193,10 +213,53 @@ protected:
 
   void WriteMemory(u32 address, u8 value) override { m_dsp.WriteARAM(value, address); }
 
+  const u8* GetMemoryRange(u32 address, u32 size) override
+  {
+    return m_dsp.GetARAMRange(address, size);
+  }
+
 private:
   DSP::DSPManager& m_dsp;
 };
 
+std::unique_ptr<AXVoiceWorkers> CreateVoiceWorkers(DSP::DSPManager& dsp)
+{
+  const int thread_count = Config::Get(Config::MAIN_DSP_HLE_VOICE_THREADS);
+  if (thread_count <= 0)
+    return nullptr;
+
+  return std::make_unique<AXVoiceWorkers>(std::min(thread_count, 8), BUFFER_SIZES,
+                                          [&dsp] { return std::make_unique<HLEAccelerator>(dsp); });
+}
+
+// Processes the PBs at the given addresses on the voice workers. process(accelerator, buffers,
+// addr) reads, processes and writes back one PB.
+template <typename Process>
+void ProcessPBsInParallel(AXVoiceWorkers& workers, const std::vector<u32>& pb_addrs,
+                          HLEAccelerator* accelerator, const AXBuffers& buffers,
+                          const Process& process)
+{
+  const std::function<void(size_t, size_t)> function = [&](size_t worker, size_t index) {
+    if (worker == 0)
+    {
+      process(accelerator, buffers, pb_addrs[index]);
+      return;
+    }
+
+    AXBuffers worker_buffers;
+    for (size_t i = 0; i < std::size(worker_buffers.ptrs); ++i)
+      worker_buffers.ptrs[i] = workers.GetBuffer(worker, i);
+    process(static_cast<HLEAccelerator*>(workers.GetAccelerator(worker)), worker_buffers,
+            pb_addrs[index]);
+  };
+
+  // The last voice is processed last by this thread, so that the accelerator of the UCode ends up
+  // in the same state as when processing the voices one after another.
+  workers.Run(pb_addrs.size() - 1, function);
+  process(accelerator, buffers, pb_addrs.back());
+  workers.AddBuffersTo(buffers.ptrs);
+}
+
 // Sets up the simulated accelerator.
 void AcceleratorSetup(HLEAccelerator* accelerator, PB_TYPE* pb)
 {
@@ -210,16 +273,9 @@ void AcceleratorSetup(HLEAccelerator* accelerator, PB_TYPE* pb)
   accelerator->SetPredScale(pb->adpcm.pred_scale);
 }
 
-// Reads a sample from the accelerator. Also handles looping and
-// disabling streams that reached the end (this is done by an exception raised
-// by the accelerator on real hardware).
-u16 AcceleratorGetSample(HLEAccelerator* accelerator)
-{
-  return accelerator->Read(accelerator->acc_pb->adpcm.coefs);
-}
-
-// Reads samples from the input callback, resamples them to <count> samples at
-// the wanted sample rate (computed from the ratio, see below).
+// Reads samples from the input callback, which fills the span it is given with
+// the next input samples, and resamples them to <count> samples at the wanted
+// sample rate (computed from the ratio, see below).
 //
 // If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
 // (or the srctype will automatically be changed to LINEAR).
@@ -238,11 +294,30 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
-                  u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
+u32 ResampleAudio(const std::function<void(std::span<s16>)>& input_callback, s16* output,
+                  u32 count, s16* last_samples, u32 curr_pos, u32 ratio, int srctype,
+                  const s16* coeffs)
 {
-  int read_samples_count = 0;
+  const bool interpolate = srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE;
+  const u32 input_count = AXMixing::GetResampleInputCount(count, curr_pos, ratio);
+  if (interpolate && input_count <= AXMixing::MAX_RESAMPLE_INPUT)
+  {
+    // Read all the input samples first, so that the interpolation doesn't have to wait for each
+    // of them.
+    std::array<s16, AXMixing::MAX_RESAMPLE_INPUT + 4> input;
+    std::copy_n(last_samples, 4, input.begin());
+    input_callback(std::span(input).subspan(4, input_count));
+
+    if (coeffs && srctype == SRCTYPE_POLYPHASE)
+      AXMixing::ResamplePolyphase(input.data(), output, count, curr_pos, ratio, coeffs);
+    else
+      AXMixing::ResampleLinear(input.data(), output, count, curr_pos, ratio);
+
+    std::copy_n(&input[input_count], 4, last_samples);
+    return (curr_pos + count * ratio) & 0xFFFF;
+  }
 
+  // The loops below handle very high ratios, which would need more input than fits in the buffer.
   // If DSP DROM coefficients are available, support polyphase resampling.
   if (coeffs && srctype == SRCTYPE_POLYPHASE)
   {
@@ -259,7 +334,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       curr_pos += ratio;
       while (curr_pos >= 0x10000)
       {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
+        input_callback(std::span(&temp[idx++ & 3], 1));
         curr_pos -= 0x10000;
       }
 
@@ -302,7 +377,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       // circular buffer.
       while (curr_pos >= 0x10000)
       {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
+        input_callback(std::span(&temp[idx++ & 3], 1));
         curr_pos -= 0x10000;
       }
 
@@ -341,8 +416,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   {
     // No sample rate conversion here: simply read samples from the
     // accelerator to the output buffer.
-    for (u32 i = 0; i < count; ++i)
-      output[i] = input_callback(i);
+    input_callback(std::span(output, count));
 
     memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
   }
@@ -359,9 +433,16 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // The accelerator also handles looping and disabling streams that reached
+  // the end (this is done by an exception raised by the accelerator on real
+  // hardware).
+  u32 curr_pos = ResampleAudio(
+      [accelerator](std::span<s16> input) {
+        accelerator->ReadSamples(accelerator->acc_pb->adpcm.coefs, input);
+      },
+      samples, count, pb.src.last_samples, pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio),
+      pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -375,27 +456,10 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
+  // If volume ramping is disabled, use a volume_delta of 0. That way, the
   // mixing loop can avoid testing if volume ramping is enabled at each step,
   // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    sample = std::clamp((s32)sample, -32767, 32767);  // -32768 ?
-
-    out[i] += (s16)sample;
-    volume += volume_delta;
-
-    *dpop = (s16)sample;
-  }
+  AXMixing::MixAdd(out, input, count, &vd->volume, ramp ? vd->volume_delta : 0, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value. Returns
@@ -535,9 +599,14 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 
     // We use ratio 0x55555 == (5 * 65536 + 21845) / 65536 == 5.3333 which
     // is the nearest we can get to 96/18
-    u32 curr_pos = ResampleAudio([&samples](u32 i) { return samples[i]; }, wm_samples, wm_count,
-                                 pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
-                                 SRCTYPE_POLYPHASE, coeffs);
+    u32 read_count = 0;
+    u32 curr_pos = ResampleAudio(
+        [&samples, &read_count](std::span<s16> input) {
+          std::copy_n(samples + read_count, input.size(), input.begin());
+          read_count += static_cast<u32>(input.size());
+        },
+        wm_samples, wm_count, pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
+        SRCTYPE_POLYPHASE, coeffs);
     pb.remote_src.cur_addr_frac = curr_pos & 0xFFFF;
 
 // Mix to main[0-3] and aux[0-3]
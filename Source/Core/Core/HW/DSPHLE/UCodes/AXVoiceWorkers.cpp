@@ -0,0 +1,127 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
+
+#include <algorithm>
+
+#include "Common/Thread.h"
+#include "Core/DSP/DSPAccelerator.h"
+
+namespace DSP::HLE
+{
+AXVoiceWorkers::AXVoiceWorkers(size_t thread_count, std::span<const size_t> buffer_sizes,
+                               const CreateAccelerator& create_accelerator)
+{
+  size_t total_size = 0;
+  for (const size_t size : buffer_sizes)
+  {
+    m_buffer_offsets.push_back(total_size);
+    total_size += size;
+  }
+  m_buffer_offsets.push_back(total_size);
+
+  m_workers.resize(thread_count);
+  for (Worker& worker : m_workers)
+  {
+    if (create_accelerator)
+      worker.accelerator = create_accelerator();
+    worker.samples.resize(total_size);
+  }
+
+  for (size_t i = 0; i < m_workers.size(); ++i)
+    m_workers[i].thread = std::thread(&AXVoiceWorkers::ThreadFunc, this, i + 1);
+}
+
+AXVoiceWorkers::~AXVoiceWorkers()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_quit = true;
+  }
+  m_work_cv.notify_all();
+
+  for (Worker& worker : m_workers)
+    worker.thread.join();
+}
+
+Accelerator* AXVoiceWorkers::GetAccelerator(size_t worker) const
+{
+  return m_workers[worker - 1].accelerator.get();
+}
+
+int* AXVoiceWorkers::GetBuffer(size_t worker, size_t buffer)
+{
+  return &m_workers[worker - 1].samples[m_buffer_offsets[buffer]];
+}
+
+void AXVoiceWorkers::Run(size_t count, const std::function<void(size_t, size_t)>& function)
+{
+  if (count == 0)
+    return;
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_function = &function;
+    m_count = count;
+    m_next_index = 0;
+    m_busy_workers = m_workers.size();
+    m_generation++;
+  }
+  m_work_cv.notify_all();
+
+  DoWork(0);
+
+  std::unique_lock lk(m_mutex);
+  m_done_cv.wait(lk, [this] { return m_busy_workers == 0; });
+  m_function = nullptr;
+}
+
+void AXVoiceWorkers::AddBuffersTo(std::span<int* const> buffers)
+{
+  for (Worker& worker : m_workers)
+  {
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+      int* samples = &worker.samples[m_buffer_offsets[i]];
+      const size_t size = m_buffer_offsets[i + 1] - m_buffer_offsets[i];
+      for (size_t j = 0; j < size; ++j)
+        buffers[i][j] += samples[j];
+      std::fill_n(samples, size, 0);
+    }
+  }
+}
+
+void AXVoiceWorkers::ThreadFunc(size_t worker)
+{
+  Common::SetCurrentThreadName("AX voice worker");
+
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lk(m_mutex);
+      m_work_cv.wait(lk, [&] { return m_quit || m_generation != generation; });
+      if (m_quit)
+        return;
+      generation = m_generation;
+    }
+
+    DoWork(worker);
+
+    bool done;
+    {
+      std::lock_guard lk(m_mutex);
+      done = --m_busy_workers == 0;
+    }
+    if (done)
+      m_done_cv.notify_one();
+  }
+}
+
+void AXVoiceWorkers::DoWork(size_t worker)
+{
+  for (size_t i = m_next_index++; i < m_count; i = m_next_index++)
+    (*m_function)(worker, i);
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DSP
+{
+class Accelerator;
+}
+
+namespace DSP::HLE
+{
+// Threads which the voices of a PB list are processed on in parallel. Voices only interact through
+// the mix buffers, and integer sums don't depend on the order they're added in, so each worker
+// mixes into buffers of its own which are added together afterwards.
+//
+// The thread which calls Run takes part as worker 0, using the accelerator and mix buffers of the
+// UCode. The other workers have their own. The Zelda UCode uses the workers without either.
+class AXVoiceWorkers
+{
+public:
+  using CreateAccelerator = std::function<std::unique_ptr<Accelerator>()>;
+
+  // buffer_sizes has the number of samples of each mix buffer, in the order of AXBuffers.
+  // create_accelerator may be empty if the workers don't need accelerators.
+  AXVoiceWorkers(size_t thread_count, std::span<const size_t> buffer_sizes,
+                 const CreateAccelerator& create_accelerator);
+  ~AXVoiceWorkers();
+
+  AXVoiceWorkers(const AXVoiceWorkers&) = delete;
+  AXVoiceWorkers& operator=(const AXVoiceWorkers&) = delete;
+
+  // Counting the calling thread.
+  size_t GetWorkerCount() const { return m_workers.size() + 1; }
+  // Only valid for workers other than 0.
+  Accelerator* GetAccelerator(size_t worker) const;
+  int* GetBuffer(size_t worker, size_t buffer);
+
+  // Calls function(worker, index) for every index in [0, count), and returns once all calls have.
+  void Run(size_t count, const std::function<void(size_t, size_t)>& function);
+  // Adds the mix buffers of the workers to the given buffers of the UCode, and clears them.
+  void AddBuffersTo(std::span<int* const> buffers);
+
+private:
+  struct Worker
+  {
+    std::unique_ptr<Accelerator> accelerator;
+    std::vector<int> samples;
+    std::thread thread;
+  };
+
+  void ThreadFunc(size_t worker);
+  void DoWork(size_t worker);
+
+  std::vector<Worker> m_workers;
+  std::vector<size_t> m_buffer_offsets;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+  u64 m_generation = 0;
+  size_t m_busy_workers = 0;
+  bool m_quit = false;
+
+  const std::function<void(size_t, size_t)>* m_function = nullptr;
+  size_t m_count = 0;
+  std::atomic<size_t> m_next_index = 0;
+};
+}  // namespace DSP::HLE
@@ -31,6 +31,7 @@ AXWiiUCode::AXWiiUCode(DSPHLE* dsphle, u32 crc)
   m_old_axwii = (crc == 0xfa450138) || (crc == 0x7699af32);
 
   m_accelerator = std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP());
+  m_voice_workers = CreateVoiceWorkers(dsphle->GetSystem().GetDSP());
 }
 
 void AXWiiUCode::Initialize()
@@ -425,20 +426,20 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
-  AXPBWii pb;
+  const AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+                              m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                              m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
+                              m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
+                              m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
+                              m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
+                              m_samples_wm3,       m_samples_aux3}};
+  auto* const accelerator = static_cast<HLEAccelerator*>(m_accelerator.get());
 
   auto& memory = m_dsphle->GetSystem().GetMemory();
-  while (pb_addr)
-  {
-    AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
-                          m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
-                          m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
-                          m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
-                          m_samples_wm3,       m_samples_aux3}};
-
-    ReadPB(memory, pb_addr, pb, m_crc);
+  // Returns the address of the next PB.
+  const auto process_pb = [&](HLEAccelerator* pb_accelerator, AXBuffers pb_buffers, u32 addr) {
+    AXPBWii pb;
+    ReadPB(memory, addr, pb, m_crc);
 
     u16 num_updates[3];
     u16 updates[1024];
@@ -448,26 +449,58 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
       for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
       {
         ApplyUpdatesForMs(curr_ms, pb, num_updates, updates);
-        ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
+        ProcessVoice(pb_accelerator, pb, pb_buffers, spms,
                      ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
                      m_coeffs_checksum ? m_coeffs.data() : nullptr);
 
         // Forward the buffers
-        for (auto& ptr : buffers.ptrs)
+        for (auto& ptr : pb_buffers.ptrs)
           ptr += spms;
       }
       ReinjectUpdatesFields(pb, num_updates, updates_addr);
     }
     else
     {
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, 96,
+      ProcessVoice(pb_accelerator, pb, pb_buffers, 96,
                    ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
                    m_coeffs_checksum ? m_coeffs.data() : nullptr);
     }
 
-    WritePB(memory, pb_addr, pb, m_crc);
-    pb_addr = HILO_TO_32(pb.next_pb);
+    WritePB(memory, addr, pb, m_crc);
+    return HILO_TO_32(pb.next_pb);
+  };
+
+  if (m_voice_workers && pb_addr)
+  {
+    m_batched_pb_addrs.clear();
+    for (u32 addr = pb_addr; addr && m_batched_pb_addrs.size() <= MAX_BATCHED_PBS;)
+    {
+      m_batched_pb_addrs.push_back(addr);
+
+      // The updates of a PB can change which PB follows it.
+      AXPBWii pb;
+      ReadPB(memory, addr, pb, m_crc);
+      u16 num_updates[3];
+      u16 updates[1024];
+      u32 updates_addr;
+      if (ExtractUpdatesFields(pb, num_updates, updates, &updates_addr))
+      {
+        for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
+          ApplyUpdatesForMs(curr_ms, pb, num_updates, updates);
+      }
+      addr = HILO_TO_32(pb.next_pb);
+    }
+
+    if (m_batched_pb_addrs.size() <= MAX_BATCHED_PBS)
+    {
+      ProcessPBsInParallel(*m_voice_workers, m_batched_pb_addrs, accelerator, buffers,
+                           process_pb);
+      return;
+    }
   }
+
+  while (pb_addr)
+    pb_addr = process_pb(accelerator, buffers, pb_addr);
 }
 
 void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 volume)
@@ -5,15 +5,20 @@
 
 #include <algorithm>
 #include <array>
+#include <functional>
 #include <map>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/DSP/DSPAccelerator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
 #include "Core/HW/DSPHLE/UCodes/GBA.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/System.h"
@@ -631,21 +636,23 @@ void ZeldaUCode::RenderAudio()
     if (m_rendering_curr_voice == 0)
       m_renderer.PrepareFrame();
 
-    while (m_rendering_curr_voice < m_rendering_voices_per_frame)
+    // Render all voices up to the last synced one at once.
+    const u32 end_voice = std::min<u32>(m_rendering_voices_per_frame, m_sync_max_voice_id);
+    m_batched_voices.clear();
+    for (; m_rendering_curr_voice < end_voice; m_rendering_curr_voice++)
     {
-      // If we are not meant to render this voice yet, go back to message
-      // processing.
-      if (m_rendering_curr_voice >= m_sync_max_voice_id)
-        return;
-
       // Test the sync flag for this voice, skip it if not set.
       u16 flags = m_sync_voice_skip_flags[m_rendering_curr_voice >> 4];
       u8 bit = 0xF - (m_rendering_curr_voice & 0xF);
       if (flags & (1 << bit))
-        m_renderer.AddVoice(m_rendering_curr_voice);
-
-      m_rendering_curr_voice++;
+        m_batched_voices.push_back(static_cast<u16>(m_rendering_curr_voice));
     }
+    m_renderer.AddVoices(m_batched_voices);
+
+    // If we are not meant to render the other voices yet, go back to message
+    // processing.
+    if (m_rendering_curr_voice < m_rendering_voices_per_frame)
+      return;
 
     if (!(m_flags & LIGHT_PROTOCOL))
       SendCommandAck(CommandAck::STANDARD, 0xFF00 | m_rendering_curr_frame);
@@ -966,8 +973,21 @@ struct ReverbPB
 };
 #pragma pack(pop)
 
+// A voice whose input samples were loaded by AddVoices, waiting to be mixed.
+struct ZeldaAudioRenderer::PreparedVoice
+{
+  VPB vpb;
+  MixingBuffer input_samples;
+  bool active;
+  bool loaded;
+};
+
 ZeldaAudioRenderer::ZeldaAudioRenderer(Core::System& system) : m_system(system)
 {
+  const int thread_count = Config::Get(Config::MAIN_DSP_HLE_VOICE_THREADS);
+  if (thread_count > 0)
+    m_voice_workers = std::make_unique<AXVoiceWorkers>(std::min(thread_count, 8),
+                                                       std::span<const size_t>(), nullptr);
 }
 
 ZeldaAudioRenderer::~ZeldaAudioRenderer() = default;
@@ -1087,14 +1107,7 @@ void ZeldaAudioRenderer::ApplyReverb(bool post_rendering)
 
       auto ApplyFilter = [&]() {
         // Filter the buffer using provided coefficients.
-        for (u16 i = 0; i < 0x50; ++i)
-        {
-          s32 sample = 0;
-          for (u16 j = 0; j < 8; ++j)
-            sample += (s32)buffer[i + j] * rpb.filter_coeffs[j];
-          sample >>= 15;
-          buffer[i] = std::clamp(sample, -0x8000, 0x7FFF);
-        }
+        ZeldaMixing::Filter8(buffer.data(), 0x50, rpb.filter_coeffs);
       };
 
       // LSB set -> pre-filtering.
@@ -1183,7 +1196,52 @@ void ZeldaAudioRenderer::AddVoice(u16 voice_id)
 
   MixingBuffer input_samples;
   LoadInputSamples(&input_samples, &vpb);
+  MixVoice(voice_id, vpb, input_samples);
+}
+
+void ZeldaAudioRenderer::AddVoices(std::span<const u16> voice_ids)
+{
+  if (!m_voice_workers || voice_ids.size() < 2)
+  {
+    for (const u16 voice_id : voice_ids)
+      AddVoice(voice_id);
+    return;
+  }
+
+  // Mixing wraps around instead of saturating, but the input samples of a few voices depend on the
+  // mixing buffers. So only the loading, which is where most of the time goes, runs in parallel,
+  // and the voices are still mixed one after another in order.
+  m_prepared_voices.resize(voice_ids.size());
+  const std::function<void(size_t, size_t)> prepare = [&](size_t, size_t index) {
+    PreparedVoice& voice = m_prepared_voices[index];
+    FetchVPB(voice_ids[index], &voice.vpb);
+    voice.active = voice.vpb.enabled && !voice.vpb.done;
+    voice.loaded = voice.active && !ReadsMixingBuffers(voice.vpb);
+    if (voice.loaded)
+      LoadInputSamples(&voice.input_samples, &voice.vpb);
+  };
+  m_voice_workers->Run(voice_ids.size(), prepare);
 
+  for (size_t i = 0; i < voice_ids.size(); ++i)
+  {
+    PreparedVoice& voice = m_prepared_voices[i];
+    if (!voice.active)
+      continue;
+
+    if (!voice.loaded)
+      LoadInputSamples(&voice.input_samples, &voice.vpb);
+    MixVoice(voice_ids[i], voice.vpb, voice.input_samples);
+  }
+}
+
+bool ZeldaAudioRenderer::ReadsMixingBuffers(const VPB& vpb)
+{
+  return !vpb.use_constant_sample &&
+         vpb.samples_source_type == VPB::SRC_CONST_PATTERN_0_VARIABLE_STEP;
+}
+
+void ZeldaAudioRenderer::MixVoice(u16 voice_id, VPB& vpb, const MixingBuffer& input_samples)
+{
   // TODO: In place effects.
 
   // TODO: IIR filter.
@@ -1438,19 +1496,15 @@ void ZeldaAudioRenderer::LoadInputSamples(MixingBuffer* buffer, VPB* vpb)
   {
     const u16 PATTERN_SIZE = 0x40;
 
-    struct PatternInfo
-    {
-      u16 idx;
-      bool variable_step;
-    };
-    std::map<u16, PatternInfo> samples_source_to_pattern = {
-        {VPB::SRC_CONST_PATTERN_0, {0, false}}, {VPB::SRC_CONST_PATTERN_0_VARIABLE_STEP, {0, true}},
-        {VPB::SRC_CONST_PATTERN_1, {1, false}}, {VPB::SRC_CONST_PATTERN_2, {2, false}},
-        {VPB::SRC_CONST_PATTERN_3, {3, false}},
-    };
-    auto& pattern_info = samples_source_to_pattern[vpb->samples_source_type];
-    u16 pattern_offset = pattern_info.idx * PATTERN_SIZE;
-    s16* pattern = m_const_patterns.data() + pattern_offset;
+    u16 pattern_idx = 0;
+    if (vpb->samples_source_type == VPB::SRC_CONST_PATTERN_1)
+      pattern_idx = 1;
+    else if (vpb->samples_source_type == VPB::SRC_CONST_PATTERN_2)
+      pattern_idx = 2;
+    else if (vpb->samples_source_type == VPB::SRC_CONST_PATTERN_3)
+      pattern_idx = 3;
+    const bool variable_step = vpb->samples_source_type == VPB::SRC_CONST_PATTERN_0_VARIABLE_STEP;
+    s16* pattern = m_const_patterns.data() + pattern_idx * PATTERN_SIZE;
 
     u32 pos = vpb->current_pos_frac << 6;   // log2(PATTERN_SIZE)
     u32 step = vpb->resampling_ratio << 5;  // FIXME: ucode 24B22038 shifts by 6 (?)
@@ -1459,7 +1513,7 @@ void ZeldaAudioRenderer::LoadInputSamples(MixingBuffer* buffer, VPB* vpb)
     {
       (*buffer)[i] = pattern[pos >> 16];
       pos = (pos + step) % (PATTERN_SIZE << 16);
-      if (pattern_info.variable_step)
+      if (variable_step)
         pos = ((pos << 10) + m_buf_back_right[i] * vpb->resampling_ratio) >> 10;
     }
 
@@ -1519,25 +1573,13 @@ void ZeldaAudioRenderer::Resample(VPB* vpb, const s16* src, MixingBuffer* dst)
   }
   else
   {
-    for (auto& dst_sample : *dst)
-    {
-      // We have 0x40 * 4 coeffs that need to be selected based on the
-      // most significant bits of the fractional part of the position. 12
-      // bits >> 6 = 6 bits = 0x40. Multiply by 4 since there are 4
-      // consecutive coeffs.
-      u32 coeffs_idx = ((pos & 0xFFF) >> 6) * 4;
-      const s16* coeffs = &m_resampling_coeffs[coeffs_idx];
-      const s16* input = &src[pos >> 12];
-
-      s64 dst_sample_unclamped = 0;
-      for (size_t i = 0; i < 4; ++i)
-        dst_sample_unclamped += (s64)2 * coeffs[i] * input[i];
-      dst_sample_unclamped >>= 16;
-
-      dst_sample = (s16)std::clamp<s64>(dst_sample_unclamped, -0x8000, 0x7FFF);
-
-      pos += ratio;
-    }
+    // We have 0x40 * 4 coeffs that need to be selected based on the
+    // most significant bits of the fractional part of the position. 12
+    // bits >> 6 = 6 bits = 0x40. Multiply by 4 since there are 4
+    // consecutive coeffs.
+    ZeldaMixing::ResamplePolyphase(src, dst->data(), dst->size(), pos, ratio,
+                                   m_resampling_coeffs.data());
+    pos += static_cast<u32>(dst->size()) * ratio;
   }
 
   for (u32 i = 0; i < 4; ++i)
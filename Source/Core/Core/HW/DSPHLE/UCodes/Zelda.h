@@ -5,9 +5,13 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <span>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
 
 namespace Core
 {
@@ -16,6 +20,7 @@ class System;
 
 namespace DSP::HLE
 {
+class AXVoiceWorkers;
 class DSPHLE;
 
 class ZeldaAudioRenderer
@@ -30,6 +35,9 @@ public:
 
   void PrepareFrame();
   void AddVoice(u16 voice_id);
+  // Same as calling AddVoice for each voice in order, but loads the input samples of the voices on
+  // the voice workers if MAIN_DSP_HLE_VOICE_THREADS is set.
+  void AddVoices(std::span<const u16> voice_ids);
   void FinalizeFrame();
 
   void SetFlags(u32 flags) { m_flags = flags; }
@@ -58,13 +66,7 @@ private:
   template <size_t N, size_t B>
   void ApplyVolumeInPlace(std::array<s16, N>* buf, u16 vol)
   {
-    for (size_t i = 0; i < N; ++i)
-    {
-      s32 tmp = (u32)(*buf)[i] * (u32)vol;
-      tmp >>= 16 - B;
-
-      (*buf)[i] = (s16)std::clamp(tmp, -0x8000, 0x7FFF);
-    }
+    ZeldaMixing::ApplyVolume(buf->data(), N, vol, 16 - B);
   }
   template <size_t N>
   void ApplyVolumeInPlace_1_15(std::array<s16, N>* buf, u16 vol)
@@ -89,24 +91,14 @@ private:
     if (!vol && !step)
       return vol;
 
-    for (size_t i = 0; i < N; ++i)
-    {
-      (*dst)[i] += ((vol >> 16) * src[i]) >> 16;
-      vol += step;
-    }
-
-    return vol;
+    return ZeldaMixing::AddWithVolumeRamp(dst->data(), src.data(), N, vol, step);
   }
 
   // Does not use std::array because it needs to be able to process partial
   // buffers. Volume is in 1.15 format.
   void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
   {
-    while (count--)
-    {
-      s32 vol_src = ((s32)*src++ * (s32)vol) >> 15;
-      *dst++ += std::clamp(vol_src, -0x8000, 0x7FFF);
-    }
+    ZeldaMixing::AddWithVolume(dst, src, count, vol);
   }
 
   // Whether the frame needs to be prepared or not.
@@ -139,6 +131,18 @@ private:
   // buffers. Returns nullptr if no match is found.
   MixingBuffer* BufferForID(u16 buffer_id);
 
+  // Everything AddVoice does once the input samples of the voice are loaded.
+  void MixVoice(u16 voice_id, VPB& vpb, const MixingBuffer& input_samples);
+
+  // Whether loading the input samples of the voice reads the mixing buffers, which makes them
+  // depend on the voices mixed before it.
+  static bool ReadsMixingBuffers(const VPB& vpb);
+
+  // Only set up when MAIN_DSP_HLE_VOICE_THREADS is enabled.
+  std::unique_ptr<AXVoiceWorkers> m_voice_workers;
+  struct PreparedVoice;
+  std::vector<PreparedVoice> m_prepared_voices;
+
   // Base address where VPBs are stored linearly in RAM.
   u32 m_vpb_base_addr;
   void FetchVPB(u16 voice_id, VPB* vpb);
@@ -290,6 +294,8 @@ private:
     return m_rendering_curr_frame != m_rendering_requested_frames;
   }
   void RenderAudio();
+  // The voices which RenderAudio is about to render.
+  std::vector<u16> m_batched_voices;
 
   // Main object handling audio rendering logic and state.
   ZeldaAudioRenderer m_renderer;
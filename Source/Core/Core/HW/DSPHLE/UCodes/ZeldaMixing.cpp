@@ -0,0 +1,363 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
+
+#include <algorithm>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE::ZeldaMixing
+{
+namespace
+{
+s16 ScaleSample(s16 sample, u16 volume, u32 shift)
+{
+  // A sample times a volume always fits in 32 bits.
+  return static_cast<s16>(std::clamp((s32(sample) * s32(volume)) >> shift, -0x8000, 0x7FFF));
+}
+
+s16 InterpolatePolyphase(const s16* input, u32 pos, const s16* coeffs)
+{
+  const s16* t = &input[pos >> 12];
+  const s16* c = &coeffs[((pos & 0xFFF) >> 6) * 4];
+  const s64 sample = s64(t[0]) * c[0] + s64(t[1]) * c[1] + s64(t[2]) * c[2] + s64(t[3]) * c[3];
+  return static_cast<s16>(std::clamp<s64>(sample >> 15, -0x8000, 0x7FFF));
+}
+
+s16 FilterSample(const s16* input, const s16* coeffs)
+{
+  // The sum wraps around like the 32 bit accumulator of the UCode.
+  u32 sum = 0;
+  for (u32 i = 0; i < 8; ++i)
+    sum += static_cast<u32>(s32(input[i]) * coeffs[i]);
+  return static_cast<s16>(std::clamp(static_cast<s32>(sum) >> 15, -0x8000, 0x7FFF));
+}
+
+#if defined(_M_X86_64)
+// Multiplies 8 samples by an unsigned 16 bit volume, shifts the products right and clamps them.
+// The signed multiply treats volumes of 0x8000 and more as negative, which only makes the high
+// halves of the products smaller by the sample.
+__m128i ScaleSSE2(__m128i samples, __m128i volume, bool high_volume, __m128i shift)
+{
+  const __m128i low = _mm_mullo_epi16(samples, volume);
+  __m128i high = _mm_mulhi_epi16(samples, volume);
+  if (high_volume)
+    high = _mm_add_epi16(high, samples);
+
+  const __m128i p0 = _mm_sra_epi32(_mm_unpacklo_epi16(low, high), shift);
+  const __m128i p1 = _mm_sra_epi32(_mm_unpackhi_epi16(low, high), shift);
+  return _mm_packs_epi32(p0, p1);
+}
+
+// Returns the sums of the lanes of each of the 4 vectors.
+__m128i SumLanesSSE2(const __m128i (&v)[4])
+{
+  const __m128i s01 = _mm_add_epi32(_mm_unpacklo_epi32(v[0], v[1]), _mm_unpackhi_epi32(v[0], v[1]));
+  const __m128i s23 = _mm_add_epi32(_mm_unpacklo_epi32(v[2], v[3]), _mm_unpackhi_epi32(v[2], v[3]));
+  return _mm_add_epi32(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+}
+
+size_t ApplyVolumeSSE2(s16* buffer, size_t count, u16 volume, u32 shift)
+{
+  const __m128i volumes = _mm_set1_epi16(static_cast<s16>(volume));
+  const __m128i shift_count = _mm_cvtsi32_si128(static_cast<int>(shift));
+  const bool high_volume = volume >= 0x8000;
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* samples = reinterpret_cast<__m128i*>(buffer + i);
+    _mm_storeu_si128(samples,
+                     ScaleSSE2(_mm_loadu_si128(samples), volumes, high_volume, shift_count));
+  }
+  return i;
+}
+
+size_t AddWithVolumeSSE2(s16* dst, const s16* src, size_t count, u16 volume)
+{
+  const __m128i volumes = _mm_set1_epi16(static_cast<s16>(volume));
+  const __m128i shift_count = _mm_cvtsi32_si128(15);
+  const bool high_volume = volume >= 0x8000;
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i* dest = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(dest, _mm_add_epi16(_mm_loadu_si128(dest),
+                                         ScaleSSE2(samples, volumes, high_volume, shift_count)));
+  }
+  return i;
+}
+
+size_t AddWithVolumeRampSSE2(s16* dst, const s16* src, size_t count, u32 volume, u32 step)
+{
+  __m128i volumes0 = _mm_setr_epi32(static_cast<int>(volume), static_cast<int>(volume + step),
+                                    static_cast<int>(volume + 2 * step),
+                                    static_cast<int>(volume + 3 * step));
+  __m128i volumes1 = _mm_add_epi32(volumes0, _mm_set1_epi32(static_cast<int>(4 * step)));
+  const __m128i advance = _mm_set1_epi32(static_cast<int>(8 * step));
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i volumes =
+        _mm_packs_epi32(_mm_srai_epi32(volumes0, 16), _mm_srai_epi32(volumes1, 16));
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i* dest = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(dest, _mm_add_epi16(_mm_loadu_si128(dest), _mm_mulhi_epi16(volumes, samples)));
+
+    volumes0 = _mm_add_epi32(volumes0, advance);
+    volumes1 = _mm_add_epi32(volumes1, advance);
+  }
+  return i;
+}
+
+size_t ResamplePolyphaseSSE2(const s16* input, s16* output, size_t count, u32 pos, u32 ratio,
+                             const s16* coeffs)
+{
+  const __m128i low_mask = _mm_set1_epi32(0x7FFF);
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i high[4];
+    __m128i low[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      const __m128i taps = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&input[pos >> 12]));
+      const __m128i c =
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&coeffs[((pos & 0xFFF) >> 6) * 4]));
+      const __m128i products =
+          _mm_unpacklo_epi16(_mm_mullo_epi16(taps, c), _mm_mulhi_epi16(taps, c));
+      // The sum of the four products doesn't always fit in 32 bits, so the bits above and below
+      // the shift are summed separately.
+      high[j] = _mm_srai_epi32(products, 15);
+      low[j] = _mm_and_si128(products, low_mask);
+      pos += ratio;
+    }
+
+    const __m128i result =
+        _mm_add_epi32(SumLanesSSE2(high), _mm_srai_epi32(SumLanesSSE2(low), 15));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(result, result));
+  }
+  return i;
+}
+
+size_t Filter8SSE2(s16* buffer, size_t count, const s16* coeffs)
+{
+  const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coeffs));
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    // All inputs are loaded before the outputs overwrite the first of them.
+    __m128i sums[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&buffer[i + j]));
+      sums[j] = _mm_madd_epi16(input, c);
+    }
+
+    const __m128i result = _mm_srai_epi32(SumLanesSSE2(sums), 15);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(buffer + i), _mm_packs_epi32(result, result));
+  }
+  return i;
+}
+#elif defined(_M_ARM_64)
+int16x8_t ScaleNEON(int16x8_t samples, int32x4_t volume, int32x4_t shift)
+{
+  const int32x4_t low = vshlq_s32(vmulq_s32(vmovl_s16(vget_low_s16(samples)), volume), shift);
+  const int32x4_t high = vshlq_s32(vmulq_s32(vmovl_high_s16(samples), volume), shift);
+  return vcombine_s16(vqmovn_s32(low), vqmovn_s32(high));
+}
+
+int32x4_t SumLanesNEON(const int32x4_t (&v)[4])
+{
+  return vpaddq_s32(vpaddq_s32(v[0], v[1]), vpaddq_s32(v[2], v[3]));
+}
+
+size_t ApplyVolumeNEON(s16* buffer, size_t count, u16 volume, u32 shift)
+{
+  const int32x4_t volumes = vdupq_n_s32(volume);
+  // Shifting left by a negative count shifts right.
+  const int32x4_t shift_count = vdupq_n_s32(-static_cast<s32>(shift));
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+    vst1q_s16(buffer + i, ScaleNEON(vld1q_s16(buffer + i), volumes, shift_count));
+  return i;
+}
+
+size_t AddWithVolumeNEON(s16* dst, const s16* src, size_t count, u16 volume)
+{
+  const int32x4_t volumes = vdupq_n_s32(volume);
+  const int32x4_t shift_count = vdupq_n_s32(-15);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t mixed = ScaleNEON(vld1q_s16(src + i), volumes, shift_count);
+    vst1q_s16(dst + i, vaddq_s16(vld1q_s16(dst + i), mixed));
+  }
+  return i;
+}
+
+size_t AddWithVolumeRampNEON(s16* dst, const s16* src, size_t count, u32 volume, u32 step)
+{
+  alignas(16) static constexpr u32 lanes[4] = {0, 1, 2, 3};
+  uint32x4_t volumes0 = vmlaq_n_u32(vdupq_n_u32(volume), vld1q_u32(lanes), step);
+  uint32x4_t volumes1 = vaddq_u32(volumes0, vdupq_n_u32(4 * step));
+  const uint32x4_t advance = vdupq_n_u32(8 * step);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x4_t volume_low = vshrn_n_s32(vreinterpretq_s32_u32(volumes0), 16);
+    const int16x4_t volume_high = vshrn_n_s32(vreinterpretq_s32_u32(volumes1), 16);
+    const int16x8_t samples = vld1q_s16(src + i);
+    const int16x8_t mixed =
+        vcombine_s16(vshrn_n_s32(vmull_s16(volume_low, vget_low_s16(samples)), 16),
+                     vshrn_n_s32(vmull_s16(volume_high, vget_high_s16(samples)), 16));
+    vst1q_s16(dst + i, vaddq_s16(vld1q_s16(dst + i), mixed));
+
+    volumes0 = vaddq_u32(volumes0, advance);
+    volumes1 = vaddq_u32(volumes1, advance);
+  }
+  return i;
+}
+
+size_t ResamplePolyphaseNEON(const s16* input, s16* output, size_t count, u32 pos, u32 ratio,
+                             const s16* coeffs)
+{
+  const int32x4_t low_mask = vdupq_n_s32(0x7FFF);
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    int32x4_t high[4];
+    int32x4_t low[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      const int16x4_t taps = vld1_s16(&input[pos >> 12]);
+      const int16x4_t c = vld1_s16(&coeffs[((pos & 0xFFF) >> 6) * 4]);
+      const int32x4_t products = vmull_s16(taps, c);
+      // The sum of the four products doesn't always fit in 32 bits, so the bits above and below
+      // the shift are summed separately.
+      high[j] = vshrq_n_s32(products, 15);
+      low[j] = vandq_s32(products, low_mask);
+      pos += ratio;
+    }
+
+    const int32x4_t result = vaddq_s32(SumLanesNEON(high), vshrq_n_s32(SumLanesNEON(low), 15));
+    vst1_s16(output + i, vqmovn_s32(result));
+  }
+  return i;
+}
+
+size_t Filter8NEON(s16* buffer, size_t count, const s16* coeffs)
+{
+  const int16x8_t c = vld1q_s16(coeffs);
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    // All inputs are loaded before the outputs overwrite the first of them.
+    int32x4_t sums[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      const int16x8_t input = vld1q_s16(&buffer[i + j]);
+      sums[j] = vaddq_s32(vmull_s16(vget_low_s16(input), vget_low_s16(c)),
+                          vmull_high_s16(input, c));
+    }
+
+    vst1_s16(buffer + i, vqmovn_s32(vshrq_n_s32(SumLanesNEON(sums), 15)));
+  }
+  return i;
+}
+#endif
+}  // namespace
+
+void ApplyVolume(s16* buffer, size_t count, u16 volume, u32 shift)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  i = ApplyVolumeSSE2(buffer, count, volume, shift);
+#elif defined(_M_ARM_64)
+  i = ApplyVolumeNEON(buffer, count, volume, shift);
+#endif
+
+  for (; i < count; ++i)
+    buffer[i] = ScaleSample(buffer[i], volume, shift);
+}
+
+void AddWithVolume(s16* dst, const s16* src, size_t count, u16 volume)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  i = AddWithVolumeSSE2(dst, src, count, volume);
+#elif defined(_M_ARM_64)
+  i = AddWithVolumeNEON(dst, src, count, volume);
+#endif
+
+  for (; i < count; ++i)
+    dst[i] += ScaleSample(src[i], volume, 15);
+}
+
+s32 AddWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 volume, s32 step)
+{
+  // The volume wraps around instead of overflowing.
+  const u32 start_volume = static_cast<u32>(volume);
+  const u32 volume_step = static_cast<u32>(step);
+
+  size_t i = 0;
+#if defined(_M_X86_64)
+  i = AddWithVolumeRampSSE2(dst, src, count, start_volume, volume_step);
+#elif defined(_M_ARM_64)
+  i = AddWithVolumeRampNEON(dst, src, count, start_volume, volume_step);
+#endif
+
+  u32 curr_volume = start_volume + static_cast<u32>(i) * volume_step;
+  for (; i < count; ++i)
+  {
+    dst[i] += (s32(static_cast<s32>(curr_volume) >> 16) * src[i]) >> 16;
+    curr_volume += volume_step;
+  }
+  return static_cast<s32>(curr_volume);
+}
+
+void ResamplePolyphase(const s16* input, s16* output, size_t count, u32 pos, u32 ratio,
+                       const s16* coeffs)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  i = ResamplePolyphaseSSE2(input, output, count, pos, ratio, coeffs);
+#elif defined(_M_ARM_64)
+  i = ResamplePolyphaseNEON(input, output, count, pos, ratio, coeffs);
+#endif
+
+  for (pos += static_cast<u32>(i) * ratio; i < count; ++i)
+  {
+    output[i] = InterpolatePolyphase(input, pos, coeffs);
+    pos += ratio;
+  }
+}
+
+void Filter8(s16* buffer, size_t count, const s16* coeffs)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  i = Filter8SSE2(buffer, count, coeffs);
+#elif defined(_M_ARM_64)
+  i = Filter8NEON(buffer, count, coeffs);
+#endif
+
+  for (; i < count; ++i)
+    buffer[i] = FilterSample(&buffer[i], coeffs);
+}
+}  // namespace DSP::HLE::ZeldaMixing
@@ -0,0 +1,34 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Per-sample loops of the Zelda UCode renderer. Like AXMixing, they use SIMD where the host
+// supports it, and give exactly the same results as the scalar integer math on every host. Sums of
+// samples wrap around, like they do on the DSP.
+namespace DSP::HLE::ZeldaMixing
+{
+// Sets every sample to (sample * volume) >> shift, clamped to 16 bits.
+void ApplyVolume(s16* buffer, size_t count, u16 volume, u32 shift);
+
+// Adds (src * volume) >> 15, clamped to 16 bits, to dst. volume is in 1.15 format.
+void AddWithVolume(s16* dst, const s16* src, size_t count, u16 volume);
+
+// Adds ((volume >> 16) * src) >> 16 to dst, increasing volume by step after every sample. Returns
+// the volume after the last sample.
+s32 AddWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 volume, s32 step);
+
+// Resamples input into count output samples with the 4 tap filter selected by the top 6 bits of
+// the fraction of the position. pos and ratio are 20.12 fixed point, and pos is the position of the
+// first output sample. coeffs points to 0x40 * 4 coefficients.
+void ResamplePolyphase(const s16* input, s16* output, size_t count, u32 pos, u32 ratio,
+                       const s16* coeffs);
+
+// Applies the 8 tap FIR filter of the reverb in place: buffer[i] becomes the sum of
+// buffer[i + j] * coeffs[j] >> 15, clamped to 16 bits. buffer must hold count + 7 samples.
+void Filter8(s16* buffer, size_t count, const s16* coeffs);
+}  // namespace DSP::HLE::ZeldaMixing
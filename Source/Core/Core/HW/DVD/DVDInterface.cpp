@@ -257,6 +257,7 @@ void DVDInterface::Init()
   ASSERT(!IsDiscInside());
 
   m_system.GetDVDThread().Start();
+  m_config.Init(&LoadConfig);
 
   m_DISR.Hex = 0;
   m_DICVR.Hex = 1;  // Disc Channel relies on cover being open when no disc is inserted
@@ -330,9 +331,16 @@ void DVDInterface::ResetDrive(bool spinup)
 
 void DVDInterface::Shutdown()
 {
+  m_config.Shutdown();
   m_system.GetDVDThread().Stop();
 }
 
+void DVDInterface::LoadConfig(ConfigValues& values)
+{
+  values.fast_disc_speed = Config::Get(Config::MAIN_FAST_DISC_SPEED);
+  values.auto_disc_change = Config::Get(Config::MAIN_AUTO_DISC_CHANGE);
+}
+
 static u64 GetDiscEndOffset(const DiscIO::VolumeDisc& disc)
 {
   u64 size = disc.GetDataSize();
@@ -1086,7 +1094,7 @@ void DVDInterface::ExecuteCommand(ReplyType reply_type)
 
     const bool force_eject = eject && !kill;
 
-    if (Config::Get(Config::MAIN_AUTO_DISC_CHANGE) && !m_system.GetMovie().IsPlayingInput() &&
+    if (m_config->auto_disc_change && !m_system.GetMovie().IsPlayingInput() &&
         m_system.GetDVDThread().IsInsertedDiscRunning() && !m_auto_disc_change_paths.empty())
     {
       m_system.GetCoreTiming().ScheduleEvent(
@@ -1344,7 +1352,7 @@ void DVDInterface::ScheduleReads(u64 offset, u32 length, const DiscIO::Partition
   dvd_offset = Common::AlignDown(dvd_offset, DVD_ECC_BLOCK_SIZE);
   const u64 first_block = dvd_offset;
 
-  if (Config::Get(Config::MAIN_FAST_DISC_SPEED))
+  if (m_config->fast_disc_speed)
   {
     // The SUDTR setting makes us act as if all reads are buffered
     buffer_start = std::numeric_limits<u64>::min();
@@ -11,6 +11,8 @@
 
 #include "Common/BitField.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/ConfigSnapshot.h"
+#include "Core/CPUThreadConfigCallback.h"
 
 #include "Core/HW/StreamADPCM.h"
 
@@ -301,6 +303,15 @@ private:
   CoreTiming::EventType* m_eject_disc = nullptr;
   CoreTiming::EventType* m_insert_disc = nullptr;
 
+  // Read for every disc read.
+  struct ConfigValues
+  {
+    bool fast_disc_speed;
+    bool auto_disc_change;
+  };
+  static void LoadConfig(ConfigValues& values);
+  Config::Snapshot<ConfigValues, CPUThreadConfigCallback::Callbacks> m_config;
+
   Core::System& m_system;
 };
 }  // namespace DVD
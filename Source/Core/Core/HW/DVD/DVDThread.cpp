@@ -3,6 +3,8 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -36,6 +38,15 @@
 
 namespace DVD
 {
+// How many reads ahead of the game the DVD thread reads once it has detected a pattern.
+static constexpr u32 PREFETCH_DEPTH = 4;
+// Larger reads are usually one-off loads of whole files, which aren't worth reading ahead.
+static constexpr u32 MAX_PREFETCH_LENGTH = 0x100000;
+static constexpr u32 MIN_SEQUENTIAL_PREFETCH_LENGTH = 0x8000;
+static constexpr size_t MAX_PREFETCH_CACHE_SIZE = 16 * 0x100000;
+// About 1.2 seconds of 48 kHz streamed audio.
+static constexpr u32 DTK_BLOCK_SIZE = 0x10000;
+
 DVDThread::DVDThread(Core::System& system) : m_system(system)
 {
 }
@@ -69,6 +80,7 @@ void DVDThread::Stop()
 {
   StopDVDThread();
   m_disc.reset();
+  ClearPrefetchCache();
 }
 
 void DVDThread::StopDVDThread()
@@ -132,6 +144,7 @@ void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   m_disc = std::move(disc);
+  ClearPrefetchCache();
 }
 
 bool DVDThread::HasDisc() const
@@ -252,6 +265,17 @@ void DVDThread::StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_
   core_timing.ScheduleEvent(ticks_until_completion, m_finish_read, id);
 }
 
+DVDThreadStats DVDThread::GetStats() const
+{
+  DVDThreadStats stats;
+  stats.prefetch_hits = m_prefetch_hits.load(std::memory_order_relaxed);
+  stats.prefetch_misses = m_prefetch_misses.load(std::memory_order_relaxed);
+  stats.bytes_prefetched = m_bytes_prefetched.load(std::memory_order_relaxed);
+  stats.read_stalls = m_read_stalls.load(std::memory_order_relaxed);
+  stats.read_stall_us = m_read_stall_us.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void DVDThread::GlobalFinishRead(Core::System& system, u64 id, s64 cycles_late)
 {
   system.GetDVDThread().FinishRead(id, cycles_late);
@@ -280,8 +304,18 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
   {
     while (true)
     {
-      while (!m_result_queue.Pop(result))
-        m_result_queue_expanded.Wait();
+      if (!m_result_queue.Pop(result))
+      {
+        const u64 stall_start_us = Common::Timer::NowUs();
+        do
+        {
+          m_result_queue_expanded.Wait();
+        } while (!m_result_queue.Pop(result));
+
+        m_read_stalls.fetch_add(1, std::memory_order_relaxed);
+        m_read_stall_us.fetch_add(Common::Timer::NowUs() - stall_start_us,
+                                  std::memory_order_relaxed);
+      }
 
       if (result.first.id == id)
         break;
@@ -345,8 +379,27 @@ void DVDThread::DVDThreadMain()
       m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
+      if (request.reply_type == ReplyType::DTK && request.partition == DiscIO::PARTITION_NONE)
+      {
+        if (!ReadDTK(request.dvd_offset, request.length, buffer.data()))
+          buffer.resize(0);
+      }
+      else
+      {
+        if (ReadFromPrefetchCache(request.dvd_offset, request.length, request.partition,
+                                  buffer.data()))
+        {
+          m_prefetch_hits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+          m_prefetch_misses.fetch_add(1, std::memory_order_relaxed);
+          if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+            buffer.resize(0);
+        }
+
+        UpdateAccessPattern(request.dvd_offset, request.length, request.partition);
+      }
 
       request.realtime_done_us = Common::Timer::NowUs();
 
@@ -356,6 +409,168 @@ void DVDThread::DVDThreadMain()
       if (m_dvd_thread_exiting.IsSet())
         return;
     }
+
+    // Only read ahead while there's nothing else to do. If a request arrives in the meantime,
+    // request_queue_expanded is set, so it gets handled as soon as the current block is read.
+    Prefetch();
   }
 }
+
+const DVDThread::PrefetchBlock* DVDThread::FindPrefetchBlock(u64 dvd_offset, u32 length,
+                                                             const DiscIO::Partition& partition)
+{
+  const auto it =
+      std::find_if(m_prefetch_cache.begin(), m_prefetch_cache.end(), [&](const PrefetchBlock& b) {
+        return b.partition == partition && b.dvd_offset <= dvd_offset &&
+               dvd_offset + length <= b.dvd_offset + b.data.size();
+      });
+  return it != m_prefetch_cache.end() ? &*it : nullptr;
+}
+
+bool DVDThread::ReadFromPrefetchCache(u64 dvd_offset, u32 length,
+                                      const DiscIO::Partition& partition, u8* buffer)
+{
+  const PrefetchBlock* block = FindPrefetchBlock(dvd_offset, length, partition);
+  if (!block)
+    return false;
+
+  std::memcpy(buffer, block->data.data() + (dvd_offset - block->dvd_offset), length);
+  return true;
+}
+
+void DVDThread::UpdateAccessPattern(u64 dvd_offset, u32 length,
+                                    const DiscIO::Partition& partition)
+{
+  const bool same_partition = partition == m_last_read_partition;
+  const bool sequential = same_partition && dvd_offset == m_last_read_offset + m_last_read_length;
+  const u64 stride = dvd_offset - m_last_read_offset;
+  const bool strided = same_partition && dvd_offset > m_last_read_offset &&
+                       length == m_last_read_length && stride == m_last_read_stride;
+
+  if ((sequential || strided) && length != 0 && length <= MAX_PREFETCH_LENGTH)
+  {
+    // Games streaming a file often read it in small pieces, so sequential access is read ahead
+    // in larger blocks. Strided access only reads the parts the game is expected to need.
+    m_prefetch_partition = partition;
+    m_prefetch_length = sequential ? std::max(length, MIN_SEQUENTIAL_PREFETCH_LENGTH) : length;
+    m_prefetch_stride = sequential ? m_prefetch_length : stride;
+    m_prefetch_offset = sequential ? dvd_offset + length : dvd_offset + stride;
+    m_prefetch_remaining = PREFETCH_DEPTH;
+  }
+  else
+  {
+    m_prefetch_remaining = 0;
+  }
+
+  m_last_read_partition = partition;
+  m_last_read_offset = dvd_offset;
+  m_last_read_length = length;
+  m_last_read_stride = stride;
+}
+
+bool DVDThread::ReadDTK(u64 dvd_offset, u32 length, u8* buffer)
+{
+  // Blocks the stream has played past won't be needed again, unless the game restarts the track.
+  while (!m_dtk_blocks.empty() &&
+         m_dtk_blocks.front().dvd_offset + m_dtk_blocks.front().data.size() <= dvd_offset)
+  {
+    m_dtk_blocks.pop_front();
+  }
+
+  const auto find_block = [&] {
+    return std::find_if(m_dtk_blocks.begin(), m_dtk_blocks.end(), [&](const PrefetchBlock& b) {
+      return b.dvd_offset <= dvd_offset && dvd_offset + length <= b.dvd_offset + b.data.size();
+    });
+  };
+
+  auto it = find_block();
+  if (it != m_dtk_blocks.end())
+  {
+    m_prefetch_hits.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    // The stream jumped to another track, or read across the end of the buffered data.
+    m_prefetch_misses.fetch_add(1, std::memory_order_relaxed);
+    m_dtk_blocks.clear();
+    if (!ReadDTKBlock(dvd_offset) || (it = find_block()) == m_dtk_blocks.end())
+    {
+      // The block may extend past the end of the disc, even if the read itself doesn't.
+      m_dtk_blocks.clear();
+      m_dtk_prefetch_offset.reset();
+      return m_disc->Read(dvd_offset, length, buffer, DiscIO::PARTITION_NONE);
+    }
+  }
+
+  std::memcpy(buffer, it->data.data() + (dvd_offset - it->dvd_offset), length);
+
+  // Once the stream has reached the last buffered block, read the next one while idle.
+  const PrefetchBlock& last = m_dtk_blocks.back();
+  if (&*it == &last)
+    m_dtk_prefetch_offset = last.dvd_offset + last.data.size();
+
+  return true;
+}
+
+bool DVDThread::ReadDTKBlock(u64 dvd_offset)
+{
+  std::vector<u8> buffer(DTK_BLOCK_SIZE);
+  if (!m_disc->Read(dvd_offset, DTK_BLOCK_SIZE, buffer.data(), DiscIO::PARTITION_NONE))
+    return false;
+
+  m_dtk_blocks.push_back({DiscIO::PARTITION_NONE, dvd_offset, std::move(buffer)});
+  return true;
+}
+
+void DVDThread::Prefetch()
+{
+  if (m_dtk_prefetch_offset && m_request_queue.Empty())
+  {
+    const u64 offset = *m_dtk_prefetch_offset;
+    m_dtk_prefetch_offset.reset();
+    if (ReadDTKBlock(offset))
+      m_bytes_prefetched.fetch_add(DTK_BLOCK_SIZE, std::memory_order_relaxed);
+  }
+
+  while (m_prefetch_remaining != 0 && m_request_queue.Empty() && !m_dvd_thread_exiting.IsSet())
+  {
+    const u64 offset = m_prefetch_offset;
+    m_prefetch_offset += m_prefetch_stride;
+    m_prefetch_remaining--;
+
+    if (FindPrefetchBlock(offset, m_prefetch_length, m_prefetch_partition))
+      continue;
+
+    // Reading past the end of the disc fails, and so will everything after it.
+    std::vector<u8> buffer(m_prefetch_length);
+    if (!m_disc->Read(offset, m_prefetch_length, buffer.data(), m_prefetch_partition))
+    {
+      m_prefetch_remaining = 0;
+      return;
+    }
+
+    m_bytes_prefetched.fetch_add(buffer.size(), std::memory_order_relaxed);
+    m_prefetch_cache_size += buffer.size();
+    m_prefetch_cache.push_back({m_prefetch_partition, offset, std::move(buffer)});
+
+    while (m_prefetch_cache_size > MAX_PREFETCH_CACHE_SIZE)
+    {
+      m_prefetch_cache_size -= m_prefetch_cache.front().data.size();
+      m_prefetch_cache.pop_front();
+    }
+  }
+}
+
+void DVDThread::ClearPrefetchCache()
+{
+  m_prefetch_cache.clear();
+  m_prefetch_cache_size = 0;
+  m_dtk_blocks.clear();
+  m_dtk_prefetch_offset.reset();
+  m_last_read_partition = {};
+  m_last_read_offset = 0;
+  m_last_read_length = 0;
+  m_last_read_stride = 0;
+  m_prefetch_remaining = 0;
+}
 }  // namespace DVD
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <optional>
@@ -50,6 +52,18 @@ namespace DVD
 {
 enum class ReplyType : u32;
 
+struct DVDThreadStats
+{
+  // Reads which were entirely served from data that was read ahead of time.
+  u64 prefetch_hits = 0;
+  // Reads which had to wait for the blob reader.
+  u64 prefetch_misses = 0;
+  u64 bytes_prefetched = 0;
+  // Times the CPU thread had to wait for the DVD thread to finish a read, and for how long.
+  u64 read_stalls = 0;
+  u64 read_stall_us = 0;
+};
+
 class DVDThread
 {
 public:
@@ -86,6 +100,9 @@ public:
                               const DiscIO::Partition& partition, DVD::ReplyType reply_type,
                               s64 ticks_until_completion);
 
+  // Safe to call from any thread.
+  DVDThreadStats GetStats() const;
+
 private:
   void StartDVDThread();
   void StopDVDThread();
@@ -100,6 +117,19 @@ private:
 
   void DVDThreadMain();
 
+  struct PrefetchBlock;
+
+  // Only called on the DVD thread.
+  const PrefetchBlock* FindPrefetchBlock(u64 dvd_offset, u32 length,
+                                         const DiscIO::Partition& partition);
+  bool ReadFromPrefetchCache(u64 dvd_offset, u32 length, const DiscIO::Partition& partition,
+                             u8* buffer);
+  void UpdateAccessPattern(u64 dvd_offset, u32 length, const DiscIO::Partition& partition);
+  bool ReadDTK(u64 dvd_offset, u32 length, u8* buffer);
+  bool ReadDTKBlock(u64 dvd_offset);
+  void Prefetch();
+  void ClearPrefetchCache();
+
   struct ReadRequest
   {
     bool copy_to_ram = false;
@@ -141,6 +171,42 @@ private:
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
+  // Data read ahead of time by the DVD thread, oldest first. Compressed formats like WIA/RVZ and
+  // GCZ have to decompress a whole chunk for any read within it, so it's much cheaper to read it
+  // while the DVD thread would otherwise be idle than when the game is waiting for it.
+  struct PrefetchBlock
+  {
+    DiscIO::Partition partition;
+    u64 dvd_offset = 0;
+    std::vector<u8> data;
+  };
+  std::deque<PrefetchBlock> m_prefetch_cache;
+  size_t m_prefetch_cache_size = 0;
+
+  // The last read, for detecting sequential and strided access.
+  DiscIO::Partition m_last_read_partition{};
+  u64 m_last_read_offset = 0;
+  u32 m_last_read_length = 0;
+  u64 m_last_read_stride = 0;
+
+  // The next reads the game is predicted to make.
+  DiscIO::Partition m_prefetch_partition{};
+  u64 m_prefetch_offset = 0;
+  u32 m_prefetch_length = 0;
+  u64 m_prefetch_stride = 0;
+  u32 m_prefetch_remaining = 0;
+
+  // Streamed audio is read in tiny pieces every few ms, interleaved with the reads of the game,
+  // so it gets a read-ahead buffer of its own. It's kept one block ahead of the stream.
+  std::deque<PrefetchBlock> m_dtk_blocks;
+  std::optional<u64> m_dtk_prefetch_offset;
+
+  std::atomic<u64> m_prefetch_hits = 0;
+  std::atomic<u64> m_prefetch_misses = 0;
+  std::atomic<u64> m_bytes_prefetched = 0;
+  std::atomic<u64> m_read_stalls = 0;
+  std::atomic<u64> m_read_stall_us = 0;
+
   FileMonitor::FileLogger m_file_logger;
 
   Core::System& m_system;
@@ -3,6 +3,7 @@
 
 #include "Core/HW/EXI/BBA/BuiltIn.h"
 
+#include <algorithm>
 #include <bit>
 
 #ifdef _WIN32
@@ -29,6 +30,12 @@ u64 GetTickCountStd()
   return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 }
 
+u64 GetTickCountUs()
+{
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
 std::vector<u8> BuildFINFrame(StackRef* ref)
 {
   const Common::TCPPacket result(ref->bba_mac, ref->my_mac, ref->from, ref->to, ref->seq_num,
@@ -125,6 +132,7 @@ bool CEXIETHERNET::BuiltInBBAInterface::IsActivated()
 void CEXIETHERNET::BuiltInBBAInterface::WriteToQueue(const std::vector<u8>& data)
 {
   m_queue_data[m_queue_write] = data;
+  m_queue_time_us[m_queue_write] = GetTickCountUs();
   const u8 next_write_index = (m_queue_write + 1) & 15;
   if (next_write_index != m_queue_read)
     m_queue_write = next_write_index;
@@ -602,6 +610,7 @@ const Common::MACAddress& CEXIETHERNET::BuiltInBBAInterface::ResolveAddress(u32
 bool CEXIETHERNET::BuiltInBBAInterface::SendFrame(const u8* frame, u32 size)
 {
   std::lock_guard<std::mutex> lock(m_mtx);
+  ++m_stats_frames_sent;
   const Common::PacketView view(frame, size);
 
   const std::optional<u16> ethertype = view.GetEtherType();
@@ -694,27 +703,88 @@ bool CEXIETHERNET::BuiltInBBAInterface::SendFrame(const u8* frame, u32 size)
   return true;
 }
 
+void CEXIETHERNET::BuiltInBBAInterface::WaitForSocketData(sf::SocketSelector& selector)
+{
+  // Waiting on the sockets instead of sleeping delivers frames from the network as soon as they
+  // arrive. The timeout still bounds how long frames queued by SendFrame and TCP resends wait.
+  constexpr auto timeout = std::chrono::milliseconds(1);
+
+  selector.clear();
+  bool has_sockets = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto& net_ref : m_network_ref)
+    {
+      if (net_ref.ip == 0)
+        continue;
+      has_sockets = true;
+      if (net_ref.type == IPPROTO_UDP)
+      {
+        selector.add(net_ref.udp_socket);
+      }
+      else if (net_ref.type == IPPROTO_TCP)
+      {
+        // Without a free buffer the data isn't read, which would make the wait return right away.
+        const auto& buffers = net_ref.tcp_buffers;
+        if (std::any_of(buffers.begin(), buffers.end(), [](const auto& buf) { return !buf.used; }))
+          selector.add(net_ref.tcp_socket);
+      }
+    }
+    if (m_upnp_httpd.getLocalPort() != 0)
+    {
+      selector.add(m_upnp_httpd);
+      has_sockets = true;
+    }
+  }
+
+  // select() fails right away without any sockets on Windows.
+  if (has_sockets)
+    selector.wait(sf::microseconds(std::chrono::microseconds(timeout).count()));
+  else
+    std::this_thread::sleep_for(timeout);
+}
+
+void CEXIETHERNET::BuiltInBBAInterface::UpdateStats()
+{
+  const u64 now = GetTickCountStd();
+  if (now - m_stats_time < 1000)
+    return;
+
+  if (m_stats_frames_sent != 0 || m_stats_frames_received != 0)
+  {
+    const u64 average_delay_us =
+        m_stats_frames_dequeued ? m_stats_queue_delay_us / m_stats_frames_dequeued : 0;
+    DEBUG_LOG_FMT(SP1, "BBA: {} frames sent, {} frames received, {} us average queueing delay",
+                  m_stats_frames_sent, m_stats_frames_received, average_delay_us);
+  }
+  m_stats_frames_sent = 0;
+  m_stats_frames_received = 0;
+  m_stats_frames_dequeued = 0;
+  m_stats_queue_delay_us = 0;
+  m_stats_time = now;
+}
+
 void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInBBAInterface* self)
 {
   std::size_t datasize = 0;
+  sf::SocketSelector selector;
   while (!self->m_read_thread_shutdown.IsSet())
   {
     if (datasize == 0)
-    {
-      // Make thread less CPU hungry
-      std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    }
-
-    if (!self->m_read_enabled.IsSet())
-      continue;
+      self->WaitForSocketData(selector);
 
     u8 wp = self->m_eth_ref->page_ptr(BBA_RWP);
     const u8 rp = self->m_eth_ref->page_ptr(BBA_RRP);
     if (rp > wp)
       wp += 16;
 
-    if ((wp - rp) >= 8)
+    if (!self->m_read_enabled.IsSet() || (wp - rp) >= 8)
+    {
+      // Nothing can be delivered until the receive buffer gets emptied, and waiting on the
+      // sockets would return right away if they have data.
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
       continue;
+    }
 
     std::lock_guard<std::mutex> lock(self->m_mtx);
     // process queue file first
@@ -729,6 +799,8 @@ void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInB
       }
       std::memcpy(self->m_eth_ref->mRecvBuffer.get(), self->m_queue_data[self->m_queue_read].data(),
                   datasize);
+      self->m_stats_queue_delay_us += GetTickCountUs() - self->m_queue_time_us[self->m_queue_read];
+      ++self->m_stats_frames_dequeued;
       self->m_queue_read++;
       self->m_queue_read &= 15;
     }
@@ -759,7 +831,10 @@ void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInB
       }
       self->m_eth_ref->mRecvBufferLength = static_cast<u32>(datasize);
       self->m_eth_ref->RecvHandlePacket();
+      ++self->m_stats_frames_received;
     }
+
+    self->UpdateStats();
   }
 }
 
@@ -446,6 +446,7 @@ private:
     u8 m_queue_read = 0;
     u8 m_queue_write = 0;
     std::array<std::vector<u8>, 16> m_queue_data;
+    std::array<u64, 16> m_queue_time_us{};
     std::mutex m_mtx;
     std::string m_local_ip;
     u32 m_current_ip = 0;
@@ -461,7 +462,16 @@ private:
     Common::Flag m_read_enabled;
     Common::Flag m_read_thread_shutdown;
     static void ReadThreadHandler(BuiltInBBAInterface* self);
+    void WaitForSocketData(sf::SocketSelector& selector);
 #endif
+    // Statistics, guarded by m_mtx
+    u32 m_stats_frames_sent = 0;
+    u32 m_stats_frames_received = 0;
+    u32 m_stats_frames_dequeued = 0;
+    u64 m_stats_queue_delay_us = 0;
+    u64 m_stats_time = 0;
+    void UpdateStats();
+
     void WriteToQueue(const std::vector<u8>& data);
     bool WillQueueOverrun() const;
     void PollData(std::size_t* datasize);
@@ -244,8 +244,8 @@ bool Core::Start(u64 gc_ticks)
 
   if (Config::Get(Config::MAIN_GBA_THREADS))
   {
-    m_idle = true;
-    m_exit_loop = false;
+    m_exit_loop.Clear();
+    m_pending_commands = 0;
     m_thread = std::make_unique<std::thread>([this] { ThreadLoop(); });
   }
 
@@ -257,11 +257,8 @@ void Core::Stop()
   if (m_thread)
   {
     Flush();
-    m_exit_loop = true;
-    {
-      std::lock_guard<std::mutex> lock(m_queue_mutex);
-      m_command_cv.notify_one();
-    }
+    m_exit_loop.Set();
+    m_command_event.Set();
     m_thread->join();
     m_thread.reset();
   }
@@ -477,10 +474,9 @@ void Core::SendJoybusCommand(u64 gc_ticks, int transfer_time, u8* buffer, u16 ke
 
   if (m_thread)
   {
-    std::lock_guard<std::mutex> lock(m_queue_mutex);
-    m_command_queue.push(command);
-    m_idle = false;
-    m_command_cv.notify_one();
+    ++m_pending_commands;
+    m_command_queue.Push(command);
+    m_command_event.Set();
   }
   else
   {
@@ -495,8 +491,8 @@ std::vector<u8> Core::GetJoybusResponse()
 
   if (m_thread)
   {
-    std::unique_lock<std::mutex> lock(m_response_mutex);
-    m_response_cv.wait(lock, [&] { return m_response_ready; });
+    while (!m_response_ready)
+      m_response_event.Wait();
   }
   m_response_ready = false;
   return m_response;
@@ -506,29 +502,26 @@ void Core::Flush()
 {
   if (!IsStarted() || !m_thread)
     return;
-  std::unique_lock<std::mutex> lock(m_queue_mutex);
-  m_response_cv.wait(lock, [&] { return m_idle; });
+  while (m_pending_commands != 0)
+    m_idle_event.Wait();
 }
 
 void Core::ThreadLoop()
 {
   Common::SetCurrentThreadName(fmt::format("GBA{}", m_device_number + 1).c_str());
-  std::unique_lock<std::mutex> queue_lock(m_queue_mutex);
-  while (true)
+  while (!m_exit_loop.IsSet())
   {
-    m_command_cv.wait(queue_lock, [&] { return !m_command_queue.empty() || m_exit_loop; });
-    if (m_exit_loop)
-      break;
-    Command command{m_command_queue.front()};
-    m_command_queue.pop();
-    queue_lock.unlock();
+    Command command{};
+    if (!m_command_queue.Pop(command))
+    {
+      m_command_event.Wait();
+      continue;
+    }
 
     RunCommand(command);
 
-    queue_lock.lock();
-    if (m_command_queue.empty())
-      m_idle = true;
-    m_response_cv.notify_one();
+    if (--m_pending_commands == 0)
+      m_idle_event.Set();
   }
 }
 
@@ -547,16 +540,9 @@ void Core::RunCommand(Command& command)
                 std::back_inserter(m_response));
     }
 
-    if (m_thread && !m_response_ready)
-    {
-      std::lock_guard<std::mutex> response_lock(m_response_mutex);
-      m_response_ready = true;
-      m_response_cv.notify_one();
-    }
-    else
-    {
-      m_response_ready = true;
-    }
+    m_response_ready = true;
+    if (m_thread)
+      m_response_event.Set();
   }
   if (command.transfer_time)
     RunFor(command.transfer_time);
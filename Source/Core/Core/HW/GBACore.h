@@ -4,10 +4,8 @@
 #pragma once
 
 #include <array>
-#include <condition_variable>
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <queue>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -20,6 +18,9 @@
 #include <mgba/gba/interface.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 class GBAHostInterface;
 class PointerWrap;
@@ -132,16 +133,17 @@ private:
 
   std::weak_ptr<GBAHostInterface> m_host;
 
+  // The CPU thread only waits for the GBA thread when it needs a response or has to flush, so
+  // commands are handed over without taking a lock.
   std::unique_ptr<std::thread> m_thread;
-  bool m_exit_loop = false;
-  bool m_idle = false;
-  std::mutex m_queue_mutex;
-  std::condition_variable m_command_cv;
-  std::queue<Command> m_command_queue;
-
-  std::mutex m_response_mutex;
-  std::condition_variable m_response_cv;
-  bool m_response_ready = false;
+  Common::Flag m_exit_loop;
+  Common::SPSCQueue<Command, false> m_command_queue;
+  Common::Event m_command_event;
+  std::atomic<u32> m_pending_commands = 0;
+  Common::Event m_idle_event;
+
+  Common::Event m_response_event;
+  std::atomic<bool> m_response_ready = false;
   std::vector<u8> m_response;
 
   ::Core::System& m_system;
@@ -620,95 +620,135 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
 
 void GCMemcardDirectory::FlushToFile()
 {
-  std::unique_lock l(m_write_mutex);
-  Memcard::DEntry invalid;
-  for (Memcard::GCIFile& save : m_saves)
+  // Only one flush writes files at a time, but emulation can keep accessing the card while it does.
+  std::lock_guard flush_lock(m_flush_mutex);
+
+  struct PendingWrite
   {
-    if (save.m_dirty)
+    std::string filename;
+    std::vector<u8> contents;
+  };
+  std::vector<PendingWrite> pending_writes;
+
+  {
+    std::unique_lock l(m_write_mutex);
+    for (Memcard::GCIFile& save : m_saves)
     {
-      if (save.m_gci_header.m_gamecode != Memcard::DEntry::UNINITIALIZED_GAMECODE)
+      if (save.m_dirty)
       {
-        save.m_dirty = false;
-        if (save.m_save_data.empty())
-        {
-          // The save's header has been changed but the actual save blocks haven't been read/written
-          // to
-          // skip flushing this file until actual save data is modified
-          ERROR_LOG_FMT(EXPANSIONINTERFACE,
-                        "GCI header modified without corresponding save data changes");
-          continue;
-        }
-        if (save.m_filename.empty())
+        if (save.m_gci_header.m_gamecode != Memcard::DEntry::UNINITIALIZED_GAMECODE)
         {
-          std::string default_save_name =
-              m_save_directory + GenerateDefaultGCIFilename(save.m_gci_header, m_hdr.IsShiftJIS());
-
-          // Check to see if another file is using the same name
-          // This seems unlikely except in the case of file corruption
-          // otherwise what user would name another file this way?
-          for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+          save.m_dirty = false;
+          if (save.m_save_data.empty())
           {
-            default_save_name.insert(default_save_name.end() - 4, '0');
+            // The save's header has been changed but the actual save blocks haven't been
+            // read/written to
+            // skip flushing this file until actual save data is modified
+            ERROR_LOG_FMT(EXPANSIONINTERFACE,
+                          "GCI header modified without corresponding save data changes");
+            continue;
           }
-          if (File::Exists(default_save_name))
+          if (save.m_filename.empty())
           {
-            PanicAlertFmtT("Failed to find new filename.\n{0}\n will be overwritten",
-                           default_save_name);
+            std::string default_save_name =
+                m_save_directory +
+                GenerateDefaultGCIFilename(save.m_gci_header, m_hdr.IsShiftJIS());
+
+            // Check to see if another file is using the same name
+            // This seems unlikely except in the case of file corruption
+            // otherwise what user would name another file this way?
+            for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+            {
+              default_save_name.insert(default_save_name.end() - 4, '0');
+            }
+            if (File::Exists(default_save_name))
+            {
+              PanicAlertFmtT("Failed to find new filename.\n{0}\n will be overwritten",
+                             default_save_name);
+            }
+            save.m_filename = default_save_name;
           }
-          save.m_filename = default_save_name;
-        }
-        File::IOFile gci(save.m_filename, "wb");
-        if (gci)
-        {
-          gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
-          for (const Memcard::GCMBlock& block : save.m_save_data)
-            gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
 
-          if (gci.IsGood())
-          {
-            Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
-          }
-          else
+          // Only files with changes are written. They get copied here, so that the card isn't
+          // locked while they are written to disk.
+          PendingWrite& write = pending_writes.emplace_back();
+          write.filename = save.m_filename;
+          write.contents.resize(Memcard::DENTRY_SIZE +
+                                save.m_save_data.size() * Memcard::BLOCK_SIZE);
+          u8* out = write.contents.data();
+          std::memcpy(out, &save.m_gci_header, Memcard::DENTRY_SIZE);
+          out += Memcard::DENTRY_SIZE;
+          for (const Memcard::GCMBlock& block : save.m_save_data)
           {
-            Core::DisplayMessage(
-                fmt::format("Failed to write save contents to {}", save.m_filename), 10000);
-            ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", save.m_filename);
+            std::memcpy(out, block.m_block.data(), Memcard::BLOCK_SIZE);
+            out += Memcard::BLOCK_SIZE;
           }
         }
-        else
+        else if (save.m_filename.length() != 0)
         {
-          Core::DisplayMessage(
-              fmt::format("Failed to open file at {} for writing", save.m_filename), 10000);
-          ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to open file at {} for writing",
-                        save.m_filename);
+          save.m_dirty = false;
+          std::string& old_name = save.m_filename;
+          std::string deleted_name = old_name + ".deleted";
+          if (File::Exists(deleted_name))
+            File::Delete(deleted_name);
+          File::Rename(old_name, deleted_name);
+          save.m_filename.clear();
+          save.m_save_data.clear();
+          save.m_used_blocks.clear();
         }
       }
-      else if (save.m_filename.length() != 0)
+
+      // Unload the save data for any game that is not running
+      // we could use !m_dirty, but some games have multiple gci files and may not write to them
+      // simultaneously
+      // this ensures that the save data for all of the current games gci files are stored in the
+      // savestate
+      const u32 gamecode = Common::swap32(save.m_gci_header.m_gamecode.data());
+      if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && !save.m_save_data.empty())
       {
-        save.m_dirty = false;
-        std::string& old_name = save.m_filename;
-        std::string deleted_name = old_name + ".deleted";
-        if (File::Exists(deleted_name))
-          File::Delete(deleted_name);
-        File::Rename(old_name, deleted_name);
-        save.m_filename.clear();
+        INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
         save.m_save_data.clear();
-        save.m_used_blocks.clear();
       }
     }
+  }
+
+  const u64 start_time = Common::Timer::NowMs();
+  for (const PendingWrite& write : pending_writes)
+  {
+    // Write to a temporary file first, so that a crash or a full disk can't leave a truncated
+    // save behind.
+    const std::string temp_filename = write.filename + ".tmp";
+    bool success = false;
+    {
+      File::IOFile gci(temp_filename, "wb");
+      if (!gci)
+      {
+        Core::DisplayMessage(
+            fmt::format("Failed to open file at {} for writing", temp_filename), 10000);
+        ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to open file at {} for writing", temp_filename);
+        continue;
+      }
+      success = gci.WriteBytes(write.contents.data(), write.contents.size()) && gci.Close();
+    }
 
-    // Unload the save data for any game that is not running
-    // we could use !m_dirty, but some games have multiple gci files and may not write to them
-    // simultaneously
-    // this ensures that the save data for all of the current games gci files are stored in the
-    // savestate
-    const u32 gamecode = Common::swap32(save.m_gci_header.m_gamecode.data());
-    if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && !save.m_save_data.empty())
+    if (success && File::RenameSync(temp_filename, write.filename))
+    {
+      Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
+    }
+    else
     {
-      INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
-      save.m_save_data.clear();
+      File::Delete(temp_filename);
+      Core::DisplayMessage(fmt::format("Failed to write save contents to {}", write.filename),
+                           10000);
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", write.filename);
     }
   }
+  if (!pending_writes.empty())
+  {
+    INFO_LOG_FMT(EXPANSIONINTERFACE, "Wrote {} GCI files in {} ms", pending_writes.size(),
+                 Common::Timer::NowMs() - start_time);
+  }
+
 #if _WRITE_MC_HEADER
   u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
   Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
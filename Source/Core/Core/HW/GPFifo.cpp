@@ -3,6 +3,7 @@
 
 #include "Core/HW/GPFifo.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -88,27 +89,44 @@ void GPFifoManager::UpdateGatherPipe()
   auto& memory = system.GetMemory();
   auto& processor_interface = system.GetProcessorInterface();
 
-  size_t pipe_count = GetGatherPipeCount();
-  size_t processed;
-  for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
+  const size_t pipe_count = GetGatherPipeCount();
+  const size_t burst_bytes = pipe_count - pipe_count % GATHER_PIPE_SIZE;
+  if (burst_bytes == 0)
+    return;
+
+  // Copy the bursts in as few chunks as possible (one, unless the FIFO wraps around), and only
+  // tell the command processor about them once they have all been written.
+  size_t processed = 0;
+  while (processed < burst_bytes)
   {
-    // copy the GatherPipe
-    memory.CopyToEmu(processor_interface.m_fifo_cpu_write_pointer, m_gather_pipe + processed,
-                     GATHER_PIPE_SIZE);
-    pipe_count -= GATHER_PIPE_SIZE;
+    const u32 write_pointer = processor_interface.m_fifo_cpu_write_pointer;
+    const u32 fifo_end = processor_interface.m_fifo_cpu_end;
+
+    size_t chunk_size = GATHER_PIPE_SIZE;
+    if (write_pointer <= fifo_end)
+    {
+      const u32 bytes_to_end = fifo_end - write_pointer;
+      chunk_size = std::min<size_t>(burst_bytes - processed,
+                                    bytes_to_end - bytes_to_end % GATHER_PIPE_SIZE +
+                                        GATHER_PIPE_SIZE);
+    }
+
+    memory.CopyToEmu(write_pointer, m_gather_pipe + processed, chunk_size);
+    processed += chunk_size;
 
     // increase the CPUWritePointer
-    if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
+    const u32 last_burst = write_pointer + static_cast<u32>(chunk_size) - GATHER_PIPE_SIZE;
+    if (last_burst == fifo_end)
       processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
     else
-      processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
-
-    system.GetCommandProcessor().GatherPipeBursted();
+      processor_interface.m_fifo_cpu_write_pointer = last_burst + GATHER_PIPE_SIZE;
   }
 
+  system.GetCommandProcessor().GatherPipeBursted(static_cast<u32>(burst_bytes / GATHER_PIPE_SIZE));
+
   // move back the spill bytes
-  memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count);
-  SetGatherPipeCount(pipe_count);
+  memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count - processed);
+  SetGatherPipeCount(pipe_count - processed);
 }
 
 void GPFifoManager::FastCheckGatherPipe()
@@ -3,7 +3,10 @@
 
 #include "Core/HW/MMIO.h"
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -416,6 +419,53 @@ void WriteHandler<T>::InitializeInvalid()
   ResetMethod(InvalidWrite<T>());
 }
 
+void Mapping::SetAccessCountingEnabled(bool enabled)
+{
+  if (!enabled)
+    m_access_counts.reset();
+  else if (!m_access_counts)
+    m_access_counts = std::make_unique<AccessCounts>();
+}
+
+// Converts an index into one of the access count arrays back into an address. The Wii block is
+// reported at 0x0D00xxxx, which is where both of its mirrors end up.
+template <typename Unit>
+static void AppendAccessCounts(std::vector<Mapping::AccessCount>* out,
+                               const std::array<u64, NUM_MMIOS / sizeof(Unit)>& counts,
+                               bool is_write)
+{
+  for (u32 i = 0; i < counts.size(); ++i)
+  {
+    if (counts[i] == 0)
+      continue;
+
+    const u32 unique_id = i * sizeof(Unit);
+    const u32 address = ((unique_id >> 16) == WII_BLOCK ? 0x0D000000 : 0x0C000000) |
+                        (unique_id & (BLOCK_SIZE - 1));
+    out->push_back({address, 8 * sizeof(Unit), is_write, counts[i]});
+  }
+}
+
+std::vector<Mapping::AccessCount> Mapping::GetAccessCounts() const
+{
+  std::vector<AccessCount> result;
+  if (!m_access_counts)
+    return result;
+
+  for (const bool is_write : {false, true})
+  {
+    const AccessCountArrays& arrays = is_write ? m_access_counts->writes : m_access_counts->reads;
+    AppendAccessCounts<u8>(&result, arrays.counts8, is_write);
+    AppendAccessCounts<u16>(&result, arrays.counts16, is_write);
+    AppendAccessCounts<u32>(&result, arrays.counts32, is_write);
+  }
+
+  std::sort(result.begin(), result.end(), [](const AccessCount& a, const AccessCount& b) {
+    return a.count != b.count ? a.count > b.count : a.address < b.address;
+  });
+  return result;
+}
+
 // Define all the public specializations that are exported in MMIOHandlers.h.
 #define MaybeExtern
 MMIO_PUBLIC_SPECIALIZATIONS()
@@ -6,9 +6,11 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -136,15 +138,39 @@ public:
   template <typename Unit>
   Unit Read(Core::System& system, u32 addr)
   {
+    if (m_access_counts) [[unlikely]]
+      ++GetAccessCountArray<Unit>(m_access_counts->reads)[UniqueID(addr) / sizeof(Unit)];
     return GetHandlerForRead<Unit>(addr).Read(system, addr);
   }
 
   template <typename Unit>
   void Write(Core::System& system, u32 addr, Unit val)
   {
+    if (m_access_counts) [[unlikely]]
+      ++GetAccessCountArray<Unit>(m_access_counts->writes)[UniqueID(addr) / sizeof(Unit)];
     GetHandlerForWrite<Unit>(addr).Write(system, addr, val);
   }
 
+  // Access counting interface.
+  //
+  // Counts every access going through Read/Write, per register and access
+  // width, to find out which handlers are worth optimizing for a given title.
+  // The JITs stop inlining MMIO accesses while counting is enabled, so that
+  // they are all counted.
+  struct AccessCount
+  {
+    u32 address;
+    u32 width;
+    bool is_write;
+    u64 count;
+  };
+
+  void SetAccessCountingEnabled(bool enabled);
+  bool IsAccessCountingEnabled() const { return m_access_counts != nullptr; }
+
+  // Returns the registers that were accessed at least once, most accessed first.
+  std::vector<AccessCount> GetAccessCounts() const;
+
   // Handlers access interface.
   //
   // Use when you care more about how to access the MMIO register for an
@@ -186,6 +212,25 @@ private:
   HandlerArray<u16>::Write m_write_handlers16;
   HandlerArray<u32>::Write m_write_handlers32;
 
+  template <typename Unit>
+  using AccessCountArray = std::array<u64, NUM_MMIOS / sizeof(Unit)>;
+
+  struct AccessCountArrays
+  {
+    AccessCountArray<u8> counts8{};
+    AccessCountArray<u16> counts16{};
+    AccessCountArray<u32> counts32{};
+  };
+
+  struct AccessCounts
+  {
+    AccessCountArrays reads;
+    AccessCountArrays writes;
+  };
+
+  // Only allocated while access counting is enabled.
+  std::unique_ptr<AccessCounts> m_access_counts;
+
   // Getter functions for the handler arrays.
   template <typename Unit>
   ReadHandler<Unit>& GetReadHandler(size_t index)
@@ -212,6 +257,13 @@ private:
     using ArrayType = typename HandlerArray<Unit>::Write;
     return std::get<ArrayType&>(handlers)[index];
   }
+
+  template <typename Unit>
+  static AccessCountArray<Unit>& GetAccessCountArray(AccessCountArrays& arrays)
+  {
+    auto counts = std::tie(arrays.counts8, arrays.counts16, arrays.counts32);
+    return std::get<AccessCountArray<Unit>&>(counts);
+  }
 };
 
 // Dummy 64 bits variants of these functions. While 64 bits MMIO access is
@@ -14,6 +14,7 @@
 #include <memory>
 #include <span>
 #include <tuple>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -69,6 +70,29 @@ void MemoryManager::InitMMIO(bool is_wii)
     m_system.GetExpansionInterface().RegisterMMIO(m_mmio_mapping.get(), 0x0D006800);
     m_system.GetAudioInterface().RegisterMMIO(m_mmio_mapping.get(), 0x0D006C00);
   }
+
+  m_mmio_mapping->SetAccessCountingEnabled(Config::Get(Config::MAIN_DEBUG_MMIO_ACCESS_COUNTING));
+}
+
+static void LogMMIOAccessCounts(const MMIO::Mapping& mapping)
+{
+  constexpr size_t MAX_LOGGED_REGISTERS = 32;
+
+  const std::vector<MMIO::Mapping::AccessCount> counts = mapping.GetAccessCounts();
+  u64 total = 0;
+  for (const MMIO::Mapping::AccessCount& entry : counts)
+    total += entry.count;
+  if (total == 0)
+    return;
+
+  NOTICE_LOG_FMT(MEMMAP, "MMIO accesses: {} in total, to {} registers", total, counts.size());
+  for (size_t i = 0; i < std::min(counts.size(), MAX_LOGGED_REGISTERS); ++i)
+  {
+    const MMIO::Mapping::AccessCount& entry = counts[i];
+    NOTICE_LOG_FMT(MEMMAP, "  {:08x} {:>5} u{:<2} {:>12} ({:5.2f}%)", entry.address,
+                   entry.is_write ? "write" : "read", entry.width, entry.count,
+                   100.0 * entry.count / total);
+  }
 }
 
 void MemoryManager::Init()
@@ -121,7 +145,7 @@ void MemoryManager::Init()
     region.active = true;
     mem_size += region.size;
   }
-  m_arena.GrabSHMSegment(mem_size, "dolphin-emu");
+  m_arena.GrabSHMSegment(mem_size, "dolphin-emu", Config::Get(Config::MAIN_LARGE_PAGES));
 
   m_physical_page_mappings.fill(nullptr);
 
@@ -230,11 +254,21 @@ bool MemoryManager::InitFastmemArena()
 
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
+
+  m_is_page_table_fastmem_enabled = Config::Get(Config::MAIN_PAGE_TABLE_FASTMEM) &&
+                                    m_arena.GetMappingGranularity() == PowerPC::HW_PAGE_SIZE;
+  if (Config::Get(Config::MAIN_PAGE_TABLE_FASTMEM) && !m_is_page_table_fastmem_enabled)
+    WARN_LOG_FMT(MEMMAP, "Page table fastmem isn't supported with this host's page size");
+
   return true;
 }
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // BAT mappings take priority, so make sure no page table mapping is in the way. The MMU maps
+  // them again afterwards.
+  UpdatePageTableMappings({});
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -290,6 +324,62 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+void MemoryManager::UpdatePageTableMappings(const std::map<u32, u32>& mappings)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  for (auto it = m_page_table_mapped_entries.begin(); it != m_page_table_mapped_entries.end();)
+  {
+    const auto new_mapping = mappings.find(it->first);
+    if (new_mapping == mappings.end() || new_mapping->second != it->second.physical_address)
+    {
+      m_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, PowerPC::HW_PAGE_SIZE);
+      it = m_page_table_mapped_entries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  if (!m_is_page_table_fastmem_enabled)
+    return;
+
+  for (const auto& [logical_address, translated_address] : mappings)
+  {
+    if (m_page_table_mapped_entries.contains(logical_address))
+      continue;
+
+    for (const auto& physical_region : m_physical_regions)
+    {
+      if (!physical_region.active)
+        continue;
+
+      const u32 mapping_address = physical_region.physical_address;
+      if (translated_address < mapping_address ||
+          translated_address + PowerPC::HW_PAGE_SIZE > mapping_address + physical_region.size)
+      {
+        continue;
+      }
+
+      const u32 position = physical_region.shm_position + translated_address - mapping_address;
+      u8* base = m_logical_base + logical_address;
+      void* mapped_pointer = m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base);
+      if (!mapped_pointer)
+      {
+        // Not fatal, accesses to this page will just take the slow path.
+        WARN_LOG_FMT(MEMMAP, "Failed to map page at 0x{:08X} into logical fastmem region",
+                     logical_address);
+        break;
+      }
+      m_page_table_mapped_entries.emplace(logical_address,
+                                          PageTableMapping{mapped_pointer, translated_address});
+      break;
+    }
+  }
+}
+
 void MemoryManager::DoState(PointerWrap& p)
 {
   const u32 current_ram_size = GetRamSize();
@@ -353,6 +443,8 @@ void MemoryManager::Shutdown()
     *region.out_pointer = nullptr;
   }
   m_arena.ReleaseSHMSegment();
+  if (m_mmio_mapping && m_mmio_mapping->IsAccessCountingEnabled())
+    LogMMIOAccessCounts(*m_mmio_mapping);
   m_mmio_mapping.reset();
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
@@ -377,6 +469,9 @@ void MemoryManager::ShutdownFastmemArena()
   }
   m_logical_mapped_entries.clear();
 
+  UpdatePageTableMappings({});
+  m_is_page_table_fastmem_enabled = false;
+
   m_arena.ReleaseMemoryRegion();
 
   m_fastmem_arena = nullptr;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
 #include <span>
 #include <string>
@@ -101,6 +102,13 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Whether pages translated through the page table can be mirrored into the logical fastmem
+  // region. Needs the fastmem arena, the setting, and a host that can map single 4 KiB pages.
+  bool IsPageTableFastmemEnabled() const { return m_is_page_table_fastmem_enabled; }
+  // Makes the logical fastmem region mirror the given page table translations (logical page
+  // address -> physical page address), only changing the host mappings that differ.
+  void UpdatePageTableMappings(const std::map<u32, u32>& mappings);
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -249,6 +257,14 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  struct PageTableMapping
+  {
+    void* mapped_pointer;
+    u32 physical_address;
+  };
+  bool m_is_page_table_fastmem_enabled = false;
+  std::map<u32, PageTableMapping> m_page_table_mapped_entries;  // logical address -> mapping
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
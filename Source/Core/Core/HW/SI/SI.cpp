@@ -16,6 +16,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
@@ -214,6 +215,15 @@ void SerialInterfaceManager::DoState(PointerWrap& p)
   p.Do(m_status_reg);
   p.Do(m_exi_clock_count);
   p.Do(m_si_buffer);
+
+  if (p.IsReadMode())
+  {
+    for (SSIChannel& channel : m_channel)
+    {
+      channel.late_input_pending = false;
+      channel.read_since_sample = true;
+    }
+  }
 }
 
 template <int device_number>
@@ -254,9 +264,15 @@ void SerialInterfaceManager::RemoveEvent(int device_number)
   core_timing.RemoveEvent(m_event_types_device[device_number]);
 }
 
+void SerialInterfaceManager::LoadConfig(ConfigValues& values)
+{
+  values.late_input = Config::Get(Config::MAIN_INPUT_LATE_INPUT);
+}
+
 void SerialInterfaceManager::Init()
 {
   RegisterEvents();
+  m_config.Init(&LoadConfig);
 
   for (int i = 0; i < MAX_SI_CHANNELS; i++)
   {
@@ -264,6 +280,8 @@ void SerialInterfaceManager::Init()
     m_channel[i].in_hi.hex = 0;
     m_channel[i].in_lo.hex = 0;
     m_channel[i].has_recent_device_change = false;
+    m_channel[i].late_input_pending = false;
+    m_channel[i].read_since_sample = true;
 
     auto& movie = m_system.GetMovie();
     if (movie.IsMovieActive())
@@ -307,6 +325,8 @@ void SerialInterfaceManager::Init()
   // m_exi_clock_count.LOCK = 1;
 
   m_si_buffer = {};
+
+  m_late_input_sampled = false;
 }
 
 void SerialInterfaceManager::Shutdown()
@@ -314,6 +334,7 @@ void SerialInterfaceManager::Shutdown()
   for (int i = 0; i < MAX_SI_CHANNELS; i++)
     RemoveDevice(i);
   GBAConnectionWaiter_Shutdown();
+  m_config.Shutdown();
 }
 
 void SerialInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
@@ -369,6 +390,7 @@ void SerialInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
     mmio->Register(base | (SI_CHANNEL_0_IN_HI + 0xC * i),
                    MMIO::ComplexRead<u32>([i, rdst_bit](Core::System& system, u32) {
                      auto& si = system.GetSerialInterface();
+                     si.OnChannelRead(i);
                      si.m_status_reg.hex &= ~(1U << rdst_bit);
                      si.UpdateInterrupts();
                      return si.m_channel[i].in_hi.hex;
@@ -377,6 +399,7 @@ void SerialInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
     mmio->Register(base | (SI_CHANNEL_0_IN_LO + 0xC * i),
                    MMIO::ComplexRead<u32>([i, rdst_bit](Core::System& system, u32) {
                      auto& si = system.GetSerialInterface();
+                     si.OnChannelRead(i);
                      si.m_status_reg.hex &= ~(1U << rdst_bit);
                      si.UpdateInterrupts();
                      return si.m_channel[i].in_lo.hex;
@@ -548,20 +571,30 @@ void SerialInterfaceManager::UpdateDevices()
   // succession, in order to optimize networking
   NetPlay::SetSIPollBatching(true);
 
+  // With late input, reading the controllers is put off until the game reads the results, which
+  // happens some time after the poll. The results are still flagged as new right away.
+  const bool late_input = IsLateInputAllowed();
+  m_late_input_sampled = false;
+
   // Update inputs at the rate of SI
   // Typically 120hz but is variable
-  g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
-  g_controller_interface.UpdateInput();
+  if (!late_input)
+    SampleInput();
 
   // Update channels and set the status bit if there's new data
-  m_status_reg.RDST0 =
-      !!m_channel[0].device->GetData(m_channel[0].in_hi.hex, m_channel[0].in_lo.hex);
-  m_status_reg.RDST1 =
-      !!m_channel[1].device->GetData(m_channel[1].in_hi.hex, m_channel[1].in_lo.hex);
-  m_status_reg.RDST2 =
-      !!m_channel[2].device->GetData(m_channel[2].in_hi.hex, m_channel[2].in_lo.hex);
-  m_status_reg.RDST3 =
-      !!m_channel[3].device->GetData(m_channel[3].in_hi.hex, m_channel[3].in_lo.hex);
+  std::array<bool, MAX_SI_CHANNELS> new_data;
+  for (int i = 0; i < MAX_SI_CHANNELS; ++i)
+  {
+    SSIChannel& channel = m_channel[i];
+    channel.late_input_pending =
+        late_input && SIDevice_IsGCController(channel.device->GetDeviceType());
+    new_data[i] = channel.late_input_pending ||
+                  channel.device->GetData(channel.in_hi.hex, channel.in_lo.hex);
+  }
+  m_status_reg.RDST0 = new_data[0];
+  m_status_reg.RDST1 = new_data[1];
+  m_status_reg.RDST2 = new_data[2];
+  m_status_reg.RDST3 = new_data[3];
 
   UpdateInterrupts();
 
@@ -569,6 +602,61 @@ void SerialInterfaceManager::UpdateDevices()
   NetPlay::SetSIPollBatching(false);
 }
 
+bool SerialInterfaceManager::IsLateInputAllowed() const
+{
+  // Sampling at a host-dependent time would make polling nondeterministic.
+  if (!m_config->late_input || NetPlay::IsNetPlayRunning() || m_system.GetMovie().IsMovieActive())
+    return false;
+
+  // Other devices may depend on being polled at the usual time.
+  return std::all_of(m_channel.begin(), m_channel.end(), [](const SSIChannel& channel) {
+    const SIDevices type = channel.device->GetDeviceType();
+    return type == SIDEVICE_NONE || SIDevice_IsGCController(type);
+  });
+}
+
+void SerialInterfaceManager::SampleInput()
+{
+  g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
+  g_controller_interface.UpdateInput();
+
+  m_input_sample_time = Common::Timer::NowUs();
+  for (SSIChannel& channel : m_channel)
+    channel.read_since_sample = false;
+}
+
+void SerialInterfaceManager::OnChannelRead(u32 channel_number)
+{
+  SSIChannel& channel = m_channel[channel_number];
+
+  if (channel.late_input_pending)
+  {
+    // The other channels read during this poll reuse the same sample.
+    if (!m_late_input_sampled)
+    {
+      SampleInput();
+      m_late_input_sampled = true;
+    }
+
+    channel.late_input_pending = false;
+    channel.device->GetData(channel.in_hi.hex, channel.in_lo.hex);
+  }
+
+  if (!channel.read_since_sample)
+  {
+    channel.read_since_sample = true;
+    m_input_age_total += Common::Timer::NowUs() - m_input_sample_time;
+    ++m_input_age_count;
+  }
+}
+
+u64 SerialInterfaceManager::TakeAverageInputAge()
+{
+  const u32 count = m_input_age_count.exchange(0);
+  const u64 total = m_input_age_total.exchange(0);
+  return count != 0 ? total / count : 0;
+}
+
 SIDevices SerialInterfaceManager::GetDeviceType(int channel) const
 {
   if (channel < 0 || channel >= MAX_SI_CHANNELS || !m_channel[channel].device)
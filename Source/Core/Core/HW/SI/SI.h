@@ -9,6 +9,8 @@
 
 #include "Common/BitField.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/ConfigSnapshot.h"
+#include "Core/CPUThreadConfigCallback.h"
 
 class PointerWrap;
 
@@ -67,6 +69,10 @@ public:
 
   u32 GetPollXLines();
 
+  // Returns the average time in microseconds between host input being sampled and the game reading
+  // it, since the last call, or 0 if nothing was read. Can be called from any thread.
+  u64 TakeAverageInputAge();
+
 private:
   // SI Interrupt Types
   enum SIInterruptType
@@ -81,6 +87,10 @@ private:
 
   void ChangeDeviceDeterministic(SIDevices device, int channel);
 
+  bool IsLateInputAllowed() const;
+  void SampleInput();
+  void OnChannelRead(u32 channel_number);
+
   void RegisterEvents();
   void RunSIBuffer(u64 user_data, s64 cycles_late);
   static void GlobalRunSIBuffer(Core::System& system, u64 user_data, s64 cycles_late);
@@ -132,6 +142,11 @@ private:
     std::unique_ptr<ISIDevice> device;
 
     bool has_recent_device_change = false;
+
+    // Late input: the poll was deferred until the game reads the channel.
+    bool late_input_pending = false;
+    // Whether the game has read the channel since input was last sampled.
+    bool read_since_sample = true;
   };
 
   // SI Poll: Controls how often a device is polled
@@ -242,6 +257,20 @@ private:
   USIEXIClockCount m_exi_clock_count;
   std::array<u8, 128> m_si_buffer{};
 
+  // Host time of the last input sample, in microseconds.
+  u64 m_input_sample_time = 0;
+  // Whether the late input of the current poll has been sampled yet.
+  bool m_late_input_sampled = false;
+  std::atomic<u64> m_input_age_total{0};
+  std::atomic<u32> m_input_age_count{0};
+
+  struct ConfigValues
+  {
+    bool late_input;
+  };
+  static void LoadConfig(ConfigValues& values);
+  Config::Snapshot<ConfigValues, CPUThreadConfigCallback::Callbacks> m_config;
+
   Core::System& m_system;
 };
 }  // namespace SerialInterface
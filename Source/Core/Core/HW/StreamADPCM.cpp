@@ -6,33 +6,35 @@
 #include "Core/HW/StreamADPCM.h"
 
 #include <algorithm>
+#include <array>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
+// The prediction filters selected by the upper nibble of a block's header byte. Any other value
+// disables prediction, like the first one.
+static constexpr std::array<std::array<s32, 2>, 4> FILTER_COEFFICIENTS{{
+    {0, 0},
+    {0x3c, 0},
+    {0x73, -0x34},
+    {0x62, -0x37},
+}};
+
+static const std::array<s32, 2>& GetFilterCoefficients(u8 header)
 {
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
+  const u32 filter = header >> 4;
+  return FILTER_COEFFICIENTS[filter < FILTER_COEFFICIENTS.size() ? filter : 0];
+}
+
+static s16 ADPDecodeSample(s32 bits, s32 shift, const std::array<s32, 2>& coefficients,
+                           s32& hist1, s32& hist2)
+{
+  s32 hist = hist1 * coefficients[0] + hist2 * coefficients[1];
   hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+  s32 cur = (((s16)(bits << 12) >> shift) << 6) + hist;
 
   hist2 = hist1;
   hist1 = cur;
@@ -61,12 +63,29 @@ void ADPCMDecoder::DoState(PointerWrap& p)
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
+  // The header selects the filter and shift of each channel for the whole block, so they're looked
+  // up once instead of for every sample.
+  const s32 shift_l = adpcm[0] & 0xf;
+  const s32 shift_r = adpcm[1] & 0xf;
+  const auto& coefficients_l = GetFilterCoefficients(adpcm[0]);
+  const auto& coefficients_r = GetFilterCoefficients(adpcm[1]);
+
+  // Keep the histories in locals, so the compiler doesn't have to reload them after each store.
+  s32 histl1 = m_histl1;
+  s32 histl2 = m_histl2;
+  s32 histr1 = m_histr1;
+  s32 histr2 = m_histr2;
+
+  const u8* data = &adpcm[ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK];
   for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
   {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
+    pcm[i * 2] = ADPDecodeSample(data[i] & 0xf, shift_l, coefficients_l, histl1, histl2);
+    pcm[i * 2 + 1] = ADPDecodeSample(data[i] >> 4, shift_r, coefficients_r, histr1, histr2);
   }
+
+  m_histl1 = histl1;
+  m_histl2 = histl2;
+  m_histr1 = histr1;
+  m_histr2 = histr2;
 }
 }  // namespace StreamADPCM
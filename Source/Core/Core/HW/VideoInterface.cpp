@@ -172,7 +172,21 @@ void VideoInterfaceManager::Preset(bool _bNTSC)
 
 void VideoInterfaceManager::Init()
 {
+  m_config.Init(&LoadConfig);
   Preset(true);
+  m_output_suppressed = false;
+}
+
+void VideoInterfaceManager::Shutdown()
+{
+  m_config.Shutdown();
+}
+
+void VideoInterfaceManager::LoadConfig(ConfigValues& values)
+{
+  values.early_xfb_output = Config::Get(Config::GFX_HACK_EARLY_XFB_OUTPUT);
+  values.background_input = Config::Get(Config::MAIN_INPUT_BACKGROUND_INPUT);
+  values.lock_cursor = Config::Get(Config::MAIN_LOCK_CURSOR);
 }
 
 void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
@@ -818,7 +832,7 @@ void VideoInterfaceManager::OutputField(FieldType field, u64 ticks)
   // Outputting the entire frame using a single set of VI register values isn't accurate, as games
   // can change the register values during scanout. To correctly emulate the scanout process, we
   // would need to collate all changes to the VI registers during scanout.
-  if (xfbAddr)
+  if (xfbAddr && !m_output_suppressed)
     g_video_backend->Video_OutputXFB(xfbAddr, fbWidth, fbStride, fbHeight, ticks);
 }
 
@@ -826,7 +840,7 @@ void VideoInterfaceManager::BeginField(FieldType field, u64 ticks)
 {
   // Outputting the frame at the beginning of scanout reduces latency. This assumes the game isn't
   // going to change the VI registers while a frame is scanning out.
-  if (Config::Get(Config::GFX_HACK_EARLY_XFB_OUTPUT))
+  if (m_config->early_xfb_output)
     OutputField(field, ticks);
 }
 
@@ -836,7 +850,7 @@ void VideoInterfaceManager::EndField(FieldType field, u64 ticks)
   // until the end so the last register values are used. This still isn't accurate, but it does
   // produce more acceptable results in some problematic cases.
   // Currently, this is only known to be necessary to eliminate flickering in WWE Crush Hour.
-  if (!Config::Get(Config::GFX_HACK_EARLY_XFB_OUTPUT))
+  if (!m_config->early_xfb_output)
     OutputField(field, ticks);
 
   g_perf_metrics.CountVBlank();
@@ -885,8 +899,7 @@ void VideoInterfaceManager::Update(u64 ticks)
 
   if (m_half_line_of_next_si_poll == m_half_line_count)
   {
-    Core::UpdateInputGate(!Config::Get(Config::MAIN_INPUT_BACKGROUND_INPUT),
-                          Config::Get(Config::MAIN_LOCK_CURSOR));
+    Core::UpdateInputGate(!m_config->background_input, m_config->lock_cursor);
     auto& si = m_system.GetSerialInterface();
     si.UpdateDevices();
     m_half_line_of_next_si_poll += 2 * si.GetPollXLines();
@@ -7,6 +7,8 @@
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/Config/ConfigSnapshot.h"
+#include "Core/CPUThreadConfigCallback.h"
 
 enum class FieldType;
 class PointerWrap;
@@ -363,6 +365,7 @@ public:
   void Preset(bool _bNTSC);
 
   void Init();
+  void Shutdown();
   void DoState(PointerWrap& p);
 
   void RegisterMMIO(MMIO::Mapping* mmio, u32 base);
@@ -396,6 +399,10 @@ public:
   // Create a fake VI mode for a fifolog
   void FakeVIUpdate(u32 xfb_address, u32 fb_width, u32 fb_stride, u32 fb_height);
 
+  // Stops fields from being sent to the video backend, while NetPlay runs frames again after a
+  // rollback. This isn't part of the emulated state.
+  void SetOutputSuppressed(bool suppressed) { m_output_suppressed = suppressed; }
+
 private:
   u32 GetHalfLinesPerEvenField() const;
   u32 GetHalfLinesPerOddField() const;
@@ -447,6 +454,18 @@ private:
   u32 m_even_field_last_hl = 0;   // index last halfline of the even field
   u32 m_odd_field_last_hl = 0;    // index last halfline of the odd field
 
+  bool m_output_suppressed = false;
+
+  // Read at least once every field.
+  struct ConfigValues
+  {
+    bool early_xfb_output;
+    bool background_input;
+    bool lock_cursor;
+  };
+  static void LoadConfig(ConfigValues& values);
+  Config::Snapshot<ConfigValues, CPUThreadConfigCallback::Callbacks> m_config;
+
   Core::System& m_system;
 };
 }  // namespace VideoInterface
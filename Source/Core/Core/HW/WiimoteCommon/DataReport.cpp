@@ -3,6 +3,9 @@
 
 #include "Core/HW/WiimoteCommon/DataReport.h"
 
+#include <memory>
+#include <new>
+
 #include "Common/Assert.h"
 #include "Common/BitUtils.h"
 #include "Common/MathUtil.h"
@@ -268,59 +271,65 @@ struct ReportInterleave2 : IncludeCore, IncludeIR<IRReportFormat::Full2, 3, 18,
 #pragma warning(pop)
 #endif
 
-std::unique_ptr<DataReportManipulator> MakeDataReportManipulator(InputReportID rpt_id, u8* data_ptr)
+namespace
 {
-  std::unique_ptr<DataReportManipulator> ptr;
+template <typename T>
+struct ReportType
+{
+  using type = T;
+};
 
+// Calls f with the ReportType of the manipulator for rpt_id.
+template <typename F>
+auto VisitReportType(InputReportID rpt_id, F&& f)
+{
   switch (rpt_id)
   {
   case InputReportID::ReportCore:
     // 0x30: Core Buttons
-    ptr = std::make_unique<ReportCore>();
-    break;
+    return f(ReportType<ReportCore>{});
   case InputReportID::ReportCoreAccel:
     // 0x31: Core Buttons and Accelerometer
-    ptr = std::make_unique<ReportCoreAccel>();
-    break;
+    return f(ReportType<ReportCoreAccel>{});
   case InputReportID::ReportCoreExt8:
     // 0x32: Core Buttons with 8 Extension bytes
-    ptr = std::make_unique<ReportCoreExt8>();
-    break;
+    return f(ReportType<ReportCoreExt8>{});
   case InputReportID::ReportCoreAccelIR12:
     // 0x33: Core Buttons and Accelerometer with 12 IR bytes
-    ptr = std::make_unique<ReportCoreAccelIR12>();
-    break;
+    return f(ReportType<ReportCoreAccelIR12>{});
   case InputReportID::ReportCoreExt19:
     // 0x34: Core Buttons with 19 Extension bytes
-    ptr = std::make_unique<ReportCoreExt19>();
-    break;
+    return f(ReportType<ReportCoreExt19>{});
   case InputReportID::ReportCoreAccelExt16:
     // 0x35: Core Buttons and Accelerometer with 16 Extension Bytes
-    ptr = std::make_unique<ReportCoreAccelExt16>();
-    break;
+    return f(ReportType<ReportCoreAccelExt16>{});
   case InputReportID::ReportCoreIR10Ext9:
     // 0x36: Core Buttons with 10 IR bytes and 9 Extension Bytes
-    ptr = std::make_unique<ReportCoreIR10Ext9>();
-    break;
+    return f(ReportType<ReportCoreIR10Ext9>{});
   case InputReportID::ReportCoreAccelIR10Ext6:
     // 0x37: Core Buttons and Accelerometer with 10 IR bytes and 6 Extension Bytes
-    ptr = std::make_unique<ReportCoreAccelIR10Ext6>();
-    break;
+    return f(ReportType<ReportCoreAccelIR10Ext6>{});
   case InputReportID::ReportExt21:
     // 0x3d: 21 Extension Bytes
-    ptr = std::make_unique<ReportExt21>();
-    break;
+    return f(ReportType<ReportExt21>{});
   case InputReportID::ReportInterleave1:
     // 0x3e - 0x3f: Interleaved Core Buttons and Accelerometer with 36 IR bytes
-    ptr = std::make_unique<ReportInterleave1>();
-    break;
+    return f(ReportType<ReportInterleave1>{});
   case InputReportID::ReportInterleave2:
-    ptr = std::make_unique<ReportInterleave2>();
-    break;
+    return f(ReportType<ReportInterleave2>{});
   default:
     ASSERT(false);
-    break;
+    return decltype(f(ReportType<ReportCore>{})){};
   }
+}
+}  // namespace
+
+std::unique_ptr<DataReportManipulator> MakeDataReportManipulator(InputReportID rpt_id, u8* data_ptr)
+{
+  std::unique_ptr<DataReportManipulator> ptr =
+      VisitReportType(rpt_id, [](auto type) -> std::unique_ptr<DataReportManipulator> {
+        return std::make_unique<typename decltype(type)::type>();
+      });
 
   ptr->data_ptr = data_ptr;
   return ptr;
@@ -331,10 +340,24 @@ DataReportBuilder::DataReportBuilder(InputReportID rpt_id) : m_data(rpt_id)
   SetMode(rpt_id);
 }
 
+DataReportBuilder::~DataReportBuilder()
+{
+  std::destroy_at(m_manip);
+}
+
 void DataReportBuilder::SetMode(InputReportID rpt_id)
 {
   m_data.report_id = rpt_id;
-  m_manip = MakeDataReportManipulator(rpt_id, GetDataPtr() + sizeof(m_data.report_id));
+
+  if (m_manip)
+    std::destroy_at(m_manip);
+  m_manip = VisitReportType(rpt_id, [this](auto type) -> DataReportManipulator* {
+    using T = typename decltype(type)::type;
+    static_assert(sizeof(T) <= sizeof(m_manip_storage));
+    static_assert(alignof(T) <= alignof(std::max_align_t));
+    return new (m_manip_storage.data()) T();
+  });
+  m_manip->data_ptr = GetDataPtr() + sizeof(m_data.report_id);
 }
 
 InputReportID DataReportBuilder::GetMode() const
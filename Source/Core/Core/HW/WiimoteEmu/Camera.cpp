@@ -64,9 +64,26 @@ CameraLogic::GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 fie
       Vec3{SENSOR_BAR_LED_SEPARATION / 2, 0, 0},
   };
 
-  const auto camera_view =
-      Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
-      Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4))) * transform;
+  // The field of view only changes with the settings, so the projection is only recomputed when
+  // it does rather than for every remote on every poll.
+  struct ProjectionCache
+  {
+    Common::Vec2 field_of_view{};
+    Matrix44 projection{};
+    bool valid = false;
+  };
+  thread_local ProjectionCache cache;
+  if (!cache.valid || cache.field_of_view.x != field_of_view.x ||
+      cache.field_of_view.y != field_of_view.y)
+  {
+    cache.field_of_view = field_of_view;
+    cache.projection =
+        Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
+        Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4)));
+    cache.valid = true;
+  }
+
+  const auto camera_view = cache.projection * transform;
 
   std::array<CameraPoint, CameraLogic::NUM_POINTS> camera_points;
 
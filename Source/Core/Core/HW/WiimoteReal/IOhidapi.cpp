@@ -126,10 +126,25 @@ bool WiimoteHidapi::IsConnected() const
   return m_handle != nullptr;
 }
 
+void WiimoteHidapi::IOWakeup()
+{
+  m_wakeup.Set();
+}
+
 int WiimoteHidapi::IORead(u8* buf)
 {
-  int timeout = 200;  // ms
-  int result = hid_read_timeout(m_handle, buf + 1, MAX_PAYLOAD - 1, timeout);
+  // hid_read_timeout can't be interrupted, so wait in short steps. Otherwise reports queued for
+  // writing would wait for the next input report, which doesn't come until a button changes in
+  // non-continuous reporting modes.
+  constexpr int timeout = 200;  // ms
+  constexpr int step = 10;      // ms
+  int result = 0;
+  for (int waited = 0; result == 0 && waited < timeout; waited += step)
+  {
+    if (m_wakeup.TestAndClear())
+      return -1;
+    result = hid_read_timeout(m_handle, buf + 1, MAX_PAYLOAD - 1, step);
+  }
   // TODO: If and once we use hidapi across plaforms, change our internal API to clean up this mess.
   if (result == -1)
   {
@@ -6,6 +6,7 @@
 #ifdef HAVE_HIDAPI
 #include <hidapi.h>
 
+#include "Common/Flag.h"
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 
 namespace WiimoteReal
@@ -21,13 +22,14 @@ protected:
   bool ConnectInternal() override;
   void DisconnectInternal() override;
   bool IsConnected() const override;
-  void IOWakeup() override {}
+  void IOWakeup() override;
   int IORead(u8* buf) override;
   int IOWrite(const u8* buf, size_t len) override;
 
 private:
   std::string m_device_path;
   hid_device* m_handle = nullptr;
+  Common::Flag m_wakeup;
 };
 
 class WiimoteScannerHidapi final : public WiimoteScannerBackend
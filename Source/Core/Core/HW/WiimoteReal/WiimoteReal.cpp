@@ -4,6 +4,7 @@
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 
 #include <algorithm>
+#include <bit>
 #include <cstdlib>
 #include <mutex>
 #include <queue>
@@ -16,6 +17,7 @@
 #include "Common/IniFile.h"
 #include "Common/Swap.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/Config/WiimoteSettings.h"
@@ -237,7 +239,7 @@ void Wiimote::ResetDataReporting()
 
 void Wiimote::ClearReadQueue()
 {
-  Report rpt;
+  QueuedReport rpt;
 
   // The "Clear" function isn't thread-safe :/
   while (m_read_reports.Pop(rpt))
@@ -324,7 +326,7 @@ void Wiimote::Read()
 
     // Add it to queue
     rpt.resize(result);
-    m_read_reports.Push(std::move(rpt));
+    m_read_reports.Push(QueuedReport{std::move(rpt), Common::Timer::NowUs()});
   }
 }
 
@@ -435,7 +437,32 @@ static bool IsDataReport(const Report& rpt)
 
 bool Wiimote::GetNextReport(Report* report)
 {
-  return m_read_reports.Pop(*report);
+  QueuedReport queued_report;
+  if (!m_read_reports.Pop(queued_report))
+    return false;
+
+  *report = std::move(queued_report.report);
+  RecordReportLatency(Common::Timer::NowUs() - queued_report.read_time_us);
+  return true;
+}
+
+void Wiimote::RecordReportLatency(u64 latency_us)
+{
+  auto& histogram = m_report_latency_histogram;
+  const size_t bucket = std::min<size_t>(std::bit_width(latency_us / 1000), histogram.size() - 1);
+  ++histogram[bucket];
+
+  const u64 now = Common::Timer::NowMs();
+  if (now - m_report_latency_log_time < 10000)
+    return;
+
+  DEBUG_LOG_FMT(WIIMOTE,
+                "Wii Remote {} report latency: {} <1 ms, {} <2 ms, {} <4 ms, {} <8 ms, {} <16 ms, "
+                "{} longer",
+                m_index + 1, histogram[0], histogram[1], histogram[2], histogram[3], histogram[4],
+                histogram[5]);
+  histogram = {};
+  m_report_latency_log_time = now;
 }
 
 // Returns the next report that should be sent
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -128,6 +129,8 @@ private:
   void ClearReadQueue();
   void WriteReport(Report rpt);
 
+  void RecordReportLatency(u64 latency_us);
+
   virtual int IORead(u8* buf) = 0;
   virtual int IOWrite(u8 const* buf, size_t len) = 0;
   virtual void IOWakeup() = 0;
@@ -153,9 +156,19 @@ private:
   // Triggered when the thread has finished ConnectInternal.
   Common::Event m_thread_ready_event;
 
-  Common::SPSCQueue<Report> m_read_reports;
+  struct QueuedReport
+  {
+    Report report;
+    // When the report was read from the device, to measure how long it waits to be used.
+    u64 read_time_us = 0;
+  };
+  Common::SPSCQueue<QueuedReport> m_read_reports;
   Common::SPSCQueue<Report> m_write_reports;
 
+  // Number of reports used within <1 ms, <2 ms, <4 ms, <8 ms, <16 ms and longer after being read.
+  std::array<u32, 6> m_report_latency_histogram{};
+  u64 m_report_latency_log_time = 0;
+
   bool m_speaker_enabled_in_dolphin_config = false;
   int m_balance_board_dump_port = 0;
 
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -198,6 +199,12 @@ private:
 
   std::string GetContentPath(u64 title_id, const ES::Content& content, Ticks ticks = {}) const;
 
+  // Reading the shared content map takes one FS read per entry, so it is kept between lookups
+  // and only read again after ES changes it or its size changes. Lookups are charged the ticks
+  // of the original read either way, to keep emulated timings the same.
+  const ES::SharedContentMap& GetSharedContentMap(Ticks ticks = {}) const;
+  void InvalidateSharedContentMap() const;
+
   bool IsActiveTitlePermittedByTicket(const u8* ticket_view) const;
 
   bool IsIssuerCorrect(VerifyContainerType type, const ES::CertReader& issuer_cert) const;
@@ -223,6 +230,9 @@ private:
 
   TitleContext m_title_context{};
 
+  mutable std::unique_ptr<ES::SharedContentMap> m_shared_content_map;
+  mutable u32 m_shared_content_map_size = 0;
+
   friend class ESDevice;
 };
 
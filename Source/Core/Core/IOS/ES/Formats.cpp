@@ -553,7 +553,6 @@ struct SharedContentMap::Entry
   std::array<u8, 20> sha1;
 };
 
-constexpr char CONTENT_MAP_PATH[] = "/shared1/content.map";
 SharedContentMap::SharedContentMap(HLE::FSCore& fs_core) : m_fs{fs_core.GetFS()}
 {
   static_assert(sizeof(Entry) == 28, "SharedContentMap::Entry has the wrong size");
@@ -277,6 +277,8 @@ public:
   void OverwriteCommonKeyIndex(u8 index);
 };
 
+constexpr char CONTENT_MAP_PATH[] = "/shared1/content.map";
+
 class SharedContentMap final
 {
 public:
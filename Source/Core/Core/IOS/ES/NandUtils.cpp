@@ -228,8 +228,7 @@ u32 ESCore::GetSharedContentsCount() const
 
 std::vector<std::array<u8, 20>> ESCore::GetSharedContents() const
 {
-  const ES::SharedContentMap map{m_ios.GetFSCore()};
-  return map.GetHashes();
+  return GetSharedContentMap().GetHashes();
 }
 
 static bool DeleteDirectoriesIfEmpty(FS::FileSystem* fs, const std::string& path)
@@ -397,13 +396,29 @@ std::string ESCore::GetContentPath(const u64 title_id, const ES::Content& conten
 {
   if (content.IsShared())
   {
-    ES::SharedContentMap content_map{m_ios.GetFSCore()};
-    ticks.Add(content_map.GetTicks());
-    return content_map.GetFilenameFromSHA1(content.sha1).value_or("");
+    return GetSharedContentMap(ticks).GetFilenameFromSHA1(content.sha1).value_or("");
   }
   return fmt::format("{}/{:08x}.app", Common::GetTitleContentPath(title_id), content.id);
 }
 
+const ES::SharedContentMap& ESCore::GetSharedContentMap(Ticks ticks) const
+{
+  const auto metadata = m_ios.GetFS()->GetMetadata(PID_KERNEL, PID_KERNEL, ES::CONTENT_MAP_PATH);
+  const u32 size = metadata ? metadata->size : 0;
+  if (!m_shared_content_map || size != m_shared_content_map_size)
+  {
+    m_shared_content_map = std::make_unique<ES::SharedContentMap>(m_ios.GetFSCore());
+    m_shared_content_map_size = size;
+  }
+  ticks.Add(m_shared_content_map->GetTicks());
+  return *m_shared_content_map;
+}
+
+void ESCore::InvalidateSharedContentMap() const
+{
+  m_shared_content_map.reset();
+}
+
 s32 ESDevice::WriteSystemFile(const std::string& path, const std::vector<u8>& data, Ticks ticks)
 {
   auto& fs = GetEmulationKernel().GetFSCore();
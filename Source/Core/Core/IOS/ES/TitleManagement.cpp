@@ -415,6 +415,7 @@ ReturnCode ESCore::ImportContentEnd(Context& context, u32 content_fd)
   {
     ES::SharedContentMap shared_content{m_ios.GetFSCore()};
     content_path = shared_content.AddSharedContent(content_info.sha1);
+    InvalidateSharedContentMap();
   }
   else
   {
@@ -900,7 +901,9 @@ ReturnCode ESCore::DeleteSharedContent(const std::array<u8, 20>& sha1) const
   if (delete_result != FS::ResultCode::Success)
     return FS::ConvertResult(delete_result);
 
-  if (!map.DeleteSharedContent(sha1))
+  const bool deleted = map.DeleteSharedContent(sha1);
+  InvalidateSharedContentMap();
+  if (!deleted)
     return ES_EIO;
 
   return IPC_SUCCESS;
@@ -291,6 +291,12 @@ public:
   virtual Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) = 0;
 
   virtual void SetNandRedirects(std::vector<NandRedirect> nand_redirects) = 0;
+
+  /// Called regularly while the emulated system runs. Writes cached changes to the backing storage
+  /// once they are old enough.
+  virtual void Update() = 0;
+  /// Write all cached changes to the backing storage now.
+  virtual void Flush() = 0;
 };
 
 template <typename T>
@@ -4,6 +4,7 @@
 #include "Core/IOS/FS/HostBackend/FS.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <optional>
 #include <string_view>
@@ -30,6 +31,9 @@ namespace IOS::HLE::FS
 {
 constexpr u32 BUFFER_CHUNK_SIZE = 65536;
 
+// How long changes may stay cached before Update() writes them to the host.
+constexpr auto WRITE_BACK_DELAY = std::chrono::seconds(1);
+
 HostFileSystem::HostFilename HostFileSystem::BuildFilename(const std::string& wii_path) const
 {
   for (const auto& redirect : m_nand_redirects)
@@ -155,7 +159,10 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   LoadFst();
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  Flush();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -234,6 +241,47 @@ void HostFileSystem::SaveFst()
   }
   if (!File::Rename(temp_path, dest_path))
     PanicAlertFmt("IOS_FS: Failed to rename temporary FST file");
+  m_fst_dirty = false;
+  m_host_operation_count += 2;
+}
+
+void HostFileSystem::QueueSaveFst()
+{
+  m_fst_dirty = true;
+  QueueWriteBack();
+}
+
+void HostFileSystem::QueueWriteBack()
+{
+  if (!m_unsaved_change_time)
+    m_unsaved_change_time = std::chrono::steady_clock::now();
+}
+
+void HostFileSystem::Update()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (m_unsaved_change_time && now - *m_unsaved_change_time >= WRITE_BACK_DELAY)
+    Flush();
+
+  if (now - m_stats_time >= std::chrono::seconds(1))
+  {
+    if (m_host_operation_count != 0 || m_cached_operation_count != 0)
+    {
+      DEBUG_LOG_FMT(IOS_FS, "{} host file operations, {} operations handled by the cache",
+                    m_host_operation_count, m_cached_operation_count);
+    }
+    m_host_operation_count = 0;
+    m_cached_operation_count = 0;
+    m_stats_time = now;
+  }
+}
+
+void HostFileSystem::Flush()
+{
+  WriteBackOpenFiles();
+  if (m_fst_dirty)
+    SaveFst();
+  m_unsaved_change_time.reset();
 }
 
 HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string& path)
@@ -373,6 +421,8 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  Flush();
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
@@ -402,15 +452,12 @@ void HostFileSystem::DoState(PointerWrap& p)
   if (!p.IsReadMode())
   {
     DoStateWriteOrMeasure(p, "/tmp");
-    u8* previous_position = p.ReserveU32();
+    const size_t size_position = p.ReserveU32();
     if (original_save_state_made_during_movie_recording)
     {
       DoStateWriteOrMeasure(p, "/");
-      if (p.IsWriteMode())
-      {
-        u32 size_of_nand = p.GetOffsetFromPreviousPosition(previous_position) - sizeof(u32);
-        memcpy(previous_position, &size_of_nand, sizeof(u32));
-      }
+      const u32 size_of_nand = static_cast<u32>(p.GetPosition() - size_position - sizeof(u32));
+      p.WriteReservedU32(size_position, size_of_nand);
     }
   }
   else  // case where we're in read mode.
@@ -498,7 +545,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   child->data.uid = uid;
   child->data.gid = gid;
   child->data.attribute = attr;
-  SaveFst();
+  QueueSaveFst();
   return ResultCode::Success;
 }
 
@@ -557,7 +604,7 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
                                GetNamePredicate(split_path.file_name));
   if (it != parent->children.end())
     parent->children.erase(it);
-  SaveFst();
+  QueueSaveFst();
 
   return ResultCode::Success;
 }
@@ -653,7 +700,7 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     old_parent->children.erase(it);
   }
 
-  SaveFst();
+  QueueSaveFst();
 
   return ResultCode::Success;
 }
@@ -737,7 +784,7 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid uid, Gid gid, const std::string
     return ResultCode::NotFound;
 
   Metadata metadata = entry->data;
-  metadata.size = File::GetSize(BuildFilename(path).host_path);
+  metadata.size = GetHostFileSize(BuildFilename(path).host_path);
   return metadata;
 }
 
@@ -756,7 +803,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
   if (caller_uid != 0 && uid != entry->data.uid)
     return ResultCode::AccessDenied;
 
-  const bool is_empty = File::GetSize(BuildFilename(path).host_path) == 0;
+  const bool is_empty = GetHostFileSize(BuildFilename(path).host_path) == 0;
   if (entry->data.uid != uid && entry->data.is_file && !is_empty)
     return ResultCode::FileNotEmpty;
 
@@ -767,7 +814,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
     entry->data.uid = uid;
     entry->data.attribute = attr;
     entry->data.modes = modes;
-    SaveFst();
+    QueueSaveFst();
   }
 
   return ResultCode::Success;
@@ -822,6 +869,9 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   if (!IsValidPath(wii_path))
     return ResultCode::Invalid;
 
+  // The sizes come from the host file system.
+  WriteBackOpenFiles();
+
   ExtendedDirectoryStats stats{};
   std::string path(BuildFilename(wii_path).host_path);
   File::FileInfo info(path);
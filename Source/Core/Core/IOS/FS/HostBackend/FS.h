@@ -4,8 +4,10 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -59,6 +61,9 @@ public:
 
   void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
 
+  void Update() override;
+  void Flush() override;
+
 private:
   void DoStateWriteOrMeasure(PointerWrap& p, std::string start_directory_path);
   void DoStateRead(PointerWrap& p, std::string start_directory_path);
@@ -76,12 +81,24 @@ private:
     std::vector<FstEntry> children;
   };
 
+  /// A host file, shared by all the handles which opened it.
+  struct HostFile
+  {
+    File::IOFile file;
+    u32 size = 0;
+    /// The contents of the file, if it is small enough to be kept in memory. Writes only change
+    /// this copy, the dirty range is written to the host file when the file gets closed or flushed.
+    std::optional<std::vector<u8>> data;
+    u32 dirty_begin = 0;
+    u32 dirty_end = 0;
+  };
+
   struct Handle
   {
     bool opened = false;
     Mode mode = Mode::None;
     std::string wii_path;
-    std::shared_ptr<File::IOFile> host_file;
+    std::shared_ptr<HostFile> host_file;
     u32 file_offset = 0;
   };
   Handle* AssignFreeHandle();
@@ -94,7 +111,10 @@ private:
     bool is_redirect;
   };
   HostFilename BuildFilename(const std::string& wii_path) const;
-  std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
+  std::shared_ptr<HostFile> OpenHostFile(const std::string& host_path);
+  void WriteBack(const std::string& host_path, HostFile& host_file);
+  void WriteBackOpenFiles();
+  u64 GetHostFileSize(const std::string& host_path) const;
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
                                    FileAttribute attribute, Modes modes, bool is_file);
@@ -105,6 +125,10 @@ private:
   void ResetFst();
   void LoadFst();
   void SaveFst();
+  /// Saves the FST on the next Update() after a short delay, so that a burst of metadata changes
+  /// only writes it once.
+  void QueueSaveFst();
+  void QueueWriteBack();
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
@@ -120,7 +144,18 @@ private:
   /// filesystem root manually.
   FstEntry m_root_entry{};
   std::string m_root_path;
-  std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
+
+  bool m_fst_dirty = false;
+  /// When the oldest change which hasn't been written to the host yet was made.
+  std::optional<std::chrono::steady_clock::time_point> m_unsaved_change_time;
+
+  /// The number of operations on host files and of those which the cache saved, logged by
+  /// Update() every second.
+  u32 m_host_operation_count = 0;
+  u32 m_cached_operation_count = 0;
+  std::chrono::steady_clock::time_point m_stats_time = std::chrono::steady_clock::now();
+
+  std::map<std::string, std::weak_ptr<HostFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
 
   FstEntry m_redirect_fst{};
@@ -13,8 +13,13 @@
 
 namespace IOS::HLE::FS
 {
+// Files up to this size are kept in memory while they are opened. Games tend to read and write
+// their saves in many small pieces, which would otherwise all turn into host file operations.
+constexpr u32 MAX_CACHED_FILE_SIZE = 1024 * 1024;
+
 // This isn't theadsafe, but it's only called from the CPU thread.
-std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path)
+std::shared_ptr<HostFileSystem::HostFile>
+HostFileSystem::OpenHostFile(const std::string& host_path)
 {
   // On the wii, all file operations are strongly ordered.
   // If a game opens the same file twice (or 8 times, looking at you PokePark Wii)
@@ -25,6 +30,7 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
 
   // So we fix this by catching any attempts to open the same file twice and
   // only opening one file. Accesses to a single file handle are ordered.
+  // This also makes all handles share the cached contents of the file.
   //
   // Hall of Shame:
   //    - PokePark Wii (gets stuck on the loading screen of Pikachu falling)
@@ -60,20 +66,73 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   }
 
   // This code will be called when all references to the shared pointer below have been removed.
-  auto deleter = [this, host_path](File::IOFile* ptr) {
+  auto deleter = [this, host_path](HostFile* ptr) {
+    WriteBack(host_path, *ptr);     // write the cached changes before closing the file.
     delete ptr;                     // IOFile's deconstructor closes the file.
     m_open_files.erase(host_path);  // erase the weak pointer from the list of open files.
   };
 
   // Use the custom deleter from above.
-  std::shared_ptr<File::IOFile> file_ptr(new File::IOFile(std::move(file)), deleter);
+  std::shared_ptr<HostFile> file_ptr(new HostFile{.file = std::move(file)}, deleter);
+  file_ptr->size = static_cast<u32>(file_ptr->file.GetSize());
+  ++m_host_operation_count;
+
+  if (file_ptr->size <= MAX_CACHED_FILE_SIZE)
+  {
+    std::vector<u8> data(file_ptr->size);
+    ++m_host_operation_count;
+    if (file_ptr->file.ReadBytes(data.data(), data.size()))
+      file_ptr->data = std::move(data);
+    else
+      file_ptr->file.ClearError();
+  }
 
   // Store a weak pointer to our newly opened file in the cache.
-  m_open_files[host_path] = std::weak_ptr<File::IOFile>(file_ptr);
+  m_open_files[host_path] = std::weak_ptr<HostFile>(file_ptr);
 
   return file_ptr;
 }
 
+void HostFileSystem::WriteBack(const std::string& host_path, HostFile& host_file)
+{
+  if (host_file.dirty_begin == host_file.dirty_end)
+    return;
+
+  const u32 offset = host_file.dirty_begin;
+  const u32 size = host_file.dirty_end - host_file.dirty_begin;
+  host_file.dirty_begin = host_file.dirty_end = 0;
+
+  // Flush, so that the changes are visible to anything reading the host file directly.
+  m_host_operation_count += 3;
+  if (!host_file.file.Seek(offset, File::SeekOrigin::Begin) ||
+      !host_file.file.WriteBytes(host_file.data->data() + offset, size) || !host_file.file.Flush())
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to write {} bytes at {:#x} to {}", size, offset, host_path);
+    host_file.file.ClearError();
+  }
+}
+
+void HostFileSystem::WriteBackOpenFiles()
+{
+  for (const auto& [host_path, weak_file] : m_open_files)
+  {
+    if (const std::shared_ptr<HostFile> host_file = weak_file.lock())
+      WriteBack(host_path, *host_file);
+  }
+}
+
+u64 HostFileSystem::GetHostFileSize(const std::string& host_path) const
+{
+  // The host file might not have the latest size if the file is cached.
+  const auto it = m_open_files.find(host_path);
+  if (it != m_open_files.end())
+  {
+    if (const std::shared_ptr<HostFile> host_file = it->second.lock())
+      return host_file->size;
+  }
+  return File::GetSize(host_path);
+}
+
 Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
 {
   Handle* handle = AssignFreeHandle();
@@ -115,22 +174,31 @@ ResultCode HostFileSystem::Close(Fd fd)
 Result<u32> HostFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
 {
   Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   if ((u8(handle->mode) & u8(Mode::Read)) == 0)
     return ResultCode::AccessDenied;
 
-  const u32 file_size = static_cast<u32>(handle->host_file->GetSize());
+  HostFile& host_file = *handle->host_file;
   // IOS has this check in the read request handler.
-  if (count + handle->file_offset > file_size)
-    count = file_size - handle->file_offset;
+  if (count + handle->file_offset > host_file.size)
+    count = host_file.size - handle->file_offset;
+
+  if (host_file.data)
+  {
+    std::copy_n(host_file.data->data() + handle->file_offset, count, ptr);
+    handle->file_offset += count;
+    ++m_cached_operation_count;
+    return count;
+  }
 
   // File might be opened twice, need to seek before we read
-  handle->host_file->Seek(handle->file_offset, File::SeekOrigin::Begin);
-  const u32 actually_read = static_cast<u32>(fread(ptr, 1, count, handle->host_file->GetHandle()));
+  m_host_operation_count += 2;
+  host_file.file.Seek(handle->file_offset, File::SeekOrigin::Begin);
+  const u32 actually_read = static_cast<u32>(fread(ptr, 1, count, host_file.file.GetHandle()));
 
-  if (actually_read != count && ferror(handle->host_file->GetHandle()))
+  if (actually_read != count && ferror(host_file.file.GetHandle()))
     return ResultCode::AccessDenied;
 
   // IOS returns the number of bytes read and adds that value to the seek position,
@@ -142,17 +210,51 @@ Result<u32> HostFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
 Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
 {
   Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   if ((u8(handle->mode) & u8(Mode::Write)) == 0)
     return ResultCode::AccessDenied;
 
-  // File might be opened twice, need to seek before we read
-  handle->host_file->Seek(handle->file_offset, File::SeekOrigin::Begin);
-  if (!handle->host_file->WriteBytes(ptr, count))
-    return ResultCode::AccessDenied;
+  HostFile& host_file = *handle->host_file;
+  const u32 offset = handle->file_offset;
+  if (host_file.data && u64(offset) + count > MAX_CACHED_FILE_SIZE)
+  {
+    // The file got too big to keep it in memory.
+    WriteBack(BuildFilename(handle->wii_path).host_path, host_file);
+    host_file.data.reset();
+  }
+
+  if (host_file.data)
+  {
+    std::vector<u8>& data = *host_file.data;
+    if (offset + count > data.size())
+      data.resize(offset + count);
+    std::copy_n(ptr, count, data.begin() + offset);
+
+    if (host_file.dirty_begin == host_file.dirty_end)
+    {
+      host_file.dirty_begin = offset;
+      host_file.dirty_end = offset + count;
+    }
+    else
+    {
+      host_file.dirty_begin = std::min(host_file.dirty_begin, offset);
+      host_file.dirty_end = std::max(host_file.dirty_end, offset + count);
+    }
+    ++m_cached_operation_count;
+    QueueWriteBack();
+  }
+  else
+  {
+    // File might be opened twice, need to seek before we read
+    m_host_operation_count += 2;
+    host_file.file.Seek(offset, File::SeekOrigin::Begin);
+    if (!host_file.file.WriteBytes(ptr, count))
+      return ResultCode::AccessDenied;
+  }
 
+  host_file.size = std::max(host_file.size, offset + count);
   handle->file_offset += count;
   return count;
 }
@@ -160,7 +262,7 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
 Result<u32> HostFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
 {
   Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   u32 new_position = 0;
@@ -173,14 +275,14 @@ Result<u32> HostFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
     new_position = handle->file_offset + offset;
     break;
   case SeekMode::End:
-    new_position = handle->host_file->GetSize() + offset;
+    new_position = handle->host_file->size + offset;
     break;
   default:
     return ResultCode::Invalid;
   }
 
   // This differs from POSIX behaviour which allows seeking past the end of the file.
-  if (handle->host_file->GetSize() < new_position)
+  if (handle->host_file->size < new_position)
     return ResultCode::Invalid;
 
   handle->file_offset = new_position;
@@ -190,11 +292,11 @@ Result<u32> HostFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
 Result<FileStatus> HostFileSystem::GetFileStatus(Fd fd)
 {
   const Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   FileStatus status;
-  status.size = handle->host_file->GetSize();
+  status.size = handle->host_file->size;
   status.offset = handle->file_offset;
   return status;
 }
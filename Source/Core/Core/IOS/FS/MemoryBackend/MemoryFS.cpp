@@ -0,0 +1,695 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/MemoryBackend/MemoryFS.h"
+
+#include <algorithm>
+#include <optional>
+
+#include "Common/Align.h"
+#include "Common/ChunkFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace IOS::HLE::FS
+{
+namespace
+{
+std::string JoinPath(const std::string& parent, const std::string& name)
+{
+  return parent == "/" ? '/' + name : parent + '/' + name;
+}
+
+bool CheckPermission(const Metadata& data, Uid caller_uid, Gid caller_gid, Mode requested_mode)
+{
+  if (caller_uid == 0)
+    return true;
+  Mode file_mode = data.modes.other;
+  if (data.uid == caller_uid)
+    file_mode = data.modes.owner;
+  else if (data.gid == caller_gid)
+    file_mode = data.modes.group;
+  return (u8(requested_mode) & u8(file_mode)) == u8(requested_mode);
+}
+
+// Like the host backend, hide files in the root directory and files with invalid names.
+bool IsVisible(const Metadata& data, const std::string& name, bool is_root)
+{
+  return !(is_root && data.is_file) && IsValidFilename(name);
+}
+
+auto GetNamePredicate(const std::string& name)
+{
+  return [&name](const auto& entry) { return entry.name == name; };
+}
+}  // namespace
+
+MemoryFileSystem::MemoryFileSystem(std::unique_ptr<FileSystem> base) : m_base{std::move(base)}
+{
+  m_root_entry.name = "/";
+  // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
+  m_root_entry.data.modes = {Mode::None, Mode::Read, Mode::Read};
+  if (m_base)
+  {
+    if (const Result<Metadata> metadata = m_base->GetMetadata(0, 0, "/"))
+      m_root_entry.data = *metadata;
+  }
+  else
+  {
+    m_root_entry.children_loaded = true;
+  }
+}
+
+MemoryFileSystem::~MemoryFileSystem() = default;
+
+std::vector<MemoryFileSystem::Node>& MemoryFileSystem::GetChildren(Node& node,
+                                                                   const std::string& path)
+{
+  if (node.children_loaded)
+    return node.children;
+
+  node.children_loaded = true;
+  const Result<std::vector<std::string>> names = m_base->ReadDirectory(0, 0, path);
+  if (!names)
+    return node.children;
+
+  // ReadDirectory lists the newest entries first.
+  for (auto it = names->rbegin(); it != names->rend(); ++it)
+  {
+    const Result<Metadata> metadata = m_base->GetMetadata(0, 0, JoinPath(path, *it));
+    if (!metadata)
+      continue;
+    Node& child = node.children.emplace_back();
+    child.name = *it;
+    child.data = *metadata;
+  }
+  return node.children;
+}
+
+const std::shared_ptr<std::vector<u8>>& MemoryFileSystem::GetContents(Node& node,
+                                                                      const std::string& path)
+{
+  if (node.contents)
+    return node.contents;
+
+  node.contents = std::make_shared<std::vector<u8>>();
+  if (!m_base)
+    return node.contents;
+
+  const Result<FileHandle> file = m_base->OpenFile(0, 0, path, Mode::Read);
+  if (!file)
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to load {} from the base file system", path);
+    return node.contents;
+  }
+
+  node.contents->resize(file->GetStatus()->size);
+  if (!file->Read(node.contents->data(), node.contents->size()))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to read {} from the base file system", path);
+    node.contents->clear();
+  }
+  node.data.size = static_cast<u32>(node.contents->size());
+  return node.contents;
+}
+
+void MemoryFileSystem::LoadEverything(Node& node, const std::string& path)
+{
+  if (node.data.is_file)
+    return;
+  for (Node& child : GetChildren(node, path))
+    LoadEverything(child, JoinPath(path, child.name));
+}
+
+MemoryFileSystem::Node* MemoryFileSystem::GetNode(const std::string& path)
+{
+  if (path == "/")
+    return &m_root_entry;
+
+  if (!IsValidNonRootPath(path))
+    return nullptr;
+
+  // Loading the children of a node never moves existing nodes, so this pointer stays valid until
+  // a node is added or removed.
+  Node* node = &m_root_entry;
+  std::string node_path = "/";
+  for (const std::string& component : SplitString(path.substr(1), '/'))
+  {
+    if (node->data.is_file)
+      return nullptr;
+
+    std::vector<Node>& children = GetChildren(*node, node_path);
+    const auto it = std::find_if(children.begin(), children.end(), GetNamePredicate(component));
+    if (it == children.end())
+      return nullptr;
+
+    node = &*it;
+    node_path = JoinPath(node_path, component);
+  }
+  return node;
+}
+
+void MemoryFileSystem::DoStateNode(PointerWrap& p, Node& node)
+{
+  p.Do(node.name);
+  p.Do(node.data);
+  p.Do(node.children_loaded);
+
+  bool has_contents = node.contents != nullptr;
+  p.Do(has_contents);
+  if (p.IsReadMode())
+    node.contents = has_contents ? std::make_shared<std::vector<u8>>() : nullptr;
+  if (has_contents)
+    p.Do(*node.contents);
+
+  u32 child_count = static_cast<u32>(node.children.size());
+  p.Do(child_count);
+  if (p.IsReadMode())
+    node.children.resize(child_count);
+  for (Node& child : node.children)
+    DoStateNode(p, child);
+}
+
+void MemoryFileSystem::DoState(PointerWrap& p)
+{
+  // Unlike the host backend, the whole file system is part of the state, since it doesn't exist
+  // anywhere else. Nodes which haven't been loaded yet get loaded from the base again.
+  DoStateNode(p, m_root_entry);
+
+  std::vector<std::string> modified_paths = GetModifiedPaths();
+  p.Do(modified_paths);
+  if (p.IsReadMode())
+    m_modified_paths = {modified_paths.begin(), modified_paths.end()};
+
+  for (Handle& handle : m_handles)
+  {
+    p.Do(handle.opened);
+    p.Do(handle.mode);
+    p.Do(handle.wii_path);
+    p.Do(handle.file_offset);
+    if (!p.IsReadMode())
+      continue;
+
+    handle.contents.reset();
+    if (!handle.opened)
+      continue;
+    if (Node* node = GetNode(handle.wii_path); node && node->data.is_file)
+      handle.contents = GetContents(*node, handle.wii_path);
+    else
+      handle = Handle{};
+  }
+}
+
+ResultCode MemoryFileSystem::Format(Uid uid)
+{
+  if (uid != 0)
+    return ResultCode::AccessDenied;
+
+  m_root_entry = {};
+  m_root_entry.name = "/";
+  m_root_entry.data.modes = {Mode::None, Mode::Read, Mode::Read};
+  m_root_entry.children_loaded = true;
+  m_modified_paths.insert("/");
+  // Reset and close all handles.
+  m_handles = {};
+  return ResultCode::Success;
+}
+
+Result<FileHandle> MemoryFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
+{
+  Handle* handle = AssignFreeHandle();
+  if (!handle)
+    return ResultCode::NoFreeHandle;
+
+  Node* node = GetNode(path);
+  if (!node || !node->data.is_file)
+  {
+    *handle = Handle{};
+    return ResultCode::NotFound;
+  }
+
+  handle->contents = GetContents(*node, path);
+  handle->wii_path = path;
+  handle->mode = mode;
+  handle->file_offset = 0;
+  return FileHandle{this, ConvertHandleToFd(handle)};
+}
+
+ResultCode MemoryFileSystem::Close(Fd fd)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  *handle = Handle{};
+  return ResultCode::Success;
+}
+
+Result<u32> MemoryFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Read)) == 0)
+    return ResultCode::AccessDenied;
+
+  const std::vector<u8>& contents = *handle->contents;
+  const u32 file_size = static_cast<u32>(contents.size());
+  // IOS has this check in the read request handler.
+  if (count + handle->file_offset > file_size)
+    count = file_size - handle->file_offset;
+
+  std::copy_n(contents.begin() + handle->file_offset, count, ptr);
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> MemoryFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Write)) == 0)
+    return ResultCode::AccessDenied;
+
+  std::vector<u8>& contents = *handle->contents;
+  if (handle->file_offset + count > contents.size())
+    contents.resize(handle->file_offset + count);
+  std::copy_n(ptr, count, contents.begin() + handle->file_offset);
+  m_modified_paths.insert(handle->wii_path);
+
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> MemoryFileSystem::SeekFile(Fd fd, u32 offset, SeekMode mode)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  const u32 file_size = static_cast<u32>(handle->contents->size());
+  u32 new_position = 0;
+  switch (mode)
+  {
+  case SeekMode::Set:
+    new_position = offset;
+    break;
+  case SeekMode::Current:
+    new_position = handle->file_offset + offset;
+    break;
+  case SeekMode::End:
+    new_position = file_size + offset;
+    break;
+  default:
+    return ResultCode::Invalid;
+  }
+
+  // This differs from POSIX behaviour which allows seeking past the end of the file.
+  if (file_size < new_position)
+    return ResultCode::Invalid;
+
+  handle->file_offset = new_position;
+  return handle->file_offset;
+}
+
+Result<FileStatus> MemoryFileSystem::GetFileStatus(Fd fd)
+{
+  const Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  FileStatus status;
+  status.size = static_cast<u32>(handle->contents->size());
+  status.offset = handle->file_offset;
+  return status;
+}
+
+ResultCode MemoryFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                                   FileAttribute attr, Modes modes, bool is_file)
+{
+  if (!IsValidNonRootPath(path) ||
+      !std::all_of(path.begin(), path.end(), Common::IsPrintableCharacter))
+  {
+    return ResultCode::Invalid;
+  }
+
+  if (!is_file && std::count(path.begin(), path.end(), '/') > int(MaxPathDepth))
+    return ResultCode::TooManyPathComponents;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Node* parent = GetNode(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!CheckPermission(parent->data, uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  if (parent->data.is_file)
+    return ResultCode::UnknownError;
+
+  std::vector<Node>& children = GetChildren(*parent, split_path.parent);
+  if (std::any_of(children.begin(), children.end(), GetNamePredicate(split_path.file_name)))
+    return ResultCode::AlreadyExists;
+
+  Node& child = children.emplace_back();
+  child.name = split_path.file_name;
+  child.data.is_file = is_file;
+  child.data.modes = modes;
+  child.data.uid = uid;
+  child.data.gid = gid;
+  child.data.attribute = attr;
+  if (is_file)
+    child.contents = std::make_shared<std::vector<u8>>();
+  else
+    child.children_loaded = true;
+  m_modified_paths.insert(path);
+  return ResultCode::Success;
+}
+
+ResultCode MemoryFileSystem::CreateFile(Uid uid, Gid gid, const std::string& path,
+                                        FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, true);
+}
+
+ResultCode MemoryFileSystem::CreateDirectory(Uid uid, Gid gid, const std::string& path,
+                                             FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, false);
+}
+
+bool MemoryFileSystem::IsFileOpened(const std::string& path) const
+{
+  return std::any_of(m_handles.begin(), m_handles.end(), [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path == path;
+  });
+}
+
+bool MemoryFileSystem::IsDirectoryInUse(const std::string& path) const
+{
+  return std::any_of(m_handles.begin(), m_handles.end(), [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path.starts_with(path);
+  });
+}
+
+ResultCode MemoryFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
+{
+  if (!IsValidNonRootPath(path))
+    return ResultCode::Invalid;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Node* parent = GetNode(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!CheckPermission(parent->data, uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  if (parent->data.is_file)
+    return ResultCode::NotFound;
+
+  std::vector<Node>& children = GetChildren(*parent, split_path.parent);
+  const auto it =
+      std::find_if(children.begin(), children.end(), GetNamePredicate(split_path.file_name));
+  if (it == children.end())
+    return ResultCode::NotFound;
+
+  if (it->data.is_file ? IsFileOpened(path) : IsDirectoryInUse(path))
+    return ResultCode::InUse;
+
+  children.erase(it);
+  m_modified_paths.insert(path);
+  return ResultCode::Success;
+}
+
+ResultCode MemoryFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
+                                    const std::string& new_path)
+{
+  if (!IsValidNonRootPath(old_path) || !IsValidNonRootPath(new_path))
+    return ResultCode::Invalid;
+
+  const auto split_old_path = SplitPathAndBasename(old_path);
+  const auto split_new_path = SplitPathAndBasename(new_path);
+
+  Node* old_parent = GetNode(split_old_path.parent);
+  Node* new_parent = GetNode(split_new_path.parent);
+  if (!old_parent || !new_parent)
+    return ResultCode::NotFound;
+
+  if (!CheckPermission(old_parent->data, uid, gid, Mode::Write) ||
+      !CheckPermission(new_parent->data, uid, gid, Mode::Write))
+  {
+    return ResultCode::AccessDenied;
+  }
+
+  Node* entry = GetNode(old_path);
+  if (!entry)
+    return ResultCode::NotFound;
+
+  // For files, the file name is not allowed to change.
+  if (entry->data.is_file && split_old_path.file_name != split_new_path.file_name)
+    return ResultCode::Invalid;
+
+  if ((!entry->data.is_file && IsDirectoryInUse(old_path)) ||
+      (entry->data.is_file && IsFileOpened(old_path)))
+  {
+    return ResultCode::InUse;
+  }
+
+  if (old_path == new_path)
+    return ResultCode::Success;
+
+  // The host backend fails to move a directory into itself or into a file, in the same way.
+  if (new_parent->data.is_file || new_path.starts_with(old_path + '/'))
+    return ResultCode::NotFound;
+
+  // If there is already something of the same type at the new path, it gets replaced.
+  if (const Node* existing = GetNode(new_path))
+  {
+    if (existing->data.is_file != entry->data.is_file)
+      return ResultCode::Invalid;
+  }
+
+  std::vector<Node>& old_siblings = old_parent->children;
+  Node node = std::move(*entry);
+  old_siblings.erase(old_siblings.begin() + (entry - old_siblings.data()));
+  node.name = split_new_path.file_name;
+
+  // Removing the node may have moved the new parent.
+  std::vector<Node>& new_siblings = GetChildren(*GetNode(split_new_path.parent),
+                                                split_new_path.parent);
+  const auto it = std::find_if(new_siblings.begin(), new_siblings.end(),
+                               GetNamePredicate(split_new_path.file_name));
+  if (it != new_siblings.end())
+    *it = std::move(node);
+  else
+    new_siblings.push_back(std::move(node));
+
+  m_modified_paths.insert(old_path);
+  m_modified_paths.insert(new_path);
+  return ResultCode::Success;
+}
+
+Result<std::vector<std::string>> MemoryFileSystem::ReadDirectory(Uid uid, Gid gid,
+                                                                 const std::string& path)
+{
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  Node* entry = GetNode(path);
+  if (!entry)
+    return ResultCode::NotFound;
+
+  if (!CheckPermission(entry->data, uid, gid, Mode::Read))
+    return ResultCode::AccessDenied;
+
+  if (entry->data.is_file)
+    return ResultCode::Invalid;
+
+  // Newest entries first, because Nintendo traverses a linked list in which new elements are
+  // inserted at the front.
+  const std::vector<Node>& children = GetChildren(*entry, path);
+  std::vector<std::string> output;
+  for (auto it = children.rbegin(); it != children.rend(); ++it)
+  {
+    if (IsVisible(it->data, it->name, path == "/"))
+      output.emplace_back(it->name);
+  }
+  return output;
+}
+
+Result<Metadata> MemoryFileSystem::GetMetadata(Uid uid, Gid gid, const std::string& path)
+{
+  const Node* entry = nullptr;
+  if (path == "/")
+  {
+    entry = &m_root_entry;
+  }
+  else
+  {
+    if (!IsValidNonRootPath(path))
+      return ResultCode::Invalid;
+
+    const auto split_path = SplitPathAndBasename(path);
+    const Node* parent = GetNode(split_path.parent);
+    if (!parent)
+      return ResultCode::NotFound;
+    if (!CheckPermission(parent->data, uid, gid, Mode::Read))
+      return ResultCode::AccessDenied;
+    entry = GetNode(path);
+  }
+
+  if (!entry)
+    return ResultCode::NotFound;
+
+  Metadata metadata = entry->data;
+  metadata.size = entry->contents ? static_cast<u32>(entry->contents->size()) : entry->data.size;
+  if (!metadata.is_file)
+    metadata.size = 0;
+  return metadata;
+}
+
+ResultCode MemoryFileSystem::SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                                         FileAttribute attr, Modes modes)
+{
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  Node* entry = GetNode(path);
+  if (!entry)
+    return ResultCode::NotFound;
+
+  if (caller_uid != 0 && caller_uid != entry->data.uid)
+    return ResultCode::AccessDenied;
+  if (caller_uid != 0 && uid != entry->data.uid)
+    return ResultCode::AccessDenied;
+
+  const u32 size = entry->contents ? static_cast<u32>(entry->contents->size()) : entry->data.size;
+  if (entry->data.uid != uid && entry->data.is_file && size != 0)
+    return ResultCode::FileNotEmpty;
+
+  if (entry->data.gid != gid || entry->data.uid != uid || entry->data.attribute != attr ||
+      entry->data.modes != modes)
+  {
+    entry->data.gid = gid;
+    entry->data.uid = uid;
+    entry->data.attribute = attr;
+    entry->data.modes = modes;
+    m_modified_paths.insert(path);
+  }
+
+  return ResultCode::Success;
+}
+
+Result<NandStats> MemoryFileSystem::GetNandStats()
+{
+  const auto root_stats = GetDirectoryStats("/");
+  if (!root_stats)
+    return root_stats.Error();
+
+  NandStats stats{};
+  stats.cluster_size = CLUSTER_SIZE;
+  stats.free_clusters = USABLE_CLUSTERS - root_stats->used_clusters;
+  stats.used_clusters = root_stats->used_clusters;
+  stats.bad_clusters = 0;
+  stats.reserved_clusters = RESERVED_CLUSTERS;
+  stats.free_inodes = TOTAL_INODES - root_stats->used_inodes;
+  stats.used_inodes = root_stats->used_inodes;
+
+  return stats;
+}
+
+Result<DirectoryStats> MemoryFileSystem::GetDirectoryStats(const std::string& wii_path)
+{
+  const auto result = GetExtendedDirectoryStats(wii_path);
+  if (!result)
+    return result.Error();
+
+  DirectoryStats stats{};
+  stats.used_inodes = static_cast<u32>(std::min<u64>(result->used_inodes, TOTAL_INODES));
+  stats.used_clusters = static_cast<u32>(std::min<u64>(result->used_clusters, USABLE_CLUSTERS));
+  return stats;
+}
+
+Result<ExtendedDirectoryStats>
+MemoryFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
+{
+  if (!IsValidPath(wii_path))
+    return ResultCode::Invalid;
+
+  Node* entry = GetNode(wii_path);
+  if (!entry)
+    return ResultCode::NotFound;
+  if (entry->data.is_file)
+    return ResultCode::Invalid;
+
+  LoadEverything(*entry, wii_path);
+
+  const auto count = [](const auto& self, const Node& node, bool is_root,
+                        ExtendedDirectoryStats* stats) -> void {
+    for (const Node& child : node.children)
+    {
+      if (!IsVisible(child.data, child.name, is_root))
+        continue;
+
+      ++stats->used_inodes;
+      if (!child.data.is_file)
+      {
+        self(self, child, false, stats);
+        continue;
+      }
+      const u64 size = child.contents ? child.contents->size() : child.data.size;
+      stats->used_clusters += Common::AlignUp(size, CLUSTER_SIZE) / CLUSTER_SIZE;
+    }
+  };
+
+  // Add one for the folder itself.
+  ExtendedDirectoryStats stats{};
+  stats.used_inodes = 1;
+  count(count, *entry, wii_path == "/", &stats);
+  return stats;
+}
+
+void MemoryFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
+{
+  // Redirected paths are only ever read from the base, changes to them stay in memory too.
+  if (!nand_redirects.empty())
+    WARN_LOG_FMT(IOS_FS, "NAND redirects are read-only with an in-memory NAND");
+  if (m_base)
+    m_base->SetNandRedirects(std::move(nand_redirects));
+}
+
+std::vector<std::string> MemoryFileSystem::GetModifiedPaths() const
+{
+  return {m_modified_paths.begin(), m_modified_paths.end()};
+}
+
+MemoryFileSystem::Handle* MemoryFileSystem::AssignFreeHandle()
+{
+  const auto it = std::find_if(m_handles.begin(), m_handles.end(),
+                               [](const Handle& handle) { return !handle.opened; });
+  if (it == m_handles.end())
+    return nullptr;
+
+  *it = Handle{};
+  it->opened = true;
+  return &*it;
+}
+
+MemoryFileSystem::Handle* MemoryFileSystem::GetHandleFromFd(Fd fd)
+{
+  if (fd >= m_handles.size() || !m_handles[fd].opened)
+    return nullptr;
+  return &m_handles[fd];
+}
+
+Fd MemoryFileSystem::ConvertHandleToFd(const Handle* handle) const
+{
+  return handle - m_handles.data();
+}
+}  // namespace IOS::HLE::FS
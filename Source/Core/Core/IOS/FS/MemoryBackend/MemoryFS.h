@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/IOS/FS/FileSystem.h"
+
+namespace IOS::HLE::FS
+{
+/// Backend that keeps the whole file system in memory.
+///
+/// Files and directories which haven't been created in memory are loaded lazily from a base
+/// file system, which is never written to. This makes it possible to run a session on top of an
+/// existing NAND and to discard (or inspect) the changes afterwards. Without a base, the file
+/// system starts out empty.
+class MemoryFileSystem final : public FileSystem
+{
+public:
+  explicit MemoryFileSystem(std::unique_ptr<FileSystem> base = nullptr);
+  ~MemoryFileSystem();
+
+  void DoState(PointerWrap& p) override;
+
+  ResultCode Format(Uid uid) override;
+
+  Result<FileHandle> OpenFile(Uid uid, Gid gid, const std::string& path, Mode mode) override;
+  ResultCode Close(Fd fd) override;
+  Result<u32> ReadBytesFromFile(Fd fd, u8* ptr, u32 size) override;
+  Result<u32> WriteBytesToFile(Fd fd, const u8* ptr, u32 size) override;
+  Result<u32> SeekFile(Fd fd, u32 offset, SeekMode mode) override;
+  Result<FileStatus> GetFileStatus(Fd fd) override;
+
+  ResultCode CreateFile(Uid caller_uid, Gid caller_gid, const std::string& path,
+                        FileAttribute attribute, Modes modes) override;
+
+  ResultCode CreateDirectory(Uid caller_uid, Gid caller_gid, const std::string& path,
+                             FileAttribute attribute, Modes modes) override;
+
+  ResultCode Delete(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode Rename(Uid caller_uid, Gid caller_gid, const std::string& old_path,
+                    const std::string& new_path) override;
+
+  Result<std::vector<std::string>> ReadDirectory(Uid caller_uid, Gid caller_gid,
+                                                 const std::string& path) override;
+
+  Result<Metadata> GetMetadata(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                         FileAttribute attribute, Modes modes) override;
+
+  Result<NandStats> GetNandStats() override;
+  Result<DirectoryStats> GetDirectoryStats(const std::string& path) override;
+  Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) override;
+
+  void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
+
+  void Update() override {}
+  void Flush() override {}
+
+  /// Paths that were created, written to, deleted, renamed or had their metadata changed since
+  /// the file system was created, sorted.
+  std::vector<std::string> GetModifiedPaths() const;
+
+private:
+  struct Node
+  {
+    std::string name;
+    Metadata data{};
+    /// Contents of a file. Null until the file is loaded from the base file system.
+    std::shared_ptr<std::vector<u8>> contents;
+    /// Children of a directory, oldest first. Only valid once children_loaded is set.
+    std::vector<Node> children;
+    bool children_loaded = false;
+  };
+
+  struct Handle
+  {
+    bool opened = false;
+    Mode mode = Mode::None;
+    std::string wii_path;
+    std::shared_ptr<std::vector<u8>> contents;
+    u32 file_offset = 0;
+  };
+  Handle* AssignFreeHandle();
+  Handle* GetHandleFromFd(Fd fd);
+  Fd ConvertHandleToFd(const Handle* handle) const;
+
+  /// Returns the node for a path, or nullptr if the path is invalid or doesn't exist.
+  Node* GetNode(const std::string& path);
+  std::vector<Node>& GetChildren(Node& node, const std::string& path);
+  const std::shared_ptr<std::vector<u8>>& GetContents(Node& node, const std::string& path);
+  void LoadEverything(Node& node, const std::string& path);
+  void DoStateNode(PointerWrap& p, Node& node);
+
+  ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                   FileAttribute attribute, Modes modes, bool is_file);
+  bool IsFileOpened(const std::string& path) const;
+  bool IsDirectoryInUse(const std::string& path) const;
+
+  std::unique_ptr<FileSystem> m_base;
+  Node m_root_entry{};
+  std::array<Handle, 16> m_handles{};
+  std::set<std::string> m_modified_paths;
+};
+}  // namespace IOS::HLE::FS
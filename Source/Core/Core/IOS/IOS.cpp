@@ -288,7 +288,7 @@ Kernel::Kernel(IOSC::ConsoleType console_type) : m_iosc(console_type)
   if (m_is_responsible_for_nand_root)
     Core::InitializeWiiRoot(false);
 
-  m_fs = FS::MakeFileSystem(IOS::HLE::FS::Location::Session, Core::GetActiveNandRedirects());
+  m_fs = Core::GetSessionFileSystem();
   ASSERT(m_fs);
 
   m_fs_core = std::make_unique<FSCore>(*this);
@@ -298,7 +298,11 @@ Kernel::Kernel(IOSC::ConsoleType console_type) : m_iosc(console_type)
 Kernel::~Kernel()
 {
   if (m_is_responsible_for_nand_root)
+  {
+    // Write the cached changes while the NAND root still exists.
+    m_fs->Flush();
     Core::ShutdownWiiRoot();
+  }
 }
 
 Kernel::Kernel(u64 title_id) : m_title_id(title_id)
@@ -319,7 +323,7 @@ EmulationKernel::EmulationKernel(Core::System& system, u64 title_id)
     return;
   }
 
-  m_fs = FS::MakeFileSystem(IOS::HLE::FS::Location::Session, Core::GetActiveNandRedirects());
+  m_fs = Core::GetSessionFileSystem();
   ASSERT(m_fs);
 
   AddDevice(std::make_unique<AesDevice>(*this, "/dev/aes"));
@@ -847,6 +851,9 @@ void EmulationKernel::UpdateDevices()
       entry.second->Update();
     }
   }
+
+  if (m_fs)
+    m_fs->Update();
 }
 
 void EmulationKernel::UpdateWantDeterminism(const bool new_want_determinism)
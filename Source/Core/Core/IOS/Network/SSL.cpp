@@ -120,6 +120,46 @@ NetSSLDevice::~NetSSLDevice()
       ssl.active = false;
     }
   }
+
+  for (auto& [key, session] : m_session_cache)
+    mbedtls_ssl_session_free(&session);
+}
+
+void NetSSLDevice::SaveSession(WII_SSL& ssl)
+{
+  if (ssl.ctx.state != MBEDTLS_SSL_HANDSHAKE_OVER)
+    return;
+
+  const SessionKey key{ssl.hostname, ssl.config.authmode};
+  // Titles only talk to a handful of servers, this just keeps a misbehaving one from growing the
+  // cache forever.
+  constexpr size_t MAX_CACHED_SESSIONS = 16;
+  if (m_session_cache.size() >= MAX_CACHED_SESSIONS && !m_session_cache.contains(key))
+  {
+    mbedtls_ssl_session_free(&m_session_cache.begin()->second);
+    m_session_cache.erase(m_session_cache.begin());
+  }
+
+  auto [it, inserted] = m_session_cache.try_emplace(key);
+  if (inserted)
+    mbedtls_ssl_session_init(&it->second);
+  if (mbedtls_ssl_get_session(&ssl.ctx, &it->second) != 0)
+  {
+    mbedtls_ssl_session_free(&it->second);
+    m_session_cache.erase(it);
+  }
+}
+
+void NetSSLDevice::ResumeSession(WII_SSL& ssl)
+{
+  // If the server still knows the session, resuming it skips the key exchange and the certificate
+  // verification. Otherwise, mbedTLS falls back to a full handshake.
+  const auto it = m_session_cache.find({ssl.hostname, ssl.config.authmode});
+  if (it == m_session_cache.end())
+    return;
+
+  if (mbedtls_ssl_set_session(&ssl.ctx, &it->second) == 0)
+    INFO_LOG_FMT(IOS_SSL, "Resuming the TLS session with {}", ssl.hostname);
 }
 
 int NetSSLDevice::GetSSLFreeID() const
@@ -271,7 +311,6 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       mbedtls_ssl_conf_max_version(&ssl->config, MBEDTLS_SSL_MAJOR_VERSION_3,
                                    MBEDTLS_SSL_MINOR_VERSION_2);
       mbedtls_ssl_conf_cert_profile(&ssl->config, &mbedtls_x509_crt_profile_wii);
-      mbedtls_ssl_set_session(&ssl->ctx, &ssl->session);
 
       if (Config::Get(Config::MAIN_NETWORK_SSL_VERIFY_CERTIFICATES) && verifyOption)
         mbedtls_ssl_conf_authmode(&ssl->config, MBEDTLS_SSL_VERIFY_REQUIRED);
@@ -306,6 +345,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     {
       WII_SSL* ssl = &_SSL[sslID];
 
+      SaveSession(*ssl);
       mbedtls_ssl_close_notify(&ssl->ctx);
 
       mbedtls_x509_crt_free(&ssl->cacert);
@@ -501,6 +541,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       ssl->hostfd = GetEmulationKernel().GetSocketManager()->GetHostSocket(ssl->sockfd);
       INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_CONNECT socket = {}", ssl->sockfd);
       mbedtls_ssl_set_bio(&ssl->ctx, ssl, SSLSendWithoutSNI, SSLRecv, nullptr);
+      ResumeSession(*ssl);
       WriteReturnValue(memory, SSL_OK, BufferIn);
     }
     else
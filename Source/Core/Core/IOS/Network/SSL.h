@@ -13,7 +13,9 @@
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl.h>
 #include <mbedtls/x509_crt.h>
+#include <map>
 #include <string>
+#include <utility>
 
 // clang-format on
 
@@ -94,7 +96,15 @@ public:
   static WII_SSL _SSL[NET_SSL_MAXINSTANCES];
 
 private:
+  // Sessions are cached by hostname and verification mode, so that a session which was established
+  // without verifying the certificate is never resumed by a connection which requires it.
+  using SessionKey = std::pair<std::string, int>;
+
+  void SaveSession(WII_SSL& ssl);
+  void ResumeSession(WII_SSL& ssl);
+
   bool m_cert_error_shown = false;
+  std::map<SessionKey, mbedtls_ssl_session> m_session_cache;
 };
 
 constexpr bool IsSSLIDValid(int id)
@@ -1011,10 +1011,15 @@ void WiiSockMan::Update()
     const WiiSocket& sock = socket_iter->second;
     if (sock.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      // Only sockets with blocked requests need to be checked. Titles keep their sockets open
+      // while idle, and this runs on the CPU thread for every IPC update.
+      if (sock.HasPendingOps())
+      {
+        FD_SET(sock.fd, &read_fds);
+        FD_SET(sock.fd, &write_fds);
+        FD_SET(sock.fd, &except_fds);
+        nfds = std::max(nfds, sock.fd + 1);
+      }
       ++socket_iter;
     }
     else
@@ -1024,22 +1029,24 @@ void WiiSockMan::Update()
     }
   }
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
-
-  if (ret >= 0)
+  if (nfds != 0)
   {
+    const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
     for (auto& pair : WiiSockets)
     {
       WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
-  }
-  else
-  {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
+      if (!sock.HasPendingOps())
+        continue;
+
+      if (ret >= 0)
+      {
+        sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
+                    FD_ISSET(sock.fd, &except_fds) != 0);
+      }
+      else
+      {
+        sock.Update(false, false, false);
+      }
     }
   }
   UpdatePollCommands();
@@ -1209,6 +1216,10 @@ void WiiSockMan::DoState(PointerWrap& p)
 
 void WiiSockMan::AddPollCommand(const PollCommand& cmd)
 {
+  // The timeouts are only updated while there are pending polls, so the time spent without any
+  // must not count towards the timeout of this one.
+  if (pending_polls.empty())
+    last_time = std::chrono::high_resolution_clock::now();
   pending_polls.push_back(cmd);
 }
 
@@ -226,6 +226,7 @@ private:
   void UpdateConnectingState(s32 connect_rv);
   ConnectingState GetConnectingState() const;
   bool IsValid() const { return fd >= 0; }
+  bool HasPendingOps() const { return !pending_sockops.empty(); }
   bool IsTCP() const;
 
   WiiSockMan& m_socket_manager;
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cstring>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -25,6 +26,12 @@
 
 namespace IOS::HLE::USB
 {
+// How many completed transfers of each kind are kept for reuse.
+constexpr size_t MAX_FREE_TRANSFERS = 16;
+// Isochronous transfers are allocated for the largest number of packets IOS can ask for, so that
+// any of them can be reused for any request.
+constexpr int MAX_ISO_PACKETS = std::numeric_limits<decltype(IsoMessage::num_packets)>::max();
+
 LibusbDevice::LibusbDevice(EmulationKernel& ios, libusb_device* device,
                            const libusb_device_descriptor& descriptor)
     : m_ios(ios), m_device(device)
@@ -56,6 +63,11 @@ LibusbDevice::~LibusbDevice()
     libusb_close(m_handle);
   }
   libusb_unref_device(m_device);
+
+  for (libusb_transfer* transfer : m_free_transfers)
+    libusb_free_transfer(transfer);
+  for (libusb_transfer* transfer : m_free_iso_transfers)
+    libusb_free_transfer(transfer);
 }
 
 DeviceDescriptor LibusbDevice::GetDeviceDescriptor() const
@@ -171,10 +183,10 @@ int LibusbDevice::CancelTransfer(const u8 endpoint)
 {
   INFO_LOG_FMT(IOS_USB, "[{:04x}:{:04x} {}] Cancelling transfers (endpoint {:#x})", m_vid, m_pid,
                m_active_interface, endpoint);
-  const auto iterator = m_transfer_endpoints.find(endpoint);
-  if (iterator == m_transfer_endpoints.cend())
+  TransferEndpoint& transfer_endpoint = GetTransferEndpoint(endpoint);
+  if (!transfer_endpoint.WasUsed())
     return IPC_ENOENT;
-  iterator->second.CancelTransfers();
+  transfer_endpoint.CancelTransfers();
   return IPC_SUCCESS;
 }
 
@@ -253,11 +265,9 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<CtrlMessage> cmd)
   auto& memory = system.GetMemory();
   memory.CopyFromEmu(buffer.get() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(0);
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
+  libusb_transfer* transfer = AllocateTransfer(false);
   libusb_fill_control_transfer(transfer, m_handle, buffer.release(), CtrlTransferCallback, this, 0);
-  m_transfer_endpoints[0].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return SubmitToEndpoint(std::move(cmd), transfer);
 }
 
 int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
@@ -268,13 +278,11 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
   DEBUG_LOG_FMT(IOS_USB, "[{:04x}:{:04x} {}] Bulk: length={:04x} endpoint={:02x}", m_vid, m_pid,
                 m_active_interface, cmd->length, cmd->endpoint);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(0);
+  libusb_transfer* transfer = AllocateTransfer(false);
   libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint,
                             cmd->MakeBuffer(cmd->length).release(), cmd->length, TransferCallback,
                             this, 0);
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return SubmitToEndpoint(std::move(cmd), transfer);
 }
 
 int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
@@ -285,13 +293,11 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
   DEBUG_LOG_FMT(IOS_USB, "[{:04x}:{:04x} {}] Interrupt: length={:04x} endpoint={:02x}", m_vid,
                 m_pid, m_active_interface, cmd->length, cmd->endpoint);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(0);
+  libusb_transfer* transfer = AllocateTransfer(false);
   libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint,
                                  cmd->MakeBuffer(cmd->length).release(), cmd->length,
                                  TransferCallback, this, 0);
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return SubmitToEndpoint(std::move(cmd), transfer);
 }
 
 int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
@@ -303,12 +309,11 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
                 "[{:04x}:{:04x} {}] Isochronous: length={:04x} endpoint={:02x} num_packets={:02x}",
                 m_vid, m_pid, m_active_interface, cmd->length, cmd->endpoint, cmd->num_packets);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(cmd->num_packets);
+  libusb_transfer* transfer = AllocateTransfer(true);
   transfer->buffer = cmd->MakeBuffer(cmd->length).release();
   transfer->callback = TransferCallback;
   transfer->dev_handle = m_handle;
   transfer->endpoint = cmd->endpoint;
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   for (size_t i = 0; i < cmd->num_packets; ++i)
     transfer->iso_packet_desc[i].length = cmd->packet_sizes[i];
   transfer->length = cmd->length;
@@ -316,8 +321,60 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   transfer->timeout = 0;
   transfer->type = LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
   transfer->user_data = this;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
-  return libusb_submit_transfer(transfer);
+  return SubmitToEndpoint(std::move(cmd), transfer);
+}
+
+LibusbDevice::TransferEndpoint& LibusbDevice::GetTransferEndpoint(u8 endpoint)
+{
+  return m_transfer_endpoints[(endpoint & 0xf) | ((endpoint & LIBUSB_ENDPOINT_IN) >> 3)];
+}
+
+int LibusbDevice::SubmitToEndpoint(std::unique_ptr<TransferCommand> command,
+                                   libusb_transfer* transfer)
+{
+  TransferEndpoint& endpoint = GetTransferEndpoint(transfer->endpoint);
+  endpoint.AddTransfer(std::move(command), transfer);
+  const int ret = libusb_submit_transfer(transfer);
+  if (ret < LIBUSB_SUCCESS)
+  {
+    // The callback will never be called, so the transfer has to be cleaned up here.
+    endpoint.RemoveTransfer(transfer);
+    delete[] transfer->buffer;
+    ReleaseTransfer(transfer);
+  }
+  return ret;
+}
+
+libusb_transfer* LibusbDevice::AllocateTransfer(bool isochronous)
+{
+  {
+    std::lock_guard lk{m_transfer_pool_mutex};
+    auto& free_transfers = isochronous ? m_free_iso_transfers : m_free_transfers;
+    if (!free_transfers.empty())
+    {
+      libusb_transfer* transfer = free_transfers.back();
+      free_transfers.pop_back();
+      transfer->flags = 0;
+      transfer->num_iso_packets = 0;
+      return transfer;
+    }
+  }
+  return libusb_alloc_transfer(isochronous ? MAX_ISO_PACKETS : 0);
+}
+
+void LibusbDevice::ReleaseTransfer(libusb_transfer* transfer)
+{
+  {
+    std::lock_guard lk{m_transfer_pool_mutex};
+    const bool isochronous = transfer->type == LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
+    auto& free_transfers = isochronous ? m_free_iso_transfers : m_free_transfers;
+    if (free_transfers.size() < MAX_FREE_TRANSFERS)
+    {
+      free_transfers.push_back(transfer);
+      return;
+    }
+  }
+  libusb_free_transfer(transfer);
 }
 
 void LibusbDevice::CtrlTransferCallback(libusb_transfer* transfer)
@@ -328,12 +385,13 @@ void LibusbDevice::CtrlTransferCallback(libusb_transfer* transfer)
     // The return code is the total transfer length -- *including* the setup packet.
     return transfer->length;
   });
+  device->ReleaseTransfer(transfer);
 }
 
 void LibusbDevice::TransferCallback(libusb_transfer* transfer)
 {
   auto* device = static_cast<LibusbDevice*>(transfer->user_data);
-  device->m_transfer_endpoints[transfer->endpoint].HandleTransfer(transfer, [&](const auto& cmd) {
+  device->GetTransferEndpoint(transfer->endpoint).HandleTransfer(transfer, [&](const auto& cmd) {
     switch (transfer->type)
     {
     case LIBUSB_TRANSFER_TYPE_ISOCHRONOUS:
@@ -351,6 +409,7 @@ void LibusbDevice::TransferCallback(libusb_transfer* transfer)
       return static_cast<s32>(transfer->actual_length);
     }
   });
+  device->ReleaseTransfer(transfer);
 }
 
 static const std::map<u8, const char*> s_transfer_types = {
@@ -365,21 +424,37 @@ void LibusbDevice::TransferEndpoint::AddTransfer(std::unique_ptr<TransferCommand
 {
   std::lock_guard lk{m_transfers_mutex};
   m_transfers.emplace(transfer, std::move(command));
+  m_was_used = true;
 }
 
-void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
-                                                    std::function<s32(const TransferCommand&)> fn)
+std::unique_ptr<TransferCommand>
+LibusbDevice::TransferEndpoint::RemoveTransfer(libusb_transfer* transfer)
 {
   std::lock_guard lk{m_transfers_mutex};
   const auto iterator = m_transfers.find(transfer);
   if (iterator == m_transfers.cend())
+    return nullptr;
+
+  std::unique_ptr<TransferCommand> command = std::move(iterator->second);
+  m_transfers.erase(iterator);
+  return command;
+}
+
+void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
+                                                    std::function<s32(const TransferCommand&)> fn)
+{
+  const std::unique_ptr<u8[]> buffer(transfer->buffer);
+
+  // The command is taken out of the map first so that the lock isn't held while the data is
+  // copied to emulated memory and the reply is queued.
+  const std::unique_ptr<TransferCommand> command = RemoveTransfer(transfer);
+  if (!command)
   {
     ERROR_LOG_FMT(IOS_USB, "No such transfer");
     return;
   }
 
-  const std::unique_ptr<u8[]> buffer(transfer->buffer);
-  const auto& cmd = *iterator->second.get();
+  const auto& cmd = *command;
   const auto* device = static_cast<LibusbDevice*>(transfer->user_data);
   s32 return_value = LIBUSB_SUCCESS;
   switch (transfer->status)
@@ -403,7 +478,6 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
     break;
   }
   cmd.OnTransferComplete(return_value);
-  m_transfers.erase(transfer);
 }
 
 void LibusbDevice::TransferEndpoint::CancelTransfers()
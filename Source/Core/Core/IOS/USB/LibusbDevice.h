@@ -4,6 +4,7 @@
 #pragma once
 
 #if defined(__LIBUSB__)
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <map>
@@ -61,17 +62,32 @@ private:
   {
   public:
     void AddTransfer(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
+    std::unique_ptr<TransferCommand> RemoveTransfer(libusb_transfer* transfer);
     void HandleTransfer(libusb_transfer* tr, std::function<s32(const TransferCommand&)> function);
     void CancelTransfers();
+    bool WasUsed() const { return m_was_used; }
 
   private:
     std::mutex m_transfers_mutex;
     std::map<libusb_transfer*, std::unique_ptr<TransferCommand>> m_transfers;
+    bool m_was_used = false;
   };
-  std::map<u8, TransferEndpoint> m_transfer_endpoints;
+  // Indexed by endpoint number, with the IN endpoints in the upper half. This is a fixed array
+  // because the libusb event thread looks endpoints up while the CPU thread submits transfers.
+  std::array<TransferEndpoint, 32> m_transfer_endpoints;
+  TransferEndpoint& GetTransferEndpoint(u8 endpoint);
+  int SubmitToEndpoint(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
   static void CtrlTransferCallback(libusb_transfer* transfer);
   static void TransferCallback(libusb_transfer* transfer);
 
+  // Completed transfers are kept around and reused instead of being freed and reallocated for
+  // every request, since some devices have transfers in flight all the time.
+  libusb_transfer* AllocateTransfer(bool isochronous);
+  void ReleaseTransfer(libusb_transfer* transfer);
+  std::mutex m_transfer_pool_mutex;
+  std::vector<libusb_transfer*> m_free_transfers;
+  std::vector<libusb_transfer*> m_free_iso_transfers;
+
   int ClaimAllInterfaces(u8 config_num) const;
   int ReleaseAllInterfaces(u8 config_num) const;
   int ReleaseAllInterfacesForCurrentConfig() const;
@@ -3,12 +3,15 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
-#include <iostream>
+#include <iterator>
 #include <sstream>
 #include <unistd.h>
 
+#include <fmt/format.h>
+
 #include "Common/FileUtil.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
@@ -43,19 +46,24 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   while (std::getline(locations, line))
     ParseLine(line);
 
-  return !m_values.empty();
+  // Duplicate lines are only watched once.
+  std::ranges::sort(m_watches, {}, &Watch::address);
+  const auto duplicates = std::ranges::unique(m_watches, {}, &Watch::address);
+  m_watches.erase(duplicates.begin(), duplicates.end());
+
+  return !m_watches.empty();
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch& watch = m_watches.emplace_back();
+  watch.address = line;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,10 +75,10 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const Watch& watch)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : watch.offsets)
   {
     value = PowerPC::MMU::HostRead_U32(guard, value + offset);
     if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
@@ -79,26 +87,20 @@ u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::st
   return value;
 }
 
-std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
+void MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
 {
-  std::ostringstream message_stream;
-  message_stream << std::hex;
+  m_message.clear();
 
-  for (auto& entry : m_values)
+  for (Watch& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    const u32 new_value = ChasePointer(guard, watch);
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watch.value = new_value;
+      fmt::format_to(std::back_inserter(m_message), "{}\n{:x}\n", watch.address, new_value);
     }
   }
-
-  return message_stream.str();
 }
 
 void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
@@ -106,7 +108,7 @@ void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
   if (!m_running)
     return;
 
-  std::string message = ComposeMessages(guard);
-  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
+  ComposeMessages(guard);
+  sendto(m_fd, m_message.c_str(), m_message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
          sizeof(m_addr));
 }
@@ -5,7 +5,6 @@
 
 #include "Common/CommonTypes.h"
 
-#include <map>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -35,17 +34,26 @@ private:
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
 
+  struct Watch
+  {
+    // Address as stored in the file
+    std::string address;
+    // List of offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
+
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
-  std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  static u32 ChasePointer(const Core::CPUThreadGuard& guard, const Watch& watch);
+  void ComposeMessages(const Core::CPUThreadGuard& guard);
 
   bool m_running = false;
 
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  // Sorted by address, which is the order the changes are sent in.
+  std::vector<Watch> m_watches;
+  // Reused for every step, so that it doesn't have to be reallocated every frame.
+  std::string m_message;
 };
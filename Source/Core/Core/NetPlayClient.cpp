@@ -40,6 +40,7 @@
 #include "Core/Config/SessionSettings.h"
 #include "Core/Config/WiimoteSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/GeckoCode.h"
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
@@ -65,6 +66,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/StateHash.h"
 #include "Core/SyncIdentifier.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
@@ -75,6 +77,7 @@
 #include "UICommon/GameFile.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/VideoEvents.h"
 
 namespace NetPlay
 {
@@ -926,6 +929,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.sync_codes;
 
     packet >> m_net_settings.golf_mode;
+    packet >> m_net_settings.rollback;
     packet >> m_net_settings.use_fma;
     packet >> m_net_settings.hide_remote_gbas;
 
@@ -983,8 +987,10 @@ void NetPlayClient::OnDesyncDetected(sf::Packet& packet)
 {
   int pid_to_blame;
   u32 frame;
+  bool is_state_hash;
   packet >> pid_to_blame;
   packet >> frame;
+  packet >> is_state_hash;
 
   std::string player = "??";
   std::lock_guard lkp(m_crit.players);
@@ -994,9 +1000,13 @@ void NetPlayClient::OnDesyncDetected(sf::Packet& packet)
       player = it->second.name;
   }
 
-  INFO_LOG_FMT(NETPLAY, "Player {} ({}) desynced!", player, pid_to_blame);
+  std::string region;
+  if (is_state_hash)
+    region = StateHash::DescribeFrameRegion(Core::System::GetInstance(), frame);
+
+  INFO_LOG_FMT(NETPLAY, "Player {} ({}) desynced! {}", player, pid_to_blame, region);
 
-  m_dialog->OnDesync(frame, player);
+  m_dialog->OnDesync(frame, player, region);
 }
 
 void NetPlayClient::OnSyncSaveData(sf::Packet& packet)
@@ -1045,9 +1055,46 @@ void NetPlayClient::OnSyncSaveDataNotify(sf::Packet& packet)
   INFO_LOG_FMT(NETPLAY, "Initializing wait for {} savegame chunks.", m_sync_save_data_count);
 
   if (m_sync_save_data_count == 0)
+  {
     SyncSaveDataResponse(true);
-  else
-    m_dialog->AppendChat(Common::GetStringT("Synchronizing save data..."));
+    return;
+  }
+
+  m_dialog->AppendChat(Common::GetStringT("Synchronizing save data..."));
+
+  // Memory cards and GBA saves are kept from the last session, so usually only a few blocks of
+  // them have changed since then. Wii saves are deleted when the game stops.
+  constexpr size_t MAX_SAVE_BLOCK_CACHE_SIZE = 64 * 1024 * 1024;
+  m_sync_save_block_cache.clear();
+  const auto add_temporary_files = [this](const std::string& dir, std::string_view prefix,
+                                          std::string_view extension) {
+    for (const File::FSTEntry& entry : File::ScanDirectoryTree(dir, false).children)
+    {
+      const std::string& name = entry.virtualName;
+      if (!entry.isDirectory && name.starts_with(prefix) && name.ends_with(extension))
+      {
+        AddToSaveBlockCache(entry.physicalName, m_sync_save_block_cache,
+                            MAX_SAVE_BLOCK_CACHE_SIZE);
+      }
+    }
+  };
+  add_temporary_files(File::GetUserPath(D_GCUSER_IDX), GC_MEMCARD_NETPLAY, ".raw");
+  AddToSaveBlockCache(File::GetUserPath(D_GCUSER_IDX) + GC_MEMCARD_NETPLAY DIR_SEP,
+                      m_sync_save_block_cache, MAX_SAVE_BLOCK_CACHE_SIZE);
+  add_temporary_files(File::GetUserPath(D_GBAUSER_IDX), GBA_SAVE_NETPLAY, ".sav");
+
+  INFO_LOG_FMT(NETPLAY, "Advertising {} known save data blocks.", m_sync_save_block_cache.size());
+
+  sf::Packet response_packet;
+  response_packet << MessageID::SyncSaveData;
+  response_packet << SyncSaveDataID::BlockHashes;
+  response_packet << static_cast<u32>(m_sync_save_block_cache.size());
+  for (const auto& [hash, block] : m_sync_save_block_cache)
+  {
+    for (u8 byte : hash)
+      response_packet << byte;
+  }
+  Send(response_packet);
 }
 
 void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
@@ -1084,7 +1131,7 @@ void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
     return;
   }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = DecompressPacketIntoFile(packet, path, &m_sync_save_block_cache);
   SyncSaveDataResponse(success);
 }
 
@@ -1116,7 +1163,7 @@ void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
     INFO_LOG_FMT(NETPLAY, "Received GCI: {}", file_name);
 
     if (!Common::IsFileNameSafe(file_name) ||
-        !DecompressPacketIntoFile(packet, path + DIR_SEP + file_name))
+        !DecompressPacketIntoFile(packet, path + DIR_SEP + file_name, &m_sync_save_block_cache))
     {
       WARN_LOG_FMT(NETPLAY, "Received invalid GCI.");
       SyncSaveDataResponse(false);
@@ -1295,7 +1342,7 @@ void NetPlayClient::OnSyncSaveDataGBA(sf::Packet& packet)
     return;
   }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = DecompressPacketIntoFile(packet, path, &m_sync_save_block_cache);
   SyncSaveDataResponse(success);
 }
 
@@ -1580,6 +1627,13 @@ void NetPlayClient::SendAsync(sf::Packet&& packet, const u8 channel_id)
   Common::ENet::WakeupThread(m_client);
 }
 
+// called from ---CPU--- thread
+void NetPlayClient::SendInputAsync(sf::Packet&& packet)
+{
+  m_input_send_queue.Push(AsyncQueueEntry{std::move(packet), DEFAULT_CHANNEL});
+  Common::ENet::WakeupThread(m_client);
+}
+
 // called from ---NETPLAY--- thread
 void NetPlayClient::ThreadFunc()
 {
@@ -1618,6 +1672,11 @@ void NetPlayClient::ThreadFunc()
       INFO_LOG_FMT(NETPLAY, "Processing async queue event done.");
       m_async_queue.Pop();
     }
+    while (!m_input_send_queue.Empty())
+    {
+      Send(m_input_send_queue.Front().packet);
+      m_input_send_queue.Pop();
+    }
     if (net > 0)
     {
       sf::Packet rpac;
@@ -1754,6 +1813,13 @@ bool NetPlayClient::StartGame(const std::string& path)
   m_current_golfer = 1;
   m_wait_on_input = false;
 
+  m_frame_input_wait = {};
+  m_last_frame_input_wait_ms.store(0.0, std::memory_order_relaxed);
+  m_max_frame_input_wait_ms.store(0.0, std::memory_order_relaxed);
+  m_total_input_wait_ms.store(0.0, std::memory_order_relaxed);
+  m_input_wait_frames.store(0, std::memory_order_relaxed);
+  m_input_blocked_frames.store(0, std::memory_order_relaxed);
+
   m_is_running.Set();
   NetPlay_Enable(this);
 
@@ -1761,7 +1827,32 @@ bool NetPlayClient::StartGame(const std::string& path)
 
   m_first_pad_status_received.fill(false);
 
-  if (m_dialog->IsRecording())
+  const bool uses_wiimotes =
+      std::ranges::any_of(m_wiimote_map, [](PlayerId pid) { return pid > 0; });
+  m_rollback_active = m_net_settings.rollback && !m_host_input_authority && !uses_wiimotes;
+  m_rollback.Reset();
+  if (m_rollback_active)
+  {
+    m_rollback_frame_hook =
+        VIEndFieldEvent::Register([this] { OnRollbackFrameEnd(); }, "NetPlayRollback");
+  }
+  else if (m_net_settings.rollback)
+  {
+    m_dialog->AppendChat(
+        Common::GetStringT("Rollback only supports GameCube controllers. Using input delay."));
+  }
+
+  // With dual core, the GPU thread writes to RAM at points which differ between players. Rollback
+  // runs frames more than once, the first time with predicted inputs.
+  m_state_hash_frame = 0;
+  if (!m_net_settings.cpu_thread && !m_rollback_active)
+  {
+    m_state_hash_frame_hook =
+        VIEndFieldEvent::Register([this] { SendStateHash(); }, "NetPlayStateHash");
+  }
+
+  // Inputs are used more than once when rolling back, so they can't be recorded as they are used.
+  if (m_dialog->IsRecording() && !m_rollback_active)
   {
     auto& movie = Core::System::GetInstance().GetMovie();
     if (movie.IsReadOnly())
@@ -1827,6 +1918,8 @@ void NetPlayClient::SyncSaveDataResponse(const bool success)
   {
     if (++m_sync_save_data_success_count >= m_sync_save_data_count)
     {
+      m_sync_save_block_cache.clear();
+
       sf::Packet response_packet;
       response_packet << MessageID::SyncSaveData;
       response_packet << SyncSaveDataID::Success;
@@ -1836,6 +1929,8 @@ void NetPlayClient::SyncSaveDataResponse(const bool success)
   }
   else
   {
+    m_sync_save_block_cache.clear();
+
     sf::Packet response_packet;
     response_packet << MessageID::SyncSaveData;
     response_packet << SyncSaveDataID::Failure;
@@ -2040,7 +2135,11 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     m_wait_on_input_event.Wait();
   }
 
-  if (IsFirstInGamePad(pad_nb) && batching)
+  // A poll which is run again after a rollback uses the inputs from the first time, which have
+  // already been sent.
+  const bool resimulating = m_rollback_active && m_rollback.IsResimulatingPoll(pad_nb);
+
+  if (IsFirstInGamePad(pad_nb) && batching && !resimulating)
   {
     sf::Packet packet;
     packet << MessageID::PadData;
@@ -2053,13 +2152,13 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     }
 
     if (send_packet)
-      SendAsync(std::move(packet));
+      SendInputAsync(std::move(packet));
 
     if (m_host_input_authority)
       SendPadHostPoll(-1);
   }
 
-  if (!batching)
+  if (!batching && !resimulating)
   {
     const int local_pad = InGamePadToLocalPad(pad_nb);
     if (local_pad < 4)
@@ -2067,7 +2166,7 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
       sf::Packet packet;
       packet << MessageID::PadData;
       if (PollLocalPad(local_pad, packet))
-        SendAsync(std::move(packet));
+        SendInputAsync(std::move(packet));
     }
 
     if (m_host_input_authority)
@@ -2101,6 +2200,9 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     }
   }
 
+  if (m_rollback_active)
+    return GetRollbackInput(pad_nb, pad_status);
+
   // Now, we either use the data pushed earlier, or wait for the
   // other clients to send it to us
   while (m_pad_buffer[pad_nb].Size() == 0)
@@ -2110,7 +2212,7 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
       return false;
     }
 
-    m_gc_pad_event.Wait();
+    WaitForInput(m_gc_pad_event);
   }
 
   m_pad_buffer[pad_nb].Pop(*pad_status);
@@ -2129,6 +2231,85 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
   return true;
 }
 
+// called from ---CPU--- thread
+void NetPlayClient::WaitForInput(Common::Event& event)
+{
+  const auto start = std::chrono::steady_clock::now();
+  event.Wait();
+  m_frame_input_wait += std::chrono::steady_clock::now() - start;
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::UpdateInputWaitStats()
+{
+  const double wait_ms = std::chrono::duration<double, std::milli>(m_frame_input_wait).count();
+  m_frame_input_wait = {};
+
+  if (wait_ms > m_max_frame_input_wait_ms.load(std::memory_order_relaxed))
+    m_max_frame_input_wait_ms.store(wait_ms, std::memory_order_relaxed);
+  m_last_frame_input_wait_ms.store(wait_ms, std::memory_order_relaxed);
+  m_total_input_wait_ms.store(m_total_input_wait_ms.load(std::memory_order_relaxed) + wait_ms,
+                              std::memory_order_relaxed);
+  m_input_wait_frames.fetch_add(1, std::memory_order_relaxed);
+  if (wait_ms != 0.0)
+    m_input_blocked_frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+// called from ---CPU--- thread
+bool NetPlayClient::GetRollbackInput(const int pad_nb, GCPadStatus* pad_status)
+{
+  while (true)
+  {
+    GCPadStatus received;
+    for (int pad = 0; pad < 4; ++pad)
+    {
+      while (m_pad_buffer[pad].Pop(received))
+        m_rollback.AddInput(pad, received);
+    }
+
+    if (m_rollback.GetInput(pad_nb, pad_status))
+      return true;
+
+    // Too far ahead of the other players to keep predicting their inputs
+    if (!m_is_running.IsSet())
+      return false;
+
+    WaitForInput(m_gc_pad_event);
+  }
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::OnRollbackFrameEnd()
+{
+  if (!m_rollback.OnFrameEnd(Core::System::GetInstance()))
+    return;
+
+  // Loading a state from within the VI event would leave CoreTiming and the JIT in a broken
+  // state, so the rollback happens once the CPU thread has been paused.
+  Core::QueueHostJob([](Core::System& system) {
+    Core::RunOnCPUThread(
+        system,
+        [&system] {
+          std::lock_guard lk(crit_netplay_client);
+          if (netplay_client && netplay_client->m_rollback_active && Core::IsCPUThread())
+            netplay_client->m_rollback.Rollback(system);
+        },
+        true);
+  });
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::SendStateHash()
+{
+  const u32 frame = m_state_hash_frame++;
+
+  sf::Packet packet;
+  packet << MessageID::StateHash;
+  packet << frame;
+  packet << sf::Uint64{StateHash::ComputeFrameHash(Core::System::GetInstance(), frame)};
+  SendInputAsync(std::move(packet));
+}
+
 u64 NetPlayClient::GetInitialRTCValue() const
 {
   return m_initial_rtc;
@@ -2149,7 +2330,7 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
       sf::Packet packet;
       packet << MessageID::WiimoteData;
       if (AddLocalWiimoteToBuffer(local_wiimote, *entry.state, packet))
-        SendAsync(std::move(packet));
+        SendInputAsync(std::move(packet));
     }
 
     // Now, we either use the data pushed earlier, or wait for the
@@ -2161,7 +2342,7 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
         return false;
       }
 
-      m_wii_pad_event.Wait();
+      WaitForInput(m_wii_pad_event);
     }
 
     m_wiimote_buffer[entry.wiimote].Pop(*entry.state);
@@ -2208,6 +2389,18 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
       m_first_pad_status_received[ingame_pad] = true;
     }
   }
+  else if (m_rollback_active)
+  {
+    // The inputs are buffered by the rollback history instead, since it takes them out of the
+    // pad buffer right away.
+    while (m_rollback.GetBufferedInputCount(ingame_pad) <= m_target_buffer_size)
+    {
+      m_rollback.AddInput(ingame_pad, pad_status);
+
+      AddPadStateToPacket(ingame_pad, pad_status, packet);
+      data_added = true;
+    }
+  }
   else
   {
     // adjust the buffer either up or down
@@ -2280,7 +2473,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
         if (!m_is_running.IsSet())
           return;
 
-        m_first_pad_status_received_event.Wait();
+        WaitForInput(m_first_pad_status_received_event);
       }
     }
 
@@ -2301,7 +2494,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
       if (!m_is_running.IsSet())
         return;
 
-      m_first_pad_status_received_event.Wait();
+      WaitForInput(m_first_pad_status_received_event);
     }
 
     if (m_pad_buffer[pad_num].Size() == 0)
@@ -2312,7 +2505,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
     }
   }
 
-  SendAsync(std::move(packet));
+  SendInputAsync(std::move(packet));
 }
 
 void NetPlayClient::InvokeStop()
@@ -2332,6 +2525,8 @@ bool NetPlayClient::StopGame()
   InvokeStop();
 
   NetPlay_Disable();
+  m_rollback_frame_hook.reset();
+  m_state_hash_frame_hook.reset();
 
   // stop game
   m_dialog->StopGame();
@@ -2522,6 +2717,12 @@ void NetPlayClient::SendTimeBase()
 {
   std::lock_guard lk(crit_netplay_client);
 
+  netplay_client->UpdateInputWaitStats();
+
+  // Frames which are run again after a rollback were already counted.
+  if (netplay_client->m_rollback_active && netplay_client->m_rollback.IsResimulating())
+    return;
+
   if (netplay_client->m_timebase_frame % 60 == 0)
   {
     const sf::Uint64 timebase = Core::System::GetInstance().GetSystemTimers().GetFakeTimeBase();
@@ -2531,7 +2732,7 @@ void NetPlayClient::SendTimeBase()
     packet << timebase;
     packet << netplay_client->m_timebase_frame;
 
-    netplay_client->SendAsync(std::move(packet));
+    netplay_client->SendInputAsync(std::move(packet));
   }
 
   netplay_client->m_timebase_frame++;
@@ -2617,6 +2818,24 @@ void NetPlayClient::ComputeGameDigest(const SyncIdentifier& sync_identifier)
   });
 }
 
+std::optional<PadRollback::Stats> NetPlayClient::GetRollbackStats() const
+{
+  if (!m_rollback_active)
+    return std::nullopt;
+  return m_rollback.GetStats();
+}
+
+NetPlayClient::InputWaitStats NetPlayClient::GetInputWaitStats() const
+{
+  InputWaitStats stats;
+  stats.last_frame_ms = m_last_frame_input_wait_ms.load(std::memory_order_relaxed);
+  stats.max_frame_ms = m_max_frame_input_wait_ms.load(std::memory_order_relaxed);
+  stats.total_ms = m_total_input_wait_ms.load(std::memory_order_relaxed);
+  stats.frames = m_input_wait_frames.load(std::memory_order_relaxed);
+  stats.blocked_frames = m_input_blocked_frames.load(std::memory_order_relaxed);
+  return stats;
+}
+
 const PadMappingArray& NetPlayClient::GetPadMapping() const
 {
   return m_pad_map;
@@ -5,10 +5,12 @@
 
 #include <SFML/Network/Packet.hpp>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
@@ -18,9 +20,12 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/HookableEvent.h"
 #include "Common/SPSCQueue.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayProto.h"
+#include "Core/NetPlayRollback.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
 
@@ -65,7 +70,8 @@ public:
   virtual void OnPlayerDisconnect(const std::string& player) = 0;
   virtual void OnPadBufferChanged(u32 buffer) = 0;
   virtual void OnHostInputAuthorityChanged(bool enabled) = 0;
-  virtual void OnDesync(u32 frame, const std::string& player) = 0;
+  // region is the memory region which differed, if known.
+  virtual void OnDesync(u32 frame, const std::string& player, const std::string& region) = 0;
   virtual void OnConnectionLost() = 0;
   virtual void OnConnectionError(const std::string& message) = 0;
   virtual void OnTraversalError(Common::TraversalClient::FailureReason error) = 0;
@@ -174,6 +180,20 @@ public:
 
   void AdjustPadBufferSize(unsigned int size);
 
+  // Returns nothing if the running game doesn't use rollback.
+  std::optional<PadRollback::Stats> GetRollbackStats() const;
+
+  // Time the CPU thread spent waiting for inputs which hadn't arrived yet.
+  struct InputWaitStats
+  {
+    double last_frame_ms = 0.0;
+    double max_frame_ms = 0.0;
+    double total_ms = 0.0;
+    u64 frames = 0;
+    u64 blocked_frames = 0;
+  };
+  InputWaitStats GetInputWaitStats() const;
+
   void SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs, std::vector<u64> titles,
                       std::string redirect_folder);
 
@@ -197,6 +217,9 @@ protected:
   } m_crit;
 
   Common::SPSCQueue<AsyncQueueEntry, false> m_async_queue;
+  // Packets sent by the CPU thread while polling inputs. It is the only producer, so unlike
+  // m_async_queue it doesn't need a lock which other threads could be holding.
+  Common::SPSCQueue<AsyncQueueEntry, false> m_input_send_queue;
 
   std::array<Common::SPSCQueue<GCPadStatus>, 4> m_pad_buffer;
   std::array<Common::SPSCQueue<WiimoteEmu::SerializedWiimoteState>, 4> m_wiimote_buffer;
@@ -239,6 +262,16 @@ protected:
 
   bool m_is_recording = false;
 
+  // Whether the running game uses rollback instead of waiting for remote inputs. This requires
+  // the rollback network mode, and isn't supported for emulated Wii Remotes.
+  bool m_rollback_active = false;
+  PadRollback m_rollback;
+  Common::EventHook m_rollback_frame_hook;
+
+  // Hashes of part of the emulated state are compared every frame when they are deterministic.
+  Common::EventHook m_state_hash_frame_hook;
+  u32 m_state_hash_frame = 0;
+
 private:
   enum class ConnectionState
   {
@@ -256,7 +289,14 @@ private:
   void SyncSaveDataResponse(bool success);
   void SyncCodeResponse(bool success);
 
+  void SendInputAsync(sf::Packet&& packet);
+  void WaitForInput(Common::Event& event);
+  void UpdateInputWaitStats();
+
   bool PollLocalPad(int local_pad, sf::Packet& packet);
+  bool GetRollbackInput(int pad_nb, GCPadStatus* pad_status);
+  void OnRollbackFrameEnd();
+  void SendStateHash();
   void SendPadHostPoll(PadIndex pad_num);
 
   bool AddLocalWiimoteToBuffer(int local_wiimote, const WiimoteEmu::SerializedWiimoteState& state,
@@ -336,12 +376,21 @@ private:
   Common::Event m_wait_on_input_event;
   u8 m_sync_save_data_count = 0;
   u8 m_sync_save_data_success_count = 0;
+  // The save data which is left from earlier sessions, for the blocks which aren't sent again.
+  SaveBlockCache m_sync_save_block_cache;
   u16 m_sync_gecko_codes_count = 0;
   u16 m_sync_gecko_codes_success_count = 0;
   bool m_sync_gecko_codes_complete = false;
   u16 m_sync_ar_codes_count = 0;
   u16 m_sync_ar_codes_success_count = 0;
   bool m_sync_ar_codes_complete = false;
+  std::chrono::steady_clock::duration m_frame_input_wait{};
+  // Only written by the CPU thread, once per frame.
+  std::atomic<double> m_last_frame_input_wait_ms = 0.0;
+  std::atomic<double> m_max_frame_input_wait_ms = 0.0;
+  std::atomic<double> m_total_input_wait_ms = 0.0;
+  std::atomic<u64> m_input_wait_frames = 0;
+  std::atomic<u64> m_input_blocked_frames = 0;
   std::unordered_map<u32, sf::Packet> m_chunked_data_receive_queue;
 
   u64 m_initial_rtc = 0;
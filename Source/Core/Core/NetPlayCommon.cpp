@@ -10,6 +10,7 @@
 
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
 
@@ -17,8 +18,43 @@ namespace NetPlay
 {
 constexpr u32 LZO_IN_LEN = 1024 * 64;
 constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+// Sent instead of the compressed size of a block which the receiver already has, followed by the
+// hash of the block.
+constexpr u32 KNOWN_BLOCK_MARKER = 0xFFFFFFFF;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+void AddToSaveBlockCache(const std::string& path, SaveBlockCache& cache, size_t max_size)
+{
+  if (File::IsDirectory(path))
+  {
+    for (const File::FSTEntry& child : File::ScanDirectoryTree(path, false).children)
+      AddToSaveBlockCache(child.physicalName, cache, max_size);
+    return;
+  }
+
+  File::IOFile file(path, "rb");
+  if (!file)
+    return;
+
+  size_t cached_size = 0;
+  for (const auto& [hash, block] : cache)
+    cached_size += block.size();
+
+  u64 remaining = file.GetSize();
+  while (remaining != 0 && cached_size < max_size)
+  {
+    std::vector<u8> block(std::min<u64>(remaining, LZO_IN_LEN));
+    if (!file.ReadBytes(block.data(), block.size()))
+      return;
+    remaining -= block.size();
+
+    const SaveBlockHash hash = Common::SHA1::CalculateDigest(block);
+    cached_size += block.size();
+    cache.try_emplace(hash, std::move(block));
+  }
+}
+
+bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet,
+                            const std::set<SaveBlockHash>* known_blocks)
 {
   File::IOFile file(file_path, "rb");
   if (!file)
@@ -61,6 +97,22 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
       return false;
     }
 
+    if (known_blocks)
+    {
+      const SaveBlockHash hash = Common::SHA1::CalculateDigest(in_buffer.data(), cur_len);
+      if (known_blocks->contains(hash))
+      {
+        packet << KNOWN_BLOCK_MARKER;
+        for (u8 byte : hash)
+          packet << byte;
+
+        if (cur_len != LZO_IN_LEN)
+          break;
+        i += cur_len;
+        continue;
+      }
+    }
+
     if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
         LZO_E_OK)
     {
@@ -171,7 +223,8 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
   return true;
 }
 
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
+bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path,
+                              const SaveBlockCache* cache)
 {
   u64 file_size = Common::PacketReadU64(packet);
 
@@ -197,6 +250,27 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     if (!cur_len)
       break;  // We reached the end of the data stream
 
+    if (cur_len == KNOWN_BLOCK_MARKER)
+    {
+      SaveBlockHash hash;
+      for (u8& byte : hash)
+        packet >> byte;
+
+      const auto block = cache ? cache->find(hash) : SaveBlockCache::const_iterator();
+      if (!cache || block == cache->end())
+      {
+        ERROR_LOG_FMT(NETPLAY, "Block of {} which should already be known is missing", file_path);
+        return false;
+      }
+
+      if (!file.WriteBytes(block->second.data(), block->second.size()))
+      {
+        PanicAlertFmtT("Error writing file: {0}", file_path);
+        return false;
+      }
+      continue;
+    }
+
     for (size_t j = 0; j < cur_len; j++)
     {
       packet >> in_buffer[j];
@@ -7,11 +7,14 @@
 
 #include <array>
 #include <chrono>
+#include <map>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
 
 namespace NetPlay
 {
@@ -20,10 +23,23 @@ using namespace std::chrono_literals;
 // connection is disconnected
 constexpr std::chrono::milliseconds PEER_TIMEOUT = 30s;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
+// Save data which clients still have from earlier sessions, split into the blocks which files are
+// compressed in and identified by the hash of their contents. Blocks which every client has don't
+// need to be sent again.
+using SaveBlockHash = Common::SHA1::Digest;
+using SaveBlockCache = std::map<SaveBlockHash, std::vector<u8>>;
+
+// Adds the blocks of a file, or of all files in a folder, until the cache holds max_size bytes.
+void AddToSaveBlockCache(const std::string& path, SaveBlockCache& cache, size_t max_size);
+
+// If known_blocks is given, blocks which are in it are only sent as their hash.
+bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet,
+                            const std::set<SaveBlockHash>* known_blocks = nullptr);
 bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet);
 bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet);
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
+// Blocks which were only sent as their hash are taken from cache.
+bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path,
+                              const SaveBlockCache* cache = nullptr);
 bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
 std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
 }  // namespace NetPlay
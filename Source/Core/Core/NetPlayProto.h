@@ -103,6 +103,7 @@ struct NetSettings
   bool sync_codes = false;
   std::string save_data_region;
   bool golf_mode = false;
+  bool rollback = false;
   bool use_fma = false;
   bool hide_remote_gbas = false;
 
@@ -171,6 +172,7 @@ enum class MessageID : u8
 
   TimeBase = 0xB0,
   DesyncDetected = 0xB1,
+  StateHash = 0xB2,
 
   ComputeGameDigest = 0xC0,
   GameDigestProgress = 0xC1,
@@ -206,7 +208,8 @@ enum class SyncSaveDataID : u8
   RawData = 3,
   GCIData = 4,
   WiiData = 5,
-  GBAData = 6
+  GBAData = 6,
+  BlockHashes = 7
 };
 
 enum class SyncCodeID : u8
@@ -0,0 +1,227 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayRollback.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "Common/Logging/Log.h"
+#include "Core/Core.h"
+#include "Core/HW/VideoInterface.h"
+#include "Core/State.h"
+#include "Core/System.h"
+
+namespace NetPlay
+{
+void PadRollback::Reset()
+{
+  // The video interface stops suppressing output by itself when the next game starts.
+  if (m_resimulation_end_frame != 0)
+    Core::SetIsThrottlerTempDisabled(false);
+
+  m_pads = {};
+  m_snapshots.clear();
+  m_spare_state.clear();
+  m_frame = 0;
+  m_resimulation_end_frame = 0;
+  m_rollback_pending = false;
+
+  std::lock_guard lk(m_stats_mutex);
+  m_stats = {};
+}
+
+void PadRollback::AddInput(int pad, const GCPadStatus& status)
+{
+  PadHistory& history = m_pads[pad];
+  const u64 poll = history.confirmed_polls++;
+  history.last_confirmed_input = status;
+
+  const u64 end_poll = history.first_poll + history.inputs.size();
+  if (poll == end_poll)
+  {
+    history.inputs.push_back(status);
+    return;
+  }
+
+  GCPadStatus& predicted = history.inputs[poll - history.first_poll];
+  if (predicted == status)
+    return;
+
+  predicted = status;
+  // If the prediction hasn't been used since the last rollback, the correct input will simply be
+  // used when the poll is run again.
+  if (poll < history.next_poll && !history.first_mispredicted_poll)
+    history.first_mispredicted_poll = poll;
+}
+
+u64 PadRollback::GetBufferedInputCount(int pad) const
+{
+  const PadHistory& history = m_pads[pad];
+  return history.confirmed_polls > history.next_poll ?
+             history.confirmed_polls - history.next_poll :
+             0;
+}
+
+bool PadRollback::IsResimulatingPoll(int pad) const
+{
+  return m_pads[pad].next_poll < m_pads[pad].newest_poll;
+}
+
+bool PadRollback::GetInput(int pad, GCPadStatus* status)
+{
+  PadHistory& history = m_pads[pad];
+  if (history.next_poll == history.first_poll + history.inputs.size())
+  {
+    if (!CanPredict())
+      return false;
+    history.inputs.push_back(history.last_confirmed_input);
+  }
+
+  *status = history.inputs[history.next_poll - history.first_poll];
+  history.next_poll++;
+  history.newest_poll = std::max(history.newest_poll, history.next_poll);
+  return true;
+}
+
+bool PadRollback::CanPredict() const
+{
+  // Without a state from before the prediction, there would be nothing to roll back to.
+  return !m_snapshots.empty() && m_snapshots.size() <= MAX_PREDICTED_FRAMES;
+}
+
+void PadRollback::DropUnneededSnapshots()
+{
+  // Keep the newest snapshot from before all unconfirmed inputs, and the ones after it.
+  while (m_snapshots.size() > 1)
+  {
+    const Snapshot& next = m_snapshots[1];
+    for (size_t i = 0; i < m_pads.size(); ++i)
+    {
+      if (next.next_polls[i] > m_pads[i].confirmed_polls)
+        return;
+    }
+
+    m_spare_state = std::move(m_snapshots.front().state);
+    m_snapshots.pop_front();
+  }
+
+  // Inputs from before the oldest snapshot are never used again. The last confirmed input is kept
+  // separately for predictions.
+  if (m_snapshots.empty())
+    return;
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    PadHistory& history = m_pads[i];
+    const u64 first_needed_poll =
+        std::min(m_snapshots.front().next_polls[i], history.confirmed_polls);
+    while (history.first_poll < first_needed_poll)
+    {
+      history.inputs.pop_front();
+      history.first_poll++;
+    }
+  }
+}
+
+bool PadRollback::OnFrameEnd(Core::System& system)
+{
+  m_frame++;
+  if (m_resimulation_end_frame != 0 && !IsResimulating())
+    FinishResimulation(system);
+
+  DropUnneededSnapshots();
+
+  Snapshot& snapshot = m_snapshots.emplace_back();
+  snapshot.frame = m_frame;
+  for (size_t i = 0; i < m_pads.size(); ++i)
+    snapshot.next_polls[i] = m_pads[i].next_poll;
+  snapshot.state = std::move(m_spare_state);
+  m_spare_state.clear();
+  State::SaveToBuffer(system, snapshot.state);
+
+  if (m_rollback_pending)
+    return false;
+
+  m_rollback_pending = std::ranges::any_of(m_pads, [](const PadHistory& history) {
+    return history.first_mispredicted_poll.has_value();
+  });
+  return m_rollback_pending;
+}
+
+void PadRollback::Rollback(Core::System& system)
+{
+  m_rollback_pending = false;
+
+  // Find the newest snapshot from before every mispredicted input was used.
+  auto snapshot = std::find_if(m_snapshots.rbegin(), m_snapshots.rend(), [this](const Snapshot& s) {
+    for (size_t i = 0; i < m_pads.size(); ++i)
+    {
+      const u64 first_mispredicted_poll =
+          m_pads[i].first_mispredicted_poll.value_or(std::numeric_limits<u64>::max());
+      if (s.next_polls[i] > first_mispredicted_poll)
+        return false;
+    }
+    return true;
+  });
+  if (snapshot == m_snapshots.rend())
+  {
+    ERROR_LOG_FMT(NETPLAY, "No state to roll back to, the game will desync");
+    for (PadHistory& history : m_pads)
+      history.first_mispredicted_poll.reset();
+    return;
+  }
+
+  if (!IsResimulating())
+    m_resimulation_start = Clock::now();
+  m_resimulation_end_frame = std::max(m_resimulation_end_frame, m_frame);
+
+  State::LoadFromBufferForRollback(system, snapshot->state);
+  const u64 resimulated_frames = m_frame - snapshot->frame;
+  m_frame = snapshot->frame;
+
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    PadHistory& history = m_pads[i];
+    history.next_poll = snapshot->next_polls[i];
+    history.first_mispredicted_poll.reset();
+
+    // The inputs which still haven't arrived are predicted again from the newest one.
+    for (u64 poll = std::max(history.confirmed_polls, history.first_poll);
+         poll < history.first_poll + history.inputs.size(); ++poll)
+    {
+      history.inputs[poll - history.first_poll] = history.last_confirmed_input;
+    }
+  }
+
+  // The snapshots after the one which was loaded were saved after using wrong inputs.
+  m_snapshots.erase(snapshot.base(), m_snapshots.end());
+
+  Core::SetIsThrottlerTempDisabled(true);
+  system.GetVideoInterface().SetOutputSuppressed(true);
+
+  std::lock_guard lk(m_stats_mutex);
+  m_stats.rollbacks++;
+  m_stats.resimulated_frames += resimulated_frames;
+}
+
+void PadRollback::FinishResimulation(Core::System& system)
+{
+  m_resimulation_end_frame = 0;
+
+  Core::SetIsThrottlerTempDisabled(false);
+  system.GetVideoInterface().SetOutputSuppressed(false);
+
+  const double time_ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - m_resimulation_start).count();
+  std::lock_guard lk(m_stats_mutex);
+  m_stats.total_resimulation_ms += time_ms;
+  m_stats.last_resimulation_ms = time_ms;
+}
+
+PadRollback::Stats PadRollback::GetStats() const
+{
+  std::lock_guard lk(m_stats_mutex);
+  return m_stats;
+}
+}  // namespace NetPlay
@@ -0,0 +1,113 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace Core
+{
+class System;
+}
+
+namespace NetPlay
+{
+// Rollback netcode for GameCube controllers. Instead of waiting for the inputs of remote players,
+// they are predicted to be the same as the last input which arrived, and a state is saved at the
+// end of every frame. Once an input arrives which differs from what was predicted for it, the
+// newest state from before the input was used is loaded, and the frames since then are run again
+// as fast as possible with the correct inputs and without video output.
+//
+// Inputs are tracked per SI poll of each in-game pad, since that is how they are exchanged. Every
+// player rolls back on their own, so as long as they all end up using the same inputs for each
+// poll, they stay in sync.
+//
+// Everything other than GetStats is only accessed from the CPU thread.
+class PadRollback
+{
+public:
+  struct Stats
+  {
+    u64 rollbacks = 0;
+    u64 resimulated_frames = 0;
+    // Host time spent loading states and running frames again.
+    double total_resimulation_ms = 0.0;
+    double last_resimulation_ms = 0.0;
+  };
+
+  // How many frames can be run ahead of the inputs of remote players before waiting for them.
+  static constexpr size_t MAX_PREDICTED_FRAMES = 8;
+
+  void Reset();
+
+  // Adds the next input of an in-game pad, either polled from a local controller or received
+  // from the player it belongs to.
+  void AddInput(int pad, const GCPadStatus& status);
+  // The number of inputs of a pad which have been added but not used yet.
+  u64 GetBufferedInputCount(int pad) const;
+  // Whether the next poll of a pad is being run again after a rollback. Its input is then already
+  // known, and local controllers must not be polled.
+  bool IsResimulatingPoll(int pad) const;
+  // Gets the input for the next poll of a pad, predicting it if it hasn't been added yet. Returns
+  // false if emulation is too far ahead of the inputs of the pad to predict any more.
+  bool GetInput(int pad, GCPadStatus* status);
+
+  // Called at the end of every frame. Returns true if an input was mispredicted, in which case
+  // Rollback must be called once the CPU thread can load a state.
+  bool OnFrameEnd(Core::System& system);
+  // Loads the newest state from before the first mispredicted input.
+  void Rollback(Core::System& system);
+
+  bool IsResimulating() const { return m_frame < m_resimulation_end_frame; }
+  Stats GetStats() const;
+
+private:
+  struct PadHistory
+  {
+    // The inputs of polls starting from first_poll. The ones from confirmed_polls on are
+    // predictions.
+    std::deque<GCPadStatus> inputs;
+    u64 first_poll = 0;
+    u64 confirmed_polls = 0;
+    // The poll which the next call to GetInput is for.
+    u64 next_poll = 0;
+    // The furthest next_poll has been, so polls before it are being run again.
+    u64 newest_poll = 0;
+    std::optional<u64> first_mispredicted_poll;
+    GCPadStatus last_confirmed_input{};
+  };
+
+  struct Snapshot
+  {
+    // The number of frames which had been run when the state was saved.
+    u64 frame = 0;
+    std::array<u64, 4> next_polls{};
+    std::vector<u8> state;
+  };
+
+  bool CanPredict() const;
+  void DropUnneededSnapshots();
+  void FinishResimulation(Core::System& system);
+
+  std::array<PadHistory, 4> m_pads;
+  // Sorted from oldest to newest. The oldest snapshot is always from before the first input
+  // which may still be mispredicted.
+  std::deque<Snapshot> m_snapshots;
+  std::vector<u8> m_spare_state;
+
+  u64 m_frame = 0;
+  u64 m_resimulation_end_frame = 0;
+  bool m_rollback_pending = false;
+  Clock::time_point m_resimulation_start;
+
+  mutable std::mutex m_stats_mutex;
+  Stats m_stats;
+};
+}  // namespace NetPlay
@@ -86,6 +86,17 @@
 
 namespace NetPlay
 {
+struct SaveSyncInfo
+{
+  u8 save_count = 0;
+  std::shared_ptr<const UICommon::GameFile> game;
+  bool has_wii_save = false;
+  std::unique_ptr<IOS::HLE::FS::FileSystem> configured_fs;
+  std::optional<std::vector<u8>> mii_data;
+  std::vector<std::pair<u64, WiiSave::StoragePointer>> wii_saves;
+  std::optional<DiscIO::Riivolution::SavegameRedirect> redirected_save;
+};
+
 NetPlayServer::~NetPlayServer()
 {
   if (is_connected)
@@ -1057,34 +1068,32 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (timebases.size() >= m_players.size())
     {
       // we have all records for this frame
+      CheckForDesync(timebases, frame, false);
+      m_timebase_by_frame.erase(frame);
+    }
+  }
+  break;
 
-      if (!std::all_of(timebases.begin(), timebases.end(), [&](std::pair<PlayerId, u64> pair) {
-            return pair.second == timebases[0].second;
-          }))
-      {
-        int pid_to_blame = 0;
-        for (auto pair : timebases)
-        {
-          if (std::all_of(timebases.begin(), timebases.end(), [&](std::pair<PlayerId, u64> other) {
-                return other.first == pair.first || other.second != pair.second;
-              }))
-          {
-            // we are the only outlier
-            pid_to_blame = pair.first;
-            break;
-          }
-        }
+  case MessageID::StateHash:
+  {
+    u32 frame;
+    packet >> frame;
+    u64 hash = Common::PacketReadU64(packet);
 
-        sf::Packet spac;
-        spac << MessageID::DesyncDetected;
-        spac << pid_to_blame;
-        spac << frame;
-        SendToClients(spac);
+    if (m_desync_detected)
+      break;
 
-        m_desync_detected = true;
-      }
-      m_timebase_by_frame.erase(frame);
+    std::vector<std::pair<PlayerId, u64>>& hashes = m_state_hash_by_frame[frame];
+    hashes.emplace_back(player.pid, hash);
+    if (hashes.size() >= m_players.size())
+    {
+      CheckForDesync(hashes, frame, true);
+      m_state_hash_by_frame.erase(frame);
     }
+
+    // A player who left will never send the hashes of the frames which others have sent.
+    while (!m_state_hash_by_frame.empty() && m_state_hash_by_frame.begin()->first + 600 < frame)
+      m_state_hash_by_frame.erase(m_state_hash_by_frame.begin());
   }
   break;
 
@@ -1174,6 +1183,43 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       m_dialog->OnGameStartAborted();
       ChunkedDataAbort();
       m_start_pending = false;
+      m_save_sync_info.reset();
+    }
+    break;
+
+    case SyncSaveDataID::BlockHashes:
+    {
+      if (!m_start_pending || !m_save_sync_info)
+        break;
+
+      u32 count;
+      packet >> count;
+      std::set<SaveBlockHash> hashes;
+      for (u32 i = 0; i < count && packet; ++i)
+      {
+        SaveBlockHash hash;
+        for (u8& byte : hash)
+          packet >> byte;
+        hashes.insert(hash);
+      }
+
+      // Only blocks which every client has can be left out, since the data is the same for all.
+      if (m_save_block_hashes_players++ == 0)
+        m_known_save_blocks = std::move(hashes);
+      else
+        std::erase_if(m_known_save_blocks, [&](const auto& h) { return !hashes.contains(h); });
+
+      if (m_save_block_hashes_players >= m_players.size() - 1)
+      {
+        const bool success = SendSaveData(*m_save_sync_info);
+        m_save_sync_info.reset();
+        if (!success)
+        {
+          PanicAlertFmtT("Error synchronizing save data!");
+          m_dialog->OnGameStartAborted();
+          m_start_pending = false;
+        }
+      }
     }
     break;
 
@@ -1450,6 +1496,7 @@ bool NetPlayServer::SetupNetSettings()
   settings.strict_settings_sync = Config::Get(Config::NETPLAY_STRICT_SETTINGS_SYNC);
   settings.sync_codes = Config::Get(Config::NETPLAY_SYNC_CODES);
   settings.golf_mode = Config::Get(Config::NETPLAY_NETWORK_MODE) == "golf";
+  settings.rollback = Config::Get(Config::NETPLAY_NETWORK_MODE) == "rollback";
   settings.use_fma = DoAllPlayersHaveHardwareFMA();
   settings.hide_remote_gbas = Config::Get(Config::NETPLAY_HIDE_REMOTE_GBAS);
 
@@ -1474,17 +1521,6 @@ bool NetPlayServer::DoAllPlayersHaveHardwareFMA() const
                      [](const auto& p) { return p.second.has_hardware_fma; });
 }
 
-struct SaveSyncInfo
-{
-  u8 save_count = 0;
-  std::shared_ptr<const UICommon::GameFile> game;
-  bool has_wii_save = false;
-  std::unique_ptr<IOS::HLE::FS::FileSystem> configured_fs;
-  std::optional<std::vector<u8>> mii_data;
-  std::vector<std::pair<u64, WiiSave::StoragePointer>> wii_saves;
-  std::optional<DiscIO::Riivolution::SavegameRedirect> redirected_save;
-};
-
 // called from ---GUI--- thread
 bool NetPlayServer::RequestStartGame()
 {
@@ -1520,7 +1556,7 @@ bool NetPlayServer::RequestStartGame()
     {
       start_now = false;
       m_start_pending = true;
-      if (!SyncSaveData(*save_sync_info))
+      if (!SyncSaveData(std::move(*save_sync_info)))
       {
         PanicAlertFmtT("Error synchronizing save data!");
         m_start_pending = false;
@@ -1551,12 +1587,47 @@ bool NetPlayServer::RequestStartGame()
   return true;
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::CheckForDesync(const std::vector<std::pair<PlayerId, u64>>& values, u32 frame,
+                                   bool is_state_hash)
+{
+  if (std::all_of(values.begin(), values.end(), [&](std::pair<PlayerId, u64> pair) {
+        return pair.second == values[0].second;
+      }))
+  {
+    return;
+  }
+
+  int pid_to_blame = 0;
+  for (auto pair : values)
+  {
+    if (std::all_of(values.begin(), values.end(), [&](std::pair<PlayerId, u64> other) {
+          return other.first == pair.first || other.second != pair.second;
+        }))
+    {
+      // we are the only outlier
+      pid_to_blame = pair.first;
+      break;
+    }
+  }
+
+  sf::Packet spac;
+  spac << MessageID::DesyncDetected;
+  spac << pid_to_blame;
+  spac << frame;
+  spac << is_state_hash;
+  SendToClients(spac);
+
+  m_desync_detected = true;
+}
+
 // called from multiple threads
 bool NetPlayServer::StartGame()
 {
   INFO_LOG_FMT(NETPLAY, "Starting game.");
 
   m_timebase_by_frame.clear();
+  m_state_hash_by_frame.clear();
   m_desync_detected = false;
   std::lock_guard lkg(m_crit.game);
   // only used as an identifier, not time value, so truncation is fine
@@ -1657,6 +1728,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.sync_codes;
 
   spac << m_settings.golf_mode;
+  spac << m_settings.rollback;
   spac << m_settings.use_fma;
   spac << m_settings.hide_remote_gbas;
 
@@ -1789,27 +1861,36 @@ std::optional<SaveSyncInfo> NetPlayServer::CollectSaveSyncInfo()
 }
 
 // called from ---GUI--- thread
-bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
+bool NetPlayServer::SyncSaveData(SaveSyncInfo sync_info)
 {
-  INFO_LOG_FMT(NETPLAY, "Sending {} savegame chunks to clients.", sync_info.save_count);
+  const u8 save_count = sync_info.save_count;
+  INFO_LOG_FMT(NETPLAY, "Notifying clients of {} savegame chunks.", save_count);
 
   // We're about to sync saves, so set m_saves_synced to false (waits to start game)
   m_saves_synced = false;
 
   m_save_data_synced_players = 0;
+  m_save_block_hashes_players = 0;
+  m_known_save_blocks.clear();
+  if (save_count != 0)
+    m_save_sync_info = std::make_unique<SaveSyncInfo>(std::move(sync_info));
 
-  {
-    sf::Packet pac;
-    pac << MessageID::SyncSaveData;
-    pac << SyncSaveDataID::Notify;
-    pac << sync_info.save_count;
+  sf::Packet pac;
+  pac << MessageID::SyncSaveData;
+  pac << SyncSaveDataID::Notify;
+  pac << save_count;
 
-    // send this on the chunked data channel to ensure it's sequenced properly
-    SendAsyncToClients(std::move(pac), 0, CHUNKED_DATA_CHANNEL);
-  }
+  // send this on the chunked data channel to ensure it's sequenced properly
+  SendAsyncToClients(std::move(pac), 0, CHUNKED_DATA_CHANNEL);
 
-  if (sync_info.save_count == 0)
-    return true;
+  // The save data is sent once every client has replied with the blocks it already has.
+  return true;
+}
+
+bool NetPlayServer::SendSaveData(const SaveSyncInfo& sync_info)
+{
+  INFO_LOG_FMT(NETPLAY, "Sending {} savegame chunks to clients, {} blocks are already known.",
+               sync_info.save_count, m_known_save_blocks.size());
 
   const auto game_region = sync_info.game->GetRegion();
   const auto gamecube_region = Config::ToGameCubeRegion(game_region);
@@ -1837,7 +1918,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of raw memcard {} in slot {}.", path,
                      is_slot_a ? 'A' : 'B');
-        if (!CompressFileIntoPacket(path, pac))
+        if (!CompressFileIntoPacket(path, pac, &m_known_save_blocks))
           return false;
       }
       else
@@ -1876,7 +1957,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           const std::string filename = file.substr(file.find_last_of('/') + 1);
           INFO_LOG_FMT(NETPLAY, "Sending GCI {}.", filename);
           pac << filename;
-          if (!CompressFileIntoPacket(file, pac))
+          if (!CompressFileIntoPacket(file, pac, &m_known_save_blocks))
             return false;
         }
       }
@@ -2011,7 +2092,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       if (File::Exists(path))
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of GBA save at {} for slot {}.", path, i);
-        if (!CompressFileIntoPacket(path, pac))
+        if (!CompressFileIntoPacket(path, pac, &m_known_save_blocks))
           return false;
       }
       else
@@ -10,6 +10,7 @@
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <set>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
@@ -21,6 +22,7 @@
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
@@ -123,9 +125,12 @@ private:
 
   bool SetupNetSettings();
   std::optional<SaveSyncInfo> CollectSaveSyncInfo();
-  bool SyncSaveData(const SaveSyncInfo& sync_info);
+  bool SyncSaveData(SaveSyncInfo sync_info);
+  bool SendSaveData(const SaveSyncInfo& sync_info);
   bool SyncCodes();
   void CheckSyncAndStartGame();
+  void CheckForDesync(const std::vector<std::pair<PlayerId, u64>>& values, u32 frame,
+                      bool is_state_hash);
 
   u64 GetInitialNetPlayRTC() const;
 
@@ -175,6 +180,10 @@ private:
   GBAConfigArray m_gba_config;
   PadMappingArray m_wiimote_map;
   unsigned int m_save_data_synced_players = 0;
+  // Kept until every client has sent the hashes of the save data blocks it already has.
+  std::unique_ptr<SaveSyncInfo> m_save_sync_info;
+  unsigned int m_save_block_hashes_players = 0;
+  std::set<SaveBlockHash> m_known_save_blocks;
   unsigned int m_codes_synced_players = 0;
   bool m_saves_synced = true;
   bool m_codes_synced = true;
@@ -186,6 +195,7 @@ private:
   std::map<PlayerId, Client> m_players;
 
   std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
+  std::map<u32, std::vector<std::pair<PlayerId, u64>>> m_state_hash_by_frame;
   bool m_desync_detected = false;
 
   struct
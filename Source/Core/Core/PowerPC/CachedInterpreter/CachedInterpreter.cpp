@@ -3,9 +3,11 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HW/CPU.h"
@@ -267,6 +269,67 @@ bool CachedInterpreter::CheckIdle(CachedInterpreter& cached_interpreter, u32 idl
   return false;
 }
 
+bool CachedInterpreter::FastHLEFunction(CachedInterpreter& cached_interpreter, u32 data)
+{
+  const u32 hook_index = data & 0xFFFF;
+  const u32 downcount = data >> 16;
+
+  ASSERT(Core::IsCPUThread());
+  Core::CPUThreadGuard guard(cached_interpreter.m_system);
+  if (!HLE::ExecuteFast(guard, hook_index))
+    return false;
+
+  auto& ppc_state = cached_interpreter.m_ppc_state;
+  ppc_state.pc = ppc_state.npc;
+  ppc_state.downcount -= downcount;
+  PowerPC::UpdatePerformanceMonitor(downcount, 0, 0, ppc_state);
+  return true;
+}
+
+void CachedInterpreter::LoadImmediate(CachedInterpreter& cached_interpreter,
+                                      UGeckoInstruction inst)
+{
+  cached_interpreter.m_ppc_state.gpr[inst.RD] = u32(inst.SIMM_16);
+}
+
+void CachedInterpreter::LoadImmediateShifted(CachedInterpreter& cached_interpreter,
+                                             UGeckoInstruction inst)
+{
+  cached_interpreter.m_ppc_state.gpr[inst.RD] = u32(inst.SIMM_16 << 16);
+}
+
+void CachedInterpreter::AddImmediate(CachedInterpreter& cached_interpreter,
+                                     UGeckoInstruction inst)
+{
+  auto& ppc_state = cached_interpreter.m_ppc_state;
+  ppc_state.gpr[inst.RD] = ppc_state.gpr[inst.RA] + u32(inst.SIMM_16);
+}
+
+void CachedInterpreter::MoveRegister(CachedInterpreter& cached_interpreter,
+                                     UGeckoInstruction inst)
+{
+  auto& ppc_state = cached_interpreter.m_ppc_state;
+  ppc_state.gpr[inst.RA] = ppc_state.gpr[inst.RS];
+}
+
+CachedInterpreter::SpecializedOp CachedInterpreter::GetSpecializedOp(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 14:  // addi
+    return inst.RA ? AddImmediate : LoadImmediate;
+  case 15:  // addis
+    return inst.RA ? nullptr : LoadImmediateShifted;
+  case 31:
+    // or without Rc, with both sources the same register
+    if (inst.SUBOP10 == 444 && !inst.Rc && inst.RS == inst.RB)
+      return MoveRegister;
+    return nullptr;
+  default:
+    return nullptr;
+  }
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -276,6 +339,15 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
     return false;
 
   m_code.emplace_back(WritePC, address);
+
+  if (result.type == HLE::HookType::Fast)
+  {
+    // Both have to fit in the instruction's data.
+    ASSERT(result.hook_index <= 0xFFFF && js.downcountAmount <= 0xFFFF);
+    m_code.emplace_back(FastHLEFunction, result.hook_index | js.downcountAmount << 16);
+    return false;
+  }
+
   m_code.emplace_back(Interpreter::HLEFunction, result.hook_index);
 
   if (result.type != HLE::HookType::Replace)
@@ -354,7 +426,12 @@ void CachedInterpreter::Jit(u32 address)
         js.firstFPInstructionFound = true;
       }
 
-      m_code.emplace_back(Interpreter::GetInterpreterOp(op.inst), op.inst);
+      // ori rX, rX, 0 (which nop is an alias of) doesn't do anything.
+      const bool nop = op.inst.OPCD == 24 && op.inst.RA == op.inst.RS && op.inst.UIMM == 0;
+      if (const SpecializedOp specialized_op = GetSpecializedOp(op.inst))
+        m_code.emplace_back(specialized_op, op.inst);
+      else if (!nop)
+        m_code.emplace_back(Interpreter::GetInterpreterOp(op.inst), op.inst);
       if (memcheck)
         m_code.emplace_back(CheckDSI, js.downcountAmount);
       if (check_program_exception)
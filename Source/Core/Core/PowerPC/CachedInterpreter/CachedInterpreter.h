@@ -55,6 +55,16 @@ private:
   static bool CheckProgramException(CachedInterpreter& cached_interpreter, u32 data);
   static bool CheckBreakpoint(CachedInterpreter& cached_interpreter, u32 data);
   static bool CheckIdle(CachedInterpreter& cached_interpreter, u32 idle_pc);
+  static bool FastHLEFunction(CachedInterpreter& cached_interpreter, u32 data);
+
+  // Specialized forms of common instructions, with the operand checks the interpreter makes on
+  // every execution resolved when the block is built.
+  using SpecializedOp = void (*)(CachedInterpreter&, UGeckoInstruction);
+  static SpecializedOp GetSpecializedOp(UGeckoInstruction inst);
+  static void LoadImmediate(CachedInterpreter& cached_interpreter, UGeckoInstruction inst);
+  static void LoadImmediateShifted(CachedInterpreter& cached_interpreter, UGeckoInstruction inst);
+  static void AddImmediate(CachedInterpreter& cached_interpreter, UGeckoInstruction inst);
+  static void MoveRegister(CachedInterpreter& cached_interpreter, UGeckoInstruction inst);
 
   BlockCache m_block_cache{*this};
   std::vector<Instruction> m_code;
@@ -471,15 +471,17 @@ void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection
 void Expression::Reporting(const double result) const
 {
   bool is_nan = std::isnan(result);
-  std::string message;
+  for (auto* v = m_vars->head; v != nullptr && !is_nan; v = v->next)
+    is_nan = std::isnan(v->value);
 
-  for (auto* v = m_vars->head; v != nullptr; v = v->next)
-  {
-    if (std::isnan(v->value))
-      is_nan = true;
+  // This runs on every hit of a conditional breakpoint, which is usually not taken, so only format
+  // the variables when there is something to report.
+  if (result == 0.0 && !is_nan)
+    return;
 
+  std::string message;
+  for (auto* v = m_vars->head; v != nullptr; v = v->next)
     fmt::format_to(std::back_inserter(message), "  {}={}", v->name, v->value);
-  }
 
   if (is_nan)
   {
@@ -487,8 +489,7 @@ void Expression::Reporting(const double result) const
     Core::DisplayMessage("Breakpoint condition has encountered a NaN.", 2000);
   }
 
-  if (result != 0.0 || is_nan)
-    NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
+  NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
 }
 
 std::string Expression::GetText() const
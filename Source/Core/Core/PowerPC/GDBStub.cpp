@@ -5,12 +5,17 @@
 
 #include "Core/PowerPC/GDBStub.h"
 
+#include <algorithm>
+#include <array>
 #include <fmt/format.h>
 #include <optional>
 #include <signal.h>
+#include <span>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <string>
+#include <string_view>
 #ifdef _WIN32
 #include <WinSock2.h>
 #include <iphlpapi.h>
@@ -31,6 +36,7 @@ typedef SSIZE_T ssize_t;
 #include "Common/SocketContext.h"
 #include "Common/StringUtil.h"
 #include "Core/Core.h"
+#include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/HW/CPU.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Host.h"
@@ -45,6 +51,9 @@ namespace GDBStub
 static std::optional<Common::SocketContext> s_socket_context;
 
 #define GDB_BFR_MAX 10000
+// The largest packet payload we can receive and reply with. Advertised to the client, so that
+// it transfers memory in as few packets as possible.
+constexpr u32 GDB_MAX_PAYLOAD = GDB_BFR_MAX - 5;
 
 #define GDB_STUB_START '$'
 #define GDB_STUB_END '#'
@@ -77,6 +86,11 @@ static int s_sock = -1;
 static u8 s_cmd_bfr[GDB_BFR_MAX];
 static u32 s_cmd_len;
 
+// Received bytes that haven't been consumed yet. Receiving in chunks avoids a system call per byte.
+static std::array<u8, 4096> s_recv_bfr;
+static u32 s_recv_pos = 0;
+static u32 s_recv_len = 0;
+
 static CoreTiming::EventType* s_update_event;
 
 static const char* CommandBufferAsString()
@@ -135,16 +149,22 @@ static void UpdateCallback(Core::System& system, u64 userdata, s64 cycles_late)
 
 static u8 ReadByte()
 {
-  u8 c = '+';
-
-  const ssize_t res = recv(s_sock, (char*)&c, 1, MSG_WAITALL);
-  if (res != 1)
+  if (s_recv_pos == s_recv_len)
   {
-    ERROR_LOG_FMT(GDB_STUB, "recv failed : {}", res);
-    Deinit();
+    s_recv_pos = 0;
+    s_recv_len = 0;
+
+    const ssize_t res = recv(s_sock, (char*)s_recv_bfr.data(), s_recv_bfr.size(), 0);
+    if (res <= 0)
+    {
+      ERROR_LOG_FMT(GDB_STUB, "recv failed : {}", res);
+      Deinit();
+      return '+';
+    }
+    s_recv_len = static_cast<u32>(res);
   }
 
-  return c;
+  return s_recv_bfr[s_recv_pos++];
 }
 
 static u8 CalculateChecksum()
@@ -257,8 +277,11 @@ static void ReadCommand()
   Ack();
 }
 
-static bool IsDataAvailable()
+static bool IsDataAvailable(long timeout_us)
 {
+  if (s_recv_pos != s_recv_len)
+    return true;
+
   struct timeval t;
   fd_set _fds, *fds = &_fds;
 
@@ -266,7 +289,7 @@ static bool IsDataAvailable()
   FD_SET(s_sock, fds);
 
   t.tv_sec = 0;
-  t.tv_usec = 20;
+  t.tv_usec = timeout_us;
 
   if (select(s_sock + 1, fds, nullptr, nullptr, &t) < 0)
   {
@@ -325,6 +348,128 @@ static void WriteHostInfo()
           .c_str());
 }
 
+// Returns a description of the OS thread that is currently running, if there is one. The stub
+// reports a single thread to the client, since only the registers of the running thread are known.
+static std::string GetCurrentThreadDescription()
+{
+  auto& system = Core::System::GetInstance();
+  if (!Core::IsCPUThread())
+    return {};
+
+  Core::CPUThreadGuard guard(system);
+  const Common::Debug::Threads threads = system.GetPowerPC().GetDebugInterface().GetThreads(guard);
+  const u32 sp = system.GetPPCState().gpr[1];
+  const auto current = std::ranges::find_if(threads, [sp](const auto& thread) {
+    return sp <= thread->GetStackStart() && sp > thread->GetStackEnd();
+  });
+  if (current == threads.end())
+    return {};
+
+  const std::string name = (*current)->GetSpecific(guard);
+  return fmt::format("OSThread {:08x}{}{} (priority {})", (*current)->GetAddress(),
+                     name.empty() ? "" : " ", name, (*current)->GetEffectivePriority());
+}
+
+static void WriteThreadExtraInfo()
+{
+  const std::string description = GetCurrentThreadDescription();
+  if (description.empty())
+    return SendReply("00");
+
+  std::string reply(description.size() * 2, '\0');
+  Mem2hex(reinterpret_cast<u8*>(reply.data()),
+          reinterpret_cast<u8*>(const_cast<char*>(description.data())),
+          static_cast<u32>(description.size()));
+  SendReply(reply.c_str());
+}
+
+static std::string EscapeXML(std::string_view text)
+{
+  std::string result;
+  for (const char c : text)
+  {
+    if (c == '<')
+      result += "&lt;";
+    else if (c == '>')
+      result += "&gt;";
+    else if (c == '&')
+      result += "&amp;";
+    else if (c == '"')
+      result += "&quot;";
+    else if (c >= 0x20 && c < 0x7f && !strchr("#$}*", c))
+      result += c;
+  }
+  return result;
+}
+
+static std::string GetMemoryMapXML()
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+
+  std::string xml = "<?xml version=\"1.0\"?>\n"
+                    "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" "
+                    "\"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n"
+                    "<memory-map>\n";
+  const auto add_region = [&xml](u32 start, u32 length) {
+    xml += fmt::format("<memory type=\"ram\" start=\"{:#010x}\" length=\"{:#x}\"/>\n", start,
+                       length);
+  };
+  // Cached and uncached mirrors of MEM1 and, on Wii, MEM2.
+  add_region(0x80000000, memory.GetRamSizeReal());
+  if (memory.GetEXRAM())
+    add_region(0x90000000, memory.GetExRamSizeReal());
+  add_region(0xc0000000, memory.GetRamSizeReal());
+  if (memory.GetEXRAM())
+    add_region(0xd0000000, memory.GetExRamSizeReal());
+  xml += "</memory-map>\n";
+  return xml;
+}
+
+static std::string GetThreadsXML()
+{
+  std::string xml = "<?xml version=\"1.0\"?>\n<threads>\n";
+  const std::string description = GetCurrentThreadDescription();
+  if (description.empty())
+    xml += "<thread id=\"1\"/>\n";
+  else
+    xml += fmt::format("<thread id=\"1\">{}</thread>\n", EscapeXML(description));
+  xml += "</threads>\n";
+  return xml;
+}
+
+// qXfer:<object>:read:<annex>:<offset>,<length>
+static void HandleXfer()
+{
+  const std::string_view command(CommandBufferAsString(), s_cmd_len);
+
+  std::string document;
+  if (command.starts_with("qXfer:memory-map:read::"))
+    document = GetMemoryMapXML();
+  else if (command.starts_with("qXfer:threads:read::"))
+    document = GetThreadsXML();
+  else
+    return SendReply("");
+
+  u32 i = static_cast<u32>(command.find("::")) + 2;
+  u32 offset = 0;
+  while (i < s_cmd_len && s_cmd_bfr[i] != ',')
+    offset = (offset << 4) | Hex2char(s_cmd_bfr[i++]);
+  i++;
+
+  u32 length = 0;
+  while (i < s_cmd_len)
+    length = (length << 4) | Hex2char(s_cmd_bfr[i++]);
+
+  if (offset > document.size())
+    return SendReply("E00");
+
+  // The documents never contain characters that would need escaping in the binary reply.
+  length = std::min({length, GDB_MAX_PAYLOAD - 1, static_cast<u32>(document.size()) - offset});
+  std::string reply = offset + length < document.size() ? "m" : "l";
+  reply.append(document, offset, length);
+  SendReply(reply.c_str());
+}
+
 static void HandleQuery()
 {
   DEBUG_LOG_FMT(GDB_STUB, "gdb: query '{}'", CommandBufferAsString());
@@ -338,11 +483,18 @@ static void HandleQuery()
   else if (!strcmp((const char*)(s_cmd_bfr), "qsThreadInfo"))
     return SendReply("l");
   else if (!strncmp((const char*)(s_cmd_bfr), "qThreadExtraInfo", strlen("qThreadExtraInfo")))
-    return SendReply("00");
+    return WriteThreadExtraInfo();
   else if (!strncmp((const char*)(s_cmd_bfr), "qHostInfo", strlen("qHostInfo")))
     return WriteHostInfo();
   else if (!strncmp((const char*)(s_cmd_bfr), "qSupported", strlen("qSupported")))
-    return SendReply("swbreak+;hwbreak+");
+  {
+    return SendReply(fmt::format("swbreak+;hwbreak+;PacketSize={:x};qXfer:memory-map:read+;"
+                                 "qXfer:threads:read+",
+                                 GDB_MAX_PAYLOAD)
+                         .c_str());
+  }
+  else if (!strncmp((const char*)(s_cmd_bfr), "qXfer:", strlen("qXfer:")))
+    return HandleXfer();
 
   SendReply("");
 }
@@ -823,16 +975,18 @@ static void ReadMemory(const Core::CPUThreadGuard& guard)
     len = (len << 4) | Hex2char(s_cmd_bfr[i++]);
   INFO_LOG_FMT(GDB_STUB, "gdb: read memory: {:08x} bytes from {:08x}", len, addr);
 
-  if (len * 2 > sizeof reply)
-    SendReply("E01");
+  if (len * 2 >= sizeof reply)
+    return SendReply("E01");
 
   if (!PowerPC::MMU::HostIsRAMAddress(guard, addr))
     return SendReply("E00");
 
+  // Reads that run past the end of a memory region are cut short, which the protocol allows.
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
-  u8* data = memory.GetPointerForRange(addr, len);
-  Mem2hex(reply, data, len);
+  const std::span<u8> data = memory.GetSpanForAddress(addr);
+  len = std::min(len, static_cast<u32>(data.size()));
+  Mem2hex(reply, data.data(), len);
   reply[len * 2] = '\0';
   SendReply((char*)reply);
 }
@@ -859,10 +1013,58 @@ static void WriteMemory(const Core::CPUThreadGuard& guard)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   u8* dst = memory.GetPointerForRange(addr, len);
+  if (!dst)
+    return SendReply("E00");
   Hex2mem(dst, s_cmd_bfr + i + 1, len);
   SendReply("OK");
 }
 
+// Like WriteMemory, but the data is sent as binary rather than hex, which halves its size.
+static void WriteMemoryBinary(const Core::CPUThreadGuard& guard)
+{
+  u32 addr = 0;
+  u32 len = 0;
+
+  u32 i = 1;
+  while (i < s_cmd_len && s_cmd_bfr[i] != ',')
+    addr = (addr << 4) | Hex2char(s_cmd_bfr[i++]);
+  i++;
+
+  while (i < s_cmd_len && s_cmd_bfr[i] != ':')
+    len = (len << 4) | Hex2char(s_cmd_bfr[i++]);
+  i++;
+  INFO_LOG_FMT(GDB_STUB, "gdb: write binary memory: {:08x} bytes to {:08x}", len, addr);
+
+  // Clients send an empty write to find out whether binary writes are supported.
+  if (len == 0)
+    return SendReply("OK");
+
+  if (!PowerPC::MMU::HostIsRAMAddress(guard, addr))
+    return SendReply("E00");
+
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+  u8* dst = memory.GetPointerForRange(addr, len);
+  if (!dst)
+    return SendReply("E00");
+
+  // '#', '$', '}' and '*' are sent as '}' followed by the byte xor 0x20.
+  for (u32 written = 0; written < len; written++)
+  {
+    if (i >= s_cmd_len)
+      return SendReply("E01");
+    u8 c = s_cmd_bfr[i++];
+    if (c == '}')
+    {
+      if (i >= s_cmd_len)
+        return SendReply("E01");
+      c = s_cmd_bfr[i++] ^ 0x20;
+    }
+    dst[written] = c;
+  }
+  SendReply("OK");
+}
+
 static void Step()
 {
   auto& system = Core::System::GetInstance();
@@ -959,7 +1161,9 @@ void ProcessCommands(bool loop_until_continue)
       return;
     }
 
-    if (!IsDataAvailable())
+    // Wait a little while for the next packet when there is nothing else to do, rather than
+    // spinning.
+    if (!IsDataAvailable(loop_until_continue ? 10000 : 0))
     {
       if (loop_until_continue)
         continue;
@@ -1010,11 +1214,15 @@ void ProcessCommands(bool loop_until_continue)
       break;
     }
     case 'M':
+    case 'X':
     {
       ASSERT(Core::IsCPUThread());
       Core::CPUThreadGuard guard(system);
 
-      WriteMemory(guard);
+      if (s_cmd_bfr[0] == 'X')
+        WriteMemoryBinary(guard);
+      else
+        WriteMemory(guard);
       auto& ppc_state = system.GetPPCState();
       auto& jit_interface = system.GetJitInterface();
       ppc_state.iCache.Reset(jit_interface);
@@ -1130,6 +1338,8 @@ void Deinit()
     shutdown(s_sock, SHUT_RDWR);
     s_sock = -1;
   }
+  s_recv_pos = 0;
+  s_recv_len = 0;
 
   s_socket_context.reset();
   s_has_control = false;
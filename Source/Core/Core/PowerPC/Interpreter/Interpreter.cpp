@@ -113,6 +113,16 @@ bool Interpreter::HandleFunctionHooking(u32 address)
   if (!result)
     return false;
 
+  if (result.type == HLE::HookType::Fast)
+  {
+    Core::CPUThreadGuard guard(m_system);
+    if (!HLE::ExecuteFast(guard, result.hook_index))
+      return false;
+
+    m_end_block = true;
+    return true;
+  }
+
   HLEFunction(*this, result.hook_index);
 
   return result.type != HLE::HookType::Start;
@@ -196,6 +206,17 @@ int Interpreter::SingleStepInner()
   return opinfo->num_cycles;
 }
 
+int Interpreter::RunBlock(u32 max_instructions)
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  for (u32 i = 0; i < max_instructions && !m_end_block; ++i)
+    cycles += SingleStepInner();
+
+  return cycles;
+}
+
 void Interpreter::SingleStep()
 {
   auto& core_timing = m_system.GetCoreTiming();
@@ -36,6 +36,10 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Runs instructions until a branch ends the current block or max_instructions have been run.
+  // Returns the number of cycles spent. Used by the JITs to run code that isn't hot enough to be
+  // worth compiling yet.
+  int RunBlock(u32 max_instructions);
 
   void Run() override;
   void ClearCache() override;
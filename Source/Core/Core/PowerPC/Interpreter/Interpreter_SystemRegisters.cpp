@@ -203,7 +203,11 @@ void Interpreter::mtsr(Interpreter& interpreter, UGeckoInstruction inst)
 
   const u32 index = inst.SR;
   const u32 value = ppc_state.gpr[inst.RS];
+  if (ppc_state.sr[index] == value)
+    return;
+
   ppc_state.SetSR(index, value);
+  interpreter.m_mmu.PageTableUpdated();
 }
 
 void Interpreter::mtsrin(Interpreter& interpreter, UGeckoInstruction inst)
@@ -217,7 +221,11 @@ void Interpreter::mtsrin(Interpreter& interpreter, UGeckoInstruction inst)
 
   const u32 index = (ppc_state.gpr[inst.RB] >> 28) & 0xF;
   const u32 value = ppc_state.gpr[inst.RS];
+  if (ppc_state.sr[index] == value)
+    return;
+
   ppc_state.SetSR(index, value);
+  interpreter.m_mmu.PageTableUpdated();
 }
 
 void Interpreter::mftb(Interpreter& interpreter, UGeckoInstruction inst)
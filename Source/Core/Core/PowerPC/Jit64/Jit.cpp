@@ -4,6 +4,7 @@
 #include "Core/PowerPC/Jit64/Jit.h"
 
 #include <map>
+#include <optional>
 #include <sstream>
 #include <string>
 
@@ -23,6 +24,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -268,7 +270,8 @@ void Jit64::Init()
   const size_t trampolines_size = jo.memcheck ? TRAMPOLINE_CODE_SIZE_MMU : TRAMPOLINE_CODE_SIZE;
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   const size_t constpool_size = m_const_pool.CONST_POOL_SIZE;
-  AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size);
+  AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size,
+                 Config::Get(Config::MAIN_LARGE_PAGES));
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
@@ -776,6 +779,8 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_PAIRED_FUSION);
       }
       Trace();
     }
@@ -825,13 +830,23 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Evicting the oldest blocks is a lot cheaper than recompiling everything, so try that first.
+    // Only once there is nothing left to evict, clear the entire JIT cache and retry.
+    if (blocks.EvictOldestBlocks() != 0)
+    {
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(DYNA_REC, "flushing code caches, please report if this happens a lot");
+    blocks.RecordFullClear();
     ClearCache();
     Jit(em_address, false);
     return;
@@ -967,20 +982,36 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     {
       // Gather pipe writes using a non-immediate address are discovered by profiling.
       const u32 prev_address = m_code_buffer[i - 1].address;
-      bool gatherPipeIntCheck =
+      const bool profiledGatherPipeWrite =
           js.fifoWriteAddresses.find(prev_address) != js.fifoWriteAddresses.end();
+      bool gatherPipeIntCheck = profiledGatherPipeWrite;
 
       // Gather pipe writes using an immediate address are explicitly tracked.
+      std::optional<FixupBranch> no_burst;
       if (jo.optimizeGatherPipe &&
           (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_SIZE || js.mustCheckFifo))
       {
         js.fifoBytesSinceCheck = 0;
         js.mustCheckFifo = false;
+
+        // Only call out of the block once there is a full burst to send.
+        MOV(64, R(RSCRATCH), PPCSTATE(gather_pipe_ptr));
+        SUB(64, R(RSCRATCH), PPCSTATE(gather_pipe_base_ptr));
+        CMP(64, R(RSCRATCH), Imm32(GPFifo::GATHER_PIPE_SIZE));
+        no_burst = J_CC(CC_L, Jump::Near);
         BitSet32 registersInUse = CallerSavedRegistersInUse();
         ABI_PushRegistersAndAdjustStack(registersInUse, 0);
         ABI_CallFunctionP(GPFifo::FastCheckGatherPipe, &m_system.GetGPFifo());
         ABI_PopRegistersAndAdjustStack(registersInUse, 0);
         gatherPipeIntCheck = true;
+
+        // Only a burst can raise a CP interrupt, so unless a profiled write might have sent one,
+        // the exception check below is skipped along with the call.
+        if (profiledGatherPipeWrite)
+        {
+          SetJumpTarget(*no_burst);
+          no_burst.reset();
+        }
       }
 
       // Gather pipe writes can generate an exception; add an exception check.
@@ -1015,6 +1046,9 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         SetJumpTarget(noCPInt);
         SetJumpTarget(noExtIntEnable);
       }
+
+      if (no_burst)
+        SetJumpTarget(*no_burst);
     }
 
     if (HandleFunctionHooking(op.address))
@@ -1024,8 +1058,9 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     {
       if (IsDebuggingEnabled())
       {
-        // The only thing that currently sets op.skip is the BLR following optimization.
-        // If any non-branch instruction starts setting that too, this will need to be changed.
+        // The only thing that sets op.skip while debugging is the BLR following optimization
+        // (paired single fusion is disabled). If any non-branch instruction starts setting that
+        // too, this will need to be changed.
         ASSERT(op.inst.hex == 0x4e800020);
         WriteBranchWatch<true>(op.address, op.branchTo, op.inst, RSCRATCH, RSCRATCH2,
                                CallerSavedRegistersInUse());
@@ -1097,6 +1132,8 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         // output, which needs to be bound in the actual instruction compilation.
         // TODO: make this smarter in the case that we're actually register-starved, i.e.
         // prioritize the more important registers.
+        gpr.FreeCleanRegisters(~(op.regsIn | op.regsOut | op.gprInUse));
+        fpr.FreeCleanRegisters(~(op.fregsIn | op.GetFregsOut() | op.fprInUse));
         gpr.PreloadRegisters(op.regsIn & op.gprInUse & ~op.gprDiscardable);
         fpr.PreloadRegisters(op.fregsIn & op.fprInXmm & ~op.fprDiscardable);
       }
@@ -1193,6 +1230,10 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   b->codeSize = static_cast<u32>(GetCodePtr() - b->normalEntry);
   b->originalSize = code_block.m_num_instructions;
 
+  DEBUG_LOG_FMT(DYNA_REC, "Block {:08x}: {} instructions, {} bytes, {} GPR and {} FPR spills",
+                em_address, b->originalSize, b->codeSize, gpr.GetSpillCount(),
+                fpr.GetSpillCount());
+
 #ifdef JIT_LOG_GENERATED_CODE
   LogGeneratedX86(code_block.m_num_instructions, m_code_buffer, start, b);
 #endif
@@ -1225,6 +1266,8 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_PAIRED_FUSION);
 }
 
 void Jit64::IntializeSpeculativeConstants()
@@ -1268,6 +1311,26 @@ bool Jit64::HandleFunctionHooking(u32 address)
   if (!result)
     return false;
 
+  if (result.type == HLE::HookType::Fast)
+  {
+    gpr.Flush();
+    fpr.Flush();
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionCCP(HLE::ExecuteFastFromJIT, js.compilerPC, result.hook_index, &m_system);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+
+    // If the replacement declined, fall through to the original function.
+    TEST(8, R(ABI_RETURN), R(ABI_RETURN));
+    FixupBranch not_handled = J_CC(CC_Z, Jump::Near);
+    const u32 downcount_amount = js.downcountAmount;
+    MOV(32, R(RSCRATCH), PPCSTATE(npc));
+    js.downcountAmount += js.st.numCycles;
+    WriteExitDestInRSCRATCH();
+    js.downcountAmount = downcount_amount;
+    SetJumpTarget(not_handled);
+    return false;
+  }
+
   HLEFunction(result.hook_index);
 
   if (result.type != HLE::HookType::Replace)
@@ -114,6 +114,14 @@ public:
   void FinalizeCarry(bool ca);
   void ComputeRC(preg_t preg, bool needs_test = true, bool needs_sext = true);
 
+  // Computes how many iterations of a "dcbx rX; addi rX,rX,32; bdnz" loop to run at once and
+  // adjusts CTR and downcount for them. Leaves that amount in loop_counter and the same amount
+  // minus one in RSCRATCH2. Clobbers RSCRATCH, reg_cycle_count and reg_downcount.
+  void EmitDCBLoopCount(Gen::X64Reg loop_counter, Gen::X64Reg reg_cycle_count,
+                        Gen::X64Reg reg_downcount, Gen::X64Reg max_extra_loops = Gen::INVALID_REG);
+  // dcbz followed by the loop pattern above, on the fastmem path.
+  void dcbzLoop(UGeckoInstruction inst);
+
   void AndWithMask(Gen::X64Reg reg, u32 mask);
   void RotateLeft(int bits, Gen::X64Reg regOp, const Gen::OpArg& arg, u8 rotate);
 
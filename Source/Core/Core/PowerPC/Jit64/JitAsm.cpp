@@ -136,10 +136,14 @@ void Jit64AsmRoutineManager::Generate()
     else
     {
       // Fast block number lookup.
-      // ((PC >> 2) & mask) * sizeof(JitBlock*) = (PC & (mask << 2)) * 2
-      MOV(32, R(RSCRATCH), PPCSTATE(pc));
-      // Keep a copy for later.
-      MOV(32, R(RSCRATCH_EXTRA), R(RSCRATCH));
+      // (((PC >> 2) ^ (feature_flags << shift)) & mask) * sizeof(JitBlock*)
+      //   = ((PC ^ (feature_flags << (shift + 2))) & (mask << 2)) * 2
+      MOV(32, R(RSCRATCH), PPCSTATE(feature_flags));
+      SHL(32, R(RSCRATCH),
+          Imm8(JitBaseBlockCache::FAST_BLOCK_MAP_FALLBACK_FEATURE_FLAGS_SHIFT + 2));
+      // Keep a copy of the PC for later.
+      MOV(32, R(RSCRATCH_EXTRA), PPCSTATE(pc));
+      XOR(32, R(RSCRATCH), R(RSCRATCH_EXTRA));
       u64 icache = reinterpret_cast<u64>(m_jit.GetBlockCache()->GetFastBlockMapFallback());
       AND(32, R(RSCRATCH), Imm32(JitBaseBlockCache::FAST_BLOCK_MAP_FALLBACK_MASK << 2));
       if (icache <= INT_MAX)
@@ -376,6 +376,10 @@ bool Jit64::CheckMergedBranch(u32 crf) const
   if (!CanMergeNextInstructions(1))
     return false;
 
+  // DoMergedBranch only knows how to exit on the taken path.
+  if (js.op[1].branchFollowed)
+    return false;
+
   const UGeckoInstruction& next = js.op[1].inst;
   return (((next.OPCD == 16 /* bcx */) ||
            ((next.OPCD == 19) && (next.SUBOP10 == 528) /* bcctrx */) ||
@@ -1392,22 +1396,35 @@ void Jit64::mulhwXx(UGeckoInstruction inst)
     else
       gpr.SetImmediate32(d, (u32)(((u64)gpr.Imm32(a) * (u64)gpr.Imm32(b)) >> 32));
   }
+  else if (sign && (gpr.IsImm(a) || gpr.IsImm(b)))
+  {
+    // Multiplying the sign extended operands as 64-bit values doesn't tie up EAX and EDX,
+    // which would have to be spilled if they're holding guest registers.
+    const s32 imm = gpr.IsImm(a) ? gpr.SImm32(a) : gpr.SImm32(b);
+    const int src = gpr.IsImm(a) ? b : a;
+
+    RCOpArg Rsrc = gpr.Use(src, RCMode::Read);
+    RCX64Reg Rd = gpr.Bind(d, RCMode::Write);
+    RegCache::Realize(Rsrc, Rd);
+
+    MOVSX(64, 32, RSCRATCH, Rsrc);
+    IMUL(64, Rd, R(RSCRATCH), Imm32(imm));
+    SHR(64, Rd, Imm8(32));
+  }
   else if (sign)
   {
     RCOpArg Ra = gpr.Use(a, RCMode::Read);
-    RCOpArg Rb = gpr.UseNoImm(b, RCMode::Read);
+    RCOpArg Rb = gpr.Use(b, RCMode::Read);
     RCX64Reg Rd = gpr.Bind(d, RCMode::Write);
-    RCX64Reg eax = gpr.Scratch(EAX);
-    RCX64Reg edx = gpr.Scratch(EDX);
-    RegCache::Realize(Ra, Rb, Rd, eax, edx);
+    RegCache::Realize(Ra, Rb, Rd);
 
-    MOV(32, eax, Ra);
-    IMUL(32, Rb);
-    MOV(32, Rd, edx);
+    MOVSX(64, 32, RSCRATCH, Ra);
+    MOVSX(64, 32, Rd, Rb);
+    IMUL(64, Rd, R(RSCRATCH));
+    SHR(64, Rd, Imm8(32));
   }
   else
   {
-    // Not faster for signed because we'd need two movsx.
     // We need to bind everything to registers since the top 32 bits need to be zero.
     int src = d == b ? a : b;
     int other = src == b ? a : b;
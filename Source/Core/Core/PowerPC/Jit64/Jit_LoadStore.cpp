@@ -229,6 +229,94 @@ void Jit64::lXXx(UGeckoInstruction inst)
     BSWAP(accessSize, Rd);
 }
 
+void Jit64::EmitDCBLoopCount(X64Reg loop_counter, X64Reg reg_cycle_count, X64Reg reg_downcount,
+                             X64Reg max_extra_loops)
+{
+  // We'll execute somewhere between one single cacheline invalidation and however many are needed
+  // to reduce the downcount to zero, never exceeding the amount requested by the game.
+  // To stay consistent with the rest of the code we adjust the involved registers (CTR and Rb)
+  // by the amount of cache lines we invalidate minus one -- since we'll run the regular addi and
+  // bdnz afterwards! So if we invalidate a single cache line, we don't adjust the registers at
+  // all, if we invalidate 2 cachelines we adjust the registers by one step, and so on.
+
+  // This must be true in order for us to pick up the DIV results and not trash any data.
+  static_assert(RSCRATCH == Gen::EAX && RSCRATCH2 == Gen::EDX);
+
+  // Alright, now figure out how many loops we want to do.
+  const u8 cycle_count_per_loop =
+      js.op[0].opinfo->num_cycles + js.op[1].opinfo->num_cycles + js.op[2].opinfo->num_cycles;
+
+  // This is both setting the adjusted loop count to 0 for the downcount <= 0 case and clearing
+  // the upper bits for the DIV instruction in the downcount > 0 case.
+  XOR(32, R(RSCRATCH2), R(RSCRATCH2));
+
+  MOV(32, R(RSCRATCH), PPCSTATE(downcount));
+  TEST(32, R(RSCRATCH), R(RSCRATCH));                       // if (downcount <= 0)
+  FixupBranch downcount_is_zero_or_negative = J_CC(CC_LE);  // only do 1 invalidation; else:
+  MOV(32, R(loop_counter), PPCSTATE_CTR);
+  MOV(32, R(reg_downcount), R(RSCRATCH));
+  MOV(32, R(reg_cycle_count), Imm32(cycle_count_per_loop));
+  DIV(32, R(reg_cycle_count));                  // RSCRATCH = downcount / cycle_count
+  LEA(32, RSCRATCH2, MDisp(loop_counter, -1));  // RSCRATCH2 = CTR - 1
+  // ^ Note that this CTR-1 implicitly handles the CTR == 0 case correctly.
+  CMP(32, R(RSCRATCH), R(RSCRATCH2));
+  CMOVcc(32, RSCRATCH2, R(RSCRATCH), CC_B);  // RSCRATCH2 = min(RSCRATCH, RSCRATCH2)
+  if (max_extra_loops != INVALID_REG)
+  {
+    CMP(32, R(RSCRATCH2), R(max_extra_loops));
+    CMOVcc(32, RSCRATCH2, R(max_extra_loops), CC_A);  // RSCRATCH2 = min(RSCRATCH2, max_extra)
+  }
+
+  // RSCRATCH2 now holds the amount of loops to execute minus 1, which is the amount we need to
+  // adjust downcount, CTR, and Rb by to exit the loop construct with the right values in those
+  // registers.
+  SUB(32, R(loop_counter), R(RSCRATCH2));
+  MOV(32, PPCSTATE_CTR, R(loop_counter));  // CTR -= RSCRATCH2
+  IMUL(32, reg_cycle_count, R(RSCRATCH2));
+  // ^ Note that this cannot overflow because it's limited by (downcount/cycle_count).
+  SUB(32, R(reg_downcount), R(reg_cycle_count));
+  MOV(32, PPCSTATE(downcount), R(reg_downcount));  // downcount -= (RSCRATCH2 * reg_cycle_count)
+
+  SetJumpTarget(downcount_is_zero_or_negative);
+
+  // Load the loop_counter register with the amount of invalidations to execute.
+  LEA(32, loop_counter, MDisp(RSCRATCH2, 1));
+
+  if (IsDebuggingEnabled())
+  {
+    const X64Reg bw_reg_a = reg_cycle_count, bw_reg_b = reg_downcount;
+    const BitSet32 bw_caller_save = (CallerSavedRegistersInUse() | BitSet32{RSCRATCH2}) &
+                                    ~BitSet32{int(bw_reg_a), int(bw_reg_b)};
+
+    MOV(64, R(bw_reg_a), ImmPtr(&m_branch_watch));
+    MOVZX(32, 8, bw_reg_b, MDisp(bw_reg_a, Core::BranchWatch::GetOffsetOfRecordingActive()));
+    TEST(32, R(bw_reg_b), R(bw_reg_b));
+
+    FixupBranch branch_in = J_CC(CC_NZ, Jump::Near);
+    SwitchToFarCode();
+    SetJumpTarget(branch_in);
+
+    // Assert RSCRATCH2 won't be clobbered before it is moved from.
+    static_assert(RSCRATCH2 != ABI_PARAM1);
+
+    ABI_PushRegistersAndAdjustStack(bw_caller_save, 0);
+    MOV(64, R(ABI_PARAM1), R(bw_reg_a));
+    // RSCRATCH2 holds the amount of faked branch watch hits. Move RSCRATCH2 first, because
+    // ABI_PARAM2 clobbers RSCRATCH2 on Windows and ABI_PARAM3 clobbers RSCRATCH2 on Linux!
+    MOV(32, R(ABI_PARAM4), R(RSCRATCH2));
+    const PPCAnalyst::CodeOp& op = js.op[2];
+    MOV(64, R(ABI_PARAM2), Imm64(Core::FakeBranchWatchCollectionKey{op.address, op.branchTo}));
+    MOV(32, R(ABI_PARAM3), Imm32(op.inst.hex));
+    ABI_CallFunction(m_ppc_state.msr.IR ? &Core::BranchWatch::HitVirtualTrue_fk_n :
+                                          &Core::BranchWatch::HitPhysicalTrue_fk_n);
+    ABI_PopRegistersAndAdjustStack(bw_caller_save, 0);
+
+    FixupBranch branch_out = J(Jump::Near);
+    SwitchToNearCode();
+    SetJumpTarget(branch_out);
+  }
+}
+
 void Jit64::dcbx(UGeckoInstruction inst)
 {
   FALLBACK_IF(m_accurate_cpu_cache_enabled);
@@ -252,89 +340,12 @@ void Jit64::dcbx(UGeckoInstruction inst)
   RCX64Reg loop_counter;
   if (make_loop)
   {
-    // We'll execute somewhere between one single cacheline invalidation and however many are needed
-    // to reduce the downcount to zero, never exceeding the amount requested by the game.
-    // To stay consistent with the rest of the code we adjust the involved registers (CTR and Rb)
-    // by the amount of cache lines we invalidate minus one -- since we'll run the regular addi and
-    // bdnz afterwards! So if we invalidate a single cache line, we don't adjust the registers at
-    // all, if we invalidate 2 cachelines we adjust the registers by one step, and so on.
-
     RCX64Reg reg_cycle_count = gpr.Scratch();
     RCX64Reg reg_downcount = gpr.Scratch();
     loop_counter = gpr.Scratch();
     RegCache::Realize(reg_cycle_count, reg_downcount, loop_counter);
 
-    // This must be true in order for us to pick up the DIV results and not trash any data.
-    static_assert(RSCRATCH == Gen::EAX && RSCRATCH2 == Gen::EDX);
-
-    // Alright, now figure out how many loops we want to do.
-    const u8 cycle_count_per_loop =
-        js.op[0].opinfo->num_cycles + js.op[1].opinfo->num_cycles + js.op[2].opinfo->num_cycles;
-
-    // This is both setting the adjusted loop count to 0 for the downcount <= 0 case and clearing
-    // the upper bits for the DIV instruction in the downcount > 0 case.
-    XOR(32, R(RSCRATCH2), R(RSCRATCH2));
-
-    MOV(32, R(RSCRATCH), PPCSTATE(downcount));
-    TEST(32, R(RSCRATCH), R(RSCRATCH));                       // if (downcount <= 0)
-    FixupBranch downcount_is_zero_or_negative = J_CC(CC_LE);  // only do 1 invalidation; else:
-    MOV(32, R(loop_counter), PPCSTATE_CTR);
-    MOV(32, R(reg_downcount), R(RSCRATCH));
-    MOV(32, R(reg_cycle_count), Imm32(cycle_count_per_loop));
-    DIV(32, R(reg_cycle_count));                  // RSCRATCH = downcount / cycle_count
-    LEA(32, RSCRATCH2, MDisp(loop_counter, -1));  // RSCRATCH2 = CTR - 1
-    // ^ Note that this CTR-1 implicitly handles the CTR == 0 case correctly.
-    CMP(32, R(RSCRATCH), R(RSCRATCH2));
-    CMOVcc(32, RSCRATCH2, R(RSCRATCH), CC_B);  // RSCRATCH2 = min(RSCRATCH, RSCRATCH2)
-
-    // RSCRATCH2 now holds the amount of loops to execute minus 1, which is the amount we need to
-    // adjust downcount, CTR, and Rb by to exit the loop construct with the right values in those
-    // registers.
-    SUB(32, R(loop_counter), R(RSCRATCH2));
-    MOV(32, PPCSTATE_CTR, R(loop_counter));  // CTR -= RSCRATCH2
-    IMUL(32, reg_cycle_count, R(RSCRATCH2));
-    // ^ Note that this cannot overflow because it's limited by (downcount/cycle_count).
-    SUB(32, R(reg_downcount), R(reg_cycle_count));
-    MOV(32, PPCSTATE(downcount), R(reg_downcount));  // downcount -= (RSCRATCH2 * reg_cycle_count)
-
-    SetJumpTarget(downcount_is_zero_or_negative);
-
-    // Load the loop_counter register with the amount of invalidations to execute.
-    LEA(32, loop_counter, MDisp(RSCRATCH2, 1));
-
-    if (IsDebuggingEnabled())
-    {
-      const X64Reg bw_reg_a = reg_cycle_count, bw_reg_b = reg_downcount;
-      const BitSet32 bw_caller_save = (CallerSavedRegistersInUse() | BitSet32{RSCRATCH2}) &
-                                      ~BitSet32{int(bw_reg_a), int(bw_reg_b)};
-
-      MOV(64, R(bw_reg_a), ImmPtr(&m_branch_watch));
-      MOVZX(32, 8, bw_reg_b, MDisp(bw_reg_a, Core::BranchWatch::GetOffsetOfRecordingActive()));
-      TEST(32, R(bw_reg_b), R(bw_reg_b));
-
-      FixupBranch branch_in = J_CC(CC_NZ, Jump::Near);
-      SwitchToFarCode();
-      SetJumpTarget(branch_in);
-
-      // Assert RSCRATCH2 won't be clobbered before it is moved from.
-      static_assert(RSCRATCH2 != ABI_PARAM1);
-
-      ABI_PushRegistersAndAdjustStack(bw_caller_save, 0);
-      MOV(64, R(ABI_PARAM1), R(bw_reg_a));
-      // RSCRATCH2 holds the amount of faked branch watch hits. Move RSCRATCH2 first, because
-      // ABI_PARAM2 clobbers RSCRATCH2 on Windows and ABI_PARAM3 clobbers RSCRATCH2 on Linux!
-      MOV(32, R(ABI_PARAM4), R(RSCRATCH2));
-      const PPCAnalyst::CodeOp& op = js.op[2];
-      MOV(64, R(ABI_PARAM2), Imm64(Core::FakeBranchWatchCollectionKey{op.address, op.branchTo}));
-      MOV(32, R(ABI_PARAM3), Imm32(op.inst.hex));
-      ABI_CallFunction(m_ppc_state.msr.IR ? &Core::BranchWatch::HitVirtualTrue_fk_n :
-                                            &Core::BranchWatch::HitPhysicalTrue_fk_n);
-      ABI_PopRegistersAndAdjustStack(bw_caller_save, 0);
-
-      FixupBranch branch_out = J(Jump::Near);
-      SwitchToNearCode();
-      SetJumpTarget(branch_out);
-    }
+    EmitDCBLoopCount(loop_counter, reg_cycle_count, reg_downcount);
   }
 
   X64Reg addr = RSCRATCH;
@@ -439,6 +450,18 @@ void Jit64::dcbz(UGeckoInstruction inst)
   int a = inst.RA;
   int b = inst.RB;
 
+  bool emit_fast_path = (m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR) && m_jit.jo.fastmem_arena;
+
+  // Games clear large buffers with the same loop pattern that dcbx looks for, so on the fast path
+  // we zero as many cache lines at once as the downcount allows.
+  if (emit_fast_path && a == 0 && b != 0 && CanMergeNextInstructions(2) &&
+      (js.op[1].inst.hex & 0xfc00'ffff) == 0x38000020 && js.op[1].inst.RA_6 == b &&
+      js.op[1].inst.RD_2 == b && js.op[2].inst.hex == 0x4200fff8)
+  {
+    dcbzLoop(inst);
+    return;
+  }
+
   {
     RCOpArg Ra = a ? gpr.Use(a, RCMode::Read) : RCOpArg::Imm32(0);
     RCOpArg Rb = gpr.Use(b, RCMode::Read);
@@ -456,8 +479,6 @@ void Jit64::dcbz(UGeckoInstruction inst)
     end_dcbz_hack = J_CC(CC_L);
   }
 
-  bool emit_fast_path = (m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR) && m_jit.jo.fastmem_arena;
-
   if (emit_fast_path)
   {
     // Perform lookup to see if we can use fast path.
@@ -494,6 +515,70 @@ void Jit64::dcbz(UGeckoInstruction inst)
     SetJumpTarget(end_dcbz_hack);
 }
 
+void Jit64::dcbzLoop(UGeckoInstruction inst)
+{
+  RCX64Reg Rb = gpr.Bind(inst.RB, RCMode::ReadWrite);
+  RCX64Reg addr = gpr.Scratch();
+  RCX64Reg max_extra_loops = gpr.Scratch();
+  RCX64Reg reg_cycle_count = gpr.Scratch();
+  RCX64Reg reg_downcount = gpr.Scratch();
+  RCX64Reg loop_counter = gpr.Scratch();
+  RegCache::Realize(Rb, addr, max_extra_loops, reg_cycle_count, reg_downcount, loop_counter);
+
+  MOV(32, R(addr), R(Rb));
+  AND(32, R(addr), Imm32(~31));
+
+  FixupBranch end_dcbz_hack;
+  if (m_low_dcbz_hack)
+  {
+    // HACK: Don't clear any memory in the [0x8000'0000, 0x8000'8000) region.
+    CMP(32, R(addr), Imm32(0x8000'8000));
+    end_dcbz_hack = J_CC(CC_L);
+  }
+
+  // Only the first cache line is looked up, so the loop must not leave its BAT block.
+  MOV(32, R(RSCRATCH), R(addr));
+  SHR(32, R(RSCRATCH), Imm8(PowerPC::BAT_INDEX_SHIFT));
+  MOV(64, R(RSCRATCH2), ImmPtr(m_mmu.GetDBATTable().data()));
+  TEST(32, MComplex(RSCRATCH2, RSCRATCH, SCALE_4, 0), Imm32(PowerPC::BAT_PHYSICAL_BIT));
+  FixupBranch slow = J_CC(CC_Z, Jump::Near);
+
+  // max_extra_loops = the number of cache lines after this one in the BAT block
+  MOV(32, R(max_extra_loops), R(addr));
+  NOT(32, R(max_extra_loops));
+  AND(32, R(max_extra_loops), Imm32((1U << PowerPC::BAT_INDEX_SHIFT) - 1));
+  SHR(32, R(max_extra_loops), Imm8(5));
+
+  EmitDCBLoopCount(loop_counter, reg_cycle_count, reg_downcount, max_extra_loops);
+
+  SHL(32, R(RSCRATCH2), Imm8(5));
+  ADD(32, R(Rb), R(RSCRATCH2));  // Rb += (RSCRATCH2 * 32)
+
+  XORPS(XMM0, R(XMM0));
+  const u8* loop_start = GetCodePtr();
+  MOVAPS(MComplex(RMEM, addr, SCALE_1, 0), XMM0);
+  MOVAPS(MComplex(RMEM, addr, SCALE_1, 16), XMM0);
+  ADD(32, R(addr), Imm8(32));
+  SUB(32, R(loop_counter), Imm8(1));
+  J_CC(CC_NZ, loop_start);
+
+  // Slow path: clear a single cache line through the general-case code, and let the addi and bdnz
+  // take care of the rest.
+  SwitchToFarCode();
+  SetJumpTarget(slow);
+  MOV(32, PPCSTATE(pc), Imm32(js.compilerPC));
+  BitSet32 registersInUse = CallerSavedRegistersInUse();
+  ABI_PushRegistersAndAdjustStack(registersInUse, 0);
+  ABI_CallFunctionPR(PowerPC::ClearDCacheLineFromJit, &m_mmu, addr);
+  ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+  FixupBranch end_far_code = J(Jump::Near);
+  SwitchToNearCode();
+  SetJumpTarget(end_far_code);
+
+  if (m_low_dcbz_hack)
+    SetJumpTarget(end_dcbz_hack);
+}
+
 void Jit64::stX(UGeckoInstruction inst)
 {
   INSTRUCTION_START
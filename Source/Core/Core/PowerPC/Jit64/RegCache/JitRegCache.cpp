@@ -281,6 +281,7 @@ RegCache::RegCache(Jit64& jit) : m_jit{jit}
 
 void RegCache::Start()
 {
+  m_spill_count = 0;
   m_xregs.fill({});
   for (size_t i = 0; i < m_regs.size(); i++)
   {
@@ -474,6 +475,19 @@ void RegCache::PreloadRegisters(BitSet32 to_preload)
   }
 }
 
+void RegCache::FreeCleanRegisters(BitSet32 pregs)
+{
+  for (preg_t preg : pregs)
+  {
+    if (!m_regs[preg].IsBound() || m_regs[preg].IsLocked() || m_regs[preg].IsRevertable())
+      continue;
+
+    const X64CachedReg& xreg = m_xregs[RX(preg)];
+    if (!xreg.IsDirty() && !xreg.IsLocked())
+      StoreFromRegister(preg);
+  }
+}
+
 BitSet32 RegCache::RegistersInUse() const
 {
   BitSet32 result;
@@ -609,6 +623,7 @@ X64Reg RegCache::GetFreeXReg()
   if (best_xreg != INVALID_REG)
   {
     StoreFromRegister(best_preg);
+    m_spill_count++;
     return best_xreg;
   }
 
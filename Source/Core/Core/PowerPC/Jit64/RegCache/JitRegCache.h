@@ -176,8 +176,15 @@ public:
   bool IsAllUnlocked() const;
 
   void PreloadRegisters(BitSet32 pregs);
+  // Unbinds those of pregs whose host registers match ppcState and aren't locked. Call this with
+  // the registers that aren't used again in the block, so that they don't need to be spilled or
+  // saved around calls to slow paths. No code is emitted.
+  void FreeCleanRegisters(BitSet32 pregs);
   BitSet32 RegistersInUse() const;
 
+  // The number of times a register had to be evicted to make room for another one in this block.
+  u32 GetSpillCount() const { return m_spill_count; }
+
 protected:
   friend class RCOpArg;
   friend class RCX64Reg;
@@ -219,4 +226,5 @@ protected:
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
   std::array<RCConstraint, 32> m_constraints;
   Gen::XEmitter* m_emitter = nullptr;
+  u32 m_spill_count = 0;
 };
@@ -316,6 +316,88 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
   }
 }
 
+// Visitor that generates code to write a MMIO value.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Core::System* system, Gen::X64CodeBlock* code, BitSet32 registers_in_use,
+                         const Gen::OpArg& value, u32 address)
+      : m_system(system), m_code(code), m_registers_in_use(registers_in_use), m_value(value),
+        m_address(address)
+  {
+  }
+
+  void VisitNop() override
+  {
+    // Do nothing
+  }
+  void VisitDirect(T* addr, u32 mask) override { WriteToAddrMask(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(Core::System&, u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  void WriteToAddrMask(int sbits, void* ptr, u32 mask)
+  {
+    m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+
+    // Immediates and registers can be stored directly if no masking is required.
+    const u32 all_ones = (1ULL << sbits) - 1;
+    if ((all_ones & mask) == all_ones && (m_value.IsImm() || m_value.IsSimpleReg()))
+    {
+      m_code->MOV(sbits, MatR(RSCRATCH2), m_value);
+    }
+    else
+    {
+      m_code->MOV(sbits, R(RSCRATCH), m_value);
+      if ((all_ones & mask) != all_ones)
+        m_code->AND(32, R(RSCRATCH), Imm32(mask));
+      m_code->MOV(sbits, MatR(RSCRATCH2), R(RSCRATCH));
+    }
+  }
+
+  void CallLambda(int sbits, const std::function<void(Core::System&, u32, T)>* lambda)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallLambdaPCA(sbits, lambda, m_system, m_address, m_value);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Core::System* m_system;
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_value;
+  u32 m_address;
+};
+
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, const Gen::OpArg& value,
+                                      BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(&m_jit.m_system, this, registers_in_use, value, address);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(&m_jit.m_system, this, registers_in_use, value, address);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(&m_jit.m_system, this, registers_in_use, value, address);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
                                  s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
@@ -661,6 +743,13 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
   }
+  else if (const u32 mmio_address = m_jit.m_mmu.IsOptimizableMMIOAccess(address, accessSize);
+           accessSize != 64 && mmio_address)
+  {
+    MMIOWriteRegToAddr(m_jit.m_system.GetMemory().GetMMIOMapping(), arg, registersInUse,
+                       mmio_address, accessSize);
+    return false;
+  }
   else
   {
     // Helps external systems know which instruction triggered the write
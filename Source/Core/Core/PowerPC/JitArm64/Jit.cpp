@@ -14,6 +14,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -55,7 +56,7 @@ void JitArm64::Init()
   // m_far_code_0, m_near_code_0, m_near_code_1, m_far_code_1.
   // AddChildCodeSpace grabs space from the end of the parent region,
   // so we have to call AddChildCodeSpace in reverse order.
-  AllocCodeSpace(TOTAL_CODE_SIZE);
+  AllocCodeSpace(TOTAL_CODE_SIZE, Config::Get(Config::MAIN_LARGE_PAGES));
   AddChildCodeSpace(&m_far_code_1, FAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_1, NEAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_0, NEAR_CODE_SIZE);
@@ -92,12 +93,16 @@ void JitArm64::SetOptimizationEnabled(bool enabled)
     analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
     analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
     analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_FOLLOW);
+    analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_PAIRED_FUSION);
   }
   else
   {
     analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
     analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
     analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_FOLLOW);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_PAIRED_FUSION);
   }
 }
 
@@ -833,6 +838,24 @@ bool JitArm64::HandleFunctionHooking(u32 address)
   if (!result)
     return false;
 
+  if (result.type == HLE::HookType::Fast)
+  {
+    FlushCarry();
+    gpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
+    fpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
+    ABI_CallFunction(&HLE::ExecuteFastFromJIT, js.compilerPC, result.hook_index, &m_system);
+
+    // If the replacement declined, fall through to the original function.
+    FixupBranch not_handled = CBZ(ARM64Reg::W0);
+    const u32 downcount_amount = js.downcountAmount;
+    LDR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(npc));
+    js.downcountAmount += js.st.numCycles;
+    WriteExit(DISPATCHER_PC);
+    js.downcountAmount = downcount_amount;
+    SetJumpTarget(not_handled);
+    return false;
+  }
+
   HLEFunction(result.hook_index);
 
   if (result.type != HLE::HookType::Replace)
@@ -1013,13 +1036,23 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Evicting the oldest blocks is a lot cheaper than recompiling everything, so try that first.
+    // Only once there is nothing left to evict, clear the entire JIT cache and retry.
+    if (blocks.EvictOldestBlocks() != 0)
+    {
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(DYNA_REC, "flushing code caches, please report if this happens a lot");
+    blocks.RecordFullClear();
     ClearCache();
     Jit(em_address, false);
     return;
@@ -1084,7 +1117,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   js.isLastInstruction = false;
   js.firstFPInstructionFound = false;
-  js.assumeNoPairedQuantize = false;
+  js.constantGqrValid = BitSet8();
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
   js.mustCheckFifo = false;
@@ -1101,13 +1134,30 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
-  if (code_block.m_gqr_used.Count() == 1 &&
-      js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
+  // Assume that GQR values don't change often at runtime. Many paired-heavy games use largely float
+  // loads and stores, which are significantly faster when inlined, and the others can at least
+  // skip the GQR decoding and the indirect call.
+  if (js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
   {
-    int gqr = *code_block.m_gqr_used.begin();
-    if (!code_block.m_gqr_modified[gqr] && !GQR(m_ppc_state, gqr))
+    // If there are GQRs used but not set, we'll treat those as constant and optimize them
+    const BitSet8 gqr_static = code_block.m_gqr_used & ~code_block.m_gqr_modified;
+    if (gqr_static)
     {
-      LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
+      // Insert a check that the GQRs are still the value we expect at the start of the block in
+      // case our guess turns out wrong. All differences are ORed together so that there is only
+      // a single branch to the far code.
+      MOVI2R(ARM64Reg::W0, 0);
+      for (int gqr : gqr_static)
+      {
+        const u32 value = GQR(m_ppc_state, gqr);
+        js.constantGqr[gqr] = value;
+        LDR(IndexType::Unsigned, ARM64Reg::W1, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
+        if (value != 0)
+          EORI2R(ARM64Reg::W1, ARM64Reg::W1, value, ARM64Reg::W2);
+        ORR(ARM64Reg::W0, ARM64Reg::W0, ARM64Reg::W1);
+      }
+      js.constantGqrValid = gqr_static;
+
       FixupBranch no_fail = CBZ(ARM64Reg::W0);
       FixupBranch fail = B();
       SwitchToFarCode();
@@ -1119,7 +1169,6 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       B(dispatcher_no_check);
       SwitchToNearCode();
       SetJumpTarget(no_fail);
-      js.assumeNoPairedQuantize = true;
     }
   }
 
@@ -1158,9 +1207,12 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     {
       // Gather pipe writes using a non-immediate address are discovered by profiling.
       const u32 prev_address = m_code_buffer[i - 1].address;
-      bool gatherPipeIntCheck =
+      const bool profiled_gather_pipe_write =
           js.fifoWriteAddresses.find(prev_address) != js.fifoWriteAddresses.end();
+      bool gatherPipeIntCheck = profiled_gather_pipe_write;
 
+      std::optional<FixupBranch> no_burst;
+      ARM64Reg burst_check_reg = ARM64Reg::INVALID_REG;
       if (jo.optimizeGatherPipe &&
           (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_SIZE || js.mustCheckFifo))
       {
@@ -1168,9 +1220,21 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.mustCheckFifo = false;
 
         gpr.Lock(ARM64Reg::W30);
+        const ARM64Reg WA = gpr.GetReg();
+        const ARM64Reg XA = EncodeRegTo64(WA);
+        burst_check_reg = WA;
         BitSet32 regs_in_use = gpr.GetCallerSavedUsed();
         BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
         regs_in_use[DecodeReg(ARM64Reg::W30)] = 0;
+        regs_in_use[DecodeReg(WA)] = 0;
+
+        // Only call out of the block once there is a full burst to send.
+        static_assert(PPCSTATE_OFF(gather_pipe_ptr) <= 504);
+        static_assert(PPCSTATE_OFF(gather_pipe_ptr) + 8 == PPCSTATE_OFF(gather_pipe_base_ptr));
+        LDP(IndexType::Signed, XA, ARM64Reg::X30, PPC_REG, PPCSTATE_OFF(gather_pipe_ptr));
+        SUB(XA, XA, ARM64Reg::X30);
+        CMP(XA, GPFifo::GATHER_PIPE_SIZE);
+        no_burst = B(CC_LT);
 
         ABI_PushRegisters(regs_in_use);
         m_float_emit.ABI_PushRegisters(fprs_in_use, ARM64Reg::X30);
@@ -1180,14 +1244,25 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
         gpr.Unlock(ARM64Reg::W30);
         gatherPipeIntCheck = true;
+
+        // Only a burst can raise a CP interrupt, so unless a profiled write might have sent one,
+        // the exception check below is skipped along with the call. WA stays allocated for it, so
+        // that both paths leave the register cache in the same state.
+        if (profiled_gather_pipe_write)
+        {
+          SetJumpTarget(*no_burst);
+          no_burst.reset();
+        }
       }
       // Gather pipe writes can generate an exception; add an exception check.
       // TODO: This doesn't really match hardware; the CP interrupt is
       // asynchronous.
       if (jo.optimizeGatherPipe && gatherPipeIntCheck)
       {
-        ARM64Reg WA = gpr.GetReg();
+        ARM64Reg WA =
+            burst_check_reg != ARM64Reg::INVALID_REG ? burst_check_reg : gpr.GetReg();
         ARM64Reg XA = EncodeRegTo64(WA);
+        burst_check_reg = ARM64Reg::INVALID_REG;
 
         LDR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF(Exceptions));
         FixupBranch no_ext_exception = TBZ(WA, MathUtil::IntLog2(EXCEPTION_EXTERNAL_INT));
@@ -1215,6 +1290,11 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
         gpr.Unlock(WA);
       }
+
+      if (no_burst)
+        SetJumpTarget(*no_burst);
+      if (burst_check_reg != ARM64Reg::INVALID_REG)
+        gpr.Unlock(burst_check_reg);
     }
 
     if (HandleFunctionHooking(op.address))
@@ -1224,8 +1304,9 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     {
       if (IsDebuggingEnabled())
       {
-        // The only thing that currently sets op.skip is the BLR following optimization.
-        // If any non-branch instruction starts setting that too, this will need to be changed.
+        // The only thing that sets op.skip while debugging is the BLR following optimization
+        // (paired single fusion is disabled). If any non-branch instruction starts setting that
+        // too, this will need to be changed.
         ASSERT(op.inst.hex == 0x4e800020);
         const ARM64Reg bw_reg_a = gpr.GetReg(), bw_reg_b = gpr.GetReg();
         const BitSet32 gpr_caller_save =
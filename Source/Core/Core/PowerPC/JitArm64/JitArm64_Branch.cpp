@@ -255,6 +255,39 @@ void JitArm64::bcx(UGeckoInstruction inst)
     STR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF_SPR(SPR_LR));
   }
 
+  // The analyzer continued the block at the branch target, so it's the fallthrough path which
+  // has to leave the block.
+  if (js.op->branchFollowed)
+  {
+    FixupBranch taken = B();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+
+    gpr.Flush(FlushMode::MaintainState, WA);
+    fpr.Flush(FlushMode::MaintainState, ARM64Reg::INVALID_REG);
+    if (IsDebuggingEnabled())
+    {
+      WriteBranchWatch<false>(js.compilerPC, js.compilerPC + 4, inst, WA, WB, {}, {});
+    }
+    WriteExit(js.compilerPC + 4);
+
+    SetJumpTarget(taken);
+    if (IsDebuggingEnabled())
+    {
+      const BitSet32 gpr_caller_save =
+          gpr.GetCallerSavedUsed() & ~BitSet32{DecodeReg(WA), DecodeReg(WB)};
+      WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, WA, WB, gpr_caller_save,
+                             fpr.GetCallerSavedUsed());
+    }
+
+    gpr.Unlock(WA);
+    if (WB != WA)
+      gpr.Unlock(WB);
+    return;
+  }
+
   gpr.Flush(FlushMode::MaintainState, WB);
   fpr.Flush(FlushMode::MaintainState, ARM64Reg::INVALID_REG);
 
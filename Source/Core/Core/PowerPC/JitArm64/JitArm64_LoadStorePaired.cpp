@@ -22,10 +22,6 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStorePairedOff);
 
-  // If fastmem is enabled, the asm routines assume address translation is on.
-  FALLBACK_IF(!js.assumeNoPairedQuantize && jo.fastmem &&
-              !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
-
   // X30 is LR
   // X0 is a temporary
   // X1 is the address
@@ -38,9 +34,17 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
   const int i = indexed ? inst.Ix : inst.I;
   const int w = indexed ? inst.Wx : inst.W;
 
+  // The load half of the GQR lives in the upper 16 bits.
+  const bool gqr_is_constant = js.constantGqrValid[i];
+  const u32 gqr_value = js.constantGqr[i] >> 16;
+  const bool is_float = gqr_is_constant && (gqr_value & 0x7) == 0;
+
+  // If fastmem is enabled, the asm routines assume address translation is on.
+  FALLBACK_IF(!is_float && jo.fastmem && !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
+
   gpr.Lock(ARM64Reg::W1, ARM64Reg::W30);
   fpr.Lock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!is_float)
   {
     gpr.Lock(ARM64Reg::W0, ARM64Reg::W2, ARM64Reg::W3);
     fpr.Lock(ARM64Reg::Q1);
@@ -77,7 +81,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (is_float)
   {
     BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
     BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
@@ -98,6 +102,23 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     EmitBackpatchRoutine(flags, MemAccessMode::Auto, VS, EncodeRegTo64(addr_reg), gprs_in_use,
                          fprs_in_use);
   }
+  else if (gqr_is_constant)
+  {
+    // Stash PC in case asm routine needs to call into C++
+    MOVI2R(ARM64Reg::W30, js.compilerPC);
+    STR(IndexType::Unsigned, ARM64Reg::W30, PPC_REG, PPCSTATE_OFF(pc));
+
+    // We know what the GQR is here, so we can load the scale and call into the load method
+    // directly.
+    MOVI2R(scale_reg, (gqr_value & 0x3F00) >> 8);
+    const u8* const* routines = w ? single_load_quantized : paired_load_quantized;
+    MOVP2R(EncodeRegTo64(type_reg), routines[gqr_value & 0x7]);
+    BLR(EncodeRegTo64(type_reg));
+
+    WriteConditionalExceptionExit(EXCEPTION_DSI, ARM64Reg::W30, ARM64Reg::Q1);
+
+    m_float_emit.ORR(EncodeRegToDouble(VS), ARM64Reg::D0, ARM64Reg::D0);
+  }
   else
   {
     LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + i));
@@ -135,7 +156,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
 
   gpr.Unlock(ARM64Reg::W1, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!is_float)
   {
     gpr.Unlock(ARM64Reg::W0, ARM64Reg::W2, ARM64Reg::W3);
     fpr.Unlock(ARM64Reg::Q1);
@@ -151,10 +172,6 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStorePairedOff);
 
-  // If fastmem is enabled, the asm routines assume address translation is on.
-  FALLBACK_IF(!js.assumeNoPairedQuantize && jo.fastmem &&
-              !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
-
   // X30 is LR
   // X0 is a temporary
   // X1 is the scale
@@ -167,15 +184,23 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   const int i = indexed ? inst.Ix : inst.I;
   const int w = indexed ? inst.Wx : inst.W;
 
+  // The store half of the GQR lives in the lower 16 bits.
+  const bool gqr_is_constant = js.constantGqrValid[i];
+  const u32 gqr_value = js.constantGqr[i] & 0xffff;
+  const bool is_float = gqr_is_constant && (gqr_value & 0x7) == 0;
+
+  // If fastmem is enabled, the asm routines assume address translation is on.
+  FALLBACK_IF(!is_float && jo.fastmem && !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
+
   fpr.Lock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!is_float)
     fpr.Lock(ARM64Reg::Q1);
 
   const bool have_single = fpr.IsSingle(inst.RS);
 
   ARM64Reg VS = fpr.R(inst.RS, have_single ? RegType::Single : RegType::Register);
 
-  if (js.assumeNoPairedQuantize)
+  if (is_float)
   {
     if (!have_single)
     {
@@ -205,9 +230,9 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   }
 
   gpr.Lock(ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W30);
-  if (!js.assumeNoPairedQuantize || !jo.fastmem)
+  if (!is_float || !jo.fastmem)
     gpr.Lock(ARM64Reg::W0);
-  if (!js.assumeNoPairedQuantize && !jo.fastmem)
+  if (!is_float && !jo.fastmem)
     gpr.Lock(ARM64Reg::W3);
 
   constexpr ARM64Reg type_reg = ARM64Reg::W0;
@@ -236,7 +261,7 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (is_float)
   {
     BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
     BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
@@ -255,6 +280,21 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     EmitBackpatchRoutine(flags, MemAccessMode::Auto, VS, EncodeRegTo64(addr_reg), gprs_in_use,
                          fprs_in_use);
   }
+  else if (gqr_is_constant)
+  {
+    // Stash PC in case asm routine needs to call into C++
+    MOVI2R(ARM64Reg::W30, js.compilerPC);
+    STR(IndexType::Unsigned, ARM64Reg::W30, PPC_REG, PPCSTATE_OFF(pc));
+
+    // We know what the GQR is here, so we can load the scale and call into the store method
+    // directly.
+    MOVI2R(scale_reg, (gqr_value & 0x3F00) >> 8);
+    const u8* const* routines = w ? single_store_quantized : paired_store_quantized;
+    MOVP2R(EncodeRegTo64(type_reg), routines[gqr_value & 0x7]);
+    BLR(EncodeRegTo64(type_reg));
+
+    WriteConditionalExceptionExit(EXCEPTION_DSI, ARM64Reg::W30, ARM64Reg::Q1);
+  }
   else
   {
     LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + i));
@@ -279,15 +319,15 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize && !have_single)
+  if (is_float && !have_single)
     fpr.Unlock(VS);
 
   gpr.Unlock(ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize || !jo.fastmem)
+  if (!is_float || !jo.fastmem)
     gpr.Unlock(ARM64Reg::W0);
-  if (!js.assumeNoPairedQuantize && !jo.fastmem)
+  if (!is_float && !jo.fastmem)
     gpr.Unlock(ARM64Reg::W3);
-  if (!js.assumeNoPairedQuantize)
+  if (!is_float)
     fpr.Unlock(ARM64Reg::Q1);
 }
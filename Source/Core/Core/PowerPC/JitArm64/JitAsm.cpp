@@ -130,10 +130,14 @@ void JitArm64::GenerateAsm()
       ARM64Reg feature_flags_2 = ARM64Reg::W13;
       ARM64Reg entry = ARM64Reg::X14;
 
-      // iCache[(address >> 2) & iCache_Mask];
+      // iCache[((address >> 2) ^ (feature_flags << shift)) & iCache_Mask];
+      LDR(IndexType::Unsigned, feature_flags_2, PPC_REG, PPCSTATE_OFF(feature_flags));
       MOVP2R(cache_base, GetBlockCache()->GetFastBlockMapFallback());
       UBFX(pc_masked, DISPATCHER_PC, 2,
-           MathUtil::IntLog2(JitBaseBlockCache::FAST_BLOCK_MAP_FALLBACK_ELEMENTS) - 2);
+           MathUtil::IntLog2(JitBaseBlockCache::FAST_BLOCK_MAP_FALLBACK_ELEMENTS));
+      EOR(pc_masked, pc_masked, feature_flags_2,
+          ArithOption(feature_flags_2, ShiftType::LSL,
+                      JitBaseBlockCache::FAST_BLOCK_MAP_FALLBACK_FEATURE_FLAGS_SHIFT));
       LDR(block, cache_base, ArithOption(EncodeRegTo64(pc_masked), true));
       FixupBranch not_found = CBZ(block);
 
@@ -141,7 +145,6 @@ void JitArm64::GenerateAsm()
       static_assert(offsetof(JitBlockData, feature_flags) + 4 ==
                     offsetof(JitBlockData, effectiveAddress));
       LDP(IndexType::Signed, feature_flags, pc, block, offsetof(JitBlockData, feature_flags));
-      LDR(IndexType::Unsigned, feature_flags_2, PPC_REG, PPCSTATE_OFF(feature_flags));
       CMP(pc, DISPATCHER_PC);
       FixupBranch pc_mismatch = B(CC_NEQ);
 
@@ -5,12 +5,17 @@
 
 #include <algorithm>
 #include <array>
+#include <string>
 #include <utility>
 
+#include <fmt/format.h>
+
 #include "Common/Align.h"
 #include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "Common/MemoryUtil.h"
 #include "Common/Thread.h"
+#include "Common/Version.h"
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/MainSettings.h"
@@ -19,6 +24,9 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -57,7 +65,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -74,6 +82,8 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_conditional_branch_following,
+     &Config::MAIN_JIT_FOLLOW_CONDITIONAL_BRANCH},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
@@ -90,7 +100,11 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  if (jit.InterpretColdBlock(em_address))
+    return;
+
   jit.Jit(em_address);
+  jit.CompilePersistentBlocks(em_address);
 }
 
 JitBase::JitBase(Core::System& system)
@@ -129,8 +143,14 @@ void JitBase::RefreshConfig()
     m_low_dcbz_hack = false;
   }
 
+  m_compile_threshold =
+      static_cast<u32>(std::max(Config::Get(Config::MAIN_JIT_COMPILE_THRESHOLD), 0));
+  m_cold_block_run_counts.clear();
+
   analyzer.SetDebuggingEnabled(m_enable_debugging);
   analyzer.SetBranchFollowingEnabled(m_enable_branch_following);
+  analyzer.SetConditionalBranchFollowingEnabled(m_enable_conditional_branch_following);
+  analyzer.SetBranchWatch(&m_system.GetPowerPC().GetBranchWatch());
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
 
@@ -138,6 +158,7 @@ void JitBase::RefreshConfig()
   jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
                EMM::IsExceptionHandlerSupported();
   jo.memcheck = m_system.IsMMUMode() || m_system.IsPauseOnPanicMode() || any_watchpoints;
+  analyzer.SetMemoryExceptionsEnabled(jo.memcheck);
   jo.fp_exceptions = m_enable_float_exceptions;
   jo.div_by_zero_exceptions = m_enable_div_by_zero_exceptions;
 }
@@ -260,6 +281,72 @@ void JitBase::CleanUpAfterStackFault()
   }
 }
 
+u64 JitBase::GetPersistentCacheKey() const
+{
+  // Anything that affects which blocks get formed or where they end has to be part of the key.
+  std::string key = fmt::format("{}:{}:", Common::GetScmRevGitStr(),
+                                static_cast<int>(Config::Get(Config::MAIN_CPU_CORE)));
+  for (const auto& setting : JIT_SETTINGS)
+    key += this->*setting.first ? '1' : '0';
+
+  return Common::GetHash64(reinterpret_cast<const u8*>(key.data()), static_cast<u32>(key.size()),
+                           0);
+}
+
+bool JitBase::InterpretColdBlock(u32 em_address)
+{
+  // The interpreter doesn't know about breakpoints or single stepping outside of its own loop.
+  if (m_compile_threshold == 0 || m_enable_debugging)
+    return false;
+
+  const u64 key = (static_cast<u64>(m_ppc_state.feature_flags) << 32) | em_address;
+  u32& run_count = m_cold_block_run_counts[key];
+  if (++run_count >= m_compile_threshold)
+  {
+    m_cold_block_run_counts.erase(key);
+    return false;
+  }
+
+  // Code that only runs a handful of times (e.g. while loading) would spend more time in the
+  // compiler than it saves, so interpret it for now. The dispatcher picks up from the new PC.
+  const int cycles = m_system.GetInterpreter().RunBlock(static_cast<u32>(m_code_buffer.size()));
+  m_ppc_state.downcount -= cycles;
+
+  // The block may have changed MSR.DR, either directly or by raising an exception.
+  m_system.GetJitInterface().UpdateMembase();
+  return true;
+}
+
+void JitBase::CompilePersistentBlocks(u32 em_address)
+{
+  // While debugging, block boundaries depend on breakpoints and stepping.
+  if (m_enable_debugging)
+    return;
+
+  JitBaseBlockCache& blocks = *GetBlockCache();
+  blocks.SyncPersistentCache(SConfig::GetInstance().GetGameID(), GetPersistentCacheKey());
+
+  const auto translated = m_mmu.JitCache_TranslateAddress(em_address);
+  if (!translated.valid)
+    return;
+
+  const CPUEmuFeatureFlags feature_flags = m_ppc_state.feature_flags;
+  for (const JitPersistentCache::Entry& entry :
+       blocks.TakePersistentBlocks(translated.address, feature_flags))
+  {
+    // Compiling a block whose entry point can't be translated would raise an ISI, so only
+    // compile blocks that are still mapped the way they were when they were recorded.
+    const auto entry_translated = m_mmu.JitCache_TranslateAddress(entry.effective_address);
+    if (!entry_translated.valid || entry_translated.address != entry.physical_address)
+      continue;
+
+    if (blocks.GetBlockFromStartAddress(entry.effective_address, feature_flags))
+      continue;
+
+    Jit(entry.effective_address);
+  }
+}
+
 bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
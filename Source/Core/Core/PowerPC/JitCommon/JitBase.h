@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -102,7 +103,6 @@ protected:
     bool fixupExceptionHandler;
     Gen::FixupBranch exceptionHandler;
 
-    bool assumeNoPairedQuantize;
     BitSet8 constantGqrValid;
     std::array<u32, 8> constantGqr;
     bool firstFPInstructionFound;
@@ -150,6 +150,7 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_conditional_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -158,11 +159,15 @@ protected:
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
 
+  // Blocks are run through the interpreter until they have been reached this many times.
+  u32 m_compile_threshold = 0;
+  std::unordered_map<u64, u32> m_cold_block_run_counts;
+
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh();
   void RefreshConfig();
@@ -176,6 +181,8 @@ protected:
 
   bool CanMergeNextInstructions(int count) const;
 
+  u64 GetPersistentCacheKey() const;
+
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op);
 
 public:
@@ -194,6 +201,14 @@ public:
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Runs the block at em_address through the interpreter instead of compiling it if it hasn't
+  // been reached often enough yet. Returns false if the block should be compiled.
+  bool InterpretColdBlock(u32 em_address);
+
+  // Compiles the blocks that a previous session of the running title compiled in the same
+  // physical page as em_address, if the persistent block cache is enabled.
+  void CompilePersistentBlocks(u32 em_address);
+
   virtual const CommonAsmRoutinesBase* GetAsmRoutines() = 0;
 
   virtual bool HandleFault(uintptr_t access_address, SContext* ctx) = 0;
@@ -8,17 +8,24 @@
 #include <cstring>
 #include <functional>
 #include <map>
+#include <optional>
 #include <set>
+#include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
+#include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -26,6 +33,27 @@
 
 using namespace Gen;
 
+namespace
+{
+// Removes all instruction addresses in [address, address + length) from the given set. Large
+// ranges walk the set instead of probing it once per instruction.
+void EraseAddressRange(std::unordered_set<u32>& addresses, u32 address, u32 length)
+{
+  if (addresses.empty())
+    return;
+
+  if (length / 4 <= addresses.size())
+  {
+    for (u32 i = 0; i < length; i += 4)
+      addresses.erase(address + i);
+  }
+  else
+  {
+    std::erase_if(addresses, [&](u32 i) { return i - address < length; });
+  }
+}
+}  // namespace
+
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
   return physical_addresses.lower_bound(address) !=
@@ -54,6 +82,8 @@ void JitBaseBlockCache::Init()
 {
   Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
 
+  m_persistent_cache_enabled = Config::Get(Config::MAIN_JIT_PERSISTENT_CACHE);
+
   m_entry_points_ptr = nullptr;
 #ifdef _ARCH_64
   if (Config::Get(Config::MAIN_LARGE_ENTRY_POINTS_MAP))
@@ -67,6 +97,9 @@ void JitBaseBlockCache::Shutdown()
 {
   Common::JitRegister::Shutdown();
 
+  SavePersistentCache();
+  m_persistent_cache.Clear();
+
   m_entry_points_arena.Release();
 }
 
@@ -80,9 +113,10 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
-  for (auto& e : block_map)
   {
-    DestroyBlock(e.second);
+    const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+    for (auto& e : block_map)
+      DestroyBlock(e.second);
   }
   block_map.clear();
   links_to.clear();
@@ -143,6 +177,7 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     m_fast_block_map_fallback[index] = &block;
   }
   block.fast_block_map_index = index;
+  block.sequence_number = ++m_next_sequence_number;
 
   block.physical_addresses = physical_addresses;
 
@@ -163,6 +198,9 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     LinkBlock(block);
   }
 
+  if (m_persistent_cache_enabled)
+    m_persistent_cache.Record(m_jit.m_system.GetMemory(), block);
+
   Common::Symbol* symbol = nullptr;
   if (Common::JitRegister::IsEnabled() &&
       (symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
@@ -177,6 +215,19 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 }
 
+void JitBaseBlockCache::DiscardBlock(JitBlock& block)
+{
+  auto block_map_iter = block_map.equal_range(block.physicalAddress);
+  for (auto it = block_map_iter.first; it != block_map_iter.second; ++it)
+  {
+    if (&it->second == &block)
+    {
+      block_map.erase(it);
+      return;
+    }
+  }
+}
+
 JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFlags feature_flags)
 {
   u32 translated_addr = addr;
@@ -291,6 +342,12 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
   }
   else if (length > 32)
   {
+    // Blocks only cover cache lines whose valid_block bit is set, so if none of the lines in the
+    // range has its bit set there is nothing to invalidate. This keeps dcb* loops over plain data
+    // from walking the block maps.
+    if (!valid_block.TestRange(physical_address / 32, (physical_address + length - 1) / 32))
+      destroy_block = false;
+
     // Even if we can't check the set for optimization, we still want to remove all fully covered
     // cache lines from the valid_block set so that later calls don't try to invalidate already
     // cleared regions.
@@ -311,12 +368,9 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
     // being in the right place between instructions).
     if (!forced)
     {
-      for (u32 i = address; i < address + length; i += 4)
-      {
-        m_jit.js.fifoWriteAddresses.erase(i);
-        m_jit.js.pairedQuantizeAddresses.erase(i);
-        m_jit.js.noSpeculativeConstantsAddresses.erase(i);
-      }
+      EraseAddressRange(m_jit.js.fifoWriteAddresses, address, length);
+      EraseAddressRange(m_jit.js.pairedQuantizeAddresses, address, length);
+      EraseAddressRange(m_jit.js.noSpeculativeConstantsAddresses, address, length);
     }
   }
 }
@@ -327,6 +381,8 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
   auto start = block_range_map.lower_bound(address & range_mask);
   auto end = block_range_map.lower_bound(address + length);
+  // Only switch the JIT pages to writable once, and only if something is actually destroyed.
+  std::optional<Common::ScopedJITPageWriteAndNoExecute> enable_jit_page_writes;
   while (start != end)
   {
     // Iterate over all blocks in the macro block.
@@ -343,6 +399,8 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
             block_range_map[addr & range_mask].erase(block);
 
         // And remove the block.
+        if (!enable_jit_page_writes)
+          enable_jit_page_writes.emplace();
         DestroyBlock(*block);
         auto block_map_iter = block_map.equal_range(block->physicalAddress);
         while (block_map_iter.first != block_map_iter.second)
@@ -375,6 +433,38 @@ u32* JitBaseBlockCache::GetBlockBitSet() const
   return valid_block.m_valid_block.get();
 }
 
+void JitBaseBlockCache::SyncPersistentCache(const std::string& game_id, u64 config_key)
+{
+  if (!m_persistent_cache_enabled || game_id.empty())
+    return;
+
+  const std::string path = JitPersistentCache::GetCachePath(game_id);
+  if (m_persistent_cache.GetLoadedPath() == path && m_persistent_cache_key == config_key)
+    return;
+
+  SavePersistentCache();
+  m_persistent_cache_key = config_key;
+  m_persistent_cache.Load(path, config_key);
+}
+
+void JitBaseBlockCache::SavePersistentCache()
+{
+  if (!m_persistent_cache_enabled || m_persistent_cache.GetLoadedPath().empty())
+    return;
+
+  m_persistent_cache.Save(m_persistent_cache.GetLoadedPath(), m_persistent_cache_key);
+}
+
+std::vector<JitPersistentCache::Entry>
+JitBaseBlockCache::TakePersistentBlocks(u32 physical_address, CPUEmuFeatureFlags feature_flags)
+{
+  if (!m_persistent_cache_enabled || !m_persistent_cache.HasPendingEntries())
+    return {};
+
+  return m_persistent_cache.TakeValidEntriesForPage(m_jit.m_system.GetMemory(), physical_address,
+                                                    feature_flags);
+}
+
 void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
 }
@@ -403,6 +493,7 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
   LinkBlockExits(block);
   const auto it = links_to.find(block.effectiveAddress);
   if (it == links_to.end())
@@ -443,6 +534,53 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 }
 
+std::size_t JitBaseBlockCache::EvictOldestBlocks()
+{
+  if (block_map.empty())
+    return 0;
+
+  std::vector<JitBlock*> blocks;
+  blocks.reserve(block_map.size());
+  for (auto& e : block_map)
+    blocks.push_back(&e.second);
+
+  const std::size_t count = std::max<std::size_t>(blocks.size() / EVICTION_DIVISOR, 1);
+  std::nth_element(blocks.begin(), blocks.begin() + (count - 1), blocks.end(),
+                   [](const JitBlock* a, const JitBlock* b) {
+                     return a->sequence_number < b->sequence_number;
+                   });
+
+  // The oldest blocks were usually compiled next to each other, so evicting them tends to free
+  // contiguous chunks of code space.
+  {
+    const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+    for (std::size_t i = 0; i < count; i++)
+      EraseBlock(*blocks[i]);
+  }
+
+  m_eviction_stats.partial_evictions++;
+  m_eviction_stats.evicted_blocks += count;
+  INFO_LOG_FMT(DYNA_REC, "Evicted {} of {} JIT blocks", count, blocks.size());
+  return count;
+}
+
+void JitBaseBlockCache::EraseBlock(JitBlock& block)
+{
+  const u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  for (u32 addr : block.physical_addresses)
+  {
+    auto it = block_range_map.find(addr & range_mask);
+    if (it == block_range_map.end())
+      continue;
+    it->second.erase(&block);
+    if (it->second.empty())
+      block_range_map.erase(it);
+  }
+
+  DestroyBlock(block);
+  DiscardBlock(block);
+}
+
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 {
   if (m_entry_points_ptr)
@@ -460,6 +598,9 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
     }
   }
 
+  // Unlinking writes to every exit of this block and of the blocks linking to it, so make the JIT
+  // pages writable once for all of them instead of once per write.
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
   UnlinkBlock(block);
 
   // Delete linking addresses
@@ -524,6 +665,7 @@ size_t JitBaseBlockCache::FastLookupIndexForAddress(u32 address, u32 feature_fla
   }
   else
   {
-    return (address >> 2) & FAST_BLOCK_MAP_FALLBACK_MASK;
+    return ((address >> 2) ^ (feature_flags << FAST_BLOCK_MAP_FALLBACK_FEATURE_FLAGS_SHIFT)) &
+           FAST_BLOCK_MAP_FALLBACK_MASK;
   }
 }
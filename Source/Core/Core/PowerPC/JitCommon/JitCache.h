@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -19,6 +20,7 @@
 #include "Common/CommonTypes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitPersistentCache.h"
 
 class JitBase;
 
@@ -105,6 +107,10 @@ struct JitBlock : public JitBlockData
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
+  // Increases with every finalized block. Used to find the oldest blocks when the code space is
+  // full.
+  u64 sequence_number = 0;
+
   std::unique_ptr<ProfileData> profile_data;
 };
 
@@ -138,6 +144,34 @@ public:
   void Clear(u32 bit) { m_valid_block[bit / 32] &= ~(1u << (bit % 32)); }
   void ClearAll() { memset(m_valid_block.get(), 0, sizeof(u32) * VALID_BLOCK_ALLOC_ELEMENTS); }
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
+
+  // Returns whether any bit in the inclusive range [first, last] is set.
+  bool TestRange(u32 first, u32 last) const
+  {
+    const u32 first_word = first / 32;
+    const u32 last_word = last / 32;
+    const u32 first_mask = ~0u << (first % 32);
+    const u32 last_mask = ~0u >> (31 - last % 32);
+    if (first_word == last_word)
+      return (m_valid_block[first_word] & first_mask & last_mask) != 0;
+    if ((m_valid_block[first_word] & first_mask) != 0)
+      return true;
+    for (u32 i = first_word + 1; i < last_word; ++i)
+    {
+      if (m_valid_block[i] != 0)
+        return true;
+    }
+    return (m_valid_block[last_word] & last_mask) != 0;
+  }
+};
+
+struct JitBlockEvictionStats
+{
+  // Number of times the oldest blocks were evicted to make room for new code.
+  u64 partial_evictions = 0;
+  u64 evicted_blocks = 0;
+  // Number of times the whole cache had to be cleared because it was full.
+  u64 full_clears = 0;
 };
 
 class JitBaseBlockCache
@@ -148,6 +182,14 @@ public:
   static constexpr u64 FAST_BLOCK_MAP_SIZE = 0x10'0000'0000;
   static constexpr u32 FAST_BLOCK_MAP_FALLBACK_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_FALLBACK_MASK = FAST_BLOCK_MAP_FALLBACK_ELEMENTS - 1;
+  // The feature flags are folded into the top bits of the fallback index, so that blocks for the
+  // same address in different MSR modes don't keep evicting each other.
+  static constexpr u32 FAST_BLOCK_MAP_FALLBACK_FEATURE_FLAGS_SHIFT = 13;
+  static_assert(((FEATURE_FLAG_MSR_DR | FEATURE_FLAG_MSR_IR | FEATURE_FLAG_PERFMON)
+                 << FAST_BLOCK_MAP_FALLBACK_FEATURE_FLAGS_SHIFT) <= FAST_BLOCK_MAP_FALLBACK_MASK);
+
+  // Partial evictions throw away this fraction (1 / n) of the blocks at a time.
+  static constexpr std::size_t EVICTION_DIVISOR = 4;
 
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
@@ -164,6 +206,8 @@ public:
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  // Removes a block that has been allocated but failed to compile.
+  void DiscardBlock(JitBlock& block);
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -180,8 +224,22 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
 
+  // Invalidates the oldest 1 / EVICTION_DIVISOR of the blocks, so that the JIT can reuse their
+  // code space without having to recompile everything. Returns the number of evicted blocks.
+  std::size_t EvictOldestBlocks();
+  void RecordFullClear() { m_eviction_stats.full_clears++; }
+  const JitBlockEvictionStats& GetEvictionStats() const { return m_eviction_stats; }
+
   u32* GetBlockBitSet() const;
 
+  // Persistent block cache
+  // Loads the persistent cache for the given game ID, writing back the previously loaded one
+  // first. Does nothing if the cache for this game ID is already loaded.
+  void SyncPersistentCache(const std::string& game_id, u64 config_key);
+  void SavePersistentCache();
+  std::vector<JitPersistentCache::Entry> TakePersistentBlocks(u32 physical_address,
+                                                              CPUEmuFeatureFlags feature_flags);
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -195,6 +253,7 @@ private:
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
+  void EraseBlock(JitBlock& block);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
@@ -229,4 +288,12 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  u64 m_next_sequence_number = 0;
+  JitBlockEvictionStats m_eviction_stats;
+
+  // Blocks compiled in this or a previous session of the running title.
+  JitPersistentCache m_persistent_cache;
+  bool m_persistent_cache_enabled = false;
+  u64 m_persistent_cache_key = 0;
 };
@@ -0,0 +1,227 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitPersistentCache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+// On disk format:
+// header{
+// u32 'DJBC';
+// u32 version;
+// u64 config_key;
+// u32 entry_count;
+//}
+//
+// entry{
+// u32 effective_address;
+// u32 physical_address;
+// u32 original_size;
+// u32 feature_flags;
+// u64 guest_hash;
+// u32 physical_address_count;
+// u32 exit_address_count;
+// u32 physical_addresses[physical_address_count];
+// u32 exit_addresses[exit_address_count];
+//}
+
+namespace
+{
+constexpr u32 CACHE_FILE_MAGIC = 0x434A4244;  // "DJBC"
+constexpr u32 CACHE_FILE_VERSION = 2;
+
+// Guards against reading garbage from a truncated or corrupted file.
+constexpr u32 MAX_ADDRESSES_PER_ENTRY = 0x10000;
+
+#pragma pack(push, 1)
+struct FileHeader
+{
+  u32 magic;
+  u32 version;
+  u64 config_key;
+  u32 entry_count;
+};
+
+struct FileEntry
+{
+  u32 effective_address;
+  u32 physical_address;
+  u32 original_size;
+  u32 feature_flags;
+  u64 guest_hash;
+  u32 physical_address_count;
+  u32 exit_address_count;
+};
+#pragma pack(pop)
+}  // namespace
+
+std::string JitPersistentCache::GetCachePath(const std::string& game_id)
+{
+  return fmt::format("{}JIT/{}.jbc", File::GetUserPath(D_CACHE_IDX), game_id);
+}
+
+u64 JitPersistentCache::HashGuestCode(const Memory::MemoryManager& memory,
+                                      const std::vector<u32>& physical_addresses)
+{
+  std::vector<u32> code;
+  code.reserve(physical_addresses.size());
+  for (u32 address : physical_addresses)
+    code.push_back(memory.Read_U32(address));
+
+  return Common::GetHash64(reinterpret_cast<const u8*>(code.data()),
+                           static_cast<u32>(code.size() * sizeof(u32)), 0);
+}
+
+bool JitPersistentCache::Load(const std::string& path, u64 config_key)
+{
+  Clear();
+  m_loaded_path = path;
+
+  File::IOFile file(path, "rb");
+  if (!file)
+    return false;
+
+  FileHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != CACHE_FILE_MAGIC ||
+      header.version != CACHE_FILE_VERSION || header.config_key != config_key)
+  {
+    INFO_LOG_FMT(DYNA_REC, "Ignoring outdated JIT block cache {}", path);
+    return false;
+  }
+
+  for (u32 i = 0; i < header.entry_count; ++i)
+  {
+    FileEntry file_entry;
+    if (!file.ReadArray(&file_entry, 1) ||
+        file_entry.physical_address_count > MAX_ADDRESSES_PER_ENTRY ||
+        file_entry.exit_address_count > MAX_ADDRESSES_PER_ENTRY)
+    {
+      WARN_LOG_FMT(DYNA_REC, "JIT block cache {} is corrupted", path);
+      Clear();
+      return false;
+    }
+
+    Entry entry;
+    entry.effective_address = file_entry.effective_address;
+    entry.physical_address = file_entry.physical_address;
+    entry.original_size = file_entry.original_size;
+    entry.feature_flags = file_entry.feature_flags;
+    entry.guest_hash = file_entry.guest_hash;
+    entry.physical_addresses.resize(file_entry.physical_address_count);
+    entry.exit_addresses.resize(file_entry.exit_address_count);
+    if (!file.ReadArray(entry.physical_addresses.data(), entry.physical_addresses.size()) ||
+        !file.ReadArray(entry.exit_addresses.data(), entry.exit_addresses.size()))
+    {
+      WARN_LOG_FMT(DYNA_REC, "JIT block cache {} is corrupted", path);
+      Clear();
+      return false;
+    }
+
+    m_recorded.emplace(MakeKey(entry.effective_address, entry.feature_flags), entry);
+    m_pending[entry.physical_address >> PAGE_SHIFT].push_back(std::move(entry));
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} blocks from JIT block cache {}", header.entry_count, path);
+  return true;
+}
+
+bool JitPersistentCache::Save(const std::string& path, u64 config_key) const
+{
+  if (!File::CreateFullPath(path))
+    return false;
+
+  File::IOFile file(path, "wb");
+  if (!file)
+    return false;
+
+  const FileHeader header{CACHE_FILE_MAGIC, CACHE_FILE_VERSION, config_key,
+                          static_cast<u32>(m_recorded.size())};
+  bool success = file.WriteArray(&header, 1);
+
+  for (const auto& [key, entry] : m_recorded)
+  {
+    const FileEntry file_entry{entry.effective_address,
+                               entry.physical_address,
+                               entry.original_size,
+                               entry.feature_flags,
+                               entry.guest_hash,
+                               static_cast<u32>(entry.physical_addresses.size()),
+                               static_cast<u32>(entry.exit_addresses.size())};
+    success &= file.WriteArray(&file_entry, 1);
+    success &= file.WriteArray(entry.physical_addresses.data(), entry.physical_addresses.size());
+    success &= file.WriteArray(entry.exit_addresses.data(), entry.exit_addresses.size());
+  }
+
+  if (!success)
+    ERROR_LOG_FMT(DYNA_REC, "Failed to write JIT block cache {}", path);
+  return success;
+}
+
+void JitPersistentCache::Clear()
+{
+  m_loaded_path.clear();
+  m_pending.clear();
+  m_recorded.clear();
+}
+
+void JitPersistentCache::Record(const Memory::MemoryManager& memory, const JitBlock& block)
+{
+  Entry entry;
+  entry.effective_address = block.effectiveAddress;
+  entry.physical_address = block.physicalAddress;
+  entry.original_size = block.originalSize;
+  entry.feature_flags = block.feature_flags;
+  entry.physical_addresses.assign(block.physical_addresses.begin(),
+                                  block.physical_addresses.end());
+  entry.exit_addresses.reserve(block.linkData.size());
+  for (const JitBlock::LinkData& link : block.linkData)
+    entry.exit_addresses.push_back(link.exitAddress);
+  entry.guest_hash = HashGuestCode(memory, entry.physical_addresses);
+
+  m_recorded.insert_or_assign(MakeKey(entry.effective_address, entry.feature_flags),
+                              std::move(entry));
+}
+
+std::vector<JitPersistentCache::Entry>
+JitPersistentCache::TakeValidEntriesForPage(const Memory::MemoryManager& memory,
+                                            u32 physical_address, u32 feature_flags)
+{
+  const auto it = m_pending.find(physical_address >> PAGE_SHIFT);
+  if (it == m_pending.end())
+    return {};
+
+  std::vector<Entry> entries;
+  std::erase_if(it->second, [&](Entry& entry) {
+    if (entry.feature_flags != feature_flags)
+      return false;
+
+    if (HashGuestCode(memory, entry.physical_addresses) == entry.guest_hash)
+    {
+      entries.push_back(std::move(entry));
+    }
+    else
+    {
+      // The guest code has changed since the block was recorded. Forget about it; if the new
+      // code gets compiled it will be recorded again.
+      m_recorded.erase(MakeKey(entry.effective_address, entry.feature_flags));
+    }
+    return true;
+  });
+
+  if (it->second.empty())
+    m_pending.erase(it);
+
+  return entries;
+}
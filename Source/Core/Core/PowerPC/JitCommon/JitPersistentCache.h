@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Memory
+{
+class MemoryManager;
+}
+struct JitBlock;
+
+// Remembers which blocks were compiled while running a title, so that the next session of the
+// same title can translate them as soon as the guest code they cover is first executed, instead
+// of stalling once for every block that is reached for the first time.
+//
+// Emitted host code is not stored: it embeds absolute pointers to the PowerPC state, the memory
+// base and the common asm routines, none of which are stable across sessions. Instead the block
+// metadata is stored along with a hash of the guest instructions, and blocks whose guest code has
+// changed since they were recorded are discarded instead of being translated.
+class JitPersistentCache
+{
+public:
+  static constexpr u32 PAGE_SHIFT = 12;
+
+  struct Entry
+  {
+    u32 effective_address = 0;
+    u32 physical_address = 0;
+    u32 original_size = 0;
+    u32 feature_flags = 0;
+    u64 guest_hash = 0;
+    std::vector<u32> physical_addresses;
+    std::vector<u32> exit_addresses;
+  };
+
+  // Returns the file the cache for the given game ID is stored in.
+  static std::string GetCachePath(const std::string& game_id);
+
+  static u64 HashGuestCode(const Memory::MemoryManager& memory,
+                           const std::vector<u32>& physical_addresses);
+
+  // Loads previously recorded blocks. Blocks recorded with a different key are ignored.
+  bool Load(const std::string& path, u64 config_key);
+  bool Save(const std::string& path, u64 config_key) const;
+  void Clear();
+
+  void Record(const Memory::MemoryManager& memory, const JitBlock& block);
+
+  // Removes and returns all loaded entries with the given feature flags that start in the given
+  // physical page and whose guest code still matches the recorded hash.
+  std::vector<Entry> TakeValidEntriesForPage(const Memory::MemoryManager& memory,
+                                             u32 physical_address, u32 feature_flags);
+
+  bool HasPendingEntries() const { return !m_pending.empty(); }
+  const std::string& GetLoadedPath() const { return m_loaded_path; }
+
+private:
+  static u64 MakeKey(u32 effective_address, u32 feature_flags)
+  {
+    return (static_cast<u64>(feature_flags) << 32) | effective_address;
+  }
+
+  std::string m_loaded_path;
+
+  // Entries which were loaded from disk but have not been translated yet, by physical page.
+  std::map<u32, std::vector<Entry>> m_pending;
+
+  // Everything that was compiled (or loaded) this session, which is what gets written back.
+  std::unordered_map<u64, Entry> m_recorded;
+};
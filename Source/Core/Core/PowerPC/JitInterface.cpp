@@ -4,23 +4,29 @@
 #include "Core/PowerPC/JitInterface.h"
 
 #include <algorithm>
+#include <map>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/JitRegister.h"
+#include "Common/JsonUtil.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/Core.h"
+#include "Core/Debugger/OSThread.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/PowerPC/SamplingProfiler.h"
 #include "Core/System.h"
 
 #ifdef _M_X86_64
@@ -182,6 +188,129 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
   }
 }
 
+void JitInterface::StartSamplingProfiler()
+{
+  if (!m_sampling_profiler)
+  {
+    m_sampling_profiler =
+        std::make_unique<PowerPC::SamplingProfiler>(m_system.GetPPCState(), m_system.GetMemory());
+  }
+
+  m_sampling_profiler->Clear();
+  m_sampling_profiler->Start();
+}
+
+void JitInterface::StopSamplingProfiler()
+{
+  if (m_sampling_profiler)
+    m_sampling_profiler->Stop();
+}
+
+bool JitInterface::IsSamplingProfilerRunning() const
+{
+  return m_sampling_profiler && m_sampling_profiler->IsRunning();
+}
+
+static std::string GetGuestThreadName(const Core::CPUThreadGuard& guard, u32 thread_address)
+{
+  if (thread_address == 0)
+    return "no thread";
+
+  if (!PowerPC::MMU::HostIsRAMAddress(guard, thread_address))
+    return fmt::format("thread {:08x}", thread_address);
+  const Core::Debug::OSThreadView thread(guard, thread_address);
+  if (!thread.IsValid(guard))
+    return fmt::format("thread {:08x}", thread_address);
+
+  // Titles commonly store a pointer to the thread's name in its first specific slot.
+  std::string name = fmt::format("thread {:08x} (priority {})", thread_address,
+                                 thread.GetBasePriority());
+  const u32 name_address = thread.Data().specific[0];
+  if (PowerPC::MMU::HostIsRAMAddress(guard, name_address))
+    name += fmt::format(" \"{}\"", PowerPC::MMU::HostGetString(guard, name_address, 64));
+  return name;
+}
+
+bool JitInterface::WriteSamplingProfile(const Core::CPUThreadGuard& guard,
+                                        const std::string& perf_map_path,
+                                        const std::string& json_path) const
+{
+  if (!m_sampling_profiler)
+    return false;
+
+  PPCSymbolDB& symbol_db = m_system.GetPPCSymbolDB();
+
+  if (m_jit)
+  {
+    std::vector<Common::JitRegister::PerfMapEntry> entries;
+    m_jit->GetBlockCache()->RunOnBlocks(guard, [&](const JitBlock& block) {
+      const Common::Symbol* const symbol = symbol_db.GetSymbolFromAddr(block.effectiveAddress);
+      entries.push_back({block.normalEntry, block.codeSize,
+                         symbol ? fmt::format("JIT_PPC_{}_{:08x}", symbol->function_name,
+                                              block.physicalAddress) :
+                                  fmt::format("JIT_PPC_{:08x}", block.physicalAddress)});
+    });
+    if (!Common::JitRegister::WritePerfMap(perf_map_path, entries))
+      return false;
+  }
+
+  // Group the sampled block addresses by the guest thread they ran on, and then by the symbol they
+  // belong to. Samples are already sorted by count, so the children of each symbol end up sorted
+  // as well.
+  struct SymbolSamples
+  {
+    u64 count = 0;
+    picojson::array children;
+  };
+  struct ThreadSamples
+  {
+    u64 count = 0;
+    std::map<std::string, SymbolSamples> symbols;
+  };
+  std::map<u32, ThreadSamples> threads;
+  for (const PowerPC::SamplingProfiler::Sample& sample : m_sampling_profiler->GetSamples())
+  {
+    ThreadSamples& thread = threads[sample.thread];
+    thread.count += sample.count;
+
+    const Common::Symbol* const symbol = symbol_db.GetSymbolFromAddr(sample.address);
+    SymbolSamples& samples = thread.symbols[symbol ? symbol->name : "unknown"];
+    samples.count += sample.count;
+
+    picojson::object block;
+    block.emplace("name", fmt::format("{:08x}", sample.address));
+    block.emplace("value", static_cast<double>(sample.count));
+    samples.children.emplace_back(std::move(block));
+  }
+
+  picojson::array children;
+  for (auto& [thread_address, thread_samples] : threads)
+  {
+    picojson::array thread_children;
+    for (auto& [name, samples] : thread_samples.symbols)
+    {
+      picojson::object symbol;
+      symbol.emplace("name", name);
+      symbol.emplace("value", static_cast<double>(samples.count));
+      symbol.emplace("children", std::move(samples.children));
+      thread_children.emplace_back(std::move(symbol));
+    }
+
+    picojson::object thread;
+    thread.emplace("name", GetGuestThreadName(guard, thread_address));
+    thread.emplace("value", static_cast<double>(thread_samples.count));
+    thread.emplace("children", std::move(thread_children));
+    children.emplace_back(std::move(thread));
+  }
+
+  picojson::object root;
+  root.emplace("name", "all");
+  root.emplace("value", static_cast<double>(m_sampling_profiler->GetTotalSamples()));
+  root.emplace("interval_us", static_cast<double>(m_sampling_profiler->GetInterval().count()));
+  root.emplace("children", std::move(children));
+  return JsonToFile(json_path, picojson::value{std::move(root)}, true);
+}
+
 std::variant<JitInterface::GetHostCodeError, JitInterface::GetHostCodeResult>
 JitInterface::GetHostCode(u32 address) const
 {
@@ -224,6 +353,14 @@ JitInterface::GetHostCode(u32 address) const
   return result;
 }
 
+JitBlockEvictionStats JitInterface::GetBlockEvictionStats() const
+{
+  if (!m_jit)
+    return {};
+
+  return m_jit->GetBlockCache()->GetEvictionStats();
+}
+
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -345,6 +482,8 @@ void JitInterface::CompileExceptionCheckFromJIT(JitInterface& jit_interface, Exc
 
 void JitInterface::Shutdown()
 {
+  StopSamplingProfiler();
+
   if (m_jit)
   {
     m_jit->Shutdown();
@@ -16,6 +16,7 @@
 class CPUCoreBase;
 class PointerWrap;
 class JitBase;
+struct JitBlockEvictionStats;
 
 namespace Core
 {
@@ -25,7 +26,8 @@ class System;
 namespace PowerPC
 {
 enum class CPUCore;
-}
+class SamplingProfiler;
+}  // namespace PowerPC
 
 class JitInterface
 {
@@ -58,6 +60,17 @@ public:
   void UpdateMembase();
   void JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
   std::variant<GetHostCodeError, GetHostCodeResult> GetHostCode(u32 address) const;
+  JitBlockEvictionStats GetBlockEvictionStats() const;
+
+  // Sampling profiler
+  void StartSamplingProfiler();
+  void StopSamplingProfiler();
+  bool IsSamplingProfilerRunning() const;
+  // Writes a perf map of the host code of all current JIT blocks, and a JSON flame graph
+  // (in the format used by d3-flame-graph) of the samples collected so far grouped by guest OS
+  // thread and then by symbol.
+  bool WriteSamplingProfile(const Core::CPUThreadGuard& guard, const std::string& perf_map_path,
+                            const std::string& json_path) const;
 
   // Memory Utilities
   bool HandleFault(uintptr_t access_address, SContext* ctx);
@@ -94,5 +107,6 @@ public:
 
 private:
   std::unique_ptr<JitBase> m_jit;
+  std::unique_ptr<PowerPC::SamplingProfiler> m_sampling_profiler;
   Core::System& m_system;
 };
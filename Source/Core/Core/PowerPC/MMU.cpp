@@ -25,16 +25,20 @@
 
 #include "Core/PowerPC/MMU.h"
 
+#include <atomic>
 #include <bit>
 #include <cstddef>
 #include <cstring>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/Swap.h"
 
 #include "Core/Core.h"
 #include "Core/HW/CPU.h"
@@ -1215,6 +1219,10 @@ u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
   if (m_power_pc.GetMemChecks().HasAny())
     return 0;
 
+  // Accesses must go through MMIO::Mapping to be counted.
+  if (m_memory.GetMMIOMapping()->IsAccessCountingEnabled())
+    return 0;
+
   if (!m_ppc_state.msr.DR)
     return 0;
 
@@ -1324,6 +1332,80 @@ void MMU::SDRUpdated()
 
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  PageTableUpdated();
+}
+
+void MMU::PageTableUpdated()
+{
+#ifndef _ARCH_32
+  if (!m_memory.IsPageTableFastmemEnabled())
+    return;
+
+  // Instead of hashing every possible effective address, walk the page table and work out which
+  // effective address each valid entry belongs to.
+  std::map<u32, std::vector<u32>> segments_for_vsid;
+  for (u32 i = 0; i < 16; ++i)
+  {
+    const auto sr = UReg_SR{m_ppc_state.sr[i]};
+    if (sr.T == 0)
+      segments_for_vsid[sr.VSID].push_back(i);
+  }
+
+  std::map<u32, u32> mappings;
+  const u32 pteg_count = m_ppc_state.pagetable_hashmask + 1;
+  const u8* page_table =
+      m_memory.GetPointerForRange(m_ppc_state.pagetable_base, pteg_count * 64);
+  if (!page_table || segments_for_vsid.empty())
+  {
+    m_memory.UpdatePageTableMappings(mappings);
+    return;
+  }
+
+  for (u32 pteg_index = 0; pteg_index < pteg_count; ++pteg_index)
+  {
+    for (u32 i = 0; i < 8; ++i)
+    {
+      const u8* pte = page_table + pteg_index * 64 + i * 8;
+      const UPTE_Lo pte1(Common::swap32(pte));
+      if (!pte1.V)
+        continue;
+
+      const auto segments = segments_for_vsid.find(pte1.VSID);
+      if (segments == segments_for_vsid.end())
+        continue;
+
+      // Accesses through fastmem can't update the R and C bits, so only pages that already have
+      // both set can be mapped.
+      const UPTE_Hi pte2(Common::swap32(pte + 4));
+      if (!pte2.R || !pte2.C)
+        continue;
+
+      // The PTEG index is the low bits of the (possibly inverted) hash, and the API holds the
+      // bits of the page index that didn't go into the hash at all.
+      const u32 hash = pte1.H ? ~pteg_index : pteg_index;
+      const u32 page_index = (pte1.API << 10) | ((hash ^ pte1.VSID) & 0x3ff);
+
+      for (u32 segment : segments->second)
+      {
+        const u32 logical_address = (segment << 28) | (page_index << HW_PAGE_INDEX_SHIFT);
+
+        // BATs take priority over the page table.
+        if (m_dbat_table[logical_address >> BAT_INDEX_SHIFT] & BAT_MAPPED_BIT)
+          continue;
+        if (m_power_pc.GetMemChecks().OverlapsMemcheck(logical_address,
+                                                       static_cast<u32>(HW_PAGE_SIZE)))
+        {
+          continue;
+        }
+
+        mappings.emplace(logical_address, pte2.RPN << HW_PAGE_INDEX_SHIFT);
+      }
+    }
+  }
+
+  m_memory.UpdatePageTableMappings(mappings);
+#endif
 }
 
 enum class TLBLookupResult
@@ -1333,40 +1415,25 @@ enum class TLBLookupResult
   UpdateC
 };
 
+static TLBEntry& GetTLBSet(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag flag, u32 tag)
+{
+  const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
+  return ppc_state.tlb[tlb_index][tag & (PowerPC::TLB_SETS - 1)];
+}
+
 static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
                                             const XCheckTLBFlag flag, const u32 vpa, const u32 vsid,
                                             u32* paddr, bool* wi)
 {
   const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
-  const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
-  TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
+  TLBEntry& tlbe = GetTLBSet(ppc_state, flag, tag);
 
-  if (tlbe.tag[0] == tag && tlbe.vsid[0] == vsid)
+  for (u32 way = 0; way < PowerPC::TLB_WAYS; ++way)
   {
-    UPTE_Hi pte2(tlbe.pte[0]);
-
-    // Check if C bit requires updating
-    if (flag == XCheckTLBFlag::Write)
-    {
-      if (pte2.C == 0)
-      {
-        pte2.C = 1;
-        tlbe.pte[0] = pte2.Hex;
-        return TLBLookupResult::UpdateC;
-      }
-    }
-
-    if (!IsNoExceptionFlag(flag))
-      tlbe.recent = 0;
-
-    *paddr = tlbe.paddr[0] | (vpa & 0xfff);
-    *wi = (pte2.WIMG & 0b1100) != 0;
+    if (tlbe.tag[way] != tag || tlbe.vsid[way] != vsid)
+      continue;
 
-    return TLBLookupResult::Found;
-  }
-  if (tlbe.tag[1] == tag && tlbe.vsid[1] == vsid)
-  {
-    UPTE_Hi pte2(tlbe.pte[1]);
+    UPTE_Hi pte2(tlbe.pte[way]);
 
     // Check if C bit requires updating
     if (flag == XCheckTLBFlag::Write)
@@ -1374,15 +1441,15 @@ static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
       if (pte2.C == 0)
       {
         pte2.C = 1;
-        tlbe.pte[1] = pte2.Hex;
+        tlbe.pte[way] = pte2.Hex;
         return TLBLookupResult::UpdateC;
       }
     }
 
     if (!IsNoExceptionFlag(flag))
-      tlbe.recent = 1;
+      tlbe.Touch(way);
 
-    *paddr = tlbe.paddr[1] | (vpa & 0xfff);
+    *paddr = tlbe.paddr[way] | (vpa & 0xfff);
     *wi = (pte2.WIMG & 0b1100) != 0;
 
     return TLBLookupResult::Found;
@@ -1397,22 +1464,43 @@ static void UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag
     return;
 
   const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
-  const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
-  TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
-  const u32 index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
-  tlbe.recent = index;
-  tlbe.paddr[index] = pte2.RPN << HW_PAGE_INDEX_SHIFT;
-  tlbe.pte[index] = pte2.Hex;
-  tlbe.tag[index] = tag;
-  tlbe.vsid[index] = vsid;
+  TLBEntry& tlbe = GetTLBSet(ppc_state, flag, tag);
+  const u32 way = tlbe.GetReplacementWay();
+  tlbe.Touch(way);
+  tlbe.paddr[way] = pte2.RPN << HW_PAGE_INDEX_SHIFT;
+  tlbe.pte[way] = pte2.Hex;
+  tlbe.tag[way] = tag;
+  tlbe.vsid[way] = vsid;
 }
 
 void MMU::InvalidateTLBEntry(u32 address)
 {
-  const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
+  const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & (PowerPC::TLB_SETS - 1);
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+
+  PageTableUpdated();
+}
+
+static void IncrementTLBCounter(std::atomic<u64>& counter)
+{
+  // Only the CPU thread writes to the counters, so there's no need for an atomic increment.
+  counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+TLBStats MMU::GetTLBStats() const
+{
+  return TLBStats{m_tlb_hits.load(std::memory_order_relaxed),
+                  m_tlb_misses.load(std::memory_order_relaxed),
+                  m_page_table_walks.load(std::memory_order_relaxed)};
+}
+
+void MMU::ResetTLBStats()
+{
+  m_tlb_hits.store(0, std::memory_order_relaxed);
+  m_tlb_misses.store(0, std::memory_order_relaxed);
+  m_page_table_walks.store(0, std::memory_order_relaxed);
 }
 
 // Page Address Translation
@@ -1430,10 +1518,15 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
       LookupTLBPageAddress(m_ppc_state, flag, address.Hex, VSID, &translated_address, wi);
   if (res == TLBLookupResult::Found)
   {
+    if (!IsNoExceptionFlag(flag))
+      IncrementTLBCounter(m_tlb_hits);
     return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
                                   translated_address};
   }
 
+  if (!IsNoExceptionFlag(flag) && res == TLBLookupResult::NotFound)
+    IncrementTLBCounter(m_tlb_misses);
+
   if (sr.T != 0)
     return TranslateAddressResult{TranslateAddressResultEnum::DIRECT_STORE_SEGMENT, 0};
 
@@ -1445,6 +1538,9 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
     return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
   }
 
+  if (!IsNoExceptionFlag(flag))
+    IncrementTLBCounter(m_page_table_walks);
+
   const u32 offset = address.offset;          // 12 bit
   const u32 page_index = address.page_index;  // 16 bit
   const u32 api = address.API;                //  6 bit (part of page_index)
@@ -1642,6 +1738,7 @@ void MMU::DBATUpdated()
 #ifndef _ARCH_32
   m_memory.UpdateLogicalMemory(m_dbat_table);
 #endif
+  PageTableUpdated();
 
   // IsOptimizable*Address and dcbz depends on the BAT mapping, so we need a flush here.
   m_system.GetJitInterface().ClearSafe();
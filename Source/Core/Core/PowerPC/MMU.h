@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -70,7 +71,16 @@ using BatTable = std::array<u32, BAT_PAGE_COUNT>;  // 128 KB
 constexpr size_t HW_PAGE_SIZE = 4096;
 constexpr size_t HW_PAGE_MASK = HW_PAGE_SIZE - 1;
 constexpr u32 HW_PAGE_INDEX_SHIFT = 12;
-constexpr u32 HW_PAGE_INDEX_MASK = 0x3f;
+
+// Counters for the software TLB in front of the page table. Only accesses made by the emulated
+// CPU are counted, not host accesses such as those made by the debugger.
+struct TLBStats
+{
+  u64 hits = 0;
+  u64 misses = 0;
+  // Includes the walks that are needed to set the C bit of a page that's in the TLB.
+  u64 page_table_walks = 0;
+};
 
 // Return value of MMU::TryReadInstruction().
 struct TryReadInstResult
@@ -241,6 +251,14 @@ public:
   void InvalidateTLBEntry(u32 address);
   void DBATUpdated();
   void IBATUpdated();
+  // Mirrors the page table into the logical fastmem region, if page table fastmem is enabled.
+  // Has to be called whenever the page table location, a segment register or a BAT changes, and
+  // on tlbie (which the guest has to execute after modifying or removing a page table entry).
+  void PageTableUpdated();
+
+  // Safe to call from any thread.
+  TLBStats GetTLBStats() const;
+  void ResetTLBStats();
 
   // Result changes based on the BAT registers and MSR.DR.  Returns whether
   // it's safe to optimize a read or write to this address to an unguarded
@@ -324,6 +342,10 @@ private:
   PowerPC::PowerPCManager& m_power_pc;
   PowerPC::PowerPCState& m_ppc_state;
 
+  std::atomic<u64> m_tlb_hits = 0;
+  std::atomic<u64> m_tlb_misses = 0;
+  std::atomic<u64> m_page_table_walks = 0;
+
   BatTable m_ibat_table;
   BatTable m_dbat_table;
 };
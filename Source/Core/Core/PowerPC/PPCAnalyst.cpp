@@ -18,6 +18,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/Debugger/BranchWatch.h"
 #include "Core/HLE/HLE.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
@@ -46,6 +47,15 @@ constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
+// The "y" bit of BO, which reverses the static branch prediction.
+constexpr u32 BO_REVERSE_PREDICTION = 1;
+
+// How often a conditional branch has to have been recorded by Branch Watch before the recorded
+// outcomes are trusted over the static prediction, and the share of those which have to be taken.
+constexpr std::size_t BRANCH_PROFILE_MIN_HITS = 16;
+constexpr std::size_t BRANCH_PROFILE_TAKEN_NUMERATOR = 7;
+constexpr std::size_t BRANCH_PROFILE_TAKEN_DENOMINATOR = 8;
+
 static u32 EvaluateBranchTarget(UGeckoInstruction instr, u32 pc)
 {
   switch (instr.OPCD)
@@ -569,6 +579,51 @@ void PPCAnalyzer::ReorderInstructions(u32 instructions, CodeOp* code) const
     ReorderInstructionsCore(instructions, code, true, ReorderType::CROR);
 }
 
+void PPCAnalyzer::FusePairedInstructions(CodeBlock* block, u32 instructions, CodeOp* code) const
+{
+  // Metrowerks likes to emit a broadcast followed by a multiplication, like so:
+  //   ps_merge00 f0, f1, f1
+  //   ps_madd    f0, f2, f0, f3
+  // which is the same as ps_madds0 f0, f2, f1, f3. The multiplication rounds its C operand the
+  // same way in both cases, so this is exact.
+  for (u32 i = 0; i + 1 < instructions; i++)
+  {
+    CodeOp& merge = code[i];
+    CodeOp& op = code[i + 1];
+    if (merge.skip || op.skip || merge.inst.OPCD != 4 || op.inst.OPCD != 4 || merge.inst.Rc)
+      continue;
+
+    const bool broadcast_ps0 = merge.inst.SUBOP10 == 528;  // ps_merge00
+    const bool broadcast_ps1 = merge.inst.SUBOP10 == 624;  // ps_merge11
+    if ((!broadcast_ps0 && !broadcast_ps1) || merge.inst.FA != merge.inst.FB)
+      continue;
+
+    // If the ps_merge raises an exception, it has to be the one reported.
+    if (merge.canCauseException || op.canCauseException)
+      continue;
+
+    // The broadcast value must only be used as the C operand, and must be overwritten right away.
+    const u32 broadcast = merge.inst.FD;
+    if (op.inst.FC != broadcast || op.inst.FA == broadcast || op.inst.FD != broadcast)
+      continue;
+
+    UGeckoInstruction fused = op.inst;
+    if (op.inst.SUBOP5 == 25)  // ps_mul
+      fused.SUBOP5 = broadcast_ps0 ? 12 : 13;  // ps_muls0, ps_muls1
+    else if (op.inst.SUBOP5 == 29 && op.inst.FB != broadcast)  // ps_madd
+      fused.SUBOP5 = broadcast_ps0 ? 14 : 15;  // ps_madds0, ps_madds1
+    else
+      continue;
+    fused.FC = merge.inst.FA;
+
+    merge.skip = true;
+    op.inst = fused;
+    op.opinfo = PPCTables::GetOpInfo(fused, op.address);
+    SetInstructionStats(block, &op, op.opinfo);
+    i++;
+  }
+}
+
 void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
                                       const GekkoOPInfo* opinfo) const
 {
@@ -618,10 +673,16 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   code->outputFPRF = (opinfo->flags & FL_SET_FPRF) != 0;
   code->canEndBlock = InstructionCanEndBlock(*code);
 
-  code->canCauseException = first_fpu_instruction ||
-                            (opinfo->flags & (FL_LOADSTORE | FL_PROGRAMEXCEPTION)) != 0 ||
-                            (m_enable_float_exceptions && (opinfo->flags & FL_FLOAT_EXCEPTION)) ||
-                            (m_enable_div_by_zero_exceptions && (opinfo->flags & FL_FLOAT_DIV));
+  // Loads and stores can only raise an exception when memory checks are on. An FP unavailable
+  // exception can only come from the block's first FPU instruction, before the block has
+  // computed an FPRF of its own, so it never needs earlier FPRF updates either.
+  code->canCauseFPRFVisibleException =
+      (m_enable_memory_exceptions && (opinfo->flags & FL_LOADSTORE)) ||
+      (opinfo->flags & FL_PROGRAMEXCEPTION) != 0 ||
+      (m_enable_float_exceptions && (opinfo->flags & FL_FLOAT_EXCEPTION)) ||
+      (m_enable_div_by_zero_exceptions && (opinfo->flags & FL_FLOAT_DIV));
+  code->canCauseException = code->canCauseFPRFVisibleException || first_fpu_instruction ||
+                            (opinfo->flags & FL_LOADSTORE) != 0;
 
   code->wantsCA = (opinfo->flags & FL_READ_CA) != 0;
   code->outputCA = (opinfo->flags & FL_SET_CA) != 0;
@@ -733,57 +794,126 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
 
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
-  // Very basic algorithm to detect busy wait loops:
-  //   * It loops to itself and does not contain any other branches.
-  //   * It does not write to memory.
+  // Basic algorithm to detect busy wait loops:
+  //   * It loops to itself. Other branches are allowed as long as they are
+  //     followed calls and returns (which keep the loop in this block) or
+  //     leave the loop.
+  //   * It does not write to memory, and only contains integer, CR and load
+  //     instructions.
   //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //     does not write to these registers. This covers GPRs, FPRs, CR fields
+  //     and the carry flag.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // Together, these guarantee that every iteration starts in the same state
+  // as the previous one, so nothing but memory written by something else
+  // (another thread after an interrupt, or hardware) can end the loop. Such
+  // loops are typically polling a flag or an MMIO register, so the JITs can
+  // skip ahead to the next scheduled event instead of running them.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  std::bitset<32> write_disallowed_fregs;
+  std::bitset<32> written_fregs;
+  std::bitset<8> write_disallowed_crs;
+  std::bitset<8> written_crs;
+  bool write_disallowed_ca = false;
+  bool written_ca = false;
+
   for (size_t i = 0; i <= instructions; ++i)
   {
-    if (code[i].opinfo->type == OpType::Branch)
+    const CodeOp& op = code[i];
+
+    if (op.opinfo->type == OpType::Branch)
     {
-      if (code[i].branchUsesCtr)
+      if (op.branchUsesCtr)
         return false;
-      if (code[i].branchTo == block->m_address && i == instructions)
+      if (op.branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (op.opinfo->type != OpType::Integer && op.opinfo->type != OpType::CR &&
+             op.opinfo->type != OpType::Load && op.opinfo->type != OpType::LoadFP)
     {
       // In the future, some subsets of other instruction types might get
       // supported. Right now, only try loops that have this very
       // restricted instruction set.
       return false;
     }
-    else
+
+    for (int reg : op.regsIn)
     {
-      for (int reg : code[i].regsIn)
-      {
-        if (reg == -1)
-          continue;
-        if (written_regs[reg])
-          continue;
+      if (!written_regs[reg])
         write_disallowed_regs[reg] = true;
-      }
-      for (int reg : code[i].regsOut)
-      {
-        if (reg == -1)
-          continue;
-        if (write_disallowed_regs[reg])
-          return false;
-        written_regs[reg] = true;
-      }
+    }
+    for (int reg : op.fregsIn)
+    {
+      if (!written_fregs[reg])
+        write_disallowed_fregs[reg] = true;
+    }
+    for (int cr : op.crIn)
+    {
+      if (!written_crs[cr])
+        write_disallowed_crs[cr] = true;
+    }
+    if (op.wantsCA && !written_ca)
+      write_disallowed_ca = true;
+
+    for (int reg : op.regsOut)
+    {
+      if (write_disallowed_regs[reg])
+        return false;
+      written_regs[reg] = true;
+    }
+    if (op.fregOut >= 0)
+    {
+      if (write_disallowed_fregs[op.fregOut])
+        return false;
+      written_fregs[op.fregOut] = true;
+    }
+    for (int cr : op.crOut)
+    {
+      if (write_disallowed_crs[cr])
+        return false;
+      written_crs[cr] = true;
+    }
+    if (op.outputCA)
+    {
+      if (write_disallowed_ca)
+        return false;
+      written_ca = true;
     }
   }
   return false;
 }
 
+bool PPCAnalyzer::IsConditionalBranchLikelyTaken(const CodeOp* code, u32 index) const
+{
+  const CodeOp& op = code[index];
+
+  // Following a branch back into code that is already part of the block would unroll a loop
+  // rather than extend the block, which only grows the code.
+  for (u32 i = 0; i <= index; ++i)
+  {
+    if (code[i].address == op.branchTo)
+      return false;
+  }
+
+  if (m_branch_watch)
+  {
+    const auto [taken, not_taken] =
+        m_branch_watch->GetConditionalBranchHits(op.address, op.branchTo, op.inst);
+    const std::size_t total = taken + not_taken;
+    if (total >= BRANCH_PROFILE_MIN_HITS)
+    {
+      return taken * BRANCH_PROFILE_TAKEN_DENOMINATOR >= total * BRANCH_PROFILE_TAKEN_NUMERATOR;
+    }
+  }
+
+  // Same as the static prediction of the 750CL: backward branches are predicted taken and
+  // forward branches not taken, unless the y bit says otherwise.
+  const bool backward = op.branchTo < op.address;
+  const bool reversed = (op.inst.BO & BO_REVERSE_PREDICTION) != 0;
+  return backward != reversed;
+}
+
 static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
 {
   // eieio
@@ -881,6 +1011,15 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
           caller = i;
         }
       }
+      else if (inst.OPCD == 16 && !inst.LK && m_enable_conditional_branch_following &&
+               HasOption(OPTION_CONDITIONAL_FOLLOW) && block_size > 1 &&
+               numFollows < BRANCH_FOLLOWING_THRESHOLD && IsConditionalBranchLikelyTaken(code, i))
+      {
+        // Conditional BCX on the hot path. The JIT emits an exit for the fallthrough path and
+        // keeps compiling at the branch target.
+        follow = true;
+        code[i].branchFollowed = true;
+      }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call)
       {
         code[i].branchTo = code[caller].address + 4;
@@ -972,7 +1111,11 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   block->m_num_instructions = num_inst;
 
   if (block->m_num_instructions > 1)
+  {
     ReorderInstructions(block->m_num_instructions, code);
+    if (HasOption(OPTION_PAIRED_FUSION) && !m_is_debugging_enabled)
+      FusePairedInstructions(block, block->m_num_instructions, code);
+  }
 
   if ((!found_exit && num_inst > 0) || block_size == 1)
   {
@@ -1005,12 +1148,16 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     const bool hle = !!HLE::TryReplaceFunction(ppc_symbol_db, op.address, ppc_mode);
     const bool breakpoint = power_pc.GetBreakPoints().IsAddressBreakPoint(op.address);
     const bool may_exit_block = hle || breakpoint || op.canEndBlock || op.canCauseException;
+    // Stores can still leave the block through a gather pipe interrupt check.
+    const bool fprf_may_exit_block = hle || breakpoint || op.canEndBlock ||
+                                     op.canCauseFPRFVisibleException ||
+                                     CanCauseGatherPipeInterruptCheck(op);
 
     const bool opWantsFPRF = op.wantsFPRF;
     const bool opWantsCA = op.wantsCA;
-    op.wantsFPRF = wantsFPRF || may_exit_block;
+    op.wantsFPRF = wantsFPRF || fprf_may_exit_block;
     op.wantsCA = wantsCA || may_exit_block;
-    wantsFPRF |= opWantsFPRF || may_exit_block;
+    wantsFPRF |= opWantsFPRF || fprf_may_exit_block;
     wantsCA |= opWantsCA || may_exit_block;
     wantsFPRF &= !op.outputFPRF || opWantsFPRF;
     wantsCA &= !op.outputCA || opWantsCA;
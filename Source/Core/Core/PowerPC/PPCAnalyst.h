@@ -21,6 +21,7 @@ struct Symbol;
 
 namespace Core
 {
+class BranchWatch;
 class CPUThreadGuard;
 }
 
@@ -49,8 +50,12 @@ struct CodeOp  // 16B
   bool outputCA = false;
   bool canEndBlock = false;
   bool canCauseException = false;
+  // Whether an exception this instruction raises could observe an FPRF computed earlier in the
+  // block. Narrower than canCauseException.
+  bool canCauseFPRFVisibleException = false;
   bool skipLRStack = false;
   bool skip = false;  // followed BL-s for example
+  bool branchFollowed = false;  // conditional branch inlined along its predicted path
   BitSet8 crInUse;
   BitSet8 crDiscardable;
   // which registers are still needed after this instruction in this block
@@ -171,6 +176,16 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Also follow conditional branches which are predicted to be taken, so that the hot path
+    // through a region is compiled as one block. The JIT must turn the fallthrough path of such
+    // branches (marked with branchFollowed) into an exit.
+    OPTION_CONDITIONAL_FOLLOW = (1 << 7),
+
+    // Fuse a paired single broadcast (ps_merge00/ps_merge11 of a register with itself) into the
+    // following ps_mul/ps_madd, turning it into ps_muls0/1 or ps_madds0/1. The ps_merge is
+    // marked as skipped.
+    OPTION_PAIRED_FUSION = (1 << 8),
   };
 
   // Option setting/getting
@@ -179,8 +194,15 @@ public:
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
+  void SetConditionalBranchFollowingEnabled(bool enabled)
+  {
+    m_enable_conditional_branch_following = enabled;
+  }
+  // Branch Watch hit counts, when available, are preferred over static branch prediction.
+  void SetBranchWatch(const Core::BranchWatch* branch_watch) { m_branch_watch = branch_watch; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  void SetMemoryExceptionsEnabled(bool enabled) { m_enable_memory_exceptions = enabled; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -195,16 +217,21 @@ private:
   void ReorderInstructionsCore(u32 instructions, CodeOp* code, bool reverse,
                                ReorderType type) const;
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
+  void FusePairedInstructions(CodeBlock* block, u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo) const;
   bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool IsConditionalBranchLikelyTaken(const CodeOp* code, u32 index) const;
 
   // Options
   u32 m_options = 0;
 
   bool m_is_debugging_enabled = false;
   bool m_enable_branch_following = false;
+  bool m_enable_conditional_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  bool m_enable_memory_exceptions = true;
+  const Core::BranchWatch* m_branch_watch = nullptr;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
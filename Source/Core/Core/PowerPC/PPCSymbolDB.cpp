@@ -42,6 +42,7 @@ Common::Symbol* PPCSymbolDB::AddFunction(const Core::CPUThreadGuard& guard, u32
     return nullptr;
 
   const auto insert = m_functions.emplace(start_addr, std::move(symbol));
+  InvalidateIndex();
   Common::Symbol* ptr = &insert.first->second;
   ptr->type = Common::Symbol::Type::Function;
   m_checksum_to_function[ptr->hash].insert(ptr);
@@ -65,6 +66,7 @@ void PPCSymbolDB::AddKnownSymbol(const Core::CPUThreadGuard& guard, u32 startAdd
   {
     // new symbol. run analyze.
     auto& new_symbol = m_functions.emplace(startAddr, name).first->second;
+    InvalidateIndex();
     new_symbol.type = type;
     new_symbol.address = startAddr;
 
@@ -89,23 +91,7 @@ void PPCSymbolDB::AddKnownSymbol(const Core::CPUThreadGuard& guard, u32 startAdd
 
 Common::Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr)
 {
-  auto it = m_functions.lower_bound(addr);
-
-  if (it != m_functions.end())
-  {
-    // If the address is exactly the start address of a symbol, we're done.
-    if (it->second.address == addr)
-      return &it->second;
-  }
-  if (it != m_functions.begin())
-  {
-    // Otherwise, check whether the address is within the bounds of a symbol.
-    --it;
-    if (addr >= it->second.address && addr < it->second.address + it->second.size)
-      return &it->second;
-  }
-
-  return nullptr;
+  return FindSymbolContaining(addr);
 }
 
 std::string_view PPCSymbolDB::GetDescription(u32 addr)
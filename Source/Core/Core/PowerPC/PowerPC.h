@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <span>
 #include <tuple>
@@ -47,26 +48,74 @@ enum class CoreMode
 };
 
 // TLB cache
-constexpr size_t TLB_SIZE = 128;
+// The real hardware has 128 entries and 2 ways, but since the TLB is only a cache of the page
+// table, a larger one is fine as long as tlbie invalidates every way that could hold the page.
+// Both values can be changed freely as long as they remain powers of two.
+constexpr size_t TLB_SIZE = 1024;
 constexpr size_t NUM_TLBS = 2;
-constexpr size_t TLB_WAYS = 2;
+constexpr size_t TLB_WAYS = 4;
+constexpr size_t TLB_SETS = TLB_SIZE / TLB_WAYS;
 constexpr size_t DATA_TLB_INDEX = 0;
 constexpr size_t INST_TLB_INDEX = 1;
 
+static_assert(std::has_single_bit(TLB_WAYS) && std::has_single_bit(TLB_SETS),
+              "TLB_WAYS and TLB_SETS must be powers of two");
+
 struct TLBEntry
 {
   using WayArray = std::array<u32, TLB_WAYS>;
 
   static constexpr u32 INVALID_TAG = 0xffffffff;
 
-  WayArray tag{INVALID_TAG, INVALID_TAG};
+  static constexpr WayArray InvalidTags()
+  {
+    WayArray tags{};
+    tags.fill(INVALID_TAG);
+    return tags;
+  }
+
+  WayArray tag = InvalidTags();
   WayArray paddr{};
   WayArray vsid{};
   WayArray pte{};
-  u32 recent = 0;
 
-  void Invalidate() { tag.fill(INVALID_TAG); }
+  // Tree pseudo-LRU state. Each bit is a node of a binary tree over the ways (node n has the
+  // children 2n+1 and 2n+2), and points towards the half that was used less recently.
+  u32 plru = 0;
+
+  void Invalidate() { tag = InvalidTags(); }
+
+  void Touch(u32 way)
+  {
+    u32 node = 0;
+    for (u32 level = std::countr_zero(TLB_WAYS); level-- > 0;)
+    {
+      const u32 half = (way >> level) & 1;
+      plru = (plru & ~(1u << node)) | ((half ^ 1) << node);
+      node = 2 * node + 1 + half;
+    }
+  }
+
+  u32 GetReplacementWay() const
+  {
+    for (u32 way = 0; way < TLB_WAYS; ++way)
+    {
+      if (tag[way] == INVALID_TAG)
+        return way;
+    }
+
+    u32 node = 0;
+    u32 way = 0;
+    for (u32 level = std::countr_zero(TLB_WAYS); level-- > 0;)
+    {
+      const u32 half = (plru >> node) & 1;
+      way = (way << 1) | half;
+      node = 2 * node + 1 + half;
+    }
+    return way;
+  }
 };
+static_assert(TLB_WAYS - 1 <= 32, "TLBEntry::plru is too small");
 
 struct PairedSingle
 {
@@ -175,7 +224,7 @@ struct PowerPCState
   u8* stored_stack_pointer = nullptr;
   u8* mem_ptr = nullptr;
 
-  std::array<std::array<TLBEntry, TLB_SIZE / TLB_WAYS>, NUM_TLBS> tlb;
+  std::array<std::array<TLBEntry, TLB_SETS>, NUM_TLBS> tlb;
 
   u32 pagetable_base = 0;
   u32 pagetable_hashmask = 0;
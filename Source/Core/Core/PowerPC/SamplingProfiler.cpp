@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/SamplingProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "Common/Swap.h"
+#include "Common/Thread.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace PowerPC
+{
+// Physical address of the pointer to the current OSThread (__OSCurrentThread).
+constexpr u32 CURRENT_THREAD_ADDRESS = 0x000000e4;
+
+SamplingProfiler::SamplingProfiler(const PowerPCState& ppc_state, Memory::MemoryManager& memory)
+    : m_ppc_state(ppc_state), m_memory(memory)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+  Stop();
+}
+
+void SamplingProfiler::Start(std::chrono::microseconds interval)
+{
+  if (m_running.TestAndSet())
+  {
+    m_interval = std::max(interval, std::chrono::microseconds{1});
+    m_stop_event.Reset();
+    m_thread = std::thread(&SamplingProfiler::ThreadFunc, this);
+  }
+}
+
+void SamplingProfiler::Stop()
+{
+  if (m_running.TestAndClear())
+  {
+    m_stop_event.Set();
+    m_thread.join();
+  }
+}
+
+void SamplingProfiler::Clear()
+{
+  std::lock_guard lk(m_samples_lock);
+  m_samples.clear();
+  m_total_samples = 0;
+}
+
+std::vector<SamplingProfiler::Sample> SamplingProfiler::GetSamples() const
+{
+  std::vector<Sample> samples;
+  {
+    std::lock_guard lk(m_samples_lock);
+    samples.reserve(m_samples.size());
+    for (const auto& [key, count] : m_samples)
+      samples.push_back({static_cast<u32>(key >> 32), static_cast<u32>(key), count});
+  }
+
+  std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) {
+    if (a.count != b.count)
+      return a.count > b.count;
+    return a.thread != b.thread ? a.thread < b.thread : a.address < b.address;
+  });
+  return samples;
+}
+
+u64 SamplingProfiler::GetTotalSamples() const
+{
+  std::lock_guard lk(m_samples_lock);
+  return m_total_samples;
+}
+
+void SamplingProfiler::ThreadFunc()
+{
+  Common::SetCurrentThreadName("PPC Sampling Profiler");
+
+  // The PC is only ever written by the CPU thread; a stale read would at worst attribute one
+  // sample to a neighbouring block.
+  u32& pc = const_cast<u32&>(m_ppc_state.pc);
+
+  while (!m_stop_event.WaitFor(m_interval))
+  {
+    const u32 address = std::atomic_ref<u32>(pc).load(std::memory_order_relaxed);
+
+    // Like the PC, the current thread pointer can change under us, which is harmless.
+    u32 thread = 0;
+    if (u8* const ram = m_memory.GetRAM())
+    {
+      u32& current_thread = *reinterpret_cast<u32*>(ram + CURRENT_THREAD_ADDRESS);
+      thread = Common::swap32(std::atomic_ref<u32>(current_thread).load(std::memory_order_relaxed));
+    }
+
+    std::lock_guard lk(m_samples_lock);
+    ++m_samples[u64{thread} << 32 | address];
+    ++m_total_samples;
+  }
+}
+}  // namespace PowerPC
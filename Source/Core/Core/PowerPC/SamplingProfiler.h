@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
+
+namespace Memory
+{
+class MemoryManager;
+}
+
+namespace PowerPC
+{
+struct PowerPCState;
+
+// Periodically samples the guest PC from a separate thread. Unlike the per-block profiling in
+// the JITs, this needs no instrumentation in the generated code, so it can be left running on
+// release builds without skewing the results.
+//
+// The JITs write the PC before leaving a block, so a sample is attributed to the block that
+// was executing (or about to be executed) when the sample was taken.
+//
+// Each sample also records the guest OS thread that was current, read from the OS globals in
+// low MEM1, so that time can be attributed to e.g. the render or audio thread of a title.
+class SamplingProfiler
+{
+public:
+  struct Sample
+  {
+    // Address of the current OSThread, or 0 if there isn't one (e.g. before the OS is set up).
+    u32 thread;
+    u32 address;
+    u64 count;
+  };
+
+  static constexpr std::chrono::microseconds DEFAULT_INTERVAL{1000};
+
+  SamplingProfiler(const PowerPCState& ppc_state, Memory::MemoryManager& memory);
+  SamplingProfiler(const SamplingProfiler&) = delete;
+  SamplingProfiler(SamplingProfiler&&) = delete;
+  SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+  SamplingProfiler& operator=(SamplingProfiler&&) = delete;
+  ~SamplingProfiler();
+
+  void Start(std::chrono::microseconds interval = DEFAULT_INTERVAL);
+  void Stop();
+  bool IsRunning() const { return m_running.IsSet(); }
+
+  void Clear();
+
+  // Returns the sampled threads and addresses, most frequently sampled first.
+  std::vector<Sample> GetSamples() const;
+  u64 GetTotalSamples() const;
+  std::chrono::microseconds GetInterval() const { return m_interval; }
+
+private:
+  void ThreadFunc();
+
+  const PowerPCState& m_ppc_state;
+  Memory::MemoryManager& m_memory;
+
+  std::thread m_thread;
+  Common::Flag m_running;
+  Common::Event m_stop_event;
+  std::chrono::microseconds m_interval = DEFAULT_INTERVAL;
+
+  mutable std::mutex m_samples_lock;
+  // Keyed by the thread in the upper and the address in the lower 32 bits.
+  std::unordered_map<u64, u64> m_samples;
+  u64 m_total_samples = 0;
+};
+}  // namespace PowerPC
@@ -3,10 +3,12 @@
 
 #include "Core/PowerPC/SignatureDB/MEGASignatureDB.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <fstream>
 #include <limits>
+#include <span>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -101,18 +103,15 @@ bool GetRefs(MEGASignature* sig, std::istringstream* iss)
   return true;
 }
 
-bool Compare(const Core::CPUThreadGuard& guard, u32 address, u32 size, const MEGASignature& sig)
+bool Compare(const std::vector<u32>& code, const MEGASignature& sig)
 {
-  if (size != sig.code.size() * sizeof(u32))
+  if (code.size() != sig.code.size())
     return false;
 
   for (size_t i = 0; i < sig.code.size(); ++i)
   {
-    if (sig.code[i] != 0 && PowerPC::MMU::HostRead_U32(
-                                guard, static_cast<u32>(address + i * sizeof(u32))) != sig.code[i])
-    {
+    if (sig.code[i] != 0 && code[i] != sig.code[i])
       return false;
-    }
   }
   return true;
 }
@@ -124,6 +123,14 @@ MEGASignatureDB::~MEGASignatureDB() = default;
 void MEGASignatureDB::Clear()
 {
   m_signatures.clear();
+  m_index.clear();
+}
+
+void MEGASignatureDB::AddToIndex(size_t signature_index)
+{
+  const std::vector<u32>& code = m_signatures[signature_index].code;
+  const u32 size = static_cast<u32>(code.size() * sizeof(u32));
+  m_index[{size, code.empty() ? 0 : code[0]}].push_back(signature_index);
 }
 
 bool MEGASignatureDB::Load(const std::string& file_path)
@@ -143,6 +150,7 @@ bool MEGASignatureDB::Load(const std::string& file_path)
     if (GetCode(&sig, &iss) && GetName(&sig, &iss) && GetRefs(&sig, &iss))
     {
       m_signatures.push_back(std::move(sig));
+      AddToIndex(m_signatures.size() - 1);
     }
     else
     {
@@ -160,12 +168,49 @@ bool MEGASignatureDB::Save(const std::string& file_path) const
 
 void MEGASignatureDB::Apply(const Core::CPUThreadGuard& guard, PPCSymbolDB* symbol_db) const
 {
+  const auto find_candidates = [this](u32 size, u32 first_instruction) {
+    const auto iter = m_index.find({size, first_instruction});
+    return iter != m_index.end() ? std::span<const size_t>(iter->second) :
+                                   std::span<const size_t>();
+  };
+
+  std::vector<u32> code;
   for (auto& it : symbol_db->AccessSymbols())
   {
     auto& symbol = it.second;
-    for (const auto& sig : m_signatures)
+    if (symbol.size == 0 || symbol.size % sizeof(u32) != 0)
+      continue;
+
+    const u32 first_instruction = PowerPC::MMU::HostRead_U32(guard, symbol.address);
+    const std::span<const size_t> exact =
+        first_instruction != 0 ? find_candidates(symbol.size, first_instruction) :
+                                 std::span<const size_t>();
+    const std::span<const size_t> wildcard = find_candidates(symbol.size, 0);
+    if (exact.empty() && wildcard.empty())
+      continue;
+
+    code.resize(symbol.size / sizeof(u32));
+    for (size_t i = 0; i < code.size(); ++i)
+      code[i] = PowerPC::MMU::HostRead_U32(guard, static_cast<u32>(symbol.address + i * 4));
+
+    // Both lists are in load order, and the first signature in the file that matches wins.
+    auto exact_iter = exact.begin();
+    auto wildcard_iter = wildcard.begin();
+    while (exact_iter != exact.end() || wildcard_iter != wildcard.end())
     {
-      if (Compare(guard, symbol.address, symbol.size, sig))
+      size_t index;
+      if (wildcard_iter == wildcard.end() ||
+          (exact_iter != exact.end() && *exact_iter < *wildcard_iter))
+      {
+        index = *exact_iter++;
+      }
+      else
+      {
+        index = *wildcard_iter++;
+      }
+
+      const MEGASignature& sig = m_signatures[index];
+      if (Compare(code, sig))
       {
         symbol.name = sig.name;
         INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig.name, symbol.address,
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -58,5 +61,11 @@ public:
            const std::string& name) override;
 
 private:
+  void AddToIndex(size_t signature_index);
+
   std::vector<MEGASignature> m_signatures;
+  // Indices into m_signatures, in load order, by code size in bytes and first instruction (0 when
+  // it's a wildcard). A function only has to be compared against the signatures that share its
+  // size and either its first instruction or a wildcard there.
+  std::map<std::pair<u32, u32>, std::vector<size_t>> m_index;
 };
@@ -0,0 +1,133 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <lz4.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+
+namespace State
+{
+// Stores the XOR of a and b into out, treating the shorter one as if it was padded with zeroes.
+static void XorStates(const std::vector<u8>& a, const std::vector<u8>& b, std::vector<u8>* out)
+{
+  const std::vector<u8>& shorter = a.size() < b.size() ? a : b;
+  const std::vector<u8>& longer = a.size() < b.size() ? b : a;
+
+  out->resize(longer.size());
+  std::transform(shorter.begin(), shorter.end(), longer.begin(), out->begin(),
+                 [](u8 x, u8 y) { return u8(x ^ y); });
+  std::copy(longer.begin() + shorter.size(), longer.end(), out->begin() + shorter.size());
+}
+
+std::vector<u8> RewindBuffer::Push(std::vector<u8> state)
+{
+  if (!m_has_newest)
+  {
+    m_newest = std::move(state);
+    m_has_newest = true;
+    return {};
+  }
+
+  XorStates(m_newest, state, &m_scratch);
+
+  if (m_scratch.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+  {
+    ERROR_LOG_FMT(CORE, "Rewind: State is too big to compress ({} bytes)", m_scratch.size());
+    Clear();
+    m_newest = std::move(state);
+    m_has_newest = true;
+    return {};
+  }
+
+  const int uncompressed_size = static_cast<int>(m_scratch.size());
+  Delta delta{m_newest.size(), m_scratch.size(), {}};
+  delta.compressed.resize(LZ4_compressBound(uncompressed_size));
+  const int compressed_size =
+      LZ4_compress_default(reinterpret_cast<const char*>(m_scratch.data()),
+                           reinterpret_cast<char*>(delta.compressed.data()), uncompressed_size,
+                           static_cast<int>(delta.compressed.size()));
+  if (compressed_size <= 0)
+  {
+    // Without this delta, none of the older states can be reconstructed.
+    ERROR_LOG_FMT(CORE, "Rewind: Failed to compress state");
+    m_deltas.clear();
+    m_deltas_size = 0;
+  }
+  else
+  {
+    delta.compressed.resize(compressed_size);
+    delta.compressed.shrink_to_fit();
+    m_deltas_size += delta.compressed.size();
+    m_deltas.push_back(std::move(delta));
+  }
+
+  std::swap(m_newest, state);
+  Trim();
+  return state;
+}
+
+bool RewindBuffer::Pop(std::vector<u8>* state)
+{
+  if (!m_has_newest)
+    return false;
+
+  *state = std::move(m_newest);
+  m_newest.clear();
+  m_has_newest = false;
+
+  if (m_deltas.empty())
+    return true;
+
+  Delta delta = std::move(m_deltas.back());
+  m_deltas.pop_back();
+  m_deltas_size -= delta.compressed.size();
+
+  m_scratch.resize(delta.uncompressed_size);
+  const int decompressed_size = LZ4_decompress_safe(
+      reinterpret_cast<const char*>(delta.compressed.data()),
+      reinterpret_cast<char*>(m_scratch.data()), static_cast<int>(delta.compressed.size()),
+      static_cast<int>(m_scratch.size()));
+  if (decompressed_size != static_cast<int>(delta.uncompressed_size))
+  {
+    ERROR_LOG_FMT(CORE, "Rewind: Failed to decompress state");
+    Clear();
+    return true;
+  }
+
+  XorStates(*state, m_scratch, &m_newest);
+  m_newest.resize(delta.state_size);
+  m_has_newest = true;
+  return true;
+}
+
+void RewindBuffer::Clear()
+{
+  m_deltas.clear();
+  m_deltas_size = 0;
+  m_newest.clear();
+  m_has_newest = false;
+}
+
+void RewindBuffer::SetMaxSize(size_t max_size)
+{
+  m_max_size = max_size;
+  Trim();
+}
+
+void RewindBuffer::Trim()
+{
+  while (!m_deltas.empty() && GetMemoryUsage() > m_max_size)
+  {
+    m_deltas_size -= m_deltas.front().compressed.size();
+    m_deltas.pop_front();
+  }
+}
+}  // namespace State
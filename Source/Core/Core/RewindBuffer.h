@@ -0,0 +1,56 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// Keeps a history of savestates in memory within a fixed budget. Only the newest state is stored
+// in full. Each older state is stored as the LZ4 compressed XOR of itself and the state after it,
+// which is mostly zeroes since most of the emulated memory doesn't change between snapshots.
+class RewindBuffer
+{
+public:
+  explicit RewindBuffer(size_t max_size) : m_max_size(max_size) {}
+
+  // Returns the storage of the previous newest state, which can be reused for the next state.
+  std::vector<u8> Push(std::vector<u8> state);
+  // Removes the newest state and returns it in *state. Returns false if there are no states.
+  bool Pop(std::vector<u8>* state);
+  void Clear();
+
+  // When the buffer is over budget, the oldest states are dropped. The newest state is always kept.
+  void SetMaxSize(size_t max_size);
+
+  size_t GetStateCount() const { return m_deltas.size() + (m_has_newest ? 1 : 0); }
+  size_t GetMemoryUsage() const { return m_newest.size() + m_deltas_size; }
+
+private:
+  struct Delta
+  {
+    // The size of the state that this delta reconstructs.
+    size_t state_size;
+    // The size of the XOR before compression.
+    size_t uncompressed_size;
+    std::vector<u8> compressed;
+  };
+
+  void Trim();
+
+  // Sorted from oldest to newest
+  std::deque<Delta> m_deltas;
+  size_t m_deltas_size = 0;
+
+  std::vector<u8> m_newest;
+  bool m_has_newest = false;
+
+  std::vector<u8> m_scratch;
+  size_t m_max_size;
+};
+}  // namespace State
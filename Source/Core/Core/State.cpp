@@ -7,6 +7,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <memory>
@@ -21,8 +22,10 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
+#include "Common/Config/Config.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
@@ -36,6 +39,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -47,6 +51,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -89,6 +94,12 @@ static std::mutex s_save_thread_mutex;
 // Queue for compressing and writing savestates to disk.
 static Common::WorkQueueThread<CompressAndDumpState_args> s_save_thread;
 
+// The buffer of the last state that was written to disk. Saving the next state into it means the
+// emulation doesn't have to wait for a new buffer to be allocated and paged in by the OS, which
+// is a large part of the pause for a state of over 100 MiB.
+static std::mutex s_spare_save_buffer_mutex;
+static std::vector<u8> s_spare_save_buffer;
+
 // Keeps track of savestate writes that are currently happening, so we don't load a state while
 // another one is still saving. This is particularly important so if you save to a slot and then
 // immediately load from the same one, you don't accidentally load the state that's still at that
@@ -97,8 +108,26 @@ static std::mutex s_state_writes_in_queue_mutex;
 static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
+struct RewindSnapshot
+{
+  std::vector<u8> buffer;
+  size_t max_history_size;
+};
+
+// Protects s_rewind_buffer and s_rewind_spare_buffer.
+static std::mutex s_rewind_mutex;
+static RewindBuffer s_rewind_buffer{0};
+// Storage of a state that's no longer needed. Reusing it saves the allocation, and makes
+// SaveToBuffer only need one pass if the size of the state hasn't grown.
+static std::vector<u8> s_rewind_spare_buffer;
+
+// Compresses rewind snapshots, so that the CPU thread only has to wait for the state to be saved.
+static Common::WorkQueueThread<RewindSnapshot> s_rewind_thread;
+static std::atomic<size_t> s_rewind_snapshots_in_queue = 0;
+static std::atomic<u32> s_frames_until_rewind_snapshot = 0;
+
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 168;  // Last changed in PR 12639
+constexpr u32 STATE_VERSION = 169;  // Last changed for the set-associative TLB
 
 // Increase this if the StateExtendedHeader definition changes
 constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
@@ -106,6 +135,9 @@ constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
 // Change this if we ever need to store more data in the extended header
 constexpr u32 COMPRESSED_DATA_OFFSET = 0;
 
+// The amount of state data in each independently compressed chunk
+constexpr u32 STATE_CHUNK_SIZE = 4 * 1024 * 1024;
+
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
 // Maps savestate versions to Dolphin versions.
@@ -204,6 +236,18 @@ static void DoState(Core::System& system, PointerWrap& p)
 #endif  // USE_RETRO_ACHIEVEMENTS
 }
 
+static void DoLoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        u8* ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+        DoState(system, p);
+      },
+      true);
+}
+
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
 {
   if (NetPlay::IsNetPlayRunning())
@@ -218,33 +262,80 @@ void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
     return;
   }
 
+  DoLoadFromBuffer(system, buffer);
+}
+
+void LoadFromBufferForRollback(Core::System& system, std::vector<u8>& buffer)
+{
+  DoLoadFromBuffer(system, buffer);
+}
+
+void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
   Core::RunOnCPUThread(
       system,
       [&] {
-        u8* ptr = buffer.data();
-        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+        PointerWrap p(&buffer);
         DoState(system, p);
+        buffer.resize(p.GetPosition());
       },
       true);
 }
 
-void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+void UpdateRewind(Core::System& system)
 {
-  Core::RunOnCPUThread(
-      system,
-      [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  if (!Config::Get(Config::MAIN_REWIND_ENABLE) || NetPlay::IsNetPlayRunning() ||
+      AchievementManager::GetInstance().IsHardcoreModeActive())
+  {
+    return;
+  }
 
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
+  if (s_frames_until_rewind_snapshot > 0)
+  {
+    --s_frames_until_rewind_snapshot;
+    return;
+  }
 
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
-      },
-      true);
+  // If compression can't keep up, take the snapshot on a later frame instead of queuing up
+  // uncompressed states.
+  if (s_rewind_snapshots_in_queue != 0)
+    return;
+
+  s_frames_until_rewind_snapshot = std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1u) - 1;
+
+  RewindSnapshot snapshot;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    snapshot.buffer = std::move(s_rewind_spare_buffer);
+    s_rewind_spare_buffer.clear();
+  }
+  SaveToBuffer(system, snapshot.buffer);
+  snapshot.max_history_size = size_t(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE)) * 1024 * 1024;
+
+  ++s_rewind_snapshots_in_queue;
+  s_rewind_thread.Push(std::move(snapshot));
+}
+
+bool Rewind(Core::System& system)
+{
+  s_rewind_thread.WaitForCompletion();
+
+  std::vector<u8> buffer;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    if (!s_rewind_buffer.Pop(&buffer))
+    {
+      OSD::AddMessage("There is nothing to rewind to");
+      return false;
+    }
+  }
+
+  LoadFromBuffer(system, buffer);
+  s_frames_until_rewind_snapshot = std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1u) - 1;
+
+  std::lock_guard lk(s_rewind_mutex);
+  s_rewind_spare_buffer = std::move(buffer);
+  return true;
 }
 
 namespace
@@ -318,51 +409,110 @@ static bool CompareTimestamp(const SlotWithTimestamp& lhs, const SlotWithTimesta
   return lhs.timestamp < rhs.timestamp;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// Calls function(i) for every i in [0, count) on all cores. Returns false if any call did.
+template <typename Function>
+static bool RunInParallel(size_t count, const Function& function)
 {
-  u64 total_bytes_compressed = 0;
-
-  while (true)
-  {
-    u64 bytes_left_to_compress = size - total_bytes_compressed;
+  const size_t threads =
+      std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), count);
 
-    int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    int compressed_buffer_size = LZ4_compressBound(bytes_to_compress);
-    auto compressed_buffer = std::make_unique<char[]>(compressed_buffer_size);
-    s32 compressed_len =
-        LZ4_compress_default(reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed,
-                             compressed_buffer.get(), bytes_to_compress, compressed_buffer_size);
-
-    if (compressed_len == 0)
+  std::atomic<size_t> next = 0;
+  std::atomic<bool> success = true;
+  const auto work = [&] {
+    for (size_t i = next++; i < count; i = next++)
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      if (!function(i))
+        success = false;
     }
+  };
+
+  std::vector<std::future<void>> futures;
+  for (size_t i = 1; i < threads; ++i)
+    futures.push_back(std::async(std::launch::async, work));
+  work();
+  for (std::future<void>& future : futures)
+    future.get();
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+  return success;
+}
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
+static std::vector<u8> CompressChunk(CompressionType compression_type, int zstd_level,
+                                     const u8* data, size_t size)
+{
+  std::vector<u8> compressed;
+  if (compression_type == CompressionType::ZstdChunked)
+  {
+    compressed.resize(ZSTD_compressBound(size));
+    const size_t compressed_size =
+        ZSTD_compress(compressed.data(), compressed.size(), data, size, zstd_level);
+    compressed.resize(ZSTD_isError(compressed_size) ? 0 : compressed_size);
   }
+  else
+  {
+    compressed.resize(LZ4_compressBound(static_cast<int>(size)));
+    const int compressed_size = LZ4_compress_default(
+        reinterpret_cast<const char*>(data), reinterpret_cast<char*>(compressed.data()),
+        static_cast<int>(size), static_cast<int>(compressed.size()));
+    compressed.resize(std::max(compressed_size, 0));
+  }
+  return compressed;
+}
+
+static bool DecompressChunk(CompressionType compression_type, const u8* data, size_t size,
+                            u8* out, size_t out_size)
+{
+  if (compression_type == CompressionType::ZstdChunked)
+    return ZSTD_decompress(out, out_size, data, size) == out_size;
+
+  return LZ4_decompress_safe(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+                             static_cast<int>(size),
+                             static_cast<int>(out_size)) == static_cast<int>(out_size);
+}
+
+static void CompressBufferToFile(const u8* raw_buffer, u64 size, CompressionType compression_type,
+                                 int zstd_level, File::IOFile& f)
+{
+  ChunkedPayloadHeader header;
+  header.chunk_size = STATE_CHUNK_SIZE;
+  header.chunk_count = static_cast<u32>((size + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE);
+
+  std::vector<std::vector<u8>> chunks(header.chunk_count);
+  const bool success = RunInParallel(chunks.size(), [&](size_t i) {
+    const u64 offset = u64(i) * STATE_CHUNK_SIZE;
+    const size_t chunk_size = static_cast<size_t>(std::min<u64>(STATE_CHUNK_SIZE, size - offset));
+    chunks[i] = CompressChunk(compression_type, zstd_level, raw_buffer + offset, chunk_size);
+    return !chunks[i].empty();
+  });
+  if (!success)
+  {
+    PanicAlertFmtT("Internal Error - compressing the state failed");
+    return;
+  }
+
+  std::vector<u32> compressed_sizes(chunks.size());
+  std::transform(chunks.begin(), chunks.end(), compressed_sizes.begin(),
+                 [](const std::vector<u8>& chunk) { return static_cast<u32>(chunk.size()); });
+
+  f.WriteArray(&header, 1);
+  f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+  for (const std::vector<u8>& chunk : chunks)
+    f.WriteBytes(chunk.data(), chunk.size());
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -374,7 +524,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -408,10 +558,15 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
-
+  const int zstd_level = Config::Get(Config::MAIN_SAVESTATE_ZSTD_LEVEL);
+  CompressionType compression_type = CompressionType::Uncompressed;
   if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
+    compression_type = zstd_level > 0 ? CompressionType::ZstdChunked : CompressionType::LZ4Chunked;
+
+  WriteHeadersToFile(buffer_size, compression_type, f);
+
+  if (compression_type != CompressionType::Uncompressed)
+    CompressBufferToFile(buffer_data, buffer_size, compression_type, zstd_level, f);
   else
     f.WriteBytes(buffer_data, buffer_size);
 
@@ -484,18 +639,15 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
         std::vector<u8> current_buffer;
-        current_buffer.resize(buffer_size);
-        ptr = current_buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+        {
+          std::lock_guard lk_(s_spare_save_buffer_mutex);
+          current_buffer.swap(s_spare_save_buffer);
+        }
+
+        PointerWrap p(&current_buffer);
         DoState(system, p);
+        current_buffer.resize(p.GetPosition());
 
         if (p.IsWriteMode())
         {
@@ -723,6 +875,57 @@ static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f
   }
 }
 
+static bool DecompressChunked(std::vector<u8>& raw_buffer, u64 size,
+                              CompressionType compression_type, File::IOFile& f)
+{
+  ChunkedPayloadHeader header;
+  if (!f.ReadArray(&header, 1))
+  {
+    PanicAlertFmt("Could not read state data header");
+    return false;
+  }
+
+  if (header.chunk_size == 0 ||
+      header.chunk_count != (size + header.chunk_size - 1) / header.chunk_size)
+  {
+    PanicAlertFmt("State data header corrupted");
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(header.chunk_count);
+  if (!f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    PanicAlertFmt("Could not read state data length");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(header.chunk_count + 1);
+  for (size_t i = 0; i < compressed_sizes.size(); ++i)
+    compressed_offsets[i + 1] = compressed_offsets[i] + compressed_sizes[i];
+
+  std::vector<u8> compressed_data(compressed_offsets.back());
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.resize(size);
+  const bool success = RunInParallel(header.chunk_count, [&](size_t i) {
+    const u64 offset = u64(i) * header.chunk_size;
+    const size_t chunk_size = static_cast<size_t>(std::min<u64>(header.chunk_size, size - offset));
+    return DecompressChunk(compression_type, compressed_data.data() + compressed_offsets[i],
+                           compressed_sizes[i], raw_buffer.data() + offset, chunk_size);
+  });
+  if (!success)
+  {
+    PanicAlertFmtT("Internal Error - decompressing the state failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -820,6 +1023,20 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     break;
   }
+  case CompressionType::LZ4Chunked:
+  case CompressionType::ZstdChunked:
+  {
+    Core::DisplayMessage("Decompressing State...", 500);
+    const auto compression_type =
+        static_cast<CompressionType>(extended_header.base_header.compression_type);
+    if (!DecompressChunked(buffer, extended_header.base_header.uncompressed_size, compression_type,
+                           f))
+    {
+      return;
+    }
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -945,6 +1162,11 @@ void Init(Core::System& system)
   s_save_thread.Reset("Savestate Worker", [&system](CompressAndDumpState_args args) {
     CompressAndDumpState(system, args);
 
+    {
+      std::lock_guard lk(s_spare_save_buffer_mutex);
+      s_spare_save_buffer = std::move(args.buffer_vector);
+    }
+
     {
       std::lock_guard lk(s_state_writes_in_queue_mutex);
       if (--s_state_writes_in_queue == 0)
@@ -954,12 +1176,30 @@ void Init(Core::System& system)
     if (args.state_write_done_event)
       args.state_write_done_event->Set();
   });
+
+  s_rewind_thread.Reset("Rewind Worker", [](RewindSnapshot snapshot) {
+    {
+      std::lock_guard lk(s_rewind_mutex);
+      s_rewind_buffer.SetMaxSize(snapshot.max_history_size);
+      s_rewind_spare_buffer = s_rewind_buffer.Push(std::move(snapshot.buffer));
+    }
+    --s_rewind_snapshots_in_queue;
+  });
+  s_frames_until_rewind_snapshot = 0;
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
 
+  s_rewind_thread.Shutdown(true);
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    s_rewind_buffer.Clear();
+    std::vector<u8>().swap(s_rewind_spare_buffer);
+  }
+  s_rewind_snapshots_in_queue = 0;
+
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
   // never)
@@ -967,6 +1207,10 @@ void Shutdown()
     std::lock_guard lk(s_undo_load_buffer_mutex);
     std::vector<u8>().swap(s_undo_load_buffer);
   }
+  {
+    std::lock_guard lk(s_spare_save_buffer_mutex);
+    std::vector<u8>().swap(s_spare_save_buffer);
+  }
 }
 
 static std::string MakeStateFilename(int number)
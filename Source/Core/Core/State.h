@@ -55,6 +55,9 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The payload is split into chunks which are compressed independently, see ChunkedPayloadHeader.
+  LZ4Chunked = 2,
+  ZstdChunked = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -72,6 +75,16 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+// Chunked payloads start with this header, followed by the compressed size of each chunk as a u32,
+// followed by the chunks. Every chunk but the last decompresses to chunk_size bytes.
+struct ChunkedPayloadHeader
+{
+  u32 chunk_size;
+  u32 chunk_count;
+};
+static_assert(sizeof(ChunkedPayloadHeader) == 8);
+static_assert(std::is_trivially_copyable_v<ChunkedPayloadHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
@@ -106,14 +119,25 @@ void Load(Core::System& system, int slot);
 void SaveAs(Core::System& system, const std::string& filename, bool wait = false);
 void LoadAs(Core::System& system, const std::string& filename);
 
+// The buffer's memory is reused, so passing in the buffer of an earlier state is faster.
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
+// Same as LoadFromBuffer, but also allowed during NetPlay. Only for rolling back, where every
+// player loads their own state and replays the same inputs.
+void LoadFromBufferForRollback(Core::System& system, std::vector<u8>& buffer);
 
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Called on the CPU thread at the end of every frame. While rewinding is enabled, this keeps a
+// snapshot every MAIN_REWIND_INTERVAL frames in memory.
+void UpdateRewind(Core::System& system);
+// Loads the newest rewind snapshot and removes it from the history, so that calling this again
+// goes further back. Returns false if there are no snapshots.
+bool Rewind(Core::System& system);
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
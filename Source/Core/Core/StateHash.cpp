@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/StateHash.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "Common/Hash.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+
+namespace StateHash
+{
+namespace
+{
+struct Slice
+{
+  const u8* data;
+  u32 size;
+  // The effective address the slice starts at, for messages.
+  u32 address;
+  const char* region;
+};
+
+u32 GetMEM1SliceCount(const Memory::MemoryManager& memory)
+{
+  return (memory.GetRamSizeReal() + SLICE_SIZE - 1) / SLICE_SIZE;
+}
+
+u32 GetMEM2SliceCount(Memory::MemoryManager& memory)
+{
+  return memory.GetEXRAM() ? (memory.GetExRamSizeReal() + SLICE_SIZE - 1) / SLICE_SIZE : 0;
+}
+
+Slice GetSlice(Core::System& system, u32 frame)
+{
+  auto& memory = system.GetMemory();
+  const u32 mem1_slices = GetMEM1SliceCount(memory);
+  const u32 index = frame % (mem1_slices + GetMEM2SliceCount(memory));
+  if (index < mem1_slices)
+  {
+    const u32 offset = index * SLICE_SIZE;
+    return {memory.GetRAM() + offset, std::min(SLICE_SIZE, memory.GetRamSizeReal() - offset),
+            0x80000000 + offset, "MEM1"};
+  }
+
+  const u32 offset = (index - mem1_slices) * SLICE_SIZE;
+  return {memory.GetEXRAM() + offset, std::min(SLICE_SIZE, memory.GetExRamSizeReal() - offset),
+          0x90000000 + offset, "MEM2"};
+}
+}  // namespace
+
+u32 GetSliceCount(Core::System& system)
+{
+  auto& memory = system.GetMemory();
+  return GetMEM1SliceCount(memory) + GetMEM2SliceCount(memory);
+}
+
+u64 ComputeFrameHash(Core::System& system, u32 frame)
+{
+  // With every word hashed, GetHash64 gives the same result on all hosts.
+  const Slice slice = GetSlice(system, frame);
+  return Common::GetHash64(slice.data, slice.size, 0);
+}
+
+std::string DescribeFrameRegion(Core::System& system, u32 frame)
+{
+  const Slice slice = GetSlice(system, frame);
+  return fmt::format("{} {:#010x}-{:#010x}", slice.region, slice.address,
+                     slice.address + slice.size - 1);
+}
+}  // namespace StateHash
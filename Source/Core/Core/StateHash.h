@@ -0,0 +1,27 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class System;
+}
+
+// A hash of the emulated state which is cheap enough to be compared between instances every
+// frame. Hashing all of RAM every frame would be too slow, so every frame covers a different slice
+// of MEM1 and MEM2, and all of RAM is covered every GetSliceCount() frames. The first frame with a
+// different hash then also tells which memory region diverged.
+namespace StateHash
+{
+constexpr u32 SLICE_SIZE = 1024 * 1024;
+
+u32 GetSliceCount(Core::System& system);
+u64 ComputeFrameHash(Core::System& system, u32 frame);
+// Describes the memory region which the hash of a frame covers, like "MEM1 0x80100000-0x801fffff".
+std::string DescribeFrameRegion(Core::System& system, u32 frame);
+}  // namespace StateHash
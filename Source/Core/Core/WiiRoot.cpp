@@ -23,6 +23,7 @@
 #include "Core/HW/WiiSave.h"
 #include "Core/IOS/ES/ES.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/MemoryBackend/MemoryFS.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
@@ -38,6 +39,7 @@ static std::string s_temp_wii_root;
 static std::string s_temp_redirect_root;
 static bool s_wii_root_initialized = false;
 static std::vector<IOS::HLE::FS::NandRedirect> s_nand_redirects;
+static std::shared_ptr<IOS::HLE::FS::MemoryFileSystem> s_memory_fs;
 
 // When Temp NAND + Redirects are both active, we need to keep track of where each redirect path
 // should be copied back to after a successful session finish.
@@ -53,6 +55,13 @@ const std::vector<IOS::HLE::FS::NandRedirect>& GetActiveNandRedirects()
   return s_nand_redirects;
 }
 
+std::shared_ptr<IOS::HLE::FS::FileSystem> GetSessionFileSystem()
+{
+  if (s_memory_fs)
+    return s_memory_fs;
+  return FS::MakeFileSystem(FS::Location::Session, s_nand_redirects);
+}
+
 static bool CopyBackupFile(const std::string& path_from, const std::string& path_to)
 {
   if (!File::Exists(path_from))
@@ -204,7 +213,7 @@ static void MoveToBackupIfExists(const std::string& path)
   }
 }
 
-void InitializeWiiRoot(bool use_temporary)
+void InitializeWiiRoot(bool use_temporary, bool in_memory)
 {
   ASSERT(!s_wii_root_initialized);
 
@@ -226,12 +235,31 @@ void InitializeWiiRoot(bool use_temporary)
     File::SetUserPath(D_SESSION_WIIROOT_IDX, File::GetUserPath(D_WIIROOT_IDX));
   }
 
+  if (in_memory)
+  {
+    // A temporary NAND only gets the files copied by InitializeWiiFileSystemContents, so there is
+    // nothing to read from the host.
+    s_memory_fs = std::make_shared<FS::MemoryFileSystem>(
+        use_temporary ? nullptr : FS::MakeFileSystem(FS::Location::Session));
+    WARN_LOG_FMT(IOS_FS, "Using an in-memory NAND, changes to it will be discarded");
+  }
+
   s_nand_redirects.clear();
   s_wii_root_initialized = true;
 }
 
 void ShutdownWiiRoot()
 {
+  if (s_memory_fs)
+  {
+    const std::vector<std::string> modified_paths = s_memory_fs->GetModifiedPaths();
+    INFO_LOG_FMT(IOS_FS, "Discarding {} modified paths of the in-memory NAND",
+                 modified_paths.size());
+    for (const std::string& path : modified_paths)
+      DEBUG_LOG_FMT(IOS_FS, "Discarding changes to {}", path);
+    s_memory_fs.reset();
+  }
+
   if (WiiRootIsTemporary())
   {
     File::DeleteDirRecursively(s_temp_wii_root);
@@ -390,6 +418,11 @@ void CleanUpWiiFileSystemContents(const BootSessionData& boot_session_data)
 
   INFO_LOG_FMT(CORE, "Wii FS Cleanup: Copying from temporary FS to configured_fs.");
 
+  IOS::HLE::EmulationKernel* ios = Core::System::GetInstance().GetIOS();
+
+  // Files are copied from the host directly below, so cached changes must be written first.
+  ios->GetFS()->Flush();
+
   // copy back the temp nand redirected files to where they should normally be redirected to
   for (const auto& redirect : s_temp_nand_redirects)
   {
@@ -397,8 +430,6 @@ void CleanUpWiiFileSystemContents(const BootSessionData& boot_session_data)
     File::MoveWithOverwrite(redirect.temp_path, redirect.real_path);
   }
 
-  IOS::HLE::EmulationKernel* ios = Core::System::GetInstance().GetIOS();
-
   // clear the redirects in the session FS, otherwise the back-copy might grab redirected files
   s_nand_redirects.clear();
   ios->GetFS()->SetNandRedirects({});
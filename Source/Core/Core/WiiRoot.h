@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -12,6 +13,7 @@ class BootSessionData;
 
 namespace IOS::HLE::FS
 {
+class FileSystem;
 struct NandRedirect;
 }
 
@@ -23,7 +25,9 @@ enum class RestoreReason
   CrashRecovery,
 };
 
-void InitializeWiiRoot(bool use_temporary);
+// With in_memory, the session NAND is kept in memory and all changes to it are discarded when the
+// Wii root is shut down. A temporary in-memory NAND starts out empty.
+void InitializeWiiRoot(bool use_temporary, bool in_memory = false);
 void ShutdownWiiRoot();
 
 bool WiiRootIsInitialized();
@@ -39,4 +43,8 @@ void InitializeWiiFileSystemContents(
 void CleanUpWiiFileSystemContents(const BootSessionData& boot_session_data);
 
 const std::vector<IOS::HLE::FS::NandRedirect>& GetActiveNandRedirects();
+
+// The file system for the session NAND. With an in-memory NAND, every call returns the same
+// instance, so that the contents survive IOS reloads. Otherwise, a new host file system is created.
+std::shared_ptr<IOS::HLE::FS::FileSystem> GetSessionFileSystem();
 }  // namespace Core
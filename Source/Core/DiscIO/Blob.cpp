@@ -251,7 +251,7 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
     if (auto split_blob = SplitPlainFileReader::Create(filename))
       return std::move(split_blob);
 
-    return PlainFileReader::Create(std::move(file));
+    return PlainFileReader::Create(std::move(file), filename);
   }
 }
 
@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -87,6 +88,12 @@ public:
     return Common::FromBigEndian(temp);
   }
 
+  // Returns the data in the given range without copying it, e.g. from a memory-mapped file.
+  // Returns an empty span if the reader can't do this for the range, in which case Read must be
+  // used instead. The span stays valid until the next call to Read or GetView.
+  // NOT thread-safe - can't call this from multiple threads.
+  virtual std::span<const u8> GetView(u64 offset, u64 size) { return {}; }
+
   virtual bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const
   {
     return false;
@@ -194,14 +201,18 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// threads is the number of compression threads to use. 0 means one per hardware thread.
+// zstd_dictionary makes RVZ files compressed with Zstandard store a dictionary built from the
+// disc's files. This helps with small chunk sizes, but older versions can't read such files.
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
-                  CompressCB callback);
+                  CompressCB callback, size_t threads = 0);
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, CompressCB callback);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback);
+                       int chunk_size, CompressCB callback, size_t threads = 0,
+                       bool zstd_dictionary = false);
 
 }  // namespace DiscIO
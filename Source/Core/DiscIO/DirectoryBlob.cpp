@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
 #include <utility>
 #include <variant>
@@ -96,12 +97,20 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
 
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
-      const auto& content = std::get<ContentFile>(m_content_source);
-      File::IOFile file(content.m_filename, "rb");
-      if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
-          !file.ReadBytes(*buffer, bytes_to_read))
+      const std::span<const u8> view = GetView(*offset, bytes_to_read, blob);
+      if (view.size() == bytes_to_read)
       {
-        return false;
+        std::copy(view.begin(), view.end(), *buffer);
+      }
+      else
+      {
+        const auto& content = std::get<ContentFile>(m_content_source);
+        File::IOFile file(content.m_filename, "rb");
+        if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
+            !file.ReadBytes(*buffer, bytes_to_read))
+        {
+          return false;
+        }
       }
     }
     else if (std::holds_alternative<ContentMemory>(m_content_source))
@@ -148,6 +157,34 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
   return true;
 }
 
+std::span<const u8> DiscContent::GetView(u64 offset, u64 length,
+                                         DirectoryBlobReader* blob) const
+{
+  DEBUG_ASSERT(offset >= m_offset);
+  const u64 offset_in_content = offset - m_offset;
+  if (offset_in_content > m_size || length > m_size - offset_in_content)
+    return {};
+
+  if (std::holds_alternative<ContentFile>(m_content_source))
+  {
+    const auto& content = std::get<ContentFile>(m_content_source);
+    const File::MemoryMappedFile* file = blob->GetMappedFile(content.m_filename);
+    const u64 offset_in_file = content.m_offset + offset_in_content;
+    if (!file || offset_in_file > file->GetSize() || length > file->GetSize() - offset_in_file)
+      return {};
+
+    return {file->GetData() + offset_in_file, static_cast<size_t>(length)};
+  }
+
+  if (std::holds_alternative<ContentMemory>(m_content_source))
+  {
+    const auto& content = std::get<ContentMemory>(m_content_source);
+    return {content->data() + offset_in_content, static_cast<size_t>(length)};
+  }
+
+  return {};
+}
+
 void DiscContentContainer::Add(u64 offset, u64 size, ContentSource source)
 {
   if (size != 0)
@@ -194,6 +231,16 @@ bool DiscContentContainer::Read(u64 offset, u64 length, u8* buffer, DirectoryBlo
   return true;
 }
 
+std::span<const u8> DiscContentContainer::GetView(u64 offset, u64 length,
+                                                  DirectoryBlobReader* blob) const
+{
+  const auto it = m_contents.upper_bound(DiscContent(offset));
+  if (it == m_contents.end() || it->GetOffset() > offset)
+    return {};
+
+  return it->GetView(offset, length, blob);
+}
+
 static std::optional<PartitionType> ParsePartitionDirectoryName(const std::string& name)
 {
   if (name.size() < 2)
@@ -495,6 +542,39 @@ bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
       .Read(offset, length, buffer, this);
 }
 
+std::span<const u8> DirectoryBlobReader::GetView(u64 offset, u64 size)
+{
+  if (offset + size > m_data_size)
+    return {};
+
+  return (m_is_wii ? m_nonpartition_contents : m_gamecube_pseudopartition.GetContents())
+      .GetView(offset, size, this);
+}
+
+const File::MemoryMappedFile* DirectoryBlobReader::GetMappedFile(const std::string& path)
+{
+  // Extracted games can contain thousands of files, so only the most recently used ones are kept
+  // mapped. Games tend to read a few files at a time.
+  static constexpr size_t MAX_MAPPED_FILES = 64;
+
+  const auto it = std::find_if(m_mapped_files.begin(), m_mapped_files.end(),
+                               [&path](const auto& entry) { return entry.first == path; });
+  if (it != m_mapped_files.end())
+  {
+    m_mapped_files.splice(m_mapped_files.begin(), m_mapped_files, it);
+    return m_mapped_files.front().second.get();
+  }
+
+  auto file = std::make_unique<File::MemoryMappedFile>();
+  if (!file->Open(path))
+    return nullptr;
+
+  if (m_mapped_files.size() >= MAX_MAPPED_FILES)
+    m_mapped_files.pop_back();
+  m_mapped_files.emplace_front(path, std::move(file));
+  return m_mapped_files.front().second.get();
+}
+
 const DirectoryBlobPartition* DirectoryBlobReader::GetPartition(u64 offset, u64 size,
                                                                 u64 partition_data_offset) const
 {
@@ -6,16 +6,20 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/MemoryMappedFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/WiiEncryptionCache.h"
@@ -138,6 +142,8 @@ public:
   u64 GetEndOffset() const;
   u64 GetSize() const;
   bool Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReader* blob) const;
+  // Returns an empty span unless the whole range is in this chunk and is in memory or in a file.
+  std::span<const u8> GetView(u64 offset, u64 length, DirectoryBlobReader* blob) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
   bool operator!=(const DiscContent& other) const { return !(*this == other); }
@@ -170,6 +176,7 @@ public:
   u64 CheckSizeAndAdd(u64 offset, u64 max_size, const std::string& path);
 
   bool Read(u64 offset, u64 length, u8* buffer, DirectoryBlobReader* blob) const;
+  std::span<const u8> GetView(u64 offset, u64 length, DirectoryBlobReader* blob) const;
 
 private:
   std::set<DiscContent> m_contents;
@@ -261,6 +268,7 @@ public:
   DirectoryBlobReader& operator=(DirectoryBlobReader&&) = default;
 
   bool Read(u64 offset, u64 length, u8* buffer) override;
+  std::span<const u8> GetView(u64 offset, u64 size) override;
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
   bool ReadWiiDecrypted(u64 offset, u64 size, u8* buffer, u64 partition_data_offset) override;
 
@@ -313,6 +321,10 @@ private:
 
   DiscIO::VolumeDisc* GetWrappedVolume() { return m_wrapped_volume.get(); }
 
+  // Returns nullptr if the file can't be mapped. The returned pointer stays valid until the next
+  // call to this function.
+  const File::MemoryMappedFile* GetMappedFile(const std::string& path);
+
   // For GameCube:
   DirectoryBlobPartition m_gamecube_pseudopartition;
 
@@ -327,6 +339,9 @@ private:
   u64 m_data_size;
 
   std::unique_ptr<DiscIO::VolumeDisc> m_wrapped_volume;
+
+  // The most recently used file is at the front.
+  std::list<std::pair<std::string, std::unique_ptr<File::MemoryMappedFile>>> m_mapped_files;
 };
 
 }  // namespace DiscIO
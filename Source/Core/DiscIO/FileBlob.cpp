@@ -15,26 +15,74 @@
 
 namespace DiscIO
 {
-PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
+// How far ahead of a read the OS is asked to page in a memory-mapped disc image.
+static constexpr u64 READAHEAD_SIZE = 0x100000;
+
+void MappedFileReadahead::OnRead(const File::MemoryMappedFile& file, u64 offset, u64 size)
+{
+  const u64 end = offset + size;
+  if (offset != m_last_read_end)
+  {
+    // The game has seeked, so whatever was paged in ahead of the old position is of no use.
+    m_advised_end = std::max(end, offset + READAHEAD_SIZE);
+    file.Advise(offset, m_advised_end - offset, File::MemoryMappedFile::AccessHint::WillNeed);
+  }
+  else if (end + READAHEAD_SIZE / 2 > m_advised_end)
+  {
+    // Keep reading ahead of a sequential read before it catches up.
+    const u64 advise_start = std::max(offset, m_advised_end);
+    m_advised_end = std::max(end, m_advised_end) + READAHEAD_SIZE;
+    file.Advise(advise_start, m_advised_end - advise_start,
+                File::MemoryMappedFile::AccessHint::Sequential);
+  }
+  m_last_read_end = end;
+}
+
+PlainFileReader::PlainFileReader(File::IOFile file, const std::string& path)
+    : m_file(std::move(file)), m_path(path)
 {
   m_size = m_file.GetSize();
+
+  // Reading through the mapping avoids a seek and a read call for every (often small) read.
+  if (!m_mapping.Open(path) || m_mapping.GetSize() != m_size)
+    m_mapping.Close();
 }
 
-std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
+std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file,
+                                                         const std::string& path)
 {
   if (file)
-    return std::unique_ptr<PlainFileReader>(new PlainFileReader(std::move(file)));
+    return std::unique_ptr<PlainFileReader>(new PlainFileReader(std::move(file), path));
 
   return nullptr;
 }
 
 std::unique_ptr<BlobReader> PlainFileReader::CopyReader() const
 {
-  return Create(m_file.Duplicate("rb"));
+  return Create(m_file.Duplicate("rb"), m_path);
+}
+
+std::span<const u8> PlainFileReader::GetView(u64 offset, u64 nbytes)
+{
+  if (!m_mapping.IsOpen() || offset > m_size || nbytes > m_size - offset)
+    return {};
+
+  m_readahead.OnRead(m_mapping, offset, nbytes);
+  return {m_mapping.GetData() + offset, static_cast<size_t>(nbytes)};
 }
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapping.IsOpen())
+  {
+    const std::span<const u8> view = GetView(offset, nbytes);
+    if (view.size() != nbytes)
+      return false;
+
+    std::copy(view.begin(), view.end(), out_ptr);
+    return true;
+  }
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -93,13 +141,18 @@ bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
     }
     const u64 inpos = i * buffer_size;
     const u64 sz = std::min(buffer_size, infile->GetDataSize() - inpos);
-    if (!infile->Read(inpos, sz, buffer.data()))
+    const u8* data = buffer.data();
+    if (const std::span<const u8> view = infile->GetView(inpos, sz); !view.empty())
+    {
+      data = view.data();
+    }
+    else if (!infile->Read(inpos, sz, buffer.data()))
     {
       PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
       success = false;
       break;
     }
-    if (!outfile.WriteBytes(buffer.data(), sz))
+    if (!outfile.WriteBytes(data, sz))
     {
       PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
                      "Check that you have enough space available on the target drive.",
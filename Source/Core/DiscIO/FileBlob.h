@@ -9,14 +9,28 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MemoryMappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
 {
+// Tells the OS which parts of a memory-mapped disc image are about to be read, so that the page
+// faults on the DVD thread don't each have to wait for the disk.
+class MappedFileReadahead
+{
+public:
+  void OnRead(const File::MemoryMappedFile& file, u64 offset, u64 size);
+
+private:
+  u64 m_last_read_end = 0;
+  u64 m_advised_end = 0;
+};
+
 class PlainFileReader : public BlobReader
 {
 public:
-  static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  // Memory-maps the file at the given path if possible, and otherwise reads from the file.
+  static std::unique_ptr<PlainFileReader> Create(File::IOFile file, const std::string& path);
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
   std::unique_ptr<BlobReader> CopyReader() const override;
@@ -31,11 +45,15 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  std::span<const u8> GetView(u64 offset, u64 nbytes) override;
 
 private:
-  PlainFileReader(File::IOFile file);
+  PlainFileReader(File::IOFile file, const std::string& path);
 
   File::IOFile m_file;
+  std::string m_path;
+  File::MemoryMappedFile m_mapping;
+  MappedFileReadahead m_readahead;
   u64 m_size;
 };
 
@@ -4,7 +4,10 @@
 #include "DiscIO/NANDImporter.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <future>
+#include <thread>
 
 #include "Common/Crypto/AES.h"
 #include "Common/FileUtil.h"
@@ -36,6 +39,7 @@ void NANDImporter::ImportNANDBin(const std::string& path_to_bin,
 
   ExportKeys();
   ProcessEntry(0, "");
+  WriteFiles();
   ExtractCertificates();
 }
 
@@ -58,17 +62,25 @@ bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
 
   m_nand.resize(NAND_SIZE);
 
-  for (size_t i = 0; i < NAND_TOTAL_BLOCKS; i++)
+  // Read many blocks at a time rather than doing a read and a seek for each one.
+  // This also paces the update callback, which is called once per read.
+  constexpr size_t BLOCKS_PER_READ = 0x400;
+  constexpr size_t BLOCK_WITH_ECC_SIZE = NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE;
+  static_assert(NAND_TOTAL_BLOCKS % BLOCKS_PER_READ == 0);
+  std::vector<u8> buffer(BLOCK_WITH_ECC_SIZE * BLOCKS_PER_READ);
+
+  for (size_t i = 0; i < NAND_TOTAL_BLOCKS; i += BLOCKS_PER_READ)
   {
-    // Instead of updating on every cycle, we only update every 1000 cycles for a balance between
-    // not updating fast enough vs updating too fast
-    if (i % 1000 == 0)
-      m_update_callback();
+    m_update_callback();
 
-    file.ReadBytes(&m_nand[i * NAND_BLOCK_SIZE], NAND_BLOCK_SIZE);
+    file.ReadBytes(buffer.data(), buffer.size());
 
     // We don't care about the ECC blocks
-    file.Seek(NAND_ECC_BLOCK_SIZE, File::SeekOrigin::Current);
+    for (size_t j = 0; j < BLOCKS_PER_READ; j++)
+    {
+      std::memcpy(&m_nand[(i + j) * NAND_BLOCK_SIZE], &buffer[j * BLOCK_WITH_ECC_SIZE],
+                  NAND_BLOCK_SIZE);
+    }
   }
 
   m_nand_keys.resize(NAND_KEYS_SIZE);
@@ -150,9 +162,7 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
     Type type = static_cast<Type>(entry.mode & 3);
     if (type == Type::File)
     {
-      std::vector<u8> data = GetEntryData(entry);
-      File::IOFile file(m_nand_root + path, "wb");
-      file.WriteBytes(data.data(), data.size());
+      m_files.push_back({entry, path});
     }
     else if (type == Type::Directory)
     {
@@ -168,17 +178,49 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
   }
 }
 
-std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry)
+void NANDImporter::WriteFiles()
+{
+  // Files are independent of each other, so they are decrypted and written on several threads.
+  // The calling thread works through them too, and is the one that calls the update callback.
+  const size_t threads = std::min<size_t>(
+      m_files.size(), std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+  std::atomic<size_t> next_file = 0;
+  const auto write_files = [this, &next_file](bool is_calling_thread) {
+    for (size_t i = next_file++; i < m_files.size(); i = next_file++)
+    {
+      const FileToWrite& file_to_write = m_files[i];
+      const std::vector<u8> data = GetEntryData(file_to_write.entry);
+      File::IOFile file(m_nand_root + file_to_write.path, "wb");
+      file.WriteBytes(data.data(), data.size());
+
+      if (is_calling_thread)
+        m_update_callback();
+    }
+  };
+
+  std::vector<std::future<void>> futures(threads > 1 ? threads - 1 : 0);
+  for (std::future<void>& future : futures)
+    future = std::async(std::launch::async, write_files, false);
+  write_files(true);
+
+  for (std::future<void>& future : futures)
+    future.get();
+
+  m_files.clear();
+}
+
+std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry) const
 {
   constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
 
   u16 sub = entry.sub;
-  size_t remaining_bytes = entry.size;
-  std::vector<u8> data{};
-  data.reserve(remaining_bytes);
+  const size_t total_bytes = entry.size;
+  std::vector<u8> data(total_bytes);
 
-  auto block = std::make_unique<u8[]>(NAND_FAT_BLOCK_SIZE);
-  while (remaining_bytes > 0)
+  // Blocks are decrypted straight into the file data, except for a partial last block.
+  std::unique_ptr<u8[]> block;
+  for (size_t offset = 0; offset < total_bytes; offset += NAND_FAT_BLOCK_SIZE)
   {
     if (sub >= m_superblock->fat.size())
     {
@@ -186,11 +228,18 @@ std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry)
       return {};
     }
 
-    m_aes_ctx->CryptIvZero(&m_nand[NAND_FAT_BLOCK_SIZE * sub], block.get(), NAND_FAT_BLOCK_SIZE);
-
-    size_t size = std::min(remaining_bytes, NAND_FAT_BLOCK_SIZE);
-    data.insert(data.end(), block.get(), block.get() + size);
-    remaining_bytes -= size;
+    const u8* const encrypted = &m_nand[NAND_FAT_BLOCK_SIZE * sub];
+    const size_t size = std::min(total_bytes - offset, NAND_FAT_BLOCK_SIZE);
+    if (size == NAND_FAT_BLOCK_SIZE)
+    {
+      m_aes_ctx->CryptIvZero(encrypted, &data[offset], NAND_FAT_BLOCK_SIZE);
+    }
+    else
+    {
+      block = std::make_unique<u8[]>(NAND_FAT_BLOCK_SIZE);
+      m_aes_ctx->CryptIvZero(encrypted, block.get(), NAND_FAT_BLOCK_SIZE);
+      std::memcpy(&data[offset], block.get(), size);
+    }
 
     sub = m_superblock->fat[sub];
   }
@@ -69,14 +69,23 @@ private:
   std::string GetPath(const NANDFSTEntry& entry, const std::string& parent_path);
   std::string FormatDebugString(const NANDFSTEntry& entry);
   void ProcessEntry(u16 entry_number, const std::string& parent_path);
-  std::vector<u8> GetEntryData(const NANDFSTEntry& entry);
+  void WriteFiles();
+  std::vector<u8> GetEntryData(const NANDFSTEntry& entry) const;
   void ExportKeys();
 
+  struct FileToWrite
+  {
+    NANDFSTEntry entry;
+    std::string path;
+  };
+
   std::string m_nand_root;
   std::vector<u8> m_nand;
   std::vector<u8> m_nand_keys;
   std::unique_ptr<Common::AES::Context> m_aes_ctx;
   std::unique_ptr<NANDSuperblock> m_superblock;
+  // Found by ProcessEntry, which creates the directories, and then written by WriteFiles.
+  std::vector<FileToWrite> m_files;
   std::function<void()> m_update_callback;
 };
 }  // namespace DiscIO
@@ -50,7 +50,8 @@ FileDataLoaderHostFS::FileDataLoaderHostFS(std::string sd_root, const std::strin
   // m_patch_root with it.
   if (!patch_root.empty())
   {
-    auto r = MakeAbsoluteFromRelative(patch_root);
+    // This has to bypass the cache, since the result depends on m_patch_root.
+    auto r = ResolvePath(patch_root);
     if (r)
       m_patch_root = std::move(*r);
   }
@@ -58,6 +59,32 @@ FileDataLoaderHostFS::FileDataLoaderHostFS(std::string sd_root, const std::strin
 
 std::optional<std::string>
 FileDataLoaderHostFS::MakeAbsoluteFromRelative(std::string_view external_relative_path)
+{
+  auto it = m_resolved_paths.find(external_relative_path);
+  if (it == m_resolved_paths.end())
+  {
+    it = m_resolved_paths
+             .emplace(std::string(external_relative_path), ResolvePath(external_relative_path))
+             .first;
+  }
+  return it->second;
+}
+
+const std::vector<std::string>& FileDataLoaderHostFS::GetDirectoryListing(const std::string& path)
+{
+  auto it = m_directory_listings.find(path);
+  if (it == m_directory_listings.end())
+  {
+    std::vector<std::string> listing;
+    for (auto& f : ::File::ScanDirectoryTree(path, false).children)
+      listing.emplace_back(std::move(f.virtualName));
+    it = m_directory_listings.emplace(path, std::move(listing)).first;
+  }
+  return it->second;
+}
+
+std::optional<std::string>
+FileDataLoaderHostFS::ResolvePath(std::string_view external_relative_path)
 {
 #ifdef _WIN32
   // Riivolution treats a backslash as just a standard filename character, but we can't replicate
@@ -130,13 +157,12 @@ FileDataLoaderHostFS::MakeAbsoluteFromRelative(std::string_view external_relativ
         result.erase(result.size() - element.size(), element.size());
 
         // Re-attach an element that actually matches the capitalization in the host filesystem.
-        auto possible_files = ::File::ScanDirectoryTree(result, false);
         bool found = false;
-        for (auto& f : possible_files.children)
+        for (const std::string& name : GetDirectoryListing(result))
         {
-          if (Common::CaseInsensitiveEquals(element, f.virtualName))
+          if (Common::CaseInsensitiveEquals(element, name))
           {
-            result += f.virtualName;
+            result += name;
             found = true;
             break;
           }
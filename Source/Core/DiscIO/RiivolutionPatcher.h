@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
 #include <optional>
 #include <span>
 #include <string>
@@ -66,9 +68,17 @@ public:
 
 private:
   std::optional<std::string> MakeAbsoluteFromRelative(std::string_view external_relative_path);
+  std::optional<std::string> ResolvePath(std::string_view external_relative_path);
+  const std::vector<std::string>& GetDirectoryListing(const std::string& path);
 
   std::string m_sd_root;
   std::string m_patch_root;
+
+  // Large mods reference hundreds of files, and each of them is looked up several times while
+  // the patches are applied, so resolved paths and the directory listings used for
+  // case-insensitive matching are kept for the lifetime of the loader.
+  std::map<std::string, std::optional<std::string>, std::less<>> m_resolved_paths;
+  std::map<std::string, std::vector<std::string>> m_directory_listings;
 };
 
 enum class PatchIndex
@@ -3,6 +3,7 @@
 
 #include "DiscIO/SplitFileBlob.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -38,13 +39,15 @@ std::unique_ptr<SplitPlainFileReader> SplitPlainFileReader::Create(std::string_v
   u64 offset = 0;
   while (true)
   {
-    File::IOFile f(fmt::format("{}.part{}.iso", base_path, index), "rb");
+    std::string path = fmt::format("{}.part{}.iso", base_path, index);
+    File::IOFile f(path, "rb");
     if (!f.IsOpen())
       break;
     const u64 size = f.GetSize();
     if (size == 0)
       return nullptr;
-    files.emplace_back(SingleFile{std::move(f), offset, size});
+    files.emplace_back(SingleFile{std::move(f), offset, size, std::move(path)});
+    MapFile(&files.back());
     offset += size;
     ++index;
   }
@@ -61,12 +64,40 @@ std::unique_ptr<BlobReader> SplitPlainFileReader::CopyReader() const
   std::vector<SingleFile> new_files{};
   for (const SingleFile& file : m_files)
   {
-    new_files.push_back(
-        {.file = file.file.Duplicate("rb"), .offset = file.offset, .size = file.size});
+    new_files.push_back({.file = file.file.Duplicate("rb"),
+                         .offset = file.offset,
+                         .size = file.size,
+                         .path = file.path});
+    MapFile(&new_files.back());
   }
   return std::unique_ptr<SplitPlainFileReader>(new SplitPlainFileReader(std::move(new_files)));
 }
 
+void SplitPlainFileReader::MapFile(SingleFile* file)
+{
+  file->mapping = std::make_unique<File::MemoryMappedFile>();
+  if (!file->mapping->Open(file->path) || file->mapping->GetSize() != file->size)
+    file->mapping->Close();
+}
+
+std::span<const u8> SplitPlainFileReader::GetView(u64 offset, u64 nbytes)
+{
+  // Only reads within a single part can be handed out without copying.
+  for (auto& file : m_files)
+  {
+    if (offset < file.offset || offset >= file.offset + file.size)
+      continue;
+
+    const u64 offset_in_file = offset - file.offset;
+    if (!file.mapping->IsOpen() || nbytes > file.size - offset_in_file)
+      return {};
+
+    file.readahead.OnRead(*file.mapping, offset_in_file, nbytes);
+    return {file.mapping->GetData() + offset_in_file, static_cast<size_t>(nbytes)};
+  }
+  return {};
+}
+
 bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
   if (offset >= m_size)
@@ -82,7 +113,12 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
-      if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
+      if (file.mapping->IsOpen())
+      {
+        file.readahead.OnRead(*file.mapping, seek_offset, current_read);
+        std::copy_n(file.mapping->GetData() + seek_offset, current_read, out);
+      }
+      else if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
       {
         f.ClearError();
         return false;
@@ -11,7 +11,9 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MemoryMappedFile.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/FileBlob.h"
 
 namespace DiscIO
 {
@@ -33,6 +35,7 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  std::span<const u8> GetView(u64 offset, u64 nbytes) override;
 
 private:
   struct SingleFile
@@ -40,8 +43,14 @@ private:
     File::IOFile file;
     u64 offset;
     u64 size;
+    std::string path;
+    // Not open if the file couldn't be mapped, in which case it's read from instead.
+    std::unique_ptr<File::MemoryMappedFile> mapping;
+    MappedFileReadahead readahead;
   };
 
+  static void MapFile(SingleFile* file);
+
   SplitPlainFileReader(std::vector<SingleFile> m_files);
 
   std::vector<SingleFile> m_files;
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -32,6 +33,7 @@
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/TaskScheduler.h"
 #include "Common/Version.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/ES/ES.h"
@@ -360,11 +362,12 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
-                               Hashes<bool> hashes_to_calculate)
+                               Hashes<bool> hashes_to_calculate, size_t jobs)
     : m_volume(volume), m_redump_verification(redump_verification),
       m_hashes_to_calculate(hashes_to_calculate),
       m_calculating_any_hash(hashes_to_calculate.crc32 || hashes_to_calculate.md5 ||
                              hashes_to_calculate.sha1),
+      m_jobs(jobs != 0 ? jobs : std::max<size_t>(std::thread::hardware_concurrency(), 1)),
       m_max_progress(volume.GetDataSize()), m_data_size_type(volume.GetDataSizeType())
 {
   if (!m_calculating_any_hash)
@@ -1090,33 +1093,92 @@ void VolumeVerifier::WaitForAsyncOperations() const
     m_sha1_future.wait();
   if (m_content_future.valid())
     m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  for (const std::future<GroupResult>& future : m_group_futures)
+    future.wait();
 }
 
 bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  auto data = std::make_shared<std::vector<u8>>(bytes_to_read);
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
-  if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
+  if (bytes_to_copy > 0 && m_data)
+    std::memcpy(data->data(), m_data->data() + m_data->size() - m_excess_bytes, bytes_to_copy);
   bytes_to_read -= bytes_to_copy;
 
   if (bytes_to_read > 0)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
+    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data->data() + bytes_to_copy,
                        PARTITION_NONE))
     {
       return false;
     }
   }
 
-  WaitForAsyncOperations();
+  // The hashes must be updated in order, so the previous chunk has to be hashed before the next
+  // one can be. Group checks hold on to their own data and are allowed to lag behind.
+  if (m_crc32_future.valid())
+    m_crc32_future.wait();
+  if (m_md5_future.valid())
+    m_md5_future.wait();
+  if (m_sha1_future.valid())
+    m_sha1_future.wait();
+  if (m_content_future.valid())
+    m_content_future.wait();
+
   m_data = std::move(data);
   return true;
 }
 
+VolumeVerifier::GroupResult
+VolumeVerifier::CheckGroup(size_t group_index, bool read_failed,
+                           std::shared_ptr<const std::vector<u8>> data) const
+{
+  const GroupToVerify& group = m_groups[group_index];
+  GroupResult result{group.partition};
+
+  u64 offset_in_group = 0;
+  for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
+       ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+  {
+    const u64 block_offset = group.offset + offset_in_group;
+
+    if (!read_failed &&
+        m_volume.CheckBlockIntegrity(block_index, data->data() + offset_in_group, group.partition))
+    {
+      result.biggest_verified_offset = block_offset + VolumeWii::BLOCK_TOTAL_SIZE;
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        result.unused_block_errors++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        result.block_errors++;
+      }
+    }
+  }
+
+  return result;
+}
+
+void VolumeVerifier::FinishGroupChecks(size_t max_groups_in_flight)
+{
+  while (m_group_futures.size() > max_groups_in_flight)
+  {
+    const GroupResult result = m_group_futures.front().get();
+    m_group_futures.pop_front();
+
+    m_biggest_verified_offset = std::max(m_biggest_verified_offset, result.biggest_verified_offset);
+    m_block_errors[result.partition] += result.block_errors;
+    m_unused_block_errors[result.partition] += result.unused_block_errors;
+  }
+}
+
 void VolumeVerifier::Process()
 {
   ASSERT(m_started);
@@ -1201,75 +1263,55 @@ void VolumeVerifier::Process()
   m_excess_bytes = excess_bytes;
   const u64 byte_increment = bytes_to_read - excess_bytes;
 
+  Common::TaskScheduler& scheduler = Common::TaskScheduler::GetInstance();
+
   if (m_calculating_any_hash)
   {
     if (m_hashes_to_calculate.crc32)
     {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
+      m_crc32_future = scheduler.Submit(Common::TaskPriority::Normal, [this, byte_increment] {
+        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data->data(),
                                               static_cast<size_t>(byte_increment));
       });
     }
 
     if (m_hashes_to_calculate.md5)
     {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
+      m_md5_future = scheduler.Submit(Common::TaskPriority::Normal, [this, byte_increment] {
+        mbedtls_md5_update_ret(&m_md5_context, m_data->data(), byte_increment);
       });
     }
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
+      m_sha1_future = scheduler.Submit(Common::TaskPriority::Normal, [this, byte_increment] {
+        m_sha1_context->Update(m_data->data(), byte_increment);
       });
     }
   }
 
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
-      {
-        AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
-      }
-    });
+    m_content_future =
+        scheduler.Submit(Common::TaskPriority::Normal, [this, read_failed, content] {
+          if (read_failed || !m_volume.CheckContentIntegrity(content, *m_data, m_ticket))
+          {
+            AddProblem(Severity::High,
+                       Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
+          }
+        });
 
     m_content_index++;
   }
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
-    });
+    FinishGroupChecks(m_jobs - 1);
+    m_group_futures.emplace_back(scheduler.Submit(
+        Common::TaskPriority::Normal,
+        [this, group_index = m_group_index, read_failed, data = m_data] {
+          return CheckGroup(group_index, read_failed, data);
+        }));
 
     m_group_index++;
   }
@@ -1293,6 +1335,7 @@ void VolumeVerifier::Finish()
     return;
   m_done = true;
 
+  FinishGroupChecks(0);
   WaitForAsyncOperations();
 
   if (m_calculating_any_hash)
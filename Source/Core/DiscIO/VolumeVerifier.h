@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deque>
 #include <future>
 #include <map>
 #include <memory>
@@ -124,7 +125,10 @@ public:
     RedumpVerifier::Result redump;
   };
 
-  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
+  // jobs is the maximum number of groups of Wii blocks that are decrypted and hash checked at the
+  // same time. 0 means one per hardware thread.
+  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate,
+                 size_t jobs = 0);
   ~VolumeVerifier();
 
   static Hashes<bool> GetDefaultHashesToCalculate();
@@ -144,6 +148,14 @@ private:
     size_t block_index_end;
   };
 
+  struct GroupResult
+  {
+    Partition partition;
+    u64 biggest_verified_offset = 0;
+    size_t block_errors = 0;
+    size_t unused_block_errors = 0;
+  };
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -158,6 +170,9 @@ private:
   void SetUpHashing();
   void WaitForAsyncOperations() const;
   bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  GroupResult CheckGroup(size_t group_index, bool read_failed,
+                         std::shared_ptr<const std::vector<u8>> data) const;
+  void FinishGroupChecks(size_t max_groups_in_flight);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -179,12 +194,16 @@ private:
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
+  // Shared with the async operations, so that groups can still be checked after the next chunk
+  // has been read.
+  std::shared_ptr<const std::vector<u8>> m_data;
   std::future<void> m_crc32_future;
   std::future<void> m_md5_future;
   std::future<void> m_sha1_future;
   std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  // In the order of m_groups. At most m_jobs are in flight at once.
+  std::deque<std::future<GroupResult>> m_group_futures;
+  size_t m_jobs;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
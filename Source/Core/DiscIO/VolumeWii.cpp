@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -35,6 +36,9 @@
 
 namespace DiscIO
 {
+// The smallest number of blocks that's worth giving a thread of its own when decrypting.
+static constexpr u64 BLOCKS_PER_DECRYPTION_THREAD = 16;
+
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
     : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE),
       m_last_decrypted_block(UINT64_MAX)
@@ -186,14 +190,11 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   }
 
   Common::AES::Context* aes_context = nullptr;
-  std::unique_ptr<u8[]> read_buffer = nullptr;
   if (m_has_encryption)
   {
     aes_context = partition_details.key->get();
     if (!aes_context)
       return false;
-
-    read_buffer = std::make_unique<u8[]>(BLOCK_TOTAL_SIZE);
   }
 
   while (length > 0)
@@ -201,17 +202,60 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
     // Calculate offsets
     u64 block_offset_on_disc = partition_data_offset + offset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
+    const u64 blocks_left = (data_offset_in_block + length + BLOCK_DATA_SIZE - 1) / BLOCK_DATA_SIZE;
+
+    if (m_last_decrypted_block != block_offset_on_disc && blocks_left > 1)
+    {
+      // Read all the remaining blocks at once, so that they can be decrypted in parallel.
+      // The last one is kept around, since the next read likely continues from it.
+      const u64 read_size = blocks_left * BLOCK_TOTAL_SIZE;
+      const u8* blocks = nullptr;
+      std::vector<u8> read_buffer;
+      if (const std::span<const u8> view = m_reader->GetView(block_offset_on_disc, read_size);
+          !view.empty())
+      {
+        blocks = view.data();
+      }
+      else
+      {
+        read_buffer.resize(read_size);
+        if (!m_reader->Read(block_offset_on_disc, read_size, read_buffer.data()))
+          return false;
+        blocks = read_buffer.data();
+      }
+
+      std::vector<u8> decrypted(blocks_left * BLOCK_DATA_SIZE);
+      if (m_has_encryption)
+      {
+        DecryptBlocks(blocks, decrypted.data(), blocks_left, aes_context);
+      }
+      else
+      {
+        for (u64 i = 0; i < blocks_left; ++i)
+        {
+          std::memcpy(&decrypted[i * BLOCK_DATA_SIZE],
+                      &blocks[i * BLOCK_TOTAL_SIZE + BLOCK_HEADER_SIZE], BLOCK_DATA_SIZE);
+        }
+      }
+
+      std::memcpy(buffer, &decrypted[data_offset_in_block], static_cast<size_t>(length));
+      std::memcpy(m_last_decrypted_block_data, &decrypted[(blocks_left - 1) * BLOCK_DATA_SIZE],
+                  BLOCK_DATA_SIZE);
+      m_last_decrypted_block = block_offset_on_disc + (blocks_left - 1) * BLOCK_TOTAL_SIZE;
+      return true;
+    }
 
     if (m_last_decrypted_block != block_offset_on_disc)
     {
       if (m_has_encryption)
       {
         // Read the current block
-        if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.get()))
+        u8 read_buffer[BLOCK_TOTAL_SIZE];
+        if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer))
           return false;
 
         // Decrypt the block's data
-        DecryptBlockData(read_buffer.get(), m_last_decrypted_block_data, aes_context);
+        DecryptBlockData(read_buffer, m_last_decrypted_block_data, aes_context);
       }
       else
       {
@@ -653,4 +697,37 @@ void VolumeWii::DecryptBlockData(const u8* in, u8* out, Common::AES::Context* ae
   aes_context->Crypt(&in[0x3d0], &in[sizeof(HashBlock)], out, BLOCK_DATA_SIZE);
 }
 
+void VolumeWii::DecryptBlocks(const u8* in, u8* out, u64 num_blocks,
+                              Common::AES::Context* aes_context)
+{
+  // Every block is its own CBC chain, so blocks can be decrypted independently. Starting threads
+  // only pays off once there's a fair amount of data.
+  const u64 threads =
+      std::min<u64>(num_blocks / BLOCKS_PER_DECRYPTION_THREAD,
+                    std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+  const auto decrypt = [&](u64 start, u64 end) {
+    for (u64 i = start; i < end; ++i)
+      DecryptBlockData(&in[i * BLOCK_TOTAL_SIZE], &out[i * BLOCK_DATA_SIZE], aes_context);
+  };
+
+  if (threads <= 1)
+  {
+    decrypt(0, num_blocks);
+    return;
+  }
+
+  // The calling thread takes the first range itself.
+  std::vector<std::future<void>> decryption_futures(threads - 1);
+  for (u64 i = 1; i < threads; ++i)
+  {
+    decryption_futures[i - 1] = std::async(std::launch::async, decrypt, i * num_blocks / threads,
+                                           (i + 1) * num_blocks / threads);
+  }
+  decrypt(0, num_blocks / threads);
+
+  for (std::future<void>& future : decryption_futures)
+    future.get();
+}
+
 }  // namespace DiscIO
@@ -108,6 +108,10 @@ public:
 
   static void DecryptBlockHashes(const u8* in, HashBlock* out, Common::AES::Context* aes_context);
   static void DecryptBlockData(const u8* in, u8* out, Common::AES::Context* aes_context);
+  // Decrypts the data of consecutive blocks, using multiple threads for large amounts of data.
+  // The decrypted data is written contiguously, without the hash blocks.
+  static void DecryptBlocks(const u8* in, u8* out, u64 num_blocks,
+                            Common::AES::Context* aes_context);
 
 protected:
   u32 GetOffsetShift() const override { return 2; }
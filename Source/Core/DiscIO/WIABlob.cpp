@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -77,6 +78,27 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
   }
 }
 
+// Decompressed chunks are kept around until they take up more memory than this.
+static constexpr size_t CHUNK_CACHE_SIZE_MB = 64;
+static constexpr size_t MAX_PREFETCH_THREADS = 4;
+
+// Zstandard dictionaries are built from the start of files, since files of the same type tend to
+// share headers and tables that a compressor working on small chunks otherwise can't see twice.
+static constexpr size_t ZSTD_DICTIONARY_SAMPLE_SIZE = 0x400;
+static constexpr size_t ZSTD_DICTIONARY_MAX_SIZE = 0x1C000;
+static constexpr size_t ZSTD_DICTIONARY_MIN_SIZE = 0x2000;
+
+static void GetFileExtents(const FileInfo& directory, std::vector<std::pair<u64, u32>>* files)
+{
+  for (const FileInfo& file_info : directory)
+  {
+    if (file_info.IsDirectory())
+      GetFileExtents(file_info, files);
+    else if (file_info.GetSize() != 0)
+      files->emplace_back(file_info.GetOffset(), file_info.GetSize());
+  }
+}
+
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
     : m_file(std::move(file)), m_path(path), m_encryption_cache(this)
@@ -85,7 +107,11 @@ WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& pa
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  // The prefetch threads use the rest of the reader, so they have to finish first.
+  m_prefetcher.reset();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -158,6 +184,18 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  if (RVZ && file_version_compatible >= RVZ_VERSION_ZSTD_DICTIONARY &&
+      header_2_size > sizeof(WIAHeader2))
+  {
+    if (m_compression_type != WIARVZCompressionType::Zstd)
+      return false;
+
+    m_zstd_dictionary.reset(ZSTD_createDDict(header_2.data() + sizeof(WIAHeader2),
+                                             header_2_size - sizeof(WIAHeader2)));
+    if (!m_zstd_dictionary)
+      return false;
+  }
+
   const size_t number_of_partition_entries = Common::swap32(m_header_2.number_of_partition_entries);
   const size_t partition_entry_size = Common::swap32(m_header_2.partition_entry_size);
   std::vector<u8> partition_entries(partition_entry_size * number_of_partition_entries);
@@ -500,6 +538,7 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   data_offset -= skipped_data;
   data_size += skipped_data;
 
+  const u64 full_chunk_size = chunk_size;
   const u64 start_group_index = (*offset - data_offset) / chunk_size;
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
@@ -514,35 +553,20 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
+    const ChunkParameters parameters =
+        GetGroupChunkParameters(group, chunk_size, exception_lists, group_offset_in_data);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
-
-    if (group_data_size == 0)
+    if (parameters.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(parameters);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        EvictCachedChunk(parameters.offset_in_file);
         return false;
       }
 
@@ -555,6 +579,14 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
         chunk.GetHashExceptions(&m_exception_list, exception_list_index, additional_offset);
         m_exception_list_last_group_index = total_group_index;
       }
+
+      // Once the groups are being read in order, decompress the next ones ahead of time.
+      if (total_group_index == m_last_group_index + 1)
+      {
+        PrefetchGroups(full_chunk_size, data_offset, data_size, group_index, number_of_groups,
+                       exception_lists, i + 1);
+      }
+      m_last_group_index = total_group_index;
     }
 
     *offset += bytes_to_read;
@@ -565,6 +597,36 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::ChunkParameters
+WIARVZFileReader<RVZ>::GetGroupChunkParameters(const GroupEntry& group, u64 chunk_size,
+                                               u32 exception_lists, u64 group_offset_in_data) const
+{
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  ChunkParameters parameters;
+  parameters.offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  parameters.compressed_size = group_data_size;
+  parameters.decompressed_size = chunk_size;
+  parameters.compression_type = compression_type;
+  parameters.exception_lists = exception_lists;
+  parameters.rvz_packed_size = rvz_packed_size;
+  parameters.data_offset = group_offset_in_data;
+  return parameters;
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -572,11 +634,168 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  return ReadCompressedData({offset_in_file, compressed_size, decompressed_size, compression_type,
+                             exception_lists, rvz_packed_size, data_offset});
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk&
+WIARVZFileReader<RVZ>::ReadCompressedData(const ChunkParameters& parameters)
+{
+  const auto it =
+      std::find_if(m_cached_chunks.begin(), m_cached_chunks.end(), [&](const CachedChunk& c) {
+        return c.offset_in_file == parameters.offset_in_file;
+      });
+  if (it != m_cached_chunks.end())
+  {
+    m_cached_chunks.splice(m_cached_chunks.begin(), m_cached_chunks, it);
+    return it->chunk;
+  }
+
+  if (std::unique_ptr<Chunk> prefetched = TakePrefetchedChunk(parameters.offset_in_file))
+  {
+    prefetched->SetFile(&m_file);
+    m_cached_chunks.push_front({parameters.offset_in_file, std::move(*prefetched)});
+  }
+  else
+  {
+    m_cached_chunks.push_front({parameters.offset_in_file, CreateChunk(&m_file, parameters)});
+  }
+  m_cached_chunks_size += m_cached_chunks.front().chunk.GetMemoryUsage();
+
+  // The chunk that was just added is never evicted, even if it alone is over the limit.
+  while (m_cached_chunks_size > CHUNK_CACHE_SIZE_MB * 1024 * 1024 && m_cached_chunks.size() > 1)
+  {
+    m_cached_chunks_size -= m_cached_chunks.back().chunk.GetMemoryUsage();
+    m_cached_chunks.pop_back();
+  }
+
+  return m_cached_chunks.front().chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::EvictCachedChunk(u64 offset_in_file)
+{
+  const auto it =
+      std::find_if(m_cached_chunks.begin(), m_cached_chunks.end(),
+                   [&](const CachedChunk& c) { return c.offset_in_file == offset_in_file; });
+  if (it == m_cached_chunks.end())
+    return;
+
+  m_cached_chunks_size -= it->chunk.GetMemoryUsage();
+  m_cached_chunks.erase(it);
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchGroups(u64 chunk_size, u64 data_offset, u64 data_size,
+                                           u32 group_index, u32 number_of_groups,
+                                           u32 exception_lists, u64 next_group)
+{
+  // Groups without compression are cheap enough to read when they're needed.
+  if (m_compression_type <= WIARVZCompressionType::Purge)
+    return;
+
+  if (!m_prefetcher)
+  {
+    const size_t threads =
+        std::min<size_t>(MAX_PREFETCH_THREADS, std::thread::hardware_concurrency());
+    m_prefetcher = std::make_unique<Prefetcher>(
+        [this](PrefetchThreadState* state) {
+          // A duplicated file descriptor would share its position with m_file. If opening fails,
+          // the prefetched chunks fail to read and get read again when they're needed instead.
+          state->file.Open(m_path, "rb");
+          return ConversionResultCode::Success;
+        },
+        [this](PrefetchThreadState* state,
+               ChunkParameters parameters) -> ConversionResult<PrefetchResult> {
+          auto chunk = std::make_unique<Chunk>(CreateChunk(&state->file, parameters));
+          if (!chunk->ReadAll())
+            chunk.reset();
+          return PrefetchResult{parameters.offset_in_file, std::move(chunk)};
+        },
+        [this](PrefetchResult result) {
+          {
+            std::lock_guard lk(m_prefetched_chunks_mutex);
+            m_prefetched_chunks[result.offset_in_file] = std::move(result.chunk);
+          }
+          m_prefetched_chunks_cv.notify_all();
+          return ConversionResultCode::Success;
+        },
+        threads);
+  }
+
+  const size_t prefetch_count = m_prefetcher->GetThreadCount();
+  std::set<u64> window;
+  for (u64 i = next_group; i < number_of_groups && window.size() < prefetch_count; ++i)
+  {
+    const u64 total_group_index = group_index + i;
+    if (total_group_index >= m_group_entries.size())
+      break;
+
+    const u64 group_offset_in_data = i * chunk_size;
+    const ChunkParameters parameters =
+        GetGroupChunkParameters(m_group_entries[total_group_index],
+                                std::min(chunk_size, data_size - group_offset_in_data),
+                                exception_lists, group_offset_in_data);
+    window.insert(parameters.offset_in_file);
+
+    if (parameters.compressed_size == 0 || m_pending_prefetches.contains(parameters.offset_in_file))
+      continue;
+
+    const bool cached =
+        std::any_of(m_cached_chunks.begin(), m_cached_chunks.end(), [&](const CachedChunk& c) {
+          return c.offset_in_file == parameters.offset_in_file;
+        });
+    // Keep the number of chunks in flight bounded, so a pattern which stops being sequential
+    // doesn't pile up work.
+    if (cached || m_pending_prefetches.size() >= prefetch_count)
+      continue;
+
+    m_pending_prefetches.insert(parameters.offset_in_file);
+    m_prefetcher->CompressAndWrite(parameters);
+  }
+
+  // Drop finished chunks which the game has moved past without reading.
+  std::lock_guard lk(m_prefetched_chunks_mutex);
+  for (auto it = m_prefetched_chunks.begin(); it != m_prefetched_chunks.end();)
+  {
+    if (window.contains(it->first))
+    {
+      ++it;
+      continue;
+    }
+
+    m_pending_prefetches.erase(it->first);
+    it = m_prefetched_chunks.erase(it);
+  }
+}
+
+template <bool RVZ>
+std::unique_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::TakePrefetchedChunk(u64 offset_in_file)
+{
+  if (!m_pending_prefetches.erase(offset_in_file))
+    return nullptr;
+
+  // The chunk is already being decompressed, so waiting for it is faster than starting over.
+  std::unique_lock lk(m_prefetched_chunks_mutex);
+  m_prefetched_chunks_cv.wait(lk, [&] { return m_prefetched_chunks.contains(offset_in_file); });
+
+  const auto it = m_prefetched_chunks.find(offset_in_file);
+  std::unique_ptr<Chunk> chunk = std::move(it->second);
+  m_prefetched_chunks.erase(it);
+  return chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const
+{
+  const u64 decompressed_size = parameters.decompressed_size;
+  const u32 rvz_packed_size = parameters.rvz_packed_size;
 
   std::unique_ptr<Decompressor> decompressor;
-  switch (compression_type)
+  switch (parameters.compression_type)
   {
   case WIARVZCompressionType::None:
     decompressor = std::make_unique<NoneDecompressor>();
@@ -597,17 +816,16 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                                       m_header_2.compressor_data_size);
     break;
   case WIARVZCompressionType::Zstd:
-    decompressor = std::make_unique<ZstdDecompressor>();
+    decompressor = std::make_unique<ZstdDecompressor>(m_zstd_dictionary.get());
     break;
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  const bool compressed_exception_lists =
+      parameters.compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, parameters.offset_in_file, parameters.compressed_size, decompressed_size,
+               parameters.exception_lists, compressed_exception_lists, rvz_packed_size,
+               parameters.data_offset, std::move(decompressor));
 }
 
 template <bool RVZ>
@@ -757,6 +975,17 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
   return true;
 }
 
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::ReadAll()
+{
+  const u64 size = m_out.data.size() - m_out_bytes_allocated_for_exceptions;
+  if (size == 0)
+    return true;
+
+  u8 last_byte;
+  return Read(size - 1, 1, &last_byte);
+}
+
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Decompress()
 {
@@ -1061,7 +1290,8 @@ std::optional<std::vector<u8>> WIARVZFileReader<RVZ>::Compress(Compressor* compr
 template <bool RVZ>
 void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                                             WIARVZCompressionType compression_type,
-                                            int compression_level, WIAHeader2* header_2)
+                                            int compression_level, WIAHeader2* header_2,
+                                            std::span<const u8> zstd_dictionary)
 {
   switch (compression_type)
   {
@@ -1092,11 +1322,48 @@ void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compres
     break;
   }
   case WIARVZCompressionType::Zstd:
-    *compressor = std::make_unique<ZstdCompressor>(compression_level);
+    *compressor = std::make_unique<ZstdCompressor>(compression_level, zstd_dictionary);
     break;
   }
 }
 
+template <bool RVZ>
+std::vector<u8> WIARVZFileReader<RVZ>::CreateZstdDictionary(const VolumeDisc* volume)
+{
+  if (!volume)
+    return {};
+
+  const Partition partition = volume->GetGamePartition();
+  const FileSystem* file_system = volume->GetFileSystem(partition);
+  if (!file_system)
+    return {};
+
+  std::vector<std::pair<u64, u32>> files;
+  GetFileExtents(file_system->GetRoot(), &files);
+
+  // Spread the samples evenly over the files if there are too many to sample all of them
+  const size_t max_samples = ZSTD_DICTIONARY_MAX_SIZE / ZSTD_DICTIONARY_SAMPLE_SIZE;
+  const size_t samples = std::min(files.size(), max_samples);
+  std::vector<u8> dictionary;
+  dictionary.reserve(samples * ZSTD_DICTIONARY_SAMPLE_SIZE);
+  for (size_t i = 0; i < samples; ++i)
+  {
+    const auto& [offset, size] = files[i * files.size() / samples];
+    const size_t sample_size = std::min<size_t>(size, ZSTD_DICTIONARY_SAMPLE_SIZE);
+
+    const size_t old_size = dictionary.size();
+    dictionary.resize(old_size + sample_size);
+    if (!volume->Read(offset, sample_size, dictionary.data() + old_size, partition))
+      dictionary.resize(old_size);
+  }
+
+  // A tiny dictionary isn't worth making the file unreadable for older versions
+  if (dictionary.size() < ZSTD_DICTIONARY_MIN_SIZE)
+    return {};
+
+  return dictionary;
+}
+
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::TryReuse(std::map<ReuseID, GroupEntry>* reusable_groups,
                                      std::mutex* reusable_groups_mutex,
@@ -1735,7 +2002,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               size_t threads, bool zstd_dictionary)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1771,6 +2039,10 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   group_entries.resize(total_groups);
 
+  std::vector<u8> dictionary;
+  if (RVZ && zstd_dictionary && compression_type == WIARVZCompressionType::Zstd)
+    dictionary = CreateZstdDictionary(infile_volume);
+
   const size_t partition_entries_size = partition_entries.size() * sizeof(PartitionEntry);
   const size_t raw_data_entries_size = raw_data_entries.size() * sizeof(RawDataEntry);
   const size_t group_entries_size = group_entries.size() * sizeof(GroupEntry);
@@ -1780,8 +2052,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   // fit in that space, we will need to write them at the end of the file instead.
   const u64 headers_size_upper_bound = [&] {
     // 0x100 is added to account for compression overhead (in particular for Purge).
-    u64 upper_bound = sizeof(WIAHeader1) + sizeof(WIAHeader2) + partition_entries_size +
-                      raw_data_entries_size + 0x100;
+    u64 upper_bound = sizeof(WIAHeader1) + sizeof(WIAHeader2) + dictionary.size() +
+                      partition_entries_size + raw_data_entries_size + 0x100;
 
     // Compared to WIA, RVZ adds an extra member to the GroupEntry struct. This added data usually
     // compresses well, so we'll assume the compression ratio for RVZ GroupEntries is 9 / 16 or
@@ -1811,7 +2083,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   std::mutex reusable_groups_mutex;
 
   const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
-    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr);
+    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr, dictionary);
     return ConversionResultCode::Success;
   };
 
@@ -1842,7 +2114,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, threads);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -1940,7 +2212,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
     return status;
 
   std::unique_ptr<Compressor> compressor;
-  SetUpCompressor(&compressor, compression_type, compression_level, &header_2);
+  SetUpCompressor(&compressor, compression_type, compression_level, &header_2, dictionary);
 
   const std::optional<std::vector<u8>> compressed_raw_data_entries = Compress(
       compressor.get(), reinterpret_cast<u8*>(raw_data_entries.data()), raw_data_entries_size);
@@ -1952,8 +2224,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   if (!compressed_group_entries)
     return ConversionResultCode::InternalError;
 
-  bytes_written = sizeof(WIAHeader1) + sizeof(WIAHeader2);
-  if (!outfile->Seek(sizeof(WIAHeader1) + sizeof(WIAHeader2), File::SeekOrigin::Begin))
+  bytes_written = sizeof(WIAHeader1) + sizeof(WIAHeader2) + dictionary.size();
+  if (!outfile->Seek(bytes_written, File::SeekOrigin::Begin))
     return ConversionResultCode::WriteFailed;
 
   u64 partition_entries_offset;
@@ -2010,11 +2282,23 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   header_1.magic = RVZ ? RVZ_MAGIC : WIA_MAGIC;
   header_1.version = Common::swap32(RVZ ? RVZ_VERSION : WIA_VERSION);
-  header_1.version_compatible =
-      Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
-  header_1.header_2_size = Common::swap32(sizeof(WIAHeader2));
-  header_1.header_2_hash =
-      Common::SHA1::CalculateDigest(reinterpret_cast<const u8*>(&header_2), sizeof(header_2));
+  if (!dictionary.empty())
+  {
+    header_1.version_compatible = Common::swap32(RVZ_VERSION_ZSTD_DICTIONARY);
+  }
+  else
+  {
+    header_1.version_compatible =
+        Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
+  }
+
+  // The dictionary is stored right after header 2 and is counted as part of it
+  std::vector<u8> header_2_data(sizeof(WIAHeader2));
+  std::memcpy(header_2_data.data(), &header_2, sizeof(WIAHeader2));
+  header_2_data.insert(header_2_data.end(), dictionary.begin(), dictionary.end());
+
+  header_1.header_2_size = Common::swap32(static_cast<u32>(header_2_data.size()));
+  header_1.header_2_hash = Common::SHA1::CalculateDigest(header_2_data);
   header_1.iso_file_size = Common::swap64(infile->GetDataSize());
   header_1.wia_file_size = Common::swap64(outfile->GetSize());
   header_1.header_1_hash = Common::SHA1::CalculateDigest(reinterpret_cast<const u8*>(&header_1),
@@ -2025,7 +2309,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   if (!outfile->WriteArray(&header_1, 1))
     return ConversionResultCode::WriteFailed;
-  if (!outfile->WriteArray(&header_2, 1))
+  if (!outfile->WriteBytes(header_2_data.data(), header_2_data.size()))
     return ConversionResultCode::WriteFailed;
 
   return ConversionResultCode::Success;
@@ -2034,7 +2318,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, CompressCB callback, size_t threads,
+                       bool zstd_dictionary)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2052,7 +2337,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, threads, zstd_dictionary);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
@@ -4,10 +4,14 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -69,7 +73,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      size_t threads, bool zstd_dictionary);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -193,6 +198,11 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    bool ReadAll();
+
+    // Used when a chunk which was decompressed using another file handle is handed over.
+    void SetFile(File::IOFile* file) { m_file = file; }
+    size_t GetMemoryUsage() const { return m_in.data.size() + m_out.data.size(); }
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -228,6 +238,38 @@ private:
     u64 m_data_offset = 0;
   };
 
+  struct ChunkParameters
+  {
+    u64 offset_in_file = 0;
+    u64 compressed_size = 0;
+    u64 decompressed_size = 0;
+    WIARVZCompressionType compression_type = WIARVZCompressionType::None;
+    u32 exception_lists = 0;
+    u32 rvz_packed_size = 0;
+    u64 data_offset = 0;
+  };
+
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    Chunk chunk;
+  };
+
+  struct PrefetchThreadState
+  {
+    File::IOFile file;
+  };
+
+  struct PrefetchResult
+  {
+    u64 offset_in_file = 0;
+    // nullptr if decompressing failed, in which case the chunk is read again when it's needed so
+    // that the error is handled like for any other read.
+    std::unique_ptr<Chunk> chunk;
+  };
+
+  using Prefetcher = MultithreadedCompressor<PrefetchThreadState, ChunkParameters, PrefetchResult>;
+
   explicit WIARVZFileReader(File::IOFile file, const std::string& path);
   bool Initialize(const std::string& path);
   bool HasDataOverlap() const;
@@ -237,9 +279,19 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  ChunkParameters GetGroupChunkParameters(const GroupEntry& group, u64 chunk_size,
+                                          u32 exception_lists, u64 group_offset_in_data) const;
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk& ReadCompressedData(const ChunkParameters& parameters);
+  Chunk CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const;
+  void EvictCachedChunk(u64 offset_in_file);
+
+  // Decompresses the groups after the given one on the prefetch threads.
+  void PrefetchGroups(u64 chunk_size, u64 data_offset, u64 data_size, u32 group_index,
+                      u32 number_of_groups, u32 exception_lists, u64 next_group);
+  std::unique_ptr<Chunk> TakePrefetchedChunk(u64 offset_in_file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -343,7 +395,8 @@ private:
 
   static void SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                               WIARVZCompressionType compression_type, int compression_level,
-                              WIAHeader2* header_2);
+                              WIAHeader2* header_2, std::span<const u8> zstd_dictionary);
+  static std::vector<u8> CreateZstdDictionary(const VolumeDisc* volume);
   static bool TryReuse(std::map<ReuseID, GroupEntry>* reusable_groups,
                        std::mutex* reusable_groups_mutex, OutputParametersEntry* entry);
   static ConversionResult<OutputParameters>
@@ -364,11 +417,25 @@ private:
 
   bool m_valid;
   WIARVZCompressionType m_compression_type;
+  // Used for all Zstandard data in the file, if the file has a dictionary.
+  std::unique_ptr<ZSTD_DDict, ZstdDDictDeleter> m_zstd_dictionary;
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  // Decompressed chunks, most recently used first.
+  std::list<CachedChunk> m_cached_chunks;
+  size_t m_cached_chunks_size = 0;
+
+  // Written by the prefetcher's output thread.
+  std::mutex m_prefetched_chunks_mutex;
+  std::condition_variable m_prefetched_chunks_cv;
+  std::map<u64, std::unique_ptr<Chunk>> m_prefetched_chunks;
+  // Chunks which have been handed to the prefetcher but not yet taken by TakePrefetchedChunk.
+  std::set<u64> m_pending_prefetches;
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+  // Created when the reader is first read from sequentially, so readers which are only used for
+  // reading metadata don't start any threads. Shut down first in the destructor.
+  std::unique_ptr<Prefetcher> m_prefetcher;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -391,9 +458,11 @@ private:
   static constexpr u32 WIA_VERSION_WRITE_COMPATIBLE = 0x01000000;
   static constexpr u32 WIA_VERSION_READ_COMPATIBLE = 0x00080000;
 
-  static constexpr u32 RVZ_VERSION = 0x01000000;
+  static constexpr u32 RVZ_VERSION = 0x01010000;
   static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE = 0x00030000;
   static constexpr u32 RVZ_VERSION_READ_COMPATIBLE = 0x00030000;
+  // Files which store a Zstandard dictionary after header 2 can't be read by older versions.
+  static constexpr u32 RVZ_VERSION_ZSTD_DICTIONARY = 0x01010000;
 };
 
 using WIAFileReader = WIARVZFileReader<false>;
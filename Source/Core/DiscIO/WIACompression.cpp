@@ -256,9 +256,15 @@ bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
   return result == LZMA_OK || result == LZMA_STREAM_END;
 }
 
-ZstdDecompressor::ZstdDecompressor()
+ZstdDecompressor::ZstdDecompressor(const ZSTD_DDict* dictionary)
 {
   m_stream = ZSTD_createDStream();
+
+  if (m_stream && dictionary && ZSTD_isError(ZSTD_DCtx_refDDict(m_stream, dictionary)))
+  {
+    ZSTD_freeDStream(m_stream);
+    m_stream = nullptr;
+  }
 }
 
 ZstdDecompressor::~ZstdDecompressor()
@@ -733,12 +739,15 @@ size_t LZMACompressor::GetSize() const
   return static_cast<size_t>(m_stream.next_out - m_buffer.data());
 }
 
-ZstdCompressor::ZstdCompressor(int compression_level)
+ZstdCompressor::ZstdCompressor(int compression_level, std::span<const u8> dictionary)
 {
   m_stream = ZSTD_createCStream();
 
+  // The dictionary is kept when the stream is reset for the next chunk.
   if (ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, compression_level)) ||
-      ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_contentSizeFlag, 0)))
+      ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_contentSizeFlag, 0)) ||
+      (!dictionary.empty() &&
+       ZSTD_isError(ZSTD_CCtx_loadDictionary(m_stream, dictionary.data(), dictionary.size()))))
   {
     m_stream = nullptr;
   }
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <bzlib.h>
@@ -102,10 +103,16 @@ private:
   bool m_error_occurred = false;
 };
 
+struct ZstdDDictDeleter
+{
+  void operator()(ZSTD_DDict* dictionary) const { ZSTD_freeDDict(dictionary); }
+};
+
 class ZstdDecompressor final : public Decompressor
 {
 public:
-  ZstdDecompressor();
+  // The dictionary must outlive the decompressor.
+  explicit ZstdDecompressor(const ZSTD_DDict* dictionary = nullptr);
   ~ZstdDecompressor();
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
@@ -228,7 +235,7 @@ private:
 class ZstdCompressor final : public Compressor
 {
 public:
-  ZstdCompressor(int compression_level);
+  ZstdCompressor(int compression_level, std::span<const u8> dictionary = {});
   ~ZstdCompressor();
 
   bool Start(std::optional<u64> size) override;
@@ -3,6 +3,7 @@
 
 #include "DiscIO/WiiEncryptionCache.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <limits>
@@ -29,8 +30,9 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
   // Only allocate memory if this function actually ends up getting called
   if (!m_cache)
   {
-    m_cache = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
-    m_cached_offset = std::numeric_limits<u64>::max();
+    m_cache = std::make_unique<
+        std::array<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>, CACHED_GROUPS>>();
+    m_cached_groups.fill({});
   }
 
   ASSERT(offset % VolumeWii::GROUP_TOTAL_SIZE == 0);
@@ -38,31 +40,43 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
       offset / VolumeWii::GROUP_TOTAL_SIZE * VolumeWii::GROUP_DATA_SIZE;
   const u64 group_offset_on_disc = partition_data_offset + offset;
 
-  if (m_cached_offset != group_offset_on_disc)
+  // Games often go back and forth between a few files, so more than one group is kept.
+  const auto it =
+      std::find_if(m_cached_groups.begin(), m_cached_groups.end(),
+                   [&](const CachedGroup& g) { return g.offset == group_offset_on_disc; });
+  if (it != m_cached_groups.end())
   {
-    std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
-
-    if (hash_exception_callback)
-    {
-      hash_exception_callback_2 =
-          [offset, &hash_exception_callback](
-              VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
-            return hash_exception_callback(hash_blocks, offset);
-          };
-    }
-
-    if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
-                                 partition_data_decrypted_size, key, m_blob, m_cache.get(),
-                                 hash_exception_callback_2))
-    {
-      m_cached_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
-      return nullptr;
-    }
-
-    m_cached_offset = group_offset_on_disc;
+    it->last_used = ++m_use_counter;
+    return &(*m_cache)[it - m_cached_groups.begin()];
   }
 
-  return m_cache.get();
+  const auto lru = std::min_element(
+      m_cached_groups.begin(), m_cached_groups.end(),
+      [](const CachedGroup& a, const CachedGroup& b) { return a.last_used < b.last_used; });
+  std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>* group = &(*m_cache)[lru - m_cached_groups.begin()];
+
+  std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
+
+  if (hash_exception_callback)
+  {
+    hash_exception_callback_2 =
+        [offset, &hash_exception_callback](
+            VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
+          return hash_exception_callback(hash_blocks, offset);
+        };
+  }
+
+  if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
+                               partition_data_decrypted_size, key, m_blob, group,
+                               hash_exception_callback_2))
+  {
+    *lru = {};  // Invalidate the cache entry
+    return nullptr;
+  }
+
+  lru->offset = group_offset_on_disc;
+  lru->last_used = ++m_use_counter;
+  return group;
 }
 
 bool WiiEncryptionCache::EncryptGroups(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset,
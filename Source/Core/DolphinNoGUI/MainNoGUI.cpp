@@ -4,9 +4,12 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <chrono>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <map>
+#include <optional>
 #include <signal.h>
 #include <string>
 #include <vector>
@@ -17,13 +20,24 @@
 #include <Windows.h>
 #endif
 
+#include <fmt/format.h>
+#include <picojson.h>
+
+#include "Common/Config/Config.h"
+#include "Common/Hash.h"
+#include "Common/HookableEvent.h"
+#include "Common/JsonUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/HW/Memmap.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/System.h"
 
 #include "UICommon/CommandLineParse.h"
@@ -34,10 +48,28 @@
 
 #include "InputCommon/GCAdapter.h"
 
+#include "VideoCommon/FrameTimingRecorder.h"
+#include "VideoCommon/MetricsExporter.h"
 #include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoEvents.h"
 
 static std::unique_ptr<Platform> s_platform;
 
+// Playback state for --verify_movie. The RAM hashes are recorded on the CPU thread, and only
+// accessed from the main thread once the core has shut down.
+struct MovieVerification
+{
+  u64 hash_interval = 0;
+  // Only every render_interval-th frame is rendered.
+  u64 render_interval = 1;
+  // Frame number to RAM hash, at every interval and at the end of playback.
+  std::map<u64, u64> ram_hashes;
+  std::optional<u64> last_frame;
+  Common::EventHook frame_hook;
+};
+
+static MovieVerification s_movie_verification;
+
 static void signal_handler(int)
 {
   const char message[] = "A signal was received. A second signal will force Dolphin to stop.\n";
@@ -156,10 +188,144 @@ std::unique_ptr<GBAHostInterface> Host_CreateGBAHost(std::weak_ptr<HW::GBA::Core
   return nullptr;
 }
 
+// CRC32 is used rather than GetHash64, since the latter depends on the host CPU, and reports
+// should be comparable across machines.
+static u64 HashEmulatedRAM(Core::System& system)
+{
+  auto& memory = system.GetMemory();
+  const u64 mem1_hash = Common::ComputeCRC32(memory.GetRAM(), memory.GetRamSizeReal());
+  const u64 mem2_hash =
+      memory.GetEXRAM() ? Common::ComputeCRC32(memory.GetEXRAM(), memory.GetExRamSizeReal()) : 0;
+  return mem1_hash << 32 | mem2_hash;
+}
+
+static void OnMovieVerificationFrame()
+{
+  if (s_movie_verification.last_frame)
+    return;
+
+  Core::System& system = Core::System::GetInstance();
+  Movie::MovieManager& movie = system.GetMovie();
+  const u64 frame = movie.GetCurrentFrame();
+  if (!movie.IsPlayingInput())
+  {
+    s_movie_verification.ram_hashes[frame] = HashEmulatedRAM(system);
+    s_movie_verification.last_frame = frame;
+    s_platform->Stop();
+    return;
+  }
+
+  if (frame != 0 && frame % s_movie_verification.hash_interval == 0)
+    s_movie_verification.ram_hashes.try_emplace(frame, HashEmulatedRAM(system));
+
+  if (s_movie_verification.render_interval > 1)
+    g_video_backend->Video_SetSkipRendering(frame % s_movie_verification.render_interval != 0);
+}
+
+static std::optional<std::map<u64, u64>> ReadReferenceHashes(const std::string& path)
+{
+  picojson::value root;
+  std::string error;
+  if (!JsonFromFile(path, &root, &error) || !root.is<picojson::object>())
+  {
+    fprintf(stderr, "Failed to read reference report %s: %s\n", path.c_str(), error.c_str());
+    return std::nullopt;
+  }
+
+  const picojson::value& hashes = root.get("ram_hashes");
+  if (!hashes.is<picojson::array>())
+  {
+    fprintf(stderr, "Reference report %s contains no RAM hashes\n", path.c_str());
+    return std::nullopt;
+  }
+
+  std::map<u64, u64> result;
+  for (const picojson::value& entry : hashes.get<picojson::array>())
+  {
+    if (!entry.is<picojson::object>())
+      continue;
+    const auto frame = ReadNumericFromJson<u64>(entry.get<picojson::object>(), "frame");
+    const auto hash = ReadStringFromJson(entry.get<picojson::object>(), "hash");
+    if (frame && hash)
+      result.emplace(*frame, std::stoull(*hash, nullptr, 16));
+  }
+  return result;
+}
+
+// Writes the verification report, and compares it against the reference report if one was
+// given. Returns whether playback finished and matched the reference.
+static bool WriteMovieVerificationReport(const std::string& path,
+                                         const std::optional<std::string>& reference_path)
+{
+  const MovieVerification& verification = s_movie_verification;
+
+  picojson::array hashes;
+  for (const auto& [frame, hash] : verification.ram_hashes)
+  {
+    picojson::object entry;
+    entry["frame"] = picojson::value(static_cast<double>(frame));
+    entry["hash"] = picojson::value(fmt::format("{:016x}", hash));
+    hashes.emplace_back(std::move(entry));
+  }
+
+  picojson::object root;
+  root["completed"] = picojson::value(verification.last_frame.has_value());
+  root["hash_interval"] = picojson::value(static_cast<double>(verification.hash_interval));
+  if (verification.last_frame)
+  {
+    root["frames"] = picojson::value(static_cast<double>(*verification.last_frame));
+    root["final_ram_hash"] = picojson::value(
+        fmt::format("{:016x}", verification.ram_hashes.at(*verification.last_frame)));
+  }
+
+  bool passed = verification.last_frame.has_value();
+  if (reference_path)
+  {
+    const auto reference = ReadReferenceHashes(*reference_path);
+    if (!reference)
+      return false;
+
+    // The first hashed frame at which RAM differs from the reference. Frames only one of the
+    // reports has a hash for are skipped, except that a movie which ends at a different frame
+    // has desynced at the earlier of the two ends.
+    std::optional<u64> desync_frame;
+    for (const auto& [frame, hash] : verification.ram_hashes)
+    {
+      const auto it = reference->find(frame);
+      if (it != reference->end() && it->second != hash)
+      {
+        desync_frame = frame;
+        break;
+      }
+    }
+    if (!desync_frame && verification.last_frame && !reference->empty() &&
+        reference->rbegin()->first != *verification.last_frame)
+    {
+      desync_frame = std::min(reference->rbegin()->first, *verification.last_frame);
+    }
+
+    root["desync_frame"] =
+        desync_frame ? picojson::value(static_cast<double>(*desync_frame)) : picojson::value();
+    passed = passed && !desync_frame;
+  }
+
+  root["ram_hashes"] = picojson::value(std::move(hashes));
+  if (!JsonToFile(path, picojson::value(std::move(root)), true))
+  {
+    fprintf(stderr, "Failed to write movie verification report to %s\n", path.c_str());
+    return false;
+  }
+  return passed;
+}
+
 static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
 {
   std::string platform_name = static_cast<const char*>(options.get("platform"));
 
+  // Benchmarks and movie verification shouldn't be affected by presenting to a window.
+  if (platform_name.empty() && (options.is_set("benchmark") || options.is_set("verify_movie")))
+    platform_name = "headless";
+
 #if HAVE_X11
   if (platform_name == "x11" || platform_name.empty())
     return Platform::CreateX11Platform();
@@ -216,6 +382,45 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--benchmark")
+      .action("store")
+      .metavar("<file>")
+      .help("Play a FIFO log as fast as possible and write per-frame timings to a JSON file");
+  parser->add_option("--benchmark_loops")
+      .action("store")
+      .type("int")
+      .set_default(1)
+      .help("Number of times to play the FIFO log when benchmarking [default: %default]");
+  parser->add_option("--verify_movie")
+      .action("store")
+      .metavar("<file>")
+      .help("Play the movie given with --movie as fast as possible, without video or audio output, "
+            "and write hashes of emulated RAM to a JSON file");
+  parser->add_option("--verify_reference")
+      .action("store")
+      .metavar("<file>")
+      .help("Report written by an earlier --verify_movie run to detect desyncs against");
+  parser->add_option("--verify_hash_interval")
+      .action("store")
+      .type("int")
+      .set_default(60)
+      .help("Number of frames between RAM hashes when verifying a movie [default: %default]");
+  parser->add_option("--verify_render_interval")
+      .action("store")
+      .type("int")
+      .set_default(1)
+      .help("Only render every Nth frame when verifying a movie. Skipped frames see the EFB "
+            "copies, bounding box and perf query results of the last rendered frame, so games "
+            "which read these back may desync [default: %default]");
+  parser->add_option("--metrics")
+      .action("store")
+      .metavar("<file>")
+      .help("Periodically write performance metrics to a file in the Prometheus text format");
+  parser->add_option("--metrics_interval")
+      .action("store")
+      .type("int")
+      .set_default(1000)
+      .help("Milliseconds between metrics updates [default: %default]");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -290,6 +495,84 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  std::optional<std::string> benchmark_path;
+  if (options.is_set("benchmark"))
+  {
+    const int benchmark_loops = options.get("benchmark_loops");
+    if (benchmark_loops < 1)
+    {
+      fprintf(stderr, "The number of benchmark loops must be at least 1.\n");
+      return 1;
+    }
+    benchmark_path = static_cast<const char*>(options.get("benchmark"));
+
+    // Run unthrottled, and stop once the FIFO log has been played the given number of times.
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::GFX_VSYNC, false);
+    Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+    Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_COUNT, static_cast<u32>(benchmark_loops));
+    g_frame_timing_recorder.Start();
+  }
+
+  const bool export_metrics = options.is_set("metrics");
+  if (export_metrics)
+  {
+    const int metrics_interval = options.get("metrics_interval");
+    if (metrics_interval < 1)
+    {
+      fprintf(stderr, "The metrics interval must be at least 1 ms.\n");
+      return 1;
+    }
+    g_metrics_exporter.Start(static_cast<const char*>(options.get("metrics")),
+                             std::chrono::duration_cast<DT>(DT_ms(metrics_interval)));
+  }
+
+  std::optional<std::string> verify_movie_path;
+  std::optional<std::string> verify_reference_path;
+  if (options.is_set("verify_movie"))
+  {
+    const int hash_interval = options.get("verify_hash_interval");
+    const int render_interval = options.get("verify_render_interval");
+    if (!options.is_set("movie") || hash_interval < 1 || render_interval < 1)
+    {
+      fprintf(stderr, "Verifying a movie requires --movie, and hash and render intervals of at "
+                      "least 1.\n");
+      return 1;
+    }
+    verify_movie_path = static_cast<const char*>(options.get("verify_movie"));
+    if (options.is_set("verify_reference"))
+      verify_reference_path = static_cast<const char*>(options.get("verify_reference"));
+
+    // Run unthrottled and discard audio. The video backend still runs, since EFB copies to RAM
+    // affect emulation, but nothing is presented with the headless platform.
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::GFX_VSYNC, false);
+    Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, BACKEND_NULLSOUND);
+    Config::SetCurrent(Config::MAIN_DUMP_AUDIO, false);
+    Config::SetCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, false);
+
+    s_movie_verification.hash_interval = static_cast<u64>(hash_interval);
+    s_movie_verification.render_interval = static_cast<u64>(render_interval);
+    s_movie_verification.frame_hook =
+        VIEndFieldEvent::Register(OnMovieVerificationFrame, "MovieVerification");
+  }
+
+  if (options.is_set("movie"))
+  {
+    const std::string movie_path = static_cast<const char*>(options.get("movie"));
+    std::optional<std::string> movie_save_state_path;
+    if (!Core::System::GetInstance().GetMovie().PlayInput(movie_path, &movie_save_state_path))
+    {
+      fprintf(stderr, "Could not play the movie %s\n", movie_path.c_str());
+      return 1;
+    }
+    if (boot && movie_save_state_path)
+    {
+      boot->boot_session_data.SetSavestateData(std::move(movie_save_state_path),
+                                               DeleteSavestateAfterBoot::No);
+    }
+  }
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -326,6 +609,26 @@ int main(int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (export_metrics)
+    g_metrics_exporter.Stop();
+
+  if (benchmark_path)
+  {
+    g_frame_timing_recorder.Stop();
+    if (!g_frame_timing_recorder.WriteJSON(*benchmark_path))
+    {
+      fprintf(stderr, "Failed to write benchmark results to %s\n", benchmark_path->c_str());
+      return 1;
+    }
+  }
+
+  if (verify_movie_path)
+  {
+    s_movie_verification.frame_hook.reset();
+    if (!WriteMovieVerificationReport(*verify_movie_path, verify_reference_path))
+      return 1;
+  }
+
   return 0;
 }
 
@@ -5,11 +5,15 @@
 
 #include <QCheckBox>
 #include <QGroupBox>
+#include <QLabel>
 #include <QPushButton>
+#include <QTimer>
 #include <QVBoxLayout>
 
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/HW/SI/SI.h"
+#include "Core/System.h"
 
 #include "DolphinQt/Config/ControllerInterface/ControllerInterfaceWindow.h"
 #include "DolphinQt/QtUtils/NonDefaultQPushButton.h"
@@ -25,6 +29,11 @@ CommonControllersWidget::CommonControllersWidget(QWidget* parent) : QWidget(pare
 
   connect(&Settings::Instance(), &Settings::ConfigChanged, this,
           &CommonControllersWidget::LoadSettings);
+
+  m_input_age_timer = new QTimer(this);
+  connect(m_input_age_timer, &QTimer::timeout, this, &CommonControllersWidget::UpdateInputAge);
+  m_input_age_timer->start(1000);
+  UpdateInputAge();
 }
 
 void CommonControllersWidget::CreateLayout()
@@ -33,10 +42,21 @@ void CommonControllersWidget::CreateLayout()
   m_common_box = new QGroupBox(tr("Common"));
   m_common_layout = new QVBoxLayout();
   m_common_bg_input = new QCheckBox(tr("Background Input"));
+  m_common_late_input = new QCheckBox(tr("Late Input"));
+  m_common_late_input->setToolTip(
+      tr("Reads GameCube controllers when the game reads their results instead of when the "
+         "console polls them, which can reduce input latency by up to a frame.<br><br>Has no "
+         "effect during NetPlay, while a movie is active or when other devices are plugged into "
+         "the GameCube ports."));
+  m_common_input_age = new QLabel();
+  m_common_input_age->setToolTip(
+      tr("Average time between host input being read and the game reading it."));
   m_common_configure_controller_interface =
       new NonDefaultQPushButton(tr("Alternate Input Sources"));
 
   m_common_layout->addWidget(m_common_bg_input);
+  m_common_layout->addWidget(m_common_late_input);
+  m_common_layout->addWidget(m_common_input_age);
   m_common_layout->addWidget(m_common_configure_controller_interface);
 
   m_common_box->setLayout(m_common_layout);
@@ -51,6 +71,7 @@ void CommonControllersWidget::CreateLayout()
 void CommonControllersWidget::ConnectWidgets()
 {
   connect(m_common_bg_input, &QCheckBox::toggled, this, &CommonControllersWidget::SaveSettings);
+  connect(m_common_late_input, &QCheckBox::toggled, this, &CommonControllersWidget::SaveSettings);
   connect(m_common_configure_controller_interface, &QPushButton::clicked, this,
           &CommonControllersWidget::OnControllerInterfaceConfigure);
 }
@@ -67,10 +88,23 @@ void CommonControllersWidget::OnControllerInterfaceConfigure()
 void CommonControllersWidget::LoadSettings()
 {
   SignalBlocking(m_common_bg_input)->setChecked(Config::Get(Config::MAIN_INPUT_BACKGROUND_INPUT));
+  SignalBlocking(m_common_late_input)->setChecked(Config::Get(Config::MAIN_INPUT_LATE_INPUT));
 }
 
 void CommonControllersWidget::SaveSettings()
 {
   Config::SetBaseOrCurrent(Config::MAIN_INPUT_BACKGROUND_INPUT, m_common_bg_input->isChecked());
+  Config::SetBaseOrCurrent(Config::MAIN_INPUT_LATE_INPUT, m_common_late_input->isChecked());
   Config::Save();
 }
+
+void CommonControllersWidget::UpdateInputAge()
+{
+  auto& system = Core::System::GetInstance();
+  const u64 age = Core::IsRunning(system) ? system.GetSerialInterface().TakeAverageInputAge() : 0;
+
+  if (age == 0)
+    m_common_input_age->setText(tr("Input Age: -"));
+  else
+    m_common_input_age->setText(tr("Input Age: %1 ms").arg(age / 1000.0, 0, 'f', 2));
+}
@@ -9,8 +9,10 @@
 
 class QCheckBox;
 class QGroupBox;
+class QLabel;
 class QVBoxLayout;
 class QPushButton;
+class QTimer;
 
 class CommonControllersWidget final : public QWidget
 {
@@ -27,8 +29,13 @@ private:
   void LoadSettings();
   void SaveSettings();
 
+  void UpdateInputAge();
+
   QGroupBox* m_common_box;
   QVBoxLayout* m_common_layout;
   QCheckBox* m_common_bg_input;
+  QCheckBox* m_common_late_input;
+  QLabel* m_common_input_age;
+  QTimer* m_input_age_timer;
   QPushButton* m_common_configure_controller_interface;
 };
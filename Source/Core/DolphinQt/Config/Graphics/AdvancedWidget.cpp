@@ -63,6 +63,8 @@ void AdvancedWidget::CreateWidgets()
   m_show_graphs = new ConfigBool(tr("Show Performance Graphs"), Config::GFX_SHOW_GRAPHS);
   m_show_speed = new ConfigBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED);
   m_show_speed_colors = new ConfigBool(tr("Show Speed Colors"), Config::GFX_SHOW_SPEED_COLORS);
+  m_show_tlb_stats = new ConfigBool(tr("Show TLB Statistics"), Config::GFX_SHOW_TLB_STATS);
+  m_show_gpu_timings = new ConfigBool(tr("Show GPU Timings"), Config::GFX_SHOW_GPU_TIMINGS);
   m_perf_samp_window = new ConfigInteger(0, 10000, Config::GFX_PERF_SAMP_WINDOW, 100);
   m_perf_samp_window->SetTitle(tr("Performance Sample Window (ms)"));
   m_log_render_time =
@@ -78,6 +80,8 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_tlb_stats, 5, 0);
+  performance_layout->addWidget(m_show_gpu_timings, 5, 1);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -282,6 +286,16 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Shows the % speed of emulation compared to full speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
                  "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_TLB_STATS_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how often the emulated CPU's address translations hit the TLB, and how "
+                 "often they have to walk the page table instead. Only games that use the MMU "
+                 "make use of the TLB.<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_GPU_TIMINGS_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how long the GPU spends drawing to the EFB, on EFB and XFB copies, on "
+                 "post-processing and on presenting each frame. Not supported by all backends."
+                 "<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_SPEED_COLORS_DESCRIPTION[] =
       QT_TR_NOOP("Changes the color of the FPS counter depending on emulation speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
@@ -439,6 +453,8 @@ void AdvancedWidget::AddDescriptions()
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
   m_show_speed_colors->SetDescription(tr(TR_SHOW_SPEED_COLORS_DESCRIPTION));
+  m_show_tlb_stats->SetDescription(tr(TR_SHOW_TLB_STATS_DESCRIPTION));
+  m_show_gpu_timings->SetDescription(tr(TR_SHOW_GPU_TIMINGS_DESCRIPTION));
 
   m_enable_wireframe->SetDescription(tr(TR_WIREFRAME_DESCRIPTION));
   m_show_statistics->SetDescription(tr(TR_SHOW_STATS_DESCRIPTION));
@@ -43,6 +43,8 @@ private:
   ConfigBool* m_show_graphs;
   ConfigBool* m_show_speed;
   ConfigBool* m_show_speed_colors;
+  ConfigBool* m_show_tlb_stats;
+  ConfigBool* m_show_gpu_timings;
   ConfigInteger* m_perf_samp_window;
   ConfigBool* m_log_render_time;
 
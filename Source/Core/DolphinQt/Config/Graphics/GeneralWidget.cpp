@@ -73,6 +73,7 @@ void GeneralWidget::CreateWidgets()
   m_custom_aspect_height->setHidden(true);
   m_adapter_combo = new ToolTipComboBox;
   m_enable_vsync = new ConfigBool(tr("V-Sync"), Config::GFX_VSYNC);
+  m_low_latency_pacing = new ConfigBool(tr("Reduce Input Latency"), Config::GFX_LOW_LATENCY_PACING);
   m_enable_fullscreen = new ConfigBool(tr("Start in Fullscreen"), Config::MAIN_FULLSCREEN);
 
   m_video_box->setLayout(m_video_layout);
@@ -98,6 +99,7 @@ void GeneralWidget::CreateWidgets()
 
   m_video_layout->addWidget(m_enable_vsync, 5, 0);
   m_video_layout->addWidget(m_enable_fullscreen, 5, 1, 1, -1);
+  m_video_layout->addWidget(m_low_latency_pacing, 6, 0);
 
   // Other
   auto* m_options_box = new QGroupBox(tr("Other"));
@@ -276,6 +278,13 @@ void GeneralWidget::AddDescriptions()
       "if emulation speed is below 100%.<br><br><dolphin_emphasis>If unsure, leave "
       "this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_LOW_LATENCY_PACING_DESCRIPTION[] = QT_TR_NOOP(
+      "Starts emulating each frame as late as the previous frames allow, and keeps at most one "
+      "frame queued for display, so that the game reads input closer to when the frame is "
+      "shown.<br><br>The latency is shown with the frame times in the performance "
+      "overlay. Can cause stuttering if emulation speed is close to 100%. On D3D, changes only "
+      "take effect when emulation is restarted.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_NETPLAY_PING_DESCRIPTION[] = QT_TR_NOOP(
       "Shows the player's maximum ping while playing on "
       "NetPlay.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -324,6 +333,8 @@ void GeneralWidget::AddDescriptions()
 
   m_enable_vsync->SetDescription(tr(TR_VSYNC_DESCRIPTION));
 
+  m_low_latency_pacing->SetDescription(tr(TR_LOW_LATENCY_PACING_DESCRIPTION));
+
   m_enable_fullscreen->SetDescription(tr(TR_FULLSCREEN_DESCRIPTION));
 
   m_show_ping->SetDescription(tr(TR_SHOW_NETPLAY_PING_DESCRIPTION));
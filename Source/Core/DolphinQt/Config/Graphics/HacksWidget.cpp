@@ -53,11 +53,14 @@ void HacksWidget::CreateWidgets()
       new ConfigBool(tr("Store EFB Copies to Texture Only"), Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   m_defer_efb_copies =
       new ConfigBool(tr("Defer EFB Copies to RAM"), Config::GFX_HACK_DEFER_EFB_COPIES);
+  m_defer_efb_copies_to_frame_end = new ConfigBool(tr("Defer EFB Copies to End of Frame"),
+                                                   Config::GFX_HACK_DEFER_EFB_COPIES_TO_FRAME_END);
 
   efb_layout->addWidget(m_skip_efb_cpu, 0, 0);
   efb_layout->addWidget(m_ignore_format_changes, 0, 1);
   efb_layout->addWidget(m_store_efb_copies, 1, 0);
   efb_layout->addWidget(m_defer_efb_copies, 1, 1);
+  efb_layout->addWidget(m_defer_efb_copies_to_frame_end, 2, 1);
 
   // Texture Cache
   auto* texture_cache_box = new QGroupBox(tr("Texture Cache"));
@@ -71,6 +74,8 @@ void HacksWidget::CreateWidgets()
   m_accuracy->setTickPosition(QSlider::TicksBelow);
   m_gpu_texture_decoding =
       new ConfigBool(tr("GPU Texture Decoding"), Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
+  m_async_texture_decoding =
+      new ConfigBool(tr("Asynchronous Texture Decoding"), Config::GFX_ASYNC_TEXTURE_DECODING);
 
   auto* safe_label = new QLabel(tr("Safe"));
   safe_label->setAlignment(Qt::AlignRight);
@@ -82,6 +87,7 @@ void HacksWidget::CreateWidgets()
   texture_cache_layout->addWidget(m_accuracy, 0, 2);
   texture_cache_layout->addWidget(new QLabel(tr("Fast")), 0, 3);
   texture_cache_layout->addWidget(m_gpu_texture_decoding, 1, 0);
+  texture_cache_layout->addWidget(m_async_texture_decoding, 1, 2);
 
   // XFB
   auto* xfb_box = new QGroupBox(tr("External Frame Buffer (XFB)"));
@@ -152,6 +158,8 @@ void HacksWidget::ConnectWidgets()
           [this](int) { UpdateDeferEFBCopiesEnabled(); });
   connect(m_store_xfb_copies, &QCheckBox::stateChanged,
           [this](int) { UpdateDeferEFBCopiesEnabled(); });
+  connect(m_defer_efb_copies, &QCheckBox::stateChanged,
+          [this](int) { UpdateDeferEFBCopiesEnabled(); });
   connect(m_immediate_xfb, &QCheckBox::stateChanged,
           [this](int) { UpdateSkipPresentingDuplicateFramesEnabled(); });
   connect(m_vi_skip, &QCheckBox::stateChanged,
@@ -242,6 +250,13 @@ void HacksWidget::AddDescriptions()
       "many games, at the risk of breaking those which do not safely synchronize with the "
       "emulated GPU.<br><br><dolphin_emphasis>If unsure, leave this "
       "checked.</dolphin_emphasis>");
+  static const char TR_DEFER_EFB_COPIES_TO_FRAME_END_DESCRIPTION[] = QT_TR_NOOP(
+      "Keeps deferred EFB copies on the GPU until the end of the frame, instead of writing them to "
+      "RAM whenever the game synchronizes with the emulated GPU. Copies are still written early "
+      "if the emulated GPU reads the memory they cover.<br><br>Avoids stalling on the host GPU in "
+      "games which do many small EFB copies per frame, but breaks games which read the results of "
+      "EFB copies with the CPU within the same frame.<br><br><dolphin_emphasis>If unsure, leave "
+      "this unchecked.</dolphin_emphasis>");
   static const char TR_ACCUARCY_DESCRIPTION[] = QT_TR_NOOP(
       "Adjusts the accuracy at which the GPU receives texture updates from RAM.<br><br>"
       "The \"Safe\" setting eliminates the likelihood of the GPU missing texture updates "
@@ -270,6 +285,12 @@ void HacksWidget::AddDescriptions()
       "performance gains in some scenarios, or on systems where the CPU is the "
       "bottleneck.<br><br>This option is incompatible with Arbitrary Mipmap Detection.<br><br>"
       "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_ASYNC_TEXTURE_DECODING_DESCRIPTION[] = QT_TR_NOOP(
+      "Decodes textures that change in place on background threads, and keeps showing the "
+      "previous contents of the texture until decoding has finished.<br><br>This reduces "
+      "stuttering when games stream or animate large textures, at the cost of some textures "
+      "being a frame or two out of date.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_FAST_DEPTH_CALC_DESCRIPTION[] = QT_TR_NOOP(
       "Uses a less accurate algorithm to calculate depth values.<br><br>Causes issues in a few "
       "games, but can result in a decent speed increase depending on the game and/or "
@@ -299,12 +320,14 @@ void HacksWidget::AddDescriptions()
   m_ignore_format_changes->SetDescription(tr(TR_IGNORE_FORMAT_CHANGE_DESCRIPTION));
   m_store_efb_copies->SetDescription(tr(TR_STORE_EFB_TO_TEXTURE_DESCRIPTION));
   m_defer_efb_copies->SetDescription(tr(TR_DEFER_EFB_COPIES_DESCRIPTION));
+  m_defer_efb_copies_to_frame_end->SetDescription(tr(TR_DEFER_EFB_COPIES_TO_FRAME_END_DESCRIPTION));
   m_accuracy->SetTitle(tr("Texture Cache Accuracy"));
   m_accuracy->SetDescription(tr(TR_ACCUARCY_DESCRIPTION));
   m_store_xfb_copies->SetDescription(tr(TR_STORE_XFB_TO_TEXTURE_DESCRIPTION));
   m_immediate_xfb->SetDescription(tr(TR_IMMEDIATE_XFB_DESCRIPTION));
   m_skip_duplicate_xfbs->SetDescription(tr(TR_SKIP_DUPLICATE_XFBS_DESCRIPTION));
   m_gpu_texture_decoding->SetDescription(tr(TR_GPU_DECODING_DESCRIPTION));
+  m_async_texture_decoding->SetDescription(tr(TR_ASYNC_TEXTURE_DECODING_DESCRIPTION));
   m_fast_depth_calculation->SetDescription(tr(TR_FAST_DEPTH_CALC_DESCRIPTION));
   m_disable_bounding_box->SetDescription(tr(TR_DISABLE_BOUNDINGBOX_DESCRIPTION));
   m_save_texture_cache_state->SetDescription(tr(TR_SAVE_TEXTURE_CACHE_TO_STATE_DESCRIPTION));
@@ -318,6 +341,7 @@ void HacksWidget::UpdateDeferEFBCopiesEnabled()
   // enabled.
   const bool can_defer = m_store_efb_copies->isChecked() && m_store_xfb_copies->isChecked();
   m_defer_efb_copies->setEnabled(!can_defer);
+  m_defer_efb_copies_to_frame_end->setEnabled(!can_defer && m_defer_efb_copies->isChecked());
 }
 
 void HacksWidget::UpdateSkipPresentingDuplicateFramesEnabled()
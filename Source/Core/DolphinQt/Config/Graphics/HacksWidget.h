@@ -27,11 +27,13 @@ private:
   ConfigBool* m_ignore_format_changes;
   ConfigBool* m_store_efb_copies;
   ConfigBool* m_defer_efb_copies;
+  ConfigBool* m_defer_efb_copies_to_frame_end;
 
   // Texture Cache
   QLabel* m_accuracy_label;
   ToolTipSlider* m_accuracy;
   ConfigBool* m_gpu_texture_decoding;
+  ConfigBool* m_async_texture_decoding;
 
   // External Framebuffer
   ConfigBool* m_store_xfb_copies;
@@ -6,6 +6,7 @@
 #include <QCheckBox>
 #include <QDialogButtonBox>
 #include <QLabel>
+#include <QTimer>
 #include <QVBoxLayout>
 
 #include "Core/Config/MainSettings.h"
@@ -36,6 +37,10 @@ void GCPadWiiUConfigDialog::CreateLayout()
 
   m_layout = new QVBoxLayout();
   m_status_label = new QLabel();
+  m_report_label = new QLabel();
+  m_report_label->setToolTip(
+      tr("How often the adapter sent input reports over the last second, and how much the time "
+         "between reports varied."));
   m_rumble = new QCheckBox(tr("Enable Rumble"));
   m_simulate_bongos = new QCheckBox(tr("Simulate DK Bongos"));
   m_button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
@@ -46,11 +51,17 @@ void GCPadWiiUConfigDialog::CreateLayout()
   GCAdapter::SetAdapterCallback(callback);
 
   m_layout->addWidget(m_status_label);
+  m_layout->addWidget(m_report_label);
   m_layout->addWidget(m_rumble);
   m_layout->addWidget(m_simulate_bongos);
   m_layout->addWidget(m_button_box);
 
   setLayout(m_layout);
+
+  m_report_timer = new QTimer(this);
+  connect(m_report_timer, &QTimer::timeout, this, &GCPadWiiUConfigDialog::UpdateReportStatistics);
+  m_report_timer->start(1000);
+  UpdateReportStatistics();
 }
 
 void GCPadWiiUConfigDialog::ConnectWidgets()
@@ -85,6 +96,17 @@ void GCPadWiiUConfigDialog::UpdateAdapterStatus()
   m_simulate_bongos->setEnabled(detected);
 }
 
+void GCPadWiiUConfigDialog::UpdateReportStatistics()
+{
+  const GCAdapter::ReportStatistics statistics = GCAdapter::GetReportStatistics();
+
+  m_report_label->setVisible(statistics.rate != 0);
+  m_report_label->setText(tr("Polling Rate: %1 Hz, Jitter: %2 ms, Longest Gap: %3 ms")
+                              .arg(statistics.rate, 0, 'f', 0)
+                              .arg(statistics.interval_deviation, 0, 'f', 2)
+                              .arg(statistics.max_interval, 0, 'f', 2));
+}
+
 void GCPadWiiUConfigDialog::LoadSettings()
 {
   m_rumble->setChecked(Config::Get(Config::GetInfoForAdapterRumble(m_port)));
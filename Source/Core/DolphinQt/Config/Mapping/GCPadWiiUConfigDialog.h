@@ -8,6 +8,7 @@
 class QCheckBox;
 class QLabel;
 class QDialogButtonBox;
+class QTimer;
 class QVBoxLayout;
 
 class GCPadWiiUConfigDialog final : public QDialog
@@ -26,11 +27,14 @@ private:
 
 private:
   void UpdateAdapterStatus();
+  void UpdateReportStatistics();
 
   int m_port;
 
   QVBoxLayout* m_layout;
   QLabel* m_status_label;
+  QLabel* m_report_label;
+  QTimer* m_report_timer;
   QDialogButtonBox* m_button_box;
 
   // Checkboxes
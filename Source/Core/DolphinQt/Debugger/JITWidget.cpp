@@ -13,6 +13,8 @@
 
 #include "Common/GekkoDisassembler.h"
 #include "Core/Core.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/System.h"
 #include "UICommon/Disassembler.h"
@@ -203,6 +205,12 @@ void JITWidget::Update()
           100 * host_instructions_disasm.code_size / (4 * code_block.m_num_instructions) - 100);
     }
 
+    const JitBlockEvictionStats eviction_stats =
+        Core::System::GetInstance().GetJitInterface().GetBlockEvictionStats();
+    fmt::format_to(ppc_disasm, "\nCode space full: {} partial evictions ({} blocks), {} clears",
+                   eviction_stats.partial_evictions, eviction_stats.evicted_blocks,
+                   eviction_stats.full_clears);
+
     m_ppc_asm_widget->setHtml(
         QStringLiteral("<pre>%1</pre>").arg(QString::fromStdString(ppc_disasm_str)));
   }
@@ -637,6 +637,9 @@ void HotkeyScheduler::Run()
 
     if (IsHotkey(HK_SAVE_STATE_FILE))
       emit StateSaveFile();
+
+    if (IsHotkey(HK_REWIND))
+      Core::QueueHostJob([](auto& system) { State::Rewind(system); });
   }
 }
 
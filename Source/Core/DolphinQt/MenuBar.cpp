@@ -154,6 +154,10 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_log_coverage->setEnabled(!running);
   m_jit_search_instruction->setEnabled(running);
   m_jit_write_cache_log_dump->setEnabled(running && jit_exists);
+  m_jit_sampling_profiler->setEnabled(running);
+  m_jit_sampling_profiler->setChecked(
+      Core::System::GetInstance().GetJitInterface().IsSamplingProfilerRunning());
+  m_jit_write_sampling_profile->setEnabled(running);
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -218,6 +222,29 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnWriteSamplingProfile()
+{
+  const std::string base_path = fmt::format("{}{}", File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
+                                            SConfig::GetInstance().GetGameID());
+  const std::string perf_map_path = base_path + "_perf.map";
+  const std::string json_path = base_path + "_samples.json";
+
+  auto& system = Core::System::GetInstance();
+  if (!system.GetJitInterface().WriteSamplingProfile(Core::CPUThreadGuard{system}, perf_map_path,
+                                                     json_path))
+  {
+    ModalMessageBox::warning(this, tr("Error"),
+                             tr("Failed to write the sampling profile to \"%1\".")
+                                 .arg(QString::fromStdString(json_path)));
+    return;
+  }
+
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\" and \"%2\".")
+                                   .arg(QString::fromStdString(json_path))
+                                   .arg(QString::fromStdString(perf_map_path)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -921,6 +948,18 @@ void MenuBar::AddJITMenu()
   m_jit_write_cache_log_dump =
       m_jit->addAction(tr("Write JIT Block Log Dump"), this, &MenuBar::OnWriteJitBlockLogDump);
 
+  m_jit_sampling_profiler = m_jit->addAction(tr("Enable Sampling Profiler"));
+  m_jit_sampling_profiler->setCheckable(true);
+  connect(m_jit_sampling_profiler, &QAction::toggled, [](bool enabled) {
+    auto& jit_interface = Core::System::GetInstance().GetJitInterface();
+    if (enabled)
+      jit_interface.StartSamplingProfiler();
+    else
+      jit_interface.StopSamplingProfiler();
+  });
+  m_jit_write_sampling_profile =
+      m_jit->addAction(tr("Write Sampling Profile"), this, &MenuBar::OnWriteSamplingProfile);
+
   m_jit->addSeparator();
 
   m_jit_off = m_jit->addAction(tr("JIT Off (JIT Core)"));
@@ -186,6 +186,7 @@ private:
   void OnReadOnlyModeChanged(bool read_only);
   void OnDebugModeToggled(bool enabled);
   void OnWriteJitBlockLogDump();
+  void OnWriteSamplingProfile();
 
   QString GetSignatureSelector() const;
 
@@ -271,6 +272,8 @@ private:
   QAction* m_jit_search_instruction;
   QAction* m_jit_profile_blocks;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_jit_sampling_profiler;
+  QAction* m_jit_write_sampling_profile;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
@@ -132,6 +132,10 @@ void NetPlayDialog::CreateMainLayout()
   m_start_button = new QPushButton(tr("Start"));
   m_buffer_size_box = new QSpinBox;
   m_buffer_label = new QLabel(tr("Buffer:"));
+  m_rollback_label = new QLabel;
+  m_rollback_label->setHidden(true);
+  m_input_wait_label = new QLabel;
+  m_input_wait_label->setHidden(true);
   m_quit_button = new QPushButton(tr("Quit"));
   m_splitter = new QSplitter(Qt::Horizontal);
   m_menu_bar = new QMenuBar(this);
@@ -200,12 +204,20 @@ void NetPlayDialog::CreateMainLayout()
          "switched at any time.\nSuitable for turn-based games with timing-sensitive controls, "
          "such as golf."));
   m_golf_mode_action->setCheckable(true);
+  m_rollback_action = m_network_menu->addAction(tr("Rollback"));
+  m_rollback_action->setToolTip(
+      tr("Identical to Fair Input Delay, except that the inputs of other players are predicted "
+         "instead of waited for, and the game is rolled back and run again when a prediction was "
+         "wrong.\nSuitable for GameCube games on high latency connections, on computers which "
+         "can run the game much faster than full speed. Emulated Wii Remotes are not supported."));
+  m_rollback_action->setCheckable(true);
 
   m_network_mode_group = new QActionGroup(this);
   m_network_mode_group->setExclusive(true);
   m_network_mode_group->addAction(m_fixed_delay_action);
   m_network_mode_group->addAction(m_host_input_authority_action);
   m_network_mode_group->addAction(m_golf_mode_action);
+  m_network_mode_group->addAction(m_rollback_action);
   m_fixed_delay_action->setChecked(true);
 
   m_game_digest_menu = m_menu_bar->addMenu(tr("Checksum"));
@@ -253,8 +265,10 @@ void NetPlayDialog::CreateMainLayout()
   options_widget->addWidget(m_start_button, 0, 0, Qt::AlignVCenter);
   options_widget->addWidget(m_buffer_label, 0, 1, Qt::AlignVCenter);
   options_widget->addWidget(m_buffer_size_box, 0, 2, Qt::AlignVCenter);
-  options_widget->addWidget(m_quit_button, 0, 3, Qt::AlignVCenter | Qt::AlignRight);
-  options_widget->setColumnStretch(3, 1000);
+  options_widget->addWidget(m_rollback_label, 0, 3, Qt::AlignVCenter);
+  options_widget->addWidget(m_input_wait_label, 0, 4, Qt::AlignVCenter);
+  options_widget->addWidget(m_quit_button, 0, 5, Qt::AlignVCenter | Qt::AlignRight);
+  options_widget->setColumnStretch(5, 1000);
 
   m_main_layout->addLayout(options_widget, 2, 0, 1, -1, Qt::AlignRight);
   m_main_layout->setRowStretch(1, 1000);
@@ -377,6 +391,7 @@ void NetPlayDialog::ConnectWidgets()
           [hia_function] { hia_function(true); });
   connect(m_golf_mode_action, &QAction::toggled, this, [hia_function] { hia_function(true); });
   connect(m_fixed_delay_action, &QAction::toggled, this, [hia_function] { hia_function(false); });
+  connect(m_rollback_action, &QAction::toggled, this, [hia_function] { hia_function(false); });
 
   connect(m_start_button, &QPushButton::clicked, this, &NetPlayDialog::OnStart);
   connect(m_quit_button, &QPushButton::clicked, this, &NetPlayDialog::reject);
@@ -423,6 +438,7 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_strict_settings_sync_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_host_input_authority_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_golf_mode_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_rollback_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_golf_mode_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_fixed_delay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_hide_remote_gbas_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
@@ -695,6 +711,36 @@ void NetPlayDialog::UpdateGUI()
     m_old_player_count = m_player_count;
   }
 
+  if (const auto rollback_stats = client->GetRollbackStats())
+  {
+    const NetPlay::PadRollback::Stats& stats = *rollback_stats;
+    const double average_ms =
+        stats.rollbacks != 0 ? stats.total_resimulation_ms / stats.rollbacks : 0.0;
+    m_rollback_label->setText(tr("Rollbacks: %1 (%2 frames, %3 ms average)")
+                                  .arg(stats.rollbacks)
+                                  .arg(stats.resimulated_frames)
+                                  .arg(average_ms, 0, 'f', 1));
+    m_rollback_label->setHidden(false);
+  }
+  else
+  {
+    m_rollback_label->setHidden(true);
+  }
+
+  const NetPlay::NetPlayClient::InputWaitStats input_wait = client->GetInputWaitStats();
+  if (input_wait.frames != 0)
+  {
+    m_input_wait_label->setText(tr("Input wait: %1 ms (%2 ms max, %3% of frames)")
+                                    .arg(input_wait.last_frame_ms, 0, 'f', 1)
+                                    .arg(input_wait.max_frame_ms, 0, 'f', 1)
+                                    .arg(100 * input_wait.blocked_frames / input_wait.frames));
+    m_input_wait_label->setHidden(false);
+  }
+  else
+  {
+    m_input_wait_label->setHidden(true);
+  }
+
   if (!server)
     return;
 
@@ -862,6 +908,7 @@ void NetPlayDialog::SetOptionsEnabled(bool enabled)
     m_strict_settings_sync_action->setEnabled(enabled);
     m_host_input_authority_action->setEnabled(enabled);
     m_golf_mode_action->setEnabled(enabled);
+    m_rollback_action->setEnabled(enabled);
     m_fixed_delay_action->setEnabled(enabled);
   }
 
@@ -965,10 +1012,19 @@ void NetPlayDialog::OnHostInputAuthorityChanged(bool enabled)
   });
 }
 
-void NetPlayDialog::OnDesync(u32 frame, const std::string& player)
+void NetPlayDialog::OnDesync(u32 frame, const std::string& player, const std::string& region)
 {
-  DisplayMessage(tr("Possible desync detected: %1 might have desynced at frame %2")
-                     .arg(QString::fromStdString(player), QString::number(frame)),
+  if (region.empty())
+  {
+    DisplayMessage(tr("Possible desync detected: %1 might have desynced at frame %2")
+                       .arg(QString::fromStdString(player), QString::number(frame)),
+                   "red", OSD::Duration::VERY_LONG);
+    return;
+  }
+
+  DisplayMessage(tr("Possible desync detected: %1 might have desynced at frame %2 in %3")
+                     .arg(QString::fromStdString(player), QString::number(frame),
+                          QString::fromStdString(region)),
                  "red", OSD::Duration::VERY_LONG);
 }
 
@@ -1166,6 +1222,10 @@ void NetPlayDialog::LoadSettings()
   {
     m_golf_mode_action->setChecked(true);
   }
+  else if (network_mode == "rollback")
+  {
+    m_rollback_action->setChecked(true);
+  }
   else
   {
     WARN_LOG_FMT(NETPLAY, "Unknown network mode '{}', using 'fixeddelay'", network_mode);
@@ -1208,6 +1268,10 @@ void NetPlayDialog::SaveSettings()
   {
     network_mode = "golf";
   }
+  else if (m_rollback_action->isChecked())
+  {
+    network_mode = "rollback";
+  }
 
   Config::SetBase(Config::NETPLAY_NETWORK_MODE, network_mode);
 }
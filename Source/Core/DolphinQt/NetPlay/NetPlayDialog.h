@@ -64,7 +64,7 @@ public:
   void OnPlayerDisconnect(const std::string& player) override;
   void OnPadBufferChanged(u32 buffer) override;
   void OnHostInputAuthorityChanged(bool enabled) override;
-  void OnDesync(u32 frame, const std::string& player) override;
+  void OnDesync(u32 frame, const std::string& player, const std::string& region) override;
   void OnConnectionLost() override;
   void OnConnectionError(const std::string& message) override;
   void OnTraversalError(Common::TraversalClient::FailureReason error) override;
@@ -143,6 +143,8 @@ private:
   QPushButton* m_start_button;
   QLabel* m_buffer_label;
   QSpinBox* m_buffer_size_box;
+  QLabel* m_rollback_label;
+  QLabel* m_input_wait_label;
 
   QActionGroup* m_savedata_style_group;
   QAction* m_savedata_none_action;
@@ -155,6 +157,7 @@ private:
   QAction* m_strict_settings_sync_action;
   QAction* m_host_input_authority_action;
   QAction* m_golf_mode_action;
+  QAction* m_rollback_action;
   QAction* m_golf_mode_overlay_action;
   QAction* m_fixed_delay_action;
   QAction* m_hide_remote_gbas_action;
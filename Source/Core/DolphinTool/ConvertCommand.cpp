@@ -3,11 +3,15 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,6 +19,9 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -56,6 +63,150 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+struct ConversionSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  bool zstd_dictionary;
+  size_t threads;
+};
+
+static bool ConvertImage(const std::string& input_file_path, const std::string& output_file_path,
+                         const ConversionSettings& settings)
+{
+  const DiscIO::BlobType format = settings.format;
+  const bool scrub = settings.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    fmt::print(std::cerr,
+               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                          "offer space advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    fmt::print(std::cerr,
+               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    fmt::print(std::cerr,
+               "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+               "must be an integer multiple of the block size and must not be an integer "
+               "multiple of the block size multiplied by 32. Continuing anyway.\n");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   settings.block_size.value(), NOOP_STATUS_CALLBACK,
+                                   settings.threads);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        settings.compression.value(), settings.compression_level.value(),
+        settings.block_size.value(), NOOP_STATUS_CALLBACK, settings.threads,
+        settings.zstd_dictionary);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  return success;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -72,13 +223,15 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-i", "--input")
       .type("string")
       .action("store")
-      .help("Path to disc image FILE.")
+      .help("Path to disc image FILE, or to a directory of disc images to convert in a batch. "
+            "More disc images can be listed after the options.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE. When converting several disc images, the directory "
+            "to write them to.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
@@ -110,6 +263,26 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-d", "--zstd_dictionary")
+      .action("store_true")
+      .help("Store a Zstandard dictionary built from the disc's files when converting to RVZ with "
+            "zstd. Improves compression with small block sizes, but the output can't be read by "
+            "older versions of Dolphin.");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Total number of compression threads, shared between the disc images that "
+            "are being converted. Defaults to the number of hardware threads.")
+      .set_default(0);
+
+  parser.add_option("-p", "--parallel_images")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of disc images to convert at the same time in a batch, so that "
+            "reading one overlaps compressing another. Default is 2.")
+      .set_default(2);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -120,12 +293,32 @@ int ConvertCommand(const std::vector<std::string>& args)
   // Validate options
 
   // --input
-  if (!options.is_set("input"))
+  std::vector<std::string> input_file_paths;
+  bool batch = false;
+  if (options.is_set("input"))
+  {
+    const std::string& input = options["input"];
+    if (File::IsDirectory(input))
+    {
+      static const std::vector<std::string> disc_image_extensions = {
+          ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz", ".nfs"};
+      input_file_paths = Common::DoFileSearch({input}, disc_image_extensions);
+      batch = true;
+    }
+    else
+    {
+      input_file_paths.push_back(input);
+    }
+  }
+  for (const std::string& arg : parser.args())
+    input_file_paths.push_back(arg);
+  batch |= input_file_paths.size() > 1;
+
+  if (input_file_paths.empty())
   {
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
 
   // --output
   if (!options.is_set("output"))
@@ -133,7 +326,13 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No output set\n");
     return EXIT_FAILURE;
   }
-  const std::string& output_file_path = options["output"];
+  const std::string& output_path = options["output"];
+
+  if (batch && !File::IsDirectory(output_path) && !File::CreateFullPath(output_path + '/'))
+  {
+    fmt::print(std::cerr, "Error: The output directory could not be created\n");
+    return EXIT_FAILURE;
+  }
 
   // --format
   const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
@@ -144,48 +343,9 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
   // --scrub
   const bool scrub = static_cast<bool>(options.get("scrub"));
 
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
   if (scrub && format == DiscIO::BlobType::RVZ)
   {
     fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
@@ -198,19 +358,6 @@ int ConvertCommand(const std::vector<std::string>& args)
                           "using external compression. Continuing anyway.\n");
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
@@ -237,15 +384,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,55 +434,82 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
-
-  switch (format)
+  // --zstd_dictionary
+  const bool zstd_dictionary = static_cast<bool>(options.get("zstd_dictionary"));
+  if (zstd_dictionary && (format != DiscIO::BlobType::RVZ ||
+                          compression_o != DiscIO::WIARVZCompressionType::Zstd))
   {
-  case DiscIO::BlobType::PLAIN:
+    fmt::print(std::cerr, "Error: A Zstandard dictionary can only be used for RVZ with zstd\n");
+    return EXIT_FAILURE;
+  }
+
+  // --jobs, --parallel_images
+  const int jobs_option = static_cast<int>(options.get("jobs"));
+  const int parallel_images_option = static_cast<int>(options.get("parallel_images"));
+  if (jobs_option < 0 || parallel_images_option < 1)
   {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    fmt::print(std::cerr, "Error: The number of jobs and parallel images must be positive\n");
+    return EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::GCZ:
+  const size_t jobs = jobs_option != 0 ?
+                          static_cast<size_t>(jobs_option) :
+                          std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  const size_t parallel_images =
+      batch ? std::min<size_t>(parallel_images_option, input_file_paths.size()) : 1;
+
+  // Split the compression threads between the images being converted at once, so that converting
+  // a batch doesn't start more threads than converting one image with the same number of jobs.
+  const ConversionSettings settings{.format = format,
+                                    .scrub = scrub,
+                                    .block_size = block_size_o,
+                                    .compression = compression_o,
+                                    .compression_level = compression_level_o,
+                                    .zstd_dictionary = zstd_dictionary,
+                                    .threads = std::max<size_t>(jobs / parallel_images, 1)};
+
+  if (!batch)
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    if (!ConvertImage(input_file_paths[0], output_path, settings))
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: Conversion failed\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
-  }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
+    return EXIT_SUCCESS;
   }
 
-  default:
-  {
-    ASSERT(false);
-    break;
-  }
-  }
+  // Each worker takes the next image that hasn't been started yet
+  std::atomic<size_t> next_image = 0;
+  std::atomic<size_t> failed_images = 0;
+  const auto convert_images = [&] {
+    for (size_t i = next_image++; i < input_file_paths.size(); i = next_image++)
+    {
+      const std::string& input_file_path = input_file_paths[i];
+      std::string name;
+      SplitPath(input_file_path, nullptr, &name, nullptr);
+      const std::string output_file_path =
+          fmt::format("{}/{}{}", output_path, name, GetFormatExtension(format));
+
+      fmt::print(std::cout, "Converting {} to {}\n", input_file_path, output_file_path);
+      if (!ConvertImage(input_file_path, output_file_path, settings))
+      {
+        fmt::print(std::cerr, "Error: Conversion of {} failed\n", input_file_path);
+        ++failed_images;
+      }
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t i = 0; i < parallel_images; ++i)
+    workers.emplace_back(std::async(std::launch::async, convert_images));
+  for (std::future<void>& worker : workers)
+    worker.wait();
 
-  if (!success)
+  if (failed_images != 0)
   {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
+    fmt::print(std::cerr, "Error: {} of {} conversions failed\n", failed_images.load(),
+               input_file_paths.size());
     return EXIT_FAILURE;
   }
 
@@ -0,0 +1,272 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/DedupCommand.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace DolphinTool
+{
+namespace
+{
+constexpr u64 READ_SIZE = 0x400000;
+
+constexpr std::array<u64, 256> GenerateGearTable()
+{
+  // Any fixed set of random-looking values works, as long as it never changes between runs
+  std::array<u64, 256> table{};
+  u64 state = 0;
+  for (u64& value : table)
+  {
+    state += 0x9e3779b97f4a7c15;
+    u64 z = state;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    value = z ^ (z >> 31);
+  }
+  return table;
+}
+
+constexpr std::array<u64, 256> GEAR_TABLE = GenerateGearTable();
+
+struct DigestHash
+{
+  size_t operator()(const Common::SHA1::Digest& digest) const
+  {
+    size_t hash;
+    std::memcpy(&hash, digest.data(), sizeof(hash));
+    return hash;
+  }
+};
+
+// Splits data into content-defined chunks using a gear rolling hash, so that data which is
+// shared between discs gets split the same way even if it is at different offsets
+class ChunkCounter
+{
+public:
+  explicit ChunkCounter(u32 average_chunk_size)
+      : m_min_chunk_size(average_chunk_size / 4), m_max_chunk_size(average_chunk_size * 4),
+        m_boundary_shift(64 - std::countr_zero(average_chunk_size))
+  {
+  }
+
+  struct Stats
+  {
+    u64 total_bytes = 0;
+    u64 unique_bytes = 0;
+    u64 repeated_bytes = 0;  // Also found earlier in the same image
+    u64 shared_bytes = 0;    // Also found in an earlier image
+  };
+
+  u32 GetMaxChunkSize() const { return m_max_chunk_size; }
+  const Stats& GetStats() const { return m_stats; }
+
+  // Returns the length of the chunk starting at data, or 0 if more data is needed to find its end
+  size_t FindChunkLength(const u8* data, size_t available) const
+  {
+    const size_t end = std::min<size_t>(available, m_max_chunk_size);
+    u64 hash = 0;
+    for (size_t i = m_min_chunk_size; i < end; ++i)
+    {
+      hash = (hash << 1) + GEAR_TABLE[data[i]];
+      if ((hash >> m_boundary_shift) == 0)
+        return i + 1;
+    }
+    return available >= m_max_chunk_size ? m_max_chunk_size : 0;
+  }
+
+  void AddChunk(const u8* data, size_t size, size_t image_index)
+  {
+    m_stats.total_bytes += size;
+
+    const auto [it, inserted] = m_chunks.try_emplace(Common::SHA1::CalculateDigest(data, size),
+                                                     image_index);
+    if (inserted)
+      m_stats.unique_bytes += size;
+    else if (it->second == image_index)
+      m_stats.repeated_bytes += size;
+    else
+      m_stats.shared_bytes += size;
+  }
+
+private:
+  // The value is the index of the first image the chunk was found in
+  std::unordered_map<Common::SHA1::Digest, size_t, DigestHash> m_chunks;
+
+  u32 m_min_chunk_size;
+  u32 m_max_chunk_size;
+  int m_boundary_shift;
+
+  Stats m_stats;
+};
+
+// Returns the data that RVZ would compress: the decrypted data of each Wii partition, or the
+// whole disc for GameCube
+std::vector<std::pair<DiscIO::Partition, u64>> GetDataRanges(const DiscIO::Volume& volume)
+{
+  const std::vector<DiscIO::Partition> partitions = volume.GetPartitions();
+  if (partitions.empty())
+    return {{DiscIO::PARTITION_NONE, volume.GetDataSize()}};
+
+  std::vector<std::pair<DiscIO::Partition, u64>> ranges;
+  for (const DiscIO::Partition& partition : partitions)
+  {
+    const u64 data_size =
+        volume.ReadSwappedAndShifted(partition.offset + 0x2bc, DiscIO::PARTITION_NONE).value_or(0);
+    const u64 blocks = data_size / DiscIO::VolumeWii::BLOCK_TOTAL_SIZE;
+    ranges.emplace_back(partition, blocks * DiscIO::VolumeWii::BLOCK_DATA_SIZE);
+  }
+  return ranges;
+}
+
+bool AddImage(const DiscIO::Volume& volume, size_t image_index, ChunkCounter* counter)
+{
+  std::vector<u8> buffer(READ_SIZE + counter->GetMaxChunkSize());
+
+  for (const auto& [partition, size] : GetDataRanges(volume))
+  {
+    u64 offset = 0;
+    size_t buffered = 0;
+    while (true)
+    {
+      const u64 bytes_to_read = std::min(READ_SIZE, size - offset);
+      if (!volume.Read(offset, bytes_to_read, buffer.data() + buffered, partition))
+        return false;
+      offset += bytes_to_read;
+      buffered += bytes_to_read;
+
+      size_t chunk_start = 0;
+      while (const size_t length =
+                 counter->FindChunkLength(buffer.data() + chunk_start, buffered - chunk_start))
+      {
+        counter->AddChunk(buffer.data() + chunk_start, length, image_index);
+        chunk_start += length;
+      }
+
+      if (offset == size)
+      {
+        if (buffered != chunk_start)
+          counter->AddChunk(buffer.data() + chunk_start, buffered - chunk_start, image_index);
+        break;
+      }
+
+      std::memmove(buffer.data(), buffer.data() + chunk_start, buffered - chunk_start);
+      buffered -= chunk_start;
+    }
+  }
+
+  return true;
+}
+
+double ToMiB(u64 bytes)
+{
+  return bytes / 1048576.0;
+}
+}  // namespace
+
+int DedupCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: dedup [options]... [FILE]...");
+
+  parser.description("Estimates how much data a set of disc images have in common, by splitting "
+                     "the data that would be compressed into content-defined chunks.");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to a DIRECTORY of disc images. Disc images can also be listed after the "
+            "options.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-a", "--average_chunk_size")
+      .type("int")
+      .action("store")
+      .help("Average chunk size, as a power of two between 4096 and 4194304. Default is 65536.")
+      .set_default(65536);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  std::vector<std::string> input_file_paths;
+  if (options.is_set("input"))
+  {
+    static const std::vector<std::string> disc_image_extensions = {
+        ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz", ".nfs"};
+    input_file_paths = Common::DoFileSearch({options["input"]}, disc_image_extensions);
+  }
+  for (const std::string& arg : parser.args())
+    input_file_paths.push_back(arg);
+
+  if (input_file_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const int average_chunk_size = static_cast<int>(options.get("average_chunk_size"));
+  if (average_chunk_size < 0x1000 || average_chunk_size > 0x400000 ||
+      !std::has_single_bit(static_cast<u32>(average_chunk_size)))
+  {
+    fmt::print(std::cerr, "Error: Average chunk size is not valid\n");
+    return EXIT_FAILURE;
+  }
+
+  ChunkCounter counter(static_cast<u32>(average_chunk_size));
+  for (size_t i = 0; i < input_file_paths.size(); ++i)
+  {
+    const std::string& path = input_file_paths[i];
+    const std::unique_ptr<DiscIO::VolumeDisc> volume = DiscIO::CreateDisc(path);
+    if (!volume)
+    {
+      fmt::print(std::cerr, "Warning: Skipping '{}', it is not a GC/Wii disc image\n", path);
+      continue;
+    }
+
+    const ChunkCounter::Stats before = counter.GetStats();
+    if (!AddImage(*volume, i, &counter))
+    {
+      fmt::print(std::cerr, "Error: Unable to read '{}'\n", path);
+      return EXIT_FAILURE;
+    }
+
+    const ChunkCounter::Stats& after = counter.GetStats();
+    fmt::print(std::cout, "{}: {:.1f} MiB, {:.1f} MiB also in previous images\n", path,
+               ToMiB(after.total_bytes - before.total_bytes),
+               ToMiB(after.shared_bytes - before.shared_bytes));
+  }
+
+  const ChunkCounter::Stats& stats = counter.GetStats();
+  fmt::print(std::cout,
+             "\nTotal: {:.1f} MiB\n"
+             "Unique: {:.1f} MiB\n"
+             "Repeated within an image: {:.1f} MiB\n"
+             "Shared between images: {:.1f} MiB\n",
+             ToMiB(stats.total_bytes), ToMiB(stats.unique_bytes), ToMiB(stats.repeated_bytes),
+             ToMiB(stats.shared_bytes));
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
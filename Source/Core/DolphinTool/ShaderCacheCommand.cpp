@@ -0,0 +1,189 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/ShaderCacheCommand.h"
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/StringUtil.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// The header written by Common::LinearDiskCache: the 'DCAC' magic, the key size, the value
+// element size and the Dolphin version. Caches can only be merged if their headers are identical.
+constexpr size_t HEADER_SIZE = 48;
+using Header = std::array<u8, HEADER_SIZE>;
+
+struct MergedCache
+{
+  bool has_header = false;
+  Header header{};
+  std::unordered_set<std::string> keys;
+  // Entries without their entry numbers, which are rewritten when the cache is saved.
+  std::vector<std::string> entries;
+};
+
+// Appends the entries of a cache file which aren't already in the merged cache. Stops at the first
+// truncated or corrupted entry, like LinearDiskCache does.
+bool AddCacheFile(const std::string& path, MergedCache* cache)
+{
+  File::IOFile file(path, "rb");
+  Header header;
+  if (!file.ReadArray(&header) || std::memcmp(header.data(), "DCAC", 4) != 0)
+    return false;
+
+  if (!cache->has_header)
+  {
+    cache->header = header;
+    cache->has_header = true;
+  }
+  else if (header != cache->header)
+  {
+    return false;
+  }
+
+  u16 key_size, value_element_size;
+  std::memcpy(&key_size, &header[4], sizeof(key_size));
+  std::memcpy(&value_element_size, &header[6], sizeof(value_element_size));
+
+  const u64 file_size = file.GetSize();
+  u32 value_size;
+  u32 entry_number = 0;
+  while (file.ReadArray(&value_size, 1))
+  {
+    const u64 data_size = key_size + u64(value_size) * value_element_size;
+    if (file.Tell() + data_size + sizeof(entry_number) > file_size)
+      break;
+
+    std::string key(key_size, '\0');
+    std::string value(data_size - key_size, '\0');
+    u32 next_entry_number;
+    if (!file.ReadBytes(key.data(), key.size()) || !file.ReadBytes(value.data(), value.size()) ||
+        !file.ReadArray(&next_entry_number, 1) || next_entry_number != entry_number + 1)
+    {
+      break;
+    }
+    entry_number = next_entry_number;
+
+    if (!cache->keys.insert(key).second)
+      continue;
+
+    std::string entry(sizeof(value_size), '\0');
+    std::memcpy(entry.data(), &value_size, sizeof(value_size));
+    entry += key;
+    entry += value;
+    cache->entries.push_back(std::move(entry));
+  }
+  return true;
+}
+
+bool WriteCacheFile(const std::string& path, const MergedCache& cache)
+{
+  // Write to a temporary file first, as an input may be the file which is being replaced.
+  const std::string temp_path = path + ".tmp";
+  {
+    File::IOFile file(temp_path, "wb");
+    if (!file.WriteArray(&cache.header, 1))
+      return false;
+
+    u32 entry_number = 0;
+    for (const std::string& entry : cache.entries)
+    {
+      entry_number++;
+      if (!file.WriteBytes(entry.data(), entry.size()) || !file.WriteArray(&entry_number, 1))
+        return false;
+    }
+  }
+  return File::Rename(temp_path, path);
+}
+}  // namespace
+
+int ShaderCacheCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: shadercache [options]... DIRECTORY...");
+
+  parser.description(
+      "Merges the shader caches in the given directories, e.g. the caches of several instances "
+      "and an existing shared cache, into a shared cache which instances can be pointed to with "
+      "the SharedShaderCachePath graphics setting. Entries found in more than one cache are only "
+      "kept once.");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the DIRECTORY to write the merged caches to.")
+      .metavar("DIRECTORY");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& output_path = options["output"];
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<std::string>& input_paths = parser.args();
+  if (input_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  // Caches are matched up by file name, which includes the API, the game ID and the host config.
+  std::map<std::string, MergedCache> caches;
+  for (const std::string& path : Common::DoFileSearch(input_paths, {".cache"}))
+  {
+    MergedCache& cache = caches[PathToFileName(path)];
+    if (!AddCacheFile(path, &cache))
+    {
+      fmt::print(std::cerr,
+                 "Warning: Skipping '{}', it is not a cache from the same Dolphin version as the "
+                 "other caches with this name\n",
+                 path);
+    }
+  }
+
+  if (!File::IsDirectory(output_path) && !File::CreateFullPath(output_path + '/'))
+  {
+    fmt::print(std::cerr, "Error: Unable to create the output directory\n");
+    return EXIT_FAILURE;
+  }
+
+  for (const auto& [file_name, cache] : caches)
+  {
+    if (cache.entries.empty())
+      continue;
+
+    const std::string path = output_path + '/' + file_name;
+    if (!WriteCacheFile(path, cache))
+    {
+      fmt::print(std::cerr, "Error: Unable to write '{}'\n", path);
+      return EXIT_FAILURE;
+    }
+    fmt::print(std::cout, "{}: {} entries\n", file_name, cache.entries.size());
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TexturePackCommand.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TexturePackFile.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DolphinTool
+{
+static bool IsMipLevelFile(std::string_view filename)
+{
+  // Mip levels are loaded as part of the texture they belong to, e.g. tex1_..._mip1.dds
+  const size_t mip_index = filename.rfind("_mip");
+  if (mip_index == std::string_view::npos || mip_index + 4 == filename.size())
+    return false;
+
+  const std::string_view level = filename.substr(mip_index + 4);
+  return std::all_of(level.begin(), level.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+int TexturePackCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texturepack [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the hi-res texture DIRECTORY to pack.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help(fmt::format("Path to the texture pack FILE to write. Place it in a game's texture "
+                        "directory with the '{}' extension for it to be loaded.",
+                        VideoCommon::TexturePackFile::EXTENSION))
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& input_path = options["input"];
+  if (input_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& output_path = options["output"];
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  // Keep compressed DDS data as it is. Whether the backend supports the formats is checked when
+  // the pack is loaded instead.
+  g_ActiveConfig.backend_info.bSupportsST3CTextures = true;
+  g_ActiveConfig.backend_info.bSupportsBPTCTextures = true;
+
+  VideoCommon::TexturePackWriter writer;
+  if (!writer.Open(output_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to open output file\n");
+    return EXIT_FAILURE;
+  }
+
+  auto library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+  std::set<std::string> texture_names;
+  size_t num_failed = 0;
+  for (const std::string& path :
+       Common::DoFileSearch({input_path}, {".png", ".dds"}, /*recursive*/ true))
+  {
+    std::string name;
+    SplitPath(path, nullptr, &name, nullptr);
+    if (!name.starts_with("tex1_") || IsMipLevelFile(name))
+      continue;
+
+    // The same naming rules as for loose hi-res textures apply.
+    const size_t arb_index = name.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      name.erase(arb_index, 4);
+
+    if (!texture_names.insert(name).second)
+    {
+      fmt::print(std::cerr, "Warning: Skipping '{}', texture '{}' was already added\n", path,
+                 name);
+      continue;
+    }
+
+    library->SetAssetIDMapData(name, std::map<std::string, std::filesystem::path>{
+                                         {"texture", StringToPath(path)}});
+    VideoCommon::TextureData data;
+    if (library->LoadGameTexture(name, &data).m_bytes_loaded == 0)
+    {
+      fmt::print(std::cerr, "Warning: Unable to load '{}'\n", path);
+      num_failed++;
+      continue;
+    }
+
+    if (!writer.AddTexture(name, has_arbitrary_mipmaps, data.m_texture))
+    {
+      fmt::print(std::cerr, "Error: Unable to write texture '{}'\n", name);
+      return EXIT_FAILURE;
+    }
+  }
+
+  const size_t num_textures = texture_names.size() - num_failed;
+  if (!writer.Finish())
+  {
+    fmt::print(std::cerr, "Error: Unable to write output file\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Packed {} textures ({:.1f} MiB)\n", num_textures,
+             writer.GetDataSize() / 1048576.0);
+  if (num_failed != 0)
+  {
+    fmt::print(std::cerr, "Error: {} textures could not be loaded\n", num_failed);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -15,15 +15,19 @@
 #include "Core/Core.h"
 
 #include "DolphinTool/ConvertCommand.h"
+#include "DolphinTool/DedupCommand.h"
 #include "DolphinTool/ExtractCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/ShaderCacheCommand.h"
+#include "DolphinTool/TexturePackCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+                        "commands supported: [convert, verify, header, extract, texturepack, "
+                        "dedup, shadercache]\n");
 }
 
 #ifdef _WIN32
@@ -52,6 +56,12 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "texturepack")
+    return DolphinTool::TexturePackCommand(args);
+  else if (command_str == "dedup")
+    return DolphinTool::DedupCommand(args);
+  else if (command_str == "shadercache")
+    return DolphinTool::ShaderCacheCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
@@ -99,6 +99,13 @@ int VerifyCommand(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1"});
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of groups of Wii blocks to decrypt and check at the same time. "
+            "Defaults to the number of hardware threads.")
+      .set_default(0);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -138,6 +145,13 @@ int VerifyCommand(const std::vector<std::string>& args)
     return EXIT_FAILURE;
   }
 
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 0)
+  {
+    fmt::print(std::cerr, "Error: The number of jobs must not be negative\n");
+    return EXIT_FAILURE;
+  }
+
   // Open the volume
   const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
   if (!volume)
@@ -147,7 +161,8 @@ int VerifyCommand(const std::vector<std::string>& args)
   }
 
   // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate,
+                                  static_cast<size_t>(jobs));
   verifier.Start();
   while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
   {
@@ -28,6 +28,7 @@ void ControlReference::UpdateReference(ciface::ExpressionParser::ControlEnvironm
   if (m_parsed_expression)
   {
     m_parsed_expression->UpdateReferences(env);
+    m_compiled_expression.Compile(m_parsed_expression.get());
   }
 }
 
@@ -55,6 +56,7 @@ std::optional<std::string> ControlReference::SetExpression(std::string expr)
   auto parse_result = ParseExpression(m_expression);
   m_parse_status = parse_result.status;
   m_parsed_expression = std::move(parse_result.expr);
+  m_compiled_expression.Compile(m_parsed_expression.get());
   return parse_result.description;
 }
 
@@ -88,7 +90,7 @@ bool OutputReference::IsInput() const
 ControlState InputReference::State(const ControlState ignore)
 {
   if (m_parsed_expression && GetInputGate())
-    return m_parsed_expression->GetValue() * range;
+    return m_compiled_expression.GetValue() * range;
   return 0.0;
 }
 
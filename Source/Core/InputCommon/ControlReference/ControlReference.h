@@ -56,6 +56,9 @@ protected:
   ControlReference();
   std::string m_expression;
   std::unique_ptr<ciface::ExpressionParser::Expression> m_parsed_expression;
+  // What State() evaluates for inputs, rebuilt whenever the parsed expression or its references
+  // change.
+  ciface::ExpressionParser::CompiledExpression m_compiled_expression;
   ciface::ExpressionParser::ParseStatus m_parse_status =
       ciface::ExpressionParser::ParseStatus::EmptyExpression;
 };
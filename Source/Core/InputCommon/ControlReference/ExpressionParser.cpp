@@ -4,6 +4,7 @@
 #include "InputCommon/ControlReference/ExpressionParser.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
 #include <iostream>
@@ -74,6 +75,64 @@ private:
 
 static HotkeySuppressions s_hotkey_suppressions;
 
+static ControlState GetInputValueIgnoringSuppression(Device::Input* input)
+{
+  if (!input)
+    return 0.0;
+
+  // Note: Inputs may return negative values in situations where opposing directions are
+  // activated. We clamp off the negative values here.
+
+  // FYI: Clamping values greater than 1.0 is purposely not done to support unbounded values in
+  // the future. (e.g. raw accelerometer/gyro data)
+
+  return std::max(0.0, input->GetState());
+}
+
+static ControlState GetInputValue(Device::Input* input)
+{
+  if (s_hotkey_suppressions.IsSuppressed(input))
+    return 0;
+  return GetInputValueIgnoringSuppression(input);
+}
+
+// The operators that only depend on the values of their operands.
+static ControlState ApplyBinaryOperator(TokenType op, ControlState lhs, ControlState rhs)
+{
+  switch (op)
+  {
+  case TOK_AND:
+    return std::min(lhs, rhs);
+  case TOK_OR:
+    return std::max(lhs, rhs);
+  case TOK_ADD:
+    return lhs + rhs;
+  case TOK_SUB:
+    return lhs - rhs;
+  case TOK_MUL:
+    return lhs * rhs;
+  case TOK_DIV:
+  {
+    const ControlState result = lhs / rhs;
+    return std::isinf(result) ? 0.0 : result;
+  }
+  case TOK_MOD:
+  {
+    const ControlState result = std::fmod(lhs, rhs);
+    return std::isnan(result) ? 0.0 : result;
+  }
+  case TOK_LTHAN:
+    return lhs < rhs;
+  case TOK_GTHAN:
+    return lhs > rhs;
+  case TOK_XOR:
+    return std::max(std::min(1 - lhs, rhs), std::min(lhs, 1 - rhs));
+  default:
+    ASSERT(false);
+    return 0;
+  }
+}
+
 Token::Token(TokenType type_) : type(type_)
 {
 }
@@ -250,25 +309,11 @@ class ControlExpression : public Expression
 public:
   explicit ControlExpression(ControlQualifier qualifier) : m_qualifier(std::move(qualifier)) {}
 
-  ControlState GetValue() const override
-  {
-    if (s_hotkey_suppressions.IsSuppressed(m_input))
-      return 0;
-    return GetValueIgnoringSuppression();
-  }
+  ControlState GetValue() const override { return GetInputValue(m_input); }
 
   ControlState GetValueIgnoringSuppression() const
   {
-    if (!m_input)
-      return 0.0;
-
-    // Note: Inputs may return negative values in situations where opposing directions are
-    // activated. We clamp off the negative values here.
-
-    // FYI: Clamping values greater than 1.0 is purposely not done to support unbounded values in
-    // the future. (e.g. raw accelerometer/gyro data)
-
-    return std::max(0.0, m_input->GetState());
+    return GetInputValueIgnoringSuppression(m_input);
   }
   void SetValue(ControlState value) override
   {
@@ -283,6 +328,14 @@ public:
     m_output = env.FindOutput(m_qualifier);
   }
 
+  void Compile(CompiledExpression& program) const override
+  {
+    if (m_input)
+      program.EmitInput(m_input);
+    else
+      program.EmitLiteral(0.0);
+  }
+
   Device::Input* GetInput() const { return m_input; };
 
 private:
@@ -348,51 +401,44 @@ public:
   {
     switch (op)
     {
-    case TOK_AND:
-      return std::min(lhs->GetValue(), rhs->GetValue());
-    case TOK_OR:
-      return std::max(lhs->GetValue(), rhs->GetValue());
-    case TOK_ADD:
-      return lhs->GetValue() + rhs->GetValue();
-    case TOK_SUB:
-      return lhs->GetValue() - rhs->GetValue();
-    case TOK_MUL:
-      return lhs->GetValue() * rhs->GetValue();
-    case TOK_DIV:
-    {
-      const ControlState result = lhs->GetValue() / rhs->GetValue();
-      return std::isinf(result) ? 0.0 : result;
-    }
-    case TOK_MOD:
-    {
-      const ControlState result = std::fmod(lhs->GetValue(), rhs->GetValue());
-      return std::isnan(result) ? 0.0 : result;
-    }
     case TOK_ASSIGN:
     {
       // Use this carefully as it's extremely powerful and can end up in unforeseen situations
       lhs->SetValue(rhs->GetValue());
       return lhs->GetValue();
     }
-    case TOK_LTHAN:
-      return lhs->GetValue() < rhs->GetValue();
-    case TOK_GTHAN:
-      return lhs->GetValue() > rhs->GetValue();
     case TOK_COMMA:
     {
       // Eval and discard lhs:
       lhs->GetValue();
       return rhs->GetValue();
     }
-    case TOK_XOR:
+    default:
     {
-      const auto lval = lhs->GetValue();
-      const auto rval = rhs->GetValue();
-      return std::max(std::min(1 - lval, rval), std::min(lval, 1 - rval));
+      const ControlState lval = lhs->GetValue();
+      const ControlState rval = rhs->GetValue();
+      return ApplyBinaryOperator(op, lval, rval);
+    }
     }
+  }
+
+  void Compile(CompiledExpression& program) const override
+  {
+    switch (op)
+    {
+    case TOK_ASSIGN:
+      program.EmitCall(this);
+      break;
+    case TOK_COMMA:
+      lhs->Compile(program);
+      program.EmitPop();
+      rhs->Compile(program);
+      break;
     default:
-      ASSERT(false);
-      return 0;
+      lhs->Compile(program);
+      rhs->Compile(program);
+      program.EmitOperator(op);
+      break;
     }
   }
 
@@ -442,6 +488,8 @@ public:
 
   ControlState GetValue() const override { return m_value; }
 
+  void Compile(CompiledExpression& program) const override { program.EmitLiteral(m_value); }
+
   std::string GetName() const override { return ValueToString(m_value); }
 
 private:
@@ -477,6 +525,14 @@ public:
     m_variable_ptr = env.GetVariablePtr(m_name);
   }
 
+  void Compile(CompiledExpression& program) const override
+  {
+    if (m_variable_ptr)
+      program.EmitVariable(m_variable_ptr.get());
+    else
+      program.EmitLiteral(0.0);
+  }
+
 protected:
   const std::string m_name;
   std::shared_ptr<ControlState> m_variable_ptr;
@@ -590,6 +646,8 @@ public:
     m_rhs->UpdateReferences(env);
   }
 
+  void Compile(CompiledExpression& program) const override { GetActiveChild()->Compile(program); }
+
 private:
   const std::unique_ptr<Expression>& GetActiveChild() const
   {
@@ -600,6 +658,115 @@ private:
   std::unique_ptr<Expression> m_rhs;
 };
 
+void Expression::Compile(CompiledExpression& program) const
+{
+  program.EmitCall(this);
+}
+
+void CompiledExpression::Compile(const Expression* expr)
+{
+  m_instructions.clear();
+  m_stack_depth = 0;
+  m_max_stack_depth = 0;
+
+  if (!expr)
+    return;
+
+  expr->Compile(*this);
+
+  if (m_max_stack_depth > MAX_STACK_DEPTH)
+  {
+    m_instructions.clear();
+    m_stack_depth = 0;
+    m_max_stack_depth = 0;
+    EmitCall(expr);
+  }
+}
+
+ControlState CompiledExpression::GetValue() const
+{
+  if (m_instructions.empty())
+    return 0.0;
+
+  std::array<ControlState, MAX_STACK_DEPTH> stack;
+  ControlState* top = stack.data();
+
+  for (const Instruction& instruction : m_instructions)
+  {
+    switch (instruction.opcode)
+    {
+    case Opcode::Literal:
+      *top++ = instruction.literal;
+      break;
+    case Opcode::Variable:
+      *top++ = *instruction.variable;
+      break;
+    case Opcode::Input:
+      *top++ = GetInputValue(instruction.input);
+      break;
+    case Opcode::Call:
+      *top++ = instruction.expression->GetValue();
+      break;
+    case Opcode::Operator:
+      --top;
+      top[-1] = ApplyBinaryOperator(instruction.op, top[-1], top[0]);
+      break;
+    case Opcode::Pop:
+      --top;
+      break;
+    }
+  }
+
+  return top[-1];
+}
+
+void CompiledExpression::EmitLiteral(ControlState value)
+{
+  Instruction instruction{Opcode::Literal};
+  instruction.literal = value;
+  Emit(instruction, 1);
+}
+
+void CompiledExpression::EmitVariable(const ControlState* variable)
+{
+  Instruction instruction{Opcode::Variable};
+  instruction.variable = variable;
+  Emit(instruction, 1);
+}
+
+void CompiledExpression::EmitInput(Device::Input* input)
+{
+  Instruction instruction{Opcode::Input};
+  instruction.input = input;
+  Emit(instruction, 1);
+}
+
+void CompiledExpression::EmitCall(const Expression* expr)
+{
+  Instruction instruction{Opcode::Call};
+  instruction.expression = expr;
+  Emit(instruction, 1);
+}
+
+void CompiledExpression::EmitOperator(TokenType op)
+{
+  Instruction instruction{Opcode::Operator};
+  instruction.op = op;
+  Emit(instruction, -1);
+}
+
+void CompiledExpression::EmitPop()
+{
+  Emit(Instruction{Opcode::Pop}, -1);
+}
+
+void CompiledExpression::Emit(const Instruction& instruction, int stack_change)
+{
+  m_instructions.push_back(instruction);
+  m_stack_depth += stack_change;
+  m_max_stack_depth = std::max(m_max_stack_depth, m_stack_depth);
+}
+
 std::shared_ptr<Device> ControlEnvironment::FindDevice(const ControlQualifier& qualifier) const
 {
   if (qualifier.has_device)
@@ -7,7 +7,9 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "InputCommon/ControllerInterface/CoreDevice.h"
 
 namespace ciface::ExpressionParser
@@ -164,6 +166,8 @@ private:
   const Core::DeviceQualifier& default_device;
 };
 
+class CompiledExpression;
+
 class Expression
 {
 public:
@@ -172,6 +176,63 @@ public:
   virtual void SetValue(ControlState state) = 0;
   virtual int CountNumControls() const = 0;
   virtual void UpdateReferences(ControlEnvironment& finder) = 0;
+
+  // Appends instructions computing GetValue() to the program.
+  // By default the node is called as is.
+  virtual void Compile(CompiledExpression& program) const;
+};
+
+// A flattened copy of an expression tree, evaluated in a single loop over a small value stack
+// rather than with a virtual call per node. Nodes with side effects or state of their own are kept
+// as calls back into the tree. Control and variable pointers are baked in, so the program must be
+// rebuilt whenever the tree's references are updated.
+class CompiledExpression
+{
+public:
+  enum class Opcode : u8
+  {
+    Literal,
+    Variable,
+    Input,
+    Call,
+    // Replaces the top two values with the result of a binary operator.
+    Operator,
+    // Discards the top value.
+    Pop,
+  };
+
+  struct Instruction
+  {
+    Opcode opcode;
+    union
+    {
+      ControlState literal;
+      const ControlState* variable;
+      Core::Device::Input* input;
+      const Expression* expression;
+      TokenType op;
+    };
+  };
+
+  // Trees that need a deeper stack than this are evaluated as a call to the root instead.
+  static constexpr int MAX_STACK_DEPTH = 16;
+
+  void Compile(const Expression* expr);
+  ControlState GetValue() const;
+
+  void EmitLiteral(ControlState value);
+  void EmitVariable(const ControlState* variable);
+  void EmitInput(Core::Device::Input* input);
+  void EmitCall(const Expression* expr);
+  void EmitOperator(TokenType op);
+  void EmitPop();
+
+private:
+  void Emit(const Instruction& instruction, int stack_change);
+
+  std::vector<Instruction> m_instructions;
+  int m_stack_depth = 0;
+  int m_max_stack_depth = 0;
 };
 
 class ParseResult
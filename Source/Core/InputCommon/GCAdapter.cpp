@@ -13,8 +13,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <mutex>
 #include <optional>
+#include <type_traits>
 
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
 #include <libusb.h>
@@ -28,6 +32,7 @@
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -112,11 +117,61 @@ struct PortState
   GCPadStatus status = {};
 
   ControllerType controller_type = ControllerType::None;
-  bool is_new_connection = false;
+  // Incremented on every new connection, so that the origin is returned once for each.
+  u32 connection_id = 0;
 };
 
-// Only access with s_mutex held!
+// Lets a writer publish a value without ever blocking readers. A reader copies the value and
+// retries if it was modified in the meantime. Writers must be serialized by the caller.
+template <typename T>
+class SeqLock
+{
+  static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+  void Store(const T& value)
+  {
+    std::array<u32, WORD_COUNT> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    const u32 sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORD_COUNT; ++i)
+      m_words[i].store(words[i], std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  T Load() const
+  {
+    std::array<u32, WORD_COUNT> words;
+    u32 sequence;
+    do
+    {
+      sequence = m_sequence.load(std::memory_order_acquire);
+      for (size_t i = 0; i < WORD_COUNT; ++i)
+        words[i] = m_words[i].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) != 0 || sequence != m_sequence.load(std::memory_order_relaxed));
+
+    T value;
+    std::memcpy(&value, words.data(), sizeof(T));
+    return value;
+  }
+
+private:
+  static constexpr size_t WORD_COUNT = (sizeof(T) + sizeof(u32) - 1) / sizeof(u32);
+
+  std::atomic<u32> m_sequence{0};
+  std::array<std::atomic<u32>, WORD_COUNT> m_words{};
+};
+
+// Only access with s_read_mutex held! Changes are published to s_published_port_states, which is
+// what readers use.
 static std::array<PortState, SerialInterface::MAX_SI_CHANNELS> s_port_states;
+static std::array<SeqLock<PortState>, SerialInterface::MAX_SI_CHANNELS> s_published_port_states;
+// The connection_id whose origin was last returned by Input().
+static std::array<std::atomic<u32>, SerialInterface::MAX_SI_CHANNELS> s_origin_connection_ids{};
 
 static std::array<u8, CONTROLLER_OUTPUT_RUMBLE_PAYLOAD_SIZE> s_controller_write_payload;
 static std::atomic<int> s_controller_write_payload_size{0};
@@ -164,6 +219,79 @@ static std::optional<Config::ConfigChangedCallbackID> s_config_callback_id = std
 static bool s_is_adapter_wanted = false;
 static std::array<bool, SerialInterface::MAX_SI_CHANNELS> s_config_rumble_enabled{};
 
+// Only accessed by the read thread.
+static u64 s_last_report_time = 0;
+static u64 s_report_window_start = 0;
+static u32 s_report_interval_count = 0;
+static double s_report_interval_sum = 0;
+static double s_report_interval_square_sum = 0;
+static double s_report_interval_max = 0;
+
+static std::mutex s_report_statistics_mutex;
+static ReportStatistics s_report_statistics;
+static u64 s_report_statistics_time = 0;
+
+static void ClearPortStates()
+{
+  std::lock_guard lk(s_read_mutex);
+
+  for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
+  {
+    s_port_states[chan] = {.connection_id = s_port_states[chan].connection_id};
+    s_published_port_states[chan].Store(s_port_states[chan]);
+  }
+}
+
+static void ResetReportStatistics()
+{
+  s_last_report_time = 0;
+  s_report_window_start = 0;
+
+  std::lock_guard lk(s_report_statistics_mutex);
+  s_report_statistics = {};
+  s_report_statistics_time = 0;
+}
+
+static void RecordReport()
+{
+  const u64 now = Common::Timer::NowUs();
+
+  if (s_last_report_time == 0)
+  {
+    s_report_window_start = now;
+  }
+  else
+  {
+    const double interval = (now - s_last_report_time) / 1000.0;
+    ++s_report_interval_count;
+    s_report_interval_sum += interval;
+    s_report_interval_square_sum += interval * interval;
+    s_report_interval_max = std::max(s_report_interval_max, interval);
+  }
+  s_last_report_time = now;
+
+  if (now - s_report_window_start < 1000000 || s_report_interval_count == 0)
+    return;
+
+  const double mean = s_report_interval_sum / s_report_interval_count;
+  const double variance = s_report_interval_square_sum / s_report_interval_count - mean * mean;
+
+  {
+    std::lock_guard lk(s_report_statistics_mutex);
+    s_report_statistics.rate = s_report_interval_count * 1000000.0 / (now - s_report_window_start);
+    s_report_statistics.mean_interval = mean;
+    s_report_statistics.interval_deviation = std::sqrt(std::max(variance, 0.0));
+    s_report_statistics.max_interval = s_report_interval_max;
+    s_report_statistics_time = now;
+  }
+
+  s_report_window_start = now;
+  s_report_interval_count = 0;
+  s_report_interval_sum = 0;
+  s_report_interval_square_sum = 0;
+  s_report_interval_max = 0;
+}
+
 static void ReadThreadFunc()
 {
   Common::SetCurrentThreadName("GCAdapter Read Thread");
@@ -493,7 +621,8 @@ static void Setup()
   if (s_status == AdapterStatus::Error)
     s_status = AdapterStatus::NotDetected;
 
-  s_port_states.fill({});
+  ClearPortStates();
+  ResetReportStatistics();
   s_controller_rumble.fill(0);
 
   const int ret = s_libusb_context->GetDeviceList([](libusb_device* device) {
@@ -713,7 +842,8 @@ static void Reset()
     s_read_adapter_thread.join();
   // The read thread will close the write thread
 
-  s_port_states.fill({});
+  ClearPortStates();
+  ResetReportStatistics();
 
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
   s_status = AdapterStatus::NotDetected;
@@ -752,20 +882,32 @@ GCPadStatus Input(int chan)
     return {};
 #endif
 
-  std::lock_guard lk(s_read_mutex);
-
-  auto& pad_state = s_port_states[chan];
+  // This is read at every SI poll, so it must not wait for the read thread.
+  const PortState pad_state = s_published_port_states[chan].Load();
 
   // Return the "origin" state for the first input on a new connection.
-  if (pad_state.is_new_connection)
+  u32 origin_connection_id = s_origin_connection_ids[chan].load(std::memory_order_relaxed);
+  if (origin_connection_id != pad_state.connection_id &&
+      s_origin_connection_ids[chan].compare_exchange_strong(origin_connection_id,
+                                                            pad_state.connection_id))
   {
-    pad_state.is_new_connection = false;
     return pad_state.origin;
   }
 
   return pad_state.status;
 }
 
+ReportStatistics GetReportStatistics()
+{
+  std::lock_guard lk(s_report_statistics_mutex);
+
+  // Don't report stale statistics if the reports stopped.
+  if (Common::Timer::NowUs() - s_report_statistics_time > 2000000)
+    return {};
+
+  return s_report_statistics;
+}
+
 // Get ControllerType from first byte in input payload.
 static ControllerType IdentifyControllerType(u8 data)
 {
@@ -861,25 +1003,28 @@ void ProcessInputPayload(const u8* data, std::size_t size)
 
         pad.button |= PAD_GET_ORIGIN;
         pad_state.origin = pad;
-        pad_state.is_new_connection = true;
+        ++pad_state.connection_id;
       }
 
       pad_state.controller_type = type;
       pad_state.status = pad;
+      s_published_port_states[chan].Store(pad_state);
     }
+
+    RecordReport();
   }
 }
 
 bool DeviceConnected(int chan)
 {
-  std::lock_guard lk(s_read_mutex);
-  return s_port_states[chan].controller_type != ControllerType::None;
+  return s_published_port_states[chan].Load().controller_type != ControllerType::None;
 }
 
 void ResetDeviceType(int chan)
 {
   std::lock_guard lk(s_read_mutex);
   s_port_states[chan].controller_type = ControllerType::None;
+  s_published_port_states[chan].Store(s_port_states[chan]);
 }
 
 bool UseAdapter()
@@ -950,7 +1095,7 @@ void Output(int chan, u8 rumble_command)
 
   // Skip over rumble commands if it has not changed or the controller is wireless
   if (rumble_command != s_controller_rumble[chan] &&
-      s_port_states[chan].controller_type != ControllerType::Wireless)
+      s_published_port_states[chan].Load().controller_type != ControllerType::Wireless)
   {
     s_controller_rumble[chan] = rumble_command;
     std::array<u8, CONTROLLER_OUTPUT_RUMBLE_PAYLOAD_SIZE> rumble = {
@@ -11,6 +11,16 @@ struct GCPadStatus;
 
 namespace GCAdapter
 {
+struct ReportStatistics
+{
+  // Input reports received per second.
+  double rate = 0;
+  // The mean, standard deviation and maximum of the time between reports, in milliseconds.
+  double mean_interval = 0;
+  double interval_deviation = 0;
+  double max_interval = 0;
+};
+
 void Init();
 void ResetRumble();
 void Shutdown();
@@ -28,4 +38,7 @@ bool DeviceConnected(int chan);
 void ResetDeviceType(int chan);
 bool UseAdapter();
 
+// Statistics of the reports received over the last second, or all zeros if none were received.
+ReportStatistics GetReportStatistics();
+
 }  // namespace GCAdapter
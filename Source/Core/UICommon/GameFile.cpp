@@ -7,12 +7,14 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -104,6 +106,7 @@ GameFile::GameFile() = default;
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  std::tie(m_disk_size, m_modification_time) = GetDiskSizeAndModificationTime(m_file_path);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -291,6 +294,23 @@ void GameCover::DoState(PointerWrap& p)
   p.Do(buffer);
 }
 
+std::pair<u64, s64> GameFile::GetDiskSizeAndModificationTime(const std::string& path)
+{
+  std::error_code error;
+  const std::filesystem::path native_path = StringToPath(path);
+  const auto modification_time = std::filesystem::last_write_time(native_path, error);
+  if (error)
+    return {0, 0};
+
+  return {File::GetSize(path), static_cast<s64>(modification_time.time_since_epoch().count())};
+}
+
+bool GameFile::IsOutdated() const
+{
+  return GetDiskSizeAndModificationTime(m_file_path) !=
+         std::make_pair(m_disk_size, m_modification_time);
+}
+
 void GameFile::DoState(PointerWrap& p)
 {
   p.Do(m_valid);
@@ -298,6 +318,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_file_name);
 
   p.Do(m_file_size);
+  p.Do(m_disk_size);
+  p.Do(m_modification_time);
   p.Do(m_volume_size);
   p.Do(m_volume_size_type);
   p.Do(m_is_datel_disc);
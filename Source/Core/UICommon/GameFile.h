@@ -6,6 +6,7 @@
 #include <array>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -112,6 +113,9 @@ public:
   const GameBanner& GetBannerImage() const;
   const GameCover& GetCoverImage() const;
   void DoState(PointerWrap& p);
+  // Returns true if the file on disk has been modified or replaced since this GameFile was
+  // created, going by its size and modification time. This doesn't open the file.
+  bool IsOutdated() const;
   bool XMLMetadataChanged();
   void XMLMetadataCommit();
   bool WiiBannerChanged();
@@ -136,6 +140,7 @@ private:
   bool ReadPNGBanner(const std::string& path);
   bool TryLoadGameModDescriptorBanner();
   bool CheckIfTwoDiscGame(const std::string& game_id) const;
+  static std::pair<u64, s64> GetDiskSizeAndModificationTime(const std::string& path);
 
   // IMPORTANT: Nearly all data members must be save/restored in DoState.
   // If anything is changed, make sure DoState handles it properly and
@@ -146,6 +151,9 @@ private:
   std::string m_file_name;
 
   u64 m_file_size{};
+  // The size and modification time of the file at m_file_path, used by IsOutdated
+  u64 m_disk_size{};
+  s64 m_modification_time{};
   u64 m_volume_size{};
   DiscIO::DataSizeType m_volume_size_type{};
   bool m_is_datel_disc{};
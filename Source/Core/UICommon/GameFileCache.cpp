@@ -5,11 +5,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <functional>
+#include <future>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -26,7 +30,33 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 25;  // Last changed in PR 12702
+static constexpr u32 CACHE_REVISION = 26;
+
+// How many game files are scanned at the same time. Scanning is mostly bound by I/O latency, but
+// running too many scans at once would just make them compete for the disk.
+static constexpr size_t MAX_CONCURRENT_SCANS = 8;
+
+// Calls work(i) for every i in [0, count) on up to MAX_CONCURRENT_SCANS threads, and calls
+// handle_result with the results on the calling thread, in order.
+template <typename WorkFn, typename HandleResultFn>
+static void ForEachConcurrently(size_t count, const WorkFn& work,
+                                const HandleResultFn& handle_result,
+                                const std::atomic_bool& processing_halted)
+{
+  std::deque<std::future<std::invoke_result_t<WorkFn, size_t>>> futures;
+  size_t next = 0;
+  while (next < count || !futures.empty())
+  {
+    while (next < count && futures.size() < MAX_CONCURRENT_SCANS && !processing_halted)
+      futures.push_back(std::async(std::launch::async, work, next++));
+
+    if (futures.empty())
+      break;
+
+    handle_result(futures.front().get());
+    futures.pop_front();
+  }
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -112,8 +142,10 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
       if (processing_halted)
         break;
 
-      if (game_paths.erase((*it)->GetFilePath()))
+      // Files which have been modified on disk are removed here and scanned again below.
+      if (game_paths.contains((*it)->GetFilePath()) && !(*it)->IsOutdated())
       {
+        game_paths.erase((*it)->GetFilePath());
         ++it;
       }
       else
@@ -131,21 +163,20 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
-  {
-    if (processing_halted)
-      break;
-
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
-
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
-    }
-  }
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  ForEachConcurrently(
+      new_paths.size(), [&new_paths](size_t i) { return std::make_shared<GameFile>(new_paths[i]); },
+      [&](std::shared_ptr<GameFile> file) {
+        if (file->IsValid())
+        {
+          if (game_added_to_cache)
+            game_added_to_cache(file);
+
+          cache_changed = true;
+          m_cached_files.push_back(std::move(file));
+        }
+      },
+      processing_halted);
 
   return cache_changed;
 }
@@ -155,16 +186,25 @@ bool GameFileCache::UpdateAdditionalMetadata(const GameUpdatedFn& game_updated,
 {
   bool cache_changed = false;
 
-  for (std::shared_ptr<GameFile>& file : m_cached_files)
-  {
-    if (processing_halted)
-      break;
+  // Work on copies of the pointers, so that m_cached_files is only touched on this thread.
+  ForEachConcurrently(
+      m_cached_files.size(),
+      [this](size_t i) {
+        std::shared_ptr<GameFile> file = m_cached_files[i];
+        const bool updated = UpdateAdditionalMetadata(&file);
+        return std::make_tuple(i, updated, std::move(file));
+      },
+      [&](std::tuple<size_t, bool, std::shared_ptr<GameFile>> result) {
+        auto& [i, updated, file] = result;
+        if (!updated)
+          return;
 
-    const bool updated = UpdateAdditionalMetadata(&file);
-    cache_changed |= updated;
-    if (game_updated && updated)
-      game_updated(file);
-  }
+        cache_changed = true;
+        m_cached_files[i] = std::move(file);
+        if (game_updated)
+          game_updated(m_cached_files[i]);
+      },
+      processing_halted);
 
   return cache_changed;
 }
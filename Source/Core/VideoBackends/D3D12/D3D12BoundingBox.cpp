@@ -26,36 +26,63 @@ bool D3D12BoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
+void D3D12BoundingBox::CopyToReadbackBuffer()
 {
-  // Copy from GPU->CPU buffer, and wait for the GPU to finish the copy.
   ResourceBarrier(g_dx_context->GetCommandList(), m_gpu_buffer.Get(),
                   D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE);
   g_dx_context->GetCommandList()->CopyBufferRegion(m_readback_buffer.Get(), 0, m_gpu_buffer.Get(),
                                                    0, BUFFER_SIZE);
   ResourceBarrier(g_dx_context->GetCommandList(), m_gpu_buffer.Get(),
                   D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-  Gfx::GetInstance()->ExecuteCommandList(true);
+}
 
-  // Read back to cached values.
-  std::vector<BBoxType> values(length);
+bool D3D12BoundingBox::ReadFromReadbackBuffer(u32 index, std::span<BBoxType> values)
+{
   static constexpr D3D12_RANGE read_range = {0, BUFFER_SIZE};
   void* mapped_pointer;
   HRESULT hr = m_readback_buffer->Map(0, &read_range, &mapped_pointer);
   ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Map bounding box CPU buffer failed: {}", DX12HRWrap(hr));
   if (FAILED(hr))
-    return values;
+    return false;
 
   // Copy out the values we want
   std::memcpy(values.data(), reinterpret_cast<const u8*>(mapped_pointer) + sizeof(BBoxType) * index,
-              sizeof(BBoxType) * length);
+              values.size_bytes());
 
   static constexpr D3D12_RANGE write_range = {0, 0};
   m_readback_buffer->Unmap(0, &write_range);
+  return true;
+}
+
+std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
+{
+  // Copy from GPU->CPU buffer, and wait for the GPU to finish the copy.
+  CopyToReadbackBuffer();
+  Gfx::GetInstance()->ExecuteCommandList(true);
 
+  // Read back to cached values.
+  std::vector<BBoxType> values(length);
+  ReadFromReadbackBuffer(index, values);
   return values;
 }
 
+bool D3D12BoundingBox::QueueRead()
+{
+  // Submit the copy straight away, but don't wait for it.
+  CopyToReadbackBuffer();
+  m_queued_read_fence_value = g_dx_context->GetCurrentFenceValue();
+  Gfx::GetInstance()->ExecuteCommandList(false);
+  return true;
+}
+
+bool D3D12BoundingBox::TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values)
+{
+  if (!g_dx_context->IsFenceComplete(m_queued_read_fence_value))
+    return false;
+
+  return ReadFromReadbackBuffer(0, values);
+}
+
 void D3D12BoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   const u32 copy_size = static_cast<u32>(values.size() * sizeof(BBoxType));
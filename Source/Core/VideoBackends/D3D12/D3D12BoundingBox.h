@@ -22,6 +22,8 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueRead() override;
+  bool TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values) override;
 
 private:
   static constexpr u32 BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
@@ -29,12 +31,15 @@ private:
   static constexpr u32 STREAM_BUFFER_SIZE = BUFFER_SIZE * MAX_UPDATES_PER_FRAME;
 
   bool CreateBuffers();
+  void CopyToReadbackBuffer();
+  bool ReadFromReadbackBuffer(u32 index, std::span<BBoxType> values);
 
   // Three buffers: GPU for read/write, CPU for reading back, and CPU for staging changes.
   ComPtr<ID3D12Resource> m_gpu_buffer;
   ComPtr<ID3D12Resource> m_readback_buffer;
   StreamBuffer m_upload_buffer;
   DescriptorHandle m_gpu_descriptor{};
+  u64 m_queued_read_fence_value = 0;
 };
 
 }  // namespace DX12
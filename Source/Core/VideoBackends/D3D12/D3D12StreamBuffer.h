@@ -3,53 +3,38 @@
 
 #pragma once
 
-#include <deque>
-#include <utility>
-
 #include "Common/CommonTypes.h"
 #include "VideoBackends/D3D12/Common.h"
+#include "VideoCommon/StreamBufferBase.h"
 
 namespace DX12
 {
-class StreamBuffer
+class StreamBuffer final : public StreamBufferBase
 {
 public:
   StreamBuffer();
-  ~StreamBuffer();
+  ~StreamBuffer() override;
 
   bool AllocateBuffer(u32 size);
 
   ID3D12Resource* GetBuffer() const { return m_buffer; }
   D3D12_GPU_VIRTUAL_ADDRESS GetGPUPointer() const { return m_gpu_pointer; }
-  u8* GetHostPointer() const { return m_host_pointer; }
-  u8* GetCurrentHostPointer() const { return m_host_pointer + m_current_offset; }
   D3D12_GPU_VIRTUAL_ADDRESS GetCurrentGPUPointer() const
   {
-    return m_gpu_pointer + m_current_offset;
+    return m_gpu_pointer + GetCurrentOffset();
   }
-  u32 GetSize() const { return m_size; }
-  u32 GetCurrentOffset() const { return m_current_offset; }
-  bool ReserveMemory(u32 num_bytes, u32 alignment);
-  void CommitMemory(u32 final_num_bytes);
-
-private:
-  void UpdateCurrentFencePosition();
-  void UpdateGPUPosition();
 
-  // Waits for as many fences as needed to allocate num_bytes bytes from the buffer.
-  bool WaitForClearSpace(u32 num_bytes);
+protected:
+  u64 GetCurrentFenceCounter() const override;
+  u64 GetCompletedFenceCounter() const override;
+  void WaitForFenceCounter(u64 fence_counter) override;
+  bool ResizeBuffer(u32 new_size) override;
 
-  u32 m_size = 0;
-  u32 m_current_offset = 0;
-  u32 m_current_gpu_position = 0;
-  u32 m_last_allocation_size = 0;
+private:
+  void UnmapBuffer();
 
   ID3D12Resource* m_buffer = nullptr;
   D3D12_GPU_VIRTUAL_ADDRESS m_gpu_pointer = {};
-  u8* m_host_pointer = nullptr;
-
-  // List of fences and the corresponding positions in the buffer
-  std::deque<std::pair<u64, u32>> m_tracked_fences;
 };
 
 }  // namespace DX12
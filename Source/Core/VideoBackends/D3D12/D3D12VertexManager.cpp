@@ -42,6 +42,10 @@ bool VertexManager::Initialize()
     return false;
   }
 
+  // The index buffer is bound for every draw, so it can be reallocated. The vertex buffer can't,
+  // since the SRV used for manual vertex fetch is only created once.
+  m_index_stream_buffer.SetMaximumSize(INDEX_STREAM_BUFFER_SIZE * MAX_STREAM_BUFFER_GROWTH);
+
   static constexpr std::array<std::pair<TexelBufferFormat, DXGI_FORMAT>, NUM_TEXEL_BUFFER_FORMATS>
       format_mapping = {{
           {TEXEL_BUFFER_FORMAT_R8_UINT, DXGI_FORMAT_R8_UINT},
@@ -99,6 +99,13 @@ public:
   // Last "completed" fence.
   u64 GetCompletedFenceValue() const { return m_completed_fence_value; }
 
+  // Checks whether the GPU has reached a fence, without waiting for it. This doesn't update the
+  // completed fence value, since resources are only cleaned up when waiting.
+  bool IsFenceComplete(u64 fence) const
+  {
+    return m_completed_fence_value >= fence || m_fence->GetCompletedValue() >= fence;
+  }
+
   // Texture streaming buffer for uploads.
   StreamBuffer& GetTextureUploadBuffer() { return m_texture_upload_buffer; }
 
@@ -47,6 +47,45 @@ bool DescriptorAllocator::Allocate(u32 num_handles, DescriptorHandle* out_base_h
 void DescriptorAllocator::Reset()
 {
   m_current_offset = 0;
+  m_texture_table_map.clear();
+}
+
+bool operator<(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs)
+{
+  return std::memcmp(lhs.handles.data(), rhs.handles.data(), sizeof(lhs.handles)) < 0;
+}
+
+bool DescriptorAllocator::GetTextureTableHandle(const TextureDescriptorSet& tds,
+                                                const DescriptorHeapManager& source_heap,
+                                                D3D12_GPU_DESCRIPTOR_HANDLE* handle)
+{
+  // A freed slot can be handed to a new texture, at which point our copy is stale.
+  if (m_texture_table_free_counter != source_heap.GetFreeCounter())
+  {
+    m_texture_table_map.clear();
+    m_texture_table_free_counter = source_heap.GetFreeCounter();
+  }
+
+  auto it = m_texture_table_map.find(tds);
+  if (it != m_texture_table_map.end())
+  {
+    *handle = it->second;
+    return true;
+  }
+
+  DescriptorHandle allocation;
+  if (!Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, &allocation))
+    return false;
+
+  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> source_sizes = {
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+  const UINT dest_size = VideoCommon::MAX_PIXEL_SHADER_SAMPLERS;
+  g_dx_context->GetDevice()->CopyDescriptors(
+      1, &allocation.cpu_handle, &dest_size, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
+      tds.handles.data(), source_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  *handle = allocation.gpu_handle;
+  m_texture_table_map.emplace(tds, allocation.gpu_handle);
+  return true;
 }
 
 bool operator==(const SamplerStateSet& lhs, const SamplerStateSet& rhs)
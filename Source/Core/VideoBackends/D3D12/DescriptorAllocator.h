@@ -3,12 +3,20 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
 #include "VideoCommon/Constants.h"
 
 namespace DX12
 {
+struct TextureDescriptorSet final
+{
+  std::array<D3D12_CPU_DESCRIPTOR_HANDLE, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> handles;
+};
+
+bool operator<(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs);
+
 class DescriptorAllocator
 {
 public:
@@ -23,6 +31,11 @@ public:
   bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
   void Reset();
 
+  // Copies the texture descriptors into a table, or reuses the table from an earlier call with the
+  // same descriptors since the last reset. The source descriptors live in source_heap.
+  bool GetTextureTableHandle(const TextureDescriptorSet& tds, const DescriptorHeapManager& source_heap,
+                             D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+
 protected:
   ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
   u32 m_descriptor_increment_size = 0;
@@ -31,6 +44,10 @@ protected:
 
   D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu = {};
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
+
+private:
+  std::map<TextureDescriptorSet, D3D12_GPU_DESCRIPTOR_HANDLE> m_texture_table_map;
+  u64 m_texture_table_free_counter = 0;
 };
 
 struct SamplerStateSet final
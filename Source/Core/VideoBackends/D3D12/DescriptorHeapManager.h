@@ -35,6 +35,10 @@ public:
   void Free(const DescriptorHandle& handle);
   void Free(u32 index);
 
+  // Increases every time a descriptor is freed, so that copies of descriptors made earlier can
+  // tell whether the slot they were copied from may since have been reused.
+  u64 GetFreeCounter() const { return m_free_counter; }
+
 private:
   ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
   u32 m_num_descriptors = 0;
@@ -45,6 +49,7 @@ private:
   static constexpr u32 BITSET_SIZE = 1024;
   using BitSetType = std::bitset<BITSET_SIZE>;
   std::vector<BitSetType> m_free_slots = {};
+  u64 m_free_counter = 0;
 };
 
 class SamplerHeapManager final
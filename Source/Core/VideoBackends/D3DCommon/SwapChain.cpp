@@ -44,6 +44,9 @@ SwapChain::~SwapChain()
   // Can't destroy swap chain while it's fullscreen.
   if (m_swap_chain && GetFullscreenState(m_swap_chain.Get()))
     m_swap_chain->SetFullscreenState(FALSE, nullptr);
+
+  if (m_frame_latency_waitable_object)
+    CloseHandle(m_frame_latency_waitable_object);
 }
 
 bool SwapChain::WantsStereo()
@@ -59,7 +62,13 @@ bool SwapChain::WantsHDR()
 u32 SwapChain::GetSwapChainFlags() const
 {
   // This flag is necessary if we want to use a flip-model swapchain without locking the framerate
-  return m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+  u32 flags = m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+
+  // This has to match between creating the swap chain and resizing it.
+  if (m_frame_latency_waitable)
+    flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+  return flags;
 }
 
 bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
@@ -80,6 +89,7 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
   if (SUCCEEDED(hr))
   {
     m_allow_tearing_supported = IsTearingSupported(dxgi_factory2.Get());
+    m_frame_latency_waitable = g_ActiveConfig.bLowLatencyPacing;
 
     DXGI_SWAP_CHAIN_DESC1 swap_chain_desc = {};
     swap_chain_desc.Width = m_width;
@@ -133,6 +143,7 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
     desc.Flags = 0;
 
     m_allow_tearing_supported = false;
+    m_frame_latency_waitable = false;
     hr = m_dxgi_factory->CreateSwapChain(m_d3d_device.Get(), &desc, &m_swap_chain);
   }
 
@@ -150,6 +161,17 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
 
   m_stereo = stereo;
 
+  if (m_frame_latency_waitable)
+  {
+    Microsoft::WRL::ComPtr<IDXGISwapChain2> swap_chain2;
+    hr = m_swap_chain.As(&swap_chain2);
+    if (SUCCEEDED(hr))
+    {
+      swap_chain2->SetMaximumFrameLatency(1);
+      m_frame_latency_waitable_object = swap_chain2->GetFrameLatencyWaitableObject();
+    }
+  }
+
   if (hdr)
   {
     // Only try to activate HDR here, to avoid failing when creating the swapchain
@@ -199,6 +221,12 @@ void SwapChain::DestroySwapChain()
   if (m_swap_chain && GetFullscreenState(m_swap_chain.Get()))
     m_swap_chain->SetFullscreenState(FALSE, nullptr);
 
+  if (m_frame_latency_waitable_object)
+  {
+    CloseHandle(m_frame_latency_waitable_object);
+    m_frame_latency_waitable_object = nullptr;
+  }
+
   m_swap_chain.Reset();
 }
 
@@ -309,6 +337,11 @@ bool SwapChain::Present()
     return false;
   }
 
+  // Block until the frame which was just queued has been picked up, so that the next frame doesn't
+  // start rendering until it can be shown without waiting behind this one.
+  if (m_frame_latency_waitable_object)
+    WaitForSingleObjectEx(m_frame_latency_waitable_object, 1000, TRUE);
+
   return true;
 }
 
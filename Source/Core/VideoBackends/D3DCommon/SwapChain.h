@@ -71,6 +71,9 @@ protected:
   bool m_stereo = false;
   bool m_hdr = false;
   bool m_allow_tearing_supported = false;
+  // Limits the presentation queue to a single frame, and waits for space in it after presenting.
+  bool m_frame_latency_waitable = false;
+  HANDLE m_frame_latency_waitable_object = nullptr;
   bool m_has_fullscreen = false;
   bool m_fullscreen_request = false;
 };
@@ -19,9 +19,12 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueRead() override;
+  bool TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values) override;
 
 private:
   BBoxType* m_cpu_buffer_ptr;
+  u64 m_queued_read_draw = 0;
   MRCOwned<id<MTLFence>> m_download_fence;
   MRCOwned<id<MTLFence>> m_upload_fence;
   MRCOwned<id<MTLBuffer>> m_cpu_buffer;
@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Metal/MTLBoundingBox.h"
 
+#include <algorithm>
+
 #include "VideoBackends/Metal/MTLObjectCache.h"
 #include "VideoBackends/Metal/MTLStateTracker.h"
 
@@ -42,6 +44,31 @@ std::vector<BBoxType> Metal::BoundingBox::Read(u32 index, u32 length)
   }
 }
 
+bool Metal::BoundingBox::QueueRead()
+{
+  // The buffer is shared with the CPU, so all that's needed is to get the pending draws to the GPU
+  // and note which command buffer they're in.
+  @autoreleasepool
+  {
+    m_queued_read_draw = g_state_tracker->GetCurrentDraw();
+    if (!g_state_tracker->HasUnflushedData())
+      m_queued_read_draw--;
+    g_state_tracker->FlushEncoders();
+    return true;
+  }
+}
+
+bool Metal::BoundingBox::TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values)
+{
+  if (g_state_tracker->GetLastFinishedDraw() < m_queued_read_draw)
+    return false;
+
+  // Later command buffers may still be updating the values. That's fine, since they only ever
+  // widen the box, and the result is speculative anyway.
+  std::copy_n(m_cpu_buffer_ptr, values.size(), values.begin());
+  return true;
+}
+
 void Metal::BoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   const u32 size = values.size() * sizeof(BBoxType);
@@ -138,7 +138,13 @@ std::unique_ptr<AbstractShader> Metal::Gfx::CreateShaderFromBinary(ShaderStage s
                                                                    const void* data, size_t length,
                                                                    std::string_view name)
 {
-  return CreateShaderFromMSL(stage, std::string(static_cast<const char*>(data), length), {}, name);
+  std::string msl(static_cast<const char*>(data), length);
+  // Shaders translated for a different device or OS version are silently dropped from the cache,
+  // and regenerated from source when they're next needed.
+  if (!msl.starts_with(Util::GetMSLTranslationTag()))
+    return nullptr;
+
+  return CreateShaderFromMSL(stage, std::move(msl), {}, name);
 }
 
 // clang-format off
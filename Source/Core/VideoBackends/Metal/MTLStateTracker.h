@@ -74,6 +74,9 @@ public:
   {
     return m_current_draw != 1 + m_last_finished_draw.load(std::memory_order_acquire);
   }
+  // Draw counters of the command buffer being recorded and of the last one the GPU finished.
+  u64 GetCurrentDraw() const { return m_current_draw; }
+  u64 GetLastFinishedDraw() const { return m_last_finished_draw.load(std::memory_order_acquire); }
   void ReloadSamplers();
   void NotifyOfCPUGPUSync()
   {
@@ -238,6 +241,10 @@ private:
     id<MTLRenderPipelineState> pipeline;
     std::array<id<MTLBuffer>, 2> vertex_buffers;
     std::array<id<MTLBuffer>, 3> fragment_buffers;
+    std::array<id<MTLTexture>, MAX_TEXTURES> textures;
+    std::array<id<MTLSamplerState>, MAX_SAMPLERS> samplers;
+    std::array<float, MAX_SAMPLERS> sampler_min_lod;
+    std::array<float, MAX_SAMPLERS> sampler_max_lod;
     u32 width;
     u32 height;
     MathUtil::Rectangle<int> scissor_rect;
@@ -324,6 +324,7 @@ void Metal::StateTracker::BeginRenderPass(MTLRenderPassDescriptor* descriptor)
     [descriptor setVisibilityResultBuffer:m_current_perf_query->buffer];
   m_current_render_encoder =
       MRCRetain([GetRenderCmdBuf() renderCommandEncoderWithDescriptor:descriptor]);
+  INCSTAT(g_stats.this_frame.num_render_passes);
   if (m_current_perf_query)
     [descriptor setVisibilityResultBuffer:nil];
   if (m_manual_buffer_upload)
@@ -786,17 +787,49 @@ void Metal::StateTracker::PrepareRender()
   if (u32 dirty = m_dirty_textures & pipe->GetTextures())
   {
     m_dirty_textures &= ~pipe->GetTextures();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    // Games often swap a texture out and back in between draws, skip slots where the encoder
+    // already has what we want.
+    for (u32 bits = dirty; bits; bits &= bits - 1)
+    {
+      const int idx = std::countr_zero(bits);
+      if (m_state.textures[idx] == m_current.textures[idx])
+        dirty &= ~(1u << idx);
+    }
+    if (dirty)
+    {
+      NSRange range = RangeOfBits(dirty);
+      std::copy_n(&m_state.textures[range.location], range.length,
+                  &m_current.textures[range.location]);
+      [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    }
   }
   if (u32 dirty = m_dirty_samplers & pipe->GetSamplers())
   {
     m_dirty_samplers &= ~pipe->GetSamplers();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentSamplerStates:&m_state.samplers[range.location]
-                     lodMinClamps:&m_state.sampler_min_lod[range.location]
-                     lodMaxClamps:&m_state.sampler_max_lod[range.location]
-                        withRange:range];
+    for (u32 bits = dirty; bits; bits &= bits - 1)
+    {
+      const int idx = std::countr_zero(bits);
+      if (m_state.samplers[idx] == m_current.samplers[idx] &&
+          m_state.sampler_min_lod[idx] == m_current.sampler_min_lod[idx] &&
+          m_state.sampler_max_lod[idx] == m_current.sampler_max_lod[idx])
+      {
+        dirty &= ~(1u << idx);
+      }
+    }
+    if (dirty)
+    {
+      NSRange range = RangeOfBits(dirty);
+      std::copy_n(&m_state.samplers[range.location], range.length,
+                  &m_current.samplers[range.location]);
+      std::copy_n(&m_state.sampler_min_lod[range.location], range.length,
+                  &m_current.sampler_min_lod[range.location]);
+      std::copy_n(&m_state.sampler_max_lod[range.location], range.length,
+                  &m_current.sampler_max_lod[range.location]);
+      [enc setFragmentSamplerStates:&m_state.samplers[range.location]
+                       lodMinClamps:&m_state.sampler_min_lod[range.location]
+                       lodMaxClamps:&m_state.sampler_max_lod[range.location]
+                          withRange:range];
+    }
   }
   if (m_state.perf_query_group != m_current.perf_query_group)
   {
@@ -54,6 +54,9 @@ static inline bool HasStencil(AbstractTextureFormat format)
 }
 
 std::optional<std::string> TranslateShaderToMSL(ShaderStage stage, std::string_view source);
+/// The first line of all translated MSL, identifying the features and workarounds it was
+/// translated with. Cached MSL which doesn't start with the current tag must be regenerated.
+std::string GetMSLTranslationTag();
 
 }  // namespace Util
 }  // namespace Metal
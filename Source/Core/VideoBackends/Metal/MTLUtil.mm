@@ -5,8 +5,10 @@
 
 #include <fstream>
 #include <string>
+#include <utility>
 
 #include <TargetConditionals.h>
+#include <fmt/format.h>
 #include <spirv_msl.hpp>
 
 #include "Common/MsgHandler.h"
@@ -67,7 +69,7 @@ void Metal::Util::PopulateBackendInfo(VideoConfig* config)
   config->backend_info.bSupportsLargePoints = true;
   config->backend_info.bSupportsPartialDepthCopies = true;
   config->backend_info.bSupportsDepthReadback = true;
-  config->backend_info.bSupportsShaderBinaries = false;
+  config->backend_info.bSupportsShaderBinaries = true;
   config->backend_info.bSupportsPipelineCacheData = false;
   config->backend_info.bSupportsCoarseDerivatives = false;
   config->backend_info.bSupportsTextureQueryLevels = true;
@@ -498,6 +500,31 @@ MakeResourceBinding(spv::ExecutionModel stage, u32 set, u32 binding,  //
   return resource;
 }
 
+// Bump this whenever the translation changes in a way which isn't covered by the tag below, so
+// shader caches written by older versions are ignored.
+static constexpr u32 MSL_TRANSLATION_VERSION = 1;
+
+static std::pair<u32, u32> GetMSLVersion()
+{
+  if (@available(macOS 11, iOS 14, *))
+    return {2, 3};
+  else if (@available(macOS 10.15, iOS 13, *))
+    return {2, 2};
+  else if (@available(macOS 10.14, iOS 12, *))
+    return {2, 1};
+  else
+    return {2, 0};
+}
+
+std::string Metal::Util::GetMSLTranslationTag()
+{
+  const auto [major, minor] = GetMSLVersion();
+  return fmt::format("// Dolphin MSL v{} msl{}.{} subgroup{} helper{} discard{}\n",
+                     MSL_TRANSLATION_VERSION, major, minor, g_features.subgroup_ops,
+                     DriverDetails::HasBug(DriverDetails::BUG_INVERTED_IS_HELPER),
+                     DriverDetails::HasBug(DriverDetails::BUG_BROKEN_SUBGROUP_OPS_WITH_DISCARD));
+}
+
 std::optional<std::string> Metal::Util::TranslateShaderToMSL(ShaderStage stage,
                                                              std::string_view source)
 {
@@ -566,14 +593,8 @@ std::optional<std::string> Metal::Util::TranslateShaderToMSL(ShaderStage stage,
 
   spirv_cross::CompilerMSL compiler(std::move(*code));
 
-  if (@available(macOS 11, iOS 14, *))
-    options.set_msl_version(2, 3);
-  else if (@available(macOS 10.15, iOS 13, *))
-    options.set_msl_version(2, 2);
-  else if (@available(macOS 10.14, iOS 12, *))
-    options.set_msl_version(2, 1);
-  else
-    options.set_msl_version(2, 0);
+  const auto [msl_major, msl_minor] = GetMSLVersion();
+  options.set_msl_version(msl_major, msl_minor);
   options.use_framebuffer_fetch_subpasses = true;
   compiler.set_msl_options(options);
 
@@ -603,7 +624,8 @@ std::optional<std::string> Metal::Util::TranslateShaderToMSL(ShaderStage stage,
     }
   }
 
-  std::string output(MSL_HEADER);
+  std::string output = GetMSLTranslationTag();
+  output += MSL_HEADER;
   std::string compiled = compiler.compile();
   std::string_view remaining = compiled;
   while (!remaining.empty())
@@ -3,6 +3,8 @@
 
 #include "VideoBackends/OGL/OGLBoundingBox.h"
 
+#include <algorithm>
+
 #include "VideoBackends/OGL/OGLGfx.h"
 #include "VideoCommon/DriverDetails.h"
 
@@ -12,6 +14,8 @@ OGLBoundingBox::~OGLBoundingBox()
 {
   if (m_buffer_id)
     glDeleteBuffers(1, &m_buffer_id);
+  if (m_read_fence)
+    glDeleteSync(m_read_fence);
 }
 
 bool OGLBoundingBox::Initialize()
@@ -66,6 +70,36 @@ std::vector<BBoxType> OGLBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool OGLBoundingBox::QueueRead()
+{
+  if (m_read_fence)
+    glDeleteSync(m_read_fence);
+  m_read_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  // Make sure the commands actually get to the GPU before the fence is polled.
+  glFlush();
+  return true;
+}
+
+bool OGLBoundingBox::TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values)
+{
+  if (!m_read_fence)
+    return false;
+
+  const GLenum status = glClientWaitSync(m_read_fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+    return false;
+
+  glDeleteSync(m_read_fence);
+  m_read_fence = nullptr;
+
+  // Reading the buffer won't have to wait for the GPU now, unless draws after the fence are still
+  // updating it. Those only ever widen the box, so there's no need to snapshot the values.
+  const std::vector<BBoxType> read_values = Read(0, NUM_BBOX_VALUES);
+  std::copy(read_values.begin(), read_values.end(), values.begin());
+  return true;
+}
+
 void OGLBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_buffer_id);
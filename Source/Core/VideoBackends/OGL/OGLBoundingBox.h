@@ -20,9 +20,14 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueRead() override;
+  bool TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values) override;
 
 private:
   GLuint m_buffer_id = 0;
+
+  // Signaled once the draws before the last QueueRead() have reached the buffer.
+  GLsync m_read_fence = nullptr;
 };
 
 }  // namespace OGL
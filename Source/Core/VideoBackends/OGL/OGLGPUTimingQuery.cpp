@@ -0,0 +1,69 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/OGL/OGLGPUTimingQuery.h"
+
+#include "VideoBackends/OGL/GPUTimer.h"
+#include "VideoBackends/OGL/OGLConfig.h"
+
+namespace OGL
+{
+GPUTimingQuery::GPUTimingQuery()
+{
+  // Timer queries are core in GL 3.3, and aren't available in GLES at all.
+  m_supported = !g_ogl_config.bIsES &&
+                (GLExtensions::Version() >= 330 || GLExtensions::Supports("GL_ARB_timer_query"));
+  if (m_supported)
+    glGenQueries(NUM_QUERIES, m_query_ids.data());
+}
+
+GPUTimingQuery::~GPUTimingQuery()
+{
+  if (!m_supported)
+    return;
+
+  if (m_query_active)
+    glEndQuery(GL_TIME_ELAPSED);
+  glDeleteQueries(NUM_QUERIES, m_query_ids.data());
+}
+
+void GPUTimingQuery::BeginSegment(u32 query)
+{
+  if (m_query_active)
+    glEndQuery(GL_TIME_ELAPSED);
+
+  glBeginQuery(GL_TIME_ELAPSED, m_query_ids[query]);
+  m_query_active = true;
+}
+
+void GPUTimingQuery::EndSegment(u32 query)
+{
+  // Elapsed time queries measure a whole segment each, so there's nothing to record at the end.
+  if (!m_query_active)
+    return;
+
+  glEndQuery(GL_TIME_ELAPSED);
+  m_query_active = false;
+}
+
+bool GPUTimingQuery::GetSegmentTimes(u32 first, u32 count, u64* times_ns)
+{
+  if (count == 0)
+    return true;
+
+  // Queries complete in order, so if the last one is done, all of them are.
+  GLuint available = GL_FALSE;
+  glGetQueryObjectuiv(m_query_ids[first + count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+  if (available != GL_TRUE)
+    return false;
+
+  for (u32 i = 0; i < count; i++)
+  {
+    GLuint result = 0;
+    glGetQueryObjectuiv(m_query_ids[first + i], GL_QUERY_RESULT, &result);
+    times_ns[i] = result;
+  }
+
+  return true;
+}
+}  // namespace OGL
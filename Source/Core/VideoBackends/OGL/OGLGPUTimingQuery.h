@@ -0,0 +1,34 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/GL/GLExtensions/GLExtensions.h"
+
+#include "VideoCommon/GPUTimingQuery.h"
+
+namespace OGL
+{
+// Times each segment with a GL_TIME_ELAPSED query. Only one of these can be active at a time, so
+// this can't be combined with GPUTimer.
+class GPUTimingQuery final : public GPUTimingQueryBase
+{
+public:
+  GPUTimingQuery();
+  ~GPUTimingQuery() override;
+
+  bool IsSupported() const override { return m_supported; }
+
+protected:
+  void BeginSegment(u32 query) override;
+  void EndSegment(u32 query) override;
+  bool GetSegmentTimes(u32 first, u32 count, u64* times_ns) override;
+
+private:
+  std::array<GLuint, NUM_QUERIES> m_query_ids{};
+  bool m_supported = false;
+  bool m_query_active = false;
+};
+}  // namespace OGL
@@ -10,6 +10,7 @@
 #include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/OGL/OGLConfig.h"
+#include "VideoBackends/OGL/OGLGPUTimingQuery.h"
 #include "VideoBackends/OGL/OGLPipeline.h"
 #include "VideoBackends/OGL/OGLShader.h"
 #include "VideoBackends/OGL/OGLTexture.h"
@@ -20,6 +21,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
 #include <algorithm>
@@ -370,7 +372,7 @@ void OGLGfx::SetAndClearFramebuffer(AbstractFramebuffer* framebuffer, const Clea
                 m_current_blend_state.colorupdate, m_current_blend_state.alphaupdate);
   }
   if (framebuffer->HasDepthBuffer())
-    glDepthMask(m_current_depth_state.updateenable);
+    glDepthMask(m_current_depth_state.testenable && m_current_depth_state.updateenable);
 }
 
 void OGLGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool colorEnable,
@@ -404,7 +406,7 @@ void OGLGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool colorEn
                 m_current_blend_state.colorupdate, m_current_blend_state.alphaupdate);
   }
   if (zEnable)
-    glDepthMask(m_current_depth_state.updateenable);
+    glDepthMask(m_current_depth_state.testenable && m_current_depth_state.updateenable);
 }
 
 void OGLGfx::BindBackbuffer(const ClearColor& clear_color)
@@ -508,16 +510,23 @@ void OGLGfx::ApplyRasterizationState(const RasterizationState state)
   if (m_current_rasterization_state == state)
     return;
 
-  // none, ccw, cw, ccw
-  if (state.cullmode != CullMode::None)
+  // The primitive type is part of the state but has no GL equivalent, so switching between
+  // triangles and lines with the same cull mode shouldn't touch the driver.
+  const bool force = m_current_rasterization_state == RenderState::GetInvalidRasterizationState();
+  if (force || state.cullmode != m_current_rasterization_state.cullmode)
   {
-    // TODO: GX_CULL_ALL not supported, yet!
-    glEnable(GL_CULL_FACE);
-    glFrontFace(state.cullmode == CullMode::Front ? GL_CCW : GL_CW);
-  }
-  else
-  {
-    glDisable(GL_CULL_FACE);
+    // none, ccw, cw, ccw
+    if (state.cullmode != CullMode::None)
+    {
+      // TODO: GX_CULL_ALL not supported, yet!
+      glEnable(GL_CULL_FACE);
+      glFrontFace(state.cullmode == CullMode::Front ? GL_CCW : GL_CW);
+    }
+    else
+    {
+      glDisable(GL_CULL_FACE);
+    }
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
   }
 
   m_current_rasterization_state = state;
@@ -531,19 +540,32 @@ void OGLGfx::ApplyDepthState(const DepthState state)
   const GLenum glCmpFuncs[8] = {GL_NEVER,   GL_LESS,     GL_EQUAL,  GL_LEQUAL,
                                 GL_GREATER, GL_NOTEQUAL, GL_GEQUAL, GL_ALWAYS};
 
-  if (state.testenable)
-  {
-    glEnable(GL_DEPTH_TEST);
-    glDepthMask(state.updateenable ? GL_TRUE : GL_FALSE);
-    glDepthFunc(glCmpFuncs[u32(state.func.Value())]);
-  }
-  else
+  // If the test is disabled write is disabled too, and the function is only set once it is
+  // enabled again.
+  const DepthState current = m_current_depth_state;
+  const bool force = current == RenderState::GetInvalidDepthState();
+  const bool update_enable = state.testenable && state.updateenable;
+  const bool current_update_enable = current.testenable && current.updateenable;
+
+  if (force || state.testenable != current.testenable)
   {
-    // if the test is disabled write is disabled too
     // TODO: When PE performance metrics are being emulated via occlusion queries, we should
     // (probably?) enable depth test with depth function ALWAYS here
-    glDisable(GL_DEPTH_TEST);
-    glDepthMask(GL_FALSE);
+    if (state.testenable)
+      glEnable(GL_DEPTH_TEST);
+    else
+      glDisable(GL_DEPTH_TEST);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
+  }
+  if (force || update_enable != current_update_enable)
+  {
+    glDepthMask(update_enable ? GL_TRUE : GL_FALSE);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
+  }
+  if (state.testenable && (force || !current.testenable || state.func != current.func))
+  {
+    glDepthFunc(glCmpFuncs[u32(state.func.Value())]);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
   }
 
   m_current_depth_state = state;
@@ -575,22 +597,38 @@ void OGLGfx::ApplyBlendingState(const BlendingState state)
                                  GL_DST_ALPHA,
                                  GL_ONE_MINUS_DST_ALPHA};
 
-  if (state.blendenable)
-    glEnable(GL_BLEND);
-  else
-    glDisable(GL_BLEND);
-
-  // Always call glBlendEquationSeparate and glBlendFuncSeparate, even when
-  // GL_BLEND is disabled, as a workaround for some bugs (possibly graphics
-  // driver issues?). See https://bugs.dolphin-emu.org/issues/10120 : "Sonic
-  // Adventure 2 Battle: graphics crash when loading first Dark level"
-  GLenum equation = state.subtract ? GL_FUNC_REVERSE_SUBTRACT : GL_FUNC_ADD;
-  GLenum equationAlpha = state.subtractAlpha ? GL_FUNC_REVERSE_SUBTRACT : GL_FUNC_ADD;
-  glBlendEquationSeparate(equation, equationAlpha);
-  glBlendFuncSeparate(src_factors[u32(state.srcfactor.Value())],
-                      dst_factors[u32(state.dstfactor.Value())],
-                      src_factors[u32(state.srcfactoralpha.Value())],
-                      dst_factors[u32(state.dstfactoralpha.Value())]);
+  const BlendingState& current = m_current_blend_state;
+  const bool force = current == RenderState::GetInvalidBlendingState();
+
+  if (force || state.blendenable != current.blendenable)
+  {
+    if (state.blendenable)
+      glEnable(GL_BLEND);
+    else
+      glDisable(GL_BLEND);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
+  }
+
+  // Always set the equation and factors, even when GL_BLEND is disabled, as a workaround for
+  // some bugs (possibly graphics driver issues?). See https://bugs.dolphin-emu.org/issues/10120 :
+  // "Sonic Adventure 2 Battle: graphics crash when loading first Dark level"
+  if (force || state.subtract != current.subtract || state.subtractAlpha != current.subtractAlpha)
+  {
+    GLenum equation = state.subtract ? GL_FUNC_REVERSE_SUBTRACT : GL_FUNC_ADD;
+    GLenum equationAlpha = state.subtractAlpha ? GL_FUNC_REVERSE_SUBTRACT : GL_FUNC_ADD;
+    glBlendEquationSeparate(equation, equationAlpha);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
+  }
+  if (force || state.usedualsrc != current.usedualsrc || state.srcfactor != current.srcfactor ||
+      state.dstfactor != current.dstfactor || state.srcfactoralpha != current.srcfactoralpha ||
+      state.dstfactoralpha != current.dstfactoralpha)
+  {
+    glBlendFuncSeparate(src_factors[u32(state.srcfactor.Value())],
+                        dst_factors[u32(state.dstfactor.Value())],
+                        src_factors[u32(state.srcfactoralpha.Value())],
+                        dst_factors[u32(state.dstfactoralpha.Value())]);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
+  }
 
   const GLenum logic_op_codes[16] = {
       GL_CLEAR,         GL_AND,         GL_AND_REVERSE, GL_COPY,  GL_AND_INVERTED, GL_NOOP,
@@ -600,18 +638,29 @@ void OGLGfx::ApplyBlendingState(const BlendingState state)
   // Logic ops aren't available in GLES3
   if (!IsGLES())
   {
-    if (state.logicopenable)
+    if (force || state.logicopenable != current.logicopenable)
     {
-      glEnable(GL_COLOR_LOGIC_OP);
-      glLogicOp(logic_op_codes[u32(state.logicmode.Value())]);
+      if (state.logicopenable)
+        glEnable(GL_COLOR_LOGIC_OP);
+      else
+        glDisable(GL_COLOR_LOGIC_OP);
+      INCSTAT(g_stats.this_frame.num_render_state_calls);
     }
-    else
+    if (state.logicopenable &&
+        (force || !current.logicopenable || state.logicmode != current.logicmode))
     {
-      glDisable(GL_COLOR_LOGIC_OP);
+      glLogicOp(logic_op_codes[u32(state.logicmode.Value())]);
+      INCSTAT(g_stats.this_frame.num_render_state_calls);
     }
   }
 
-  glColorMask(state.colorupdate, state.colorupdate, state.colorupdate, state.alphaupdate);
+  if (force || state.colorupdate != current.colorupdate ||
+      state.alphaupdate != current.alphaupdate)
+  {
+    glColorMask(state.colorupdate, state.colorupdate, state.colorupdate, state.alphaupdate);
+    INCSTAT(g_stats.this_frame.num_render_state_calls);
+  }
+
   m_current_blend_state = state;
 }
 
@@ -649,6 +698,7 @@ void OGLGfx::SetTexture(u32 index, const AbstractTexture* texture)
   else
     glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
   m_bound_textures[index] = gl_texture;
+  INCSTAT(g_stats.this_frame.num_render_state_calls);
 }
 
 void OGLGfx::SetSamplerState(u32 index, const SamplerState& state)
@@ -702,6 +752,11 @@ std::unique_ptr<VideoCommon::AsyncShaderCompiler> OGLGfx::CreateAsyncShaderCompi
   return std::make_unique<SharedContextAsyncShaderCompiler>();
 }
 
+std::unique_ptr<GPUTimingQueryBase> OGLGfx::CreateGPUTimingQuery()
+{
+  return std::make_unique<GPUTimingQuery>();
+}
+
 bool OGLGfx::IsGLES() const
 {
   return m_main_gl_context->IsGLES();
@@ -72,6 +72,7 @@ public:
   virtual void SelectMainBuffer() override;
 
   std::unique_ptr<VideoCommon::AsyncShaderCompiler> CreateAsyncShaderCompiler() override;
+  std::unique_ptr<GPUTimingQueryBase> CreateGPUTimingQuery() override;
 
   // Only call methods from this on the GPU thread.
   GLContext* GetMainGLContext() const { return m_main_gl_context.get(); }
@@ -7,6 +7,7 @@
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/OGL/OGLConfig.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace OGL
@@ -61,6 +62,7 @@ void SamplerCache::SetSamplerState(u32 stage, const SamplerState& state)
   m_active_samplers[stage].first = state;
   m_active_samplers[stage].second = it->second;
   glBindSampler(stage, it->second);
+  INCSTAT(g_stats.this_frame.num_render_state_calls);
 }
 
 void SamplerCache::InvalidateBinding(u32 stage)
@@ -4,8 +4,8 @@
 #pragma once
 
 #include <array>
-#include <map>
 #include <memory>
+#include <unordered_map>
 
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLUtil.h"
@@ -35,7 +35,7 @@ public:
 private:
   static void SetParameters(GLuint sampler_id, const SamplerState& params);
 
-  std::map<SamplerState, GLuint> m_cache;
+  std::unordered_map<SamplerState, GLuint> m_cache;
   std::array<std::pair<SamplerState, GLuint>, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>
       m_active_samplers{};
 
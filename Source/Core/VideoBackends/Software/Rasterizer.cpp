@@ -4,14 +4,23 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/Tev.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPMemory.h"
@@ -25,6 +34,18 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// When rasterizing on several threads, triangles are binned into tiles of this size. Each tile is
+// only drawn by one thread at a time, in primitive order, so the result is the same as drawing
+// everything on the video thread. Tiles are aligned to blocks, so a block is never split.
+static constexpr int TILE_SIZE = 32;
+static constexpr int NUM_TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr int NUM_TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr int NUM_TILES = NUM_TILES_X * NUM_TILES_Y;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0);
+
+// Binned triangles are drawn at the end of each batch, or once this many have been queued.
+static constexpr size_t MAX_BINNED_TRIANGLES = 4096;
+
 struct SlopeContext
 {
   SlopeContext(const OutputVertexData* v0, const OutputVertexData* v1, const OutputVertexData* v2,
@@ -96,21 +117,89 @@ struct Slope
   }
 };
 
+// Everything needed to draw a triangle within one scissor rectangle. This is worked out on the
+// video thread when the triangle is submitted, so that it can be drawn later on another thread.
+struct TriangleSetup
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed point
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+
+  // Bounding rectangle, clipped to the scissor rectangle
+  s32 minx, maxx, miny, maxy;
+};
+
+// State for drawing pixels, one per thread.
+struct RasterContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+  u32 rasterized_pixels = 0;
+};
+
 static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static RasterContext s_context;
+static TriangleSetup s_triangle;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// Worker threads, only used when rasterizing on more than one thread.
+static std::vector<std::unique_ptr<RasterContext>> s_worker_contexts;
+static std::vector<std::thread> s_worker_threads;
+static std::mutex s_worker_mutex;
+static std::condition_variable s_worker_wake;
+static std::condition_variable s_worker_done;
+static u64 s_work_generation = 0;
+static u32 s_busy_workers = 0;
+static bool s_workers_exit = false;
+static std::atomic<u32> s_next_tile{0};
+
+static std::vector<TriangleSetup> s_binned_triangles;
+static std::array<std::vector<u32>, NUM_TILES> s_tile_bins;
+
+static void WorkerThread(RasterContext& context);
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  const u32 num_threads = g_Config.GetSWRasterizerThreads();
+  if (num_threads > 0)
+    s_binned_triangles.reserve(MAX_BINNED_TRIANGLES);
+
+  s_workers_exit = false;
+  for (u32 i = 0; i < num_threads; i++)
+  {
+    RasterContext& context = *s_worker_contexts.emplace_back(std::make_unique<RasterContext>());
+    s_worker_threads.emplace_back(WorkerThread, std::ref(context));
+  }
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lock(s_worker_mutex);
+    s_workers_exit = true;
+  }
+  s_worker_wake.notify_all();
+  for (std::thread& thread : s_worker_threads)
+    thread.join();
+
+  s_worker_threads.clear();
+  s_worker_contexts.clear();
+  s_work_generation = 0;
+  s_binned_triangles.clear();
+  for (std::vector<u32>& bin : s_tile_bins)
+    bin.clear();
 }
 
 void ScissorChanged()
@@ -140,31 +229,36 @@ static inline int iround(float x)
   return t;
 }
 
-void SetTevKonstColors()
+void SetupTevBatch()
 {
-  tev.SetKonstColors();
+  s_context.tev.SetupBatch();
+  for (auto& context : s_worker_contexts)
+    context->tev.SetupBatch();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(const TriangleSetup& triangle, RasterContext& context, s32 x, s32 y, s32 xi,
+                 s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
+  context.rasterized_pixels++;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(triangle.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.counters.perf_query[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.testenable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.counters.perf_query[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -175,7 +269,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)triangle.ColorSlopes[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
@@ -207,7 +301,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +313,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,7 +353,8 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(const TriangleSetup& triangle, RasterBlock& rasterBlock, s32 blockX,
+                       s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -269,19 +365,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / triangle.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = triangle.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = triangle.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = triangle.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +387,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +400,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -320,34 +418,21 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Draws the part of a triangle which lies within the given rectangle.
+static void DrawTriangle(const TriangleSetup& triangle, RasterContext& context, s32 minx,
+                         s32 maxx, s32 miny, s32 maxy)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+  const s32 C1 = triangle.C1;
+  const s32 C2 = triangle.C2;
+  const s32 C3 = triangle.C3;
 
-  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
-
-  // 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
-  // could also take floor and adjust -8
-  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
-
-  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
-
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
+  const s32 DX12 = triangle.DX12;
+  const s32 DX23 = triangle.DX23;
+  const s32 DX31 = triangle.DX31;
 
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  const s32 DY12 = triangle.DY12;
+  const s32 DY23 = triangle.DY23;
+  const s32 DY31 = triangle.DY31;
 
   // Fixed-pos32 deltas
   const s32 FDX12 = DX12 * 16;
@@ -358,62 +443,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 FDY23 = DY23 * 16;
   const s32 FDY31 = DY31 * 16;
 
-  // Bounding rectangle
-  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-  // scissor
-  ASSERT(scissor.rect.left >= 0);
-  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
-  ASSERT(scissor.rect.top >= 0);
-  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
-
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
-
-  if (minx >= maxx || miny >= maxy)
-    return;
-
-  // Set up the remaining slopes
-  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
-                         scissor.y_off);
-
-  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
-                1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
-
-  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-  {
-    for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
-  {
-    for (int comp = 0; comp < 3; comp++)
-    {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
-    }
-  }
-
-  // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
-
-  // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
-
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
@@ -455,7 +484,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(triangle, context.rasterBlock, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +494,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(triangle, context, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -488,7 +517,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(triangle, context, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -505,6 +534,232 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+// Draws the binned triangles of tiles until there are none left.
+static void DrawTiles(RasterContext& context)
+{
+  for (u32 tile = s_next_tile++; tile < NUM_TILES; tile = s_next_tile++)
+  {
+    const s32 tile_minx = static_cast<s32>(tile % NUM_TILES_X) * TILE_SIZE;
+    const s32 tile_miny = static_cast<s32>(tile / NUM_TILES_X) * TILE_SIZE;
+    const s32 tile_maxx = tile_minx + TILE_SIZE;
+    const s32 tile_maxy = tile_miny + TILE_SIZE;
+
+    for (u32 index : s_tile_bins[tile])
+    {
+      const TriangleSetup& triangle = s_binned_triangles[index];
+      DrawTriangle(triangle, context, std::max(triangle.minx, tile_minx),
+                   std::min(triangle.maxx, tile_maxx), std::max(triangle.miny, tile_miny),
+                   std::min(triangle.maxy, tile_maxy));
+    }
+  }
+}
+
+static void WorkerThread(RasterContext& context)
+{
+  Common::SetCurrentThreadName("Software Rasterizer");
+
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lock(s_worker_mutex);
+      s_worker_wake.wait(lock, [&] { return s_workers_exit || s_work_generation != generation; });
+      if (s_workers_exit)
+        return;
+
+      generation = s_work_generation;
+    }
+
+    DrawTiles(context);
+
+    std::lock_guard lock(s_worker_mutex);
+    if (--s_busy_workers == 0)
+      s_worker_done.notify_one();
+  }
+}
+
+static void DrawBinnedTriangles()
+{
+  if (s_binned_triangles.empty())
+    return;
+
+  {
+    std::lock_guard lock(s_worker_mutex);
+    s_next_tile = 0;
+    s_busy_workers = static_cast<u32>(s_worker_threads.size());
+    s_work_generation++;
+  }
+  s_worker_wake.notify_all();
+
+  // Help out rather than sitting idle.
+  DrawTiles(s_context);
+
+  {
+    std::unique_lock lock(s_worker_mutex);
+    s_worker_done.wait(lock, [] { return s_busy_workers == 0; });
+  }
+
+  s_binned_triangles.clear();
+  for (std::vector<u32>& bin : s_tile_bins)
+    bin.clear();
+}
+
+static void BinTriangle()
+{
+  const u32 index = static_cast<u32>(s_binned_triangles.size() - 1);
+  const TriangleSetup& triangle = s_binned_triangles.back();
+
+  const s32 first_tile_x = triangle.minx / TILE_SIZE;
+  const s32 last_tile_x = (triangle.maxx - 1) / TILE_SIZE;
+  const s32 first_tile_y = triangle.miny / TILE_SIZE;
+  const s32 last_tile_y = (triangle.maxy - 1) / TILE_SIZE;
+  for (s32 tile_y = first_tile_y; tile_y <= last_tile_y; tile_y++)
+  {
+    for (s32 tile_x = first_tile_x; tile_x <= last_tile_x; tile_x++)
+      s_tile_bins[tile_y * NUM_TILES_X + tile_x].push_back(index);
+  }
+
+  if (s_binned_triangles.size() >= MAX_BINNED_TRIANGLES)
+    DrawBinnedTriangles();
+}
+
+static void FlushCounters(RasterContext& context)
+{
+  Tev::Counters& counters = context.tev.counters;
+
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, context.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, counters.pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, counters.pixels_out);
+
+  for (int i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (counters.perf_query[i] != 0)
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i), counters.perf_query[i]);
+  }
+
+  if (counters.bbox_left <= counters.bbox_right)
+  {
+    BBoxManager::Update(counters.bbox_left, counters.bbox_right, counters.bbox_top,
+                        counters.bbox_bottom);
+  }
+
+  context.rasterized_pixels = 0;
+  counters = {};
+}
+
+void Flush()
+{
+  DrawBinnedTriangles();
+
+  FlushCounters(s_context);
+  for (auto& context : s_worker_contexts)
+    FlushCounters(*context);
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+
+  // 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
+  // could also take floor and adjust -8
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  // Bounding rectangle
+  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+  // scissor
+  ASSERT(scissor.rect.left >= 0);
+  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
+  ASSERT(scissor.rect.top >= 0);
+  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+
+  minx = std::max(minx, scissor.rect.left);
+  maxx = std::min(maxx, scissor.rect.right);
+  miny = std::max(miny, scissor.rect.top);
+  maxy = std::min(maxy, scissor.rect.bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  const bool binned = !s_worker_threads.empty();
+  TriangleSetup& triangle = binned ? s_binned_triangles.emplace_back() : s_triangle;
+  triangle.minx = minx;
+  triangle.maxx = maxx;
+  triangle.miny = miny;
+  triangle.maxy = maxy;
+
+  // Deltas
+  triangle.DX12 = X1 - X2;
+  triangle.DX23 = X2 - X3;
+  triangle.DX31 = X3 - X1;
+
+  triangle.DY12 = Y1 - Y2;
+  triangle.DY23 = Y2 - Y3;
+  triangle.DY31 = Y3 - Y1;
+
+  // Set up the remaining slopes
+  triangle.ZSlope = ZSlope;
+
+  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
+                         scissor.y_off);
+
+  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
+                1.0f / v2->projectedPosition.w};
+  triangle.WSlope = Slope(w[0], w[1], w[2], ctx);
+
+  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+  {
+    for (int comp = 0; comp < 4; comp++)
+    {
+      triangle.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
+  }
+
+  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+  {
+    for (int comp = 0; comp < 3; comp++)
+    {
+      triangle.TexSlopes[i][comp] =
+          Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                v2->texCoords[i][comp] * w[2], ctx);
+    }
+  }
+
+  // Half-edge constants
+  triangle.C1 = triangle.DY12 * X1 - triangle.DX12 * Y1;
+  triangle.C2 = triangle.DY23 * X2 - triangle.DX23 * Y2;
+  triangle.C3 = triangle.DY31 * X3 - triangle.DX31 * Y3;
+
+  // Correct for fill convention
+  if (triangle.DY12 < 0 || (triangle.DY12 == 0 && triangle.DX12 > 0))
+    triangle.C1++;
+  if (triangle.DY23 < 0 || (triangle.DY23 == 0 && triangle.DX23 > 0))
+    triangle.C2++;
+  if (triangle.DY31 < 0 || (triangle.DY31 == 0 && triangle.DX31 > 0))
+    triangle.C3++;
+
+  if (binned)
+    BinTriangle();
+  else
+    DrawTriangle(triangle, s_context, minx, maxx, miny, maxy);
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
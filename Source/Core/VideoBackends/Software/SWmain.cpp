@@ -99,9 +99,15 @@ void VideoSoftware::InitBackendInfo(const WindowSystemInfo& wsi)
 
 bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 {
-  std::unique_ptr<SWOGLWindow> window = SWOGLWindow::Create(wsi);
-  if (!window)
-    return false;
+  // Everything is rendered on the CPU, so when there's nothing to present to we can run without
+  // a GL context at all. This lets headless runs still read back EFB copies, peeks and bbox.
+  std::unique_ptr<SWOGLWindow> window;
+  if (wsi.type != WindowSystemType::Headless)
+  {
+    window = SWOGLWindow::Create(wsi);
+    if (!window)
+      return false;
+  }
 
   Clipper::Init();
   Rasterizer::Init();
@@ -115,5 +121,6 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 void VideoSoftware::Shutdown()
 {
   ShutdownShared();
+  Rasterizer::Shutdown();
 }
 }  // namespace SW
@@ -7,18 +7,20 @@
 #include <cmath>
 #include <cstring>
 
+#ifdef _M_X86_64
+#include <emmintrin.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 
 #include "Core/System.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
-#include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/TextureSampler.h"
 
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderManager.h"
-#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
@@ -39,14 +41,13 @@ static inline s16 Clamp1024(s16 in)
   return std::clamp<s16>(in, -1024, 1023);
 }
 
-void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
+void Tev::SetRasColor(RasColorChan colorChan, const SwapTable& swap)
 {
   switch (colorChan)
   {
   case RasColorChan::Color0:
   {
     const u8* color = Color[0];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
     RasColor.r = color[u32(swap[ColorChannel::Red])];
     RasColor.g = color[u32(swap[ColorChannel::Green])];
     RasColor.b = color[u32(swap[ColorChannel::Blue])];
@@ -56,7 +57,6 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
   case RasColorChan::Color1:
   {
     const u8* color = Color[1];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
     RasColor.r = color[u32(swap[ColorChannel::Red])];
     RasColor.g = color[u32(swap[ColorChannel::Green])];
     RasColor.b = color[u32(swap[ColorChannel::Blue])];
@@ -198,6 +198,65 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
     Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
+#ifdef _M_X86_64
+// Evaluates both regular combiners at once, with one channel in each 32-bit lane. The inputs and
+// the scaled weights all fit in 16 bits, so SSE2's 16-bit multiplies are enough. Gives the same
+// results as DrawColorRegular() and DrawAlphaRegular() followed by the clamps in Draw().
+void Tev::DrawRegular(const StageSetup& stage, const InputRegType inputs[4], TevOutput color_dest,
+                      TevOutput alpha_dest)
+{
+  const auto load = [](const auto& lanes) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.data()));
+  };
+
+  const __m128i a = _mm_setr_epi32(inputs[ALP_C].a, inputs[BLU_C].a, inputs[GRN_C].a,
+                                   inputs[RED_C].a);
+  const __m128i b = _mm_setr_epi32(inputs[ALP_C].b, inputs[BLU_C].b, inputs[GRN_C].b,
+                                   inputs[RED_C].b);
+  __m128i c = _mm_setr_epi32(inputs[ALP_C].c, inputs[BLU_C].c, inputs[GRN_C].c,
+                             inputs[RED_C].c);
+  const __m128i d = _mm_setr_epi32(inputs[ALP_C].d, inputs[BLU_C].d, inputs[GRN_C].d,
+                                   inputs[RED_C].d);
+  const __m128i scale = load(stage.scale);
+
+  // (a * (256 - c) + b * c) << scale, with the (a, b) and (256 - c, c) pairs in the 16-bit halves
+  // of each lane so that a single madd does both products and the sum.
+  c = _mm_add_epi32(c, _mm_srli_epi32(c, 7));
+  const __m128i ab = _mm_or_si128(a, _mm_slli_epi32(b, 16));
+  __m128i weights = _mm_or_si128(_mm_sub_epi32(_mm_set1_epi32(256), c), _mm_slli_epi32(c, 16));
+  weights = _mm_mullo_epi16(weights, _mm_or_si128(scale, _mm_slli_epi32(scale, 16)));
+  __m128i temp = _mm_madd_epi16(ab, weights);
+
+  // Alpha subtraction negates before the shift and color subtraction after it, which rounds
+  // differently.
+  temp = _mm_add_epi32(temp, load(stage.round));
+  const __m128i negate_before = load(stage.negate_before_shift);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_before), negate_before);
+  temp = _mm_srai_epi32(temp, 8);
+  const __m128i negate_after = load(stage.negate_after_shift);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_after), negate_after);
+
+  // ((d + bias) << scale) + temp. d + bias is sign extended, but the upper half of scale is zero.
+  __m128i result = _mm_madd_epi16(_mm_add_epi32(d, load(stage.bias)), scale);
+  result = _mm_add_epi32(result, temp);
+  const __m128i divide2 = load(stage.divide2);
+  result = _mm_or_si128(_mm_andnot_si128(divide2, result),
+                        _mm_and_si128(divide2, _mm_srai_epi32(result, 1)));
+
+  // The results are well within the s16 range, so the saturation here never kicks in.
+  result = _mm_packs_epi32(result, result);
+  result = _mm_max_epi16(result, load(stage.clamp_min));
+  result = _mm_min_epi16(result, load(stage.clamp_max));
+
+  s16 output[8];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output), result);
+  Reg[color_dest].r = output[RED_C];
+  Reg[color_dest].g = output[GRN_C];
+  Reg[color_dest].b = output[BLU_C];
+  Reg[alpha_dest].a = output[ALP_C];
+}
+#endif
+
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
 {
   switch (comp)
@@ -397,19 +456,11 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
-
-  auto& system = Core::System::GetInstance();
-  auto& pixel_shader_manager = system.GetPixelShaderManager();
+  counters.pixels_in++;
 
   // initial color values
   for (int i = 0; i < 4; i++)
-  {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
-  }
+    Reg[static_cast<TevOutput>(i)] = m_initial_regs[i];
 
   for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
   {
@@ -437,26 +488,16 @@ void Tev::Draw()
 
   for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
   {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-    const TwoTevStageOrders& order = bpmem.tevorders[stageNum2];
+    const StageSetup& stage = m_stages[stageNum];
 
     // stage combiners
     const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
     const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
 
-    u32 texcoordSel = order.getTexCoord(stageOdd);
-    const u32 texmap = order.getTexMap(stageOdd);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
-
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    Indirect(stageNum, Uv[stage.texcoord].s, Uv[stage.texcoord].t);
 
     // sample texture
-    if (order.getEnable(stageOdd))
+    if (stage.texture_enabled)
     {
       // RGBA
       u8 texel[4];
@@ -464,7 +505,7 @@ void Tev::Draw()
       if (bpmem.genMode.numtexgens > 0)
       {
         TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
+                               TextureLinear[stageNum], stage.texmap, texel);
       }
       else
       {
@@ -473,7 +514,7 @@ void Tev::Draw()
         std::memset(texel, 0, 4);
       }
 
-      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
+      const SwapTable& swap = stage.tex_swap;
       TexColor.r = texel[u32(swap[ColorChannel::Red])];
       TexColor.g = texel[u32(swap[ColorChannel::Green])];
       TexColor.b = texel[u32(swap[ColorChannel::Blue])];
@@ -481,36 +522,44 @@ void Tev::Draw()
     }
 
     // set konst for this stage
-    const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
-    const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
+    StageKonst.r = stage.konst_color->r;
+    StageKonst.g = stage.konst_color->g;
+    StageKonst.b = stage.konst_color->b;
+    StageKonst.a = stage.konst_alpha->a;
 
     // set color
-    SetRasColor(order.getColorChan(stageOdd), ac.rswap);
+    SetRasColor(stage.ras_color_chan, stage.ras_swap);
 
     // combine inputs
+    const auto& color_inputs = stage.color_inputs;
+    const auto& alpha_inputs = stage.alpha_inputs;
     InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
+    inputs[BLU_C].a = color_inputs[0]->b;
+    inputs[BLU_C].b = color_inputs[1]->b;
+    inputs[BLU_C].c = color_inputs[2]->b;
+    inputs[BLU_C].d = color_inputs[3]->b;
+    inputs[GRN_C].a = color_inputs[0]->g;
+    inputs[GRN_C].b = color_inputs[1]->g;
+    inputs[GRN_C].c = color_inputs[2]->g;
+    inputs[GRN_C].d = color_inputs[3]->g;
+    inputs[RED_C].a = color_inputs[0]->r;
+    inputs[RED_C].b = color_inputs[1]->r;
+    inputs[RED_C].c = color_inputs[2]->r;
+    inputs[RED_C].d = color_inputs[3]->r;
+    inputs[ALP_C].a = alpha_inputs[0]->a;
+    inputs[ALP_C].b = alpha_inputs[1]->a;
+    inputs[ALP_C].c = alpha_inputs[2]->a;
+    inputs[ALP_C].d = alpha_inputs[3]->a;
+
+#ifdef _M_X86_64
+    if (!stage.color_compare && !stage.alpha_compare)
+    {
+      DrawRegular(stage, inputs, cc.dest, ac.dest);
+      continue;
+    }
+#endif
+
+    if (!stage.color_compare)
       DrawColorRegular(cc, inputs);
     else
       DrawColorCompare(cc, inputs);
@@ -528,7 +577,7 @@ void Tev::Draw()
       Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
     }
 
-    if (ac.bias != TevBias::Compare)
+    if (!stage.alpha_compare)
       DrawAlphaRegular(ac, inputs);
     else
       DrawAlphaCompare(ac, inputs);
@@ -666,26 +715,28 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    counters.perf_query[PQ_ZCOMP_INPUT]++;
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    counters.perf_query[PQ_ZCOMP_OUTPUT]++;
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  counters.bbox_left = std::min(counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  counters.bbox_right = std::max(counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  counters.bbox_top = std::min(counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  counters.bbox_bottom = std::max(counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  counters.pixels_out++;
+  counters.perf_query[PQ_BLEND_INPUT]++;
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
-void Tev::SetKonstColors()
+void Tev::SetupBatch()
 {
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -696,5 +747,59 @@ void Tev::SetKonstColors()
     KonstantColors[i].g = pixel_shader_manager.constants.kcolors[i][1];
     KonstantColors[i].b = pixel_shader_manager.constants.kcolors[i][2];
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
+
+    m_initial_regs[i].r = pixel_shader_manager.constants.colors[i][0];
+    m_initial_regs[i].g = pixel_shader_manager.constants.colors[i][1];
+    m_initial_regs[i].b = pixel_shader_manager.constants.colors[i][2];
+    m_initial_regs[i].a = pixel_shader_manager.constants.colors[i][3];
+  }
+
+  for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
+  {
+    StageSetup& stage = m_stages[stageNum];
+    const int stageOdd = stageNum & 1;
+    const TwoTevStageOrders& order = bpmem.tevorders[stageNum >> 1];
+    const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
+    const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
+
+    stage.texcoord = order.getTexCoord(stageOdd);
+    stage.texmap = order.getTexMap(stageOdd);
+
+    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
+    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
+    if (stage.texcoord >= bpmem.genMode.numtexgens)
+      stage.texcoord = 0;
+
+    stage.texture_enabled = order.getEnable(stageOdd);
+    stage.ras_color_chan = order.getColorChan(stageOdd);
+    stage.tex_swap = bpmem.tevksel.GetSwapTable(ac.tswap);
+    stage.ras_swap = bpmem.tevksel.GetSwapTable(ac.rswap);
+    stage.konst_color = &m_KonstLUT[bpmem.tevksel.GetKonstColor(stageNum)];
+    stage.konst_alpha = &m_KonstLUT[bpmem.tevksel.GetKonstAlpha(stageNum)];
+    stage.color_inputs = {&m_ColorInputLUT[cc.a], &m_ColorInputLUT[cc.b], &m_ColorInputLUT[cc.c],
+                          &m_ColorInputLUT[cc.d]};
+    stage.alpha_inputs = {&m_AlphaInputLUT[ac.a], &m_AlphaInputLUT[ac.b], &m_AlphaInputLUT[ac.c],
+                          &m_AlphaInputLUT[ac.d]};
+    stage.color_compare = cc.bias == TevBias::Compare;
+    stage.alpha_compare = ac.bias == TevBias::Compare;
+
+#ifdef _M_X86_64
+    for (int i = ALP_C; i <= RED_C; i++)
+    {
+      const bool alpha = i == ALP_C;
+      const TevScale scale = alpha ? ac.scale : cc.scale;
+      const bool sub = (alpha ? ac.op : cc.op) == TevOp::Sub;
+      const bool clamp = alpha ? ac.clamp : cc.clamp;
+
+      stage.scale[i] = 1 << s_ScaleLShiftLUT[scale];
+      stage.bias[i] = s_BiasLUT[alpha ? ac.bias : cc.bias];
+      stage.round[i] = (scale == TevScale::Divide2) ? 0 : sub ? 127 : 128;
+      stage.negate_before_shift[i] = (alpha && sub) ? -1 : 0;
+      stage.negate_after_shift[i] = (!alpha && sub) ? -1 : 0;
+      stage.divide2[i] = s_ScaleRShiftLUT[scale] ? -1 : 0;
+      stage.clamp_min[i] = clamp ? 0 : -1024;
+      stage.clamp_max[i] = clamp ? 255 : 1023;
+    }
+#endif
   }
 }
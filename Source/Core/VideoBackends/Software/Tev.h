@@ -5,8 +5,10 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -203,12 +205,50 @@ class Tev
     INDIRECT = 32
   };
 
-  void SetRasColor(RasColorChan colorChan, u32 swaptable);
+  using SwapTable = Common::EnumMap<ColorChannel, ColorChannel::Alpha>;
+
+  // Stage configuration which only depends on bpmem, decoded once per batch by SetupBatch() instead
+  // of for every pixel.
+  struct StageSetup
+  {
+    u32 texcoord = 0;
+    u32 texmap = 0;
+    bool texture_enabled = false;
+    RasColorChan ras_color_chan = RasColorChan::Zero;
+    SwapTable tex_swap{};
+    SwapTable ras_swap{};
+    const TevKonstRef* konst_color = nullptr;
+    const TevKonstRef* konst_alpha = nullptr;
+    std::array<const TevColorRef*, 4> color_inputs{};
+    std::array<const TevAlphaRef*, 4> alpha_inputs{};
+    bool color_compare = false;
+    bool alpha_compare = false;
+
+#ifdef _M_X86_64
+    // Combiner parameters for DrawRegular(), one lane per ALP_C..RED_C.
+    alignas(16) std::array<s32, 4> scale{};
+    alignas(16) std::array<s32, 4> bias{};
+    alignas(16) std::array<s32, 4> round{};
+    alignas(16) std::array<s32, 4> negate_before_shift{};
+    alignas(16) std::array<s32, 4> negate_after_shift{};
+    alignas(16) std::array<s32, 4> divide2{};
+    alignas(16) std::array<s16, 8> clamp_min{};
+    alignas(16) std::array<s16, 8> clamp_max{};
+#endif
+  };
+  std::array<StageSetup, 16> m_stages;
+  std::array<TevColor, 4> m_initial_regs;
+
+  void SetRasColor(RasColorChan colorChan, const SwapTable& swap);
 
   void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
   void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+#ifdef _M_X86_64
+  void DrawRegular(const StageSetup& stage, const InputRegType inputs[4], TevOutput color_dest,
+                   TevOutput alpha_dest);
+#endif
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
@@ -229,6 +269,21 @@ public:
     RED_C
   };
 
-  void SetKonstColors();
+  // Several Tev instances can be drawing at the same time, so the statistics, perf query and
+  // bounding box updates are collected here and applied by the rasterizer after each batch.
+  struct Counters
+  {
+    u32 pixels_in = 0;
+    u32 pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_query{};
+    u16 bbox_left = 0xFFFF;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xFFFF;
+    u16 bbox_bottom = 0;
+  };
+  Counters counters;
+
+  // Loads the konst colors, initial register values and stage configuration for the next batch.
+  void SetupBatch();
   void Draw();
 };
@@ -15,13 +15,21 @@
 
 namespace Vulkan
 {
-CommandBufferManager::CommandBufferManager(bool use_threaded_submission)
-    : m_use_threaded_submission(use_threaded_submission)
+CommandBufferManager::CommandBufferManager(bool use_threaded_submission,
+                                           bool use_threaded_recording)
+    : m_use_threaded_submission(use_threaded_submission),
+      m_use_threaded_recording(use_threaded_recording)
 {
 }
 
 CommandBufferManager::~CommandBufferManager()
 {
+  if (m_use_threaded_recording)
+  {
+    FlushDrawCommands();
+    m_recording_thread.Shutdown();
+  }
+
   // If the worker thread is enabled, stop and block until it exits.
   if (m_use_threaded_submission)
   {
@@ -40,6 +48,9 @@ bool CommandBufferManager::Initialize()
   if (m_use_threaded_submission && !CreateSubmitThread())
     return false;
 
+  if (m_use_threaded_recording && !CreateRecordingThread())
+    return false;
+
   return true;
 }
 
@@ -231,6 +242,131 @@ bool CommandBufferManager::CreateSubmitThread()
   return true;
 }
 
+bool CommandBufferManager::CreateRecordingThread()
+{
+  m_recording_thread.Reset("VK recording thread", [](DrawCommandBatch batch) {
+    for (const DrawCommand& command : batch.commands)
+      ExecuteDrawCommand(batch.command_buffer, command, batch.image_infos.data());
+  });
+  m_pending_draw_commands.reserve(DRAW_COMMAND_BATCH_SIZE);
+
+  return true;
+}
+
+void CommandBufferManager::RecordDrawCommand(const DrawCommand& command)
+{
+  if (!m_use_threaded_recording)
+  {
+    ExecuteDrawCommand(GetCurrentCommandBuffer(), command, nullptr);
+    return;
+  }
+
+  m_pending_draw_commands.push_back(command);
+  if (m_pending_draw_commands.size() >= DRAW_COMMAND_BATCH_SIZE)
+    PushDrawCommands();
+}
+
+void CommandBufferManager::RecordPushDescriptorImages(VkPipelineLayout layout, u32 set,
+                                                      const VkDescriptorImageInfo* images,
+                                                      u32 num_images)
+{
+  if (!m_use_threaded_recording)
+  {
+    PushDescriptorImages(GetCurrentCommandBuffer(), layout, set, images, num_images);
+    return;
+  }
+
+  DrawCommand command{DrawCommand::Type::PushDescriptorImages};
+  command.push_images = {layout, set, static_cast<u32>(m_pending_image_infos.size()), num_images};
+  m_pending_image_infos.insert(m_pending_image_infos.end(), images, images + num_images);
+  RecordDrawCommand(command);
+}
+
+void CommandBufferManager::PushDrawCommands()
+{
+  m_recording_thread.Push({GetCurrentCmdBufferResources().command_buffers[1],
+                           std::move(m_pending_draw_commands), std::move(m_pending_image_infos)});
+  m_pending_draw_commands = {};
+  m_pending_draw_commands.reserve(DRAW_COMMAND_BATCH_SIZE);
+  m_pending_image_infos = {};
+  m_recording_pending = true;
+}
+
+void CommandBufferManager::FlushDrawCommands()
+{
+  if (!m_pending_draw_commands.empty())
+    PushDrawCommands();
+
+  if (m_recording_pending)
+  {
+    m_recording_thread.WaitForCompletion();
+    m_recording_pending = false;
+  }
+}
+
+void CommandBufferManager::ExecuteDrawCommand(VkCommandBuffer command_buffer,
+                                              const DrawCommand& command,
+                                              const VkDescriptorImageInfo* image_infos)
+{
+  switch (command.type)
+  {
+  case DrawCommand::Type::BindVertexBuffer:
+    vkCmdBindVertexBuffers(command_buffer, 0, 1, &command.buffer.buffer, &command.buffer.offset);
+    break;
+  case DrawCommand::Type::BindIndexBuffer:
+    vkCmdBindIndexBuffer(command_buffer, command.buffer.buffer, command.buffer.offset,
+                         command.buffer.index_type);
+    break;
+  case DrawCommand::Type::BindPipeline:
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, command.pipeline);
+    break;
+  case DrawCommand::Type::SetViewport:
+    vkCmdSetViewport(command_buffer, 0, 1, &command.viewport);
+    break;
+  case DrawCommand::Type::SetScissor:
+    vkCmdSetScissor(command_buffer, 0, 1, &command.scissor);
+    break;
+  case DrawCommand::Type::BindDescriptorSets:
+    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            command.descriptor_sets.layout, command.descriptor_sets.first_set,
+                            command.descriptor_sets.num_sets, command.descriptor_sets.sets.data(),
+                            command.descriptor_sets.num_offsets,
+                            command.descriptor_sets.offsets.data());
+    break;
+  case DrawCommand::Type::PushDescriptorImages:
+    PushDescriptorImages(command_buffer, command.push_images.layout, command.push_images.set,
+                         image_infos + command.push_images.first_image,
+                         command.push_images.num_images);
+    break;
+  case DrawCommand::Type::Draw:
+    vkCmdDraw(command_buffer, command.draw.count, 1, command.draw.first, 0);
+    break;
+  case DrawCommand::Type::DrawIndexed:
+    vkCmdDrawIndexed(command_buffer, command.draw.count, 1, command.draw.first,
+                     command.draw.base_vertex, 0);
+    break;
+  }
+}
+
+void CommandBufferManager::PushDescriptorImages(VkCommandBuffer command_buffer,
+                                                VkPipelineLayout layout, u32 set,
+                                                const VkDescriptorImageInfo* images,
+                                                u32 num_images)
+{
+  const VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                      nullptr,
+                                      VK_NULL_HANDLE,
+                                      0,
+                                      0,
+                                      num_images,
+                                      VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                      images,
+                                      nullptr,
+                                      nullptr};
+  vkCmdPushDescriptorSetKHR(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, set, 1,
+                            &write);
+}
+
 void CommandBufferManager::WaitForWorkerThreadIdle()
 {
   if (!m_use_threaded_submission)
@@ -258,6 +394,28 @@ void CommandBufferManager::WaitForFenceCounter(u64 fence_counter)
   WaitForCommandBufferCompletion(index);
 }
 
+bool CommandBufferManager::IsFenceCounterComplete(u64 fence_counter) const
+{
+  if (m_completed_fence_counter >= fence_counter)
+    return true;
+
+  u32 index = (m_current_cmd_buffer + 1) % NUM_COMMAND_BUFFERS;
+  while (index != m_current_cmd_buffer)
+  {
+    if (m_command_buffers[index].fence_counter >= fence_counter)
+      break;
+
+    index = (index + 1) % NUM_COMMAND_BUFFERS;
+  }
+
+  // Still being recorded, or not submitted yet.
+  const CmdBufferResources& resources = m_command_buffers[index];
+  if (index == m_current_cmd_buffer || resources.waiting_for_submit.load(std::memory_order_acquire))
+    return false;
+
+  return vkGetFenceStatus(g_vulkan_context->GetDevice(), resources.fence) == VK_SUCCESS;
+}
+
 void CommandBufferManager::WaitForCommandBufferCompletion(u32 index)
 {
   CmdBufferResources& resources = m_command_buffers[index];
@@ -304,6 +462,8 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
                                                VkSwapchainKHR present_swap_chain,
                                                uint32_t present_image_index)
 {
+  FlushDrawCommands();
+
   // End the current command buffer.
   CmdBufferResources& resources = GetCurrentCmdBufferResources();
   for (VkCommandBuffer command_buffer : resources.command_buffers)
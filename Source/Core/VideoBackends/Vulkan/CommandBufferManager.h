@@ -23,27 +23,104 @@
 
 namespace Vulkan
 {
+// A state bind or draw that can be recorded into the draw command buffer later, on the recording
+// thread. Everything the command refers to is copied, so the state tracker can change its state
+// right after queuing it.
+struct DrawCommand
+{
+  enum class Type : u8
+  {
+    BindVertexBuffer,
+    BindIndexBuffer,
+    BindPipeline,
+    SetViewport,
+    SetScissor,
+    BindDescriptorSets,
+    PushDescriptorImages,
+    Draw,
+    DrawIndexed,
+  };
+
+  static constexpr u32 MAX_DESCRIPTOR_SETS = 3;
+
+  Type type;
+  union
+  {
+    struct
+    {
+      VkBuffer buffer;
+      VkDeviceSize offset;
+      VkIndexType index_type;
+    } buffer;
+    VkPipeline pipeline;
+    VkViewport viewport;
+    VkRect2D scissor;
+    struct
+    {
+      VkPipelineLayout layout;
+      u32 first_set;
+      u32 num_sets;
+      u32 num_offsets;
+      std::array<VkDescriptorSet, MAX_DESCRIPTOR_SETS> sets;
+      std::array<u32, NUM_UBO_DESCRIPTOR_SET_BINDINGS> offsets;
+    } descriptor_sets;
+    struct
+    {
+      VkPipelineLayout layout;
+      u32 set;
+      // Index of the first image in the image infos queued alongside the command.
+      u32 first_image;
+      u32 num_images;
+    } push_images;
+    struct
+    {
+      u32 count;
+      u32 first;
+      s32 base_vertex;
+    } draw;
+  };
+};
+
 class CommandBufferManager
 {
 public:
-  explicit CommandBufferManager(bool use_threaded_submission);
+  // Threaded recording moves the vkCmd* calls for state binds and draws to a worker thread.
+  explicit CommandBufferManager(bool use_threaded_submission, bool use_threaded_recording);
   ~CommandBufferManager();
 
   bool Initialize();
 
   // These command buffers are allocated per-frame. They are valid until the command buffer
   // is submitted, after that you should call these functions again.
+  // Both first wait for queued draw commands to be recorded, so that anything recorded directly
+  // stays in order with them (and the command pool is only used by one thread at a time).
   VkCommandBuffer GetCurrentInitCommandBuffer()
   {
+    if (HasPendingDrawCommands()) [[unlikely]]
+      FlushDrawCommands();
+
     CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
     cmd_buffer_resources.init_command_buffer_used = true;
     return cmd_buffer_resources.command_buffers[0];
   }
-  VkCommandBuffer GetCurrentCommandBuffer() const
+  VkCommandBuffer GetCurrentCommandBuffer()
   {
+    if (HasPendingDrawCommands()) [[unlikely]]
+      FlushDrawCommands();
+
     const CmdBufferResources& cmd_buffer_resources = m_command_buffers[m_current_cmd_buffer];
     return cmd_buffer_resources.command_buffers[1];
   }
+
+  // Records a draw command into the current command buffer. With threaded recording, the command
+  // is queued and handed to the recording thread in batches instead.
+  void RecordDrawCommand(const DrawCommand& command);
+  // Pushes combined image samplers starting at binding 0 of a push descriptor set, in the same
+  // order as draw commands. Requires VK_KHR_push_descriptor.
+  void RecordPushDescriptorImages(VkPipelineLayout layout, u32 set,
+                                  const VkDescriptorImageInfo* images, u32 num_images);
+  // Waits until all queued draw commands have been recorded.
+  void FlushDrawCommands();
   // Allocates a descriptors set from the pool reserved for the current frame.
   VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout set_layout);
 
@@ -53,6 +130,10 @@ public:
   // commands can be retreived by calling GetCurrentFenceCounter().
   u64 GetCompletedFenceCounter() const { return m_completed_fence_counter; }
 
+  // Checks whether the GPU has completed the work associated with fence_counter, without waiting
+  // for it or advancing the completed fence counter.
+  bool IsFenceCounterComplete(u64 fence_counter) const;
+
   // Gets the fence that will be signaled when the currently executing command buffer is
   // queued and executed. Do not wait for this fence before the buffer is executed.
   u64 GetCurrentFenceCounter() const
@@ -99,6 +180,17 @@ private:
   void DestroyCommandBuffers();
 
   bool CreateSubmitThread();
+  bool CreateRecordingThread();
+
+  bool HasPendingDrawCommands() const
+  {
+    return m_recording_pending || !m_pending_draw_commands.empty();
+  }
+  void PushDrawCommands();
+  static void ExecuteDrawCommand(VkCommandBuffer command_buffer, const DrawCommand& command,
+                                 const VkDescriptorImageInfo* image_infos);
+  static void PushDescriptorImages(VkCommandBuffer command_buffer, VkPipelineLayout layout,
+                                   u32 set, const VkDescriptorImageInfo* images, u32 num_images);
 
   void WaitForCommandBufferCompletion(u32 command_buffer_index);
   void SubmitCommandBuffer(u32 command_buffer_index, VkSwapchainKHR present_swap_chain,
@@ -109,6 +201,9 @@ private:
 
   const u32 DESCRIPTOR_SETS_PER_POOL = 1024;
 
+  // Number of draw commands queued before they are handed to the recording thread.
+  static constexpr std::size_t DRAW_COMMAND_BATCH_SIZE = 256;
+
   struct CmdBufferResources
   {
     // [0] - Init (upload) command buffer, [1] - draw command buffer
@@ -159,6 +254,20 @@ private:
   Common::Flag m_last_present_done;
   VkResult m_last_present_result = VK_SUCCESS;
   bool m_use_threaded_submission = false;
+
+  // Threaded draw command recording
+  struct DrawCommandBatch
+  {
+    VkCommandBuffer command_buffer;
+    std::vector<DrawCommand> commands;
+    std::vector<VkDescriptorImageInfo> image_infos;
+  };
+  Common::WorkQueueThread<DrawCommandBatch> m_recording_thread;
+  std::vector<DrawCommand> m_pending_draw_commands;
+  std::vector<VkDescriptorImageInfo> m_pending_image_infos;
+  // Whether a batch has been pushed to the recording thread since it was last waited for.
+  bool m_recording_pending = false;
+  bool m_use_threaded_recording = false;
   u32 m_descriptor_set_count = DESCRIPTOR_SETS_PER_POOL;
 };
 
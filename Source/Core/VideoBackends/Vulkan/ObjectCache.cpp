@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <tuple>
 #include <type_traits>
 
 #include "Common/Assert.h"
@@ -32,6 +33,7 @@ ObjectCache::ObjectCache() = default;
 
 ObjectCache::~ObjectCache()
 {
+  DestroyPipelineLibraryCache();
   DestroyPipelineCache();
   DestroySamplers();
   DestroyPipelineLayouts();
@@ -203,8 +205,9 @@ bool ObjectCache::CreateDescriptorSetLayouts()
        static_cast<u32>(compute_set_bindings.size()), compute_set_bindings.data()},
   }};
 
-  // Don't set the GS bit if geometry shaders aren't available.
-  if (g_ActiveConfig.UseVSForLinePointExpand())
+  // Don't set the GS bit if geometry shaders aren't available. With multiview, the vertex shader
+  // needs the stereo parameters.
+  if (g_ActiveConfig.UseVSForLinePointExpand() || g_ActiveConfig.backend_info.bSupportsMultiview)
   {
     if (g_ActiveConfig.backend_info.bSupportsGeometryShaders)
       ubo_bindings[UBO_DESCRIPTOR_SET_BINDING_GS].stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
@@ -216,6 +219,14 @@ bool ObjectCache::CreateDescriptorSetLayouts()
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_UNIFORM_BUFFERS].bindingCount--;
   }
 
+  // The GX samplers change with almost every texture bind, so push them instead of allocating a
+  // new descriptor set each time.
+  if (g_vulkan_context->SupportsPushDescriptors())
+  {
+    create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS].flags |=
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+  }
+
   // Remove the dynamic vertex loader's buffer if it'll never be needed
   if (!g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SHADER_STORAGE_BUFFERS].bindingCount--;
@@ -418,10 +429,10 @@ VkSampler ObjectCache::GetSampler(const SamplerState& info)
 
 VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
                                         u32 multisamples, VkAttachmentLoadOp load_op,
-                                        u8 additional_attachment_count)
+                                        u8 additional_attachment_count, bool multiview)
 {
-  auto key =
-      std::tie(color_format, depth_format, multisamples, load_op, additional_attachment_count);
+  auto key = std::tie(color_format, depth_format, multisamples, load_op,
+                      additional_attachment_count, multiview);
   auto it = m_render_pass_cache.find(key);
   if (it != m_render_pass_cache.end())
     return it->second;
@@ -488,6 +499,15 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
                                       0,
                                       nullptr};
 
+  // One view per eye. The views are also marked as correlated, as they only differ by a
+  // horizontal offset, which lets the driver share work between them.
+  static constexpr u32 view_mask = 0b11;
+  const VkRenderPassMultiviewCreateInfo multiview_info = {
+      VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO, nullptr, 1, &view_mask, 0, nullptr, 1,
+      &view_mask};
+  if (multiview)
+    pass_info.pNext = &multiview_info;
+
   VkRenderPass pass;
   VkResult res = vkCreateRenderPass(g_vulkan_context->GetDevice(), &pass_info, nullptr, &pass);
   if (res != VK_SUCCESS)
@@ -507,6 +527,56 @@ void ObjectCache::DestroyRenderPassCache()
   m_render_pass_cache.clear();
 }
 
+bool ObjectCache::PipelineLibraryKey::operator<(const PipelineLibraryKey& rhs) const
+{
+  return std::tie(part, shaders, vertex_format, state, framebuffer_state, layout, render_pass) <
+         std::tie(rhs.part, rhs.shaders, rhs.vertex_format, rhs.state, rhs.framebuffer_state,
+                  rhs.layout, rhs.render_pass);
+}
+
+VkPipeline ObjectCache::GetPipelineLibrary(const PipelineLibraryKey& key,
+                                           const std::function<VkPipeline()>& create_library)
+{
+  {
+    std::lock_guard guard(m_pipeline_library_lock);
+    auto iter = m_pipeline_library_cache.find(key);
+    if (iter != m_pipeline_library_cache.end())
+      return iter->second;
+  }
+
+  // Don't hold the lock while compiling, so the other compiler threads can still look up parts.
+  // If another thread created the same part in the meantime, keep theirs.
+  VkPipeline library = create_library();
+  if (library == VK_NULL_HANDLE)
+    return VK_NULL_HANDLE;
+
+  std::lock_guard guard(m_pipeline_library_lock);
+  auto [iter, inserted] = m_pipeline_library_cache.emplace(key, library);
+  if (!inserted)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+  return iter->second;
+}
+
+void ObjectCache::DestroyPipelineLibraries(VkShaderModule module)
+{
+  // Pipelines linked from these parts stay valid, so there is no need to wait for the GPU.
+  std::lock_guard guard(m_pipeline_library_lock);
+  std::erase_if(m_pipeline_library_cache, [module](const auto& it) {
+    if (it.first.shaders[0] != module && it.first.shaders[1] != module)
+      return false;
+
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+    return true;
+  });
+}
+
+void ObjectCache::DestroyPipelineLibraryCache()
+{
+  for (auto& it : m_pipeline_library_cache)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+  m_pipeline_library_cache.clear();
+}
+
 class PipelineCacheReadCallback : public Common::LinearDiskCacheReader<u32, u8>
 {
 public:
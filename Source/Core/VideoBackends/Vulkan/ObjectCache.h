@@ -5,8 +5,10 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -58,18 +60,41 @@ public:
   VkSampler GetLinearSampler() const { return m_linear_sampler; }
   VkSampler GetSampler(const SamplerState& info);
 
-  // Render pass cache.
+  // Render pass cache. Multiview render passes render to the first two layers at once.
   VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
-                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0);
+                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0,
+                             bool multiview = false);
 
   // Pipeline cache. Used when creating pipelines for drivers to store compiled programs.
   VkPipelineCache GetPipelineCache() const { return m_pipeline_cache; }
 
+  // Graphics pipeline library parts, which GX pipelines are linked from. Parts are keyed on the
+  // shader modules and state they were created from. Lookups are thread-safe, as pipelines are
+  // created on the shader compiler threads.
+  struct PipelineLibraryKey
+  {
+    bool operator<(const PipelineLibraryKey& rhs) const;
+
+    VkGraphicsPipelineLibraryFlagsEXT part = 0;
+    std::array<VkShaderModule, 2> shaders = {};
+    const VertexFormat* vertex_format = nullptr;
+    u32 state = 0;
+    u32 framebuffer_state = 0;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+  };
+  VkPipeline GetPipelineLibrary(const PipelineLibraryKey& key,
+                                const std::function<VkPipeline()>& create_library);
+
+  // Destroys any library parts created from the shader module. Call before destroying it.
+  void DestroyPipelineLibraries(VkShaderModule module);
+
   // Clear sampler cache, use when anisotropy mode changes
   // WARNING: Ensure none of the objects from here are in use when calling
   void ClearSamplerCache();
 
-  // Saves the pipeline cache to disk. Call when shutting down.
+  // Saves the pipeline cache to disk. Called when shutting down, and once the shader cache has
+  // finished precompiling.
   void SavePipelineCache();
 
   // Reload pipeline cache. Call when host config changes.
@@ -87,6 +112,7 @@ private:
   bool LoadPipelineCache();
   bool ValidatePipelineCache(const u8* data, size_t data_length);
   void DestroyPipelineCache();
+  void DestroyPipelineLibraryCache();
 
   std::array<VkDescriptorSetLayout, NUM_DESCRIPTOR_SET_LAYOUTS> m_descriptor_set_layouts = {};
   std::array<VkPipelineLayout, NUM_PIPELINE_LAYOUTS> m_pipeline_layouts = {};
@@ -102,12 +128,17 @@ private:
   std::unique_ptr<VKTexture> m_dummy_texture;
 
   // Render pass cache
-  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t>;
+  using RenderPassCacheKey =
+      std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t, bool>;
   std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
 
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
+
+  // pipeline library cache
+  std::map<PipelineLibraryKey, VkPipeline> m_pipeline_library_cache;
+  std::mutex m_pipeline_library_lock;
 };
 
 extern std::unique_ptr<ObjectCache> g_object_cache;
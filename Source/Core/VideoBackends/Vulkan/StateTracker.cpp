@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Vulkan/StateTracker.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
@@ -14,6 +16,7 @@
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
 #include "VideoCommon/Constants.h"
+#include "VideoCommon/Statistics.h"
 
 namespace Vulkan
 {
@@ -299,6 +302,33 @@ void StateTracker::BeginRenderPass()
 
   vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
                        VK_SUBPASS_CONTENTS_INLINE);
+  INCSTAT(g_stats.this_frame.num_render_passes);
+}
+
+bool StateTracker::InMultiviewRenderPass() const
+{
+  return InRenderPass() && m_current_render_pass == m_framebuffer->GetMultiviewRenderPass();
+}
+
+void StateTracker::BeginMultiviewRenderPass()
+{
+  if (InRenderPass())
+    return;
+
+  m_current_render_pass = m_framebuffer->GetMultiviewRenderPass();
+  m_framebuffer_render_area = m_framebuffer->GetRect();
+
+  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                                      nullptr,
+                                      m_current_render_pass,
+                                      m_framebuffer->GetMultiviewFB(),
+                                      m_framebuffer_render_area,
+                                      0,
+                                      nullptr};
+
+  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
+                       VK_SUBPASS_CONTENTS_INLINE);
+  INCSTAT(g_stats.this_frame.num_render_passes);
 }
 
 void StateTracker::BeginDiscardRenderPass()
@@ -319,6 +349,7 @@ void StateTracker::BeginDiscardRenderPass()
 
   vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
                        VK_SUBPASS_CONTENTS_INLINE);
+  INCSTAT(g_stats.this_frame.num_render_passes);
 }
 
 void StateTracker::EndRenderPass()
@@ -348,6 +379,7 @@ void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue
 
   vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
                        VK_SUBPASS_CONTENTS_INLINE);
+  INCSTAT(g_stats.this_frame.num_render_passes);
 }
 
 void StateTracker::SetViewport(const VkViewport& viewport)
@@ -374,38 +406,71 @@ bool StateTracker::Bind()
   if (!m_pipeline)
     return false;
 
+  // Multiview pipelines can only draw to layered framebuffers. This can only happen for a frame
+  // while stereoscopic 3D is being turned on.
+  const bool multiview = m_pipeline->IsMultiview();
+  if (multiview && m_framebuffer->GetMultiviewFB() == VK_NULL_HANDLE)
+    return false;
+
   // Check the render area if we were in a clear pass.
   if (m_current_render_pass == m_framebuffer->GetClearRenderPass() && !IsViewportWithinRenderArea())
     EndRenderPass();
 
+  // Game draws render both eyes in a multiview pass, while utility draws write each layer with a
+  // geometry shader, which needs a regular pass.
+  if (InRenderPass() && InMultiviewRenderPass() != multiview)
+    EndRenderPass();
+
   // Get a new descriptor set if any parts have changed
   UpdateDescriptorSet();
 
   // Start render pass if not already started
   if (!InRenderPass())
-    BeginRenderPass();
+  {
+    if (multiview)
+      BeginMultiviewRenderPass();
+    else
+      BeginRenderPass();
+  }
 
   // Re-bind parts of the pipeline
-  const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
   const bool needs_vertex_buffer = !g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader ||
                                    m_pipeline->GetUsage() != AbstractPipelineUsage::GXUber;
   if (needs_vertex_buffer && (m_dirty_flags & DIRTY_FLAG_VERTEX_BUFFER))
   {
-    vkCmdBindVertexBuffers(command_buffer, 0, 1, &m_vertex_buffer, &m_vertex_buffer_offset);
+    DrawCommand command{DrawCommand::Type::BindVertexBuffer};
+    command.buffer = {m_vertex_buffer, m_vertex_buffer_offset};
+    g_command_buffer_mgr->RecordDrawCommand(command);
     m_dirty_flags &= ~DIRTY_FLAG_VERTEX_BUFFER;
   }
 
   if (m_dirty_flags & DIRTY_FLAG_INDEX_BUFFER)
-    vkCmdBindIndexBuffer(command_buffer, m_index_buffer, m_index_buffer_offset, m_index_type);
+  {
+    DrawCommand command{DrawCommand::Type::BindIndexBuffer};
+    command.buffer = {m_index_buffer, m_index_buffer_offset, m_index_type};
+    g_command_buffer_mgr->RecordDrawCommand(command);
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_PIPELINE)
-    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipeline());
+  {
+    DrawCommand command{DrawCommand::Type::BindPipeline};
+    command.pipeline = m_pipeline->GetVkPipeline();
+    g_command_buffer_mgr->RecordDrawCommand(command);
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_VIEWPORT)
-    vkCmdSetViewport(command_buffer, 0, 1, &m_viewport);
+  {
+    DrawCommand command{DrawCommand::Type::SetViewport};
+    command.viewport = m_viewport;
+    g_command_buffer_mgr->RecordDrawCommand(command);
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_SCISSOR)
-    vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
+  {
+    DrawCommand command{DrawCommand::Type::SetScissor};
+    command.scissor = m_scissor;
+    g_command_buffer_mgr->RecordDrawCommand(command);
+  }
 
   m_dirty_flags &=
       ~(DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR);
@@ -482,7 +547,8 @@ void StateTracker::UpdateGXDescriptorSet()
   u32 num_writes = 0;
 
   const bool needs_gs_ubo = g_ActiveConfig.backend_info.bSupportsGeometryShaders ||
-                            g_ActiveConfig.UseVSForLinePointExpand();
+                            g_ActiveConfig.UseVSForLinePointExpand() ||
+                            g_ActiveConfig.backend_info.bSupportsMultiview;
 
   if (m_dirty_flags & DIRTY_FLAG_GX_UBOS || m_gx_descriptor_sets[0] == VK_NULL_HANDLE)
   {
@@ -517,7 +583,10 @@ void StateTracker::UpdateGXDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_UBOS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+  // With push descriptors, the samplers are pushed after the other sets have been bound instead.
+  const bool push_samplers = g_vulkan_context->SupportsPushDescriptors();
+  if (!push_samplers &&
+      (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE))
   {
     m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
@@ -573,26 +642,41 @@ void StateTracker::UpdateGXDescriptorSet()
   if (num_writes > 0)
     vkUpdateDescriptorSets(g_vulkan_context->GetDevice(), num_writes, writes.data(), 0, nullptr);
 
+  const u32 num_ubo_offsets =
+      needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1);
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
-                            m_gx_descriptor_sets.data(),
-                            needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS :
-                                           (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-                            m_bindings.gx_ubo_offsets.data());
+    if (push_samplers)
+    {
+      // The pushed sampler set sits between the UBO and SSBO sets.
+      BindDescriptorSets(0, 1, m_gx_descriptor_sets.data(), num_ubo_offsets,
+                         m_bindings.gx_ubo_offsets.data());
+      if (needs_ssbo)
+        BindDescriptorSets(2, 1, &m_gx_descriptor_sets[2], 0, nullptr);
+      m_dirty_flags |= DIRTY_FLAG_GX_SAMPLERS;
+    }
+    else
+    {
+      BindDescriptorSets(0, needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
+                         m_gx_descriptor_sets.data(), num_ubo_offsets,
+                         m_bindings.gx_ubo_offsets.data());
+    }
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
   }
   else if (m_dirty_flags & DIRTY_FLAG_GX_UBO_OFFSETS)
   {
-    vkCmdBindDescriptorSets(
-        g_command_buffer_mgr->GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
-        m_pipeline->GetVkPipelineLayout(), 0, 1, m_gx_descriptor_sets.data(),
-        needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-        m_bindings.gx_ubo_offsets.data());
+    BindDescriptorSets(0, 1, m_gx_descriptor_sets.data(), num_ubo_offsets,
+                       m_bindings.gx_ubo_offsets.data());
     m_dirty_flags &= ~DIRTY_FLAG_GX_UBO_OFFSETS;
   }
+
+  if (push_samplers && (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS))
+  {
+    g_command_buffer_mgr->RecordPushDescriptorImages(
+        m_pipeline->GetVkPipelineLayout(), 1, m_bindings.samplers.data(),
+        static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS));
+    m_dirty_flags &= ~DIRTY_FLAG_GX_SAMPLERS;
+  }
 }
 
 void StateTracker::UpdateUtilityDescriptorSet()
@@ -655,21 +739,33 @@ void StateTracker::UpdateUtilityDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+    BindDescriptorSets(0, NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
+                       &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            1, m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
+    BindDescriptorSets(0, 1, m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
 }
 
+void StateTracker::BindDescriptorSets(u32 first_set, u32 num_sets, const VkDescriptorSet* sets,
+                                      u32 num_offsets, const u32* offsets)
+{
+  static_assert(NUM_GX_DESCRIPTOR_SETS <= DrawCommand::MAX_DESCRIPTOR_SETS);
+  static_assert(NUM_UTILITY_DESCRIPTOR_SETS <= DrawCommand::MAX_DESCRIPTOR_SETS);
+
+  DrawCommand command{DrawCommand::Type::BindDescriptorSets};
+  command.descriptor_sets.layout = m_pipeline->GetVkPipelineLayout();
+  command.descriptor_sets.first_set = first_set;
+  command.descriptor_sets.num_sets = num_sets;
+  command.descriptor_sets.num_offsets = num_offsets;
+  std::copy_n(sets, num_sets, command.descriptor_sets.sets.begin());
+  std::copy_n(offsets, num_offsets, command.descriptor_sets.offsets.begin());
+  g_command_buffer_mgr->RecordDrawCommand(command);
+}
+
 void StateTracker::UpdateComputeDescriptorSet()
 {
   // Max number of updates - UBO, Samplers, TexelBuffer, Image
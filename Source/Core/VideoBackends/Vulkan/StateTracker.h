@@ -54,6 +54,7 @@ public:
   // When Bind() is next called, the pass will be restarted.
   // Calling this function is allowed even if a pass has not begun.
   bool InRenderPass() const { return m_current_render_pass != VK_NULL_HANDLE; }
+  bool InMultiviewRenderPass() const;
   void BeginRenderPass();
   void BeginDiscardRenderPass();
   void EndRenderPass();
@@ -112,6 +113,9 @@ private:
 
   bool Initialize();
 
+  // Starts the render pass which multiview pipelines draw both eyes in.
+  void BeginMultiviewRenderPass();
+
   // Check that the specified viewport is within the render area.
   // If not, ends the render pass if it is a clear render pass.
   bool IsViewportWithinRenderArea() const;
@@ -121,6 +125,10 @@ private:
   void UpdateUtilityDescriptorSet();
   void UpdateComputeDescriptorSet();
 
+  // Binds graphics descriptor sets for the current pipeline through the command buffer manager.
+  void BindDescriptorSets(u32 first_set, u32 num_sets, const VkDescriptorSet* sets,
+                          u32 num_offsets, const u32* offsets);
+
   // Which bindings/state has to be updated before the next draw.
   u32 m_dirty_flags = 0;
 
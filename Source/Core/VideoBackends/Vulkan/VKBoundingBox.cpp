@@ -37,7 +37,7 @@ bool VKBoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+void VKBoundingBox::CopyToReadbackBuffer()
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -63,6 +63,11 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
   m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer();
 
   // Wait until these commands complete.
   VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
@@ -77,6 +82,26 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool VKBoundingBox::QueueRead()
+{
+  CopyToReadbackBuffer();
+  m_queued_read_fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+
+  // Submit now, so that the values are ready as soon as possible.
+  VKGfx::GetInstance()->ExecuteCommandBuffer(true, false);
+  return true;
+}
+
+bool VKBoundingBox::TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values)
+{
+  if (!g_command_buffer_mgr->IsFenceCounterComplete(m_queued_read_fence_counter))
+    return false;
+
+  m_readback_buffer->InvalidateCPUCache();
+  m_readback_buffer->Read(0, values.data(), BUFFER_SIZE, false);
+  return true;
+}
+
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   // We can't issue vkCmdUpdateBuffer within a render pass.
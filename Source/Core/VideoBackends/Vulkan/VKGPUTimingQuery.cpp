@@ -0,0 +1,109 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Vulkan/VKGPUTimingQuery.h"
+
+#include <vector>
+
+#include "VideoBackends/Vulkan/CommandBufferManager.h"
+#include "VideoBackends/Vulkan/VulkanContext.h"
+
+namespace Vulkan
+{
+GPUTimingQuery::GPUTimingQuery()
+{
+  const VkPhysicalDeviceLimits& limits = g_vulkan_context->GetDeviceLimits();
+  if (!limits.timestampComputeAndGraphics || limits.timestampPeriod <= 0.0f)
+    return;
+
+  VkQueryPoolCreateInfo info = {
+      VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,  // VkStructureType                  sType
+      nullptr,                                   // const void*                      pNext
+      0,                                         // VkQueryPoolCreateFlags           flags
+      VK_QUERY_TYPE_TIMESTAMP,                   // VkQueryType                      queryType
+      NUM_QUERIES,                               // uint32_t                         queryCount
+      0  // VkQueryPipelineStatisticFlags    pipelineStatistics;
+  };
+
+  VkResult res = vkCreateQueryPool(g_vulkan_context->GetDevice(), &info, nullptr, &m_query_pool);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateQueryPool failed: ");
+    m_query_pool = VK_NULL_HANDLE;
+    return;
+  }
+
+  // Devices which set timestampComputeAndGraphics support timestamps on every graphics queue, but
+  // may still only implement some of the bits.
+  u32 valid_bits = 64;
+  u32 queue_family_count = 0;
+  vkGetPhysicalDeviceQueueFamilyProperties(g_vulkan_context->GetPhysicalDevice(),
+                                           &queue_family_count, nullptr);
+  std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+  vkGetPhysicalDeviceQueueFamilyProperties(g_vulkan_context->GetPhysicalDevice(),
+                                           &queue_family_count, queue_families.data());
+  const u32 queue_family = g_vulkan_context->GetGraphicsQueueFamilyIndex();
+  if (queue_family < queue_family_count && queue_families[queue_family].timestampValidBits != 0)
+    valid_bits = queue_families[queue_family].timestampValidBits;
+
+  m_timestamp_mask = valid_bits >= 64 ? ~u64(0) : (u64(1) << valid_bits) - 1;
+  m_timestamp_period = limits.timestampPeriod;
+}
+
+GPUTimingQuery::~GPUTimingQuery()
+{
+  if (m_query_pool != VK_NULL_HANDLE)
+    vkDestroyQueryPool(g_vulkan_context->GetDevice(), m_query_pool, nullptr);
+}
+
+void GPUTimingQuery::ResetQueries(u32 first, u32 count)
+{
+  // The init command buffer runs before any of the timestamps in the current command buffer, and
+  // doesn't require ending the current render pass.
+  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentInitCommandBuffer(), m_query_pool, first,
+                      count);
+}
+
+void GPUTimingQuery::WriteTimestamp(u32 query)
+{
+  vkCmdWriteTimestamp(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_query_pool, query);
+  m_query_fence_counters[query] = g_command_buffer_mgr->GetCurrentFenceCounter();
+}
+
+void GPUTimingQuery::BeginSegment(u32 query)
+{
+  WriteTimestamp(query);
+}
+
+void GPUTimingQuery::EndSegment(u32 query)
+{
+  WriteTimestamp(query);
+}
+
+bool GPUTimingQuery::GetSegmentTimes(u32 first, u32 count, u64* times_ns)
+{
+  // The closing timestamp is written last, so once its command buffer is done, all of them are.
+  if (!g_command_buffer_mgr->IsFenceCounterComplete(m_query_fence_counters[first + count]))
+    return false;
+
+  std::array<u64, QUERIES_PER_FRAME> timestamps;
+  VkResult res = vkGetQueryPoolResults(g_vulkan_context->GetDevice(), m_query_pool, first,
+                                       count + 1, (count + 1) * sizeof(u64), timestamps.data(),
+                                       sizeof(u64), VK_QUERY_RESULT_64_BIT);
+  if (res != VK_SUCCESS)
+  {
+    if (res != VK_NOT_READY)
+      LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+    return false;
+  }
+
+  for (u32 i = 0; i < count; i++)
+  {
+    const u64 ticks = (timestamps[i + 1] - timestamps[i]) & m_timestamp_mask;
+    times_ns[i] = static_cast<u64>(ticks * m_timestamp_period);
+  }
+
+  return true;
+}
+}  // namespace Vulkan
@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Vulkan/Constants.h"
+#include "VideoCommon/GPUTimingQuery.h"
+
+namespace Vulkan
+{
+// Writes a timestamp at every segment boundary, and times each segment as the difference between
+// its timestamp and the next one.
+class GPUTimingQuery final : public GPUTimingQueryBase
+{
+public:
+  GPUTimingQuery();
+  ~GPUTimingQuery() override;
+
+  bool IsSupported() const override { return m_query_pool != VK_NULL_HANDLE; }
+
+protected:
+  void ResetQueries(u32 first, u32 count) override;
+  void BeginSegment(u32 query) override;
+  void EndSegment(u32 query) override;
+  bool GetSegmentTimes(u32 first, u32 count, u64* times_ns) override;
+
+private:
+  void WriteTimestamp(u32 query);
+
+  VkQueryPool m_query_pool = VK_NULL_HANDLE;
+  double m_timestamp_period = 1.0;
+  u64 m_timestamp_mask = 0;
+
+  // Fence counter of the command buffer each timestamp was written in.
+  std::array<u64, NUM_QUERIES> m_query_fence_counters{};
+};
+}  // namespace Vulkan
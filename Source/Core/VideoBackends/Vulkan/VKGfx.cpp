@@ -18,6 +18,7 @@
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 #include "VideoBackends/Vulkan/ObjectCache.h"
+#include "VideoBackends/Vulkan/VKGPUTimingQuery.h"
 #include "VideoBackends/Vulkan/StateTracker.h"
 #include "VideoBackends/Vulkan/VKPipeline.h"
 #include "VideoBackends/Vulkan/VKShader.h"
@@ -89,6 +90,22 @@ std::unique_ptr<AbstractPipeline> VKGfx::CreatePipeline(const AbstractPipelineCo
   return VKPipeline::Create(config);
 }
 
+std::unique_ptr<AbstractPipeline> VKGfx::CreateLinkedPipeline(const AbstractPipelineConfig& config)
+{
+  return VKPipeline::CreateLinked(config);
+}
+
+std::unique_ptr<GPUTimingQueryBase> VKGfx::CreateGPUTimingQuery()
+{
+  return std::make_unique<GPUTimingQuery>();
+}
+
+void VKGfx::SavePipelineCache()
+{
+  if (g_ActiveConfig.bShaderCache)
+    g_object_cache->SavePipelineCache();
+}
+
 std::unique_ptr<AbstractFramebuffer>
 VKGfx::CreateFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment,
                          std::vector<AbstractTexture*> additional_color_attachments)
@@ -189,7 +206,6 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
     }
     if (!clear_attachments.empty())
     {
-      VkClearRect vk_rect = {target_vk_rc, 0, g_framebuffer_manager->GetEFBLayers()};
       if (!StateTracker::GetInstance()->IsWithinRenderArea(
               target_vk_rc.offset.x, target_vk_rc.offset.y, target_vk_rc.extent.width,
               target_vk_rc.extent.height))
@@ -198,6 +214,12 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
       }
       StateTracker::GetInstance()->BeginRenderPass();
 
+      // In a multiview pass, clearing layer 0 clears it in every view.
+      const u32 layers = StateTracker::GetInstance()->InMultiviewRenderPass() ?
+                             1 :
+                             g_framebuffer_manager->GetEFBLayers();
+      VkClearRect vk_rect = {target_vk_rc, 0, layers};
+
       vkCmdClearAttachments(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             static_cast<uint32_t>(clear_attachments.size()),
                             clear_attachments.data(), 1, &vk_rect);
@@ -580,7 +602,9 @@ void VKGfx::Draw(u32 base_vertex, u32 num_vertices)
   if (!StateTracker::GetInstance()->Bind())
     return;
 
-  vkCmdDraw(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_vertices, 1, base_vertex, 0);
+  DrawCommand command{DrawCommand::Type::Draw};
+  command.draw = {num_vertices, base_vertex, 0};
+  g_command_buffer_mgr->RecordDrawCommand(command);
 }
 
 void VKGfx::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
@@ -588,8 +612,9 @@ void VKGfx::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
   if (!StateTracker::GetInstance()->Bind())
     return;
 
-  vkCmdDrawIndexed(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_indices, 1, base_index,
-                   base_vertex, 0);
+  DrawCommand command{DrawCommand::Type::DrawIndexed};
+  command.draw = {num_indices, base_index, static_cast<s32>(base_vertex)};
+  g_command_buffer_mgr->RecordDrawCommand(command);
 }
 
 void VKGfx::DispatchComputeShader(const AbstractShader* shader, u32 groupsize_x, u32 groupsize_y,
@@ -48,6 +48,10 @@ public:
   std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config,
                                                    const void* cache_data = nullptr,
                                                    size_t cache_data_length = 0) override;
+  std::unique_ptr<AbstractPipeline>
+  CreateLinkedPipeline(const AbstractPipelineConfig& config) override;
+  void SavePipelineCache() override;
+  std::unique_ptr<GPUTimingQueryBase> CreateGPUTimingQuery() override;
 
   SwapChain* GetSwapChain() const { return m_swap_chain.get(); }
 
@@ -193,11 +193,15 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
       &g_Config, g_vulkan_context->GetPhysicalDevice(), g_vulkan_context->GetDeviceProperties());
   g_Config.backend_info.bSupportsExclusiveFullscreen =
       enable_surface && g_vulkan_context->SupportsExclusiveFullscreen(wsi, surface);
+  g_Config.backend_info.bSupportsFastPipelineLinking =
+      g_vulkan_context->SupportsGraphicsPipelineLibrary();
+  g_Config.backend_info.bSupportsMultiview = g_vulkan_context->SupportsMultiview();
 
   UpdateActiveConfig();
 
   // Create command buffers. We do this separately because the other classes depend on it.
-  g_command_buffer_mgr = std::make_unique<CommandBufferManager>(g_Config.bBackendMultithreading);
+  g_command_buffer_mgr = std::make_unique<CommandBufferManager>(g_Config.bBackendMultithreading,
+                                                                g_Config.bBackendMultithreading);
   if (!g_command_buffer_mgr->Initialize())
   {
     PanicAlertFmt("Failed to create Vulkan command buffers");
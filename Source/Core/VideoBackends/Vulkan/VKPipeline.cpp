@@ -3,7 +3,9 @@
 
 #include "VideoBackends/Vulkan/VKPipeline.h"
 
+#include <algorithm>
 #include <array>
+#include <span>
 
 #include "Common/Assert.h"
 #include "Common/EnumMap.h"
@@ -20,9 +22,10 @@
 namespace Vulkan
 {
 VKPipeline::VKPipeline(const AbstractPipelineConfig& config, VkPipeline pipeline,
-                       VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage)
+                       VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage,
+                       bool multiview)
     : AbstractPipeline(config), m_pipeline(pipeline), m_pipeline_layout(pipeline_layout),
-      m_usage(usage)
+      m_usage(usage), m_multiview(multiview)
 {
 }
 
@@ -240,16 +243,125 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
-std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
+static VkPipeline CreatePipelineLibrary(VkGraphicsPipelineLibraryFlagsEXT part,
+                                        VkGraphicsPipelineCreateInfo pipeline_info,
+                                        std::span<const VkPipelineShaderStageCreateInfo> stages)
+{
+  // State which doesn't belong to the part being created is ignored, but the stages have to be
+  // limited to the ones in the part.
+  VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr, part};
+  pipeline_info.pNext = &library_info;
+  pipeline_info.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+  pipeline_info.stageCount = static_cast<uint32_t>(stages.size());
+  pipeline_info.pStages = stages.data();
+
+  VkPipeline library;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &pipeline_info, nullptr, &library);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed for pipeline library: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return library;
+}
+
+static VkPipeline LinkPipeline(const AbstractPipelineConfig& config,
+                               const VkGraphicsPipelineCreateInfo& pipeline_info)
+{
+  const std::span<const VkPipelineShaderStageCreateInfo> stages(pipeline_info.pStages,
+                                                                pipeline_info.stageCount);
+  const VKShader* vertex_shader = static_cast<const VKShader*>(config.vertex_shader);
+  const VKShader* geometry_shader = static_cast<const VKShader*>(config.geometry_shader);
+  const VKShader* pixel_shader = static_cast<const VKShader*>(config.pixel_shader);
+
+  // The fragment shader stage always comes last.
+  const auto pre_rasterization_stages = stages.first(stages.size() - 1);
+  const auto fragment_stages = stages.last(1);
+
+  ObjectCache::PipelineLibraryKey vertex_input_key;
+  vertex_input_key.part = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+  vertex_input_key.vertex_format = static_cast<const VertexFormat*>(config.vertex_format);
+  vertex_input_key.state = static_cast<u32>(config.rasterization_state.primitive.Value());
+
+  ObjectCache::PipelineLibraryKey pre_rasterization_key;
+  pre_rasterization_key.part = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+  pre_rasterization_key.shaders = {
+      vertex_shader->GetShaderModule(),
+      geometry_shader ? geometry_shader->GetShaderModule() : VK_NULL_HANDLE};
+  pre_rasterization_key.state = config.rasterization_state.hex;
+  pre_rasterization_key.layout = pipeline_info.layout;
+  pre_rasterization_key.render_pass = pipeline_info.renderPass;
+
+  ObjectCache::PipelineLibraryKey fragment_shader_key;
+  fragment_shader_key.part = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+  fragment_shader_key.shaders = {pixel_shader->GetShaderModule(), VK_NULL_HANDLE};
+  fragment_shader_key.state = config.depth_state.hex;
+  fragment_shader_key.framebuffer_state = config.framebuffer_state.hex;
+  fragment_shader_key.layout = pipeline_info.layout;
+  fragment_shader_key.render_pass = pipeline_info.renderPass;
+
+  ObjectCache::PipelineLibraryKey fragment_output_key;
+  fragment_output_key.part = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+  fragment_output_key.state = config.blending_state.hex;
+  fragment_output_key.framebuffer_state = config.framebuffer_state.hex;
+  fragment_output_key.render_pass = pipeline_info.renderPass;
+
+  const auto get_library = [&](const ObjectCache::PipelineLibraryKey& key,
+                               std::span<const VkPipelineShaderStageCreateInfo> part_stages) {
+    return g_object_cache->GetPipelineLibrary(
+        key, [&] { return CreatePipelineLibrary(key.part, pipeline_info, part_stages); });
+  };
+  const std::array<VkPipeline, 4> libraries = {
+      get_library(vertex_input_key, {}),
+      get_library(pre_rasterization_key, pre_rasterization_stages),
+      get_library(fragment_shader_key, fragment_stages),
+      get_library(fragment_output_key, {}),
+  };
+  if (std::find(libraries.begin(), libraries.end(), VK_NULL_HANDLE) != libraries.end())
+    return VK_NULL_HANDLE;
+
+  // Leaving out VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT is what makes this fast.
+  VkPipelineLibraryCreateInfoKHR link_info = {VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+                                              nullptr, static_cast<uint32_t>(libraries.size()),
+                                              libraries.data()};
+  VkGraphicsPipelineCreateInfo linked_pipeline_info = {};
+  linked_pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  linked_pipeline_info.pNext = &link_info;
+  linked_pipeline_info.layout = pipeline_info.layout;
+  linked_pipeline_info.basePipelineIndex = -1;
+
+  VkPipeline pipeline;
+  VkResult res = vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(),
+                                           g_object_cache->GetPipelineCache(), 1,
+                                           &linked_pipeline_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed to link pipeline: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
+static std::unique_ptr<VKPipeline> CreatePipeline(const AbstractPipelineConfig& config, bool link)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
 
+  // With multiview stereo, game draws render both eyes at once. Utility draws still write each
+  // layer with a geometry shader.
+  const bool multiview =
+      config.usage != AbstractPipelineUsage::Utility && g_ActiveConfig.UseMultiviewStereo();
+
   // Get render pass for config.
   VkRenderPass render_pass = g_object_cache->GetRenderPass(
       VKTexture::GetVkFormatForHostTextureFormat(config.framebuffer_state.color_texture_format),
       VKTexture::GetVkFormatForHostTextureFormat(config.framebuffer_state.depth_texture_format),
       config.framebuffer_state.samples, VK_ATTACHMENT_LOAD_OP_LOAD,
-      config.framebuffer_state.additional_color_attachment_count);
+      config.framebuffer_state.additional_color_attachment_count, multiview);
 
   if (render_pass == VK_NULL_HANDLE)
   {
@@ -417,15 +529,36 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
   };
 
   VkPipeline pipeline;
-  VkResult res =
-      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
-                                1, &pipeline_info, nullptr, &pipeline);
-  if (res != VK_SUCCESS)
+  if (link)
   {
-    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed: ");
-    return VK_NULL_HANDLE;
+    pipeline = LinkPipeline(config, pipeline_info);
+    if (pipeline == VK_NULL_HANDLE)
+      return nullptr;
   }
+  else
+  {
+    VkResult res =
+        vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                  1, &pipeline_info, nullptr, &pipeline);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed: ");
+      return VK_NULL_HANDLE;
+    }
+  }
+
+  return std::make_unique<VKPipeline>(config, pipeline, pipeline_layout, config.usage,
+                                      multiview);
+}
 
-  return std::make_unique<VKPipeline>(config, pipeline, pipeline_layout, config.usage);
+std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
+{
+  return CreatePipeline(config, false);
+}
+
+std::unique_ptr<VKPipeline> VKPipeline::CreateLinked(const AbstractPipelineConfig& config)
+{
+  DEBUG_ASSERT(config.usage == AbstractPipelineUsage::GX);
+  return CreatePipeline(config, true);
 }
 }  // namespace Vulkan
@@ -14,18 +14,26 @@ class VKPipeline final : public AbstractPipeline
 {
 public:
   explicit VKPipeline(const AbstractPipelineConfig& config, VkPipeline pipeline,
-                      VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage);
+                      VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage,
+                      bool multiview);
   ~VKPipeline() override;
 
   VkPipeline GetVkPipeline() const { return m_pipeline; }
   VkPipelineLayout GetVkPipelineLayout() const { return m_pipeline_layout; }
   AbstractPipelineUsage GetUsage() const { return m_usage; }
+  // Multiview pipelines render both eyes at once, and have to be used in a multiview render pass.
+  bool IsMultiview() const { return m_multiview; }
   static std::unique_ptr<VKPipeline> Create(const AbstractPipelineConfig& config);
 
+  // Links a GX pipeline from graphics pipeline library parts, which is much quicker than a full
+  // compile once the parts exist. Requires VK_EXT_graphics_pipeline_library.
+  static std::unique_ptr<VKPipeline> CreateLinked(const AbstractPipelineConfig& config);
+
 private:
   VkPipeline m_pipeline;
   VkPipelineLayout m_pipeline_layout;
   AbstractPipelineUsage m_usage;
+  bool m_multiview;
 };
 
 }  // namespace Vulkan
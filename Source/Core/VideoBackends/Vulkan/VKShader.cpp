@@ -48,7 +48,11 @@ VKShader::VKShader(std::vector<u32> spv, VkPipeline compute_pipeline, std::strin
 VKShader::~VKShader()
 {
   if (m_stage != ShaderStage::Compute)
+  {
+    if (g_object_cache)
+      g_object_cache->DestroyPipelineLibraries(m_module);
     vkDestroyShaderModule(g_vulkan_context->GetDevice(), m_module, nullptr);
+  }
   else
     vkDestroyPipeline(g_vulkan_context->GetDevice(), m_compute_pipeline, nullptr);
 }
@@ -3,52 +3,38 @@
 
 #pragma once
 
-#include <cstddef>
-#include <deque>
 #include <memory>
-#include <utility>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
+#include "VideoCommon/StreamBufferBase.h"
 
 namespace Vulkan
 {
-class StreamBuffer
+class StreamBuffer final : public StreamBufferBase
 {
 public:
-  StreamBuffer(VkBufferUsageFlags usage, u32 size);
-  ~StreamBuffer();
+  explicit StreamBuffer(VkBufferUsageFlags usage);
+  ~StreamBuffer() override;
 
   VkBuffer GetBuffer() const { return m_buffer; }
-  u8* GetHostPointer() const { return m_host_pointer; }
-  u8* GetCurrentHostPointer() const { return m_host_pointer + m_current_offset; }
-  u32 GetCurrentSize() const { return m_size; }
-  u32 GetCurrentOffset() const { return m_current_offset; }
-  bool ReserveMemory(u32 num_bytes, u32 alignment);
-  void CommitMemory(u32 final_num_bytes);
 
   static std::unique_ptr<StreamBuffer> Create(VkBufferUsageFlags usage, u32 size);
 
-private:
-  bool AllocateBuffer();
-  void UpdateCurrentFencePosition();
-  void UpdateGPUPosition();
+protected:
+  u64 GetCurrentFenceCounter() const override;
+  u64 GetCompletedFenceCounter() const override;
+  void WaitForFenceCounter(u64 fence_counter) override;
+  bool ResizeBuffer(u32 new_size) override;
+  void FlushMemory(u32 offset, u32 size) override;
 
-  // Waits for as many fences as needed to allocate num_bytes bytes from the buffer.
-  bool WaitForClearSpace(u32 num_bytes);
+private:
+  bool AllocateBuffer(u32 size);
 
   VkBufferUsageFlags m_usage;
-  u32 m_size;
-  u32 m_current_offset = 0;
-  u32 m_current_gpu_position = 0;
-  u32 m_last_allocation_size = 0;
 
   VkBuffer m_buffer = VK_NULL_HANDLE;
   VmaAllocation m_alloc = VK_NULL_HANDLE;
-  u8* m_host_pointer = nullptr;
-
-  // List of fences and the corresponding positions in the buffer
-  std::deque<std::pair<u64, u32>> m_tracked_fences;
 };
 
 }  // namespace Vulkan
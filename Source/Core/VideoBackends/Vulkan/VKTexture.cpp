@@ -1013,20 +1013,24 @@ VKFramebuffer::VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attac
                              std::vector<AbstractTexture*> additional_color_attachments, u32 width,
                              u32 height, u32 layers, u32 samples, VkFramebuffer fb,
                              VkRenderPass load_render_pass, VkRenderPass discard_render_pass,
-                             VkRenderPass clear_render_pass)
+                             VkRenderPass clear_render_pass, VkFramebuffer multiview_fb,
+                             VkRenderPass multiview_render_pass)
     : AbstractFramebuffer(
           color_attachment, depth_attachment, std::move(additional_color_attachments),
           color_attachment ? color_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           depth_attachment ? depth_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           width, height, layers, samples),
       m_fb(fb), m_load_render_pass(load_render_pass), m_discard_render_pass(discard_render_pass),
-      m_clear_render_pass(clear_render_pass)
+      m_clear_render_pass(clear_render_pass), m_multiview_fb(multiview_fb),
+      m_multiview_render_pass(multiview_render_pass)
 {
 }
 
 VKFramebuffer::~VKFramebuffer()
 {
   g_command_buffer_mgr->DeferFramebufferDestruction(m_fb);
+  if (m_multiview_fb != VK_NULL_HANDLE)
+    g_command_buffer_mgr->DeferFramebufferDestruction(m_multiview_fb);
 }
 
 std::unique_ptr<VKFramebuffer>
@@ -1092,9 +1096,36 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
     return nullptr;
   }
 
+  // A multiview framebuffer has a single layer, the views select the layers of the attachments.
+  VkFramebuffer multiview_fb = VK_NULL_HANDLE;
+  VkRenderPass multiview_render_pass = VK_NULL_HANDLE;
+  if (layers == 2 && g_ActiveConfig.backend_info.bSupportsMultiview)
+  {
+    multiview_render_pass = g_object_cache->GetRenderPass(
+        vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_LOAD,
+        static_cast<u8>(additional_color_attachments.size()), true);
+    if (multiview_render_pass == VK_NULL_HANDLE)
+    {
+      vkDestroyFramebuffer(g_vulkan_context->GetDevice(), fb, nullptr);
+      return nullptr;
+    }
+
+    framebuffer_info.renderPass = multiview_render_pass;
+    framebuffer_info.layers = 1;
+    res = vkCreateFramebuffer(g_vulkan_context->GetDevice(), &framebuffer_info, nullptr,
+                              &multiview_fb);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateFramebuffer failed for multiview: ");
+      vkDestroyFramebuffer(g_vulkan_context->GetDevice(), fb, nullptr);
+      return nullptr;
+    }
+  }
+
   return std::make_unique<VKFramebuffer>(
       color_attachment, depth_attachment, std::move(additional_color_attachments), width, height,
-      layers, samples, fb, load_render_pass, discard_render_pass, clear_render_pass);
+      layers, samples, fb, load_render_pass, discard_render_pass, clear_render_pass, multiview_fb,
+      multiview_render_pass);
 }
 
 void VKFramebuffer::Unbind()
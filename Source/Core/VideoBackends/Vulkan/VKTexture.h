@@ -129,7 +129,8 @@ public:
   VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment,
                 std::vector<AbstractTexture*> additional_color_attachments, u32 width, u32 height,
                 u32 layers, u32 samples, VkFramebuffer fb, VkRenderPass load_render_pass,
-                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass);
+                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass,
+                VkFramebuffer multiview_fb, VkRenderPass multiview_render_pass);
   ~VKFramebuffer() override;
 
   VkFramebuffer GetFB() const { return m_fb; }
@@ -139,6 +140,11 @@ public:
   VkRenderPass GetDiscardRenderPass() const { return m_discard_render_pass; }
   VkRenderPass GetClearRenderPass() const { return m_clear_render_pass; }
 
+  // Renders to both layers of a stereo framebuffer at once. Only created for layered framebuffers,
+  // when the device supports multiview.
+  VkFramebuffer GetMultiviewFB() const { return m_multiview_fb; }
+  VkRenderPass GetMultiviewRenderPass() const { return m_multiview_render_pass; }
+
   void Unbind();
   void TransitionForRender();
 
@@ -158,6 +164,8 @@ protected:
   VkRenderPass m_load_render_pass;
   VkRenderPass m_discard_render_pass;
   VkRenderPass m_clear_render_pass;
+  VkFramebuffer m_multiview_fb;
+  VkRenderPass m_multiview_render_pass;
 };
 
 }  // namespace Vulkan
@@ -78,6 +78,10 @@ bool VertexManager::Initialize()
     return false;
   }
 
+  // The vertex and index buffers are bound for every draw, so they can be reallocated.
+  m_vertex_stream_buffer->SetMaximumSize(VERTEX_STREAM_BUFFER_SIZE * MAX_STREAM_BUFFER_GROWTH);
+  m_index_stream_buffer->SetMaximumSize(INDEX_STREAM_BUFFER_SIZE * MAX_STREAM_BUFFER_GROWTH);
+
   // The validation layer complains if max(offsets) + max(ubo_ranges) >= ubo_size.
   // To work around this we reserve the maximum buffer size at all times, but only commit
   // as many bytes as we use.
@@ -190,7 +194,7 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
   ADDSTAT(g_stats.this_frame.bytes_index_streamed, static_cast<int>(index_data_size));
 
   StateTracker::GetInstance()->SetVertexBuffer(m_vertex_stream_buffer->GetBuffer(), 0,
-                                               VERTEX_STREAM_BUFFER_SIZE);
+                                               m_vertex_stream_buffer->GetSize());
   StateTracker::GetInstance()->SetIndexBuffer(m_index_stream_buffer->GetBuffer(), 0,
                                               VK_INDEX_TYPE_UINT16);
 }
@@ -390,7 +394,7 @@ void VertexManager::UploadUtilityUniforms(const void* data, u32 data_size)
 bool VertexManager::UploadTexelBuffer(const void* data, u32 data_size, TexelBufferFormat format,
                                       u32* out_offset)
 {
-  if (data_size > m_texel_stream_buffer->GetCurrentSize())
+  if (data_size > m_texel_stream_buffer->GetSize())
     return false;
 
   const u32 elem_size = GetTexelBufferElementSize(format);
@@ -421,7 +425,7 @@ bool VertexManager::UploadTexelBuffer(const void* data, u32 data_size, TexelBuff
   const u32 elem_size = GetTexelBufferElementSize(format);
   const u32 palette_elem_size = GetTexelBufferElementSize(palette_format);
   const u32 reserve_size = data_size + palette_size + palette_elem_size;
-  if (reserve_size > m_texel_stream_buffer->GetCurrentSize())
+  if (reserve_size > m_texel_stream_buffer->GetSize())
     return false;
 
   if (!m_texel_stream_buffer->ReserveMemory(reserve_size, elem_size))
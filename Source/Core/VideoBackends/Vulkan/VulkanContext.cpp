@@ -383,6 +383,8 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
   config->backend_info.bSupportsDynamicVertexLoader = true;        // Assumed support.
   config->backend_info.bSupportsVSLinePointExpand = true;          // Assumed support.
   config->backend_info.bSupportsHDROutput = true;                  // Assumed support.
+  config->backend_info.bSupportsFastPipelineLinking = false;       // Dependent on features.
+  config->backend_info.bSupportsMultiview = false;                 // Dependent on features.
 }
 
 void VulkanContext::PopulateBackendInfoAdapters(VideoConfig* config, const GPUList& gpu_list)
@@ -596,6 +598,13 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
   AddExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, false);
   AddExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
 
+  // VK_EXT_graphics_pipeline_library depends on VK_KHR_pipeline_library.
+  if (AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false))
+    AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false);
+
+  AddExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, false);
+  AddExtension(VK_KHR_MULTIVIEW_EXTENSION_NAME, false);
+
   return true;
 }
 
@@ -755,6 +764,31 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
 
   device_info.pEnabledFeatures = &m_device_features;
 
+  // Graphics pipeline libraries have to be enabled explicitly.
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT graphics_pipeline_library_features = {};
+  graphics_pipeline_library_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  if (SupportsDeviceExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+      QueryGraphicsPipelineLibrarySupport())
+  {
+    graphics_pipeline_library_features.graphicsPipelineLibrary = VK_TRUE;
+    device_info.pNext = &graphics_pipeline_library_features;
+    m_supports_graphics_pipeline_library = true;
+  }
+
+  // So does multiview, which is used to render both eyes of stereoscopic 3D in one pass.
+  VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+  multiview_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+  if (SupportsDeviceExtension(VK_KHR_MULTIVIEW_EXTENSION_NAME) && QueryMultiviewSupport())
+  {
+    multiview_features.multiview = VK_TRUE;
+    multiview_features.multiviewGeometryShader = m_device_features.geometryShader;
+    if (m_supports_graphics_pipeline_library)
+      multiview_features.pNext = &graphics_pipeline_library_features;
+    device_info.pNext = &multiview_features;
+    m_supports_multiview = true;
+  }
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -773,6 +807,10 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   if (!LoadVulkanDeviceFunctions(m_device))
     return false;
 
+  m_supports_push_descriptors =
+      SupportsDeviceExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) && vkCmdPushDescriptorSetKHR;
+  INFO_LOG_FMT(VIDEO, "Push descriptors: {}", m_supports_push_descriptors);
+
   // Grab the graphics and present queues.
   vkGetDeviceQueue(m_device, m_graphics_queue_family_index, 0, &m_graphics_queue);
   if (surface)
@@ -1003,6 +1041,61 @@ void VulkanContext::PopulateShaderSubgroupSupport()
       subgroup_properties.supportedStages & VK_SHADER_STAGE_FRAGMENT_BIT;
 }
 
+bool VulkanContext::QueryGraphicsPipelineLibrarySupport() const
+{
+  if (!vkGetPhysicalDeviceFeatures2 || !vkGetPhysicalDeviceProperties2 ||
+      (VK_VERSION_MAJOR(m_device_properties.apiVersion) == 1 &&
+       VK_VERSION_MINOR(m_device_properties.apiVersion) < 1))
+  {
+    return false;
+  }
+
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT features = {};
+  features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  VkPhysicalDeviceFeatures2 device_features_2 = {};
+  device_features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  device_features_2.pNext = &features;
+  vkGetPhysicalDeviceFeatures2(m_physical_device, &device_features_2);
+
+  VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 device_properties_2 = {};
+  device_properties_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  device_properties_2.pNext = &properties;
+  vkGetPhysicalDeviceProperties2(m_physical_device, &device_properties_2);
+
+  // Without fast linking, a linked pipeline can take as long to create as a monolithic one, so
+  // there would be no point in linking them over using ubershaders.
+  INFO_LOG_FMT(VIDEO, "Graphics pipeline library: {}, fast linking: {}",
+               features.graphicsPipelineLibrary == VK_TRUE,
+               properties.graphicsPipelineLibraryFastLinking == VK_TRUE);
+  return features.graphicsPipelineLibrary == VK_TRUE &&
+         properties.graphicsPipelineLibraryFastLinking == VK_TRUE;
+}
+
+bool VulkanContext::QueryMultiviewSupport() const
+{
+  if (!vkGetPhysicalDeviceFeatures2 || (VK_VERSION_MAJOR(m_device_properties.apiVersion) == 1 &&
+                                        VK_VERSION_MINOR(m_device_properties.apiVersion) < 1))
+  {
+    return false;
+  }
+
+  VkPhysicalDeviceMultiviewFeatures features = {};
+  features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+  VkPhysicalDeviceFeatures2 device_features_2 = {};
+  device_features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  device_features_2.pNext = &features;
+  vkGetPhysicalDeviceFeatures2(m_physical_device, &device_features_2);
+
+  // Lines, points and wireframe are still expanded by a geometry shader inside the multiview
+  // render pass, so that has to be supported as well.
+  INFO_LOG_FMT(VIDEO, "Multiview: {}, with geometry shaders: {}", features.multiview == VK_TRUE,
+               features.multiviewGeometryShader == VK_TRUE);
+  return features.multiview == VK_TRUE &&
+         (features.multiviewGeometryShader == VK_TRUE || !m_device_features.geometryShader);
+}
+
 bool VulkanContext::SupportsExclusiveFullscreen(const WindowSystemInfo& wsi, VkSurfaceKHR surface)
 {
 #ifdef SUPPORTS_VULKAN_EXCLUSIVE_FULLSCREEN
@@ -83,6 +83,9 @@ public:
   }
   u32 GetShaderSubgroupSize() const { return m_shader_subgroup_size; }
   bool SupportsShaderSubgroupOperations() const { return m_supports_shader_subgroup_operations; }
+  bool SupportsGraphicsPipelineLibrary() const { return m_supports_graphics_pipeline_library; }
+  bool SupportsMultiview() const { return m_supports_multiview; }
+  bool SupportsPushDescriptors() const { return m_supports_push_descriptors; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
@@ -122,6 +125,8 @@ private:
   bool CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer);
   void InitDriverDetails();
   void PopulateShaderSubgroupSupport();
+  bool QueryGraphicsPipelineLibrarySupport() const;
+  bool QueryMultiviewSupport() const;
   bool CreateAllocator(u32 vk_api_version);
 
   VkInstance m_instance = VK_NULL_HANDLE;
@@ -143,6 +148,9 @@ private:
 
   u32 m_shader_subgroup_size = 1;
   bool m_supports_shader_subgroup_operations = false;
+  bool m_supports_graphics_pipeline_library = false;
+  bool m_supports_multiview = false;
+  bool m_supports_push_descriptors = false;
 
   std::vector<std::string> m_device_extensions;
 };
@@ -6,9 +6,11 @@
 #include "Common/Assert.h"
 
 #include "VideoCommon/AbstractFramebuffer.h"
+#include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/ShaderCache.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -22,6 +24,12 @@ AbstractGfx::AbstractGfx()
       ConfigChangedEvent::Register([this](u32 bits) { OnConfigChanged(bits); }, "AbstractGfx");
 }
 
+std::unique_ptr<AbstractPipeline>
+AbstractGfx::CreateLinkedPipeline(const AbstractPipelineConfig& config)
+{
+  return nullptr;
+}
+
 bool AbstractGfx::IsHeadless() const
 {
   return true;
@@ -162,6 +170,11 @@ std::unique_ptr<VideoCommon::AsyncShaderCompiler> AbstractGfx::CreateAsyncShader
   return std::make_unique<VideoCommon::AsyncShaderCompiler>();
 }
 
+std::unique_ptr<GPUTimingQueryBase> AbstractGfx::CreateGPUTimingQuery()
+{
+  return std::make_unique<GPUTimingQueryBase>();
+}
+
 void AbstractGfx::OnConfigChanged(u32 changed_bits)
 {
   // If there's any shader changes, wait for the GPU to finish before destroying anything.
@@ -17,6 +17,7 @@ class AbstractPipeline;
 class AbstractShader;
 class AbstractTexture;
 class AbstractStagingTexture;
+class GPUTimingQueryBase;
 class NativeVertexFormat;
 struct ComputePipelineConfig;
 struct AbstractPipelineConfig;
@@ -118,6 +119,15 @@ public:
   virtual std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config,
                                                            const void* cache_data = nullptr,
                                                            size_t cache_data_length = 0) = 0;
+  // Links a pipeline from the already-compiled shaders in the config, without whole-pipeline
+  // optimization. Only called when backend_info.bSupportsFastPipelineLinking is set.
+  virtual std::unique_ptr<AbstractPipeline>
+  CreateLinkedPipeline(const AbstractPipelineConfig& config);
+
+  // Writes out the pipeline binaries kept by the driver, for backends which cache them as a whole
+  // rather than per pipeline through AbstractPipeline::GetCacheData. Called by the shader cache
+  // once precompilation has finished, so that the binaries survive an unclean exit.
+  virtual void SavePipelineCache() {}
 
   AbstractFramebuffer* GetCurrentFramebuffer() const { return m_current_framebuffer; }
 
@@ -156,6 +166,9 @@ public:
 
   virtual std::unique_ptr<VideoCommon::AsyncShaderCompiler> CreateAsyncShaderCompiler();
 
+  // Backends which can time GPU work return their own timing query implementation.
+  virtual std::unique_ptr<GPUTimingQueryBase> CreateGPUTimingQuery();
+
   // Called when the configuration changes, and backend structures need to be updated.
   virtual void OnConfigChanged(u32 changed_bits);
 
@@ -20,6 +20,18 @@ void AbstractTexture::FinishedRendering()
 }
 
 bool AbstractTexture::Save(const std::string& filename, unsigned int level, int compression) const
+{
+  std::vector<u8> texels;
+  if (!ReadRGBA8(level, &texels))
+    return false;
+
+  const u32 level_width = std::max(1u, m_config.width >> level);
+  const u32 level_height = std::max(1u, m_config.height >> level);
+  return Common::SavePNG(filename, texels.data(), Common::ImageByteFormat::RGBA, level_width,
+                         level_height, static_cast<int>(level_width * 4), compression);
+}
+
+bool AbstractTexture::ReadRGBA8(unsigned int level, std::vector<u8>* texels) const
 {
   // We can't dump compressed textures currently (it would mean drawing them to a RGBA8
   // framebuffer, and saving that). TextureCache does not call Save for custom textures
@@ -47,15 +59,13 @@ bool AbstractTexture::Save(const std::string& filename, unsigned int level, int
   // Copy to the readback texture's buffer.
   readback_texture->CopyFromTexture(this, 0, level);
   readback_texture->Flush();
-
-  // Map it so we can encode it to the file.
   if (!readback_texture->Map())
     return false;
 
-  return Common::SavePNG(filename,
-                         reinterpret_cast<const u8*>(readback_texture->GetMappedPointer()),
-                         Common::ImageByteFormat::RGBA, level_width, level_height,
-                         static_cast<int>(readback_texture->GetMappedStride()), compression);
+  texels->resize(static_cast<size_t>(level_width) * level_height * 4);
+  readback_texture->ReadTexels(readback_texture_config.GetRect(), texels->data(),
+                               level_width * 4);
+  return true;
 }
 
 bool AbstractTexture::IsCompressedFormat(AbstractTextureFormat format)
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
@@ -40,6 +41,9 @@ public:
   bool IsMultisampled() const { return m_config.IsMultisampled(); }
   bool Save(const std::string& filename, unsigned int level, int compression = 6) const;
 
+  // Downloads the given level as tightly-packed RGBA8 texels, for saving on another thread.
+  bool ReadRGBA8(unsigned int level, std::vector<u8>* texels) const;
+
   static bool IsCompressedFormat(AbstractTextureFormat format);
   static bool IsDepthFormat(AbstractTextureFormat format);
   static bool IsStencilFormat(AbstractTextureFormat format);
@@ -23,6 +23,27 @@ bool CustomAsset::Load()
   return load_information.m_bytes_loaded != 0;
 }
 
+std::size_t CustomAsset::Unload()
+{
+  UnloadImpl();
+
+  std::lock_guard lk(m_info_lock);
+  const std::size_t bytes_freed = m_bytes_loaded;
+  m_bytes_loaded = 0;
+  m_last_loaded_time = {};
+  return bytes_freed;
+}
+
+void CustomAsset::MarkUsed() const
+{
+  m_last_used_time.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+Clock::time_point CustomAsset::GetLastUsedTime() const
+{
+  return Clock::time_point(Clock::duration(m_last_used_time.load(std::memory_order_relaxed)));
+}
+
 CustomAssetLibrary::TimeType CustomAsset::GetLastWriteTime() const
 {
   return m_owning_library->GetLastAssetWriteTime(m_asset_id);
@@ -6,6 +6,7 @@
 #include "Common/CommonTypes.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -28,6 +29,15 @@ public:
   // Loads the asset from the library returning a pass/fail result
   bool Load();
 
+  // Frees the loaded data, returning how many bytes were freed. The asset can be loaded again
+  // afterwards, and reports a last loaded time of epoch until then
+  std::size_t Unload();
+
+  // Records that the asset's data is in use, which the loader uses to prioritize loading
+  // and to decide which assets to unload first when memory runs low
+  void MarkUsed() const;
+  Clock::time_point GetLastUsedTime() const;
+
   // Queries the last time the asset was modified or standard epoch time
   // if the asset hasn't been modified yet
   // Note: not thread safe, expected to be called by the loader
@@ -48,11 +58,14 @@ protected:
 
 private:
   virtual CustomAssetLibrary::LoadInfo LoadImpl(const CustomAssetLibrary::AssetID& asset_id) = 0;
+  virtual void UnloadImpl() = 0;
   CustomAssetLibrary::AssetID m_asset_id;
 
   mutable std::mutex m_info_lock;
   std::size_t m_bytes_loaded = 0;
   CustomAssetLibrary::TimeType m_last_loaded_time = {};
+
+  mutable std::atomic<Clock::rep> m_last_used_time = 0;
 };
 
 // An abstract class that is expected to
@@ -73,6 +86,7 @@ public:
   // they want to handle reloads
   [[nodiscard]] std::shared_ptr<UnderlyingType> GetData() const
   {
+    MarkUsed();
     std::lock_guard lk(m_data_lock);
     if (m_loaded)
       return m_data;
@@ -83,6 +97,14 @@ protected:
   bool m_loaded = false;
   mutable std::mutex m_data_lock;
   std::shared_ptr<UnderlyingType> m_data;
+
+private:
+  void UnloadImpl() override
+  {
+    std::lock_guard lk(m_data_lock);
+    m_loaded = false;
+    m_data.reset();
+  }
 };
 
 // A helper struct that contains
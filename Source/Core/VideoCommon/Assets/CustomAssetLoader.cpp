@@ -3,7 +3,12 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+
+#include "Common/CPUDetect.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
 
 namespace VideoCommon
@@ -17,6 +22,11 @@ void CustomAssetLoader::Init()
   // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
   m_max_memory_available =
       (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+  if (const int memory_limit_mb = Config::Get(Config::GFX_CUSTOM_ASSET_MEMORY_LIMIT);
+      memory_limit_mb > 0)
+  {
+    m_max_memory_available = std::min(m_max_memory_available, size_t(memory_limit_mb) << 20);
+  }
 
   m_asset_monitor_thread = std::thread([this]() {
     Common::SetCurrentThreadName("Asset monitor");
@@ -29,80 +39,237 @@ void CustomAssetLoader::Init()
 
       std::this_thread::sleep_for(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
 
+      // Keep the assets alive until the lock is released, as releasing the last reference to an
+      // asset removes it from the map
+      std::vector<std::shared_ptr<CustomAsset>> changed_assets;
       std::lock_guard lk(m_asset_load_lock);
       for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
       {
-        if (auto ptr = asset_to_monitor.lock())
+        if (auto ptr = asset_to_monitor.asset.lock())
         {
           const auto write_time = ptr->GetLastWriteTime();
-          if (write_time > ptr->GetLastLoadedTime())
+          if (write_time > ptr->GetLastLoadedTime() && !m_pending_loads.contains(ptr.get()))
           {
-            (void)ptr->Load();
+            QueueLoad(ptr, asset_to_monitor.type);
+            changed_assets.push_back(std::move(ptr));
           }
         }
       }
     }
   });
 
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (m_memory_exceeded)
-        return;
-
-      if (ptr->Load())
-      {
-        std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        m_total_bytes_loaded += asset_memory_size;
-        m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        if (m_total_bytes_loaded > m_max_memory_available)
-        {
-          ERROR_LOG_FMT(VIDEO,
-                        "Asset memory exceeded with asset '{}', future assets won't load until "
-                        "memory is available.",
-                        ptr->GetAssetId());
-          m_memory_exceeded = true;
-        }
-      }
-    }
-  });
+  m_asset_load_shutdown = false;
+  const int num_threads = std::clamp(cpu_info.num_cores - 3, 1, 4);
+  for (int i = 0; i < num_threads; i++)
+    m_asset_load_threads.emplace_back(&CustomAssetLoader::AssetLoadThread, this);
 }
 
 void CustomAssetLoader ::Shutdown()
 {
-  m_asset_load_thread.Shutdown(true);
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    m_asset_load_shutdown = true;
+    m_pending_loads.clear();
+  }
+  m_asset_load_wake.notify_all();
+  for (std::thread& thread : m_asset_load_threads)
+    thread.join();
+  m_asset_load_threads.clear();
 
   m_asset_monitor_thread_shutdown.Set();
   m_asset_monitor_thread.join();
+
+  for (size_t i = 0; i < m_load_statistics.size(); i++)
+  {
+    const LoadStatistics& stats = m_load_statistics[i];
+    if (stats.num_loads == 0)
+      continue;
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    INFO_LOG_FMT(VIDEO, "Loaded {} {} assets, average latency {:.1f} ms, max {:.1f} ms",
+                 stats.num_loads, static_cast<AssetType>(i),
+                 Milliseconds(stats.total_latency).count() / stats.num_loads,
+                 Milliseconds(stats.max_latency).count());
+  }
+
   m_assets_to_monitor.clear();
+  m_unloaded_assets.clear();
+  m_load_statistics = {};
   m_total_bytes_loaded = 0;
+  m_memory_exceeded = false;
+}
+
+void CustomAssetLoader::QueueLoad(const std::shared_ptr<CustomAsset>& asset, AssetType type)
+{
+  m_pending_loads.insert_or_assign(asset.get(), PendingLoad{asset, type, Clock::now()});
+  m_asset_load_wake.notify_one();
+}
+
+bool CustomAssetLoader::PopNextLoad(PendingLoad* load)
+{
+  if (m_pending_loads.empty())
+    return false;
+
+  // Priorities change whenever an asset is used, so there's no ordering to maintain. Assets used
+  // since they were requested are likely to be visible, and requests come in the order textures
+  // show up, so the most recent of the two goes first.
+  const auto priority = [](const auto& pending) {
+    return std::max(pending.first->GetLastUsedTime(), pending.second.request_time);
+  };
+  const auto it = std::max_element(
+      m_pending_loads.begin(), m_pending_loads.end(),
+      [&](const auto& a, const auto& b) { return priority(a) < priority(b); });
+
+  *load = std::move(it->second);
+  m_pending_loads.erase(it);
+  return true;
+}
+
+void CustomAssetLoader::AssetLoadThread()
+{
+  Common::SetCurrentThreadName("Custom Asset Loader");
+
+  std::unique_lock lk(m_asset_load_lock);
+  while (true)
+  {
+    m_asset_load_wake.wait(lk,
+                           [this] { return m_asset_load_shutdown || !m_pending_loads.empty(); });
+    if (m_asset_load_shutdown)
+      return;
+
+    PendingLoad load;
+    if (!PopNextLoad(&load))
+      continue;
+
+    lk.unlock();
+    LoadAsset(load);
+    lk.lock();
+  }
+}
+
+void CustomAssetLoader::LoadAsset(const PendingLoad& load)
+{
+  auto ptr = load.asset.lock();
+  if (!ptr)
+    return;
+
+  if (m_memory_exceeded)
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    UnloadUnusedAssets();
+    if (m_total_bytes_loaded > m_max_memory_available)
+    {
+      // Try again once the asset is requested again
+      m_unloaded_assets.insert(ptr.get());
+      return;
+    }
+    m_memory_exceeded = false;
+  }
+
+  const std::size_t previous_size = ptr->GetByteSizeInMemory();
+  if (!ptr->Load())
+    return;
+
+  std::lock_guard lk(m_asset_load_lock);
+  LoadStatistics& stats = m_load_statistics[static_cast<size_t>(load.type)];
+  const Clock::duration latency = Clock::now() - load.request_time;
+  stats.num_loads++;
+  stats.total_latency += latency;
+  stats.max_latency = std::max(stats.max_latency, latency);
+
+  // Reloads replace the previously loaded data
+  m_total_bytes_loaded += ptr->GetByteSizeInMemory() - previous_size;
+  m_assets_to_monitor.try_emplace(ptr->GetAssetId(), LoadedAsset{ptr, load.type});
+  if (m_total_bytes_loaded > m_max_memory_available)
+  {
+    UnloadUnusedAssets();
+    if (m_total_bytes_loaded > m_max_memory_available)
+    {
+      ERROR_LOG_FMT(VIDEO,
+                    "Asset memory exceeded with asset '{}', future assets won't load until "
+                    "memory is available.",
+                    ptr->GetAssetId());
+      m_memory_exceeded = true;
+    }
+  }
+}
+
+void CustomAssetLoader::UnloadUnusedAssets()
+{
+  // Keep the assets alive until the end, as releasing the last reference to an asset removes it
+  // from the maps
+  std::vector<std::shared_ptr<CustomAsset>> candidates;
+  const Clock::time_point unused_since = Clock::now() - MIN_TIME_UNUSED_BEFORE_UNLOAD;
+  for (const auto& [asset_id, loaded_asset] : m_assets_to_monitor)
+  {
+    auto ptr = loaded_asset.asset.lock();
+    if (ptr && ptr->GetLastUsedTime() < unused_since)
+      candidates.push_back(std::move(ptr));
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+    return a->GetLastUsedTime() < b->GetLastUsedTime();
+  });
+
+  std::size_t num_unloaded = 0;
+  for (const auto& asset : candidates)
+  {
+    if (m_total_bytes_loaded <= m_max_memory_available)
+      break;
+
+    m_total_bytes_loaded -= asset->Unload();
+    m_assets_to_monitor.erase(asset->GetAssetId());
+    m_unloaded_assets.insert(asset.get());
+    num_unloaded++;
+  }
+
+  if (num_unloaded != 0)
+  {
+    INFO_LOG_FMT(VIDEO, "Unloaded {} assets which were not used recently to free memory",
+                 num_unloaded);
+  }
+}
+
+std::array<CustomAssetLoader::LoadStatistics, CustomAssetLoader::NUM_ASSET_TYPES>
+CustomAssetLoader::GetLoadStatistics() const
+{
+  std::lock_guard lk(m_asset_load_lock);
+  return m_load_statistics;
+}
+
+std::size_t CustomAssetLoader::GetBytesLoaded() const
+{
+  std::lock_guard lk(m_asset_load_lock);
+  return m_total_bytes_loaded;
 }
 
 std::shared_ptr<GameTextureAsset>
 CustomAssetLoader::LoadGameTexture(const CustomAssetLibrary::AssetID& asset_id,
                                    std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library));
+  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library),
+                                             AssetType::GameTexture);
 }
 
 std::shared_ptr<PixelShaderAsset>
 CustomAssetLoader::LoadPixelShader(const CustomAssetLibrary::AssetID& asset_id,
                                    std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<PixelShaderAsset>(asset_id, m_pixel_shaders, std::move(library));
+  return LoadOrCreateAsset<PixelShaderAsset>(asset_id, m_pixel_shaders, std::move(library),
+                                             AssetType::PixelShader);
 }
 
 std::shared_ptr<MaterialAsset>
 CustomAssetLoader::LoadMaterial(const CustomAssetLibrary::AssetID& asset_id,
                                 std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<MaterialAsset>(asset_id, m_materials, std::move(library));
+  return LoadOrCreateAsset<MaterialAsset>(asset_id, m_materials, std::move(library),
+                                          AssetType::Material);
 }
 
 std::shared_ptr<MeshAsset> CustomAssetLoader::LoadMesh(const CustomAssetLibrary::AssetID& asset_id,
                                                        std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<MeshAsset>(asset_id, m_meshes, std::move(library));
+  return LoadOrCreateAsset<MeshAsset>(asset_id, m_meshes, std::move(library), AssetType::Mesh);
 }
 }  // namespace VideoCommon
@@ -3,15 +3,19 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <vector>
 
+#include "Common/EnumFormatter.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
-#include "Common/WorkQueueThread.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
 #include "VideoCommon/Assets/MeshAsset.h"
@@ -22,9 +26,29 @@ namespace VideoCommon
 {
 // This class is responsible for loading data asynchronously when requested
 // and watches that data asynchronously reloading it if it changes
+// Loads are spread across a pool of threads, the most recently used assets first, and assets
+// which haven't been used in a while are unloaded when the memory limit is reached
 class CustomAssetLoader
 {
 public:
+  enum class AssetType
+  {
+    GameTexture,
+    PixelShader,
+    Material,
+    Mesh,
+    Count
+  };
+  static constexpr size_t NUM_ASSET_TYPES = static_cast<size_t>(AssetType::Count);
+
+  struct LoadStatistics
+  {
+    u32 num_loads = 0;
+    // Time from an asset being requested until its load finished
+    Clock::duration total_latency{};
+    Clock::duration max_latency{};
+  };
+
   CustomAssetLoader() = default;
   ~CustomAssetLoader() = default;
   CustomAssetLoader(const CustomAssetLoader&) = delete;
@@ -52,26 +76,51 @@ public:
   std::shared_ptr<MeshAsset> LoadMesh(const CustomAssetLibrary::AssetID& asset_id,
                                       std::shared_ptr<CustomAssetLibrary> library);
 
+  std::array<LoadStatistics, NUM_ASSET_TYPES> GetLoadStatistics() const;
+  std::size_t GetBytesLoaded() const;
+  std::size_t GetMemoryLimit() const { return m_max_memory_available; }
+
 private:
+  struct PendingLoad
+  {
+    std::weak_ptr<CustomAsset> asset;
+    AssetType type;
+    Clock::time_point request_time;
+  };
+
+  struct LoadedAsset
+  {
+    std::weak_ptr<CustomAsset> asset;
+    AssetType type;
+  };
+
   // TODO C++20: use a 'derived_from' concept against 'CustomAsset' when available
-  template <typename AssetType>
-  std::shared_ptr<AssetType>
+  template <typename T>
+  std::shared_ptr<T>
   LoadOrCreateAsset(const CustomAssetLibrary::AssetID& asset_id,
-                    std::map<CustomAssetLibrary::AssetID, std::weak_ptr<AssetType>>& asset_map,
-                    std::shared_ptr<CustomAssetLibrary> library)
+                    std::map<CustomAssetLibrary::AssetID, std::weak_ptr<T>>& asset_map,
+                    std::shared_ptr<CustomAssetLibrary> library, AssetType type)
   {
     auto [it, inserted] = asset_map.try_emplace(asset_id);
     if (!inserted)
     {
       auto shared = it->second.lock();
       if (shared)
+      {
+        // Assets which were unloaded to free memory are loaded again once they're requested
+        std::lock_guard lk(m_asset_load_lock);
+        if (m_unloaded_assets.erase(shared.get()) != 0)
+          QueueLoad(shared, type);
         return shared;
+      }
     }
-    std::shared_ptr<AssetType> ptr(new AssetType(std::move(library), asset_id), [&](AssetType* a) {
+    std::shared_ptr<T> ptr(new T(std::move(library), asset_id), [&](T* a) {
       {
         std::lock_guard lk(m_asset_load_lock);
         m_total_bytes_loaded -= a->GetByteSizeInMemory();
         m_assets_to_monitor.erase(a->GetAssetId());
+        m_pending_loads.erase(a);
+        m_unloaded_assets.erase(a);
         if (m_max_memory_available >= m_total_bytes_loaded && m_memory_exceeded)
         {
           INFO_LOG_FMT(VIDEO, "Asset memory went below limit, new assets can begin loading.");
@@ -81,11 +130,24 @@ private:
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+
+    std::lock_guard lk(m_asset_load_lock);
+    QueueLoad(ptr, type);
     return ptr;
   }
 
+  // These must be called with m_asset_load_lock held
+  void QueueLoad(const std::shared_ptr<CustomAsset>& asset, AssetType type);
+  bool PopNextLoad(PendingLoad* load);
+  void UnloadUnusedAssets();
+
+  void AssetLoadThread();
+  void LoadAsset(const PendingLoad& load);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
+  // Assets used within this time are not unloaded to free memory, as they are likely to be
+  // visible
+  static constexpr auto MIN_TIME_UNUSED_BEFORE_UNLOAD = std::chrono::seconds{5};
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<GameTextureAsset>> m_game_textures;
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<PixelShaderAsset>> m_pixel_shaders;
@@ -98,11 +160,24 @@ private:
   std::size_t m_max_memory_available = 0;
   std::atomic_bool m_memory_exceeded = false;
 
-  std::map<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>> m_assets_to_monitor;
+  // The loaded assets, which are also unloaded from here when memory runs low
+  std::map<CustomAssetLibrary::AssetID, LoadedAsset> m_assets_to_monitor;
+  std::map<const CustomAsset*, PendingLoad> m_pending_loads;
+  std::set<const CustomAsset*> m_unloaded_assets;
+  std::array<LoadStatistics, NUM_ASSET_TYPES> m_load_statistics;
 
   // Use a recursive mutex to handle the scenario where an asset goes out of scope while
-  // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
-  std::recursive_mutex m_asset_load_lock;
-  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+  // holding the lock, as the asset's deleter in 'LoadOrCreateAsset' locks it as well
+  mutable std::recursive_mutex m_asset_load_lock;
+  std::condition_variable_any m_asset_load_wake;
+  bool m_asset_load_shutdown = false;
+  std::vector<std::thread> m_asset_load_threads;
 };
 }  // namespace VideoCommon
+
+template <>
+struct fmt::formatter<VideoCommon::CustomAssetLoader::AssetType>
+    : EnumFormatter<VideoCommon::CustomAssetLoader::AssetType::Mesh>
+{
+  constexpr formatter() : EnumFormatter({"texture", "pixel shader", "material", "mesh"}) {}
+};
@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/RenderState.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon
+{
+namespace
+{
+bool IsRangeInFile(u64 offset, u64 size, u64 file_size)
+{
+  return offset <= file_size && size <= file_size - offset;
+}
+
+bool IsFormatSupported(AbstractTextureFormat format)
+{
+  switch (format)
+  {
+  case AbstractTextureFormat::RGBA8:
+    return true;
+  case AbstractTextureFormat::DXT1:
+  case AbstractTextureFormat::DXT3:
+  case AbstractTextureFormat::DXT5:
+    return g_ActiveConfig.backend_info.bSupportsST3CTextures;
+  case AbstractTextureFormat::BPTC:
+    return g_ActiveConfig.backend_info.bSupportsBPTCTextures;
+  default:
+    return false;
+  }
+}
+}  // namespace
+
+bool TexturePackAssetLibrary::Open(const std::string& path)
+{
+  m_path = path;
+  m_textures = {};
+  m_levels = {};
+  m_names = {};
+  if (!m_file.Open(path))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open texture pack '{}'", path);
+    return false;
+  }
+
+  const u8* const data = m_file.GetData();
+  const u64 file_size = m_file.GetSize();
+
+  TexturePackFile::Header header;
+  if (file_size < sizeof(header))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is too small", path);
+    m_file.Close();
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+
+  if (header.magic != TexturePackFile::MAGIC || header.version != TexturePackFile::VERSION)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an unsupported format or version {}", path,
+                  header.version);
+    m_file.Close();
+    return false;
+  }
+
+  if (!IsRangeInFile(header.textures_offset,
+                     u64{header.num_textures} * sizeof(TexturePackFile::TextureEntry), file_size) ||
+      !IsRangeInFile(header.levels_offset,
+                     u64{header.num_levels} * sizeof(TexturePackFile::LevelEntry), file_size) ||
+      !IsRangeInFile(header.names_offset, header.names_size, file_size))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is truncated", path);
+    m_file.Close();
+    return false;
+  }
+
+  m_textures = {reinterpret_cast<const TexturePackFile::TextureEntry*>(data +
+                                                                        header.textures_offset),
+                header.num_textures};
+  m_levels = {reinterpret_cast<const TexturePackFile::LevelEntry*>(data + header.levels_offset),
+              header.num_levels};
+  m_names = {reinterpret_cast<const char*>(data + header.names_offset),
+             static_cast<size_t>(header.names_size)};
+
+  if (!ValidateIndex())
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid index", path);
+    m_textures = {};
+    m_levels = {};
+    m_names = {};
+    m_file.Close();
+    return false;
+  }
+
+  m_open_time = std::chrono::system_clock::now();
+  return true;
+}
+
+bool TexturePackAssetLibrary::ValidateIndex() const
+{
+  // Only the index is checked here, so none of the texture data has to be paged in.
+  const u64 file_size = m_file.GetSize();
+  for (const TexturePackFile::LevelEntry& level : m_levels)
+  {
+    if (!IsRangeInFile(level.data_offset, level.data_size, file_size) ||
+        level.format >= static_cast<u32>(AbstractTextureFormat::Undefined))
+    {
+      return false;
+    }
+  }
+
+  u64 previous_hash = 0;
+  for (const TexturePackFile::TextureEntry& texture : m_textures)
+  {
+    if (texture.name_hash < previous_hash ||
+        !IsRangeInFile(texture.name_offset, texture.name_size, m_names.size()) ||
+        texture.num_slices == 0 || texture.num_levels == 0 ||
+        !IsRangeInFile(texture.first_level, u64{texture.num_slices} * texture.num_levels,
+                       m_levels.size()))
+    {
+      return false;
+    }
+    previous_hash = texture.name_hash;
+  }
+
+  return true;
+}
+
+void TexturePackAssetLibrary::ForEachTexture(
+    const std::function<void(std::string_view name, bool has_arbitrary_mipmaps)>& func) const
+{
+  for (const TexturePackFile::TextureEntry& texture : m_textures)
+    func(GetName(texture), (texture.flags & TexturePackFile::TEXTURE_FLAG_ARBITRARY_MIPMAPS) != 0);
+}
+
+std::string_view
+TexturePackAssetLibrary::GetName(const TexturePackFile::TextureEntry& texture) const
+{
+  return m_names.substr(texture.name_offset, texture.name_size);
+}
+
+const TexturePackFile::TextureEntry*
+TexturePackAssetLibrary::FindTexture(std::string_view name) const
+{
+  const u64 hash = TexturePackFile::HashName(name);
+  auto it = std::lower_bound(m_textures.begin(), m_textures.end(), hash,
+                             [](const auto& texture, u64 h) { return texture.name_hash < h; });
+  for (; it != m_textures.end() && it->name_hash == hash; ++it)
+  {
+    if (GetName(*it) == name)
+      return &*it;
+  }
+
+  return nullptr;
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  TextureData* data)
+{
+  const TexturePackFile::TextureEntry* const texture = FindTexture(asset_id);
+  if (!texture)
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - not found in texture pack '{}'!", asset_id, m_path);
+    return {};
+  }
+
+  data->m_sampler = RenderState::GetLinearSamplerState();
+  data->m_type = TextureData::Type::Type_Texture2D;
+  data->m_texture.m_slices.resize(texture->num_slices);
+
+  std::size_t bytes_loaded = 0;
+  u32 level_index = texture->first_level;
+  for (auto& slice : data->m_texture.m_slices)
+  {
+    slice.m_levels.resize(texture->num_levels);
+    for (auto& level : slice.m_levels)
+    {
+      const TexturePackFile::LevelEntry& level_entry = m_levels[level_index++];
+      level.format = static_cast<AbstractTextureFormat>(level_entry.format);
+      if (!IsFormatSupported(level.format))
+      {
+        ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture format is not supported by the backend!",
+                      asset_id);
+        return {};
+      }
+
+      // This is the only place the texture data is touched, paging it in from the file.
+      const u8* const level_data = m_file.GetData() + level_entry.data_offset;
+      level.data.assign(level_data, level_data + level_entry.data_size);
+      level.width = level_entry.width;
+      level.height = level_entry.height;
+      level.row_length = level_entry.row_length;
+      bytes_loaded += level.data.size();
+    }
+  }
+
+  return LoadInfo{bytes_loaded, m_open_time};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadPixelShader(const AssetID& asset_id,
+                                                                      PixelShaderData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                   MaterialData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMesh(const AssetID& asset_id,
+                                                               MeshData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::TimeType
+TexturePackAssetLibrary::GetLastAssetWriteTime(const AssetID& asset_id) const
+{
+  return m_open_time;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,48 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Common/MemoryMappedFile.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackFile.h"
+
+namespace VideoCommon
+{
+// This class implements 'CustomAssetLibrary' and loads textures from a memory-mapped texture
+// pack file, see TexturePackFile.h. The asset ids are the texture names.
+class TexturePackAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  bool Open(const std::string& path);
+
+  // Calls the function with the name of every texture in the pack
+  void ForEachTexture(
+      const std::function<void(std::string_view name, bool has_arbitrary_mipmaps)>& func) const;
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureData* data) override;
+  LoadInfo LoadPixelShader(const AssetID& asset_id, PixelShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+  // The pack can't change while it's mapped, so this is the time it was opened
+  TimeType GetLastAssetWriteTime(const AssetID& asset_id) const override;
+
+private:
+  bool ValidateIndex() const;
+  const TexturePackFile::TextureEntry* FindTexture(std::string_view name) const;
+  std::string_view GetName(const TexturePackFile::TextureEntry& texture) const;
+
+  std::string m_path;
+  File::MemoryMappedFile m_file;
+  std::span<const TexturePackFile::TextureEntry> m_textures;
+  std::span<const TexturePackFile::LevelEntry> m_levels;
+  std::string_view m_names;
+  TimeType m_open_time;
+};
+}  // namespace VideoCommon
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackFile.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <xxhash.h>
+
+#include "Common/Align.h"
+#include "Common/Logging/Log.h"
+
+namespace VideoCommon
+{
+u64 TexturePackFile::HashName(std::string_view name)
+{
+  return XXH64(name.data(), name.size(), 0);
+}
+
+bool TexturePackWriter::Open(const std::string& path)
+{
+  m_textures.clear();
+  m_levels.clear();
+  m_names.clear();
+
+  if (!m_file.Open(path, "wb"))
+    return false;
+
+  // The header is written by Finish, once the location of the index is known.
+  const TexturePackFile::Header header{};
+  m_data_end = sizeof(header);
+  return m_file.WriteArray(&header, 1);
+}
+
+bool TexturePackWriter::AddTexture(std::string_view name, bool has_arbitrary_mipmaps,
+                                   const CustomTextureData& data)
+{
+  if (data.m_slices.empty() || data.m_slices[0].m_levels.empty())
+    return false;
+
+  const size_t num_levels = data.m_slices[0].m_levels.size();
+  if (data.m_slices.size() > std::numeric_limits<u16>::max() ||
+      num_levels > std::numeric_limits<u16>::max() ||
+      std::any_of(data.m_slices.begin(), data.m_slices.end(),
+                  [&](const auto& slice) { return slice.m_levels.size() != num_levels; }))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture '{}' has an unsupported number of slices or levels", name);
+    return false;
+  }
+
+  TexturePackFile::TextureEntry& texture = m_textures.emplace_back();
+  texture.name_hash = TexturePackFile::HashName(name);
+  texture.name_offset = static_cast<u32>(m_names.size());
+  texture.name_size = static_cast<u32>(name.size());
+  texture.flags = has_arbitrary_mipmaps ? TexturePackFile::TEXTURE_FLAG_ARBITRARY_MIPMAPS : 0;
+  texture.first_level = static_cast<u32>(m_levels.size());
+  texture.num_slices = static_cast<u16>(data.m_slices.size());
+  texture.num_levels = static_cast<u16>(num_levels);
+  m_names.append(name);
+
+  static constexpr u8 padding[TexturePackFile::DATA_ALIGNMENT] = {};
+  for (const auto& slice : data.m_slices)
+  {
+    for (const auto& level : slice.m_levels)
+    {
+      const u64 data_offset = Common::AlignUp(m_data_end, TexturePackFile::DATA_ALIGNMENT);
+      if (!m_file.WriteBytes(padding, data_offset - m_data_end) ||
+          !m_file.WriteBytes(level.data.data(), level.data.size()))
+      {
+        return false;
+      }
+      m_data_end = data_offset + level.data.size();
+
+      TexturePackFile::LevelEntry& level_entry = m_levels.emplace_back();
+      level_entry.data_offset = data_offset;
+      level_entry.data_size = level.data.size();
+      level_entry.format = static_cast<u32>(level.format);
+      level_entry.width = level.width;
+      level_entry.height = level.height;
+      level_entry.row_length = level.row_length;
+    }
+  }
+
+  return true;
+}
+
+bool TexturePackWriter::Finish()
+{
+  std::sort(m_textures.begin(), m_textures.end(),
+            [](const auto& a, const auto& b) { return a.name_hash < b.name_hash; });
+
+  TexturePackFile::Header header{};
+  header.magic = TexturePackFile::MAGIC;
+  header.version = TexturePackFile::VERSION;
+  header.num_textures = static_cast<u32>(m_textures.size());
+  header.num_levels = static_cast<u32>(m_levels.size());
+  header.textures_offset = Common::AlignUp(m_data_end, alignof(u64));
+  header.levels_offset = header.textures_offset + m_textures.size() * sizeof(m_textures[0]);
+  header.names_offset = header.levels_offset + m_levels.size() * sizeof(m_levels[0]);
+  header.names_size = m_names.size();
+
+  static constexpr u8 padding[alignof(u64)] = {};
+  const bool success = m_file.WriteBytes(padding, header.textures_offset - m_data_end) &&
+                       m_file.WriteArray(m_textures.data(), m_textures.size()) &&
+                       m_file.WriteArray(m_levels.data(), m_levels.size()) &&
+                       m_file.WriteBytes(m_names.data(), m_names.size()) &&
+                       m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteArray(&header, 1);
+  return m_file.Close() && success;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+namespace VideoCommon
+{
+// A texture pack file holds a hi-res texture pack, with every texture stored ready to be
+// uploaded: compressed DDS data is kept as is, and PNGs are decoded to RGBA8. The file is
+// memory-mapped when loaded, so textures are only read from disk on first use.
+//
+// The file consists of the header, the texture data, and then the index: the texture entries
+// sorted by name hash, the level entries they refer to, and the names. All values are little
+// endian.
+namespace TexturePackFile
+{
+constexpr u32 MAGIC = 0x4B505444;  // "DTPK"
+constexpr u32 VERSION = 1;
+constexpr std::string_view EXTENSION = ".dtp";
+
+// Alignment of each level's data in the file.
+constexpr u64 DATA_ALIGNMENT = 64;
+
+enum TextureFlags : u32
+{
+  TEXTURE_FLAG_ARBITRARY_MIPMAPS = 1 << 0,
+};
+
+#pragma pack(push, 1)
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 num_textures;
+  u32 num_levels;
+  u64 textures_offset;
+  u64 levels_offset;
+  u64 names_offset;
+  u64 names_size;
+};
+static_assert(sizeof(Header) == 48);
+
+struct TextureEntry
+{
+  u64 name_hash;
+  u32 name_offset;
+  u32 name_size;
+  u32 flags;
+  u32 first_level;
+  // Each slice has the same number of levels, stored one slice after the other.
+  u16 num_slices;
+  u16 num_levels;
+  u32 padding;
+};
+static_assert(sizeof(TextureEntry) == 32);
+
+struct LevelEntry
+{
+  u64 data_offset;
+  u64 data_size;
+  // AbstractTextureFormat
+  u32 format;
+  u32 width;
+  u32 height;
+  u32 row_length;
+};
+static_assert(sizeof(LevelEntry) == 32);
+#pragma pack(pop)
+
+u64 HashName(std::string_view name);
+}  // namespace TexturePackFile
+
+// Writes a texture pack file. The texture data is written out as textures are added, and only
+// the index is kept in memory.
+class TexturePackWriter
+{
+public:
+  bool Open(const std::string& path);
+  bool AddTexture(std::string_view name, bool has_arbitrary_mipmaps, const CustomTextureData& data);
+  // Writes the index and closes the file.
+  bool Finish();
+
+  u64 GetDataSize() const { return m_data_end - sizeof(TexturePackFile::Header); }
+
+private:
+  File::IOFile m_file;
+  u64 m_data_end = 0;
+  std::vector<TexturePackFile::TextureEntry> m_textures;
+  std::vector<TexturePackFile::LevelEntry> m_levels;
+  std::string m_names;
+};
+}  // namespace VideoCommon
@@ -55,6 +55,8 @@ public:
         u32 fbWidth;
         u32 fbStride;
         u32 fbHeight;
+        // Clock::now() on the CPU thread when the frame was output, for latency measurements.
+        DT::rep output_time;
       } swap_event;
 
       struct
@@ -199,6 +199,17 @@ void SetScissorAndViewport()
     raw_height = std::round(raw_height);
   }
 
+  // Nothing outside of both the scissor rectangle and the viewport can be drawn to, which lets the
+  // EFB peek cache keep the tiles outside of it.
+  MathUtil::Rectangle<int> draw_bounds(
+      static_cast<int>(std::floor(std::min(raw_x, raw_x + raw_width))),
+      static_cast<int>(std::floor(std::min(raw_y, raw_y + raw_height))),
+      static_cast<int>(std::ceil(std::max(raw_x, raw_x + raw_width))),
+      static_cast<int>(std::ceil(std::max(raw_y, raw_y + raw_height))));
+  draw_bounds.ClampUL(native_rc.rect.left, native_rc.rect.top, native_rc.rect.right,
+                      native_rc.rect.bottom);
+  g_framebuffer_manager->SetDrawBounds(draw_bounds);
+
   float x = g_framebuffer_manager->EFBToScaledXf(raw_x);
   float y = g_framebuffer_manager->EFBToScaledYf(raw_y);
   float width = g_framebuffer_manager->EFBToScaledXf(raw_width);
@@ -37,6 +37,7 @@
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -183,7 +184,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     case 0x02:
     {
       INCSTAT(g_stats.this_frame.num_draw_done);
-      g_texture_cache->FlushEFBCopies();
+      g_texture_cache->FlushEFBCopiesForSync();
       g_texture_cache->FlushStaleBinds();
       g_framebuffer_manager->InvalidatePeekCache(false);
       g_framebuffer_manager->RefreshPeekCache();
@@ -202,7 +203,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
   case BPMEM_PE_TOKEN_ID:  // Pixel Engine Token ID
   {
     INCSTAT(g_stats.this_frame.num_token);
-    g_texture_cache->FlushEFBCopies();
+    g_texture_cache->FlushEFBCopiesForSync();
     g_texture_cache->FlushStaleBinds();
     g_framebuffer_manager->InvalidatePeekCache(false);
     g_framebuffer_manager->RefreshPeekCache();
@@ -218,7 +219,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
   case BPMEM_PE_TOKEN_INT_ID:  // Pixel Engine Interrupt Token ID
   {
     INCSTAT(g_stats.this_frame.num_token_int);
-    g_texture_cache->FlushEFBCopies();
+    g_texture_cache->FlushEFBCopiesForSync();
     g_texture_cache->FlushStaleBinds();
     g_framebuffer_manager->InvalidatePeekCache(false);
     g_framebuffer_manager->RefreshPeekCache();
@@ -298,17 +299,24 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     const u32 copy_width = srcRect.GetWidth();
     const u32 copy_height = srcRect.GetHeight();
 
+    // The copy and clear are dropped in frames which aren't rendered, so that the destination
+    // keeps the contents of the last rendered frame instead of an EFB that nothing was drawn to.
+    const bool skip_rendering = g_vertex_manager->IsSkippingRendering();
+
     // Check if we are to copy from the EFB or draw to the XFB
     if (PE_copy.copy_to_xfb == 0)
     {
       // bpmem.zcontrol.pixel_format to PixelFormat::Z24 is when the game wants to copy from ZBuffer
       // (Zbuffer uses 24-bit Format)
       bool is_depth_copy = bpmem.zcontrol.pixel_format == PixelFormat::Z24;
-      g_texture_cache->CopyRenderTargetToTexture(
-          destAddr, PE_copy.tp_realFormat(), copy_width, copy_height, destStride, is_depth_copy,
-          srcRect, PE_copy.intensity_fmt && PE_copy.auto_conv, PE_copy.half_scale, 1.0f,
-          s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
-          bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      if (!skip_rendering)
+      {
+        g_texture_cache->CopyRenderTargetToTexture(
+            destAddr, PE_copy.tp_realFormat(), copy_width, copy_height, destStride, is_depth_copy,
+            srcRect, PE_copy.intensity_fmt && PE_copy.auto_conv, PE_copy.half_scale, 1.0f,
+            s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
+            bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      }
     }
     else
     {
@@ -334,10 +342,13 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
                     bpmem.copyTexSrcWH.x + 1, destStride, height, yScale);
 
       bool is_depth_copy = bpmem.zcontrol.pixel_format == PixelFormat::Z24;
-      g_texture_cache->CopyRenderTargetToTexture(
-          destAddr, EFBCopyFormat::XFB, copy_width, height, destStride, is_depth_copy, srcRect,
-          false, false, yScale, s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
-          bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      if (!skip_rendering)
+      {
+        g_texture_cache->CopyRenderTargetToTexture(
+            destAddr, EFBCopyFormat::XFB, copy_width, height, destStride, is_depth_copy, srcRect,
+            false, false, yScale, s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
+            bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      }
 
       // This is as closest as we have to an "end of the frame"
       // It works 99% of the time.
@@ -372,7 +383,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     }
 
     // Clear the rectangular region after copying it.
-    if (PE_copy.clear)
+    if (PE_copy.clear && !skip_rendering)
     {
       ClearScreen(srcRect);
     }
@@ -400,6 +411,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
         (1 << bpmem.tmem_config.tlut_dest.tmem_line_count.NumBits()) * TMEM_LINE_SIZE;
     static_assert(MAX_LOADABLE_TMEM_ADDR + MAX_TMEM_LINE_COUNT < TMEM_SIZE);
 
+    g_texture_cache->FlushEFBCopiesInRange(addr, tmem_transfer_count);
     auto& memory = system.GetMemory();
     memory.CopyFromEmu(s_tex_mem.data() + tmem_addr, addr, tmem_transfer_count);
 
@@ -507,8 +519,13 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     const u8 offset = bp.address & 2;
     g_bounding_box->Enable(pixel_shader_manager);
 
-    g_bounding_box->Set(offset, bp.newvalue & 0x3ff);
-    g_bounding_box->Set(offset + 1, bp.newvalue >> 10);
+    // Nothing is drawn in frames which aren't rendered, so keep the last rendered frame's values
+    // for the game to read back instead of the reset ones.
+    if (!g_vertex_manager->IsSkippingRendering())
+    {
+      g_bounding_box->Set(offset, bp.newvalue & 0x3ff);
+      g_bounding_box->Set(offset + 1, bp.newvalue >> 10);
+    }
   }
     return;
   case BPMEM_TEXINVALIDATE:
@@ -566,7 +583,8 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
   case BPMEM_CLEAR_PIXEL_PERF:
     // GXClearPixMetric writes 0xAAA here, Sunshine alternates this register between values 0x000
     // and 0xAAA
-    if (PerfQueryBase::ShouldEmulate())
+    // Like the bounding box, the counters keep the last rendered frame's values in skipped frames.
+    if (PerfQueryBase::ShouldEmulate() && !g_vertex_manager->IsSkippingRendering())
       g_perf_query->ResetQuery();
     return;
 
@@ -588,6 +606,11 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
       u32 bytes_read = 0;
       u32 tmem_addr_even = tmem_cfg.preload_tmem_even * TMEM_LINE_SIZE;
 
+      // RGBA8 tiles read two lines per count.
+      const u32 lines_per_count = tmem_cfg.preload_tile_info.type != 3 ? 1 : 2;
+      g_texture_cache->FlushEFBCopiesInRange(
+          src_addr, tmem_cfg.preload_tile_info.count * lines_per_count * TMEM_LINE_SIZE);
+
       if (tmem_cfg.preload_tile_info.type != 3)
       {
         if (tmem_addr_even < TMEM_SIZE)
@@ -608,23 +631,27 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
 
         // AR and GB tiles are stored in separate TMEM banks => can't use a single memcpy for
         // everything
-        u32 tmem_addr_odd = tmem_cfg.preload_tmem_odd * TMEM_LINE_SIZE;
-
-        for (u32 i = 0; i < tmem_cfg.preload_tile_info.count; ++i)
+        const u32 tmem_addr_odd = tmem_cfg.preload_tmem_odd * TMEM_LINE_SIZE;
+        u32 line_count = tmem_cfg.preload_tile_info.count;
+        if (tmem_addr_even >= TMEM_SIZE || tmem_addr_odd >= TMEM_SIZE)
+          line_count = 0;
+        line_count = std::min(line_count, (TMEM_SIZE - tmem_addr_even) / TMEM_LINE_SIZE);
+        line_count = std::min(line_count, (TMEM_SIZE - tmem_addr_odd) / TMEM_LINE_SIZE);
+
+        // Translate the source range once and deinterleave straight from it, rather than going
+        // through CopyFromEmu for every line.
+        const u32 size = line_count * TMEM_LINE_SIZE * 2;
+        const u8* src = size != 0 ? memory.GetPointerForRange(src_addr, size) : nullptr;
+        if (src)
         {
-          if (tmem_addr_even + TMEM_LINE_SIZE > TMEM_SIZE ||
-              tmem_addr_odd + TMEM_LINE_SIZE > TMEM_SIZE)
+          for (u32 i = 0; i < line_count; ++i)
           {
-            break;
+            std::memcpy(s_tex_mem.data() + tmem_addr_even + i * TMEM_LINE_SIZE,
+                        src + i * TMEM_LINE_SIZE * 2, TMEM_LINE_SIZE);
+            std::memcpy(s_tex_mem.data() + tmem_addr_odd + i * TMEM_LINE_SIZE,
+                        src + i * TMEM_LINE_SIZE * 2 + TMEM_LINE_SIZE, TMEM_LINE_SIZE);
           }
-
-          memory.CopyFromEmu(s_tex_mem.data() + tmem_addr_even, src_addr + bytes_read,
-                             TMEM_LINE_SIZE);
-          memory.CopyFromEmu(s_tex_mem.data() + tmem_addr_odd,
-                             src_addr + bytes_read + TMEM_LINE_SIZE, TMEM_LINE_SIZE);
-          tmem_addr_even += TMEM_LINE_SIZE;
-          tmem_addr_odd += TMEM_LINE_SIZE;
-          bytes_read += TMEM_LINE_SIZE * 2;
+          bytes_read = size;
         }
       }
 
@@ -4,15 +4,16 @@
 #include "VideoCommon/BoundingBox.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
-#include <algorithm>
-
 std::unique_ptr<BoundingBox> g_bounding_box;
 
 void BoundingBox::Enable(PixelShaderManager& pixel_shader_manager)
@@ -60,7 +61,12 @@ void BoundingBox::Readback()
   if (!g_ActiveConfig.backend_info.bSupportsBBox)
     return;
 
+  const auto read_start = std::chrono::steady_clock::now();
   auto read_values = Read(0, NUM_BBOX_VALUES);
+  const auto read_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - read_start);
+  INCSTAT(g_stats.this_frame.num_bbox_stalls);
+  ADDSTAT(g_stats.this_frame.bbox_stall_us, static_cast<int>(read_time.count()));
 
   // Preserve dirty values, that way we don't need to sync.
   for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
@@ -70,6 +76,44 @@ void BoundingBox::Readback()
   }
 
   m_is_valid = true;
+
+  // These are the freshest values we can get, so any readback still in flight is obsolete.
+  m_speculative_values = m_values;
+  m_speculative_values_frame = g_presenter->FrameCount();
+  m_has_speculative_values = true;
+  m_queued_read_pending = false;
+}
+
+bool BoundingBox::SpeculativeReadback()
+{
+  if (g_ActiveConfig.iBBoxAsyncReadbackFrames <= 0)
+    return false;
+
+  const int max_age = g_ActiveConfig.iBBoxAsyncReadbackFrames;
+  const int frame = g_presenter->FrameCount();
+  if (m_queued_read_pending && TryGetQueuedRead(m_speculative_values))
+  {
+    m_speculative_values_frame = m_queued_read_frame;
+    m_has_speculative_values = true;
+    m_queued_read_pending = false;
+  }
+
+  // Keep a readback in flight, so that there are newer values by the next time the game asks.
+  if (!m_queued_read_pending)
+  {
+    if (!QueueRead())
+      return false;
+
+    m_queued_read_pending = true;
+    m_queued_read_frame = frame;
+  }
+
+  // Once the values get too old, wait for the GPU instead.
+  if (!m_has_speculative_values || frame - m_speculative_values_frame > max_age)
+    return false;
+
+  INCSTAT(g_stats.this_frame.num_bbox_speculative_reads);
+  return true;
 }
 
 u16 BoundingBox::Get(u32 index)
@@ -80,7 +124,12 @@ u16 BoundingBox::Get(u32 index)
     return m_bounding_box_fallback[index];
 
   if (!m_is_valid)
+  {
+    if (SpeculativeReadback())
+      return static_cast<u16>(m_speculative_values[index]);
+
     Readback();
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -113,6 +162,13 @@ void BoundingBox::DoState(PointerWrap& p)
   p.DoArray(m_dirty);
   p.Do(m_is_valid);
 
+  // Any readback in flight refers to the state before loading.
+  if (p.IsReadMode())
+  {
+    m_has_speculative_values = false;
+    m_queued_read_pending = false;
+  }
+
   // We handle saving the backend values specially rather than using Readback() and Flush() so that
   // we don't mess up the current cache state
   std::vector<BBoxType> backend_values(NUM_BBOX_VALUES);
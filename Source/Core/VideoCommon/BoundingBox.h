@@ -41,8 +41,15 @@ protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Optional asynchronous readback, used when BBoxAsyncReadbackFrames is set. QueueRead() starts
+  // copying all of the values back without waiting for the GPU, and returns false if the backend
+  // can't do that. TryGetQueuedRead() fills in the values once the queued copy has completed.
+  virtual bool QueueRead() { return false; }
+  virtual bool TryGetQueuedRead(std::span<BBoxType, NUM_BBOX_VALUES> values) { return false; }
+
 private:
   void Readback();
+  bool SpeculativeReadback();
 
   bool m_is_active = false;
 
@@ -50,6 +57,14 @@ private:
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
 
+  // The results of the last completed readback, and the frame it was started in, which are
+  // returned while a newer readback is in flight.
+  std::array<BBoxType, NUM_BBOX_VALUES> m_speculative_values = {};
+  int m_speculative_values_frame = 0;
+  bool m_has_speculative_values = false;
+  bool m_queued_read_pending = false;
+  int m_queued_read_frame = 0;
+
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
   // are the only values encountered so far, which happen to be the extents allowed by the BP
   // registers) to reset the registers for comparison in the pixel engine, and presumably to detect
@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,9 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) && !defined(__AVX512F__)
+#define ATTR_TARGET __attribute__((target("avx512f,avx,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -236,6 +240,53 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 BroadcastYMMToZMM(__m256 v)
+{
+  return _mm512_broadcast_f32x4(_mm256_castps256_ps128(v));
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128 LoadPosition(const u8* data)
+{
+  if constexpr (PositionHas3Elems)
+    return _mm_loadu_ps(reinterpret_cast<const float*>(data));
+  else
+    return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data)));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 ApplyMatrixZMM(__m512 v, __m512 m0, __m512 m1,
+                                                              __m512 m2, __m512 m3)
+{
+  __m512 output = _mm512_mul_ps(_mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)), m0);
+  output = _mm512_fmadd_ps(_mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), m1, output);
+  output = _mm512_fmadd_ps(_mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), m2, output);
+  output = _mm512_fmadd_ps(_mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), m3, output);
+  return output;
+}
+
+// Only used without per-vertex position matrices, where all four vertices share one matrix.
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+LoadTransform4Vertices(const u8* data, u32 stride,                          //
+                       __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                       __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 v0123 = _mm512_castps128_ps512(LoadPosition<PositionHas3Elems>(data));
+  v0123 = _mm512_insertf32x4(v0123, LoadPosition<PositionHas3Elems>(data + stride), 1);
+  v0123 = _mm512_insertf32x4(v0123, LoadPosition<PositionHas3Elems>(data + stride * 2), 2);
+  v0123 = _mm512_insertf32x4(v0123, LoadPosition<PositionHas3Elems>(data + stride * 3), 3);
+
+  // Same operations as TransformVertexYMM, so the results match the FMA version exactly.
+  __m512 output = pos3;  // vertex.w is always 1.0
+  output = _mm512_fmadd_ps(_mm512_permute_ps(v0123, _MM_SHUFFLE(0, 0, 0, 0)), pos0, output);
+  output = _mm512_fmadd_ps(_mm512_permute_ps(v0123, _MM_SHUFFLE(1, 1, 1, 1)), pos1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm512_fmadd_ps(_mm512_permute_ps(v0123, _MM_SHUFFLE(2, 2, 2, 2)), pos2, output);
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -517,7 +568,29 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
   LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
-  for (int i = 1; i < count; i += 2)
+  int i = 0;
+#ifdef USE_AVX512
+  if constexpr (!PerVertexPosMtx)
+  {
+    const __m512 zproj0 = BroadcastYMMToZMM(proj0);
+    const __m512 zproj1 = BroadcastYMMToZMM(proj1);
+    const __m512 zproj2 = BroadcastYMMToZMM(proj2);
+    const __m512 zproj3 = BroadcastYMMToZMM(proj3);
+    const __m512 zpos0 = BroadcastYMMToZMM(pos0);
+    const __m512 zpos1 = BroadcastYMMToZMM(pos1);
+    const __m512 zpos2 = BroadcastYMMToZMM(pos2);
+    const __m512 zpos3 = BroadcastYMMToZMM(pos3);
+    for (; i + 4 <= count; i += 4)
+    {
+      __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems>(
+          cvertices, stride, zpos0, zpos1, zpos2, zpos3, zproj0, zproj1, zproj2, zproj3);
+      _mm512_storeu_ps(reinterpret_cast<float*>(voutput), v0123);
+      cvertices += stride * 4;
+      voutput += 4;
+    }
+  }
+#endif
+  for (; i + 2 <= count; i += 2)
   {
     const u8* v0data = cvertices;
     const u8* v1data = cvertices + stride;
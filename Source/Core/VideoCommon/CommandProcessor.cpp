@@ -357,7 +357,7 @@ void CommandProcessorManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   mmio->Register(base | FIFO_READ_POINTER_HI, fifo_read_hi_r, fifo_read_hi_w);
 }
 
-void CommandProcessorManager::GatherPipeBursted()
+void CommandProcessorManager::GatherPipeBursted(u32 burst_count)
 {
   SetCPStatusFromCPU();
 
@@ -382,15 +382,17 @@ void CommandProcessorManager::GatherPipeBursted()
   }
 
   // update the fifo pointer
-  if (m_fifo.CPWritePointer.load(std::memory_order_relaxed) ==
-      m_fifo.CPEnd.load(std::memory_order_relaxed))
+  const u32 cp_base = m_fifo.CPBase.load(std::memory_order_relaxed);
+  const u32 cp_end = m_fifo.CPEnd.load(std::memory_order_relaxed);
+  u32 cp_write_pointer = m_fifo.CPWritePointer.load(std::memory_order_relaxed);
+  for (u32 i = 0; i < burst_count; ++i)
   {
-    m_fifo.CPWritePointer.store(m_fifo.CPBase, std::memory_order_relaxed);
-  }
-  else
-  {
-    m_fifo.CPWritePointer.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
+    if (cp_write_pointer == cp_end)
+      cp_write_pointer = cp_base;
+    else
+      cp_write_pointer += GPFifo::GATHER_PIPE_SIZE;
   }
+  m_fifo.CPWritePointer.store(cp_write_pointer, std::memory_order_relaxed);
 
   if (m_cp_ctrl_reg.GPReadEnable && m_cp_ctrl_reg.GPLinkEnable)
   {
@@ -404,7 +406,8 @@ void CommandProcessorManager::GatherPipeBursted()
   if (m_fifo.bFF_HiWatermark.load(std::memory_order_relaxed) != 0)
     m_system.GetCoreTiming().ForceExceptionCheck(0);
 
-  m_fifo.CPReadWriteDistance.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
+  m_fifo.CPReadWriteDistance.fetch_add(burst_count * GPFifo::GATHER_PIPE_SIZE,
+                                       std::memory_order_seq_cst);
 
   m_system.GetFifo().RunGpu();
 
@@ -174,7 +174,10 @@ public:
 
   void SetCPStatusFromGPU();
   void SetCPStatusFromCPU();
-  void GatherPipeBursted();
+  // Called after the CPU has written burst_count bursts of GPFifo::GATHER_PIPE_SIZE bytes to the
+  // FIFO. Handling them all at once means a single update of the read/write distance, which is
+  // what makes the data visible to the GPU thread.
+  void GatherPipeBursted(u32 burst_count = 1);
   void UpdateInterrupts(u64 userdata);
   void UpdateInterruptsFromVideoBackend(u64 userdata);
 
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <cstring>
+#include <type_traits>
 
 #include "Common/CommonTypes.h"
 
@@ -119,3 +121,31 @@ struct alignas(16) GeometryShaderConstants
   VSExpand vs_expand;  // Used by VS point/line expansion in ubershaders
   u32 pad[3];
 };
+
+// Remembers the contents of the last upload of a constant block. Most constant setters flag their
+// block as dirty whenever the emulated state is written, even if the value doesn't change, so this
+// lets redundant uploads of whole blocks be skipped.
+template <typename T>
+class UploadedConstants
+{
+  static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+  // Returns false if constants matches what was last uploaded. Otherwise, remembers it as uploaded.
+  bool Update(const T& constants)
+  {
+    if (m_valid && std::memcmp(&m_constants, &constants, sizeof(T)) == 0)
+      return false;
+
+    std::memcpy(&m_constants, &constants, sizeof(T));
+    m_valid = true;
+    return true;
+  }
+
+  // Called when the uploaded block may no longer be bound.
+  void Invalidate() { m_valid = false; }
+
+private:
+  T m_constants{};
+  bool m_valid = false;
+};
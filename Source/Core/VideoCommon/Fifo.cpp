@@ -3,6 +3,7 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
@@ -48,6 +49,7 @@ void FifoManager::RefreshConfig()
   m_config_sync_gpu_max_distance = Config::Get(Config::MAIN_SYNC_GPU_MAX_DISTANCE);
   m_config_sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
   m_config_sync_gpu_overclock = Config::Get(Config::MAIN_SYNC_GPU_OVERCLOCK);
+  m_config_sync_gpu_on_demand = Config::Get(Config::MAIN_SYNC_GPU_ON_DEMAND);
 }
 
 void FifoManager::DoState(PointerWrap& p)
@@ -105,6 +107,16 @@ void FifoManager::Shutdown()
   if (m_gpu_mainloop.IsRunning())
     PanicAlertFmt("FIFO shutting down while active");
 
+  static constexpr std::array<const char*, NUM_SYNC_GPU_REASONS> reason_names = {
+      "other", "wraparound", "EFB poke", "perf query",       "bbox",
+      "swap",  "aux space",  "EFB peek", "CP register read", "PE token"};
+  for (size_t i = 0; i < NUM_SYNC_GPU_REASONS; ++i)
+  {
+    if (m_sync_counts[i] != 0)
+      NOTICE_LOG_FMT(VIDEO, "Waited for the GPU {} times ({})", m_sync_counts[i], reason_names[i]);
+  }
+  m_sync_counts = {};
+
   Common::FreeMemoryPages(m_video_buffer, FIFO_SIZE + 4);
   m_video_buffer = nullptr;
   m_video_buffer_write_ptr = nullptr;
@@ -150,6 +162,7 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
+    ++m_sync_counts[static_cast<size_t>(reason)];
     m_gpu_mainloop.Wait();
     if (!m_gpu_mainloop.IsRunning())
       return;
@@ -236,11 +249,12 @@ void FifoManager::ReadDataFromFifo(u32 read_ptr)
   m_video_buffer_write_ptr += GPFifo::GATHER_PIPE_SIZE;
 }
 
-// The deterministic_gpu_thread version.
-void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
+// The deterministic_gpu_thread version. Copies and preprocesses size bytes, which must not wrap
+// around the end of the emulated FIFO, and publishes them to the GPU thread all at once.
+void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr, u32 size)
 {
   u8* write_ptr = m_video_buffer_write_ptr;
-  if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(m_video_buffer + FIFO_SIZE - write_ptr))
+  if (size > static_cast<size_t>(m_video_buffer + FIFO_SIZE - write_ptr))
   {
     // We can't wrap around while the GPU is working on the data.
     // This should be very rare due to the reset in SyncGPU.
@@ -258,19 +272,19 @@ void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
     }
     write_ptr = m_video_buffer_write_ptr;
     const size_t existing_len = write_ptr - m_video_buffer_pp_read_ptr;
-    if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(FIFO_SIZE - existing_len))
+    if (size > static_cast<size_t>(FIFO_SIZE - existing_len))
     {
-      PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len,
-                    GPFifo::GATHER_PIPE_SIZE, FIFO_SIZE);
+      PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len, size,
+                    FIFO_SIZE);
       return;
     }
   }
   auto& memory = m_system.GetMemory();
-  memory.CopyFromEmu(m_video_buffer_write_ptr, read_ptr, GPFifo::GATHER_PIPE_SIZE);
+  memory.CopyFromEmu(m_video_buffer_write_ptr, read_ptr, size);
   m_video_buffer_pp_read_ptr = OpcodeDecoder::RunFifo<true>(
-      DataReader(m_video_buffer_pp_read_ptr, write_ptr + GPFifo::GATHER_PIPE_SIZE), nullptr);
+      DataReader(m_video_buffer_pp_read_ptr, write_ptr + size), nullptr);
   // This would have to be locked if the GPU thread didn't spin.
-  m_video_buffer_write_ptr = write_ptr + GPFifo::GATHER_PIPE_SIZE;
+  m_video_buffer_write_ptr = write_ptr + size;
 }
 
 void FifoManager::ResetVideoBuffer()
@@ -450,9 +464,31 @@ int FifoManager::RunGpuOnCpu(int ticks)
          fifo.CPReadWriteDistance.load(std::memory_order_relaxed) && !AtBreakpoint(m_system) &&
          available_ticks >= 0)
   {
+    const u32 read_pointer = fifo.CPReadPointer.load(std::memory_order_relaxed);
+    const u32 fifo_end = fifo.CPEnd.load(std::memory_order_relaxed);
+    u32 bytes_read = GPFifo::GATHER_PIPE_SIZE;
+
     if (m_use_deterministic_gpu_thread)
     {
-      ReadDataFromFifoOnCPU(fifo.CPReadPointer.load(std::memory_order_relaxed));
+      // The GPU thread doesn't consume ticks here, so hand it everything that is available,
+      // in as few batches as possible: one, unless the FIFO wraps around or the batch limit
+      // is hit. Each batch is preprocessed in one go and costs a single wakeup.
+      if (read_pointer <= fifo_end)
+      {
+        u32 batch_size = std::min({fifo.CPReadWriteDistance.load(std::memory_order_relaxed),
+                                   fifo_end - read_pointer + GPFifo::GATHER_PIPE_SIZE,
+                                   MAX_DETERMINISTIC_BATCH_SIZE});
+
+        // Stop at the FIFO breakpoint, like the burst by burst loop does.
+        const u32 breakpoint = fifo.CPBreakpoint.load(std::memory_order_relaxed);
+        if (fifo.bFF_BPEnable.load(std::memory_order_relaxed) && breakpoint > read_pointer)
+          batch_size = std::min(batch_size, breakpoint - read_pointer);
+
+        bytes_read = std::max(batch_size - batch_size % GPFifo::GATHER_PIPE_SIZE,
+                              GPFifo::GATHER_PIPE_SIZE);
+      }
+
+      ReadDataFromFifoOnCPU(read_pointer, bytes_read);
       m_gpu_mainloop.Wakeup();
     }
     else
@@ -463,25 +499,25 @@ int FifoManager::RunGpuOnCpu(int ticks)
         Common::FPU::LoadDefaultSIMDState();
         reset_simd_state = true;
       }
-      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed));
+      ReadDataFromFifo(read_pointer);
       u32 cycles = 0;
       m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
           DataReader(m_video_buffer_read_ptr, m_video_buffer_write_ptr), &cycles);
       available_ticks -= cycles;
     }
 
-    if (fifo.CPReadPointer.load(std::memory_order_relaxed) ==
-        fifo.CPEnd.load(std::memory_order_relaxed))
+    const u32 last_burst = read_pointer + bytes_read - GPFifo::GATHER_PIPE_SIZE;
+    if (last_burst == fifo_end)
     {
       fifo.CPReadPointer.store(fifo.CPBase.load(std::memory_order_relaxed),
                                std::memory_order_relaxed);
     }
     else
     {
-      fifo.CPReadPointer.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
+      fifo.CPReadPointer.store(last_burst + GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
     }
 
-    fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
+    fifo.CPReadWriteDistance.fetch_sub(bytes_read, std::memory_order_relaxed);
   }
 
   command_processor.SetCPStatusFromGPU();
@@ -559,7 +595,14 @@ int FifoManager::WaitForGpuThread(int ticks)
 
   // Wait for GPU
   if (now >= m_config_sync_gpu_max_distance)
-    m_sync_wakeup_event.Wait();
+  {
+    // In sync on demand mode, the CPU only waits when it reads GPU state. Keep the distance from
+    // growing without bound while the CPU runs ahead.
+    if (m_config_sync_gpu_on_demand)
+      m_sync_ticks.fetch_sub(now - m_config_sync_gpu_max_distance);
+    else
+      m_sync_wakeup_event.Wait();
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -590,10 +633,27 @@ void FifoManager::SyncGPUForRegisterAccess()
 
   if (!m_system.IsDualCoreMode() || m_use_deterministic_gpu_thread)
     RunGpuOnCpu(GPU_TIME_SLOT_SIZE);
+  else if (IsSyncingGPUOnDemand())
+    SyncGPUForGPUStateRead(SyncGPUReason::CPRegisterRead);
   else if (m_config_sync_gpu)
     WaitForGpuThread(GPU_TIME_SLOT_SIZE);
 }
 
+bool FifoManager::IsSyncingGPUOnDemand() const
+{
+  return m_config_sync_gpu && m_config_sync_gpu_on_demand && m_system.IsDualCoreMode() &&
+         !m_use_deterministic_gpu_thread;
+}
+
+void FifoManager::SyncGPUForGPUStateRead(SyncGPUReason reason)
+{
+  if (!IsSyncingGPUOnDemand())
+    return;
+
+  ++m_sync_counts[static_cast<size_t>(reason)];
+  m_gpu_mainloop.Wait();
+}
+
 // Initialize GPU - CPU thread syncing, this gives us a deterministic way to start the GPU thread.
 void FifoManager::Prepare()
 {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <optional>
@@ -36,7 +37,11 @@ enum class SyncGPUReason
   BBox,
   Swap,
   AuxSpace,
+  EFBPeek,
+  CPRegisterRead,
+  PEToken,
 };
+constexpr size_t NUM_SYNC_GPU_REASONS = static_cast<size_t>(SyncGPUReason::PEToken) + 1;
 
 class FifoManager final
 {
@@ -64,6 +69,14 @@ public:
   // In dual core mode, this synchronizes with the GPU thread.
   void SyncGPUForRegisterAccess();
 
+  // In sync on demand mode, this waits for the GPU thread to process all pending work. Call it
+  // before the CPU reads state that the GPU produces.
+  void SyncGPUForGPUStateRead(SyncGPUReason reason);
+  bool IsSyncingGPUOnDemand() const;
+
+  // Returns how many times the CPU had to wait for the GPU, per SyncGPUReason.
+  const std::array<u64, NUM_SYNC_GPU_REASONS>& GetSyncCounts() const { return m_sync_counts; }
+
   void PushFifoAuxBuffer(const void* ptr, size_t size);
   void* PopFifoAuxBuffer(size_t size);
 
@@ -78,12 +91,15 @@ public:
 private:
   void RefreshConfig();
   void ReadDataFromFifo(u32 read_ptr);
-  void ReadDataFromFifoOnCPU(u32 read_ptr);
+  void ReadDataFromFifoOnCPU(u32 read_ptr, u32 size);
   int RunGpuOnCpu(int ticks);
   int WaitForGpuThread(int ticks);
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
+  // Upper bound for the data preprocessed and handed to the GPU thread at once in deterministic
+  // GPU thread mode, so that a large batch doesn't delay the GPU thread for too long.
+  static constexpr u32 MAX_DETERMINISTIC_BATCH_SIZE = 64 * 1024;
 
   Common::BlockingLoop m_gpu_mainloop;
 
@@ -127,6 +143,9 @@ private:
   int m_config_sync_gpu_max_distance = 0;
   int m_config_sync_gpu_min_distance = 0;
   float m_config_sync_gpu_overclock = 0.0f;
+  bool m_config_sync_gpu_on_demand = false;
+
+  std::array<u64, NUM_SYNC_GPU_REASONS> m_sync_counts{};
 
   Core::System& m_system;
 };
@@ -18,6 +18,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/error.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -51,6 +52,10 @@ struct FrameDumpContext
   AVFrame* scaled_frame = nullptr;
   SwsContext* sws = nullptr;
 
+  // Only used by encoders which take their input in GPU memory.
+  AVBufferRef* hw_frames = nullptr;
+  AVFrame* hw_frame = nullptr;
+
   s64 last_pts = AV_NOPTS_VALUE;
 
   int width = 0;
@@ -158,6 +163,64 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// Hardware encoders like h264_vaapi only list hardware pixel formats, and need their frames to be
+// uploaded to the device first. Others like NVENC, AMF and VideoToolbox take frames in system
+// memory directly.
+bool EncoderRequiresHardwareFrames(const AVCodec* codec)
+{
+  if (!codec->pix_fmts || codec->pix_fmts[0] == AV_PIX_FMT_NONE)
+    return false;
+
+  const AVPixFmtDescriptor* const desc = av_pix_fmt_desc_get(codec->pix_fmts[0]);
+  return desc && (desc->flags & AV_PIX_FMT_FLAG_HWACCEL);
+}
+
+// Creates a pool of device frames for the encoder, which frames in sw_pix_fmt are uploaded to.
+AVBufferRef* CreateHardwareFramesContext(const AVCodec* codec, AVPixelFormat sw_pix_fmt, int width,
+                                         int height)
+{
+  for (int i = 0;; i++)
+  {
+    const AVCodecHWConfig* const config = avcodec_get_hw_config(codec, i);
+    if (!config)
+      return nullptr;
+    if (!(config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX))
+      continue;
+
+    AVBufferRef* device = nullptr;
+    if (const int error = av_hwdevice_ctx_create(&device, config->device_type, nullptr, nullptr, 0))
+    {
+      WARN_LOG_FMT(FRAMEDUMP, "Could not create {} device: {}",
+                   av_hwdevice_get_type_name(config->device_type), AVErrorString(error));
+      continue;
+    }
+
+    // The frames context keeps its own reference to the device.
+    AVBufferRef* frames = av_hwframe_ctx_alloc(device);
+    av_buffer_unref(&device);
+    if (!frames)
+      continue;
+
+    auto* const frames_context = reinterpret_cast<AVHWFramesContext*>(frames->data);
+    frames_context->format = config->pix_fmt;
+    frames_context->sw_format = sw_pix_fmt;
+    frames_context->width = width;
+    frames_context->height = height;
+    frames_context->initial_pool_size = 4;
+    if (const int error = av_hwframe_ctx_init(frames))
+    {
+      WARN_LOG_FMT(FRAMEDUMP, "Could not create {} frames: {}",
+                   av_hwdevice_get_type_name(config->device_type), AVErrorString(error));
+      av_buffer_unref(&frames);
+      continue;
+    }
+
+    INFO_LOG_FMT(FRAMEDUMP, "Uploading frames to {} device for encoding",
+                 av_hwdevice_get_type_name(config->device_type));
+    return frames;
+  }
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -285,6 +348,27 @@ bool FFMpegFrameDump::CreateVideoFile()
       pix_fmt = AV_PIX_FMT_YUV420P;
   }
 
+  // Frames are converted to this format on the CPU.
+  AVPixelFormat sw_pix_fmt = pix_fmt;
+
+  if (EncoderRequiresHardwareFrames(codec))
+  {
+    if (pixel_format_string.empty())
+      sw_pix_fmt = AV_PIX_FMT_NV12;
+
+    m_context->hw_frames =
+        CreateHardwareFramesContext(codec, sw_pix_fmt, m_context->width, m_context->height);
+    if (!m_context->hw_frames)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Could not create hardware frames for encoder {}", codec->name);
+      return false;
+    }
+
+    pix_fmt = reinterpret_cast<AVHWFramesContext*>(m_context->hw_frames->data)->format;
+    m_context->codec->hw_frames_ctx = av_buffer_ref(m_context->hw_frames);
+    m_context->hw_frame = av_frame_alloc();
+  }
+
   m_context->codec->pix_fmt = pix_fmt;
 
   if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
@@ -302,7 +386,7 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
 
-  m_context->scaled_frame->format = m_context->codec->pix_fmt;
+  m_context->scaled_frame->format = sw_pix_fmt;
   m_context->scaled_frame->width = m_context->width;
   m_context->scaled_frame->height = m_context->height;
 
@@ -319,6 +403,12 @@ bool FFMpegFrameDump::CreateVideoFile()
 
   m_context->stream->time_base = m_context->codec->time_base;
 
+  // The emulated time of the first frame in seconds, to line the video up with audio dumps. Their
+  // bext chunks have the same time as a sample count.
+  const u32 ticks_per_second = Core::System::GetInstance().GetSystemTimers().GetTicksPerSecond();
+  av_dict_set(&m_context->format->metadata, "dolphin_start_time",
+              fmt::format("{:.6f}", double(m_context->start_ticks) / ticks_per_second).c_str(), 0);
+
   NOTICE_LOG_FMT(FRAMEDUMP, "Opening file {} for dumping", dump_path);
   if (avio_open(&m_context->format->pb, dump_path.c_str(), AVIO_FLAG_WRITE) < 0 ||
       avformat_write_header(m_context->format, nullptr))
@@ -387,7 +477,8 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   // Convert image from RGBA to desired pixel format.
   m_context->sws = sws_getCachedContext(
       m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+      static_cast<AVPixelFormat>(m_context->scaled_frame->format), SWS_BICUBIC, nullptr, nullptr,
+      nullptr);
   if (m_context->sws)
   {
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
@@ -397,7 +488,27 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   m_context->last_pts = pts;
   m_context->scaled_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  AVFrame* encoder_frame = m_context->scaled_frame;
+  if (m_context->hw_frames)
+  {
+    // Upload the converted frame to the encoder's device.
+    encoder_frame = m_context->hw_frame;
+    int error = av_hwframe_get_buffer(m_context->hw_frames, encoder_frame, 0);
+    if (!error)
+      error = av_hwframe_transfer_data(encoder_frame, m_context->scaled_frame, 0);
+    if (error)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Error uploading frame: {}", AVErrorString(error));
+      av_frame_unref(encoder_frame);
+      return;
+    }
+    encoder_frame->pts = pts;
+  }
+
+  const int error = avcodec_send_frame(m_context->codec, encoder_frame);
+  if (m_context->hw_frames)
+    av_frame_unref(encoder_frame);
+  if (error)
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -470,8 +581,10 @@ void FFMpegFrameDump::CloseVideoFile()
 {
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
+  av_frame_free(&m_context->hw_frame);
 
   avcodec_free_context(&m_context->codec);
+  av_buffer_unref(&m_context->hw_frames);
 
   if (m_context->format)
     avio_closep(&m_context->format->pb);
@@ -62,13 +62,19 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // If every readback texture is still waiting to be encoded, free up the oldest one.
+  if (m_frame_dump_num_readbacks == NUM_FRAME_DUMP_READBACK_TEXTURES)
+    QueueOldestFrameDumpReadback();
+
+  PendingReadback& readback =
+      m_frame_dump_readbacks[(m_frame_dump_first_readback + m_frame_dump_num_readbacks) %
+                             NUM_FRAME_DUMP_READBACK_TEXTURES];
+  if (!CheckFrameDumpReadbackTexture(readback.texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  readback.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, readback.texture->GetRect());
+  readback.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_frame_dump_num_readbacks++;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -99,9 +105,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                                u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -118,38 +124,53 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_frame_dump_num_readbacks == 0)
     return;
 
+  // Keep the most recent frames in flight while dumping to a file. Screenshots are written right
+  // away, since the next frame might not come until emulation is unpaused.
+  const bool pipeline_readbacks =
+      Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES) && !m_screenshot_request.IsSet();
+  const u32 max_pending_readbacks = pipeline_readbacks ? NUM_FRAME_DUMP_READBACK_TEXTURES - 1 : 0;
+  while (m_frame_dump_num_readbacks > max_pending_readbacks)
+    QueueOldestFrameDumpReadback();
+
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
+}
+
+void FrameDumper::QueueOldestFrameDumpReadback()
+{
   // Ensure dumping thread is done with output texture before swapping.
   FinishFrameData();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  PendingReadback& readback = m_frame_dump_readbacks[m_frame_dump_first_readback];
+  std::swap(m_frame_dump_output_texture, readback.texture);
+  m_frame_dump_first_readback =
+      (m_frame_dump_first_readback + 1) % NUM_FRAME_DUMP_READBACK_TEXTURES;
+  m_frame_dump_num_readbacks--;
 
-  // Queue encoding of the last frame dumped.
+  // Queue encoding of the frame.
   auto& output = m_frame_dump_output_texture;
   output->Flush();
   if (output->Map())
   {
     DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                  readback.state);
   }
   else
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
   }
-
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure all queued readbacks have been sent to the encoder.
+  while (m_frame_dump_num_readbacks > 0)
+    QueueOldestFrameDumpReadback();
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
@@ -165,13 +186,15 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
+  for (PendingReadback& readback : m_frame_dump_readbacks)
+    readback.texture.reset();
   m_frame_dump_output_texture.reset();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride,
+                                const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -25,7 +28,7 @@ public:
   // Ensures all rendered frames are queued for encoding.
   void FlushFrameDump();
 
-  // Fills the frame dump staging texture with the current XFB texture.
+  // Queues a readback of the current XFB texture to one of the frame dump staging textures.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect,
                         const MathUtil::Rectangle<int>& target_rect, u64 ticks, int frame_number);
@@ -53,10 +56,14 @@ private:
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
   // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& texture,
+                                     u32 target_width, u32 target_height);
+
+  // Maps the oldest pending readback and hands it to the frame dump thread.
+  void QueueOldestFrameDumpReadback();
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -70,9 +77,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
@@ -80,11 +84,22 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
+  // Frames are read back through a ring of staging textures. While dumping to a file, a readback
+  // is only mapped once the frames after it have been rendered, by which time the GPU has usually
+  // finished the copy, so the video thread doesn't have to wait for it.
+  static constexpr u32 NUM_FRAME_DUMP_READBACK_TEXTURES = 3;
+  struct PendingReadback
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    // Emulation state during the swap of the frame being read back.
+    FrameState state;
+  };
+  std::array<PendingReadback, NUM_FRAME_DUMP_READBACK_TEXTURES> m_frame_dump_readbacks;
+  u32 m_frame_dump_first_readback = 0;
+  u32 m_frame_dump_num_readbacks = 0;
+
+  // Texture currently mapped for the frame dump thread.
   std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
   // Set when thread is processing output texture.
   bool m_frame_dump_frame_running = false;
 
@@ -0,0 +1,121 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameTimingRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <picojson.h>
+
+#include "Common/JsonUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "VideoCommon/GPUTimingQuery.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+FrameTimingRecorder g_frame_timing_recorder;
+
+void FrameTimingRecorder::Start()
+{
+  m_frames.clear();
+  m_next_gpu_record = 0;
+  m_last_present_time = Clock::now();
+  m_last_shaders_created = 0;
+
+  m_present_hook = AfterPresentEvent::Register([this](const PresentInfo&) { OnPresent(); },
+                                               "FrameTimingRecorder");
+  m_recording.store(true, std::memory_order_relaxed);
+}
+
+void FrameTimingRecorder::Stop()
+{
+  m_recording.store(false, std::memory_order_relaxed);
+  m_present_hook.reset();
+}
+
+void FrameTimingRecorder::OnPresent()
+{
+  const Clock::time_point now = Clock::now();
+  const int shaders_created =
+      g_stats.num_pixel_shaders_created + g_stats.num_vertex_shaders_created;
+
+  FrameRecord& frame = m_frames.emplace_back();
+  frame.cpu_time_ms = std::chrono::duration<double, std::milli>(now - m_last_present_time).count();
+  // The shader cache resets its counters when it's reloaded.
+  frame.shaders_compiled = std::max(shaders_created - m_last_shaders_created, 0);
+  frame.draw_calls = g_stats.this_frame.num_draw_calls;
+  // The frame which was just presented is the last one GPU timing finished recording.
+  if (g_gpu_timing_query && g_gpu_timing_query->GetFrameNumber() != 0)
+    frame.gpu_frame_number = g_gpu_timing_query->GetFrameNumber() - 1;
+
+  m_last_present_time = now;
+  m_last_shaders_created = shaders_created;
+}
+
+void FrameTimingRecorder::AddGPUTime(u64 gpu_frame_number, double time_ms)
+{
+  if (!IsRecording())
+    return;
+
+  for (; m_next_gpu_record < m_frames.size(); m_next_gpu_record++)
+  {
+    FrameRecord& frame = m_frames[m_next_gpu_record];
+    if (frame.gpu_frame_number > gpu_frame_number)
+      return;
+
+    if (frame.gpu_frame_number == gpu_frame_number)
+    {
+      frame.gpu_time_ms = time_ms;
+      m_next_gpu_record++;
+      return;
+    }
+  }
+}
+
+bool FrameTimingRecorder::WriteJSON(const std::string& path) const
+{
+  picojson::array frames;
+  frames.reserve(m_frames.size());
+  double total_cpu_time_ms = 0.0;
+  double total_gpu_time_ms = 0.0;
+  size_t gpu_timed_frames = 0;
+  int total_shaders_compiled = 0;
+  for (const FrameRecord& frame : m_frames)
+  {
+    picojson::object json;
+    json["cpu_time_ms"] = picojson::value(frame.cpu_time_ms);
+    if (frame.gpu_time_ms >= 0.0)
+      json["gpu_time_ms"] = picojson::value(frame.gpu_time_ms);
+    json["shaders_compiled"] = picojson::value(static_cast<double>(frame.shaders_compiled));
+    json["draw_calls"] = picojson::value(static_cast<double>(frame.draw_calls));
+    frames.emplace_back(std::move(json));
+
+    total_cpu_time_ms += frame.cpu_time_ms;
+    if (frame.gpu_time_ms >= 0.0)
+    {
+      total_gpu_time_ms += frame.gpu_time_ms;
+      gpu_timed_frames++;
+    }
+    total_shaders_compiled += frame.shaders_compiled;
+  }
+
+  picojson::object summary;
+  summary["frames"] = picojson::value(static_cast<double>(m_frames.size()));
+  summary["total_cpu_time_ms"] = picojson::value(total_cpu_time_ms);
+  if (!m_frames.empty())
+  {
+    summary["average_cpu_time_ms"] = picojson::value(total_cpu_time_ms / m_frames.size());
+    if (total_cpu_time_ms > 0.0)
+      summary["average_fps"] = picojson::value(m_frames.size() * 1000.0 / total_cpu_time_ms);
+  }
+  if (gpu_timed_frames != 0)
+    summary["average_gpu_time_ms"] = picojson::value(total_gpu_time_ms / gpu_timed_frames);
+  summary["shaders_compiled"] = picojson::value(static_cast<double>(total_shaders_compiled));
+
+  picojson::object root;
+  root["video_backend"] = picojson::value(Config::Get(Config::MAIN_GFX_BACKEND));
+  root["summary"] = picojson::value(std::move(summary));
+  root["frames"] = picojson::value(std::move(frames));
+  return JsonToFile(path, picojson::value(std::move(root)), true);
+}
@@ -0,0 +1,58 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+// Records the timings of every presented frame, for benchmarking the video pipeline, e.g. by
+// replaying a FIFO log as fast as possible.
+//
+// Frames are recorded on the video thread. Start() must be called before the video backend
+// starts, and the results are only accessed after it has shut down.
+class FrameTimingRecorder
+{
+public:
+  void Start();
+  void Stop();
+
+  bool IsRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+  // Called with the GPU time of a frame, identified by its GPUTimingQueryBase frame number, once
+  // the GPU has finished it.
+  void AddGPUTime(u64 gpu_frame_number, double time_ms);
+
+  bool WriteJSON(const std::string& path) const;
+
+private:
+  struct FrameRecord
+  {
+    // Host time since the previous present. Without throttling, this is how long the emulated
+    // frame took to process.
+    double cpu_time_ms = 0.0;
+    // Negative if the backend can't time GPU work, or the result never arrived.
+    double gpu_time_ms = -1.0;
+    u64 gpu_frame_number = 0;
+    int shaders_compiled = 0;
+    int draw_calls = 0;
+  };
+
+  void OnPresent();
+
+  std::atomic<bool> m_recording = false;
+  Common::EventHook m_present_hook;
+
+  std::vector<FrameRecord> m_frames;
+  // GPU results arrive in frame order, so they are matched up starting from this record.
+  size_t m_next_gpu_record = 0;
+
+  Clock::time_point m_last_present_time;
+  int m_last_shaders_created = 0;
+};
+
+extern FrameTimingRecorder g_frame_timing_recorder;
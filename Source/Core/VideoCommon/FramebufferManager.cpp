@@ -3,6 +3,7 @@
 
 #include "VideoCommon/FramebufferManager.h"
 
+#include <chrono>
 #include <fmt/format.h>
 #include <memory>
 
@@ -10,6 +11,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/HW/VideoInterface.h"
 #include "Core/System.h"
 #include "VideoCommon/AbstractFramebuffer.h"
 #include "VideoCommon/AbstractGfx.h"
@@ -20,8 +22,10 @@
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -217,6 +221,11 @@ std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
   else
     m_efb_scale = g_ActiveConfig.iEFBScale;
 
+  if (!g_ActiveConfig.bDynamicResolution)
+    m_dynamic_scale_limit = 0;
+  else if (m_dynamic_scale_limit != 0)
+    m_efb_scale = std::min(m_efb_scale, static_cast<float>(m_dynamic_scale_limit));
+
   const u32 max_size = g_ActiveConfig.backend_info.MaxTextureSize;
   if (max_size < EFB_WIDTH * m_efb_scale)
     m_efb_scale = max_size / EFB_WIDTH;
@@ -249,6 +258,13 @@ bool FramebufferManager::CreateEFBFramebuffer()
   if (!m_efb_framebuffer || !m_efb_convert_framebuffer)
     return false;
 
+  // Format conversion only writes color, so it renders without the depth attachment.
+  m_efb_color_only_framebuffer = g_gfx->CreateFramebuffer(m_efb_color_texture.get(), nullptr);
+  m_efb_convert_color_only_framebuffer =
+      g_gfx->CreateFramebuffer(m_efb_convert_color_texture.get(), nullptr);
+  if (!m_efb_color_only_framebuffer || !m_efb_convert_color_only_framebuffer)
+    return false;
+
   // Create resolved textures if MSAA is on
   if (g_ActiveConfig.MultisamplingEnabled())
   {
@@ -300,6 +316,8 @@ void FramebufferManager::DestroyEFBFramebuffer()
 {
   m_efb_framebuffer.reset();
   m_efb_convert_framebuffer.reset();
+  m_efb_color_only_framebuffer.reset();
+  m_efb_convert_color_only_framebuffer.reset();
   m_efb_color_texture.reset();
   m_efb_convert_color_texture.reset();
   m_efb_depth_texture.reset();
@@ -382,13 +400,12 @@ bool FramebufferManager::ReinterpretPixelData(EFBReinterpretType convtype)
   if (!m_format_conversion_pipelines[static_cast<u32>(convtype)])
     return false;
 
-  // Draw to the secondary framebuffer.
-  // We don't discard here because discarding the framebuffer also throws away the depth
-  // buffer, which we want to preserve. If we find this to be hindering performance in the
-  // future (e.g. on mobile/tilers), it may be worth discarding only the color buffer.
+  // Draw to the secondary color texture. Every pixel is written, so the old contents can be
+  // discarded, and leaving the depth buffer out of the pass means it doesn't have to be loaded
+  // and stored again just to preserve it (which is expensive on tilers).
   m_efb_color_texture->FinishedRendering();
   g_gfx->BeginUtilityDrawing();
-  g_gfx->SetFramebuffer(m_efb_convert_framebuffer.get());
+  g_gfx->SetAndDiscardFramebuffer(m_efb_convert_color_only_framebuffer.get());
   g_gfx->SetViewportAndScissor(m_efb_framebuffer->GetRect());
   g_gfx->SetPipeline(m_format_conversion_pipelines[static_cast<u32>(convtype)].get());
   g_gfx->SetTexture(0, m_efb_color_texture.get());
@@ -397,6 +414,7 @@ bool FramebufferManager::ReinterpretPixelData(EFBReinterpretType convtype)
   // And swap the framebuffers around, so we do new drawing to the converted framebuffer.
   std::swap(m_efb_color_texture, m_efb_convert_color_texture);
   std::swap(m_efb_framebuffer, m_efb_convert_framebuffer);
+  std::swap(m_efb_color_only_framebuffer, m_efb_convert_color_only_framebuffer);
   g_gfx->EndUtilityDrawing();
   InvalidatePeekCache(true);
   return true;
@@ -422,6 +440,7 @@ bool FramebufferManager::CompileConversionPipelines()
     config.depth_state = RenderState::GetNoDepthTestingDepthState();
     config.blending_state = RenderState::GetNoBlendingBlendState();
     config.framebuffer_state = GetEFBFramebufferState();
+    config.framebuffer_state.depth_texture_format = AbstractTextureFormat::Undefined;
     config.usage = AbstractPipelineUsage::Utility;
     m_format_conversion_pipelines[i] = g_gfx->CreatePipeline(config);
     if (!m_format_conversion_pipelines[i])
@@ -478,17 +497,7 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
   if (g_ActiveConfig.backend_info.bUsesLowerLeftOrigin)
     y = EFB_HEIGHT - 1 - y;
 
-  u32 tile_index;
-  if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
-
-  m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
-
-  if (m_efb_color_cache.needs_flush)
-  {
-    m_efb_color_cache.readback_texture->Flush();
-    m_efb_color_cache.needs_flush = false;
-  }
+  PrepareEFBCacheRead(false, x, y);
 
   u32 value;
   m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
@@ -501,21 +510,38 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   if (g_ActiveConfig.backend_info.bUsesLowerLeftOrigin)
     y = EFB_HEIGHT - 1 - y;
 
+  PrepareEFBCacheRead(true, x, y);
+
+  float value;
+  m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
+  return value;
+}
+
+void FramebufferManager::PrepareEFBCacheRead(bool depth, u32 x, u32 y)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
   u32 tile_index;
-  if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
+  const bool present = IsEFBCacheTilePresent(depth, x, y, &tile_index);
+  data.tiles[tile_index].frame_access_mask |= 1;
+  if (present && !data.needs_flush)
+    return;
 
-  m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
+  // Either the tile has to be copied now, or a prefetch is still in flight. Both have to wait for
+  // the GPU to catch up with the CPU.
+  const auto stall_start = std::chrono::steady_clock::now();
+  if (!present)
+    PopulateEFBCache(depth, tile_index);
 
-  if (m_efb_depth_cache.needs_flush)
+  if (data.needs_flush)
   {
-    m_efb_depth_cache.readback_texture->Flush();
-    m_efb_depth_cache.needs_flush = false;
+    data.readback_texture->Flush();
+    data.needs_flush = false;
   }
 
-  float value;
-  m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
-  return value;
+  const auto stall_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - stall_start);
+  INCSTAT(g_stats.this_frame.num_efb_peek_stalls);
+  ADDSTAT(g_stats.this_frame.efb_peek_stall_us, static_cast<int>(stall_time.count()));
 }
 
 void FramebufferManager::SetEFBCacheTileSize(u32 size)
@@ -538,17 +564,21 @@ void FramebufferManager::RefreshPeekCache()
     return;
   }
 
+  // Copy the tiles which were read in the last few frames ahead of time, so that the CPU doesn't
+  // have to wait for them if they're read again.
   bool flush_command_buffer = false;
   for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
   {
     if (m_efb_color_cache.tiles[i].frame_access_mask != 0 && !m_efb_color_cache.tiles[i].present)
     {
       PopulateEFBCache(false, i, true);
+      INCSTAT(g_stats.this_frame.num_efb_peek_prefetches);
       flush_command_buffer = true;
     }
     if (m_efb_depth_cache.tiles[i].frame_access_mask != 0 && !m_efb_depth_cache.tiles[i].present)
     {
       PopulateEFBCache(true, i, true);
+      INCSTAT(g_stats.this_frame.num_efb_peek_prefetches);
       flush_command_buffer = true;
     }
   }
@@ -565,46 +595,91 @@ void FramebufferManager::RefreshPeekCache()
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
   if (forced || m_efb_color_cache.out_of_date)
-  {
-    if (m_efb_color_cache.has_active_tiles)
-    {
-      for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
-      {
-        m_efb_color_cache.tiles[i].present = false;
-      }
-
-      m_efb_color_cache.needs_refresh = true;
-    }
-
-    m_efb_color_cache.has_active_tiles = false;
-    m_efb_color_cache.out_of_date = false;
-  }
+    InvalidateEFBCacheTiles(m_efb_color_cache, forced);
   if (forced || m_efb_depth_cache.out_of_date)
+    InvalidateEFBCacheTiles(m_efb_depth_cache, forced);
+}
+
+void FramebufferManager::InvalidateEFBCacheTiles(EFBCacheData& data, bool forced)
+{
+  if (data.has_active_tiles)
   {
-    if (m_efb_depth_cache.has_active_tiles)
+    bool has_active_tiles = false;
+    for (EFBCacheTile& tile : data.tiles)
     {
-      for (u32 i = 0; i < m_efb_depth_cache.tiles.size(); i++)
+      if (tile.present && (forced || tile.dirty))
       {
-        m_efb_depth_cache.tiles[i].present = false;
+        tile.present = false;
+        data.needs_refresh = true;
       }
-
-      m_efb_depth_cache.needs_refresh = true;
+      tile.dirty = false;
+      has_active_tiles |= tile.present;
     }
-
-    m_efb_depth_cache.has_active_tiles = false;
-    m_efb_depth_cache.out_of_date = false;
+    data.has_active_tiles = has_active_tiles;
   }
+
+  data.out_of_date = false;
 }
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
 {
-  if (m_efb_color_cache.has_active_tiles)
-    m_efb_color_cache.out_of_date = true;
-  if (m_efb_depth_cache.has_active_tiles)
-    m_efb_depth_cache.out_of_date = true;
+  FlagPeekCacheAsOutOfDate(MathUtil::Rectangle<int>(0, 0, EFB_WIDTH, EFB_HEIGHT), true, true);
+}
+
+void FramebufferManager::FlagPeekCacheAsOutOfDate(const MathUtil::Rectangle<int>& rect, bool color,
+                                                  bool depth)
+{
+  if (color && m_efb_color_cache.has_active_tiles)
+    MarkEFBCacheTilesDirty(m_efb_color_cache, rect);
+  if (depth && m_efb_depth_cache.has_active_tiles)
+    MarkEFBCacheTilesDirty(m_efb_depth_cache, rect);
 
   if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
-    InvalidatePeekCache();
+    InvalidatePeekCache(false);
+}
+
+void FramebufferManager::MarkEFBCacheTilesDirty(EFBCacheData& data,
+                                                const MathUtil::Rectangle<int>& rect)
+{
+  // Tiles use the same origin as the readback texture.
+  int top = rect.top;
+  int bottom = rect.bottom;
+  if (g_ActiveConfig.backend_info.bUsesLowerLeftOrigin)
+  {
+    top = EFB_HEIGHT - rect.bottom;
+    bottom = EFB_HEIGHT - rect.top;
+  }
+
+  const int left = std::max(rect.left, 0);
+  const int right = std::min(rect.right, static_cast<int>(EFB_WIDTH));
+  top = std::max(top, 0);
+  bottom = std::min(bottom, static_cast<int>(EFB_HEIGHT));
+  if (left >= right || top >= bottom)
+    return;
+
+  if (!IsUsingTiledEFBCache())
+  {
+    data.tiles[0].dirty = true;
+    data.out_of_date = true;
+    return;
+  }
+
+  const u32 first_tile_x = static_cast<u32>(left) / m_efb_cache_tile_size;
+  const u32 last_tile_x = static_cast<u32>(right - 1) / m_efb_cache_tile_size;
+  const u32 first_tile_y = static_cast<u32>(top) / m_efb_cache_tile_size;
+  const u32 last_tile_y = static_cast<u32>(bottom - 1) / m_efb_cache_tile_size;
+  for (u32 tile_y = first_tile_y; tile_y <= last_tile_y; tile_y++)
+  {
+    for (u32 tile_x = first_tile_x; tile_x <= last_tile_x; tile_x++)
+    {
+      EFBCacheTile& tile = data.tiles[tile_y * m_efb_cache_tile_row_stride + tile_x];
+      if (tile.present)
+      {
+        tile.dirty = true;
+        data.out_of_date = true;
+      }
+    }
+  }
 }
 
 void FramebufferManager::EndOfFrame()
@@ -614,6 +689,87 @@ void FramebufferManager::EndOfFrame()
     m_efb_color_cache.tiles[i].frame_access_mask <<= 1;
     m_efb_depth_cache.tiles[i].frame_access_mask <<= 1;
   }
+
+  if (g_ActiveConfig.bDynamicResolution)
+    UpdateDynamicResolution();
+}
+
+void FramebufferManager::UpdateDynamicResolution()
+{
+  // How long the GPU has to be over or under budget before the scale changes. Stepping down
+  // reacts faster than stepping up, as a dropped frame is worse than a blurrier one.
+  static constexpr u32 FRAMES_BEFORE_DECREASE = 30;
+  static constexpr u32 FRAMES_BEFORE_INCREASE = 180;
+  // The pass times are smoothed, so give them time to settle after a change.
+  static constexpr u64 FRAMES_TO_SETTLE = 60;
+  static constexpr double DECREASE_THRESHOLD = 0.95;
+  static constexpr double INCREASE_THRESHOLD = 0.85;
+
+  if (!g_gpu_timing_query || !g_gpu_timing_query->HasResults() ||
+      g_gpu_timing_query->GetFrameNumber() < m_dynamic_resolution_wait_until_frame)
+  {
+    return;
+  }
+
+  // Recreating the EFB throws away its contents, so only do it right after the game cleared the
+  // EFB with its XFB copy, when there's nothing left to lose.
+  if (!bpmem.triggerEFBCopy.clear)
+    return;
+
+  const double refresh_rate =
+      Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
+  if (refresh_rate <= 0.0)
+    return;
+
+  double gpu_time_ms = 0.0;
+  for (u32 i = 0; i < static_cast<u32>(GPUTimingPass::Count); i++)
+    gpu_time_ms += g_gpu_timing_query->GetPassTime(static_cast<GPUTimingPass>(i));
+
+  // EFB rendering cost grows with the number of pixels, so estimate what the next scale up
+  // would cost before committing to it.
+  const double budget_ms = 1000.0 / refresh_rate;
+  const u32 current_scale = std::max(GetEFBScale(), 1u);
+  const double next_scale_ratio = static_cast<double>((current_scale + 1) * (current_scale + 1)) /
+                                  static_cast<double>(current_scale * current_scale);
+  const u32 max_scale = g_ActiveConfig.iEFBScale == EFB_SCALE_AUTO_INTEGRAL ?
+                            g_presenter->AutoIntegralScale() :
+                            static_cast<u32>(g_ActiveConfig.iEFBScale);
+
+  u32 new_limit = m_dynamic_scale_limit;
+  if (gpu_time_ms > budget_ms * DECREASE_THRESHOLD && current_scale > 1)
+  {
+    m_frames_under_budget = 0;
+    if (++m_frames_over_budget >= FRAMES_BEFORE_DECREASE)
+      new_limit = current_scale - 1;
+  }
+  else if (current_scale < max_scale &&
+           gpu_time_ms * next_scale_ratio < budget_ms * INCREASE_THRESHOLD)
+  {
+    m_frames_over_budget = 0;
+    if (++m_frames_under_budget >= FRAMES_BEFORE_INCREASE)
+      new_limit = current_scale + 1 < max_scale ? current_scale + 1 : 0;
+  }
+  else
+  {
+    m_frames_over_budget = 0;
+    m_frames_under_budget = 0;
+  }
+
+  if (new_limit == m_dynamic_scale_limit)
+    return;
+
+  m_dynamic_scale_limit = new_limit;
+  m_frames_over_budget = 0;
+  m_frames_under_budget = 0;
+  m_dynamic_resolution_wait_until_frame = g_gpu_timing_query->GetFrameNumber() + FRAMES_TO_SETTLE;
+
+  INFO_LOG_FMT(VIDEO, "Dynamic resolution: {:.2f} ms GPU time for a {:.2f} ms frame, scale {}",
+               gpu_time_ms, budget_ms, new_limit != 0 ? new_limit : max_scale);
+  RecreateEFBFramebuffer();
+
+  // Same as when the internal resolution is changed in the config.
+  Core::System::GetInstance().GetPixelShaderManager().Dirty();
+  BPFunctions::SetScissorAndViewport();
 }
 
 bool FramebufferManager::CompileReadbackPipelines()
@@ -760,9 +916,11 @@ bool FramebufferManager::CreateReadbackFramebuffer()
   }
 
   m_efb_color_cache.tiles.resize(total_tiles);
-  std::fill(m_efb_color_cache.tiles.begin(), m_efb_color_cache.tiles.end(), EFBCacheTile{false, 0});
+  std::fill(m_efb_color_cache.tiles.begin(), m_efb_color_cache.tiles.end(),
+            EFBCacheTile{false, false, 0});
   m_efb_depth_cache.tiles.resize(total_tiles);
-  std::fill(m_efb_depth_cache.tiles.begin(), m_efb_depth_cache.tiles.end(), EFBCacheTile{false, 0});
+  std::fill(m_efb_depth_cache.tiles.begin(), m_efb_depth_cache.tiles.end(),
+            EFBCacheTile{false, false, 0});
 
   return true;
 }
@@ -849,15 +1007,15 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
     data.needs_flush = true;
   }
   data.has_active_tiles = true;
-  data.out_of_date = false;
   data.tiles[tile_index].present = true;
+  data.tiles[tile_index].dirty = false;
 }
 
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color_enable,
                                   bool alpha_enable, bool z_enable, u32 color, u32 z)
 {
   FlushEFBPokes();
-  FlagPeekCacheAsOutOfDate();
+  FlagPeekCacheAsOutOfDate(rc, color_enable || alpha_enable, z_enable);
 
   // Native -> EFB coordinates
   MathUtil::Rectangle<int> target_rc = ConvertEFBRectangle(rc);
@@ -17,6 +17,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoEvents.h"
 
 class NativeVertexFormat;
@@ -114,6 +115,10 @@ public:
 
   AbstractPipeline* GetClearPipeline(bool clear_color, bool clear_alpha, bool clear_z) const;
 
+  // Region of the EFB which draws with the current scissor and viewport can write to.
+  const MathUtil::Rectangle<int>& GetDrawBounds() const { return m_draw_bounds; }
+  void SetDrawBounds(const MathUtil::Rectangle<int>& rect) { m_draw_bounds = rect; }
+
   // Reads a framebuffer value back from the GPU. This may block if the cache is not current.
   u32 PeekEFBColor(u32 x, u32 y);
   float PeekEFBDepth(u32 x, u32 y);
@@ -121,6 +126,8 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void RefreshPeekCache();
   void FlagPeekCacheAsOutOfDate();
+  // Only marks the cache tiles overlapping rect (in native EFB coordinates) as out of date.
+  void FlagPeekCacheAsOutOfDate(const MathUtil::Rectangle<int>& rect, bool color, bool depth);
   void EndOfFrame();
 
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
@@ -142,6 +149,8 @@ protected:
   struct EFBCacheTile
   {
     bool present;
+    // Drawn to since it was copied, and will be discarded on the next invalidation.
+    bool dirty;
     u8 frame_access_mask;
   };
 
@@ -182,6 +191,11 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void MarkEFBCacheTilesDirty(EFBCacheData& data, const MathUtil::Rectangle<int>& rect);
+  void InvalidateEFBCacheTiles(EFBCacheData& data, bool forced);
+
+  // Makes sure the given pixel can be read from the readback texture, waiting if needed.
+  void PrepareEFBCacheRead(bool depth, u32 x, u32 y);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -190,6 +204,7 @@ protected:
                         const AbstractPipeline* pipeline);
 
   std::tuple<u32, u32> CalculateTargetSize();
+  void UpdateDynamicResolution();
 
   void DoLoadState(PointerWrap& p);
   void DoSaveState(PointerWrap& p);
@@ -197,6 +212,12 @@ protected:
   float m_efb_scale = 1.0f;
   PixelFormat m_prev_efb_format;
 
+  // Upper limit on the EFB scale picked by dynamic resolution. Zero means no limit.
+  u32 m_dynamic_scale_limit = 0;
+  u32 m_frames_over_budget = 0;
+  u32 m_frames_under_budget = 0;
+  u64 m_dynamic_resolution_wait_until_frame = 0;
+
   std::unique_ptr<AbstractTexture> m_efb_color_texture;
   std::unique_ptr<AbstractTexture> m_efb_convert_color_texture;
   std::unique_ptr<AbstractTexture> m_efb_depth_texture;
@@ -205,6 +226,8 @@ protected:
 
   std::unique_ptr<AbstractFramebuffer> m_efb_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_convert_framebuffer;
+  std::unique_ptr<AbstractFramebuffer> m_efb_color_only_framebuffer;
+  std::unique_ptr<AbstractFramebuffer> m_efb_convert_color_only_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_color_resolve_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_depth_resolve_framebuffer;
   std::unique_ptr<AbstractPipeline> m_efb_color_resolve_pipeline;
@@ -226,6 +249,7 @@ protected:
   u32 m_efb_cache_tile_row_stride = 1;
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
+  MathUtil::Rectangle<int> m_draw_bounds{0, 0, EFB_WIDTH, EFB_HEIGHT};
 
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
@@ -0,0 +1,140 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUTimingQuery.h"
+
+#include <iomanip>
+
+#include "Common/FileUtil.h"
+#include "VideoCommon/FrameTimingRecorder.h"
+#include "VideoCommon/VideoConfig.h"
+
+std::unique_ptr<GPUTimingQueryBase> g_gpu_timing_query;
+
+GPUTimingQueryBase::GPUTimingQueryBase() = default;
+
+GPUTimingQueryBase::~GPUTimingQueryBase() = default;
+
+const char* GPUTimingQueryBase::GetPassName(GPUTimingPass pass)
+{
+  static constexpr std::array<const char*, static_cast<u32>(GPUTimingPass::Count)> names = {
+      "EFB draw", "EFB copy", "XFB copy", "Color correction", "Post-processing", "Present"};
+  return names[static_cast<u32>(pass)];
+}
+
+void GPUTimingQueryBase::SwitchPass(GPUTimingPass pass)
+{
+  m_current_pass = pass;
+  if (m_recording)
+    StartSegment();
+}
+
+void GPUTimingQueryBase::StartSegment()
+{
+  // If a frame runs out of segments, the rest of it is attributed to the last pass.
+  Frame& frame = m_frames[m_current_frame];
+  if (frame.num_segments == MAX_SEGMENTS_PER_FRAME)
+    return;
+
+  frame.passes[frame.num_segments] = m_current_pass;
+  BeginSegment(m_current_frame * QUERIES_PER_FRAME + frame.num_segments);
+  frame.num_segments++;
+}
+
+void GPUTimingQueryBase::EndFrame()
+{
+  if (m_recording)
+  {
+    Frame& frame = m_frames[m_current_frame];
+    EndSegment(m_current_frame * QUERIES_PER_FRAME + frame.num_segments);
+    frame.pending = true;
+    m_current_frame = (m_current_frame + 1) % NUM_FRAMES;
+  }
+  m_frame_number++;
+
+  ReadResults();
+
+  m_recording = (g_ActiveConfig.bShowGPUTimings || g_ActiveConfig.bDynamicResolution ||
+                 g_frame_timing_recorder.IsRecording()) &&
+                IsSupported();
+  if (!m_recording)
+  {
+    for (Frame& frame : m_frames)
+      frame.pending = false;
+    m_has_results = false;
+    return;
+  }
+
+  // If the GPU is this far behind, the oldest frame's results are dropped.
+  Frame& frame = m_frames[m_current_frame];
+  frame.pending = false;
+  frame.number = m_frame_number;
+  frame.num_segments = 0;
+  ResetQueries(m_current_frame * QUERIES_PER_FRAME, QUERIES_PER_FRAME);
+  StartSegment();
+}
+
+void GPUTimingQueryBase::ReadResults()
+{
+  // Frames finish in order, starting with the one after the one being recorded.
+  for (u32 i = 0; i < NUM_FRAMES; i++)
+  {
+    const u32 frame_index = (m_current_frame + i) % NUM_FRAMES;
+    Frame& frame = m_frames[frame_index];
+    if (!frame.pending)
+      continue;
+
+    std::array<u64, MAX_SEGMENTS_PER_FRAME> segment_times;
+    if (!GetSegmentTimes(frame_index * QUERIES_PER_FRAME, frame.num_segments,
+                         segment_times.data()))
+    {
+      break;
+    }
+
+    std::array<double, static_cast<u32>(GPUTimingPass::Count)> times{};
+    double total = 0.0;
+    for (u32 segment = 0; segment < frame.num_segments; segment++)
+    {
+      times[static_cast<u32>(frame.passes[segment])] += segment_times[segment] / 1000000.0;
+      total += segment_times[segment] / 1000000.0;
+    }
+    g_frame_timing_recorder.AddGPUTime(frame.number, total);
+
+    for (u32 pass = 0; pass < times.size(); pass++)
+    {
+      if (m_has_results)
+        m_pass_times_ms[pass] += (times[pass] - m_pass_times_ms[pass]) * 0.1;
+      else
+        m_pass_times_ms[pass] = times[pass];
+    }
+    m_has_results = true;
+    frame.pending = false;
+
+    LogPassTimesToFile(times);
+  }
+}
+
+void GPUTimingQueryBase::LogPassTimesToFile(
+    const std::array<double, static_cast<u32>(GPUTimingPass::Count)>& times)
+{
+  if (!g_ActiveConfig.bLogRenderTimeToFile)
+    return;
+
+  if (!m_log_file.is_open())
+  {
+    File::OpenFStream(m_log_file, File::GetUserPath(D_LOGS_IDX) + "gpu_pass_times.csv",
+                      std::ios_base::out);
+    for (u32 pass = 0; pass < times.size(); pass++)
+      m_log_file << GetPassName(static_cast<GPUTimingPass>(pass)) << " (ms),";
+    m_log_file << "Total (ms)" << std::endl;
+  }
+
+  double total = 0.0;
+  m_log_file << std::fixed << std::setprecision(4);
+  for (const double time : times)
+  {
+    m_log_file << time << ',';
+    total += time;
+  }
+  m_log_file << total << std::endl;
+}
@@ -0,0 +1,106 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <fstream>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+enum class GPUTimingPass : u8
+{
+  EFBDraw,
+  EFBCopy,
+  XFBCopy,
+  ColorCorrection,
+  PostProcessing,
+  Present,
+  Count
+};
+
+// Measures how long the host GPU spends on each pass of a frame, for the performance overlay.
+//
+// GPU work is split into segments at every pass change, and the backend times each segment with
+// a query. Segments are timed back to back, so any time the GPU is idle waiting for more work is
+// attributed to the pass which was active at the time.
+class GPUTimingQueryBase
+{
+public:
+  GPUTimingQueryBase();
+  virtual ~GPUTimingQueryBase();
+
+  // Returns false if the backend can't time GPU work, in which case nothing is recorded.
+  virtual bool IsSupported() const { return false; }
+
+  // Attributes the GPU work recorded from now on to the given pass.
+  void SetPass(GPUTimingPass pass)
+  {
+    if (pass != m_current_pass)
+      SwitchPass(pass);
+  }
+
+  // Called once per frame, before presenting. Finishes the current frame's queries, picks up
+  // results for frames the GPU has completed, and starts recording the next frame.
+  void EndFrame();
+
+  // The number of frames ended so far, which identifies the frame being recorded.
+  u64 GetFrameNumber() const { return m_frame_number; }
+
+  bool HasResults() const { return m_has_results; }
+  double GetPassTime(GPUTimingPass pass) const
+  {
+    return m_pass_times_ms[static_cast<u32>(pass)];
+  }
+
+  static const char* GetPassName(GPUTimingPass pass);
+
+protected:
+  static constexpr u32 NUM_FRAMES = 4;
+  static constexpr u32 MAX_SEGMENTS_PER_FRAME = 256;
+  // Each frame has an extra query to end its last segment.
+  static constexpr u32 QUERIES_PER_FRAME = MAX_SEGMENTS_PER_FRAME + 1;
+  static constexpr u32 NUM_QUERIES = NUM_FRAMES * QUERIES_PER_FRAME;
+
+  // Prepares count queries starting at first to be recorded again. Called outside of render passes.
+  virtual void ResetQueries(u32 first, u32 count) {}
+
+  // Starts timing a segment with the given query, ending the segment which was active before.
+  virtual void BeginSegment(u32 query) {}
+
+  // Ends the active segment. query is the one after the last segment's.
+  virtual void EndSegment(u32 query) {}
+
+  // Writes the GPU time in nanoseconds of each of count segments starting at first, or returns
+  // false if the GPU hasn't finished with them yet.
+  virtual bool GetSegmentTimes(u32 first, u32 count, u64* times_ns) { return false; }
+
+private:
+  struct Frame
+  {
+    std::array<GPUTimingPass, MAX_SEGMENTS_PER_FRAME> passes;
+    u64 number = 0;
+    u32 num_segments = 0;
+    bool pending = false;
+  };
+
+  void SwitchPass(GPUTimingPass pass);
+  void StartSegment();
+  void ReadResults();
+  void LogPassTimesToFile(const std::array<double, static_cast<u32>(GPUTimingPass::Count)>& times);
+
+  std::array<Frame, NUM_FRAMES> m_frames;
+  u32 m_current_frame = 0;
+  u64 m_frame_number = 0;
+  bool m_recording = false;
+  GPUTimingPass m_current_pass = GPUTimingPass::EFBDraw;
+
+  // Smoothed per-pass times in milliseconds.
+  std::array<double, static_cast<u32>(GPUTimingPass::Count)> m_pass_times_ms{};
+  bool m_has_results = false;
+
+  std::ofstream m_log_file;
+};
+
+extern std::unique_ptr<GPUTimingQueryBase> g_gpu_timing_query;
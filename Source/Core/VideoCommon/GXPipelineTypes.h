@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -67,6 +71,53 @@ struct GXUberPipelineUid
   bool operator!=(const GXUberPipelineUid& rhs) const { return !operator==(rhs); }
 };
 
+// Hash of a GXPipelineUid, used to look up recently used pipelines. The shader UIDs make up most of
+// a pipeline UID, so their hashes are kept and only recalculated when that shader UID changes.
+class GXPipelineUidHash
+{
+public:
+  void SetVertexShaderUid(const VertexShaderUid& uid) { m_vs_hash = HashShaderUid(uid); }
+  void SetGeometryShaderUid(const GeometryShaderUid& uid) { m_gs_hash = HashShaderUid(uid); }
+  void SetPixelShaderUid(const PixelShaderUid& uid) { m_ps_hash = HashShaderUid(uid); }
+
+  // The shader UIDs in uid must be the ones last passed to the setters.
+  u64 Get(const GXPipelineUid& uid) const
+  {
+    u64 hash = Combine(m_vs_hash, m_gs_hash);
+    hash = Combine(hash, m_ps_hash);
+    hash = Combine(hash, reinterpret_cast<std::uintptr_t>(uid.vertex_format));
+    hash = Combine(hash, uid.rasterization_state.hex);
+    hash = Combine(hash, uid.depth_state.hex);
+    return Combine(hash, uid.blending_state.hex);
+  }
+
+  static u64 Calculate(const GXPipelineUid& uid)
+  {
+    GXPipelineUidHash hash;
+    hash.SetVertexShaderUid(uid.vs_uid);
+    hash.SetGeometryShaderUid(uid.gs_uid);
+    hash.SetPixelShaderUid(uid.ps_uid);
+    return hash.Get(uid);
+  }
+
+private:
+  template <typename T>
+  static u64 HashShaderUid(const T& uid)
+  {
+    return Common::GetHash64(uid.GetUidDataRaw(), static_cast<u32>(uid.GetUidDataSize()), 0);
+  }
+
+  static constexpr u64 Combine(u64 hash, u64 value)
+  {
+    // The top bits pick the slot in the recent pipelines, so mix everything up into those.
+    return (hash ^ value) * 0x9E3779B97F4A7C15ULL;
+  }
+
+  u64 m_vs_hash = 0;
+  u64 m_gs_hash = 0;
+  u64 m_ps_hash = 0;
+};
+
 // Disk cache of pipeline UIDs. We can't use the whole UID as a type as it contains pointers.
 // This structure is safe to save to disk, and should be compiler/platform independent.
 #pragma pack(push, 1)
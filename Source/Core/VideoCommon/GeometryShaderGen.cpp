@@ -31,7 +31,10 @@ constexpr Common::EnumMap<u32, PrimitiveType::TriangleStrip> vertex_out_map{4u,
 
 bool geometry_shader_uid_data::IsPassthrough() const
 {
-  const bool stereo = g_ActiveConfig.stereo_mode != StereoMode::Off;
+  // With multiview, the vertex shader offsets each eye, and the primitive is rendered to both
+  // layers without being duplicated.
+  const bool stereo =
+      g_ActiveConfig.stereo_mode != StereoMode::Off && !g_ActiveConfig.UseMultiviewStereo();
   const bool wireframe = g_ActiveConfig.bWireFrame;
   return primitive_type >= static_cast<u32>(PrimitiveType::Triangles) && !stereo && !wireframe;
 }
@@ -63,7 +66,7 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
   const bool wireframe = host_config.wireframe;
   const bool msaa = host_config.msaa;
   const bool ssaa = host_config.ssaa;
-  const bool stereo = host_config.stereo;
+  const bool stereo = host_config.stereo && !host_config.backend_multiview;
   const auto primitive_type = static_cast<PrimitiveType>(uid_data->primitive_type);
   const u32 vertex_in = vertex_in_map[primitive_type];
   u32 vertex_out = vertex_out_map[primitive_type];
@@ -230,17 +233,7 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
   }
 
   if (stereo)
-  {
-    // For stereoscopy add a small horizontal offset in Normalized Device Coordinates proportional
-    // to the depth of the vertex. We retrieve the depth value from the w-component of the projected
-    // vertex which contains the negated z-component of the original vertex.
-    // For negative parallax (out-of-screen effects) we subtract a convergence value from
-    // the depth value. This results in objects at a distance smaller than the convergence
-    // distance to seemingly appear in front of the screen.
-    // This formula is based on page 13 of the "Nvidia 3D Vision Automatic, Best Practices Guide"
-    out.Write("\tfloat hoffset = (eye == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS ".y;\n");
-    out.Write("\tf.pos.x += hoffset * (f.pos.w - " I_STEREOPARAMS ".z);\n");
-  }
+    GenerateStereoOffset(out, "\t", "f.pos", "eye");
 
   if (primitive_type == PrimitiveType::Lines)
   {
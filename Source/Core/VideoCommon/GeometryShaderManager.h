@@ -25,6 +25,7 @@ public:
 
   GeometryShaderConstants constants{};
   bool dirty = false;
+  UploadedConstants<GeometryShaderConstants> uploaded_constants;
 
 private:
   void SetVSExpand(VSExpand expand);
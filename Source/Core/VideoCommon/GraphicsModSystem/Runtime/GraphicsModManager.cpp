@@ -3,8 +3,11 @@
 
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 
+#include <algorithm>
+#include <functional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 
 #include "Common/Logging/Log.h"
@@ -26,58 +29,147 @@ std::unique_ptr<GraphicsModManager> g_graphics_mod_manager;
 class GraphicsModManager::DecoratedAction final : public GraphicsModAction
 {
 public:
-  DecoratedAction(std::unique_ptr<GraphicsModAction> action, GraphicsModConfig mod)
-      : m_action_impl(std::move(action)), m_mod(std::move(mod))
+  DecoratedAction(std::unique_ptr<GraphicsModAction> action, GraphicsModConfig mod,
+                  std::string_view action_name)
+      : m_action_impl(std::move(action)), m_mod(std::move(mod)),
+        m_name(fmt::format("{}: {}", m_mod.m_title, action_name))
   {
   }
   void OnDrawStarted(GraphicsModActionData::DrawStarted* draw_started) override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnDrawStarted(draw_started);
+    Timed([&] { m_action_impl->OnDrawStarted(draw_started); });
   }
   void OnEFB(GraphicsModActionData::EFB* efb) override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnEFB(efb);
+    Timed([&] { m_action_impl->OnEFB(efb); });
+  }
+  void OnXFB() override
+  {
+    if (!m_mod.m_enabled)
+      return;
+    Timed([&] { m_action_impl->OnXFB(); });
   }
   void OnProjection(GraphicsModActionData::Projection* projection) override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnProjection(projection);
+    Timed([&] { m_action_impl->OnProjection(projection); });
   }
   void OnProjectionAndTexture(GraphicsModActionData::Projection* projection) override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnProjectionAndTexture(projection);
+    Timed([&] { m_action_impl->OnProjectionAndTexture(projection); });
   }
   void OnTextureLoad(GraphicsModActionData::TextureLoad* texture_load) override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnTextureLoad(texture_load);
+    Timed([&] { m_action_impl->OnTextureLoad(texture_load); });
   }
   void OnTextureCreate(GraphicsModActionData::TextureCreate* texture_create) override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnTextureCreate(texture_create);
+    Timed([&] { m_action_impl->OnTextureCreate(texture_create); });
   }
   void OnFrameEnd() override
   {
     if (!m_mod.m_enabled)
       return;
-    m_action_impl->OnFrameEnd();
+    Timed([&] { m_action_impl->OnFrameEnd(); });
+
+    m_last_frame_calls = std::exchange(m_calls, 0);
+    m_last_frame_time = std::exchange(m_time, Clock::duration::zero());
+  }
+
+  ActionTiming GetLastFrameTiming() const
+  {
+    return {m_name, m_last_frame_calls, m_last_frame_time};
   }
 
 private:
+  template <typename F>
+  void Timed(F&& f)
+  {
+    if (!g_ActiveConfig.bOverlayStats)
+    {
+      f();
+      return;
+    }
+
+    const Clock::time_point start = Clock::now();
+    f();
+    m_time += Clock::now() - start;
+    m_calls++;
+  }
+
   std::unique_ptr<GraphicsModAction> m_action_impl;
   GraphicsModConfig m_mod;
+  std::string m_name;
+
+  u32 m_calls = 0;
+  Clock::duration m_time{};
+  u32 m_last_frame_calls = 0;
+  Clock::duration m_last_frame_time{};
 };
 
+void GraphicsModManager::TargetIndex::Add(std::string_view name, GraphicsModAction* action)
+{
+  auto it = m_pending.find(name);
+  if (it == m_pending.end())
+    it = m_pending.emplace(std::string(name), std::vector<GraphicsModAction*>{}).first;
+  it->second.push_back(action);
+}
+
+void GraphicsModManager::TargetIndex::Compile()
+{
+  m_entries.clear();
+  m_actions.clear();
+  m_entries.reserve(m_pending.size());
+  for (auto& [name, actions] : m_pending)
+  {
+    m_entries.push_back({std::hash<std::string_view>{}(name), name,
+                         static_cast<u32>(m_actions.size()), static_cast<u32>(actions.size())});
+    m_actions.insert(m_actions.end(), actions.begin(), actions.end());
+  }
+  m_pending.clear();
+
+  std::sort(m_entries.begin(), m_entries.end(),
+            [](const Entry& a, const Entry& b) { return a.hash < b.hash; });
+}
+
+void GraphicsModManager::TargetIndex::Clear()
+{
+  m_pending.clear();
+  m_entries.clear();
+  m_actions.clear();
+}
+
+GraphicsModManager::ActionList GraphicsModManager::TargetIndex::Find(std::string_view name) const
+{
+  if (m_entries.empty())
+    return {};
+
+  const size_t hash = std::hash<std::string_view>{}(name);
+  auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash,
+                             [](const Entry& entry, size_t value) { return entry.hash < value; });
+  for (; it != m_entries.end() && it->hash == hash; ++it)
+  {
+    if (it->name == name)
+      return ActionList(m_actions).subspan(it->first_action, it->num_actions);
+  }
+
+  return {};
+}
+
+GraphicsModManager::GraphicsModManager() = default;
+GraphicsModManager::~GraphicsModManager() = default;
+
 bool GraphicsModManager::Initialize()
 {
   if (g_ActiveConfig.bGraphicMods)
@@ -102,86 +194,72 @@ bool GraphicsModManager::Initialize()
   return true;
 }
 
-const std::vector<GraphicsModAction*>&
+GraphicsModManager::ActionList
 GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
 {
-  if (const auto it = m_projection_target_to_actions.find(projection_type);
-      it != m_projection_target_to_actions.end())
-  {
-    return it->second;
-  }
+  const auto index = static_cast<size_t>(projection_type);
+  if (index >= NUM_PROJECTION_TYPES)
+    return {};
 
-  return m_default;
+  return m_projection_target_to_actions[index];
 }
 
-const std::vector<GraphicsModAction*>&
+GraphicsModManager::ActionList
 GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
-                                                const std::string& texture_name) const
+                                                std::string_view texture_name) const
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
-  if (const auto it = m_projection_texture_target_to_actions.find(lookup);
-      it != m_projection_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  const auto index = static_cast<size_t>(projection_type);
+  if (index >= NUM_PROJECTION_TYPES)
+    return {};
 
-  return m_default;
+  return m_projection_texture_target_to_actions[index].Find(texture_name);
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
+GraphicsModManager::ActionList
+GraphicsModManager::GetDrawStartedActions(std::string_view texture_name) const
 {
-  if (const auto it = m_draw_started_target_to_actions.find(texture_name);
-      it != m_draw_started_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return m_draw_started_target_to_actions.Find(texture_name);
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
+GraphicsModManager::ActionList
+GraphicsModManager::GetTextureLoadActions(std::string_view texture_name) const
 {
-  if (const auto it = m_load_texture_target_to_actions.find(texture_name);
-      it != m_load_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return m_load_texture_target_to_actions.Find(texture_name);
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
+GraphicsModManager::ActionList
+GraphicsModManager::GetTextureCreateActions(std::string_view texture_name) const
 {
-  if (const auto it = m_create_texture_target_to_actions.find(texture_name);
-      it != m_create_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return m_create_texture_target_to_actions.Find(texture_name);
 }
 
-const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const FBInfo& efb) const
+GraphicsModManager::ActionList GraphicsModManager::GetEFBActions(const FBInfo& efb) const
 {
   if (const auto it = m_efb_target_to_actions.find(efb); it != m_efb_target_to_actions.end())
   {
     return it->second;
   }
 
-  return m_default;
+  return {};
 }
 
-const std::vector<GraphicsModAction*>& GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
+GraphicsModManager::ActionList GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(xfb); it != m_efb_target_to_actions.end())
+  if (const auto it = m_xfb_target_to_actions.find(xfb); it != m_xfb_target_to_actions.end())
   {
     return it->second;
   }
 
-  return m_default;
+  return {};
+}
+
+std::vector<GraphicsModManager::ActionTiming> GraphicsModManager::GetActionTimings() const
+{
+  std::vector<ActionTiming> timings;
+  timings.reserve(m_actions.size());
+  for (const auto& action : m_actions)
+    timings.push_back(action->GetLastFrameTiming());
+  return timings;
 }
 
 void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
@@ -245,14 +323,15 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
       const auto create_action =
           [filesystem_library](const std::string_view& action_name,
                                const picojson::value& json_data,
-                               GraphicsModConfig mod_config) -> std::unique_ptr<GraphicsModAction> {
+                               GraphicsModConfig mod_config) -> std::unique_ptr<DecoratedAction> {
         auto action =
             GraphicsModActionFactory::Create(action_name, json_data, std::move(filesystem_library));
         if (action == nullptr)
         {
           return nullptr;
         }
-        return std::make_unique<DecoratedAction>(std::move(action), std::move(mod_config));
+        return std::make_unique<DecoratedAction>(std::move(action), std::move(mod_config),
+                                                 action_name);
       };
 
       const auto internal_group = fmt::format("{}.{}", mod.m_title, feature.m_group);
@@ -261,16 +340,16 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
         std::visit(
             overloaded{
                 [&](const DrawStartedTextureTarget& the_target) {
-                  m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  m_draw_started_target_to_actions.Add(the_target.m_texture_info_string,
+                                                       m_actions.back().get());
                 },
                 [&](const LoadTextureTarget& the_target) {
-                  m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  m_load_texture_target_to_actions.Add(the_target.m_texture_info_string,
+                                                       m_actions.back().get());
                 },
                 [&](const CreateTextureTarget& the_target) {
-                  m_create_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  m_create_texture_target_to_actions.Add(the_target.m_texture_info_string,
+                                                         m_actions.back().get());
                 },
                 [&](const EFBTarget& the_target) {
                   FBInfo info;
@@ -287,17 +366,18 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                   m_xfb_target_to_actions[info].push_back(m_actions.back().get());
                 },
                 [&](const ProjectionTarget& the_target) {
+                  const auto index = static_cast<size_t>(the_target.m_projection_type);
+                  if (index >= NUM_PROJECTION_TYPES)
+                    return;
+
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
-                    m_projection_texture_target_to_actions[lookup].push_back(
-                        m_actions.back().get());
+                    m_projection_texture_target_to_actions[index].Add(
+                        *the_target.m_texture_info_string, m_actions.back().get());
                   }
                   else
                   {
-                    m_projection_target_to_actions[the_target.m_projection_type].push_back(
-                        m_actions.back().get());
+                    m_projection_target_to_actions[index].push_back(m_actions.back().get());
                   }
                 },
             },
@@ -346,6 +426,12 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
       }
     }
   }
+
+  for (TargetIndex& index : m_projection_texture_target_to_actions)
+    index.Compile();
+  m_draw_started_target_to_actions.Compile();
+  m_load_texture_target_to_actions.Compile();
+  m_create_texture_target_to_actions.Compile();
 }
 
 void GraphicsModManager::EndOfFrame()
@@ -360,11 +446,13 @@ void GraphicsModManager::Reset()
 {
   m_actions.clear();
   m_groups.clear();
-  m_projection_target_to_actions.clear();
-  m_projection_texture_target_to_actions.clear();
-  m_draw_started_target_to_actions.clear();
-  m_load_texture_target_to_actions.clear();
-  m_create_texture_target_to_actions.clear();
+  for (auto& actions : m_projection_target_to_actions)
+    actions.clear();
+  for (TargetIndex& index : m_projection_texture_target_to_actions)
+    index.Clear();
+  m_draw_started_target_to_actions.Clear();
+  m_load_texture_target_to_actions.Clear();
+  m_create_texture_target_to_actions.Clear();
   m_efb_target_to_actions.clear();
   m_xfb_target_to_actions.clear();
 }
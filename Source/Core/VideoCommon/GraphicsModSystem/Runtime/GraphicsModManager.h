@@ -3,13 +3,18 @@
 
 #pragma once
 
+#include <array>
 #include <list>
+#include <map>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
 #include "VideoCommon/TextureInfo.h"
@@ -20,20 +25,34 @@ class GraphicsModGroupConfig;
 class GraphicsModManager
 {
 public:
+  using ActionList = std::span<GraphicsModAction* const>;
+
+  // Time spent in one action during the last frame, for the statistics overlay.
+  struct ActionTiming
+  {
+    std::string_view name;
+    u32 num_calls;
+    Clock::duration time;
+  };
+
+  GraphicsModManager();
+  ~GraphicsModManager();
+
   bool Initialize();
 
-  const std::vector<GraphicsModAction*>& GetProjectionActions(ProjectionType projection_type) const;
-  const std::vector<GraphicsModAction*>&
-  GetProjectionTextureActions(ProjectionType projection_type,
-                              const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetDrawStartedActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureLoadActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureCreateActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>& GetEFBActions(const FBInfo& efb) const;
-  const std::vector<GraphicsModAction*>& GetXFBActions(const FBInfo& xfb) const;
+  ActionList GetProjectionActions(ProjectionType projection_type) const;
+  ActionList GetProjectionTextureActions(ProjectionType projection_type,
+                                         std::string_view texture_name) const;
+  ActionList GetDrawStartedActions(std::string_view texture_name) const;
+  ActionList GetTextureLoadActions(std::string_view texture_name) const;
+  ActionList GetTextureCreateActions(std::string_view texture_name) const;
+  ActionList GetEFBActions(const FBInfo& efb) const;
+  ActionList GetXFBActions(const FBInfo& xfb) const;
+
+  bool HasDrawStartedActions() const { return !m_draw_started_target_to_actions.IsEmpty(); }
+
+  // Only recorded while the statistics overlay is shown.
+  std::vector<ActionTiming> GetActionTimings() const;
 
   void Load(const GraphicsModGroupConfig& config);
 
@@ -43,16 +62,42 @@ private:
 
   class DecoratedAction;
 
-  static inline const std::vector<GraphicsModAction*> m_default = {};
-  std::list<std::unique_ptr<GraphicsModAction>> m_actions;
-  std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
+  // Maps texture names to the actions targeting them. Targets are added while mods are loaded,
+  // then compiled into a flat array sorted by the hash of the name, which is cheaper to search
+  // for every draw than a node based map.
+  class TargetIndex
+  {
+  public:
+    void Add(std::string_view name, GraphicsModAction* action);
+    void Compile();
+    void Clear();
+
+    bool IsEmpty() const { return m_entries.empty(); }
+    ActionList Find(std::string_view name) const;
+
+  private:
+    struct Entry
+    {
+      size_t hash;
+      std::string name;
+      u32 first_action;
+      u32 num_actions;
+    };
+
+    std::map<std::string, std::vector<GraphicsModAction*>, std::less<>> m_pending;
+    std::vector<Entry> m_entries;
+    std::vector<GraphicsModAction*> m_actions;
+  };
+
+  static constexpr size_t NUM_PROJECTION_TYPES = 2;
+
+  std::list<std::unique_ptr<DecoratedAction>> m_actions;
+  std::array<std::vector<GraphicsModAction*>, NUM_PROJECTION_TYPES>
       m_projection_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_projection_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_create_texture_target_to_actions;
+  std::array<TargetIndex, NUM_PROJECTION_TYPES> m_projection_texture_target_to_actions;
+  TargetIndex m_draw_started_target_to_actions;
+  TargetIndex m_load_texture_target_to_actions;
+  TargetIndex m_create_texture_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
 
@@ -27,6 +27,7 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -36,6 +37,9 @@ static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_te
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+// Textures which come from a texture pack file rather than from loose files
+static std::unordered_map<std::string, std::shared_ptr<VideoCommon::TexturePackAssetLibrary>>
+    s_hires_texture_id_to_pack;
 
 namespace
 {
@@ -75,6 +79,48 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 
   return {"", false};
 }
+
+std::shared_ptr<VideoCommon::CustomAssetLibrary> GetLibrary(const std::string& texture_name)
+{
+  if (auto iter = s_hires_texture_id_to_pack.find(texture_name);
+      iter != s_hires_texture_id_to_pack.end())
+  {
+    return iter->second;
+  }
+  return s_file_library;
+}
+
+void LoadTexturePacks(const std::set<std::string>& texture_directories)
+{
+  // Loose files take priority over the texture packs, so that packs can be patched. The textures
+  // in a pack are not preloaded even when caching, since they stay mapped anyway.
+  const std::vector<std::string> extensions{std::string(VideoCommon::TexturePackFile::EXTENSION)};
+  const std::vector<std::string> directories(texture_directories.begin(),
+                                             texture_directories.end());
+  const auto pack_paths = Common::DoFileSearch(directories, extensions, /*recursive*/ true);
+  for (const auto& path : pack_paths)
+  {
+    auto pack = std::make_shared<VideoCommon::TexturePackAssetLibrary>();
+    if (!pack->Open(path))
+      continue;
+
+    size_t num_overridden = 0;
+    pack->ForEachTexture([&](std::string_view name, bool has_arbitrary_mipmaps) {
+      const auto [it, inserted] =
+          s_hires_texture_id_to_arbmipmap.try_emplace(std::string(name), has_arbitrary_mipmaps);
+      if (inserted)
+        s_hires_texture_id_to_pack.try_emplace(it->first, pack);
+      else
+        num_overridden++;
+    });
+
+    if (num_overridden != 0)
+    {
+      INFO_LOG_FMT(VIDEO, "{} textures in texture pack '{}' were already inserted", num_overridden,
+                   path);
+    }
+  }
+}
 }  // namespace
 
 void HiresTexture::Init()
@@ -151,6 +197,8 @@ void HiresTexture::Update()
     }
   }
 
+  LoadTexturePacks(texture_directories);
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
@@ -167,6 +215,7 @@ void HiresTexture::Clear()
 {
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
+  s_hires_texture_id_to_pack.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 }
 
@@ -185,7 +234,7 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
     auto& system = Core::System::GetInstance();
     auto hires_texture = std::make_shared<HiresTexture>(
         has_arb_mipmaps,
-        system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library));
+        system.GetCustomAssetLoader().LoadGameTexture(base_filename, GetLibrary(base_filename)));
     if (g_ActiveConfig.bCacheHiresTextures)
     {
       s_hires_texture_cache.try_emplace(base_filename, hires_texture);
@@ -7,6 +7,20 @@
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#else
+#define NO_SIMD
+#endif
+
+#if defined(USE_SSE)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -16,6 +30,140 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Every primitive type expands into indices that repeat with a fixed stride, so most of the
+// index buffer can be written as whole vectors of a precomputed pattern. Index l of block b is
+// start[l] + b * step[l], or the primitive restart index when restart[l] is set.
+template <size_t N>
+struct IndexPattern
+{
+  static_assert(N % 8 == 0, "Patterns must fill whole 8 x u16 vectors");
+  static constexpr size_t num_indices = N;
+
+  u32 prims;
+  std::array<u16, N> start;
+  std::array<u16, N> step;
+  std::array<u16, N> restart;
+};
+
+// Values for MakePattern's offsets. PATTERN_FIXED marks an offset from the first vertex of the
+// draw rather than of the primitive (used for fan centers).
+constexpr s32 PATTERN_FIXED = 0x10000;
+constexpr s32 PATTERN_RESTART = -1;
+
+// Builds the pattern for PRIMS primitives. offsets are the indices of one primitive relative to
+// its first vertex, and stride is how far that first vertex moves for the next primitive.
+template <u32 PRIMS, size_t PER_PRIM>
+constexpr IndexPattern<PRIMS * PER_PRIM> MakePattern(const std::array<s32, PER_PRIM>& offsets,
+                                                     u16 stride)
+{
+  IndexPattern<PRIMS * PER_PRIM> pattern{PRIMS, {}, {}, {}};
+  for (u32 prim = 0; prim < PRIMS; ++prim)
+  {
+    for (size_t i = 0; i < PER_PRIM; ++i)
+    {
+      const size_t lane = prim * PER_PRIM + i;
+      const s32 offset = offsets[i];
+      if (offset == PATTERN_RESTART)
+      {
+        pattern.restart[lane] = s_primitive_restart;
+      }
+      else if (offset & PATTERN_FIXED)
+      {
+        pattern.start[lane] = static_cast<u16>(offset & ~PATTERN_FIXED);
+      }
+      else
+      {
+        pattern.start[lane] = static_cast<u16>(offset + prim * stride);
+        pattern.step[lane] = static_cast<u16>(PRIMS * stride);
+      }
+    }
+  }
+  return pattern;
+}
+
+// Writes as many whole blocks of pattern as fit in num_prims primitives, with first added to every
+// non-restart index. Returns the number of primitives written; the caller finishes the rest.
+template <size_t N>
+u32 WritePattern(u16*& index_ptr, const IndexPattern<N>& pattern, u32 num_prims, u32 first)
+{
+  constexpr size_t VECTORS = N / 8;
+  const u32 blocks = num_prims / pattern.prims;
+  if (blocks == 0)
+    return 0;
+
+#if defined(USE_SSE)
+  __m128i value[VECTORS], step[VECTORS], restart[VECTORS];
+  const __m128i first_vec = _mm_set1_epi16(static_cast<s16>(first));
+  for (size_t i = 0; i < VECTORS; ++i)
+  {
+    value[i] = _mm_add_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.start[i * 8])), first_vec);
+    step[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.step[i * 8]));
+    restart[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.restart[i * 8]));
+  }
+  for (u32 block = 0; block < blocks; ++block)
+  {
+    for (size_t i = 0; i < VECTORS; ++i)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr + i * 8),
+                       _mm_or_si128(value[i], restart[i]));
+      value[i] = _mm_add_epi16(value[i], step[i]);
+    }
+    index_ptr += N;
+  }
+#elif defined(USE_NEON)
+  uint16x8_t value[VECTORS], step[VECTORS], restart[VECTORS];
+  const uint16x8_t first_vec = vdupq_n_u16(static_cast<u16>(first));
+  for (size_t i = 0; i < VECTORS; ++i)
+  {
+    value[i] = vaddq_u16(vld1q_u16(&pattern.start[i * 8]), first_vec);
+    step[i] = vld1q_u16(&pattern.step[i * 8]);
+    restart[i] = vld1q_u16(&pattern.restart[i * 8]);
+  }
+  for (u32 block = 0; block < blocks; ++block)
+  {
+    for (size_t i = 0; i < VECTORS; ++i)
+    {
+      vst1q_u16(index_ptr + i * 8, vorrq_u16(value[i], restart[i]));
+      value[i] = vaddq_u16(value[i], step[i]);
+    }
+    index_ptr += N;
+  }
+#else
+  for (u32 block = 0; block < blocks; ++block)
+  {
+    for (size_t i = 0; i < N; ++i)
+    {
+      const u16 value = static_cast<u16>(first + pattern.start[i] + block * pattern.step[i]);
+      index_ptr[i] = value | pattern.restart[i];
+    }
+    index_ptr += N;
+  }
+#endif
+
+  return blocks * pattern.prims;
+}
+
+constexpr auto s_list_pattern = MakePattern<8, 3>({0, 1, 2}, 3);
+constexpr auto s_list_pr_pattern = MakePattern<2, 4>({0, 1, 2, PATTERN_RESTART}, 3);
+constexpr auto s_sequential_pattern = MakePattern<8, 1>({0}, 1);
+// Two triangles, as every other one has its winding flipped.
+constexpr auto s_strip_pattern = MakePattern<4, 6>({0, 1, 2, 1, 3, 2}, 2);
+constexpr auto s_fan_pattern = MakePattern<8, 3>({PATTERN_FIXED | 0, 1, 2}, 1);
+constexpr auto s_fan_pr_pattern =
+    MakePattern<4, 6>({1, 2, PATTERN_FIXED | 0, 3, 4, PATTERN_RESTART}, 3);
+constexpr auto s_quads_pattern = MakePattern<4, 6>({0, 1, 2, 0, 2, 3}, 4);
+constexpr auto s_quads_pr_pattern = MakePattern<8, 5>({1, 2, 0, 3, PATTERN_RESTART}, 4);
+constexpr auto s_line_list_pattern = MakePattern<4, 2>({0, 1}, 2);
+constexpr auto s_line_strip_pattern = MakePattern<4, 2>({0, 1}, 1);
+// VS expanded lines and points use (index << 2), see AddLines_VSExpand and AddPoints_VSExpand.
+constexpr auto s_lines_vs_pattern = MakePattern<4, 6>({0, 1, 6, 1, 6, 7}, 8);
+constexpr auto s_lines_vs_pr_pattern = MakePattern<8, 5>({0, 1, 6, 7, PATTERN_RESTART}, 8);
+constexpr auto s_line_strip_vs_pattern = MakePattern<4, 6>({0, 1, 6, 1, 6, 7}, 4);
+constexpr auto s_line_strip_vs_pr_pattern = MakePattern<8, 5>({0, 1, 6, 7, PATTERN_RESTART}, 4);
+constexpr auto s_points_vs_pattern = MakePattern<4, 6>({0, 1, 2, 1, 2, 3}, 4);
+constexpr auto s_points_vs_pr_pattern = MakePattern<8, 5>({0, 1, 2, 3, PATTERN_RESTART}, 4);
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -30,7 +178,9 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  const u32 written = pr ? WritePattern(index_ptr, s_list_pr_pattern, num_verts / 3, index) :
+                           WritePattern(index_ptr, s_list_pattern, num_verts / 3, index);
+  for (u32 i = written * 3 + 2; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,7 +192,8 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 written = WritePattern(index_ptr, s_sequential_pattern, num_verts, index);
+    for (u32 i = written; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -50,8 +201,11 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // Whole pairs of triangles leave the winding where it started.
+    const u32 written =
+        num_verts > 2 ? WritePattern(index_ptr, s_strip_pattern, (num_verts - 2) / 2, index) : 0;
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = written * 2 + 2; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -87,6 +241,9 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    if (num_verts > 2)
+      i += WritePattern(index_ptr, s_fan_pr_pattern, (num_verts - 2) / 3, index) * 3;
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -106,6 +263,11 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else
+  {
+    if (num_verts > 2)
+      i += WritePattern(index_ptr, s_fan_pattern, num_verts - 2, index);
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -134,7 +296,9 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
+  const u32 written = pr ? WritePattern(index_ptr, s_quads_pr_pattern, num_verts / 4, index) :
+                           WritePattern(index_ptr, s_quads_pattern, num_verts / 4, index);
+  u32 i = 3 + written * 4;
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -170,7 +334,8 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
+  const u32 written = WritePattern(index_ptr, s_line_list_pattern, num_verts / 2, index);
+  for (u32 i = written * 2 + 1; i < num_verts; i += 2)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -182,7 +347,9 @@ u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 // so converting them to lists
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  const u32 written =
+      num_verts > 1 ? WritePattern(index_ptr, s_line_strip_pattern, num_verts - 1, index) : 0;
+  for (u32 i = written + 1; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -198,7 +365,19 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
   // Bit 1 indicates which point of the line (top/bottom for a vertical line)
   // VS Expand assumes the two points will be adjacent vertices
   constexpr u32 advance = linestrip ? 1 : 2;
-  for (u32 i = 1; i < num_verts; i += advance)
+  const u32 num_lines = linestrip ? (num_verts > 1 ? num_verts - 1 : 0) : num_verts / 2;
+  u32 written;
+  if constexpr (linestrip)
+  {
+    written = pr ? WritePattern(index_ptr, s_line_strip_vs_pr_pattern, num_lines, index << 2) :
+                   WritePattern(index_ptr, s_line_strip_vs_pattern, num_lines, index << 2);
+  }
+  else
+  {
+    written = pr ? WritePattern(index_ptr, s_lines_vs_pr_pattern, num_lines, index << 2) :
+                   WritePattern(index_ptr, s_lines_vs_pattern, num_lines, index << 2);
+  }
+  for (u32 i = written * advance + 1; i < num_verts; i += advance)
   {
     u32 p0 = (index + i - 1) << 2;
     u32 p1 = (index + i - 0) << 2;
@@ -225,7 +404,8 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  const u32 written = WritePattern(index_ptr, s_sequential_pattern, num_verts, index);
+  for (u32 i = written; i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
@@ -237,7 +417,9 @@ u16* AddPoints_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 {
   // VS Expand uses (index >> 2) as the base vertex
   // Bottom two bits indicate which of (TL, TR, BL, BR) this is
-  for (u32 i = 0; i < num_verts; ++i)
+  const u32 written = pr ? WritePattern(index_ptr, s_points_vs_pr_pattern, num_verts, index << 2) :
+                           WritePattern(index_ptr, s_points_vs_pattern, num_verts, index << 2);
+  for (u32 i = written; i < num_verts; ++i)
   {
     u32 base = (index + i) << 2;
     if constexpr (pr)
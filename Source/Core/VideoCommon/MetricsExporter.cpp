@@ -0,0 +1,175 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/MetricsExporter.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/DVD/DVDThread.h"
+#include "Core/System.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+MetricsExporter g_metrics_exporter;
+
+void MetricsExporter::Start(std::string path, DT interval)
+{
+  m_path = std::move(path);
+  m_interval = interval;
+  m_next_export_time = Clock::now() + interval;
+  m_totals = {};
+  m_last_shaders_created = 0;
+
+  m_write_thread.Reset("Metrics Exporter",
+                       [this](const Snapshot& snapshot) { WriteSnapshot(snapshot); });
+  m_present_hook =
+      AfterPresentEvent::Register([this](const PresentInfo&) { OnPresent(); }, "MetricsExporter");
+}
+
+void MetricsExporter::Stop()
+{
+  m_present_hook.reset();
+  m_write_thread.Shutdown();
+}
+
+void MetricsExporter::OnPresent()
+{
+  const Statistics::ThisFrame& frame = g_stats.this_frame;
+  m_totals.frames++;
+  m_totals.draw_calls += frame.num_draw_calls;
+  m_totals.primitives += frame.num_prims + frame.num_dl_prims;
+  m_totals.stream_buffer_stalls += frame.num_stream_buffer_stalls;
+  m_totals.stream_buffer_stall_us += frame.stream_buffer_stall_us;
+  m_totals.bbox_stalls += frame.num_bbox_stalls;
+  m_totals.bbox_stall_us += frame.bbox_stall_us;
+  m_totals.efb_peek_stalls += frame.num_efb_peek_stalls;
+  m_totals.efb_peek_stall_us += frame.efb_peek_stall_us;
+
+  // The shader cache resets its counters when it's reloaded.
+  const int shaders_created =
+      g_stats.num_pixel_shaders_created + g_stats.num_vertex_shaders_created;
+  m_totals.shaders_compiled += std::max(shaders_created - m_last_shaders_created, 0);
+  m_last_shaders_created = shaders_created;
+
+  const TimePoint now = Clock::now();
+  if (now < m_next_export_time)
+    return;
+
+  // Don't try to catch up on intervals missed while emulation was paused.
+  m_next_export_time = std::max(m_next_export_time + m_interval, now);
+  m_write_thread.Push(TakeSnapshot());
+}
+
+MetricsExporter::Snapshot MetricsExporter::TakeSnapshot() const
+{
+  Snapshot snapshot = m_totals;
+  snapshot.fps = g_perf_metrics.GetFPS();
+  snapshot.vps = g_perf_metrics.GetVPS();
+  snapshot.speed = g_perf_metrics.GetSpeed();
+  snapshot.max_speed = g_perf_metrics.GetMaxSpeed();
+  snapshot.present_latency_avg_ms = DT_ms(g_perf_metrics.GetPresentLatencyAvg()).count();
+  snapshot.present_latency_max_ms = DT_ms(g_perf_metrics.GetPresentLatencyMax()).count();
+  snapshot.audio_buffered_latency_ms = DT_ms(g_perf_metrics.GetAudioBufferedLatency()).count();
+  snapshot.audio_resample_ratio = g_perf_metrics.GetAudioResampleRatio();
+  snapshot.audio_underruns = g_perf_metrics.GetAudioUnderruns();
+
+  if (g_gpu_timing_query && g_gpu_timing_query->HasResults())
+  {
+    snapshot.has_gpu_times = true;
+    for (u32 pass = 0; pass < snapshot.gpu_pass_times_ms.size(); pass++)
+      snapshot.gpu_pass_times_ms[pass] = g_gpu_timing_query->GetPassTime(GPUTimingPass(pass));
+  }
+
+  snapshot.shaders_alive = g_stats.num_pixel_shaders_alive + g_stats.num_vertex_shaders_alive;
+  snapshot.textures_alive = g_stats.num_textures_alive;
+  snapshot.texture_memory_mib = g_stats.texture_memory_mib;
+
+  const DVD::DVDThreadStats dvd_stats = Core::System::GetInstance().GetDVDThread().GetStats();
+  snapshot.dvd_read_stalls = dvd_stats.read_stalls;
+  snapshot.dvd_read_stall_us = dvd_stats.read_stall_us;
+  return snapshot;
+}
+
+void MetricsExporter::WriteSnapshot(const Snapshot& snapshot) const
+{
+  std::string out;
+  const auto metric = [&out](std::string_view name, std::string_view type, std::string_view help,
+                             auto value) {
+    fmt::format_to(std::back_inserter(out), "# HELP dolphin_{0} {1}\n# TYPE dolphin_{0} {2}\n",
+                   name, help, type);
+    fmt::format_to(std::back_inserter(out), "dolphin_{} {}\n", name, value);
+  };
+  const auto gauge = [&metric](std::string_view name, std::string_view help, auto value) {
+    metric(name, "gauge", help, value);
+  };
+  const auto counter = [&metric](std::string_view name, std::string_view help, auto value) {
+    metric(name, "counter", help, value);
+  };
+  const auto seconds = [](u64 us) { return us / 1e6; };
+
+  gauge("fps", "Frames presented per second.", snapshot.fps);
+  gauge("vps", "VBlanks per second.", snapshot.vps);
+  gauge("speed_ratio", "Emulation speed relative to the console.", snapshot.speed);
+  gauge("max_speed_ratio", "Emulation speed possible without throttling.", snapshot.max_speed);
+  gauge("present_latency_avg_ms", "Average time from a frame being output to it being presented.",
+        snapshot.present_latency_avg_ms);
+  gauge("present_latency_max_ms", "Highest recent output to present latency.",
+        snapshot.present_latency_max_ms);
+  gauge("audio_buffered_ms", "Audio buffered in the mixer.", snapshot.audio_buffered_latency_ms);
+  gauge("audio_resample_ratio", "Factor the mixer scales the DSP sample rate by.",
+        snapshot.audio_resample_ratio);
+  counter("audio_underruns_total", "Times the audio backend ran out of samples.",
+          snapshot.audio_underruns);
+
+  if (snapshot.has_gpu_times)
+  {
+    out += "# HELP dolphin_gpu_pass_time_ms Host GPU time spent on each pass of a frame.\n"
+           "# TYPE dolphin_gpu_pass_time_ms gauge\n";
+    for (u32 pass = 0; pass < snapshot.gpu_pass_times_ms.size(); pass++)
+    {
+      fmt::format_to(std::back_inserter(out), "dolphin_gpu_pass_time_ms{{pass=\"{}\"}} {}\n",
+                     GPUTimingQueryBase::GetPassName(GPUTimingPass(pass)),
+                     snapshot.gpu_pass_times_ms[pass]);
+    }
+  }
+
+  gauge("shaders_alive", "Vertex and pixel shaders in the shader cache.", snapshot.shaders_alive);
+  gauge("textures_alive", "Textures in the texture cache.", snapshot.textures_alive);
+  gauge("texture_memory_mib", "Texture memory used by the texture cache.",
+        snapshot.texture_memory_mib);
+
+  counter("frames_total", "Frames presented.", snapshot.frames);
+  counter("draw_calls_total", "Host draw calls.", snapshot.draw_calls);
+  counter("primitives_total", "Emulated primitives drawn.", snapshot.primitives);
+  counter("shaders_compiled_total", "Vertex and pixel shaders compiled.",
+          snapshot.shaders_compiled);
+  counter("stream_buffer_stalls_total", "Times a stream buffer had to wait for the GPU.",
+          snapshot.stream_buffer_stalls);
+  counter("stream_buffer_stall_seconds_total", "Time spent waiting for stream buffers.",
+          seconds(snapshot.stream_buffer_stall_us));
+  counter("bbox_stalls_total", "Bounding box reads which waited for the GPU.",
+          snapshot.bbox_stalls);
+  counter("bbox_stall_seconds_total", "Time spent waiting for bounding box reads.",
+          seconds(snapshot.bbox_stall_us));
+  counter("efb_peek_stalls_total", "EFB peeks which waited for the GPU.",
+          snapshot.efb_peek_stalls);
+  counter("efb_peek_stall_seconds_total", "Time spent waiting for EFB peeks.",
+          seconds(snapshot.efb_peek_stall_us));
+  counter("dvd_read_stalls_total", "Disc reads the CPU thread had to wait for.",
+          snapshot.dvd_read_stalls);
+  counter("dvd_read_stall_seconds_total", "Time the CPU thread spent waiting for disc reads.",
+          seconds(snapshot.dvd_read_stall_us));
+
+  // Replace the file in one go, so that readers never see a partially written one.
+  const std::string temp_path = m_path + ".tmp";
+  if (!File::WriteStringToFile(temp_path, out) || !File::Rename(temp_path, m_path))
+    ERROR_LOG_FMT(VIDEO, "Failed to write metrics to {}", m_path);
+}
@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+#include "Common/WorkQueueThread.h"
+#include "VideoCommon/GPUTimingQuery.h"
+
+// Periodically writes performance counters to a file in the Prometheus text format, so that many
+// headless instances can be monitored, e.g. with node_exporter's textfile collector.
+//
+// Counters are accumulated on the video thread at every present, which only costs a few additions.
+// Once per interval a snapshot is handed to a worker thread, which formats it and replaces the
+// file, so the video thread never waits on file I/O.
+class MetricsExporter
+{
+public:
+  // Start() must be called before the video backend starts, and Stop() after it has shut down.
+  void Start(std::string path, DT interval);
+  void Stop();
+
+private:
+  struct Snapshot
+  {
+    double fps = 0.0;
+    double vps = 0.0;
+    double speed = 0.0;
+    double max_speed = 0.0;
+    double present_latency_avg_ms = 0.0;
+    double present_latency_max_ms = 0.0;
+    double audio_buffered_latency_ms = 0.0;
+    double audio_resample_ratio = 1.0;
+    u64 audio_underruns = 0;
+
+    bool has_gpu_times = false;
+    std::array<double, static_cast<u32>(GPUTimingPass::Count)> gpu_pass_times_ms{};
+
+    int shaders_alive = 0;
+    int textures_alive = 0;
+    int texture_memory_mib = 0;
+
+    // Totals since Start().
+    u64 frames = 0;
+    u64 draw_calls = 0;
+    u64 primitives = 0;
+    u64 shaders_compiled = 0;
+    u64 stream_buffer_stalls = 0;
+    u64 stream_buffer_stall_us = 0;
+    u64 bbox_stalls = 0;
+    u64 bbox_stall_us = 0;
+    u64 efb_peek_stalls = 0;
+    u64 efb_peek_stall_us = 0;
+    u64 dvd_read_stalls = 0;
+    u64 dvd_read_stall_us = 0;
+  };
+
+  void OnPresent();
+  Snapshot TakeSnapshot() const;
+  void WriteSnapshot(const Snapshot& snapshot) const;
+
+  std::string m_path;
+  DT m_interval{};
+  TimePoint m_next_export_time;
+
+  Common::EventHook m_present_hook;
+  Common::WorkQueueThread<Snapshot> m_write_thread;
+
+  // Only accessed on the video thread.
+  Snapshot m_totals;
+  int m_last_shaders_created = 0;
+};
+
+extern MetricsExporter g_metrics_exporter;
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <bit>
+#include <cstring>
 #include <type_traits>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumFormatter.h"
 #include "Common/Inline.h"
+#include "Common/Intrinsics.h"
 #include "Common/Swap.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/VertexLoaderBase.h"
@@ -117,6 +120,34 @@ public:
 
 namespace detail
 {
+// Returns how many GX_NOP bytes data starts with. Games pad the FIFO and display lists to 32 bytes
+// with NOPs, and GXFlush writes 32 of them, so the bytes are checked a vector at a time.
+DOLPHIN_FORCE_INLINE u32 CountNops(const u8* data, u32 available)
+{
+  u32 count = 0;
+#ifdef _M_X86_64
+  for (; available - count >= 16; count += 16)
+  {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[count]));
+    const u32 non_nops = ~_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128())) & 0xffff;
+    if (non_nops != 0)
+      return count + std::countr_zero(non_nops);
+  }
+#else
+  for (; available - count >= 8; count += 8)
+  {
+    u64 bytes;
+    std::memcpy(&bytes, &data[count], sizeof(bytes));
+    // Hosts are little-endian, so the lowest set bit belongs to the first non-NOP byte.
+    if (bytes != 0)
+      return count + std::countr_zero(bytes) / 8;
+  }
+#endif
+  while (count < available && static_cast<Opcode>(data[count]) == Opcode::GX_NOP)
+    count++;
+  return count;
+}
+
 // Main logic; split so that the main RunCommand can call OnCommand with the returned size.
 template <typename T, typename = std::enable_if_t<std::is_base_of_v<Callback, T>>>
 static DOLPHIN_FORCE_INLINE u32 RunCommand(const u8* data, u32 available, T& callback)
@@ -130,9 +161,7 @@ static DOLPHIN_FORCE_INLINE u32 RunCommand(const u8* data, u32 available, T& cal
   {
   case Opcode::GX_NOP:
   {
-    u32 count = 1;
-    while (count < available && static_cast<Opcode>(data[count]) == Opcode::GX_NOP)
-      count++;
+    const u32 count = CountNops(data, available);
     callback.OnNop(count);
     return count;
   }
@@ -2,12 +2,30 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "VideoCommon/PerfQueryBase.h"
+#include <atomic>
 #include <memory>
 #include "VideoCommon/VideoConfig.h"
 
 std::unique_ptr<PerfQueryBase> g_perf_query;
 
-bool PerfQueryBase::ShouldEmulate()
+static std::atomic<bool> s_counters_read = false;
+
+PerfQueryBase::PerfQueryBase() : m_query_count(0)
+{
+  s_counters_read.store(false, std::memory_order_relaxed);
+}
+
+bool PerfQueryBase::IsEnabled()
 {
   return g_ActiveConfig.bPerfQueriesEnable;
 }
+
+bool PerfQueryBase::ShouldEmulate()
+{
+  return IsEnabled() && s_counters_read.load(std::memory_order_relaxed);
+}
+
+void PerfQueryBase::OnCounterRead()
+{
+  s_counters_read.store(true, std::memory_order_relaxed);
+}
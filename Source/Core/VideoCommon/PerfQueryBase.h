@@ -31,15 +31,25 @@ enum PerfQueryGroup
 class PerfQueryBase
 {
 public:
-  PerfQueryBase() : m_query_count(0) {}
+  PerfQueryBase();
   virtual ~PerfQueryBase() {}
 
   virtual bool Initialize() { return true; }
 
   // Checks if performance queries are enabled in the gameini configuration.
   // NOTE: Called from CPU+GPU thread
+  static bool IsEnabled();
+
+  // Checks if performance queries are enabled and the game has read any of the counters. Host
+  // queries aren't issued until then, so the counters read as zero until queries have been run
+  // for a while after the first read.
+  // NOTE: Called from CPU+GPU thread
   static bool ShouldEmulate();
 
+  // Called when the game reads one of the counters.
+  // NOTE: Called from CPU thread
+  static void OnCounterRead();
+
   // Begin querying the specified value for the following host GPU commands
   // The call to EnableQuery() should be placed immediately before the draw command, otherwise
   // there is a risk of GPU resets if the query is left open and the buffer is submitted during
@@ -3,18 +3,24 @@
 
 #include "VideoCommon/PerformanceMetrics.h"
 
+#include <algorithm>
 #include <mutex>
+#include <utility>
 
 #include <imgui.h>
 #include <implot.h>
 
 #include "Core/CoreTiming.h"
 #include "Core/HW/VideoInterface.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/System.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
 
+static constexpr u32 PRESENT_LATENCY_WINDOW = 60;
+
 void PerformanceMetrics::Reset()
 {
   m_fps_counter.Reset();
@@ -22,6 +28,12 @@ void PerformanceMetrics::Reset()
   m_speed_counter.Reset();
 
   m_time_sleeping = DT::zero();
+  m_frame_delay = DT::zero();
+  m_present_latency_avg = DT::zero();
+  m_present_latency_max = DT::zero();
+  m_present_latency_window_max = DT::zero();
+  m_present_latency_count = 0;
+  m_audio_underruns = 0;
   m_real_times.fill(Clock::now());
   m_cpu_times.fill(Core::System::GetInstance().GetCoreTiming().GetCPUTimePoint(0));
 }
@@ -42,6 +54,31 @@ void PerformanceMetrics::CountThrottleSleep(DT sleep)
   m_time_sleeping += sleep;
 }
 
+void PerformanceMetrics::CountFrameDelay(DT delay)
+{
+  std::unique_lock lock(m_time_lock);
+  m_frame_delay = delay;
+}
+
+void PerformanceMetrics::CountPresentLatency(DT latency)
+{
+  std::unique_lock lock(m_time_lock);
+  if (m_present_latency_count == 0)
+    m_present_latency_avg = latency;
+  else
+    m_present_latency_avg += (latency - m_present_latency_avg) / 16;
+
+  m_present_latency_window_max = std::max(m_present_latency_window_max, latency);
+  if (++m_present_latency_count % PRESENT_LATENCY_WINDOW == 0)
+  {
+    m_present_latency_max = std::exchange(m_present_latency_window_max, DT::zero());
+  }
+  else if (m_present_latency_count < PRESENT_LATENCY_WINDOW)
+  {
+    m_present_latency_max = m_present_latency_window_max;
+  }
+}
+
 void PerformanceMetrics::CountPerformanceMarker(Core::System& system, s64 cyclesLate)
 {
   std::unique_lock lock(m_time_lock);
@@ -52,6 +89,17 @@ void PerformanceMetrics::CountPerformanceMarker(Core::System& system, s64 cycles
   m_time_index += 1;
 }
 
+void PerformanceMetrics::CountAudioUnderrun()
+{
+  m_audio_underruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetAudioMixerState(double resample_ratio, DT buffered)
+{
+  m_audio_resample_ratio.store(resample_ratio, std::memory_order_relaxed);
+  m_audio_buffered_latency.store(buffered, std::memory_order_relaxed);
+}
+
 double PerformanceMetrics::GetFPS() const
 {
   return m_fps_counter.GetHzAvg();
@@ -80,6 +128,39 @@ double PerformanceMetrics::GetLastSpeedDenominator() const
          Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
 }
 
+DT PerformanceMetrics::GetFrameDelay() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_frame_delay;
+}
+
+DT PerformanceMetrics::GetPresentLatencyAvg() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_present_latency_avg;
+}
+
+DT PerformanceMetrics::GetPresentLatencyMax() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_present_latency_max;
+}
+
+u64 PerformanceMetrics::GetAudioUnderruns() const
+{
+  return m_audio_underruns.load(std::memory_order_relaxed);
+}
+
+double PerformanceMetrics::GetAudioResampleRatio() const
+{
+  return m_audio_resample_ratio.load(std::memory_order_relaxed);
+}
+
+DT PerformanceMetrics::GetAudioBufferedLatency() const
+{
+  return m_audio_buffered_latency.load(std::memory_order_relaxed);
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   const float bg_alpha = 0.7f;
@@ -211,7 +292,7 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 
   if (g_ActiveConfig.bShowFPS || g_ActiveConfig.bShowFTimes)
   {
-    int count = g_ActiveConfig.bShowFPS + 2 * g_ActiveConfig.bShowFTimes;
+    int count = g_ActiveConfig.bShowFPS + 4 * g_ActiveConfig.bShowFTimes;
     float window_height = (12.f + 17.f * count) * backbuffer_scale;
 
     // Position in the top-right corner of the screen.
@@ -234,6 +315,10 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
                            DT_ms(m_fps_counter.GetDtAvg()).count());
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), " ±:%6.2lfms",
                            DT_ms(m_fps_counter.GetDtStd()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "lat:%5.1lfms",
+                           DT_ms(GetPresentLatencyAvg()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "max:%5.1lfms",
+                           DT_ms(GetPresentLatencyMax()).count());
       }
       ImGui::End();
     }
@@ -269,5 +354,67 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     }
   }
 
+  if (g_ActiveConfig.bShowTLBStats)
+  {
+    const PowerPC::TLBStats stats = Core::System::GetInstance().GetMMU().GetTLBStats();
+    const u64 lookups = stats.hits + stats.misses;
+    const double hit_rate = lookups != 0 ? 100.0 * stats.hits / lookups : 100.0;
+
+    const float tlb_window_width = 1.5f * window_width;
+    const float window_height = (12.f + 17.f * 3) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(tlb_window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= tlb_window_width + window_padding;
+
+    if (ImGui::Begin("TLBStats", nullptr, imgui_flags))
+    {
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "TLB hit:%7.2lf%%", hit_rate);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Misses:%10llu",
+                         static_cast<unsigned long long>(stats.misses));
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Walks:%11llu",
+                         static_cast<unsigned long long>(stats.page_table_walks));
+      ImGui::End();
+    }
+  }
+
+  if (g_ActiveConfig.bShowGPUTimings && g_gpu_timing_query && g_gpu_timing_query->HasResults())
+  {
+    constexpr u32 num_passes = static_cast<u32>(GPUTimingPass::Count);
+    const float gpu_window_width = 2.f * window_width;
+    const float window_height = (12.f + 17.f * (num_passes + 1)) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(gpu_window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= gpu_window_width + window_padding;
+
+    if (ImGui::Begin("GPUTimings", nullptr, imgui_flags))
+    {
+      double total = 0.0;
+      for (u32 i = 0; i < num_passes; i++)
+      {
+        const GPUTimingPass pass = static_cast<GPUTimingPass>(i);
+        const double time = g_gpu_timing_query->GetPassTime(pass);
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-16s%6.2lfms",
+                           GPUTimingQueryBase::GetPassName(pass), time);
+        total += time;
+      }
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-16s%6.2lfms", "GPU total", total);
+      ImGui::End();
+    }
+  }
+
   ImGui::PopStyleVar(2);
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <shared_mutex>
 
 #include "Common/CommonTypes.h"
@@ -31,7 +32,13 @@ public:
   void CountVBlank();
 
   void CountThrottleSleep(DT sleep);
+  void CountFrameDelay(DT delay);
+  // Time from the CPU outputting a frame to it being handed to the window system.
+  void CountPresentLatency(DT latency);
   void CountPerformanceMarker(Core::System& system, s64 cyclesLate);
+  // Called from the audio thread, so these don't take the lock.
+  void CountAudioUnderrun();
+  void SetAudioMixerState(double resample_ratio, DT buffered);
 
   // Getter Functions
   double GetFPS() const;
@@ -41,6 +48,15 @@ public:
 
   double GetLastSpeedDenominator() const;
 
+  DT GetFrameDelay() const;
+  DT GetPresentLatencyAvg() const;
+  DT GetPresentLatencyMax() const;
+
+  u64 GetAudioUnderruns() const;
+  // The factor the mixer scales the DSP sample rate by to keep its buffer at the target latency.
+  double GetAudioResampleRatio() const;
+  DT GetAudioBufferedLatency() const;
+
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
@@ -57,6 +73,17 @@ private:
   std::array<TimePoint, 256> m_real_times{};
   std::array<TimePoint, 256> m_cpu_times{};
   DT m_time_sleeping{};
+
+  DT m_frame_delay{};
+  DT m_present_latency_avg{};
+  // Highest latency in the current window of PRESENT_LATENCY_WINDOW frames, and the previous one.
+  DT m_present_latency_max{};
+  DT m_present_latency_window_max{};
+  u32 m_present_latency_count = 0;
+
+  std::atomic<u64> m_audio_underruns = 0;
+  std::atomic<double> m_audio_resample_ratio = 1.0;
+  std::atomic<DT> m_audio_buffered_latency{};
 };
 
 extern PerformanceMetrics g_perf_metrics;
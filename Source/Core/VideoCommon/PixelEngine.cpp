@@ -10,6 +10,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -143,8 +144,21 @@ void PixelEngineManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    pe.UpdateInterrupts();
                  }));
 
-  // Token register, readonly.
-  mmio->Register(base | PE_TOKEN_REG, MMIO::DirectRead<u16>(&m_token), MMIO::InvalidWrite<u16>());
+  // Token register, readonly. The GPU sets it, so in sync on demand mode reading it has to wait
+  // for the GPU to catch up.
+  if (Config::Get(Config::MAIN_SYNC_GPU_ON_DEMAND))
+  {
+    mmio->Register(base | PE_TOKEN_REG, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
+                     system.GetFifo().SyncGPUForGPUStateRead(Fifo::SyncGPUReason::PEToken);
+                     return system.GetPixelEngine().m_token;
+                   }),
+                   MMIO::InvalidWrite<u16>());
+  }
+  else
+  {
+    mmio->Register(base | PE_TOKEN_REG, MMIO::DirectRead<u16>(&m_token),
+                   MMIO::InvalidWrite<u16>());
+  }
 
   // BBOX registers, readonly and need to update a flag.
   for (int i = 0; i < 4; ++i)
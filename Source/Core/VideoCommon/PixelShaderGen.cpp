@@ -1027,7 +1027,7 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
                             GetInterpolationQualifier(msaa, ssaa, true, true), ShaderStage::Pixel);
 
     out.Write("}};\n");
-    if (stereo && !host_config.backend_gl_layer_in_fs)
+    if (stereo && !host_config.backend_multiview && !host_config.backend_gl_layer_in_fs)
       out.Write("flat in int layer;");
   }
   else
@@ -1092,7 +1092,11 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
     out.Write("\tfloat4 ocol1;\n");
   }
 
-  if (host_config.backend_geometry_shaders && stereo)
+  if (stereo && host_config.backend_multiview)
+  {
+    out.Write("\tint layer = int(gl_ViewIndex);\n");
+  }
+  else if (host_config.backend_geometry_shaders && stereo)
   {
     if (host_config.backend_gl_layer_in_fs)
       out.Write("\tint layer = gl_Layer;\n");
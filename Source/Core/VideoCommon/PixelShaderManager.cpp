@@ -73,6 +73,11 @@ void PixelShaderManager::Dirty()
   // This function is called after a savestate is loaded.
   // Any constants that can changed based on settings should be re-calculated
   m_fog_range_adjusted_changed = true;
+  m_alpha_test_dirty = true;
+  m_zmode_dirty = true;
+  m_blend_mode_dirty = true;
+  m_dest_alpha_dirty = true;
+  m_ind_matrices_dirty = BitSet32::AllTrue(std::size(bpmem.indmtx));
 
   SetEfbScaleChanged(g_framebuffer_manager->EFBToScaledXf(1),
                      g_framebuffer_manager->EFBToScaledYf(1));
@@ -158,6 +163,148 @@ void PixelShaderManager::SetConstants()
     m_indirect_dirty = false;
   }
 
+  for (const u32 matrixidx : m_ind_matrices_dirty)
+  {
+    const u8 scale = bpmem.indmtx[matrixidx].GetScale();
+
+    // xyz - static matrix
+    // w - dynamic matrix scale / 128
+    constants.indtexmtx[2 * matrixidx][0] = bpmem.indmtx[matrixidx].col0.ma;
+    constants.indtexmtx[2 * matrixidx][1] = bpmem.indmtx[matrixidx].col1.mc;
+    constants.indtexmtx[2 * matrixidx][2] = bpmem.indmtx[matrixidx].col2.me;
+    constants.indtexmtx[2 * matrixidx][3] = 17 - scale;
+    constants.indtexmtx[2 * matrixidx + 1][0] = bpmem.indmtx[matrixidx].col0.mb;
+    constants.indtexmtx[2 * matrixidx + 1][1] = bpmem.indmtx[matrixidx].col1.md;
+    constants.indtexmtx[2 * matrixidx + 1][2] = bpmem.indmtx[matrixidx].col2.mf;
+    constants.indtexmtx[2 * matrixidx + 1][3] = 17 - scale;
+    dirty = true;
+
+    PRIM_LOG("indmtx{}: scale={}, mat=({} {} {}; {} {} {})", matrixidx, scale,
+             bpmem.indmtx[matrixidx].col0.ma, bpmem.indmtx[matrixidx].col1.mc,
+             bpmem.indmtx[matrixidx].col2.me, bpmem.indmtx[matrixidx].col0.mb,
+             bpmem.indmtx[matrixidx].col1.md, bpmem.indmtx[matrixidx].col2.mf);
+  }
+  m_ind_matrices_dirty = {};
+
+  if (m_alpha_test_dirty)
+  {
+    // Force alphaTest Uniform to zero if it will always pass.
+    // (set an extra bit to distinguish from "never && never")
+    // TODO: we could optimize this further and check the actual constants,
+    // i.e. "a <= 0" and "a >= 255" will always pass.
+    u32 alpha_test =
+        bpmem.alpha_test.TestResult() != AlphaTestResult::Pass ? bpmem.alpha_test.hex | 1 << 31 : 0;
+    if (constants.alphaTest != alpha_test)
+    {
+      constants.alphaTest = alpha_test;
+      dirty = true;
+    }
+    m_alpha_test_dirty = false;
+  }
+
+  if (m_fog_param_dirty)
+  {
+    if (!g_ActiveConfig.bDisableFog)
+    {
+      constants.fogf[0] = bpmem.fog.GetA();
+      constants.fogf[1] = bpmem.fog.GetC();
+      constants.fogi[1] = bpmem.fog.b_magnitude;
+      constants.fogi[3] = bpmem.fog.b_shift;
+      constants.fogParam3 = bpmem.fog.c_proj_fsel.hex;
+    }
+    else
+    {
+      constants.fogf[0] = 0.f;
+      constants.fogf[1] = 0.f;
+      constants.fogi[1] = 1;
+      constants.fogi[3] = 1;
+      constants.fogParam3 = 0;
+    }
+    dirty = true;
+    m_fog_param_dirty = false;
+  }
+
+  // Dithering depends on both the pixel format and the blend mode.
+  const bool dither_dirty = m_zmode_dirty || m_blend_mode_dirty;
+
+  if (m_zmode_dirty)
+  {
+    u32 late_ztest = bpmem.GetEmulatedZ() == EmulatedZ::Late;
+    u32 rgba6_format = (bpmem.zcontrol.pixel_format == PixelFormat::RGBA6_Z24 &&
+                        !g_ActiveConfig.bForceTrueColor) ?
+                           1 :
+                           0;
+    if (constants.late_ztest != late_ztest || constants.rgba6_format != rgba6_format)
+    {
+      constants.late_ztest = late_ztest;
+      constants.rgba6_format = rgba6_format;
+      dirty = true;
+    }
+    m_zmode_dirty = false;
+  }
+
+  if (dither_dirty)
+  {
+    const u32 dither = constants.rgba6_format && bpmem.blendmode.dither;
+    if (constants.dither != dither)
+    {
+      constants.dither = dither;
+      dirty = true;
+    }
+  }
+
+  if (m_blend_mode_dirty)
+  {
+    BlendingState state = {};
+    state.Generate(bpmem);
+    if (constants.blend_enable != state.blendenable)
+    {
+      constants.blend_enable = state.blendenable;
+      dirty = true;
+    }
+    if (constants.blend_src_factor != state.srcfactor)
+    {
+      constants.blend_src_factor = state.srcfactor;
+      dirty = true;
+    }
+    if (constants.blend_src_factor_alpha != state.srcfactoralpha)
+    {
+      constants.blend_src_factor_alpha = state.srcfactoralpha;
+      dirty = true;
+    }
+    if (constants.blend_dst_factor != state.dstfactor)
+    {
+      constants.blend_dst_factor = state.dstfactor;
+      dirty = true;
+    }
+    if (constants.blend_dst_factor_alpha != state.dstfactoralpha)
+    {
+      constants.blend_dst_factor_alpha = state.dstfactoralpha;
+      dirty = true;
+    }
+    if (constants.blend_subtract != state.subtract)
+    {
+      constants.blend_subtract = state.subtract;
+      dirty = true;
+    }
+    if (constants.blend_subtract_alpha != state.subtractAlpha)
+    {
+      constants.blend_subtract_alpha = state.subtractAlpha;
+      dirty = true;
+    }
+    if (constants.logic_op_enable != state.logicopenable)
+    {
+      constants.logic_op_enable = state.logicopenable;
+      dirty = true;
+    }
+    if (constants.logic_op_mode != state.logicmode)
+    {
+      constants.logic_op_mode = state.logicmode;
+      dirty = true;
+    }
+    m_blend_mode_dirty = false;
+  }
+
   if (m_dest_alpha_dirty)
   {
     // Destination alpha is only enabled if alpha writes are enabled. Force entire uniform to zero
@@ -172,6 +319,7 @@ void PixelShaderManager::SetConstants()
       constants.dstalpha = dstalpha;
       dirty = true;
     }
+    m_dest_alpha_dirty = false;
   }
 }
 
@@ -246,17 +394,7 @@ void PixelShaderManager::SetAlpha()
 
 void PixelShaderManager::SetAlphaTestChanged()
 {
-  // Force alphaTest Uniform to zero if it will always pass.
-  // (set an extra bit to distinguish from "never && never")
-  // TODO: we could optimize this further and check the actual constants,
-  // i.e. "a <= 0" and "a >= 255" will always pass.
-  u32 alpha_test =
-      bpmem.alpha_test.TestResult() != AlphaTestResult::Pass ? bpmem.alpha_test.hex | 1 << 31 : 0;
-  if (constants.alphaTest != alpha_test)
-  {
-    constants.alphaTest = alpha_test;
-    dirty = true;
-  }
+  m_alpha_test_dirty = true;
 }
 
 void PixelShaderManager::SetDestAlphaChanged()
@@ -323,24 +461,7 @@ void PixelShaderManager::SetIndTexScaleChanged(bool high)
 
 void PixelShaderManager::SetIndMatrixChanged(int matrixidx)
 {
-  const u8 scale = bpmem.indmtx[matrixidx].GetScale();
-
-  // xyz - static matrix
-  // w - dynamic matrix scale / 128
-  constants.indtexmtx[2 * matrixidx][0] = bpmem.indmtx[matrixidx].col0.ma;
-  constants.indtexmtx[2 * matrixidx][1] = bpmem.indmtx[matrixidx].col1.mc;
-  constants.indtexmtx[2 * matrixidx][2] = bpmem.indmtx[matrixidx].col2.me;
-  constants.indtexmtx[2 * matrixidx][3] = 17 - scale;
-  constants.indtexmtx[2 * matrixidx + 1][0] = bpmem.indmtx[matrixidx].col0.mb;
-  constants.indtexmtx[2 * matrixidx + 1][1] = bpmem.indmtx[matrixidx].col1.md;
-  constants.indtexmtx[2 * matrixidx + 1][2] = bpmem.indmtx[matrixidx].col2.mf;
-  constants.indtexmtx[2 * matrixidx + 1][3] = 17 - scale;
-  dirty = true;
-
-  PRIM_LOG("indmtx{}: scale={}, mat=({} {} {}; {} {} {})", matrixidx, scale,
-           bpmem.indmtx[matrixidx].col0.ma, bpmem.indmtx[matrixidx].col1.mc,
-           bpmem.indmtx[matrixidx].col2.me, bpmem.indmtx[matrixidx].col0.mb,
-           bpmem.indmtx[matrixidx].col1.md, bpmem.indmtx[matrixidx].col2.mf);
+  m_ind_matrices_dirty[matrixidx] = true;
 }
 
 void PixelShaderManager::SetZTextureTypeChanged()
@@ -399,23 +520,7 @@ void PixelShaderManager::SetFogColorChanged()
 
 void PixelShaderManager::SetFogParamChanged()
 {
-  if (!g_ActiveConfig.bDisableFog)
-  {
-    constants.fogf[0] = bpmem.fog.GetA();
-    constants.fogf[1] = bpmem.fog.GetC();
-    constants.fogi[1] = bpmem.fog.b_magnitude;
-    constants.fogi[3] = bpmem.fog.b_shift;
-    constants.fogParam3 = bpmem.fog.c_proj_fsel.hex;
-  }
-  else
-  {
-    constants.fogf[0] = 0.f;
-    constants.fogf[1] = 0.f;
-    constants.fogi[1] = 1;
-    constants.fogi[3] = 1;
-    constants.fogParam3 = 0;
-  }
-  dirty = true;
+  m_fog_param_dirty = true;
 }
 
 void PixelShaderManager::SetFogRangeAdjustChanged()
@@ -441,78 +546,13 @@ void PixelShaderManager::SetGenModeChanged()
 
 void PixelShaderManager::SetZModeControl()
 {
-  u32 late_ztest = bpmem.GetEmulatedZ() == EmulatedZ::Late;
-  u32 rgba6_format =
-      (bpmem.zcontrol.pixel_format == PixelFormat::RGBA6_Z24 && !g_ActiveConfig.bForceTrueColor) ?
-          1 :
-          0;
-  u32 dither = rgba6_format && bpmem.blendmode.dither;
-  if (constants.late_ztest != late_ztest || constants.rgba6_format != rgba6_format ||
-      constants.dither != dither)
-  {
-    constants.late_ztest = late_ztest;
-    constants.rgba6_format = rgba6_format;
-    constants.dither = dither;
-    dirty = true;
-  }
+  m_zmode_dirty = true;
   m_dest_alpha_dirty = true;
 }
 
 void PixelShaderManager::SetBlendModeChanged()
 {
-  u32 dither = constants.rgba6_format && bpmem.blendmode.dither;
-  if (constants.dither != dither)
-  {
-    constants.dither = dither;
-    dirty = true;
-  }
-  BlendingState state = {};
-  state.Generate(bpmem);
-  if (constants.blend_enable != state.blendenable)
-  {
-    constants.blend_enable = state.blendenable;
-    dirty = true;
-  }
-  if (constants.blend_src_factor != state.srcfactor)
-  {
-    constants.blend_src_factor = state.srcfactor;
-    dirty = true;
-  }
-  if (constants.blend_src_factor_alpha != state.srcfactoralpha)
-  {
-    constants.blend_src_factor_alpha = state.srcfactoralpha;
-    dirty = true;
-  }
-  if (constants.blend_dst_factor != state.dstfactor)
-  {
-    constants.blend_dst_factor = state.dstfactor;
-    dirty = true;
-  }
-  if (constants.blend_dst_factor_alpha != state.dstfactoralpha)
-  {
-    constants.blend_dst_factor_alpha = state.dstfactoralpha;
-    dirty = true;
-  }
-  if (constants.blend_subtract != state.subtract)
-  {
-    constants.blend_subtract = state.subtract;
-    dirty = true;
-  }
-  if (constants.blend_subtract_alpha != state.subtractAlpha)
-  {
-    constants.blend_subtract_alpha = state.subtractAlpha;
-    dirty = true;
-  }
-  if (constants.logic_op_enable != state.logicopenable)
-  {
-    constants.logic_op_enable = state.logicopenable;
-    dirty = true;
-  }
-  if (constants.logic_op_mode != state.logicmode)
-  {
-    constants.logic_op_mode = state.logicmode;
-    dirty = true;
-  }
+  m_blend_mode_dirty = true;
   m_dest_alpha_dirty = true;
 }
 
@@ -5,6 +5,7 @@
 
 #include <span>
 
+#include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/ConstantManager.h"
 
@@ -53,6 +54,7 @@ public:
 
   PixelShaderConstants constants{};
   bool dirty = false;
+  UploadedConstants<PixelShaderConstants> uploaded_constants;
 
   // Constants for custom shaders
   std::span<u8> custom_constants;
@@ -63,4 +65,12 @@ private:
   bool m_viewport_changed = false;
   bool m_indirect_dirty = false;
   bool m_dest_alpha_dirty = false;
+
+  // Constants derived from BP registers which are expensive enough to work out that register
+  // writes only mark them, and SetConstants() updates them once before the next draw.
+  bool m_alpha_test_dirty = false;
+  bool m_fog_param_dirty = false;
+  bool m_zmode_dirty = false;
+  bool m_blend_mode_dirty = false;
+  BitSet32 m_ind_matrices_dirty;
 };
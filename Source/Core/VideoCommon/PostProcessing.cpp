@@ -25,6 +25,7 @@
 #include "VideoCommon/AbstractShader.h"
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/ShaderCache.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -541,6 +542,9 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
 
     g_gfx->SetFramebuffer(m_intermediary_frame_buffer.get());
 
+    if (g_gpu_timing_query)
+      g_gpu_timing_query->SetPass(GPUTimingPass::ColorCorrection);
+
     FillUniformBuffer(src_rect, src_tex, src_layer, g_gfx->GetCurrentFramebuffer()->GetRect(),
                       present_rect, uniform_staging_buffer->data(), !default_uniform_staging_buffer,
                       true);
@@ -592,6 +596,13 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   // Final pass, either a user selected shader or the default (fixed) shader.
   if (final_pipeline)
   {
+    if (g_gpu_timing_query)
+    {
+      g_gpu_timing_query->SetPass(final_pipeline == m_default_pipeline.get() ?
+                                      GPUTimingPass::ColorCorrection :
+                                      GPUTimingPass::PostProcessing);
+    }
+
     FillUniformBuffer(src_rect, src_tex, src_layer, g_gfx->GetCurrentFramebuffer()->GetRect(),
                       present_rect, uniform_staging_buffer->data(), !default_uniform_staging_buffer,
                       false);
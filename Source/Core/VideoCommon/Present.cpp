@@ -15,7 +15,9 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/OnScreenUI.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -157,7 +159,8 @@ bool Presenter::FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_heigh
   return old_xfb_id == m_last_xfb_id;
 }
 
-void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
+void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks,
+                       TimePoint output_time)
 {
   bool is_duplicate = FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
 
@@ -199,6 +202,8 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
   if (!is_duplicate || !g_ActiveConfig.bSkipPresentingDuplicateXFBs)
   {
     Present();
+    if (!is_duplicate)
+      g_perf_metrics.CountPresentLatency(Clock::now() - output_time);
     ProcessFrameDumping(ticks);
 
     AfterPresentEvent::Trigger(present_info);
@@ -758,6 +763,9 @@ void Presenter::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
                                   const AbstractTexture* source_texture,
                                   const MathUtil::Rectangle<int>& source_rc)
 {
+  if (g_gpu_timing_query)
+    g_gpu_timing_query->SetPass(GPUTimingPass::PostProcessing);
+
   if (g_ActiveConfig.stereo_mode == StereoMode::QuadBuffer &&
       g_ActiveConfig.backend_info.bUsesExplictQuadBuffering)
   {
@@ -790,7 +798,18 @@ void Presenter::Present()
 {
   m_present_count++;
 
-  if (g_gfx->IsHeadless() || (!m_onscreen_ui && !m_xfb_entry))
+  if (g_gfx->IsHeadless())
+  {
+    // Nothing is shown, but the frame's work is still submitted to the GPU (and timed), so that
+    // headless runs behave like windowed ones apart from presenting.
+    g_vertex_manager->Flush();
+    if (g_gpu_timing_query)
+      g_gpu_timing_query->EndFrame();
+    g_gfx->Flush();
+    return;
+  }
+
+  if (!m_onscreen_ui && !m_xfb_entry)
     return;
 
   if (!g_gfx->SupportsUtilityDrawing())
@@ -829,12 +848,18 @@ void Presenter::Present()
     RenderXFBToScreen(render_target_rc, m_xfb_entry->texture.get(), render_source_rc);
   }
 
+  if (g_gpu_timing_query)
+    g_gpu_timing_query->SetPass(GPUTimingPass::Present);
+
   if (m_onscreen_ui)
   {
     m_onscreen_ui->Finalize();
     m_onscreen_ui->DrawImGui();
   }
 
+  if (g_gpu_timing_query)
+    g_gpu_timing_query->EndFrame();
+
   // Present to the window system.
   {
     std::lock_guard<std::mutex> guard(m_swap_mutex);
@@ -3,6 +3,8 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
@@ -102,6 +104,14 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+
+  // Once everything from the caches has been built, let the driver write out its binaries rather
+  // than relying on them being saved at shutdown.
+  if (m_precompile_pending && !m_async_shader_compiler->HasPendingWork())
+  {
+    m_precompile_pending = false;
+    g_gfx->SavePipelineCache();
+  }
 }
 
 void ShaderCache::Shutdown()
@@ -114,11 +124,23 @@ void ShaderCache::Shutdown()
   ClosePipelineUIDCache();
 }
 
-const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
+const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid, u64 uid_hash)
 {
+  INCSTAT(g_stats.this_frame.num_pipeline_lookups);
+  RecentGXPipeline& recent = GetRecentGXPipeline(uid_hash);
+  if (recent.valid && recent.uid_hash == uid_hash && recent.uid == uid)
+  {
+    INCSTAT(g_stats.this_frame.num_recent_pipeline_hits);
+    return recent.pipeline;
+  }
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
+  {
+    RecordPipelineUse(uid);
+    recent = {uid_hash, uid, it->second.first.get(), true};
     return it->second.first.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
@@ -127,22 +149,53 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
-  return InsertGXPipeline(uid, std::move(pipeline));
+  RecordPipelineUse(uid);
+  const AbstractPipeline* result = InsertGXPipeline(uid, std::move(pipeline));
+  recent = {uid_hash, uid, result, true};
+  return result;
 }
 
-std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
+std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid,
+                                                                           u64 uid_hash)
 {
+  INCSTAT(g_stats.this_frame.num_pipeline_lookups);
+  RecentGXPipeline& recent = GetRecentGXPipeline(uid_hash);
+  if (recent.valid && recent.uid_hash == uid_hash && recent.uid == uid)
+  {
+    INCSTAT(g_stats.this_frame.num_recent_pipeline_hits);
+    return recent.pipeline;
+  }
+
+  RecordPipelineUse(uid);
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
+    {
+      recent = {uid_hash, uid, it->second.first.get(), true};
       return it->second.first.get();
+    }
     else
+    {
       return {};
+    }
   }
 
   AppendGXPipelineUID(uid);
+
+  // If the shaders have already been compiled for other pipelines, linking them is quick enough to
+  // do right away, so the ubershader is only needed until new shaders have compiled.
+  if (g_ActiveConfig.backend_info.bSupportsFastPipelineLinking)
+  {
+    if (std::optional<AbstractPipelineConfig> config = GetCompiledGXPipelineConfig(uid))
+    {
+      if (std::unique_ptr<AbstractPipeline> pipeline = g_gfx->CreateLinkedPipeline(*config))
+        return InsertGXPipeline(uid, std::move(pipeline));
+    }
+  }
+
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
   return {};
 }
@@ -153,6 +206,16 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  // Specialized ubershaders are never compiled on demand, as that would defeat the point of
+  // ubershaders. Use the generic ubershader until the background compile finishes.
+  GXUberPipelineUid generic_uid = uid;
+  if (UberShader::ClearSpecializedPixelShaderUidBits(&generic_uid.ps_uid))
+  {
+    if (it == m_gx_uber_pipeline_cache.end() && m_async_shader_compiler->HasWorkerThreads())
+      QueueUberPipelineCompile(uid, COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE);
+    return GetUberPipelineForUid(generic_uid);
+  }
+
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
@@ -225,6 +288,20 @@ static void UnserializePipelineUid(const SerializedUidType& uid, UidType& real_u
   real_uid.blending_state.hex = uid.blending_state_bits;
 }
 
+// Returns the path of the shared cache matching a cache file in the user's shader cache directory,
+// or an empty string if there is no shared cache.
+static std::string GetSharedCacheFileName(const std::string& filename)
+{
+  if (g_ActiveConfig.sSharedShaderCachePath.empty())
+    return {};
+
+  const std::string& user_path = File::GetUserPath(D_SHADERCACHE_IDX);
+  std::string path = g_ActiveConfig.sSharedShaderCachePath;
+  if (!path.ends_with('/'))
+    path += '/';
+  return path + filename.substr(user_path.size());
+}
+
 template <ShaderStage stage, typename K, typename T>
 void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid)
 {
@@ -234,6 +311,10 @@ void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type,
     CacheReader(T& cache_) : cache(cache_) {}
     void Read(const K& key, const u8* value, u32 value_size) override
     {
+      // Already loaded from the shared cache.
+      if (cache.shader_map.contains(key))
+        return;
+
       auto shader = g_gfx->CreateShaderFromBinary(stage, value, value_size);
       if (shader)
       {
@@ -263,6 +344,13 @@ void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type,
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
   CacheReader reader(cache);
+  if (const std::string shared_filename = GetSharedCacheFileName(filename);
+      !shared_filename.empty())
+  {
+    const u32 shared_count =
+        Common::LinearDiskCache<K, u8>::ReadOnly(shared_filename, reader);
+    INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", shared_count, shared_filename);
+  }
   u32 count = cache.disk_cache.OpenAndRead(filename, reader);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", count, filename);
 }
@@ -317,6 +405,22 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
   };
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
+  if (const std::string shared_filename = GetSharedCacheFileName(filename);
+      !shared_filename.empty())
+  {
+    // The shared cache is never modified here, so a stale one is only skipped. Its pipelines are
+    // then compiled and written to the user's cache like any other missing pipeline.
+    CacheReader shared_reader(this, cache);
+    const u32 shared_count =
+        Common::LinearDiskCache<DiskKeyType, u8>::ReadOnly(shared_filename, shared_reader);
+    INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", shared_count, shared_filename);
+    if (shared_reader.AnyFailed())
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from shared cache '{}'.",
+                   shared_filename);
+    }
+  }
+
   CacheReader reader(this, cache);
   const u32 count = disk_cache.OpenAndRead(filename, reader);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
@@ -383,6 +487,7 @@ void ShaderCache::LoadCaches()
 
 void ShaderCache::ClearCaches()
 {
+  m_recent_gx_pipelines = {};
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
@@ -421,12 +526,18 @@ void ShaderCache::CompileMissingPipelines()
   for (auto& it : m_gx_pipeline_cache)
   {
     if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    {
+      QueuePipelineCompile(it.first, GetPrecompilePriority(it.first));
+      m_precompile_pending = true;
+    }
   }
   for (auto& it : m_gx_uber_pipeline_cache)
   {
     if (!it.second.first)
+    {
       QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
+      m_precompile_pending = true;
+    }
   }
 }
 
@@ -777,6 +888,43 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
                              config.depth_state, config.blending_state, AbstractPipelineUsage::GX);
 }
 
+std::optional<AbstractPipelineConfig>
+ShaderCache::GetCompiledGXPipelineConfig(const GXPipelineUid& config_in)
+{
+  GXPipelineUid config = ApplyDriverBugs(config_in);
+  auto vs_iter = m_vs_cache.shader_map.find(config.vs_uid);
+  if (vs_iter == m_vs_cache.shader_map.end() || vs_iter->second.pending ||
+      !vs_iter->second.shader)
+  {
+    return {};
+  }
+
+  PixelShaderUid ps_uid = config.ps_uid;
+  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+
+  auto ps_iter = m_ps_cache.shader_map.find(ps_uid);
+  if (ps_iter == m_ps_cache.shader_map.end() || ps_iter->second.pending ||
+      !ps_iter->second.shader)
+  {
+    return {};
+  }
+
+  const AbstractShader* gs = nullptr;
+  if (NeedsGeometryShader(config.gs_uid))
+  {
+    auto gs_iter = m_gs_cache.shader_map.find(config.gs_uid);
+    if (gs_iter == m_gs_cache.shader_map.end() || gs_iter->second.pending)
+      return {};
+    gs = gs_iter->second.shader.get();
+    if (!gs)
+      return {};
+  }
+
+  return GetGXPipelineConfig(config.vertex_format, vs_iter->second.shader.get(), gs,
+                             ps_iter->second.shader.get(), config.rasterization_state,
+                             config.depth_state, config.blending_state, AbstractPipelineUsage::GX);
+}
+
 /// Edits the UID based on driver bugs and other special configurations
 static GXUberPipelineUid ApplyDriverBugs(const GXUberPipelineUid& in)
 {
@@ -991,14 +1139,137 @@ void ShaderCache::LoadPipelineUIDCache()
   }
 
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+
+  LoadPipelineUsageStats(File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() +
+                         ".uidstats");
 }
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  if (m_gx_pipeline_uid_cache_file.IsOpen())
+    SavePipelineUsageStats();
+
   m_gx_pipeline_uid_cache_file.Close();
 }
 
+namespace
+{
+struct SerializedPipelineUsage
+{
+  SerializedGXPipelineUid uid;
+  u32 sessions;
+  u32 first_frame;
+};
+
+constexpr u32 PIPELINE_USAGE_FILE_MAGIC = 0x54535550;  // PUST
+}  // namespace
+
+void ShaderCache::LoadPipelineUsageStats(const std::string& filename)
+{
+  constexpr size_t HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+  m_gx_pipeline_usage.clear();
+  m_gx_pipeline_usage_filename = filename;
+  // Uses of the recent pipelines have to be recorded again.
+  m_recent_gx_pipelines = {};
+
+  File::IOFile file(filename, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != PIPELINE_USAGE_FILE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    return;
+  }
+
+  // The file is rewritten as a whole on shutdown, so a size mismatch means it is truncated.
+  const u64 file_size = file.GetSize();
+  const size_t count =
+      static_cast<size_t>(file_size - HEADER_SIZE) / sizeof(SerializedPipelineUsage);
+  if (file_size != count * sizeof(SerializedPipelineUsage) + HEADER_SIZE)
+    return;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    SerializedPipelineUsage serialized;
+    if (!file.ReadBytes(&serialized, sizeof(serialized)))
+    {
+      m_gx_pipeline_usage.clear();
+      return;
+    }
+
+    GXPipelineUid uid;
+    UnserializePipelineUid(serialized.uid, uid);
+    PipelineUsage& usage = m_gx_pipeline_usage[uid];
+    usage.sessions = serialized.sessions;
+    usage.first_frame = serialized.first_frame;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read usage statistics for {} pipelines from {}", count, filename);
+}
+
+void ShaderCache::SavePipelineUsageStats()
+{
+  File::IOFile file(m_gx_pipeline_usage_filename, "wb");
+  if (!file.WriteBytes(&PIPELINE_USAGE_FILE_MAGIC, sizeof(PIPELINE_USAGE_FILE_MAGIC)) ||
+      !file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION)))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write pipeline usage statistics to {}",
+                 m_gx_pipeline_usage_filename);
+    return;
+  }
+
+  for (auto& [uid, usage] : m_gx_pipeline_usage)
+  {
+    // Fold this session into the totals, so that saving again doesn't count it twice.
+    if (usage.session_first_frame)
+    {
+      if (usage.sessions == 0 || *usage.session_first_frame < usage.first_frame)
+        usage.first_frame = *usage.session_first_frame;
+      usage.sessions++;
+      usage.session_first_frame.reset();
+    }
+
+    SerializedPipelineUsage serialized;
+    SerializePipelineUid(uid, serialized.uid);
+    serialized.sessions = usage.sessions;
+    serialized.first_frame = usage.first_frame;
+    if (!file.WriteBytes(&serialized, sizeof(serialized)))
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to write pipeline usage statistics to {}",
+                   m_gx_pipeline_usage_filename);
+      return;
+    }
+  }
+}
+
+void ShaderCache::RecordPipelineUse(const GXPipelineUid& uid)
+{
+  // Statistics are only kept alongside the UID cache.
+  if (!m_gx_pipeline_uid_cache_file.IsOpen())
+    return;
+
+  PipelineUsage& usage = m_gx_pipeline_usage[uid];
+  if (!usage.session_first_frame)
+    usage.session_first_frame = static_cast<u32>(g_presenter->FrameCount());
+}
+
+u32 ShaderCache::GetPrecompilePriority(const GXPipelineUid& uid) const
+{
+  // Pipelines without statistics go after all of the others.
+  constexpr u32 NO_STATS_PRIORITY = COMPILE_PRIORITY_SHADERCACHE_PIPELINE + 0x1000000;
+
+  const auto it = m_gx_pipeline_usage.find(uid);
+  if (it == m_gx_pipeline_usage.end() || it->second.sessions == 0)
+    return NO_STATS_PRIORITY;
+
+  // Order by the second at which the pipeline was first needed, then by how many sessions used it.
+  constexpr u32 FRAMES_PER_BUCKET = 60;
+  const u32 bucket = std::min<u32>(it->second.first_frame / FRAMES_PER_BUCKET, 0xffff);
+  const u32 sessions = std::min<u32>(it->second.sessions, 0xff);
+  return COMPILE_PRIORITY_SHADERCACHE_PIPELINE + (bucket << 8) + (0xff - sessions);
+}
+
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
@@ -62,13 +62,14 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
-  // Accesses ShaderGen shader caches
-  const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
+  // Accesses ShaderGen shader caches. uid_hash is the GXPipelineUidHash of uid.
+  const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid, u64 uid_hash);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
 
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
-  std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
+  std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid,
+                                                                u64 uid_hash);
 
   // Shared shaders
   const AbstractShader* GetScreenQuadVertexShader() const
@@ -122,6 +123,10 @@ private:
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
+  void LoadPipelineUsageStats(const std::string& filename);
+  void SavePipelineUsageStats();
+  void RecordPipelineUse(const GXPipelineUid& uid);
+  u32 GetPrecompilePriority(const GXPipelineUid& uid) const;
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
@@ -155,6 +160,8 @@ private:
                       const BlendingState& blending_state, AbstractPipelineUsage usage);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXPipelineUid& uid);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXUberPipelineUid& uid);
+  // Same as GetGXPipelineConfig, but fails instead of compiling any missing shaders.
+  std::optional<AbstractPipelineConfig> GetCompiledGXPipelineConfig(const GXPipelineUid& uid);
   const AbstractPipeline* InsertGXPipeline(const GXPipelineUid& config,
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
@@ -184,11 +191,13 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Within the shader cache,
+  // pipelines are further ordered by their usage statistics, see GetPrecompilePriority.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
+    COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE = 250,
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
 
@@ -228,7 +237,43 @@ private:
   std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
+
+  // Direct-mapped cache of recently used pipelines from m_gx_pipeline_cache, indexed by the top
+  // bits of the UID hash. Games switch between a handful of pipelines most of the time, and this
+  // saves walking the map and comparing whole UIDs at every node for those. Only pipelines which
+  // have finished compiling are added, and their use has already been recorded.
+  struct RecentGXPipeline
+  {
+    u64 uid_hash = 0;
+    GXPipelineUid uid;
+    const AbstractPipeline* pipeline = nullptr;
+    bool valid = false;
+  };
+  static constexpr u32 RECENT_GX_PIPELINE_BITS = 5;
+  std::array<RecentGXPipeline, 1 << RECENT_GX_PIPELINE_BITS> m_recent_gx_pipelines;
+  RecentGXPipeline& GetRecentGXPipeline(u64 uid_hash)
+  {
+    return m_recent_gx_pipelines[uid_hash >> (64 - RECENT_GX_PIPELINE_BITS)];
+  }
   File::IOFile m_gx_pipeline_uid_cache_file;
+
+  // How pipelines from the UID cache were used in previous sessions, so that the ones that are
+  // needed soonest after boot get precompiled first. Stored next to the UID cache.
+  struct PipelineUsage
+  {
+    // Number of sessions which used the pipeline.
+    u32 sessions = 0;
+    // Earliest frame at which the pipeline was first used, over all of those sessions.
+    u32 first_frame = 0;
+    // Frame at which the pipeline was first used in this session, if it has been used yet.
+    std::optional<u32> session_first_frame;
+  };
+  std::map<GXPipelineUid, PipelineUsage> m_gx_pipeline_usage;
+  std::string m_gx_pipeline_usage_filename;
+
+  // Set while pipelines queued by CompileMissingPipelines are still being built.
+  bool m_precompile_pending = false;
+
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -48,6 +48,7 @@ ShaderHostConfig ShaderHostConfig::GetCurrent()
   bits.backend_dynamic_vertex_loader = g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader;
   bits.backend_vs_point_line_expand = g_ActiveConfig.UseVSForLinePointExpand();
   bits.backend_gl_layer_in_fs = g_ActiveConfig.backend_info.bSupportsGLLayerInFS;
+  bits.backend_multiview = g_ActiveConfig.UseMultiviewStereo();
   return bits;
 }
 
@@ -341,6 +342,21 @@ void GenerateVSPointExpansion(ShaderCode& object, std::string_view indent, u32 t
   }
 }
 
+void GenerateStereoOffset(ShaderCode& object, std::string_view indent, std::string_view pos,
+                          std::string_view eye)
+{
+  // For stereoscopy add a small horizontal offset in Normalized Device Coordinates proportional
+  // to the depth of the vertex. We retrieve the depth value from the w-component of the projected
+  // vertex which contains the negated z-component of the original vertex.
+  // For negative parallax (out-of-screen effects) we subtract a convergence value from
+  // the depth value. This results in objects at a distance smaller than the convergence
+  // distance to seemingly appear in front of the screen.
+  // This formula is based on page 13 of the "Nvidia 3D Vision Automatic, Best Practices Guide"
+  object.Write("{0}float hoffset = ({2} == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS ".y;\n"
+               "{0}{1}.x += hoffset * ({1}.w - " I_STEREOPARAMS ".z);\n",
+               indent, pos, eye);
+}
+
 const char* GetInterpolationQualifier(bool msaa, bool ssaa, bool in_glsl_interface_block, bool in)
 {
   if (!msaa)
@@ -181,6 +181,7 @@ union ShaderHostConfig
   BitField<27, 1, bool, u32> backend_dynamic_vertex_loader;
   BitField<28, 1, bool, u32> backend_vs_point_line_expand;
   BitField<29, 1, bool, u32> backend_gl_layer_in_fs;
+  BitField<30, 1, bool, u32> backend_multiview;
 
   static ShaderHostConfig GetCurrent();
 };
@@ -207,6 +208,11 @@ void GenerateVSLineExpansion(ShaderCode& object, std::string_view indent, u32 te
 
 void GenerateVSPointExpansion(ShaderCode& object, std::string_view indent, u32 texgens);
 
+// Offsets a clip space position for the given eye. This is done by the geometry shader when it
+// duplicates primitives into both layers, or by the vertex shader with multiview.
+void GenerateStereoOffset(ShaderCode& object, std::string_view indent, std::string_view pos,
+                          std::string_view eye);
+
 // We use the flag "centroid" to fix some MSAA rendering bugs. With MSAA, the
 // pixel shader will be executed for each pixel which has at least one passed sample.
 // So there may be rendered pixels where the center of the pixel isn't in the primitive.
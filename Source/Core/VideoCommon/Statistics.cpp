@@ -3,16 +3,22 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <chrono>
 #include <cstring>
+#include <string>
 #include <utility>
 
 #include <imgui.h>
 
 #include "Core/DolphinAnalytics.h"
+#include "Core/HW/DVD/DVDThread.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/System.h"
 
+#include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
+#include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -34,9 +40,13 @@ static Common::EventHook s_after_frame_event = AfterFrameEvent::Register(
 
 static bool clear_scissors;
 
+// DVD thread counters at the start of the frame, so that its stalls can be shown per frame.
+static DVD::DVDThreadStats s_dvd_stats_at_frame_start;
+
 void Statistics::ResetFrame()
 {
   this_frame = {};
+  s_dvd_stats_at_frame_start = Core::System::GetInstance().GetDVDThread().GetStats();
   clear_scissors = true;
   if (scissors.size() > 1)
   {
@@ -90,14 +100,25 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture memory", "%d MiB", texture_memory_mib);
+  draw_statistic("Textures evicted", "%d", num_textures_evicted);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
+  draw_statistic("Pipeline lookups", "%d (%d recent)", this_frame.num_pipeline_lookups,
+                 this_frame.num_recent_pipeline_hits);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
+  draw_statistic("Merged draws", "%d", this_frame.num_merged_draws);
+  draw_statistic("CPU culled draws", "%d (%d vertices)", this_frame.num_cpu_culled_draws,
+                 this_frame.num_cpu_culled_vertices);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  if (this_frame.num_render_state_calls != 0)
+    draw_statistic("Render state calls", "%d", this_frame.num_render_state_calls);
+  if (this_frame.num_render_passes != 0)
+    draw_statistic("Render passes", "%d", this_frame.num_render_passes);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
@@ -109,14 +130,81 @@ void Statistics::Display() const
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
-  draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
+  draw_statistic("Uniform skipped", "%i kB", this_frame.bytes_uniform_skipped / 1024);
+  draw_statistic("Stream buffer stalls", "%d (%d us)", this_frame.num_stream_buffer_stalls,
+                 this_frame.stream_buffer_stall_us);
+  draw_statistic("Stream buffer resizes", "%d", num_stream_buffer_resizes);
+  draw_statistic("Bounding box stalls", "%d (%d us)", this_frame.num_bbox_stalls,
+                 this_frame.bbox_stall_us);
+  draw_statistic("Bounding box speculative reads", "%d", this_frame.num_bbox_speculative_reads);
+  draw_statistic("Vertex Loaders", "%d (%d prewarmed)", num_vertex_loaders,
+                 num_vertex_loaders_prewarmed);
+  const int vertex_loader_lookups = num_vertex_loader_hits + num_vertex_loader_misses;
+  draw_statistic("Vertex Loader hit rate", "%.1f%%",
+                 vertex_loader_lookups ? 100.0 * num_vertex_loader_hits / vertex_loader_lookups :
+                                         100.0);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("EFB peek stalls:", "%d (%d us)", this_frame.num_efb_peek_stalls,
+                 this_frame.efb_peek_stall_us);
+  draw_statistic("EFB peek prefetches:", "%d", this_frame.num_efb_peek_prefetches);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
+  const DVD::DVDThreadStats dvd_stats = Core::System::GetInstance().GetDVDThread().GetStats();
+  const u64 dvd_reads = dvd_stats.prefetch_hits + dvd_stats.prefetch_misses;
+  draw_statistic("DVD prefetch hit rate", "%.1f%% (%llu kB read ahead)",
+                 dvd_reads ? 100.0 * dvd_stats.prefetch_hits / dvd_reads : 0.0,
+                 static_cast<unsigned long long>(dvd_stats.bytes_prefetched / 1024));
+  draw_statistic("DVD read stalls", "%llu (%llu us)",
+                 static_cast<unsigned long long>(dvd_stats.read_stalls -
+                                                 s_dvd_stats_at_frame_start.read_stalls),
+                 static_cast<unsigned long long>(dvd_stats.read_stall_us -
+                                                 s_dvd_stats_at_frame_start.read_stall_us));
+
+  if (g_ActiveConfig.bHiresTextures || g_ActiveConfig.bGraphicMods)
+  {
+    const auto& asset_loader = Core::System::GetInstance().GetCustomAssetLoader();
+    draw_statistic("Custom asset memory", "%zu / %zu MB", asset_loader.GetBytesLoaded() >> 20,
+                   asset_loader.GetMemoryLimit() >> 20);
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    const auto load_statistics = asset_loader.GetLoadStatistics();
+    for (size_t i = 0; i < load_statistics.size(); i++)
+    {
+      const auto& stats = load_statistics[i];
+      if (stats.num_loads == 0)
+        continue;
+
+      const std::string name = fmt::format(
+          "Loaded {} assets", static_cast<VideoCommon::CustomAssetLoader::AssetType>(i));
+      draw_statistic(name.c_str(), "%u (avg %.1f ms, max %.1f ms)", stats.num_loads,
+                     Milliseconds(stats.total_latency).count() / stats.num_loads,
+                     Milliseconds(stats.max_latency).count());
+    }
+  }
+
   ImGui::Columns(1);
 
+  if (ImGui::CollapsingHeader("Vertex Loaders"))
+    VertexLoaderManager::DisplayStatistics();
+
+  if (g_ActiveConfig.bGraphicMods && g_graphics_mod_manager &&
+      ImGui::CollapsingHeader("Graphics Mod Actions"))
+  {
+    ImGui::Columns(2, "Graphics Mod Actions", true);
+    for (const auto& timing : g_graphics_mod_manager->GetActionTimings())
+    {
+      if (timing.num_calls == 0)
+        continue;
+
+      const std::string name(timing.name);
+      draw_statistic(name.c_str(), "%u calls (%.3f ms)", timing.num_calls,
+                     std::chrono::duration<double, std::milli>(timing.time).count());
+    }
+    ImGui::Columns(1);
+  }
+
   ImGui::End();
 }
 
@@ -18,8 +18,15 @@ struct Statistics
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
+  int texture_memory_mib = 0;
+  int num_textures_evicted = 0;
 
   int num_vertex_loaders = 0;
+  int num_vertex_loaders_prewarmed = 0;
+  int num_vertex_loader_hits = 0;
+  int num_vertex_loader_misses = 0;
+
+  int num_stream_buffer_resizes = 0;
 
   std::array<float, 6> proj{};
   std::array<float, 16> gproj{};
@@ -52,15 +59,28 @@ struct Statistics
     int num_prims = 0;
     int num_dl_prims = 0;
     int num_shader_changes = 0;
+    int num_pipeline_lookups = 0;
+    int num_recent_pipeline_hits = 0;
 
     int num_primitive_joins = 0;
+    int num_merged_draws = 0;
+    int num_cpu_culled_draws = 0;
+    int num_cpu_culled_vertices = 0;
     int num_draw_calls = 0;
+    int num_render_state_calls = 0;
+    int num_render_passes = 0;
 
     int num_dlists_called = 0;
 
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
     int bytes_uniform_streamed = 0;
+    int bytes_uniform_skipped = 0;
+    int num_stream_buffer_stalls = 0;
+    int stream_buffer_stall_us = 0;
+    int num_bbox_stalls = 0;
+    int bbox_stall_us = 0;
+    int num_bbox_speculative_reads = 0;
 
     int num_triangles_clipped = 0;
     int num_triangles_in = 0;
@@ -75,6 +95,9 @@ struct Statistics
 
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
+    int num_efb_peek_stalls = 0;
+    int efb_peek_stall_us = 0;
+    int num_efb_peek_prefetches = 0;
 
     int num_draw_done = 0;
     int num_token = 0;
@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <deque>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+
+// Ring allocator for persistently-mapped upload buffers, shared by the backends which track GPU
+// progress with a monotonically increasing fence counter. Each region handed out is associated with
+// the fence of the command list it was written in, so it is only reused once the GPU is done with
+// it. Backends provide the buffer object and the fence operations.
+class StreamBufferBase
+{
+public:
+  virtual ~StreamBufferBase();
+
+  u8* GetHostPointer() const { return m_host_pointer; }
+  u8* GetCurrentHostPointer() const { return m_host_pointer + m_current_offset; }
+  u32 GetSize() const { return m_size; }
+  u32 GetMaximumSize() const { return m_maximum_size; }
+  u32 GetCurrentOffset() const { return m_current_offset; }
+
+  // Returns false if the only way to get the space is to wait for the command list currently being
+  // recorded. In that case the caller should submit it and try again.
+  bool ReserveMemory(u32 num_bytes, u32 alignment);
+  void CommitMemory(u32 final_num_bytes);
+
+  // Lets the buffer grow up to max_size bytes when it would otherwise have to wait for the GPU.
+  // Growing replaces the backend buffer object, so only enable this for buffers which are bound
+  // again after every reservation.
+  void SetMaximumSize(u32 max_size);
+
+protected:
+  StreamBufferBase();
+
+  virtual u64 GetCurrentFenceCounter() const = 0;
+  virtual u64 GetCompletedFenceCounter() const = 0;
+  virtual void WaitForFenceCounter(u64 fence_counter) = 0;
+
+  // Replaces the buffer with a new one of new_size bytes, and calls SetBuffer() for it. The old
+  // buffer has to be kept alive until the GPU has finished with the current command list.
+  virtual bool ResizeBuffer(u32 new_size) { return false; }
+
+  // Called for each committed range, e.g. to flush non-coherent memory.
+  virtual void FlushMemory(u32 offset, u32 size) {}
+
+  // Starts allocating from a newly created buffer.
+  void SetBuffer(u8* host_pointer, u32 size);
+
+private:
+  void UpdateCurrentFencePosition();
+  void UpdateGPUPosition();
+
+  // Waits for as many fences as needed to allocate num_bytes bytes from the buffer.
+  bool WaitForClearSpace(u32 num_bytes);
+
+  // Reallocates the buffer at a larger size, if allowed, so that num_bytes fit without waiting.
+  bool GrowBuffer(u32 num_bytes);
+
+  u8* m_host_pointer = nullptr;
+  u32 m_size = 0;
+  u32 m_maximum_size = 0;
+  u32 m_current_offset = 0;
+  u32 m_current_gpu_position = 0;
+  u32 m_last_allocation_size = 0;
+
+  // List of fences and the corresponding positions in the buffer
+  std::deque<std::pair<u64, u32>> m_tracked_fences;
+};
@@ -4,14 +4,21 @@
 #include "VideoCommon/TextureCacheBase.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #if defined(_M_X86_64)
 #include <pmmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
 #endif
 
 #include <fmt/format.h>
@@ -20,6 +27,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
@@ -39,6 +47,7 @@
 #include "VideoCommon/Assets/CustomTextureData.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
@@ -60,6 +69,20 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// Levels smaller than this are decoded on the video thread, as handing them off isn't worth it.
+static constexpr u32 MIN_PARALLEL_DECODE_TEXELS = 256 * 256;
+static constexpr u32 MAX_DECODE_WORKERS = 4;
+// Custom texture levels are uploaded right away, from the smallest up, while they add up to no more
+// than this. The larger ones are streamed in over the following frames.
+static constexpr size_t CUSTOM_TEXTURE_IMMEDIATE_UPLOAD_SIZE = 1024 * 1024;
+// Streaming stops for the frame once this much has been uploaded. A level is never split, so a
+// level larger than the budget still gets uploaded when it's the first one in a frame.
+static constexpr size_t CUSTOM_TEXTURE_STREAMING_BUDGET = 16 * 1024 * 1024;
+// Arbitrary mipmap detection results which are kept before they are all dropped.
+static constexpr size_t MAX_ARBITRARY_MIPMAP_RESULTS = 8192;
+
+// Width and height of the texture that textures are decoded to on the GPU.
+static constexpr u32 DECODING_TEXTURE_SIZE = 1024;
 
 static int xfb_count = 0;
 
@@ -89,6 +112,80 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
   m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
 }
 
+struct TextureCacheBase::CPUDecodeJob
+{
+  std::atomic<u32> pending_bands = 0;
+  Common::Event done;
+};
+
+struct AsyncTextureDecode
+{
+  struct Level
+  {
+    u32 level;
+    u32 width;
+    u32 height;
+    u32 expanded_width;
+    u32 expanded_height;
+    size_t src_offset;
+    size_t dst_offset;
+  };
+
+  TextureFormat format;
+  TLUTFormat tlut_format;
+  std::vector<Level> levels;
+
+  // Copies of the texture and palette, as guest memory may change while the decode is running.
+  std::vector<u8> src;
+  std::vector<u8> palette;
+
+  // Decoded levels, followed by scratch space for the arbitrary mipmap detection.
+  std::vector<u8> dst;
+  size_t dst_size = 0;
+  size_t scratch_offset = 0;
+  ArbitraryMipmapKey mipmap_key;
+
+  std::atomic<bool> done = false;
+  Common::Event done_event;
+};
+
+bool TextureCacheBase::DecodeTextureOnCPU(CPUDecodeJob& job, u8* dst, const u8* src, u32 width,
+                                          u32 height, TextureFormat format, const u8* tlut,
+                                          TLUTFormat tlut_format)
+{
+  const u32 block_height = TexDecoder_GetBlockHeightInTexels(format);
+  const u32 block_rows = height / block_height;
+  const u32 band_count = std::min(static_cast<u32>(m_decode_workers.size()), block_rows);
+
+  // The format overlay is drawn over the whole texture, so it can't be split up.
+  if (band_count < 2 || width * height < MIN_PARALLEL_DECODE_TEXELS ||
+      m_backup_config.texfmt_overlay)
+  {
+    TexDecoder_Decode(dst, src, width, height, format, tlut, tlut_format);
+    return false;
+  }
+
+  job.pending_bands.store(band_count, std::memory_order_relaxed);
+  job.done.Reset();
+
+  for (u32 band = 0; band < band_count; ++band)
+  {
+    const u32 first_row = block_rows * band / band_count * block_height;
+    const u32 end_row = block_rows * (band + 1) / band_count * block_height;
+    u8* const band_dst = dst + size_t(first_row) * width * sizeof(u32);
+    const u8* const band_src = src + TexDecoder_GetTextureSizeInBytes(width, first_row, format);
+
+    m_decode_workers[band]->Push([&job, band_dst, band_src, width, rows = end_row - first_row,
+                                  format, tlut, tlut_format] {
+      TexDecoder_Decode(band_dst, band_src, width, rows, format, tlut, tlut_format);
+      if (job.pending_bands.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        job.done.Set();
+    });
+  }
+
+  return true;
+}
+
 TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
@@ -99,6 +196,16 @@ TextureCacheBase::TextureCacheBase()
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
 
+  const u32 decode_workers = std::min(std::thread::hardware_concurrency() / 2, MAX_DECODE_WORKERS);
+  if (decode_workers > 1)
+  {
+    for (u32 i = 0; i < decode_workers; ++i)
+    {
+      m_decode_workers.push_back(std::make_unique<DecodeWorker>(
+          fmt::format("Texture Decoder {}", i), [](std::function<void()> work) { work(); }));
+    }
+  }
+
   HiresTexture::Init();
 
   TMEM::InvalidateAll();
@@ -141,6 +248,9 @@ void TextureCacheBase::Invalidate()
     bind.reset();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_largest_texture_size = 0;
+  m_latest_xfb_copy.reset();
+  m_arbitrary_mipmap_results.clear();
 
   m_texture_pool.clear();
 }
@@ -171,6 +281,12 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  if (config.fArbitraryMipmapDetectionThreshold !=
+      m_backup_config.arbitrary_mipmap_detection_threshold)
+  {
+    m_arbitrary_mipmap_results.clear();
+  }
+
   SetBackupConfig(config);
 }
 
@@ -256,6 +372,7 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   m_backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
   m_backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   m_backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
+  m_backup_config.arbitrary_mipmap_detection_threshold = config.fArbitraryMipmapDetectionThreshold;
   m_backup_config.graphics_mods = config.bGraphicMods;
   m_backup_config.graphics_mod_change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
@@ -267,6 +384,8 @@ bool TextureCacheBase::DidLinkedAssetsChange(const TCacheEntry& entry)
   {
     if (cached_asset.m_asset)
     {
+      // The texture is in use, which gets it loaded sooner if it's still pending
+      cached_asset.m_asset->MarkUsed();
       if (cached_asset.m_asset->GetLastLoadedTime() > cached_asset.m_cached_write_time)
         return true;
     }
@@ -348,7 +467,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddTextureByAddress(decoded_entry->addr, decoded_entry);
 
   return decoded_entry;
 }
@@ -394,7 +513,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddTextureByAddress(reinterpreted_entry->addr, reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -642,6 +761,10 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
   p.Do(size);
   for (TCacheEntry* entry : entries_to_save)
   {
+    if (entry->pending_decode)
+      FinishAsyncDecode(*entry, true);
+    if (entry->first_resident_level > 0)
+      StreamCustomTexture(*entry, true);
     SerializeTexture(entry->texture.get(), entry->texture->GetConfig(), p);
     entry->DoState(p);
   }
@@ -748,7 +871,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddTextureByAddress(addr, entry);
   }
 
   // Fill in hash map.
@@ -791,7 +914,12 @@ void TextureCacheBase::OnFrameEnd()
   // copies.
   FlushEFBCopies();
 
+  m_texture_dumper.OnFrameEnd();
+
   Cleanup(g_presenter->FrameCount());
+  EvictCustomTextures(g_presenter->FrameCount());
+  EvictTextures(g_presenter->FrameCount());
+  m_custom_texture_streamed_bytes = 0;
 }
 
 void TCacheEntry::DoState(PointerWrap& p)
@@ -923,6 +1051,10 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
         u32 copy_height =
             std::min(entry->native_height - src_y, entry_to_update->native_height - dst_y);
 
+        // The EFB copy has to be drawn over the decoded texture, not over its placeholder.
+        if (entry_to_update->pending_decode)
+          FinishAsyncDecode(*entry_to_update, true);
+
         // If one of the textures is scaled, scale both with the current efb scaling factor
         if (entry_to_update->native_width != entry_to_update->GetWidth() ||
             entry_to_update->native_height != entry_to_update->GetHeight() ||
@@ -1013,7 +1145,7 @@ static bool IsAnisostropicEnhancementSafe(const TexMode0& tm0)
 }
 
 SamplerState TextureCacheBase::GetSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
-                                               bool has_arbitrary_mips)
+                                               bool has_arbitrary_mips, u32 first_resident_level)
 {
   const TexMode0& tm0 = bpmem.tex.GetUnit(index).texMode0;
 
@@ -1039,6 +1171,14 @@ SamplerState TextureCacheBase::GetSamplerState(u32 index, float custom_tex_scale
   if (custom_tex)
     state.tm1.max_lod = 255;
 
+  // Don't sample the levels of a streamed texture that haven't been uploaded yet.
+  if (first_resident_level > 0)
+  {
+    const u32 min_lod = std::min(first_resident_level * 16, 255u);
+    state.tm1.min_lod = std::max(state.tm1.min_lod.Value(), min_lod);
+    state.tm1.max_lod = std::max(state.tm1.max_lod.Value(), state.tm1.min_lod.Value());
+  }
+
   // Anisotropic filtering option.
   if (g_ActiveConfig.iMaxAnisotropy != 0 && IsAnisostropicEnhancementSafe(tm0))
   {
@@ -1101,7 +1241,6 @@ void TextureCacheBase::BindTextures(BitSet32 used_textures,
 class ArbitraryMipmapDetector
 {
 private:
-  using PixelRGBAf = std::array<float, 4>;
   using PixelRGBAu8 = std::array<u8, 4>;
 
 public:
@@ -1112,12 +1251,15 @@ public:
     levels.push_back({{width, height, row_length}, buffer});
   }
 
-  bool HasArbitraryMipmaps(u8* downsample_buffer) const
+  // Whether HasArbitraryMipmaps() has anything to check.
+  bool CanDetect() const
   {
-    if (levels.size() < 2)
-      return false;
+    return levels.size() >= 2 && g_ActiveConfig.bArbitraryMipmapDetection;
+  }
 
-    if (!g_ActiveConfig.bArbitraryMipmapDetection)
+  bool HasArbitraryMipmaps(u8* downsample_buffer) const
+  {
+    if (!CanDetect())
       return false;
 
     // This is the average per-pixel, per-channel difference in percent between what we
@@ -1125,13 +1267,14 @@ public:
     // 4.5% was chosen because it's just below the lowest clearly-arbitrary texture
     // I found in my tests, the background clouds in Mario Galaxy's Observatory lobby.
     const auto threshold = g_ActiveConfig.fArbitraryMipmapDetectionThreshold;
+    const auto level_count = levels.size() - 1;
 
     auto* src = downsample_buffer;
     auto* dst = downsample_buffer + levels[1].shape.row_length * levels[1].shape.height * 4;
 
     float total_diff = 0.f;
 
-    for (std::size_t i = 0; i < levels.size() - 1; ++i)
+    for (std::size_t i = 0; i < level_count; ++i)
     {
       const auto& level = levels[i];
       const auto& mip = levels[i + 1];
@@ -1139,23 +1282,36 @@ public:
       u64 level_pixel_count = level.shape.width;
       level_pixel_count *= level.shape.height;
 
-      // AverageDiff stores the difference sum in a u64, so make sure we can't overflow
+      // The difference sum is stored in a u64, so make sure we can't overflow
       ASSERT(level_pixel_count < (std::numeric_limits<u64>::max() / (255 * 255 * 4)));
 
       // Manually downsample the past downsample with a simple box blur
       // This is not necessarily close to whatever the original artists used, however
       // It should still be closer than a thing that's not a downscale at all
-      Level::Downsample(i ? src : level.pixels, level.shape, dst, mip.shape);
+      // Each row is compared with the next level right after it has been downsampled, as the
+      // comparison never reads ahead of the downsampled rows.
+      const u8* level_pixels = i ? src : level.pixels;
+      u64 diff_sum = 0;
+      for (u32 y = 0; y < mip.shape.height; ++y)
+      {
+        Level::DownsampleRow(level_pixels, level.shape, dst, mip.shape, y);
+        diff_sum += mip.RowDiffSum(dst, y);
+
+        // The difference of a level can only grow as more rows are compared, so stop as soon as
+        // the rows compared so far are enough to exceed the threshold. Arbitrary mipmaps tend to
+        // differ everywhere, so this usually happens within the first few rows of the first mip.
+        if ((total_diff + mip.AverageDiff(diff_sum)) / level_count > threshold)
+          return true;
+      }
 
       // Find the average difference between pixels in this level but downsampled
       // and the next level
-      auto diff = mip.AverageDiff(dst);
-      total_diff += diff;
+      total_diff += mip.AverageDiff(diff_sum);
 
       std::swap(src, dst);
     }
 
-    auto all_levels = total_diff / (levels.size() - 1);
+    auto all_levels = total_diff / level_count;
     return all_levels > threshold;
   }
 
@@ -1178,66 +1334,127 @@ private:
       return {{p[0], p[1], p[2], p[3]}};
     }
 
-    // Puts a downsampled image in dst. dst must be at least width*height*4
-    static void Downsample(const u8* src, const Shape& src_shape, u8* dst, const Shape& dst_shape)
+    // Puts row y of a downsampled image in dst. dst must be at least width*height*4
+    static void DownsampleRow(const u8* src, const Shape& src_shape, u8* dst,
+                              const Shape& dst_shape, u32 y)
     {
-      for (u32 i = 0; i < dst_shape.height; ++i)
+      const u8* src_row0 = src + (y * 2) * src_shape.row_length * 4;
+      const u8* src_row1 = src_row0 + src_shape.row_length * 4;
+      u8* dst_row = dst + y * dst_shape.row_length * 4;
+      u32 x = 0;
+
+      // Two pixels at a time, from the four pixels of each of the two source rows.
+#if defined(_M_X86_64)
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i round = _mm_set1_epi16(2);
+      for (; x + 2 <= dst_shape.width; x += 2)
       {
-        for (u32 j = 0; j < dst_shape.width; ++j)
+        const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_row0 + x * 8));
+        const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_row1 + x * 8));
+        const __m128i columns01 =
+            _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+        const __m128i columns23 =
+            _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+        const __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(columns01, columns23),
+                                          _mm_unpackhi_epi64(columns01, columns23));
+        const __m128i average = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_row + x * 4),
+                         _mm_packus_epi16(average, average));
+      }
+#elif defined(_M_ARM_64)
+      for (; x + 2 <= dst_shape.width; x += 2)
+      {
+        const uint8x16_t row0 = vld1q_u8(src_row0 + x * 8);
+        const uint8x16_t row1 = vld1q_u8(src_row1 + x * 8);
+        const uint16x8_t columns01 = vaddl_u8(vget_low_u8(row0), vget_low_u8(row1));
+        const uint16x8_t columns23 = vaddl_high_u8(row0, row1);
+        const uint16x8_t sum =
+            vaddq_u16(vcombine_u16(vget_low_u16(columns01), vget_low_u16(columns23)),
+                      vcombine_u16(vget_high_u16(columns01), vget_high_u16(columns23)));
+        vst1_u8(dst_row + x * 4, vrshrn_n_u16(sum, 2));
+      }
+#endif
+
+      for (; x < dst_shape.width; ++x)
+      {
+        const std::array<PixelRGBAu8, 4> samples{{
+            SampleLinear(src, src_shape, x * 2, y * 2),
+            SampleLinear(src, src_shape, x * 2 + 1, y * 2),
+            SampleLinear(src, src_shape, x * 2, y * 2 + 1),
+            SampleLinear(src, src_shape, x * 2 + 1, y * 2 + 1),
+        }};
+
+        auto* dst_pixel = dst_row + x * 4;
+        for (int channel = 0; channel < 4; channel++)
         {
-          auto x = j * 2;
-          auto y = i * 2;
-          const std::array<PixelRGBAu8, 4> samples{{
-              SampleLinear(src, src_shape, x, y),
-              SampleLinear(src, src_shape, x + 1, y),
-              SampleLinear(src, src_shape, x, y + 1),
-              SampleLinear(src, src_shape, x + 1, y + 1),
-          }};
-
-          auto* dst_pixel = dst + (j + i * dst_shape.row_length) * 4;
-          for (int channel = 0; channel < 4; channel++)
-          {
-            uint32_t channel_value = samples[0][channel] + samples[1][channel] +
-                                     samples[2][channel] + samples[3][channel];
-            dst_pixel[channel] = (channel_value + 2) / 4;
-          }
+          uint32_t channel_value = samples[0][channel] + samples[1][channel] +
+                                   samples[2][channel] + samples[3][channel];
+          dst_pixel[channel] = (channel_value + 2) / 4;
         }
       }
     }
 
-    float AverageDiff(const u8* other) const
+    // Returns the sum of the squared per-channel differences between row y of this level and the
+    // same row of other. Rows are advanced by row_length bytes rather than pixels, which is what
+    // the default threshold was tuned with.
+    u64 RowDiffSum(const u8* other, u32 y) const
     {
       // As textures are stored in (at most) 8 bit precision, each channel can
       // have a max diff of (2^8)^2, multiply by 4 channels = 2^18 per pixel.
       // That means to overflow, we must have a texture with more than 2^46
       // pixels - which is way beyond anything the original hardware could do,
       // and likely a sane assumption going forward for some significant time.
-      u64 current_diff_sum = 0;
-      const auto* ptr1 = pixels;
-      const auto* ptr2 = other;
-      for (u32 i = 0; i < shape.height; ++i)
+      const u8* row1 = pixels + y * shape.row_length;
+      const u8* row2 = other + y * shape.row_length;
+      const u32 size = shape.width * 4;
+      u64 diff_sum = 0;
+      u32 i = 0;
+
+      // A row of a GameCube texture is at most 1024 pixels, so the 32-bit lanes only need a
+      // fraction of their range.
+#if defined(_M_X86_64)
+      const __m128i zero = _mm_setzero_si128();
+      __m128i lanes = zero;
+      for (; i + 16 <= size; i += 16)
       {
-        const auto* row1 = ptr1;
-        const auto* row2 = ptr2;
-        for (u32 j = 0; j < shape.width; ++j, row1 += 4, row2 += 4)
-        {
-          int pixel_diff = 0;
-          for (int channel = 0; channel < 4; channel++)
-          {
-            const int diff = static_cast<int>(row1[channel]) - static_cast<int>(row2[channel]);
-            const int diff_squared = diff * diff;
-            pixel_diff += diff_squared;
-          }
-          current_diff_sum += pixel_diff;
-        }
-        ptr1 += shape.row_length;
-        ptr2 += shape.row_length;
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row2 + i));
+        const __m128i diff_lo =
+            _mm_sub_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        const __m128i diff_hi =
+            _mm_sub_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        lanes = _mm_add_epi32(lanes, _mm_add_epi32(_mm_madd_epi16(diff_lo, diff_lo),
+                                                   _mm_madd_epi16(diff_hi, diff_hi)));
+      }
+      alignas(16) std::array<u32, 4> lane_sums;
+      _mm_store_si128(reinterpret_cast<__m128i*>(lane_sums.data()), lanes);
+      for (const u32 lane_sum : lane_sums)
+        diff_sum += lane_sum;
+#elif defined(_M_ARM_64)
+      uint32x4_t lanes = vdupq_n_u32(0);
+      for (; i + 16 <= size; i += 16)
+      {
+        const uint8x16_t diff = vabdq_u8(vld1q_u8(row1 + i), vld1q_u8(row2 + i));
+        lanes = vpadalq_u16(lanes, vmull_u8(vget_low_u8(diff), vget_low_u8(diff)));
+        lanes = vpadalq_u16(lanes, vmull_high_u8(diff, diff));
       }
+      diff_sum = vaddlvq_u32(lanes);
+#endif
+
+      for (; i < size; ++i)
+      {
+        const int diff = static_cast<int>(row1[i]) - static_cast<int>(row2[i]);
+        diff_sum += diff * diff;
+      }
+      return diff_sum;
+    }
+
+    float AverageDiff(u64 diff_sum) const
+    {
       // calculate the MSE over all pixels, divide by 2.56 to make it a percent
       // (IE scale to 0..100 instead of 0..256)
 
-      return std::sqrt(static_cast<float>(current_diff_sum) / (shape.width * shape.height * 4)) /
-             2.56f;
+      return std::sqrt(static_cast<float>(diff_sum) / (shape.width * shape.height * 4)) / 2.56f;
     }
   };
   std::vector<Level> levels;
@@ -1245,18 +1462,22 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
-  if (auto entry = LoadImpl(texture_info, false))
+  TCacheEntry* entry = LoadImpl(texture_info, false);
+  if (entry && DidLinkedAssetsChange(*entry))
   {
-    if (!DidLinkedAssetsChange(*entry))
-    {
-      return entry;
-    }
-
     InvalidateTexture(GetTexCacheIter(entry));
-    return LoadImpl(texture_info, true);
+    entry = LoadImpl(texture_info, true);
   }
 
-  return nullptr;
+  // Swap in asynchronously decoded textures once they are ready.
+  if (entry && entry->pending_decode)
+    FinishAsyncDecode(*entry, false);
+
+  // Only stream in the levels of textures which are actually in use.
+  if (entry && entry->first_resident_level > 0)
+    StreamCustomTexture(*entry, false);
+
+  return entry;
 }
 
 TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool force_reload)
@@ -1349,10 +1570,24 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                                             MemoryUpdate::Type::TextureMap);
   }
 
-  // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
-  // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8)
+  {
+    // Preloaded RGBA8 textures keep their AR tiles in the even TMEM bank and their GB tiles in the
+    // odd one, each holding half of the texture. Hash both so that a preload which only changes
+    // the GB tiles isn't mistaken for the texture that's already in the cache.
+    const u32 bank_size = texture_info.GetTextureSize() / 2;
+    base_hash = Common::GetHash64(texture_info.GetData(), bank_size,
+                                  textureCacheSafetyColorSampleSize);
+    base_hash = (base_hash * 397) ^
+                Common::GetHash64(texture_info.GetTmemOddAddress(),
+                                  std::min(bank_size, texture_info.GetTmemOddSize()),
+                                  textureCacheSafetyColorSampleSize);
+  }
+  else
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1564,8 +1799,13 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   }
 
   // If at least one entry was not used for the same frame, overwrite the oldest one
+  RcTcacheEntry placeholder;
   if (temp_frameCount != 0x7fffffff)
   {
+    // With async texture decoding, the old contents are shown until the new texture is decoded.
+    if (g_ActiveConfig.bAsyncTextureDecoding && !m_decode_workers.empty())
+      placeholder = oldest_entry->second;
+
     // pool this texture and make a new one later
     InvalidateTexture(oldest_entry);
   }
@@ -1641,13 +1881,67 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   auto entry =
       CreateTextureEntry(TextureCreationInfo{base_hash, full_hash, bytes_per_block, palette_size},
                          texture_info, textureCacheSafetyColorSampleSize,
-                         std::move(data_for_assets), has_arbitrary_mipmaps, skip_texture_dump);
+                         std::move(data_for_assets), has_arbitrary_mipmaps, skip_texture_dump,
+                         placeholder.get());
   entry->linked_game_texture_assets = std::move(cached_game_assets);
   entry->linked_asset_dependencies = std::move(additional_dependencies);
   entry->texture_info_name = std::move(texture_name);
   return entry;
 }
 
+// Textures are only decoded asynchronously if they would be decoded on the CPU from RAM, and if
+// there's a stale texture with the same layout to show in the meantime.
+static bool CanDecodeTextureAsync(const TCacheEntry& placeholder, const TextureInfo& texture_info,
+                                  u32 levels, bool skip_texture_dump)
+{
+  if (g_ActiveConfig.UseGPUTextureDecoding() || g_ActiveConfig.bTexFmtOverlayEnable ||
+      texture_info.IsFromTmem() || (g_ActiveConfig.bDumpTextures && !skip_texture_dump))
+  {
+    return false;
+  }
+
+  if (!placeholder.texture || placeholder.is_custom_tex)
+    return false;
+
+  const TextureConfig& config = placeholder.texture->GetConfig();
+  return config.width == texture_info.GetRawWidth() &&
+         config.height == texture_info.GetRawHeight() && config.levels == levels &&
+         config.layers == 1 && config.format == AbstractTextureFormat::RGBA8;
+}
+
+static size_t GetCustomTextureLevelSize(
+    std::span<const std::shared_ptr<VideoCommon::TextureData>> assets_data, u32 level_index)
+{
+  size_t size = 0;
+  for (const auto& asset : assets_data)
+  {
+    const auto& levels = asset->m_texture.m_slices[0].m_levels;
+    if (level_index < levels.size())
+      size += levels[level_index].data.size();
+  }
+  return size;
+}
+
+// Uploads a level of every layer that has it, returning the number of bytes uploaded.
+static size_t LoadCustomTextureLevel(
+    AbstractTexture& texture, std::span<const std::shared_ptr<VideoCommon::TextureData>> assets_data,
+    u32 level_index)
+{
+  size_t size = 0;
+  for (u32 data_index = 0; data_index < static_cast<u32>(assets_data.size()); data_index++)
+  {
+    const auto& levels = assets_data[data_index]->m_texture.m_slices[0].m_levels;
+    if (level_index >= levels.size())
+      continue;
+
+    const auto& level = levels[level_index];
+    texture.Load(level_index, level.width, level.height, level.row_length, level.data.data(),
+                 level.data.size(), data_index);
+    size += level.data.size();
+  }
+  return size;
+}
+
 // Note: the following function assumes all CustomTextureData has a single slice.  This is verified
 // with the 'GameTexture::Validate' function after the data is loaded. Only a single slice is
 // expected because each texture is loaded into a texture array
@@ -1655,7 +1949,7 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     const TextureCreationInfo& creation_info, const TextureInfo& texture_info,
     const int safety_color_sample_size,
     std::vector<std::shared_ptr<VideoCommon::TextureData>> assets_data,
-    const bool custom_arbitrary_mipmaps, bool skip_texture_dump)
+    const bool custom_arbitrary_mipmaps, bool skip_texture_dump, TCacheEntry* placeholder)
 {
 #ifdef __APPLE__
   const bool no_mips = g_ActiveConfig.bNoMipmapping;
@@ -1682,23 +1976,43 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     entry = AllocateCacheEntry(config);
     if (!entry) [[unlikely]]
       return entry;
-    for (u32 data_index = 0; data_index < static_cast<u32>(assets_data.size()); data_index++)
+
+    // Upload the small levels now, and leave the large ones to StreamCustomTexture so that a
+    // texture pack doesn't stall the frame which first uses its textures.
+    u32 first_resident = texLevels - 1;
+    size_t immediate_size = GetCustomTextureLevelSize(assets_data, first_resident);
+    while (first_resident > 0)
     {
-      const auto& asset = assets_data[data_index];
-      const auto& slice = asset->m_texture.m_slices[0];
-      for (u32 level_index = 0;
-           level_index < std::min(texLevels, static_cast<u32>(slice.m_levels.size()));
-           ++level_index)
-      {
-        const auto& level = slice.m_levels[level_index];
-        entry->texture->Load(level_index, level.width, level.height, level.row_length,
-                             level.data.data(), level.data.size(), data_index);
-      }
+      const size_t size = GetCustomTextureLevelSize(assets_data, first_resident - 1);
+      if (immediate_size + size > CUSTOM_TEXTURE_IMMEDIATE_UPLOAD_SIZE)
+        break;
+      immediate_size += size;
+      first_resident--;
     }
+    for (u32 level_index = first_resident; level_index < texLevels; level_index++)
+      LoadCustomTextureLevel(*entry->texture, assets_data, level_index);
+
+    entry->first_resident_level = first_resident;
+    if (first_resident > 0)
+      entry->streaming_data = std::move(assets_data);
 
     entry->has_arbitrary_mips = custom_arbitrary_mipmaps;
     entry->is_custom_tex = true;
   }
+  else if (placeholder && CanDecodeTextureAsync(*placeholder, texture_info,
+                                                no_mips ? 1 : texture_info.GetLevelCount(),
+                                                skip_texture_dump))
+  {
+    entry = AllocateCacheEntry(placeholder->texture->GetConfig());
+    if (!entry) [[unlikely]]
+      return entry;
+
+    const u32 levels = entry->texture->GetConfig().levels;
+    StartAsyncDecode(*entry, *placeholder, texture_info, levels,
+                     {creation_info.full_hash, texture_info.GetRawWidth(),
+                      texture_info.GetRawHeight(), levels, texture_info.GetTextureFormat(),
+                      texture_info.GetTlutFormat()});
+  }
   else
   {
     const u32 texLevels = no_mips ? 1 : texture_info.GetLevelCount();
@@ -1715,25 +2029,64 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       return entry;
 
     // We can decode on the GPU if it is a supported format and the flag is enabled.
-    // Currently we don't decode RGBA8 textures from TMEM, as that would require copying from both
-    // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
-    // there's no conversion between formats. In the future this could be extended with a separate
-    // shader, however.
-    const bool decode_on_gpu =
-        g_ActiveConfig.UseGPUTextureDecoding() &&
-        !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
+    bool decoded_on_gpu = false;
+    if (g_ActiveConfig.UseGPUTextureDecoding())
+    {
+      const u8* data = texture_info.GetData();
+      if (texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8)
+      {
+        // Put the two banks back together, rather than needing a separate shader for them.
+        CheckTempSize(texture_info.GetTextureSize());
+        TexDecoder_InterleaveRGBA8FromTmem(m_temp, texture_info.GetData(),
+                                           texture_info.GetTmemOddAddress(), expanded_width,
+                                           expanded_height);
+        data = m_temp;
+      }
+
+      std::vector<GPUDecodeLevel> gpu_levels;
+      gpu_levels.reserve(texLevels);
+      gpu_levels.push_back(
+          {0, data, texture_info.GetTextureSize(), width, height, expanded_width, expanded_height,
+           creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth())});
+      for (u32 level = 1; level != texLevels; ++level)
+      {
+        auto mip_level = texture_info.GetMipMapLevel(level - 1);
+        if (!mip_level)
+          continue;
+
+        gpu_levels.push_back({level, mip_level->GetData(), mip_level->GetTextureSize(),
+                              mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                              mip_level->GetExpandedWidth(), mip_level->GetExpandedHeight(),
+                              creation_info.bytes_per_block * (mip_level->GetExpandedWidth() /
+                                                               texture_info.GetBlockWidth())});
+      }
+
+      decoded_on_gpu =
+          DecodeTextureOnGPU(entry, gpu_levels, texture_info.GetTextureFormat(),
+                             texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+    }
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
+    // Levels decoded on the CPU are uploaded in order once they are ready, so that earlier levels
+    // can be uploaded while later ones are still being decoded.
+    struct PendingUpload
+    {
+      u32 level;
+      u32 width;
+      u32 height;
+      u32 row_length;
+      const u8* data;
+      size_t size;
+      CPUDecodeJob* job;
+    };
+    std::vector<PendingUpload> pending_uploads;
+    std::deque<CPUDecodeJob> decode_jobs;
+
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    if (!decoded_on_gpu)
     {
       size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
@@ -1755,11 +2108,16 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
+      CPUDecodeJob* job = nullptr;
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        job = &decode_jobs.emplace_back();
+        if (!DecodeTextureOnCPU(*job, dst_buffer, texture_info.GetData(), expanded_width,
+                                expanded_height, texture_info.GetTextureFormat(),
+                                texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+        {
+          job = nullptr;
+        }
       }
       else
       {
@@ -1768,45 +2126,53 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                                        expanded_height);
       }
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
-
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+      pending_uploads.push_back(
+          {0, width, height, expanded_width, dst_buffer, decoded_texture_size, job});
 
       dst_buffer += decoded_texture_size;
-    }
 
-    for (u32 level = 1; level != texLevels; ++level)
-    {
-      auto mip_level = texture_info.GetMipMapLevel(level - 1);
-      if (!mip_level)
-        continue;
-
-      if (!decode_on_gpu ||
-          !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
-                              texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
-                              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
-                              mip_level->GetExpandedHeight(),
-                              creation_info.bytes_per_block *
-                                  (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
-                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+      for (u32 level = 1; level != texLevels; ++level)
       {
+        auto mip_level = texture_info.GetMipMapLevel(level - 1);
+        if (!mip_level)
+          continue;
+
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
+        CPUDecodeJob* job = &decode_jobs.emplace_back();
+        if (!DecodeTextureOnCPU(*job, dst_buffer, mip_level->GetData(),
+                                mip_level->GetExpandedWidth(), mip_level->GetExpandedHeight(),
+                                texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                                texture_info.GetTlutFormat()))
+        {
+          job = nullptr;
+        }
 
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
+        pending_uploads.push_back({level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                   mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size,
+                                   job});
 
         dst_buffer += decoded_mip_size;
       }
     }
 
-    entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+    for (const PendingUpload& upload : pending_uploads)
+    {
+      if (upload.job)
+        upload.job->done.Wait();
+
+      entry->texture->Load(upload.level, upload.width, upload.height, upload.row_length,
+                           upload.data, upload.size);
+      arbitrary_mip_detector.AddLevel(upload.width, upload.height, upload.row_length,
+                                      upload.data);
+    }
+
+    entry->has_arbitrary_mips = DetectArbitraryMipmaps(
+        arbitrary_mip_detector,
+        {creation_info.full_hash, width, height, texLevels, texture_info.GetTextureFormat(),
+         texture_info.GetTlutFormat()},
+        dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
     {
@@ -1825,18 +2191,18 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
+  const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
+                                         texture_info.GetTlutFormat());
+  entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
+                              full_format, false);
+
+  const auto iter = AddTextureByAddress(texture_info.GetRawAddress(), entry);
   if (safety_color_sample_size == 0 ||
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
   {
     entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
   }
-
-  const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
-                                         texture_info.GetTlutFormat());
-  entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
-                              full_format, false);
   entry->SetDimensions(texture_info.GetRawWidth(), texture_info.GetRawHeight(),
                        texture_info.GetLevelCount());
   entry->SetHashes(creation_info.base_hash, creation_info.full_hash);
@@ -1855,6 +2221,268 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   return entry;
 }
 
+void TextureCacheBase::StartAsyncDecode(TCacheEntry& entry, TCacheEntry& placeholder,
+                                        const TextureInfo& texture_info, u32 levels,
+                                        const ArbitraryMipmapKey& mipmap_key)
+{
+  auto decode = std::make_shared<AsyncTextureDecode>();
+  decode->format = texture_info.GetTextureFormat();
+  decode->tlut_format = texture_info.GetTlutFormat();
+  decode->mipmap_key = mipmap_key;
+
+  const auto add_level = [&decode](u32 level, const u8* data, size_t size, u32 width, u32 height,
+                                   u32 expanded_width, u32 expanded_height) {
+    decode->levels.push_back({level, width, height, expanded_width, expanded_height,
+                              decode->src.size(), decode->dst_size});
+    decode->src.insert(decode->src.end(), data, data + size);
+    decode->dst_size += size_t(expanded_width) * sizeof(u32) * expanded_height;
+  };
+
+  add_level(0, texture_info.GetData(), texture_info.GetTextureSize(), texture_info.GetRawWidth(),
+            texture_info.GetRawHeight(), texture_info.GetExpandedWidth(),
+            texture_info.GetExpandedHeight());
+  for (u32 level = 1; level < levels; ++level)
+  {
+    const auto mip_level = texture_info.GetMipMapLevel(level - 1);
+    if (!mip_level)
+      continue;
+
+    add_level(level, mip_level->GetData(), mip_level->GetTextureSize(), mip_level->GetRawWidth(),
+              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
+              mip_level->GetExpandedHeight());
+  }
+
+  // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+  decode->scratch_offset = decode->dst_size;
+  decode->dst_size += size_t(texture_info.GetExpandedWidth()) * sizeof(u32) *
+                      texture_info.GetExpandedHeight() * 5 / 16;
+
+  if (const std::optional<u32> palette_size = texture_info.GetPaletteSize())
+  {
+    const u8* const palette = texture_info.GetTlutAddress();
+    decode->palette.assign(palette, palette + *palette_size);
+  }
+
+  m_decode_workers[m_next_async_decode_worker++ % m_decode_workers.size()]->Push([decode] {
+    decode->dst.resize(decode->dst_size);
+    for (const AsyncTextureDecode::Level& level : decode->levels)
+    {
+      TexDecoder_Decode(decode->dst.data() + level.dst_offset,
+                        decode->src.data() + level.src_offset, level.expanded_width,
+                        level.expanded_height, decode->format, decode->palette.data(),
+                        decode->tlut_format);
+    }
+    decode->done.store(true, std::memory_order_release);
+    decode->done_event.Set();
+  });
+
+  // A stale entry may itself still be waiting for its decode.
+  if (placeholder.pending_decode)
+    FinishAsyncDecode(placeholder, false);
+
+  for (u32 level = 0; level < levels; ++level)
+  {
+    const MathUtil::Rectangle<int> rect = placeholder.texture->GetConfig().GetMipRect(level);
+    entry.texture->CopyRectangleFromTexture(placeholder.texture.get(), rect, 0, level, rect, 0,
+                                            level);
+  }
+
+  entry.has_arbitrary_mips = placeholder.has_arbitrary_mips;
+  entry.pending_decode = std::move(decode);
+}
+
+void TextureCacheBase::FinishAsyncDecode(TCacheEntry& entry, bool wait)
+{
+  AsyncTextureDecode& decode = *entry.pending_decode;
+  if (!decode.done.load(std::memory_order_acquire))
+  {
+    if (!wait)
+      return;
+
+    decode.done_event.Wait();
+  }
+
+  ArbitraryMipmapDetector arbitrary_mip_detector;
+  for (const AsyncTextureDecode::Level& level : decode.levels)
+  {
+    const u8* const data = decode.dst.data() + level.dst_offset;
+    const size_t size = size_t(level.expanded_width) * sizeof(u32) * level.expanded_height;
+    entry.texture->Load(level.level, level.width, level.height, level.expanded_width, data, size);
+    arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, data);
+  }
+  entry.has_arbitrary_mips = DetectArbitraryMipmaps(arbitrary_mip_detector, decode.mipmap_key,
+                                                    decode.dst.data() + decode.scratch_offset);
+
+  entry.pending_decode.reset();
+}
+
+bool TextureCacheBase::DetectArbitraryMipmaps(const ArbitraryMipmapDetector& detector,
+                                              const ArbitraryMipmapKey& key, u8* downsample_buffer)
+{
+  if (!detector.CanDetect())
+    return false;
+
+  // The results are tiny, but games which stream in lots of textures would still grow the map
+  // without bound, so just start over once it gets large.
+  if (m_arbitrary_mipmap_results.size() >= MAX_ARBITRARY_MIPMAP_RESULTS)
+    m_arbitrary_mipmap_results.clear();
+
+  const auto [iter, inserted] = m_arbitrary_mipmap_results.try_emplace(key, false);
+  if (inserted)
+    iter->second = detector.HasArbitraryMipmaps(downsample_buffer);
+  return iter->second;
+}
+
+void TextureCacheBase::StreamCustomTexture(TCacheEntry& entry, bool finish)
+{
+  while (entry.first_resident_level > 0 &&
+         (finish || m_custom_texture_streamed_bytes < CUSTOM_TEXTURE_STREAMING_BUDGET))
+  {
+    entry.first_resident_level--;
+    m_custom_texture_streamed_bytes +=
+        LoadCustomTextureLevel(*entry.texture, entry.streaming_data, entry.first_resident_level);
+  }
+
+  if (entry.first_resident_level == 0)
+    entry.streaming_data.clear();
+}
+
+static size_t GetTextureMemorySize(const TextureConfig& config)
+{
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(config.format);
+  size_t size = 0;
+  for (u32 level = 0; level < config.levels; level++)
+  {
+    const u32 height = std::max(config.height >> level, 1u);
+    size += config.GetMipStride(level) * ((height + block_size - 1) / block_size);
+  }
+  return size * config.layers;
+}
+
+void TextureCacheBase::EvictCustomTextures(int frame_count)
+{
+  if (g_ActiveConfig.iHiresTextureVRAMBudget <= 0)
+    return;
+
+  const size_t budget = static_cast<size_t>(g_ActiveConfig.iHiresTextureVRAMBudget) * 1024 * 1024;
+  size_t total_size = 0;
+  std::vector<std::pair<TexAddrCache::iterator, size_t>> candidates;
+  for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end(); ++iter)
+  {
+    const TCacheEntry& entry = *iter->second;
+    if (!entry.is_custom_tex)
+      continue;
+
+    const size_t size = GetTextureMemorySize(entry.texture->GetConfig());
+    total_size += size;
+
+    // Cleanup() has just stamped everything used this frame with the current frame count.
+    const bool bound = std::any_of(m_bound_textures.begin(), m_bound_textures.end(),
+                                   [&](const RcTcacheEntry& bound_entry) {
+                                     return bound_entry.get() == &entry;
+                                   });
+    if (entry.frameCount < frame_count && !bound)
+      candidates.emplace_back(iter, size);
+  }
+
+  if (total_size <= budget)
+    return;
+
+  std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first->second->frameCount < rhs.first->second->frameCount;
+  });
+  for (const auto& [iter, size] : candidates)
+  {
+    if (total_size <= budget)
+      break;
+
+    InvalidateTexture(iter);
+    total_size -= size;
+  }
+}
+
+void TextureCacheBase::EvictTextures(int frame_count)
+{
+  const bool has_budget = g_ActiveConfig.iTextureCacheVRAMBudget > 0;
+  if (!has_budget && !g_ActiveConfig.bOverlayStats)
+    return;
+
+  size_t pool_size = 0;
+  for (const auto& [config, pool_entry] : m_texture_pool)
+    pool_size += GetTextureMemorySize(pool_entry.texture->GetConfig());
+
+  // EFB copies can't be recreated once they're gone, so they're never evicted.
+  size_t cache_size = 0;
+  std::vector<std::pair<TexAddrCache::iterator, size_t>> candidates;
+  for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end(); ++iter)
+  {
+    const TCacheEntry& entry = *iter->second;
+    const size_t size = GetTextureMemorySize(entry.texture->GetConfig());
+    cache_size += size;
+
+    const bool bound = std::any_of(m_bound_textures.begin(), m_bound_textures.end(),
+                                   [&](const RcTcacheEntry& bound_entry) {
+                                     return bound_entry.get() == &entry;
+                                   });
+    if (!entry.IsCopy() && entry.frameCount < frame_count && !bound)
+      candidates.emplace_back(iter, size);
+  }
+
+  size_t total_size = pool_size + cache_size;
+  const size_t budget = static_cast<size_t>(g_ActiveConfig.iTextureCacheVRAMBudget) * 1024 * 1024;
+  if (has_budget && total_size > budget)
+  {
+    // Invalidated entries release their textures to the pool, so entries are only invalidated
+    // until the pool holds enough to get back under the budget, then the pool is trimmed.
+    // Entries that were used long ago and take up a lot of memory go first.
+    const size_t excess = total_size - budget;
+    if (pool_size < excess)
+    {
+      const auto score = [frame_count](const auto& candidate) {
+        const int age = frame_count - candidate.first->second->frameCount;
+        return static_cast<u64>(age) * candidate.second;
+      };
+      std::sort(candidates.begin(), candidates.end(),
+                [&score](const auto& lhs, const auto& rhs) { return score(lhs) > score(rhs); });
+
+      size_t released_size = pool_size;
+      for (const auto& [iter, size] : candidates)
+      {
+        if (released_size >= excess)
+          break;
+
+        InvalidateTexture(iter);
+        released_size += size;
+      }
+    }
+
+    std::vector<std::pair<TexPool::iterator, size_t>> pooled;
+    for (auto iter = m_texture_pool.begin(); iter != m_texture_pool.end(); ++iter)
+      pooled.emplace_back(iter, GetTextureMemorySize(iter->second.texture->GetConfig()));
+    std::sort(pooled.begin(), pooled.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+    // Recount, since not every invalidated entry necessarily gave up its texture yet.
+    total_size = 0;
+    for (const auto& [iter, size] : pooled)
+      total_size += size;
+    for (const auto& [address, entry] : m_textures_by_address)
+      total_size += GetTextureMemorySize(entry->texture->GetConfig());
+
+    for (const auto& [iter, size] : pooled)
+    {
+      if (total_size <= budget)
+        break;
+
+      m_texture_pool.erase(iter);
+      total_size -= size;
+      g_stats.num_textures_evicted++;
+    }
+  }
+
+  g_stats.texture_memory_mib = static_cast<int>(total_size / (1024 * 1024));
+}
+
 static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
                                       MathUtil::Rectangle<int>* display_rect)
 {
@@ -1880,8 +2508,16 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
     return {};
   }
 
+  // Is the VI presenting the copy which was just made?
+  RcTcacheEntry entry = GetLatestXFBCopy(address, width, height, stride);
+  if (entry)
+  {
+    GetDisplayRectForXFBEntry(entry.get(), width, height, display_rect);
+    return entry;
+  }
+
   // Do we currently have a mutable version of this XFB copy in VRAM?
-  RcTcacheEntry entry = GetXFBFromCache(address, width, height, stride);
+  entry = GetXFBFromCache(address, width, height, stride);
   if (entry && !entry->IsLocked())
   {
     if (entry->is_xfb_container)
@@ -1910,9 +2546,10 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->is_custom_tex = false;
   entry->may_have_overlapping_textures = false;
   entry->frameCount = FRAMECOUNT_INVALID;
+  const GPUDecodeLevel gpu_level = {0, src_data, total_size, width, height, width, height, stride};
   if (!g_ActiveConfig.UseGPUTextureDecoding() ||
-      !DecodeTextureOnGPU(entry, 0, src_data, total_size, entry->format.texfmt, width, height,
-                          width, height, stride, s_tex_mem.data(), entry->format.tlutfmt))
+      !DecodeTextureOnGPU(entry, {&gpu_level, 1}, entry->format.texfmt, s_tex_mem.data(),
+                          entry->format.tlutfmt))
   {
     const u32 decoded_size = width * height * sizeof(u32);
     CheckTempSize(decoded_size);
@@ -1925,7 +2562,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddTextureByAddress(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -1983,6 +2620,27 @@ RcTcacheEntry TextureCacheBase::GetXFBFromCache(u32 address, u32 width, u32 heig
   return {};
 }
 
+RcTcacheEntry TextureCacheBase::GetLatestXFBCopy(u32 address, u32 width, u32 height, u32 stride)
+{
+  // Only the first fetch after the copy can use it, so that an XFB which is presented repeatedly
+  // still gets checked for changes to guest memory.
+  RcTcacheEntry entry = std::move(m_latest_xfb_copy);
+  if (!entry || entry->invalidated || entry->IsLocked() || entry->addr != address ||
+      entry->memory_stride != stride || entry->native_width < width ||
+      entry->native_height < height || entry->may_have_overlapping_textures ||
+      entry->reference_changed)
+  {
+    return {};
+  }
+
+  // When the copy wasn't written to guest memory, nothing there can be newer than the copy, so
+  // hashing the whole XFB can be skipped.
+  if (m_latest_xfb_copy_in_ram && entry->hash != entry->CalculateHash())
+    return {};
+
+  return entry;
+}
+
 void TextureCacheBase::StitchXFBCopy(RcTcacheEntry& stitched_entry)
 {
   // It is possible that some of the overlapping textures overlap each other. This behavior has been
@@ -2540,7 +3198,16 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    if (is_xfb_copy)
+    {
+      m_latest_xfb_copy = entry;
+      m_latest_xfb_copy_in_ram = copy_to_ram;
+    }
+    AddTextureByAddress(dstAddr, std::move(entry));
+  }
+  else if (is_xfb_copy)
+  {
+    m_latest_xfb_copy.reset();
   }
 }
 
@@ -2554,6 +3221,31 @@ void TextureCacheBase::FlushEFBCopies()
   m_pending_efb_copies.clear();
 }
 
+void TextureCacheBase::FlushEFBCopiesForSync()
+{
+  if (g_ActiveConfig.bDeferEFBCopiesToFrameEnd)
+    return;
+
+  FlushEFBCopies();
+}
+
+void TextureCacheBase::FlushEFBCopiesInRange(u32 address, u32 size)
+{
+  const auto overlaps = [address, size](const RcTcacheEntry& entry) {
+    const u32 covered_range = entry->pending_efb_copy_height * entry->memory_stride;
+    return entry->addr < address + size && address < entry->addr + covered_range;
+  };
+  const auto last_overlapping =
+      std::find_if(m_pending_efb_copies.rbegin(), m_pending_efb_copies.rend(), overlaps);
+  if (last_overlapping == m_pending_efb_copies.rend())
+    return;
+
+  const auto end = last_overlapping.base();
+  for (auto iter = m_pending_efb_copies.begin(); iter != end; ++iter)
+    FlushEFBCopy(iter->get());
+  m_pending_efb_copies.erase(m_pending_efb_copies.begin(), end);
+}
+
 void TextureCacheBase::FlushStaleBinds()
 {
   for (u32 i = 0; i < m_bound_textures.size(); i++)
@@ -2767,17 +3459,22 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddTextureByAddress(u32 addr,
+                                                                               RcTcacheEntry entry)
+{
+  m_largest_texture_size = std::max(m_largest_texture_size, entry->size_in_bytes);
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
   // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
+  // which end after the given addr. But no texture in the cache is larger than the largest one
+  // we've added, so we look for all textures which have a start address bigger than addr minus
+  // that size. This yields false-positives which must be checked later on, but far fewer than
+  // assuming the worst-case 1024x1024 RGBA8 texture, as most textures in a game are much smaller.
+  const u32 lower_addr = addr > m_largest_texture_size ? addr - m_largest_texture_size : 0;
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
 
@@ -2828,7 +3525,10 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   }
   entry->invalidated = true;
 
-  return m_textures_by_address.erase(iter);
+  auto next = m_textures_by_address.erase(iter);
+  if (m_textures_by_address.empty())
+    m_largest_texture_size = 0;
+  return next;
 }
 
 void TextureCacheBase::ReleaseToPool(TCacheEntry* entry)
@@ -2856,8 +3556,8 @@ bool TextureCacheBase::CreateUtilityTextures()
   if (g_ActiveConfig.backend_info.bSupportsGPUTextureDecoding)
   {
     constexpr TextureConfig decoding_texture_config(
-        1024, 1024, 1, 1, 1, AbstractTextureFormat::RGBA8, AbstractTextureFlag_ComputeImage,
-        AbstractTextureType::Texture_2DArray);
+        DECODING_TEXTURE_SIZE, DECODING_TEXTURE_SIZE, 1, 1, 1, AbstractTextureFormat::RGBA8,
+        AbstractTextureFlag_ComputeImage, AbstractTextureType::Texture_2DArray);
     m_decoding_texture =
         g_gfx->CreateTexture(decoding_texture_config, "GPU texture decoding texture");
     if (!m_decoding_texture)
@@ -2887,6 +3587,12 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
     return;
   }
 
+  if (g_gpu_timing_query)
+  {
+    g_gpu_timing_query->SetPass(entry->is_xfb_copy ? GPUTimingPass::XFBCopy :
+                                                     GPUTimingPass::EFBCopy);
+  }
+
   const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
   const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
       scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
@@ -2961,6 +3667,12 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
     return;
   }
 
+  if (g_gpu_timing_query)
+  {
+    g_gpu_timing_query->SetPass(params.copy_format == EFBCopyFormat::XFB ? GPUTimingPass::XFBCopy :
+                                                                            GPUTimingPass::EFBCopy);
+  }
+
   const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
   const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
       scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
@@ -3023,10 +3735,9 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
   g_vertex_manager->OnEFBCopyToRAM();
 }
 
-bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, const u8* data,
-                                          u32 data_size, TextureFormat format, u32 width,
-                                          u32 height, u32 aligned_width, u32 aligned_height,
-                                          u32 row_stride, const u8* palette,
+bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry,
+                                          std::span<const GPUDecodeLevel> levels,
+                                          TextureFormat format, const u8* palette,
                                           TLUTFormat palette_format)
 {
   const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format);
@@ -3042,46 +3753,117 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
   const u32 bytes_per_buffer_elem =
       VertexManagerBase::GetTexelBufferElementSize(info->buffer_format);
 
-  // Allocate space in stream buffer, and copy texture + palette across.
-  u32 src_offset = 0, palette_offset = 0;
-  if (info->palette_size > 0)
+  // Set up uniforms, one region of the decoding texture per level.
+  struct DecodingRegion
   {
-    if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset,
-                                             palette, info->palette_size,
-                                             TEXEL_BUFFER_FORMAT_R16_UINT, &palette_offset))
+    u32 dst_x, dst_y;
+    u32 src_width, src_height;
+    u32 src_offset, src_row_stride;
+    u32 palette_offset, unused;
+  };
+  std::array<DecodingRegion, TextureConversionShaderTiled::MAX_DECODING_REGIONS> uniforms = {};
+
+  while (!levels.empty())
+  {
+    // Mipmap chains are packed with the first level at the top, and the remaining ones in a row
+    // below it. Whatever doesn't fit is left for the next dispatch.
+    u32 dst_x = 0;
+    u32 dst_y = 0;
+    size_t count = 0;
+    for (const GPUDecodeLevel& level : levels)
     {
-      return false;
+      if (count == uniforms.size() || dst_x + level.aligned_width > DECODING_TEXTURE_SIZE ||
+          dst_y + level.aligned_height > DECODING_TEXTURE_SIZE)
+      {
+        break;
+      }
+
+      uniforms[count] = {dst_x, dst_y, level.aligned_width, level.aligned_height,
+                         0,     0,     0,                   0};
+      if (count == 0)
+        dst_y = level.aligned_height;
+      else
+        dst_x += level.aligned_width;
+      count++;
     }
-  }
-  else
-  {
-    if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset))
+    if (count == 0)
       return false;
+
+    const std::span<const GPUDecodeLevel> batch = levels.first(count);
+    levels = levels.subspan(count);
+
+    // Levels from RAM follow each other, so they can be uploaded directly.
+    const u8* data = batch[0].data;
+    u32 data_size = 0;
+    bool contiguous = true;
+    for (const GPUDecodeLevel& level : batch)
+    {
+      contiguous &= level.data == data + data_size;
+      data_size = Common::AlignUp(data_size + level.data_size, bytes_per_buffer_elem);
+    }
+    if (!contiguous)
+    {
+      m_decoding_upload_buffer.resize(data_size);
+      u32 offset = 0;
+      for (const GPUDecodeLevel& level : batch)
+      {
+        std::memcpy(m_decoding_upload_buffer.data() + offset, level.data, level.data_size);
+        offset = Common::AlignUp(offset + level.data_size, bytes_per_buffer_elem);
+      }
+      data = m_decoding_upload_buffer.data();
+    }
+
+    // Allocate space in stream buffer, and copy texture + palette across.
+    u32 src_offset = 0, palette_offset = 0;
+    if (info->palette_size > 0)
+    {
+      if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset,
+                                               palette, info->palette_size,
+                                               TEXEL_BUFFER_FORMAT_R16_UINT, &palette_offset))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset))
+        return false;
+    }
+
+    std::pair<u32, u32> dispatch_groups = {0, 0};
+    u32 level_offset = 0;
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+      uniforms[i].src_offset = src_offset + level_offset / bytes_per_buffer_elem;
+      uniforms[i].src_row_stride = batch[i].row_stride / bytes_per_buffer_elem;
+      uniforms[i].palette_offset = palette_offset;
+      level_offset = Common::AlignUp(level_offset + batch[i].data_size, bytes_per_buffer_elem);
+
+      const auto level_groups = TextureConversionShaderTiled::GetDispatchCount(
+          info, batch[i].aligned_width, batch[i].aligned_height);
+      dispatch_groups.first = std::max(dispatch_groups.first, level_groups.first);
+      dispatch_groups.second = std::max(dispatch_groups.second, level_groups.second);
+    }
+
+    g_vertex_manager->UploadUtilityUniforms(uniforms.data(), sizeof(uniforms));
+    g_gfx->SetComputeImageTexture(0, m_decoding_texture.get(), false, true);
+    g_gfx->DispatchComputeShader(shader, info->group_size_x, info->group_size_y, 1,
+                                 dispatch_groups.first, dispatch_groups.second,
+                                 static_cast<u32>(batch.size()));
+
+    // Copy from decoding texture -> final texture
+    // This is because we don't want to have to create compute view for every layer
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+      const auto dst_rect = entry->texture->GetConfig().GetMipRect(batch[i].dst_level);
+      const MathUtil::Rectangle<int> src_rect(
+          uniforms[i].dst_x, uniforms[i].dst_y, uniforms[i].dst_x + dst_rect.GetWidth(),
+          uniforms[i].dst_y + dst_rect.GetHeight());
+      entry->texture->CopyRectangleFromTexture(m_decoding_texture.get(), src_rect, 0, 0, dst_rect,
+                                               0, batch[i].dst_level);
+    }
   }
 
-  // Set up uniforms.
-  struct Uniforms
-  {
-    u32 dst_width, dst_height;
-    u32 src_width, src_height;
-    u32 src_offset, src_row_stride;
-    u32 palette_offset, unused;
-  } uniforms = {width,          height,     aligned_width,
-                aligned_height, src_offset, row_stride / bytes_per_buffer_elem,
-                palette_offset};
-  g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
-  g_gfx->SetComputeImageTexture(0, m_decoding_texture.get(), false, true);
-
-  auto dispatch_groups =
-      TextureConversionShaderTiled::GetDispatchCount(info, aligned_width, aligned_height);
-  g_gfx->DispatchComputeShader(shader, info->group_size_x, info->group_size_y, 1,
-                               dispatch_groups.first, dispatch_groups.second, 1);
-
-  // Copy from decoding texture -> final texture
-  // This is because we don't want to have to create compute view for every layer
-  const auto copy_rect = entry->texture->GetConfig().GetMipRect(dst_level);
-  entry->texture->CopyRectangleFromTexture(m_decoding_texture.get(), copy_rect, 0, 0, copy_rect, 0,
-                                           dst_level);
   entry->texture->FinishedRendering();
   return true;
 }
@@ -6,9 +6,11 @@
 #include <array>
 #include <filesystem>
 #include <fmt/format.h>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -20,6 +22,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
@@ -32,7 +35,9 @@
 
 class AbstractFramebuffer;
 class AbstractStagingTexture;
+class ArbitraryMipmapDetector;
 class PointerWrap;
+struct AsyncTextureDecode;
 struct SamplerState;
 struct VideoConfig;
 
@@ -68,6 +73,23 @@ struct TextureAndTLUTFormat
   TLUTFormat tlutfmt;
 };
 
+// Identifies the decoded contents of a texture for the arbitrary mipmap detection.
+struct ArbitraryMipmapKey
+{
+  bool operator<(const ArbitraryMipmapKey& rhs) const
+  {
+    return std::tie(hash, width, height, levels, format, tlut_format) <
+           std::tie(rhs.hash, rhs.width, rhs.height, rhs.levels, rhs.format, rhs.tlut_format);
+  }
+
+  u64 hash = 0;
+  u32 width = 0;
+  u32 height = 0;
+  u32 levels = 0;
+  TextureFormat format = TextureFormat::I4;
+  TLUTFormat tlut_format = TLUTFormat::IA8;
+};
+
 struct EFBCopyParams
 {
   EFBCopyParams(PixelFormat efb_format_, EFBCopyFormat copy_format_, bool depth_, bool yuv_,
@@ -133,6 +155,14 @@ struct TCacheEntry
   bool may_have_overlapping_textures = true;
   // indicates that the mips in this texture are arbitrary content, aren't just downscaled
   bool has_arbitrary_mips = false;
+  // Set while the texture is still being decoded in the background. Until then, the texture holds
+  // the contents of the stale entry it replaced.
+  std::shared_ptr<AsyncTextureDecode> pending_decode;
+  // Custom textures upload their larger levels over several frames. Levels below
+  // first_resident_level haven't been uploaded yet and aren't sampled, streaming_data keeps the
+  // data they're uploaded from until then.
+  std::vector<std::shared_ptr<VideoCommon::TextureData>> streaming_data;
+  u32 first_resident_level = 0;
   bool should_force_safe_hashing = false;  // for XFB
   bool is_xfb_copy = false;
   bool is_xfb_container = false;
@@ -296,6 +326,15 @@ public:
   // Flushes all pending EFB copies to emulated RAM.
   void FlushEFBCopies();
 
+  // Called when the game synchronizes with the GPU (draw done and PE tokens), after which the CPU
+  // may read the results of EFB copies. Leaves the copies pending until the end of the frame if
+  // the DeferEFBCopiesToFrameEnd hack is enabled.
+  void FlushEFBCopiesForSync();
+
+  // Flushes the pending EFB copies that the GPU is about to read back from the given range of
+  // emulated RAM, along with any older copies so that overlapping copies land in order.
+  void FlushEFBCopiesInRange(u32 address, u32 size);
+
   // Flush any Bound textures that can't be reused
   void FlushStaleBinds();
 
@@ -311,18 +350,30 @@ public:
 
   // Get a new sampler state
   static SamplerState GetSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
-                                      bool has_arbitrary_mips);
+                                      bool has_arbitrary_mips, u32 first_resident_level);
 
 protected:
-  // Decodes the specified data to the GPU texture specified by entry.
-  // Returns false if the configuration is not supported.
+  // A level of a texture to decode on the GPU.
   // width, height are the size of the image in pixels.
   // aligned_width, aligned_height are the size of the image in pixels, aligned to the block size.
   // row_stride is the number of bytes for a row of blocks, not pixels.
-  bool DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, const u8* data, u32 data_size,
-                          TextureFormat format, u32 width, u32 height, u32 aligned_width,
-                          u32 aligned_height, u32 row_stride, const u8* palette,
-                          TLUTFormat palette_format);
+  struct GPUDecodeLevel
+  {
+    u32 dst_level;
+    const u8* data;
+    u32 data_size;
+    u32 width;
+    u32 height;
+    u32 aligned_width;
+    u32 aligned_height;
+    u32 row_stride;
+  };
+
+  // Decodes the specified levels to the GPU texture specified by entry. Levels which fit into the
+  // decoding texture together are decoded by a single dispatch.
+  // Returns false if the configuration is not supported.
+  bool DecodeTextureOnGPU(RcTcacheEntry& entry, std::span<const GPUDecodeLevel> levels,
+                          TextureFormat format, const u8* palette, TLUTFormat palette_format);
 
   virtual void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
                        u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
@@ -339,6 +390,8 @@ protected:
   size_t m_temp_size = 0;
 
 private:
+  using DecodeWorker = Common::WorkQueueThread<std::function<void()>>;
+
   using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
   using TexHashCache = std::multimap<u64, RcTcacheEntry>;
 
@@ -356,9 +409,11 @@ private:
   CreateTextureEntry(const TextureCreationInfo& creation_info, const TextureInfo& texture_info,
                      int safety_color_sample_size,
                      std::vector<std::shared_ptr<VideoCommon::TextureData>> assets_data,
-                     bool custom_arbitrary_mipmaps, bool skip_texture_dump);
+                     bool custom_arbitrary_mipmaps, bool skip_texture_dump,
+                     TCacheEntry* placeholder);
 
   RcTcacheEntry GetXFBFromCache(u32 address, u32 width, u32 height, u32 stride);
+  RcTcacheEntry GetLatestXFBCopy(u32 address, u32 width, u32 height, u32 stride);
 
   RcTcacheEntry ApplyPaletteToEntry(RcTcacheEntry& entry, const u8* palette, TLUTFormat tlutfmt);
 
@@ -370,11 +425,45 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  struct CPUDecodeJob;
+  // Decodes a texture level on the CPU. Large levels are split into bands of block rows which are
+  // decoded in parallel by m_decode_workers, and job is signalled once they are all done. Returns
+  // false if the level was decoded right away instead.
+  bool DecodeTextureOnCPU(CPUDecodeJob& job, u8* dst, const u8* src, u32 width, u32 height,
+                          TextureFormat format, const u8* tlut, TLUTFormat tlut_format);
+
+  // Queues all levels of the texture to be decoded on one of m_decode_workers, and fills the entry
+  // with the contents of placeholder in the meantime.
+  void StartAsyncDecode(TCacheEntry& entry, TCacheEntry& placeholder,
+                        const TextureInfo& texture_info, u32 levels,
+                        const ArbitraryMipmapKey& mipmap_key);
+  // Uploads the levels of an asynchronously decoded texture. If wait is false and the decode
+  // hasn't finished yet, the entry keeps showing the placeholder.
+  void FinishAsyncDecode(TCacheEntry& entry, bool wait);
+
+  // Runs the arbitrary mipmap detection on the decoded levels of a texture, unless it has already
+  // been run for a texture with the same contents.
+  bool DetectArbitraryMipmaps(const ArbitraryMipmapDetector& detector,
+                              const ArbitraryMipmapKey& key, u8* downsample_buffer);
+
+  // Uploads the next levels of a streamed custom texture until this frame's upload budget is used
+  // up, or all of its remaining levels if finish is set.
+  void StreamCustomTexture(TCacheEntry& entry, bool finish);
+  // Invalidates the least recently used custom textures not in use this frame until they fit in
+  // the configured VRAM budget.
+  void EvictCustomTextures(int frame_count);
+  // Evicts textures from the pool, then textures not in use this frame that can be decoded again,
+  // until the cache fits in the configured VRAM budget. Old and large textures go first.
+  void EvictTextures(int frame_count);
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Inserts an entry into m_textures_by_address. Its size_in_bytes must already be set.
+  TexAddrCache::iterator AddTextureByAddress(u32 addr, RcTcacheEntry entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -412,6 +501,10 @@ private:
   // but it's possible for invalidated TCache entries to live on elsewhere
   TexAddrCache m_textures_by_address;
 
+  // The largest size_in_bytes of any entry added to m_textures_by_address since it was last empty.
+  // Bounds how far back FindOverlappingTextures has to look.
+  u32 m_largest_texture_size = 0;
+
   // m_textures_by_hash is an alternative view of the texture cache
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
@@ -437,6 +530,7 @@ private:
     bool gpu_texture_decoding;
     bool disable_vram_copies;
     bool arbitrary_mipmap_detection;
+    float arbitrary_mipmap_detection_threshold;
     bool graphics_mods;
     u32 graphics_mod_change_count;
   };
@@ -448,6 +542,19 @@ private:
 
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
+  // Levels which aren't contiguous in memory are gathered here to upload them together.
+  std::vector<u8> m_decoding_upload_buffer;
+
+  // Results of the arbitrary mipmap detection, as it has to downsample every level of a texture
+  // and the same texture is often decoded again, e.g. after being evicted from the cache.
+  std::map<ArbitraryMipmapKey, bool> m_arbitrary_mipmap_results;
+
+  // Threads used to decode large textures on the CPU. Empty on machines with only a few cores.
+  std::vector<std::unique_ptr<DecodeWorker>> m_decode_workers;
+  size_t m_next_async_decode_worker = 0;
+
+  // Bytes of streamed custom texture levels uploaded during the current frame.
+  size_t m_custom_texture_streamed_bytes = 0;
 
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
@@ -457,6 +564,11 @@ private:
   // It's valid for textures to live be in here after they've been invalidated
   std::vector<RcTcacheEntry> m_pending_efb_copies;
 
+  // The latest XFB copy to VRAM since the VI last fetched an XFB. Most games present exactly this
+  // copy, which can then be scanned out without searching and hashing the cache.
+  RcTcacheEntry m_latest_xfb_copy;
+  bool m_latest_xfb_copy_in_ram = false;
+
   // Staging texture used for readbacks.
   // We store this in the class so that the same staging texture can be used for multiple
   // readbacks, saving the overhead of allocating a new buffer every time.
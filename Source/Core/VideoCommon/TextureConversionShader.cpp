@@ -512,35 +512,52 @@ static const char decoding_shader_header[] = R"(
 #define HAS_PALETTE 1
 #endif
 
+// Several images can be decoded by a single dispatch, each one by a separate Z group, and written
+// to its own region of the output image.
+struct DecodingRegion {
+  uint2 dst_offset;
+  uint2 src_size;
+  uint src_offset;
+  uint src_row_stride;
+  uint palette_offset;
+};
+
 UBO_BINDING(std140, 1) uniform UBO {
-  uint2 u_dst_size;
-  uint2 u_src_size;
-  uint u_src_offset;
-  uint u_src_row_stride;
-  uint u_palette_offset;
+  DecodingRegion u_regions[MAX_DECODING_REGIONS];
 };
 
+#define u_src_size u_regions[gl_WorkGroupID.z].src_size
+#define u_src_offset u_regions[gl_WorkGroupID.z].src_offset
+#define u_src_row_stride u_regions[gl_WorkGroupID.z].src_row_stride
+#define u_palette_offset u_regions[gl_WorkGroupID.z].palette_offset
+
+// The dispatch is sized for the largest image, so texels outside of smaller ones are discarded.
+#define STORE_TEXEL(coords, color) \
+  if (all(lessThan((coords), u_src_size))) \
+    imageStore(output_image, int3(int2((coords) + u_regions[gl_WorkGroupID.z].dst_offset), 0), \
+               (color))
+
 #if defined(API_METAL)
 
 #if defined(TEXEL_BUFFER_FORMAT_R8)
   SSBO_BINDING(0) readonly buffer Input { uint8_t s_input_buffer[]; };
-  #define FETCH(offset) uint(s_input_buffer[offset])
+  #define FETCH(offset) uint(s_input_buffer[(offset) + u_src_offset])
 #elif defined(TEXEL_BUFFER_FORMAT_R16)
   SSBO_BINDING(0) readonly buffer Input { uint16_t s_input_buffer[]; };
-  #define FETCH(offset) uint(s_input_buffer[offset])
+  #define FETCH(offset) uint(s_input_buffer[(offset) + u_src_offset])
 #elif defined(TEXEL_BUFFER_FORMAT_RGBA8)
   SSBO_BINDING(0) readonly buffer Input { u8vec4 s_input_buffer[]; };
-  #define FETCH(offset) uvec4(s_input_buffer[offset])
+  #define FETCH(offset) uvec4(s_input_buffer[(offset) + u_src_offset])
 #elif defined(TEXEL_BUFFER_FORMAT_R32G32)
   SSBO_BINDING(0) readonly buffer Input { uvec2 s_input_buffer[]; };
-  #define FETCH(offset) s_input_buffer[offset]
+  #define FETCH(offset) s_input_buffer[(offset) + u_src_offset]
 #else
   #error No texel buffer?
 #endif
 
 #ifdef HAS_PALETTE
   SSBO_BINDING(1) readonly buffer Palette { uint16_t s_palette_buffer[]; };
-  #define FETCH_PALETTE(offset) uint(s_palette_buffer[offset])
+  #define FETCH_PALETTE(offset) uint(s_palette_buffer[(offset) + u_palette_offset])
 #endif
 
 #else
@@ -690,7 +707,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint4 color = uint4(i, i, i, i);
         float4 norm_color = float4(color) / 255.0;
 
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
 
       )"}},
@@ -709,7 +726,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint4 color = uint4(i, i, i, a);
         float4 norm_color = float4(color) / 255.0;
 
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
       )"}},
     {TextureFormat::I8,
@@ -725,7 +742,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint4 color = uint4(i, i, i, i);
         float4 norm_color = float4(color) / 255.0;
 
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
       )"}},
     {TextureFormat::IA8,
@@ -742,7 +759,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint i = (val >> 8);
         uint4 color = uint4(i, i, i, a);
         float4 norm_color = float4(color) / 255.0;
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
       )"}},
     {TextureFormat::RGB565,
@@ -763,7 +780,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         color.a = 255u;
 
         float4 norm_color = float4(color) / 255.0;
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
 
       )"}},
@@ -795,7 +812,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         }
 
         float4 norm_color = float4(color) / 255.0;
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
 
       )"}},
@@ -830,7 +847,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         color.b = (val2 >> 8);
 
         float4 norm_color = float4(color) / 255.0;
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
       )"}},
     {TextureFormat::CMPR,
@@ -945,7 +962,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
 
         // Normalize and write to the output image.
         float4 norm_color = float4(color & 0xFFu) / 255.0;
-        imageStore(output_image, int3(int2(uint2(global_x, global_y)), 0), norm_color);
+        STORE_TEXEL(uint2(global_x, global_y), norm_color);
       }
       )"}},
     {TextureFormat::C4,
@@ -971,7 +988,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint val = FETCH(buffer_pos);
         uint index = ((coords.x & 1u) == 0u) ? (val >> 4) : (val & 0x0Fu);
         float4 norm_color = GetPaletteColorNormalized(index);
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
 
       )"}},
@@ -987,7 +1004,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint buffer_pos = GetTiledTexelOffset(uint2(8u, 4u), coords);
         uint index = FETCH(buffer_pos);
         float4 norm_color = GetPaletteColorNormalized(index);
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
       )"}},
     {TextureFormat::C14X2,
@@ -1002,7 +1019,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
         uint buffer_pos = GetTiledTexelOffset(uint2(4u, 4u), coords);
         uint index = Swap16(FETCH(buffer_pos)) & 0x3FFFu;
         float4 norm_color = GetPaletteColorNormalized(index);
-        imageStore(output_image, int3(int2(coords), 0), norm_color);
+        STORE_TEXEL(coords, norm_color);
       }
       )"}},
 
@@ -1030,7 +1047,7 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
                         yComp + (2.018 * uComp),
                         255.0);
         float4 rgba_norm = rgb / 255.0;
-        imageStore(output_image, int3(int2(uv), 0), rgba_norm);
+        STORE_TEXEL(uv, rgba_norm);
       }
       )"}}};
 
@@ -1093,6 +1110,7 @@ std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTForma
     break;
   }
 
+  ss << "#define MAX_DECODING_REGIONS " << MAX_DECODING_REGIONS << "\n";
   ss << decoding_shader_header;
   ss << info->shader_body;
 
@@ -33,12 +33,16 @@ struct DecodingShaderInfo
   const char* shader_body;
 };
 
+// Maximum number of images which can be decoded by a single dispatch of a decoding shader. Each
+// image is decoded by a separate Z group, so this is enough for a full mipmap chain.
+constexpr u32 MAX_DECODING_REGIONS = 16;
+
 // Obtain shader information for the specified texture format.
 // If this format does not have a shader written for it, returns nullptr.
 const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format);
 
 // Determine how many thread groups should be dispatched for an image of the specified width/height.
-// First is the number of X groups, second is the number of Y groups, Z is always one.
+// First is the number of X groups, second is the number of Y groups. Z is the number of images.
 std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width, u32 height);
 
 // Returns the GLSL string containing the texture decoding shader for the specified format.
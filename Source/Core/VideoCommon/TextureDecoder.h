@@ -193,6 +193,10 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
                        const u8* tlut, TLUTFormat tlutfmt);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
+// Copies an RGBA8 texture from TMEM, which keeps the AR and GB halves of each block in separate
+// banks, to dst in the layout used for textures in RAM, so that it can be decoded like those.
+void TexDecoder_InterleaveRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
+                                        int height);
 void TexDecoder_DecodeTexel(u8* dst, std::span<const u8> src, int s, int t, int imageWidth,
                             TextureFormat texformat, std::span<const u8> tlut, TLUTFormat tlutfmt);
 void TexDecoder_DecodeTexelRGBA8FromTmem(u8* dst, std::span<const u8> src_ar,
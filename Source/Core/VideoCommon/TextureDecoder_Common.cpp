@@ -5,6 +5,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <span>
 
 #include "Common/CommonTypes.h"
@@ -700,6 +701,21 @@ void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb,
   }
 }
 
+void TexDecoder_InterleaveRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
+                                        int height)
+{
+  // Each 4x4 block takes 32 bytes in each bank, and 64 bytes in RAM with the AR half first.
+  const int num_blocks = ((width + 3) / 4) * ((height + 3) / 4);
+  for (int i = 0; i < num_blocks; ++i)
+  {
+    std::memcpy(dst, src_ar, 32);
+    std::memcpy(dst + 32, src_gb, 32);
+    dst += 64;
+    src_ar += 32;
+    src_gb += 32;
+  }
+}
+
 void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 stride)
 {
   const u8* src_ptr = src;
@@ -6,6 +6,10 @@
 #include <algorithm>
 #include <cmath>
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
@@ -226,6 +230,19 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   break;
   case TextureFormat::I8:  // speed critical
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; ++iy, src += 8)
+        {
+          u8* newdst = reinterpret_cast<u8*>(dst + (y + iy) * width + x);
+          // (hgfedcba) -> (hhggffeeddccbbaa) -> (hhhhggggffffeeee ddddccccbbbbaaaa)
+          const uint8x8_t i = vld1_u8(src);
+          const uint8x16_t ii = vcombine_u8(vzip1_u8(i, i), vzip2_u8(i, i));
+          vst1q_u8(newdst, vzip1q_u8(ii, ii));
+          vst1q_u8(newdst + 16, vzip2q_u8(ii, ii));
+        }
+#else
     // Reference C implementation
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 8)
@@ -252,6 +269,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           srcval = newsrc[0];
           newdst[0] = srcval | (srcval << 8) | (srcval << 16) | (srcval << 24);
         }
+#endif
   }
   break;
   case TextureFormat::C8:
@@ -270,6 +288,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   break;
   case TextureFormat::IA8:
   {
+#ifdef _M_ARM_64
+    // Each texel is stored as (alpha intensity), and expands to (intensity x3, alpha).
+    static constexpr u8 index_table[16] = {1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6};
+    const uint8x16_t indices = vld1q_u8(index_table);
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          const uint8x16_t ia = vcombine_u8(vld1_u8(src), vdup_n_u8(0));
+          vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), vqtbl1q_u8(ia, indices));
+        }
+#else
     // Reference C implementation:
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
@@ -282,6 +312,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           ptr[2] = DecodePixel_IA8(s[2]);
           ptr[3] = DecodePixel_IA8(s[3]);
         }
+#endif
   }
   break;
   case TextureFormat::C14X2:
@@ -315,6 +346,22 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   break;
   case TextureFormat::RGBA8:  // speed critical
   {
+#ifdef _M_ARM_64
+    // A row of a block is stored as 4x (A R) followed 32 bytes later by 4x (G B), and each texel
+    // expands to (R G B A).
+    static constexpr u8 index_table[16] = {1, 8, 9, 0, 3, 10, 11, 2, 5, 12, 13, 4, 7, 14, 15, 6};
+    const uint8x16_t indices = vld1q_u8(index_table);
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+      {
+        for (int iy = 0; iy < 4; iy++)
+        {
+          const uint8x16_t argb = vcombine_u8(vld1_u8(src + 8 * iy), vld1_u8(src + 32 + 8 * iy));
+          vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), vqtbl1q_u8(argb, indices));
+        }
+        src += 64;
+      }
+#else
     // Reference C implementation.
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
@@ -324,6 +371,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
                             (u16*)src + 4 * iy + 16);
         src += 64;
       }
+#endif
   }
   break;
   case TextureFormat::CMPR:  // speed critical
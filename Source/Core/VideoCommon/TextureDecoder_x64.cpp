@@ -394,6 +394,31 @@ static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same as the SSSE3 version, but a whole 8 texel row is expanded and stored at once.
+  const __m256i mask = _mm256_set_epi8(7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3,
+                                       2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; ++iy, xStep++)
+      {
+        // Broadcast the 8 texels to both lanes: (hgfe dcba hgfe dcba)
+        const __m256i r =
+            _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        // (hhhh gggg ffff eeee dddd cccc bbbb aaaa)
+        const __m256i rgba = _mm256_shuffle_epi8(r, mask);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), rgba);
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I8_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -579,6 +604,40 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same as the SSSE3 version, but the rows of two horizontally adjacent blocks are decoded at
+  // once, one block per lane.
+  const __m128i mask128 = _mm_set_epi8(6, 7, 7, 7, 4, 5, 5, 5, 2, 3, 3, 3, 0, 1, 1, 1);
+  const __m256i mask = _mm256_broadcastsi128_si256(mask128);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        const __m128i r1 = _mm_loadl_epi64((const __m128i*)(src + 8 * (xStep + 4)));
+        const __m256i r = _mm256_inserti128_si256(_mm256_castsi128_si256(r0), r1, 1);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), _mm256_shuffle_epi8(r, mask));
+      }
+    }
+    for (; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        _mm_storeu_si128((__m128i*)(dst + (y + iy) * width + x), _mm_shuffle_epi8(r0, mask128));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -1001,6 +1060,63 @@ static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same as the SSSE3 version, but two horizontally adjacent blocks are decoded at once, one
+  // block per lane, so that each store writes out a whole 8 texel row.
+  const __m128i mask128 = _mm_set_epi8(12, 15, 13, 14, 8, 11, 9, 10, 4, 7, 5, 6, 0, 3, 1, 2);
+  const __m256i mask0312 = _mm256_broadcastsi128_si256(mask128);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      // The low lane holds the block at x, the high lane the one at x + 4.
+      const __m128i* src_lo = (const __m128i*)(src + 64 * yStep);
+      const __m128i* src_hi = src_lo + 4;
+      const __m256i ar0 = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(_mm_loadu_si128(src_lo)), _mm_loadu_si128(src_hi), 1);
+      const __m256i ar1 = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(_mm_loadu_si128(src_lo + 1)), _mm_loadu_si128(src_hi + 1), 1);
+      const __m256i gb0 = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(_mm_loadu_si128(src_lo + 2)), _mm_loadu_si128(src_hi + 2), 1);
+      const __m256i gb1 = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(_mm_loadu_si128(src_lo + 3)), _mm_loadu_si128(src_hi + 3), 1);
+
+      const __m256i rgba00 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar0, gb0), mask0312);
+      const __m256i rgba01 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar0, gb0), mask0312);
+      const __m256i rgba10 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar1, gb1), mask0312);
+      const __m256i rgba11 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar1, gb1), mask0312);
+
+      _mm256_storeu_si256((__m256i*)(dst + (y + 0) * width + x), rgba00);
+      _mm256_storeu_si256((__m256i*)(dst + (y + 1) * width + x), rgba01);
+      _mm256_storeu_si256((__m256i*)(dst + (y + 2) * width + x), rgba10);
+      _mm256_storeu_si256((__m256i*)(dst + (y + 3) * width + x), rgba11);
+    }
+    for (; x < width; x += 4, yStep++)
+    {
+      const u8* src2 = src + 64 * yStep;
+      const __m128i ar0 = _mm_loadu_si128((const __m128i*)src2);
+      const __m128i ar1 = _mm_loadu_si128((const __m128i*)src2 + 1);
+      const __m128i gb0 = _mm_loadu_si128((const __m128i*)src2 + 2);
+      const __m128i gb1 = _mm_loadu_si128((const __m128i*)src2 + 3);
+
+      _mm_storeu_si128((__m128i*)(dst + (y + 0) * width + x),
+                       _mm_shuffle_epi8(_mm_unpacklo_epi8(ar0, gb0), mask128));
+      _mm_storeu_si128((__m128i*)(dst + (y + 1) * width + x),
+                       _mm_shuffle_epi8(_mm_unpackhi_epi8(ar0, gb0), mask128));
+      _mm_storeu_si128((__m128i*)(dst + (y + 2) * width + x),
+                       _mm_shuffle_epi8(_mm_unpacklo_epi8(ar1, gb1), mask128));
+      _mm_storeu_si128((__m128i*)(dst + (y + 3) * width + x),
+                       _mm_shuffle_epi8(_mm_unpackhi_epi8(ar1, gb1), mask128));
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGBA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                               TextureFormat texformat, const u8* tlut,
@@ -1434,7 +1550,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1450,7 +1569,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1478,7 +1600,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
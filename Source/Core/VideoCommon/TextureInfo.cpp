@@ -62,7 +62,8 @@ TextureInfo::TextureInfo(u32 stage, std::span<const u8> data, std::span<const u8
                          u32 width, u32 height, bool from_tmem, std::span<const u8> tmem_odd,
                          std::span<const u8> tmem_even, std::optional<u32> mip_count)
     : m_ptr(data.data()), m_tlut_ptr(tlut_data.data()), m_address(address), m_from_tmem(from_tmem),
-      m_tmem_odd(tmem_odd.data()), m_texture_format(texture_format), m_tlut_format(tlut_format),
+      m_tmem_odd(tmem_odd.data()),
+      m_tmem_odd_size(static_cast<u32>(tmem_odd.size())), m_texture_format(texture_format), m_tlut_format(tlut_format),
       m_raw_width(width), m_raw_height(height), m_stage(stage)
 {
   const bool is_palette_texture = IsColorIndexed(m_texture_format);
@@ -223,6 +224,11 @@ const u8* TextureInfo::GetTmemOddAddress() const
   return m_tmem_odd;
 }
 
+u32 TextureInfo::GetTmemOddSize() const
+{
+  return m_tmem_odd_size;
+}
+
 TextureFormat TextureInfo::GetTextureFormat() const
 {
   return m_texture_format;
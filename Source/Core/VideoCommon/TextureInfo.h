@@ -43,6 +43,7 @@ public:
 
   bool IsFromTmem() const;
   const u8* GetTmemOddAddress() const;
+  u32 GetTmemOddSize() const;
 
   TextureFormat GetTextureFormat() const;
   TLUTFormat GetTlutFormat() const;
@@ -109,6 +110,7 @@ private:
 
   bool m_from_tmem;
   const u8* m_tmem_odd;
+  u32 m_tmem_odd_size;
 
   TextureFormat m_texture_format;
   TLUTFormat m_tlut_format;
@@ -3,19 +3,29 @@
 
 #include "VideoCommon/TextureUtils.h"
 
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
 
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/AbstractTexture.h"
 
 namespace
 {
+constexpr u32 MAX_SAVE_WORKERS = 4;
+
 std::string BuildDumpTextureFilename(std::string basename, u32 level, bool is_arbitrary)
 {
   if (is_arbitrary)
@@ -47,6 +57,16 @@ void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 lev
   texture.Save(filename, level, Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
 }
 
+TextureDumper::TextureDumper() = default;
+
+TextureDumper::~TextureDumper()
+{
+  // The textures have to be read back before the backend goes away, so don't leave any for the
+  // destructors. The workers finish anything still queued when they shut down.
+  for (PendingDump& dump : m_pending_dumps)
+    SaveDump(dump);
+}
+
 void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                                 bool is_arbitrary)
 {
@@ -74,7 +94,66 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
   if (file_existed)
     return;
 
-  texture.Save(fmt::format("{}/{}.png", dump_dir, name), level,
-               Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
+  const u32 width = std::max(1u, texture.GetWidth() >> level);
+  const u32 height = std::max(1u, texture.GetHeight() >> level);
+  const TextureConfig config(width, height, 1, 1, 1, AbstractTextureFormat::RGBA8, 0,
+                             AbstractTextureType::Texture_2DArray);
+  auto readback_texture = g_gfx->CreateStagingTexture(StagingTextureType::Readback, config);
+  if (!readback_texture)
+    return;
+
+  // Only record the copy here. Mapping it straight away would stall until the GPU caught up.
+  readback_texture->CopyFromTexture(&texture, 0, level);
+  m_pending_dumps.push_back(
+      {std::move(readback_texture), fmt::format("{}/{}.png", dump_dir, name), m_frame_count});
+}
+
+void TextureDumper::OnFrameEnd()
+{
+  const u64 last_frame = m_frame_count++;
+  if (m_pending_dumps.empty())
+    return;
+
+  // Dumps made during the frame that just ended wait for the next one, to give the GPU time to
+  // finish the copies.
+  auto ready_end = std::find_if(m_pending_dumps.begin(), m_pending_dumps.end(),
+                                [last_frame](const PendingDump& dump) {
+                                  return dump.frame == last_frame;
+                                });
+  for (auto it = m_pending_dumps.begin(); it != ready_end; ++it)
+    SaveDump(*it);
+  m_pending_dumps.erase(m_pending_dumps.begin(), ready_end);
+}
+
+void TextureDumper::SaveDump(PendingDump& dump)
+{
+  AbstractStagingTexture* readback_texture = dump.readback_texture.get();
+  readback_texture->Flush();
+  if (!readback_texture->Map())
+    return;
+
+  const u32 width = readback_texture->GetWidth();
+  const u32 height = readback_texture->GetHeight();
+  std::vector<u8> texels(static_cast<size_t>(width) * height * 4);
+  readback_texture->ReadTexels(readback_texture->GetRect(), texels.data(), width * 4);
+
+  if (m_save_workers.empty())
+  {
+    const u32 save_workers =
+        std::clamp(std::thread::hardware_concurrency() / 2, 1u, MAX_SAVE_WORKERS);
+    for (u32 i = 0; i < save_workers; ++i)
+    {
+      m_save_workers.push_back(std::make_unique<SaveWorker>(
+          fmt::format("Texture Dumper {}", i), [](std::function<void()> work) { work(); }));
+    }
+  }
+
+  SaveWorker& worker = *m_save_workers[m_next_save_worker];
+  m_next_save_worker = (m_next_save_worker + 1) % m_save_workers.size();
+  worker.Push([filename = std::move(dump.filename), texels = std::move(texels), width, height,
+               compression = Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL)] {
+    Common::SavePNG(filename, texels.data(), Common::ImageByteFormat::RGBA, width, height,
+                    static_cast<int>(width * 4), compression);
+  });
 }
 }  // namespace VideoCommon::TextureUtils
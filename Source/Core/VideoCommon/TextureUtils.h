@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
+class AbstractStagingTexture;
 class AbstractTexture;
 
 namespace VideoCommon::TextureUtils
@@ -15,12 +20,38 @@ namespace VideoCommon::TextureUtils
 class TextureDumper
 {
 public:
+  TextureDumper();
+  ~TextureDumper();
+
   // Only dumps if texture did not already exist anywhere within the dump-textures path.
+  // The texture is copied to a staging texture and written out later, see OnFrameEnd().
   void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                    bool is_arbitrary);
 
+  // Reads back the dumps queued before the last frame, which the GPU has most likely finished
+  // copying by now, and hands them to the save workers.
+  void OnFrameEnd();
+
 private:
+  struct PendingDump
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    std::string filename;
+    u64 frame;
+  };
+
+  void SaveDump(PendingDump& dump);
+
   std::unordered_set<std::string> m_dumped_textures;
+
+  std::vector<PendingDump> m_pending_dumps;
+  u64 m_frame_count = 0;
+
+  // PNG compression is slow enough to cause stutter while dumping, so it's done off the GPU
+  // thread, spread over a few workers.
+  using SaveWorker = Common::WorkQueueThread<std::function<void()>>;
+  std::vector<std::unique_ptr<SaveWorker>> m_save_workers;
+  size_t m_next_save_worker = 0;
 };
 
 void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
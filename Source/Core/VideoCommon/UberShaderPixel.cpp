@@ -290,6 +290,17 @@ PixelShaderUid GetPixelShaderUid()
       (bpmem.zmode.testenable && bpmem.genMode.zfreeze);
   uid_data->uint_output = bpmem.blendmode.UseLogicOp();
 
+  const u32 num_tev_stages = bpmem.genMode.numtevstages + 1;
+  if (num_tev_stages <= 2)
+    uid_data->tev_stage_limit = 1;
+  else if (num_tev_stages <= 4)
+    uid_data->tev_stage_limit = 2;
+  else if (num_tev_stages <= 8)
+    uid_data->tev_stage_limit = 3;
+  uid_data->fog_disabled =
+      bpmem.fog.c_proj_fsel.fsel == FogType::Off || g_ActiveConfig.bDisableFog;
+  uid_data->alpha_test_disabled = bpmem.alpha_test.TestResult() == AlphaTestResult::Pass;
+
   return out;
 }
 
@@ -312,6 +323,18 @@ void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& hos
     uid_data->uint_output = 0;
 }
 
+bool ClearSpecializedPixelShaderUidBits(PixelShaderUid* uid)
+{
+  pixel_ubershader_uid_data* const uid_data = uid->GetUidData();
+  if (uid_data->tev_stage_limit == 0 && !uid_data->fog_disabled && !uid_data->alpha_test_disabled)
+    return false;
+
+  uid_data->tev_stage_limit = 0;
+  uid_data->fog_disabled = 0;
+  uid_data->alpha_test_disabled = 0;
+  return true;
+}
+
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data,
                           const CustomPixelShaderContents& custom_details)
@@ -397,7 +420,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                             GetInterpolationQualifier(msaa, ssaa, true, true), ShaderStage::Pixel);
 
     out.Write("}};\n\n");
-    if (stereo && !host_config.backend_gl_layer_in_fs)
+    if (stereo && !host_config.backend_multiview && !host_config.backend_gl_layer_in_fs)
       out.Write("flat in int layer;");
   }
   else
@@ -907,7 +930,11 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "  float4 ocol1;\n");
   }
 
-  if (host_config.backend_geometry_shaders && stereo)
+  if (stereo && host_config.backend_multiview)
+  {
+    out.Write("\tint layer = int(gl_ViewIndex);\n");
+  }
+  else if (host_config.backend_geometry_shaders && stereo)
   {
     if (host_config.backend_gl_layer_in_fs)
       out.Write("\tint layer = gl_Layer;\n");
@@ -947,8 +974,21 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   out.Write("  // Main tev loop\n");
 
-  out.Write("  for(uint stage = 0u; stage <= num_stages; stage++)\n"
-            "  {{\n"
+  if (uid_data->tev_stage_limit != 0)
+  {
+    // A constant trip count lets the compiler unroll the loop.
+    out.Write("  for(uint stage = 0u; stage < {}u; stage++)\n"
+              "  {{\n"
+              "    if (stage > num_stages)\n"
+              "      break;\n",
+              1u << uid_data->tev_stage_limit);
+  }
+  else
+  {
+    out.Write("  for(uint stage = 0u; stage <= num_stages; stage++)\n"
+              "  {{\n");
+  }
+  out.Write("    StageState ss;\n"
             "    StageState ss;\n"
             "    ss.stage = stage;\n"
             "    ss.cc = bpmem_combiners(stage).x;\n"
@@ -1402,27 +1442,30 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
     out.Write("  #define discard_fragment discard\n");
   }
 
-  out.Write("  if (bpmem_alphaTest != 0u) {{\n"
-            "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
-            BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
-  out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
-            BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
-  out.Write("\n"
-            "    // These if statements are written weirdly to work around intel and Qualcomm "
-            "bugs with handling booleans.\n"
-            "    switch ({}) {{\n",
-            BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
-  out.Write("    case 0u: // AND\n"
-            "      if (comp0 && comp1) break; else discard_fragment; break;\n"
-            "    case 1u: // OR\n"
-            "      if (comp0 || comp1) break; else discard_fragment; break;\n"
-            "    case 2u: // XOR\n"
-            "      if (comp0 != comp1) break; else discard_fragment; break;\n"
-            "    case 3u: // XNOR\n"
-            "      if (comp0 == comp1) break; else discard_fragment; break;\n"
-            "    }}\n"
-            "  }}\n"
-            "\n");
+  if (!uid_data->alpha_test_disabled)
+  {
+    out.Write("  if (bpmem_alphaTest != 0u) {{\n"
+              "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
+              BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
+    out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
+              BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
+    out.Write("\n"
+              "    // These if statements are written weirdly to work around intel and Qualcomm "
+              "bugs with handling booleans.\n"
+              "    switch ({}) {{\n",
+              BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
+    out.Write("    case 0u: // AND\n"
+              "      if (comp0 && comp1) break; else discard_fragment; break;\n"
+              "    case 1u: // OR\n"
+              "      if (comp0 || comp1) break; else discard_fragment; break;\n"
+              "    case 2u: // XOR\n"
+              "      if (comp0 != comp1) break; else discard_fragment; break;\n"
+              "    case 3u: // XNOR\n"
+              "      if (comp0 == comp1) break; else discard_fragment; break;\n"
+              "    }}\n"
+              "  }}\n"
+              "\n");
+  }
 
   out.Write("  // Hardware testing indicates that an alpha of 1 can pass an alpha test,\n"
             "  // but doesn't do anything in blending\n"
@@ -1444,67 +1487,71 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   // FIXME: Fog is implemented the same as ShaderGen, but ShaderGen's fog is all hacks.
   //        Should be fixed point, and should not make guesses about Range-Based adjustments.
-  out.Write("  // Fog\n"
-            "  uint fog_function = {};\n",
-            BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
-  out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
-  out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
-            "    float ze;\n"
-            "    if ({} == 0u) {{\n",
-            BitfieldExtract<&FogParam3::proj>("bpmem_fogParam3"));
-  out.Write("      // perspective\n"
-            "      // ze = A/(B - (Zs >> B_SHF)\n"
-            "      ze = (" I_FOGF ".x * 16777216.0) / float(" I_FOGI ".y - (zCoord >> " I_FOGI
-            ".w));\n"
-            "    }} else {{\n"
-            "      // orthographic\n"
-            "      // ze = a*Zs    (here, no B_SHF)\n"
-            "      ze = " I_FOGF ".x * float(zCoord) / 16777216.0;\n"
-            "    }}\n"
-            "\n"
-            "    if (bool({})) {{\n",
-            BitfieldExtract<&FogRangeParams::RangeBase::Enabled>("bpmem_fogRangeBase"));
-  out.Write("      // x_adjust = sqrt((x-center)^2 + k^2)/k\n"
-            "      // ze *= x_adjust\n"
-            "      float offset = (2.0 * (rawpos.x / " I_FOGF ".w)) - 1.0 - " I_FOGF ".z;\n"
-            "      float floatindex = clamp(9.0 - abs(offset) * 9.0, 0.0, 9.0);\n"
-            "      uint indexlower = uint(floatindex);\n"
-            "      uint indexupper = indexlower + 1u;\n"
-            "      float klower = " I_FOGRANGE "[indexlower >> 2u][indexlower & 3u];\n"
-            "      float kupper = " I_FOGRANGE "[indexupper >> 2u][indexupper & 3u];\n"
-            "      float k = lerp(klower, kupper, frac(floatindex));\n"
-            "      float x_adjust = sqrt(offset * offset + k * k) / k;\n"
-            "      ze *= x_adjust;\n"
-            "    }}\n"
-            "\n"
-            "    float fog = clamp(ze - " I_FOGF ".y, 0.0, 1.0);\n"
-            "\n");
-  out.Write("    if (fog_function >= {:s}) {{\n", FogType::Exp);
-  out.Write("      switch (fog_function) {{\n"
-            "      case {:s}:\n"
-            "        fog = 1.0 - exp2(-8.0 * fog);\n"
-            "        break;\n",
-            FogType::Exp);
-  out.Write("      case {:s}:\n"
-            "        fog = 1.0 - exp2(-8.0 * fog * fog);\n"
-            "        break;\n",
-            FogType::ExpSq);
-  out.Write("      case {:s}:\n"
-            "        fog = exp2(-8.0 * (1.0 - fog));\n"
-            "        break;\n",
-            FogType::BackwardsExp);
-  out.Write("      case {:s}:\n"
-            "        fog = 1.0 - fog;\n"
-            "        fog = exp2(-8.0 * fog * fog);\n"
-            "        break;\n",
-            FogType::BackwardsExpSq);
-  out.Write("      }}\n"
-            "    }}\n"
-            "\n"
-            "    int ifog = iround(fog * 256.0);\n"
-            "    TevResult.rgb = (TevResult.rgb * (256 - ifog) + " I_FOGCOLOR ".rgb * ifog) >> 8;\n"
-            "  }}\n"
-            "\n");
+  if (!uid_data->fog_disabled)
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {};\n",
+              BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+    out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
+    out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
+              "    float ze;\n"
+              "    if ({} == 0u) {{\n",
+              BitfieldExtract<&FogParam3::proj>("bpmem_fogParam3"));
+    out.Write("      // perspective\n"
+              "      // ze = A/(B - (Zs >> B_SHF)\n"
+              "      ze = (" I_FOGF ".x * 16777216.0) / float(" I_FOGI ".y - (zCoord >> " I_FOGI
+              ".w));\n"
+              "    }} else {{\n"
+              "      // orthographic\n"
+              "      // ze = a*Zs    (here, no B_SHF)\n"
+              "      ze = " I_FOGF ".x * float(zCoord) / 16777216.0;\n"
+              "    }}\n"
+              "\n"
+              "    if (bool({})) {{\n",
+              BitfieldExtract<&FogRangeParams::RangeBase::Enabled>("bpmem_fogRangeBase"));
+    out.Write("      // x_adjust = sqrt((x-center)^2 + k^2)/k\n"
+              "      // ze *= x_adjust\n"
+              "      float offset = (2.0 * (rawpos.x / " I_FOGF ".w)) - 1.0 - " I_FOGF ".z;\n"
+              "      float floatindex = clamp(9.0 - abs(offset) * 9.0, 0.0, 9.0);\n"
+              "      uint indexlower = uint(floatindex);\n"
+              "      uint indexupper = indexlower + 1u;\n"
+              "      float klower = " I_FOGRANGE "[indexlower >> 2u][indexlower & 3u];\n"
+              "      float kupper = " I_FOGRANGE "[indexupper >> 2u][indexupper & 3u];\n"
+              "      float k = lerp(klower, kupper, frac(floatindex));\n"
+              "      float x_adjust = sqrt(offset * offset + k * k) / k;\n"
+              "      ze *= x_adjust;\n"
+              "    }}\n"
+              "\n"
+              "    float fog = clamp(ze - " I_FOGF ".y, 0.0, 1.0);\n"
+              "\n");
+    out.Write("    if (fog_function >= {:s}) {{\n", FogType::Exp);
+    out.Write("      switch (fog_function) {{\n"
+              "      case {:s}:\n"
+              "        fog = 1.0 - exp2(-8.0 * fog);\n"
+              "        break;\n",
+              FogType::Exp);
+    out.Write("      case {:s}:\n"
+              "        fog = 1.0 - exp2(-8.0 * fog * fog);\n"
+              "        break;\n",
+              FogType::ExpSq);
+    out.Write("      case {:s}:\n"
+              "        fog = exp2(-8.0 * (1.0 - fog));\n"
+              "        break;\n",
+              FogType::BackwardsExp);
+    out.Write("      case {:s}:\n"
+              "        fog = 1.0 - fog;\n"
+              "        fog = exp2(-8.0 * fog * fog);\n"
+              "        break;\n",
+              FogType::BackwardsExpSq);
+    out.Write("      }}\n"
+              "    }}\n"
+              "\n"
+              "    int ifog = iround(fog * 256.0);\n"
+              "    TevResult.rgb = (TevResult.rgb * (256 - ifog) + " I_FOGCOLOR
+              ".rgb * ifog) >> 8;\n"
+              "  }}\n"
+              "\n");
+  }
 
   for (std::size_t i = 0; i < custom_details.shaders.size(); i++)
   {
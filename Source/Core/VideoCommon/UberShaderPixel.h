@@ -20,6 +20,13 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Specializations for the common cases, which are compiled in the background and used in place
+  // of the generic ubershader once ready. Zero in all of them is the generic ubershader.
+  // If non-zero, at most (1 << tev_stage_limit) TEV stages are enabled.
+  u32 tev_stage_limit : 2;
+  u32 fog_disabled : 1;
+  u32 alpha_test_disabled : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -35,6 +42,8 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 void EnumeratePixelShaderUids(const std::function<void(const PixelShaderUid&)>& callback);
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid);
+// Returns true if the uid is a specialized variant, and changes it to the generic ubershader.
+bool ClearSpecializedPixelShaderUidBits(PixelShaderUid* uid);
 }  // namespace UberShader
 
 template <>
@@ -44,9 +53,13 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(
+    auto out = fmt::format_to(
         ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+    if (uid.tev_stage_limit != 0)
+      out = fmt::format_to(out, ", up to {} TEV stages", 1 << uid.tev_stage_limit);
+    return fmt::format_to(out, "{}{}", uid.fog_disabled ? ", no fog" : "",
+                          uid.alpha_test_disabled ? ", no alpha test" : "");
   }
 };
@@ -68,6 +68,7 @@ VertexLoader::VertexLoader(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
     : VertexLoaderBase(vtx_desc, vtx_attr)
 {
   CompileVertexTranslator();
+  m_specialized_run = VertexLoader_Specialized::GetFunction(m_VtxDesc, m_VtxAttr);
 
   // generate frac factors
   m_posScale = 1.0f / (1U << m_VtxAttr.g0.PosFrac);
@@ -255,10 +256,12 @@ void VertexLoader::WriteCall(TPipelineFunction func)
 
 int VertexLoader::RunVertices(const u8* src, u8* dst, int count)
 {
+  m_numLoadedVertices += count;
+  if (m_specialized_run)
+    return m_specialized_run(this, src, dst, count);
+
   g_vertex_manager_write_ptr = dst;
   g_video_buffer_read_ptr = src;
-
-  m_numLoadedVertices += count;
   m_skippedVertices = 0;
 
   for (m_remaining = count - 1; m_remaining >= 0; m_remaining--)
@@ -11,6 +11,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/SmallVector.h"
 #include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoader_Specialized.h"
 
 class VertexLoader;
 typedef void (*TPipelineFunction)(VertexLoader* loader);
@@ -45,6 +46,9 @@ private:
   // (Tested by VertexLoaderTest.LargeFloatVertexSpeed)
   Common::SmallVector<TPipelineFunction, 30> m_PipelineStages;
 
+  // Replaces the pipeline when this vertex format has a specialized loader.
+  VertexLoader_Specialized::RunFunction m_specialized_run = nullptr;
+
   void CompileVertexTranslator();
 
   void WriteCall(TPipelineFunction);
@@ -32,6 +32,9 @@ public:
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
 
+  // The VCD and VAT words, in that order. This is also the on-disk format of the loader cache.
+  const std::array<u32, 5>& GetData() const { return vid; }
+
 private:
   size_t CalculateHash() const
   {
@@ -69,7 +72,9 @@ public:
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
-  int m_numLoadedVertices = 0;
+  u64 m_numLoadedVertices = 0;
+  u64 m_last_sampled_vertices = 0;
+  float m_vertices_per_second = 0.0f;
 
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -13,10 +14,15 @@
 #include <utility>
 #include <vector>
 
+#include <imgui.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -52,6 +58,14 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Records the UIDs of all loaders created, guarded by s_vertex_loader_map_lock.
+static File::IOFile s_uid_cache_file;
+constexpr u32 UID_CACHE_FILE_MAGIC = 0x52444C56;  // VLDR
+constexpr u32 UID_CACHE_FILE_VERSION = 1;
+using SerializedVertexLoaderUID = std::array<u32, 5>;
+
+static std::chrono::steady_clock::time_point s_last_statistics_sample;
+
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
 BitSet8 g_main_vat_dirty;
@@ -67,15 +81,157 @@ void Init()
   g_main_vertex_loaders.fill(nullptr);
   g_preprocess_vertex_loaders.fill(nullptr);
   SETSTAT(g_stats.num_vertex_loaders, 0);
+  SETSTAT(g_stats.num_vertex_loaders_prewarmed, 0);
+  SETSTAT(g_stats.num_vertex_loader_hits, 0);
+  SETSTAT(g_stats.num_vertex_loader_misses, 0);
 }
 
 void Clear()
 {
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_uid_cache_file.Close();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+static void AppendUIDCache(const VertexLoaderUID& uid)
+{
+  if (!s_uid_cache_file.IsOpen())
+    return;
+
+  const SerializedVertexLoaderUID& disk_uid = uid.GetData();
+  if (!s_uid_cache_file.WriteBytes(disk_uid.data(), sizeof(disk_uid)))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_uid_cache_file.Close();
+  }
+}
+
+void LoadUIDCache()
+{
+  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_uid_cache_file.Close();
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxcache";
+  std::vector<SerializedVertexLoaderUID> disk_uids;
+  if (s_uid_cache_file.Open(filename, "rb+"))
+  {
+    u32 magic;
+    u32 version;
+    const u64 file_size = s_uid_cache_file.GetSize();
+    const size_t count =
+        static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedVertexLoaderUID);
+    bool valid = s_uid_cache_file.ReadBytes(&magic, sizeof(magic)) &&
+                 s_uid_cache_file.ReadBytes(&version, sizeof(version)) &&
+                 magic == UID_CACHE_FILE_MAGIC && version == UID_CACHE_FILE_VERSION &&
+                 file_size == count * sizeof(SerializedVertexLoaderUID) + CACHE_HEADER_SIZE;
+    if (valid)
+    {
+      disk_uids.resize(count);
+      valid = s_uid_cache_file.ReadArray(disk_uids.data(), count) &&
+              s_uid_cache_file.Seek(file_size, File::SeekOrigin::Begin);
+    }
+
+    // A truncated file is rewritten below, with whatever loaders already exist.
+    if (!valid)
+    {
+      disk_uids.clear();
+      s_uid_cache_file.Close();
+    }
+  }
+
+  for (const SerializedVertexLoaderUID& disk_uid : disk_uids)
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = disk_uid[0];
+    vtx_desc.high.Hex = disk_uid[1];
+    VAT vtx_attr;
+    vtx_attr.g0.Hex = disk_uid[2];
+    vtx_attr.g1.Hex = disk_uid[3];
+    vtx_attr.g2.Hex = disk_uid[4];
+
+    const VertexLoaderUID uid(vtx_desc, vtx_attr);
+    if (s_vertex_loader_map.contains(uid))
+      continue;
+
+    auto loader = VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr);
+    loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
+    s_vertex_loader_map.emplace(uid, std::move(loader));
+    INCSTAT(g_stats.num_vertex_loaders);
+    INCSTAT(g_stats.num_vertex_loaders_prewarmed);
+  }
+
+  if (!s_uid_cache_file.IsOpen() && s_uid_cache_file.Open(filename, "wb"))
+  {
+    s_uid_cache_file.WriteBytes(&UID_CACHE_FILE_MAGIC, sizeof(UID_CACHE_FILE_MAGIC));
+    s_uid_cache_file.WriteBytes(&UID_CACHE_FILE_VERSION, sizeof(UID_CACHE_FILE_VERSION));
+    for (const auto& it : s_vertex_loader_map)
+      AppendUIDCache(it.first);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Created {} vertex loaders from {}", disk_uids.size(), filename);
+}
+
+void DisplayStatistics()
+{
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+
+  // Sample throughput once a second, so that the numbers are readable.
+  const auto now = std::chrono::steady_clock::now();
+  const std::chrono::duration<float> elapsed = now - s_last_statistics_sample;
+  if (elapsed.count() >= 1.0f)
+  {
+    for (auto& it : s_vertex_loader_map)
+    {
+      VertexLoaderBase* loader = it.second.get();
+      loader->m_vertices_per_second =
+          (loader->m_numLoadedVertices - loader->m_last_sampled_vertices) / elapsed.count();
+      loader->m_last_sampled_vertices = loader->m_numLoadedVertices;
+    }
+    s_last_statistics_sample = now;
+  }
+
+  if (!ImGui::BeginTable("VertexLoaders", 4, ImGuiTableFlags_Borders))
+    return;
+
+  ImGui::TableSetupColumn("VCD/VAT");
+  ImGui::TableSetupColumn("Stride");
+  ImGui::TableSetupColumn("Vertices");
+  ImGui::TableSetupColumn("Vertices/s");
+  ImGui::TableHeadersRow();
+
+  // Busiest loaders first.
+
+  std::vector<std::pair<const VertexLoaderUID*, const VertexLoaderBase*>> loaders;
+  loaders.reserve(s_vertex_loader_map.size());
+  for (const auto& it : s_vertex_loader_map)
+    loaders.emplace_back(&it.first, it.second.get());
+  std::sort(loaders.begin(), loaders.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second->m_vertices_per_second > rhs.second->m_vertices_per_second;
+  });
+
+  for (const auto& [uid, loader] : loaders)
+  {
+    const SerializedVertexLoaderUID& data = uid->GetData();
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::Text("%08x %08x / %08x %08x %08x", data[0], data[1], data[2], data[3], data[4]);
+    ImGui::TableNextColumn();
+    ImGui::Text("%u -> %u", loader->m_vertex_size, loader->m_native_vtx_decl.stride);
+    ImGui::TableNextColumn();
+    ImGui::Text("%llu", static_cast<unsigned long long>(loader->m_numLoadedVertices));
+    ImGui::TableNextColumn();
+    ImGui::Text("%.0f", loader->m_vertices_per_second);
+  }
+
+  ImGui::EndTable();
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -227,6 +383,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
   {
     loader = iter->second.get();
     check_for_native_format &= !loader->m_native_vertex_format;
+    INCSTAT(g_stats.num_vertex_loader_hits);
   }
   else
   {
@@ -234,7 +391,9 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
         uid,
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
+    AppendUIDCache(uid);
     INCSTAT(g_stats.num_vertex_loaders);
+    INCSTAT(g_stats.num_vertex_loader_misses);
   }
   if (check_for_native_format)
   {
@@ -419,9 +578,10 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
     // if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
     // They still need to go through vertex loading, because we need to calculate a zfreeze
-    // reference slope.
+    // reference slope. Everything is skipped in frames which aren't rendered.
     const bool cullall = (bpmem.genMode.cullmode == CullMode::All &&
-                          primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
+                          primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES) ||
+                         g_vertex_manager->IsSkippingRendering();
 
     const int stride = loader->m_native_vtx_decl.stride;
     DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, count, stride,
@@ -436,6 +596,11 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
         DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
         memmove(new_dst.GetPointer(), dst.GetPointer(), count * stride);
       }
+      else
+      {
+        INCSTAT(g_stats.this_frame.num_cpu_culled_draws);
+        ADDSTAT(g_stats.this_frame.num_cpu_culled_vertices, count);
+      }
     }
 
     g_vertex_manager->AddIndices(primitive, count);
@@ -28,6 +28,14 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Creates the vertex loaders recorded in previous sessions of the running title, so that they
+// aren't compiled on first use, and keeps recording any new ones. Does nothing if the shader cache
+// is disabled.
+void LoadUIDCache();
+
+// Draws a table of all vertex loaders and their throughput, for the statistics window.
+void DisplayStatistics();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -0,0 +1,300 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexLoader_Specialized.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "Common/CommonTypes.h"
+#include "Common/Inline.h"
+
+#include "VideoCommon/VertexLoader.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoaderUtils.h"
+
+namespace
+{
+// The formats a specialization can be made for: an optional position matrix index, an XYZ
+// position, an optional single normal, an optional RGBA8888 color 0 and an optional ST texture
+// coordinate 0. Vertices with anything else go through the per-component pipeline.
+struct VertexShape
+{
+  bool posmtx = false;
+  VertexComponentFormat position = VertexComponentFormat::NotPresent;
+  ComponentFormat position_format = ComponentFormat::Float;
+  VertexComponentFormat normal = VertexComponentFormat::NotPresent;
+  ComponentFormat normal_format = ComponentFormat::Float;
+  VertexComponentFormat color0 = VertexComponentFormat::NotPresent;
+  VertexComponentFormat texcoord0 = VertexComponentFormat::NotPresent;
+  ComponentFormat texcoord0_format = ComponentFormat::Float;
+
+  constexpr bool operator==(const VertexShape&) const = default;
+};
+
+template <ComponentFormat format>
+using ComponentType = std::conditional_t<
+    format == ComponentFormat::UByte, u8,
+    std::conditional_t<
+        format == ComponentFormat::Byte, s8,
+        std::conditional_t<format == ComponentFormat::UShort, u16,
+                           std::conditional_t<format == ComponentFormat::Short, s16, float>>>>;
+
+template <VertexComponentFormat type>
+using IndexType = std::conditional_t<type == VertexComponentFormat::Index8, u8, u16>;
+
+// Must give the same results as PosScale and TCScale in the per-component loaders.
+template <typename T>
+float Scale(T value, float scale)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return value;
+  else
+    return value * scale;
+}
+
+// Must give the same results as FracAdjust in VertexLoader_Normal.
+template <typename T>
+float NormalScale(T value)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return value;
+  else
+    return value / float(1u << (sizeof(T) * 8 - std::is_signed_v<T> - 1));
+}
+
+template <typename T>
+DOLPHIN_FORCE_INLINE void Write(u8*& dst, T value)
+{
+  std::memcpy(dst, &value, sizeof(T));
+  dst += sizeof(T);
+}
+
+// Returns where a component's data is, either inline in the vertex or in its array, and moves src
+// past the component.
+template <VertexComponentFormat type, u32 size>
+DOLPHIN_FORCE_INLINE const u8* ComponentData(const u8*& src, CPArray array)
+{
+  if constexpr (type == VertexComponentFormat::Direct)
+  {
+    const u8* data = src;
+    src += size;
+    return data;
+  }
+  else
+  {
+    const u32 index = DataRead<IndexType<type>>(&src);
+    return VertexLoaderManager::cached_arraybases[array] +
+           index * g_main_cp_state.array_strides[array];
+  }
+}
+
+template <VertexShape shape>
+int RunShape(VertexLoader* loader, const u8* src, u8* dst, int count)
+{
+  using PositionType = ComponentType<shape.position_format>;
+  using NormalType = ComponentType<shape.normal_format>;
+  using TexCoordType = ComponentType<shape.texcoord0_format>;
+  constexpr VertexComponentFormat NotPresent = VertexComponentFormat::NotPresent;
+
+  const float pos_scale = loader->m_posScale;
+  const float tc_scale = loader->m_tcScale[0];
+  const u32 stride = loader->m_native_vtx_decl.stride;
+  int skipped = 0;
+
+  for (int remaining = count - 1; remaining >= 0; remaining--)
+  {
+    if constexpr (shape.posmtx)
+    {
+      const u32 posmtx = DataRead<u8>(&src) & 0x3f;
+      if (remaining < 3)
+        VertexLoaderManager::position_matrix_index_cache[remaining] = posmtx;
+      Write(dst, posmtx);
+    }
+
+    bool skip = false;
+    if constexpr (IsIndexed(shape.position))
+    {
+      using I = IndexType<shape.position>;
+      skip = DataPeek<I>(0, src) == std::numeric_limits<I>::max();
+    }
+    const u8* position =
+        ComponentData<shape.position, 3 * sizeof(PositionType)>(src, CPArray::Position);
+    for (u32 i = 0; i < 3; i++)
+    {
+      const float value =
+          Scale(DataPeek<PositionType>(i * sizeof(PositionType), position), pos_scale);
+      if (remaining < 3 && !skip)
+        VertexLoaderManager::position_cache[remaining][i] = value;
+      Write(dst, value);
+    }
+
+    if constexpr (shape.normal != NotPresent)
+    {
+      const u8* normal =
+          ComponentData<shape.normal, 3 * sizeof(NormalType)>(src, CPArray::Normal);
+      for (u32 i = 0; i < 3; i++)
+        Write(dst, NormalScale(DataPeek<NormalType>(i * sizeof(NormalType), normal)));
+    }
+
+    if constexpr (shape.color0 != NotPresent)
+    {
+      // RGBA8888 is already in the native byte order.
+      u32 color;
+      std::memcpy(&color, ComponentData<shape.color0, sizeof(u32)>(src, CPArray::Color0),
+                  sizeof(u32));
+      Write(dst, color);
+    }
+
+    if constexpr (shape.texcoord0 != NotPresent)
+    {
+      const u8* texcoord =
+          ComponentData<shape.texcoord0, 2 * sizeof(TexCoordType)>(src, CPArray::TexCoord0);
+      for (u32 i = 0; i < 2; i++)
+        Write(dst, Scale(DataPeek<TexCoordType>(i * sizeof(TexCoordType), texcoord), tc_scale));
+    }
+
+    if (skip)
+    {
+      dst -= stride;
+      skipped++;
+    }
+  }
+
+  return count - skipped;
+}
+
+struct Specialization
+{
+  VertexShape shape;
+  VertexLoader_Specialized::RunFunction function;
+};
+
+template <VertexShape shape>
+constexpr Specialization Specialize()
+{
+  static_assert(shape.position != VertexComponentFormat::NotPresent);
+  return {shape, RunShape<shape>};
+}
+
+using VCF = VertexComponentFormat;
+using FMT = ComponentFormat;
+
+// Adding a format only needs a line here. Directly-specified vertices are typical of UI and
+// effects, indexed ones of models; the position matrix variants cover skinned models.
+constexpr std::array s_specializations = {
+    Specialize<VertexShape{.position = VCF::Direct,
+                           .color0 = VCF::Direct,
+                           .texcoord0 = VCF::Direct}>(),
+    Specialize<VertexShape{.position = VCF::Direct, .color0 = VCF::Direct}>(),
+    Specialize<VertexShape{.position = VCF::Direct, .texcoord0 = VCF::Direct}>(),
+    Specialize<VertexShape{.position = VCF::Direct,
+                           .position_format = FMT::Short,
+                           .color0 = VCF::Direct,
+                           .texcoord0 = VCF::Direct,
+                           .texcoord0_format = FMT::Short}>(),
+    Specialize<VertexShape{.position = VCF::Index16,
+                           .normal = VCF::Index16,
+                           .texcoord0 = VCF::Index16}>(),
+    Specialize<VertexShape{.position = VCF::Index16,
+                           .normal = VCF::Index16,
+                           .normal_format = FMT::Short,
+                           .texcoord0 = VCF::Index16,
+                           .texcoord0_format = FMT::UShort}>(),
+    Specialize<VertexShape{.position = VCF::Index16,
+                           .position_format = FMT::Short,
+                           .normal = VCF::Index16,
+                           .normal_format = FMT::Short,
+                           .texcoord0 = VCF::Index16,
+                           .texcoord0_format = FMT::Short}>(),
+    Specialize<VertexShape{.position = VCF::Index16,
+                           .position_format = FMT::Short,
+                           .normal = VCF::Index16,
+                           .normal_format = FMT::Byte,
+                           .texcoord0 = VCF::Index16,
+                           .texcoord0_format = FMT::Short}>(),
+    Specialize<VertexShape{.position = VCF::Index16,
+                           .color0 = VCF::Index16,
+                           .texcoord0 = VCF::Index16}>(),
+    Specialize<VertexShape{.position = VCF::Index16,
+                           .position_format = FMT::Short,
+                           .color0 = VCF::Index16,
+                           .texcoord0 = VCF::Index16,
+                           .texcoord0_format = FMT::Short}>(),
+    Specialize<VertexShape{.position = VCF::Index8,
+                           .position_format = FMT::Short,
+                           .normal = VCF::Index8,
+                           .normal_format = FMT::Byte,
+                           .texcoord0 = VCF::Index8,
+                           .texcoord0_format = FMT::Short}>(),
+    Specialize<VertexShape{.posmtx = true,
+                           .position = VCF::Index16,
+                           .normal = VCF::Index16,
+                           .texcoord0 = VCF::Index16}>(),
+    Specialize<VertexShape{.posmtx = true,
+                           .position = VCF::Index16,
+                           .position_format = FMT::Short,
+                           .normal = VCF::Index16,
+                           .normal_format = FMT::Short,
+                           .texcoord0 = VCF::Index16,
+                           .texcoord0_format = FMT::Short}>(),
+};
+}  // Anonymous namespace
+
+VertexLoader_Specialized::RunFunction VertexLoader_Specialized::GetFunction(const TVtxDesc& vtx_desc,
+                                                                            const VAT& vtx_attr)
+{
+  const TVtxDesc::Low& low = vtx_desc.low;
+  const TVtxDesc::High& high = vtx_desc.high;
+
+  for (auto texmtxidx : low.TexMatIdx)
+  {
+    if (texmtxidx)
+      return nullptr;
+  }
+  for (u32 i = 1; i < high.TexCoord.Size(); i++)
+  {
+    if (high.TexCoord[i] != VertexComponentFormat::NotPresent)
+      return nullptr;
+  }
+  if (low.Color[1] != VertexComponentFormat::NotPresent)
+    return nullptr;
+
+  if (vtx_attr.g0.PosElements != CoordComponentCount::XYZ)
+    return nullptr;
+  if (low.Normal != VertexComponentFormat::NotPresent &&
+      vtx_attr.g0.NormalElements != NormalComponentCount::N)
+  {
+    return nullptr;
+  }
+  if (low.Color[0] != VertexComponentFormat::NotPresent &&
+      vtx_attr.GetColorFormat(0) != ColorFormat::RGBA8888)
+  {
+    return nullptr;
+  }
+  if (high.TexCoord[0] != VertexComponentFormat::NotPresent &&
+      vtx_attr.GetTexElements(0) != TexComponentCount::ST)
+  {
+    return nullptr;
+  }
+
+  // Formats of absent components are left at their defaults, so they don't affect the match.
+  VertexShape shape;
+  shape.posmtx = low.PosMatIdx;
+  shape.position = low.Position;
+  shape.position_format = vtx_attr.g0.PosFormat;
+  shape.normal = low.Normal;
+  if (shape.normal != VertexComponentFormat::NotPresent)
+    shape.normal_format = vtx_attr.g0.NormalFormat;
+  shape.color0 = low.Color[0];
+  shape.texcoord0 = high.TexCoord[0];
+  if (shape.texcoord0 != VertexComponentFormat::NotPresent)
+    shape.texcoord0_format = vtx_attr.GetTexFormat(0);
+
+  const auto it = std::find_if(s_specializations.begin(), s_specializations.end(),
+                               [&shape](const Specialization& s) { return s.shape == shape; });
+  return it != s_specializations.end() ? it->function : nullptr;
+}
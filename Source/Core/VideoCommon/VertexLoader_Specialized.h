@@ -0,0 +1,22 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+#include "VideoCommon/CPMemory.h"
+
+class VertexLoader;
+
+// Complete loaders for a handful of common vertex formats, with every component's format known at
+// compile time. Those run without any per-component calls, which makes the software vertex
+// loader much cheaper on hosts that can't use the JIT loaders.
+class VertexLoader_Specialized
+{
+public:
+  using RunFunction = int (*)(VertexLoader* loader, const u8* src, u8* dst, int count);
+
+  // Returns nullptr if there is no specialization for this vertex format.
+  static RunFunction GetFunction(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
+};
@@ -23,6 +23,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -41,6 +42,7 @@
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/Widescreen.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 
@@ -108,6 +110,17 @@ static bool IsNormalProjection(const Projection::Raw& projection, const Viewport
          config.widescreen_heuristic_aspect_ratio_slop;
 }
 
+// Clears the dirty flag of a constant block whose contents match the last upload.
+template <typename ShaderManager>
+static void SkipRedundantConstantUpload(ShaderManager& shader_manager)
+{
+  if (!shader_manager.dirty || shader_manager.uploaded_constants.Update(shader_manager.constants))
+    return;
+
+  shader_manager.dirty = false;
+  ADDSTAT(g_stats.this_frame.bytes_uniform_skipped, sizeof(shader_manager.constants));
+}
+
 VertexManagerBase::VertexManagerBase()
     : m_cpu_vertex_buffer(MAXVBUFFERSIZE), m_cpu_index_buffer(MAXIBUFFERSIZE)
 {
@@ -369,6 +382,9 @@ void VertexManagerBase::InvalidateConstants()
   vertex_shader_manager.dirty = true;
   geometry_shader_manager.dirty = true;
   pixel_shader_manager.dirty = true;
+  vertex_shader_manager.uploaded_constants.Invalidate();
+  geometry_shader_manager.uploaded_constants.Invalidate();
+  pixel_shader_manager.uploaded_constants.Invalidate();
 }
 
 void VertexManagerBase::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
@@ -513,7 +529,7 @@ void VertexManagerBase::Flush()
 
   // Track some stats used elsewhere by the anamorphic widescreen heuristic.
   auto& system = Core::System::GetInstance();
-  if (!system.IsWii())
+  if (!system.IsWii() && WidescreenManager::IsHeuristicEnabled())
   {
     const bool is_perspective = xfmem.projection.type == ProjectionType::Perspective;
 
@@ -575,7 +591,8 @@ void VertexManagerBase::Flush()
           continue;
         const float custom_tex_scale = cache_entry->GetWidth() / float(cache_entry->native_width);
         samplers[i] = TextureCacheBase::GetSamplerState(
-            i, custom_tex_scale, cache_entry->is_custom_tex, cache_entry->has_arbitrary_mips);
+            i, custom_tex_scale, cache_entry->is_custom_tex, cache_entry->has_arbitrary_mips,
+            cache_entry->first_resident_level);
       }
     }
     else
@@ -594,7 +611,8 @@ void VertexManagerBase::Flush()
 
           const float custom_tex_scale = cache_entry->GetWidth() / float(cache_entry->native_width);
           samplers[i] = TextureCacheBase::GetSamplerState(
-              i, custom_tex_scale, cache_entry->is_custom_tex, cache_entry->has_arbitrary_mips);
+              i, custom_tex_scale, cache_entry->is_custom_tex, cache_entry->has_arbitrary_mips,
+              cache_entry->first_resident_level);
         }
       }
     }
@@ -618,19 +636,22 @@ void VertexManagerBase::Flush()
     std::vector<std::string> custom_pixel_texture_names;
     std::span<u8> custom_pixel_shader_uniforms;
     bool skip = false;
-    for (size_t i = 0; i < texture_names.size(); i++)
+    if (g_graphics_mod_manager->HasDrawStartedActions())
     {
       GraphicsModActionData::DrawStarted draw_started{texture_units, &skip, &custom_pixel_shader,
                                                       &custom_pixel_shader_uniforms};
-      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_names[i]))
+      for (size_t i = 0; i < texture_names.size(); i++)
       {
-        action->OnDrawStarted(&draw_started);
-        if (custom_pixel_shader)
+        for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_names[i]))
         {
-          custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
-          custom_pixel_texture_names.push_back(texture_names[i]);
+          action->OnDrawStarted(&draw_started);
+          if (custom_pixel_shader)
+          {
+            custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
+            custom_pixel_texture_names.push_back(texture_names[i]);
+          }
+          custom_pixel_shader = std::nullopt;
         }
-        custom_pixel_shader = std::nullopt;
       }
     }
 
@@ -645,7 +666,13 @@ void VertexManagerBase::Flush()
     // Same with GPU texture decoding, which uses compute shaders.
     g_texture_cache->BindTextures(used_textures, samplers);
 
-    if (PerfQueryBase::ShouldEmulate())
+    if (g_gpu_timing_query)
+      g_gpu_timing_query->SetPass(GPUTimingPass::EFBDraw);
+
+    // Queries can get enabled by the CPU thread at any time, so the query has to be ended based on
+    // whether it was started.
+    const bool emulate_perf_queries = PerfQueryBase::ShouldEmulate();
+    if (emulate_perf_queries)
       g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
     if (!skip)
@@ -675,11 +702,13 @@ void VertexManagerBase::Flush()
     // Even if we skip the draw, emulated state should still be impacted
     OnDraw();
 
-    if (PerfQueryBase::ShouldEmulate())
+    if (emulate_perf_queries)
       g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
-    // The EFB cache is now potentially stale.
-    g_framebuffer_manager->FlagPeekCacheAsOutOfDate();
+    // The EFB cache is now potentially stale where this draw could have written to.
+    g_framebuffer_manager->FlagPeekCacheAsOutOfDate(
+        g_framebuffer_manager->GetDrawBounds(),
+        bpmem.blendmode.colorupdate || bpmem.blendmode.alphaupdate, bpmem.zmode.updateenable);
   }
 
   if (xfmem.numTexGen.numTexGens != bpmem.genMode.numtexgens)
@@ -811,6 +840,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (vs_uid != m_current_pipeline_config.vs_uid)
   {
     m_current_pipeline_config.vs_uid = vs_uid;
+    m_current_pipeline_hash.SetVertexShaderUid(vs_uid);
     m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
     m_pipeline_config_changed = true;
   }
@@ -819,6 +849,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (ps_uid != m_current_pipeline_config.ps_uid)
   {
     m_current_pipeline_config.ps_uid = ps_uid;
+    m_current_pipeline_hash.SetPixelShaderUid(ps_uid);
     m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
     m_pipeline_config_changed = true;
   }
@@ -827,6 +858,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (gs_uid != m_current_pipeline_config.gs_uid)
   {
     m_current_pipeline_config.gs_uid = gs_uid;
+    m_current_pipeline_hash.SetGeometryShaderUid(gs_uid);
     m_current_uber_pipeline_config.gs_uid = gs_uid;
     m_pipeline_config_changed = true;
   }
@@ -881,13 +913,15 @@ void VertexManagerBase::UpdatePipelineObject()
 
   m_current_pipeline_object = nullptr;
   m_pipeline_config_changed = false;
+  const u64 uid_hash = m_current_pipeline_hash.Get(m_current_pipeline_config);
 
   switch (g_ActiveConfig.iShaderCompilationMode)
   {
   case ShaderCompilationMode::Synchronous:
   {
     // Ubershaders disabled? Block and compile the specialized shader.
-    m_current_pipeline_object = g_shader_cache->GetPipelineForUid(m_current_pipeline_config);
+    m_current_pipeline_object =
+        g_shader_cache->GetPipelineForUid(m_current_pipeline_config, uid_hash);
   }
   break;
 
@@ -903,7 +937,7 @@ void VertexManagerBase::UpdatePipelineObject()
   case ShaderCompilationMode::AsynchronousSkipRendering:
   {
     // Can we background compile shaders? If so, get the pipeline asynchronously.
-    auto res = g_shader_cache->GetPipelineForUidAsync(m_current_pipeline_config);
+    auto res = g_shader_cache->GetPipelineForUidAsync(m_current_pipeline_config, uid_hash);
     if (res)
     {
       // Specialized shaders are ready, prefer these.
@@ -998,6 +1032,8 @@ void VertexManagerBase::OnEFBCopyToRAM()
 
 void VertexManagerBase::OnEndFrame()
 {
+  m_skip_rendering = g_video_backend->IsSkipRenderingRequested();
+
   m_draw_counter = 0;
   m_last_efb_copy_draw_counter = 0;
   m_scheduled_command_buffer_kicks.clear();
@@ -1084,6 +1120,10 @@ void VertexManagerBase::RenderDrawCall(
     pixel_shader_manager.custom_constants_dirty = true;
   }
   pixel_shader_manager.custom_constants = custom_pixel_shader_uniforms;
+  auto& vertex_shader_manager = Core::System::GetInstance().GetVertexShaderManager();
+  SkipRedundantConstantUpload(vertex_shader_manager);
+  SkipRedundantConstantUpload(geometry_shader_manager);
+  SkipRedundantConstantUpload(pixel_shader_manager);
   UploadUniforms();
 
   g_gfx->SetPipeline(current_pipeline);
@@ -101,6 +101,10 @@ public:
   static constexpr u32 UNIFORM_STREAM_BUFFER_SIZE = 64 * 1024 * 1024;
   static constexpr u32 TEXEL_STREAM_BUFFER_SIZE = 16 * 1024 * 1024;
 
+  // Stream buffers which can be reallocated grow up to this multiple of their initial size before
+  // the video thread has to wait for the GPU to free up space.
+  static constexpr u32 MAX_STREAM_BUFFER_GROWTH = 2;
+
   VertexManagerBase();
   virtual ~VertexManagerBase();
 
@@ -121,6 +125,9 @@ public:
   void Flush();
   bool HasSendableVertices() const { return !m_is_flushed && !m_cull_all; }
 
+  // Whether the current frame is being skipped, see VideoBackendBase::Video_SetSkipRendering().
+  bool IsSkippingRendering() const { return m_skip_rendering; }
+
   void DoState(PointerWrap& p);
 
   FlushStatistics ResetFlushAspectRatioCount();
@@ -207,6 +214,8 @@ protected:
   Slope m_zslope = {};
 
   VideoCommon::GXPipelineUid m_current_pipeline_config;
+  // Kept up to date with the shader UIDs in m_current_pipeline_config as they change.
+  VideoCommon::GXPipelineUidHash m_current_pipeline_hash;
   VideoCommon::GXUberPipelineUid m_current_uber_pipeline_config;
   const AbstractPipeline* m_current_pipeline_object = nullptr;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
@@ -251,6 +260,9 @@ private:
   std::unique_ptr<CustomShaderCache> m_custom_shader_cache;
   u64 m_ticks_elapsed = 0;
 
+  // Latched from the video backend at the end of every frame.
+  bool m_skip_rendering = false;
+
   Common::EventHook m_frame_end_event;
   Common::EventHook m_after_present_event;
 };
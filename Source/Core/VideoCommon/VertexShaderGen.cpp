@@ -83,6 +83,7 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   const bool msaa = host_config.msaa;
   const bool ssaa = host_config.ssaa;
   const bool vertex_rounding = host_config.vertex_rounding;
+  const bool multiview_stereo = host_config.stereo && host_config.backend_multiview;
 
   ShaderCode input_extract;
 
@@ -94,19 +95,19 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   out.Write("{}", s_shader_uniforms);
   out.Write("}};\n");
 
-  if (uid_data->vs_expand != VSExpand::None)
+  if (uid_data->vs_expand != VSExpand::None || multiview_stereo)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
     out.Write("}};\n");
+  }
 
-    if (api_type == APIType::D3D)
-    {
-      // D3D doesn't include the base vertex in SV_VertexID
-      out.Write("UBO_BINDING(std140, 5) uniform DX_Constants {{\n"
-                "  uint base_vertex;\n"
-                "}};\n\n");
-    }
+  if (uid_data->vs_expand != VSExpand::None && api_type == APIType::D3D)
+  {
+    // D3D doesn't include the base vertex in SV_VertexID
+    out.Write("UBO_BINDING(std140, 5) uniform DX_Constants {{\n"
+              "  uint base_vertex;\n"
+              "}};\n\n");
   }
 
   out.Write("struct VS_OUTPUT {{\n");
@@ -670,6 +671,11 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
               "}}\n");
   }
 
+  // Each view is rendered with the offset for its eye, rather than the geometry shader emitting
+  // the primitive once for each eye.
+  if (multiview_stereo)
+    GenerateStereoOffset(out, "", "o.pos", "gl_ViewIndex");
+
   if (host_config.backend_geometry_shaders)
   {
     AssignVSOutputMembers(out, "vs", "o", uid_data->numTexGens, host_config);
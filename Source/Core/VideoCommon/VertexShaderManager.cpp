@@ -42,6 +42,7 @@ void VertexShaderManager::Init()
   // TODO: should these go inside ResetView()?
   m_viewport_correction = Common::Matrix44::Identity();
   m_projection_matrix = Common::Matrix44::Identity().data;
+  m_corrected_projection_dirty = true;
 
   dirty = true;
 }
@@ -127,13 +128,27 @@ Common::Matrix44 VertexShaderManager::LoadProjectionMatrix()
   return corrected_matrix;
 }
 
+// Returns whether the corrected projection was built again.
+bool VertexShaderManager::UpdateCorrectedProjection(XFStateManager& xf_state_manager)
+{
+  if (!xf_state_manager.DidProjectionChange() && !g_freelook_camera.GetController()->IsDirty() &&
+      !m_corrected_projection_dirty)
+  {
+    return false;
+  }
+
+  xf_state_manager.ResetProjection();
+  m_corrected_projection_matrix = LoadProjectionMatrix();
+  m_corrected_projection_dirty = false;
+  return true;
+}
+
 void VertexShaderManager::SetProjectionMatrix(XFStateManager& xf_state_manager)
 {
-  if (xf_state_manager.DidProjectionChange() || g_freelook_camera.GetController()->IsDirty())
+  if (UpdateCorrectedProjection(xf_state_manager))
   {
-    xf_state_manager.ResetProjection();
-    auto corrected_matrix = LoadProjectionMatrix();
-    memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
+    memcpy(constants.projection.data(), m_corrected_projection_matrix.data.data(),
+           4 * sizeof(float4));
   }
 }
 
@@ -389,34 +404,30 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     g_stats.AddScissorRect();
   }
 
-  std::vector<GraphicsModAction*> projection_actions;
+  m_projection_actions.clear();
   if (g_ActiveConfig.bGraphicMods)
   {
-    for (const auto& action : g_graphics_mod_manager->GetProjectionActions(xfmem.projection.type))
-    {
-      projection_actions.push_back(action);
-    }
+    const auto actions = g_graphics_mod_manager->GetProjectionActions(xfmem.projection.type);
+    m_projection_actions.insert(m_projection_actions.end(), actions.begin(), actions.end());
 
     for (const auto& texture : textures)
     {
-      for (const auto& action :
-           g_graphics_mod_manager->GetProjectionTextureActions(xfmem.projection.type, texture))
-      {
-        projection_actions.push_back(action);
-      }
+      const auto texture_actions =
+          g_graphics_mod_manager->GetProjectionTextureActions(xfmem.projection.type, texture);
+      m_projection_actions.insert(m_projection_actions.end(), texture_actions.begin(),
+                                  texture_actions.end());
     }
   }
 
-  if (xf_state_manager.DidProjectionChange() || g_freelook_camera.GetController()->IsDirty() ||
-      !projection_actions.empty() || m_projection_graphics_mod_change)
+  const bool projection_changed = UpdateCorrectedProjection(xf_state_manager);
+  if (projection_changed || !m_projection_actions.empty() || m_projection_graphics_mod_change)
   {
-    xf_state_manager.ResetProjection();
-    m_projection_graphics_mod_change = !projection_actions.empty();
+    m_projection_graphics_mod_change = !m_projection_actions.empty();
 
-    auto corrected_matrix = LoadProjectionMatrix();
+    auto corrected_matrix = m_corrected_projection_matrix;
 
     GraphicsModActionData::Projection projection{&corrected_matrix};
-    for (const auto& action : projection_actions)
+    for (const auto& action : m_projection_actions)
     {
       action->OnProjection(&projection);
     }
@@ -484,6 +495,7 @@ void VertexShaderManager::DoState(PointerWrap& p)
 
   if (p.IsReadMode())
   {
+    m_corrected_projection_dirty = true;
     dirty = true;
   }
 }
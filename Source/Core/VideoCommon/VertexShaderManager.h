@@ -13,6 +13,7 @@
 #include "VideoCommon/ConstantManager.h"
 #include "VideoCommon/NativeVertexFormat.h"
 
+class GraphicsModAction;
 class PointerWrap;
 struct PortableVertexDeclaration;
 class XFStateManager;
@@ -38,6 +39,7 @@ public:
 
   VertexShaderConstants constants{};
   bool dirty = false;
+  UploadedConstants<VertexShaderConstants> uploaded_constants;
 
   static DOLPHIN_FORCE_INLINE void UpdateValue(bool* dirty, u32* old_value, u32 new_value)
   {
@@ -84,7 +86,16 @@ private:
   // track changes
   bool m_projection_graphics_mod_change = false;
 
+  // Reused for every draw, to avoid allocating when graphics mods change the projection.
+  std::vector<GraphicsModAction*> m_projection_actions;
+
+  // The projection with the viewport correction and free look applied. Graphics mods that change
+  // the projection start from it on every draw, so it's only built again when it changes.
+  Common::Matrix44 m_corrected_projection_matrix = Common::Matrix44::Identity();
+  bool m_corrected_projection_dirty = true;
+
   Common::Matrix44 m_viewport_correction{};
 
   Common::Matrix44 LoadProjectionMatrix();
+  bool UpdateCorrectedProjection(XFStateManager& xf_state_manager);
 };
@@ -20,6 +20,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/System.h"
 
@@ -49,6 +50,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimingQuery.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -113,7 +115,11 @@ void VideoBackendBase::Video_OutputXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride
     e.swap_event.fbWidth = fb_width;
     e.swap_event.fbStride = fb_stride;
     e.swap_event.fbHeight = fb_height;
+    e.swap_event.output_time = Clock::now().time_since_epoch().count();
     AsyncRequests::GetInstance()->PushEvent(e, false);
+
+    if (g_ActiveConfig.bLowLatencyPacing)
+      system.GetCoreTiming().DelayFrameStart();
   }
 }
 
@@ -138,6 +144,8 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 data
   }
   else
   {
+    Core::System::GetInstance().GetFifo().SyncGPUForGPUStateRead(Fifo::SyncGPUReason::EFBPeek);
+
     AsyncRequests::Event e;
     u32 result;
     e.type = type == EFBAccessType::PeekColor ? AsyncRequests::Event::EFB_PEEK_COLOR :
@@ -153,13 +161,20 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 data
 
 u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
 {
+  if (!g_perf_query->IsEnabled())
+  {
+    return 0;
+  }
+
   if (!g_perf_query->ShouldEmulate())
   {
+    g_perf_query->OnCounterRead();
     return 0;
   }
 
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
+  system.GetFifo().SyncGPUForGPUStateRead(Fifo::SyncGPUReason::PerfQuery);
 
   AsyncRequests::Event e;
   e.time = 0;
@@ -201,6 +216,7 @@ u16 VideoBackendBase::Video_GetBoundingBox(int index)
 
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::BBox);
+  system.GetFifo().SyncGPUForGPUStateRead(Fifo::SyncGPUReason::BBox);
 
   AsyncRequests::Event e;
   u16 result;
@@ -213,6 +229,11 @@ u16 VideoBackendBase::Video_GetBoundingBox(int index)
   return result;
 }
 
+void VideoBackendBase::Video_SetSkipRendering(bool skip)
+{
+  m_skip_rendering_requested.store(skip, std::memory_order_relaxed);
+}
+
 static VideoBackendBase* GetDefaultVideoBackend()
 {
   const auto& backends = VideoBackendBase::GetAvailableBackends();
@@ -353,6 +374,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   g_vertex_manager = std::move(vertex_manager);
   g_perf_query = std::move(perf_query);
   g_bounding_box = std::move(bounding_box);
+  g_gpu_timing_query = g_gfx->CreateGPUTimingQuery();
 
   // Null and Software Backends supply their own derived Renderer and Texture Cache
   g_texture_cache = std::move(texture_cache);
@@ -392,6 +414,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   g_Config.VerifyValidity();
   UpdateActiveConfig();
 
+  VertexLoaderManager::LoadUIDCache();
   g_shader_cache->InitializeShaderCache();
 
   return true;
@@ -407,6 +430,7 @@ void VideoBackendBase::ShutdownShared()
   if (g_texture_cache)
     g_texture_cache->Shutdown();
 
+  g_gpu_timing_query.reset();
   g_bounding_box.reset();
   g_perf_query.reset();
   g_graphics_mod_manager.reset();
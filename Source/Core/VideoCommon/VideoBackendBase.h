@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -64,6 +65,16 @@ public:
   u32 Video_GetQueryResult(PerfQueryType type);
   u16 Video_GetBoundingBox(int index);
 
+  // Sets whether the frames after the next end of frame on the video thread are rendered. Skipped
+  // frames drop their draws, EFB copies and clears, and bounding box and perf counter resets, so
+  // that EFB copies in RAM, bounding box and perf query reads keep the results of the last
+  // rendered frame, while everything else is still processed as usual. Thread safe.
+  void Video_SetSkipRendering(bool skip);
+  bool IsSkipRenderingRequested() const
+  {
+    return m_skip_rendering_requested.load(std::memory_order_relaxed);
+  }
+
   static std::string GetDefaultBackendName();
   static const std::vector<std::unique_ptr<VideoBackendBase>>& GetAvailableBackends();
   static void ActivateBackend(const std::string& name);
@@ -93,6 +104,9 @@ protected:
   void ShutdownShared();
 
   bool m_initialized = false;
+
+private:
+  std::atomic<bool> m_skip_rendering_requested = false;
 };
 
 extern VideoBackendBase* g_video_backend;
@@ -116,6 +116,9 @@ struct VideoConfig final
   // General
   bool bVSync = false;
   bool bVSyncActive = false;
+  // Limits the frames queued for presentation and delays the start of emulated frames to reduce
+  // the time between reading input and the frame being shown.
+  bool bLowLatencyPacing = false;
   bool bWidescreenHack = false;
   AspectMode aspect_mode{};
   int custom_aspect_width = 1;
@@ -127,11 +130,16 @@ struct VideoConfig final
   float widescreen_heuristic_widescreen_ratio = 0.f;
   bool bCrop = false;  // Aspect ratio controls.
   bool bShaderCache = false;
+  // Directory of read-only shader caches shared between instances. Only shaders missing from it
+  // are written to the user's own shader cache.
+  std::string sSharedShaderCachePath;
 
   // Enhancements
   u32 iMultisamples = 0;
   bool bSSAA = false;
   int iEFBScale = 0;
+  // Lowers the internal resolution below iEFBScale when the GPU can't keep up.
+  bool bDynamicResolution = false;
   TextureFilteringMode texture_filtering_mode = TextureFilteringMode::Default;
   OutputResamplingMode output_resampling_mode = OutputResamplingMode::Default;
   int iMaxAnisotropy = 0;
@@ -170,6 +178,8 @@ struct VideoConfig final
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
+  bool bShowTLBStats = false;
+  bool bShowGPUTimings = false;
   int iPerfSampleUSec = 0;
   bool bShowNetPlayPing = false;
   bool bShowNetPlayMessages = false;
@@ -190,6 +200,11 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  // In MiB. Unused custom textures are evicted when they take up more than this, 0 disables it.
+  int iHiresTextureVRAMBudget = 0;
+  // In MiB. Textures in the cache and its pool are evicted when they take up more than this, 0
+  // disables it.
+  int iTextureCacheVRAMBudget = 0;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bDumpFramesAsImages = false;
@@ -203,6 +218,7 @@ struct VideoConfig final
       FrameDumpResolutionType::XFBAspectRatioCorrectedResolution;
   bool bBorderlessFullscreen = false;
   bool bEnableGPUTextureDecoding = false;
+  bool bAsyncTextureDecoding = false;
   bool bPreferVSForLinePointExpansion = false;
   int iBitrateKbps = 0;
   bool bGraphicMods = false;
@@ -213,6 +229,9 @@ struct VideoConfig final
   bool bEFBAccessDeferInvalidation = false;
   bool bPerfQueriesEnable = false;
   bool bBBoxEnable = false;
+  // If non-zero, bounding box reads may return values up to this many frames old instead of
+  // waiting for the GPU.
+  int iBBoxAsyncReadbackFrames = 0;
   bool bForceProgressive = false;
   bool bCPUCull = false;
 
@@ -221,6 +240,7 @@ struct VideoConfig final
   bool bSkipXFBCopyToRam = false;
   bool bDisableCopyToVRAM = false;
   bool bDeferEFBCopies = false;
+  bool bDeferEFBCopiesToFrameEnd = false;
   bool bImmediateXFB = false;
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
@@ -275,6 +295,10 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of threads the software renderer rasterizes on, in addition to the video thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iSWRasterizerThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -337,6 +361,12 @@ struct VideoConfig final
     bool bSupportsVSLinePointExpand = false;
     bool bSupportsGLLayerInFS = true;
     bool bSupportsHDROutput = false;
+    // Pipelines can be linked from already-compiled shaders quickly enough to do it on the GPU
+    // thread, instead of using ubershaders until they finish compiling.
+    bool bSupportsFastPipelineLinking = false;
+    // Both eyes can be rendered in one pass, with the vertex shader offsetting each view, instead
+    // of the geometry shader duplicating every primitive into the second layer.
+    bool bSupportsMultiview = false;
   } backend_info;
 
   // Utility
@@ -348,6 +378,10 @@ struct VideoConfig final
       return true;
     return bPreferVSForLinePointExpansion;
   }
+  bool UseMultiviewStereo() const
+  {
+    return stereo_mode != StereoMode::Off && backend_info.bSupportsMultiview;
+  }
   bool MultisamplingEnabled() const { return iMultisamples > 1; }
   bool ExclusiveFullscreenEnabled() const
   {
@@ -381,6 +415,7 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetSWRasterizerThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
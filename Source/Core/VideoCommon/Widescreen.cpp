@@ -82,6 +82,18 @@ std::optional<bool> WidescreenManager::GetWidescreenOverride() const
   return is_game_widescreen;
 }
 
+bool WidescreenManager::IsHeuristicEnabled()
+{
+  // If suggested_aspect_mode (GameINI) is configured don't use heuristic.
+  if (g_ActiveConfig.suggested_aspect_mode != AspectMode::Auto)
+    return false;
+
+  // If widescreen hack isn't active and aspect_mode (UI) is 4:3 or 16:9 don't use heuristic.
+  return g_ActiveConfig.bWidescreenHack ||
+         (g_ActiveConfig.aspect_mode != AspectMode::ForceStandard &&
+          g_ActiveConfig.aspect_mode != AspectMode::ForceWide);
+}
+
 // Heuristic to detect if a GameCube game is in 16:9 anamorphic widescreen mode.
 // Cheats that change the game aspect ratio to natively unsupported ones won't be recognized here.
 void WidescreenManager::UpdateWidescreenHeuristic()
@@ -92,17 +104,14 @@ void WidescreenManager::UpdateWidescreenHeuristic()
   m_heuristic_state = HeuristicState::Inactive;
   m_was_orthographically_anamorphic = false;
 
-  // If suggested_aspect_mode (GameINI) is configured don't use heuristic.
-  // We also don't need to check "GetWidescreenOverride()" in this case as
-  // nothing would have changed there.
+  // If suggested_aspect_mode (GameINI) is configured we don't need to check
+  // "GetWidescreenOverride()" as nothing would have changed there.
   if (g_ActiveConfig.suggested_aspect_mode != AspectMode::Auto)
     return;
 
   std::optional<bool> is_game_widescreen = GetWidescreenOverride();
 
-  // If widescreen hack isn't active and aspect_mode (UI) is 4:3 or 16:9 don't use heuristic.
-  if (g_ActiveConfig.bWidescreenHack || (g_ActiveConfig.aspect_mode != AspectMode::ForceStandard &&
-                                         g_ActiveConfig.aspect_mode != AspectMode::ForceWide))
+  if (IsHeuristicEnabled())
   {
     // Modify the threshold based on which aspect ratio we're already using:
     // If the game's in 4:3, it probably won't switch to anamorphic, and vice-versa.
@@ -21,6 +21,10 @@ public:
   // or if it's being forced to.
   bool IsGameWidescreen() const { return m_is_game_widescreen; }
 
+  // Whether the heuristic's result is used with the current settings. The statistics it's based on
+  // don't need to be gathered otherwise.
+  static bool IsHeuristicEnabled();
+
   void DoState(PointerWrap& p);
 
 private:
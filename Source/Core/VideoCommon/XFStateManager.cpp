@@ -6,6 +6,9 @@
 #include "Common/ChunkFile.h"
 
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/XFMemory.h"
 
@@ -169,11 +172,40 @@ void XFStateManager::InvalidateXFRange(int start, int end)
   }
 }
 
+// Vertices which carry their own matrix indices don't use the ones set in the CP, and neither do
+// texture coordinates which aren't generated. Buffered vertices only need to be drawn before an
+// index changes if they use it, otherwise they're merged with the following draws.
+static bool IsTexMatrixIndexUsed(u32 tex_coord)
+{
+  return tex_coord < xfmem.numTexGen.numTexGens &&
+         (VertexLoaderManager::g_current_components & (VB_HAS_TEXMTXIDX0 << tex_coord)) == 0;
+}
+
+// Both matrix index registers are made of 6-bit fields.
+static bool MatrixIndexChanged(u32 changed_bits, u32 field)
+{
+  return ((changed_bits >> (field * 6)) & 0x3f) != 0;
+}
+
+static void FlushIfBufferedVerticesAffected(bool affected)
+{
+  if (affected)
+    g_vertex_manager->Flush();
+  else if (g_vertex_manager->HasSendableVertices())
+    INCSTAT(g_stats.this_frame.num_merged_draws);
+}
+
 void XFStateManager::SetTexMatrixChangedA(u32 Value)
 {
   if (g_main_cp_state.matrix_index_a.Hex != Value)
   {
-    g_vertex_manager->Flush();
+    const u32 changed_bits = g_main_cp_state.matrix_index_a.Hex ^ Value;
+    bool affected = MatrixIndexChanged(changed_bits, 0) &&
+                    (VertexLoaderManager::g_current_components & VB_HAS_POSMTXIDX) == 0;
+    for (u32 i = 0; i < 4; i++)
+      affected |= MatrixIndexChanged(changed_bits, i + 1) && IsTexMatrixIndexUsed(i);
+    FlushIfBufferedVerticesAffected(affected);
+
     if (g_main_cp_state.matrix_index_a.PosNormalMtxIdx != (Value & 0x3f))
       m_pos_normal_matrix_changed = true;
     m_tex_matrices_changed[0] = true;
@@ -190,7 +222,11 @@ void XFStateManager::SetTexMatrixChangedB(u32 Value)
 {
   if (g_main_cp_state.matrix_index_b.Hex != Value)
   {
-    g_vertex_manager->Flush();
+    const u32 changed_bits = g_main_cp_state.matrix_index_b.Hex ^ Value;
+    bool affected = false;
+    for (u32 i = 0; i < 4; i++)
+      affected |= MatrixIndexChanged(changed_bits, i) && IsTexMatrixIndexUsed(i + 4);
+    FlushIfBufferedVerticesAffected(affected);
     m_tex_matrices_changed[1] = true;
     g_main_cp_state.matrix_index_b.Hex = Value;
   }
@@ -33,6 +33,10 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
 {
   if (address >= XFMEM_REGISTERS_START && address < XFMEM_REGISTERS_END)
   {
+    // Games often rewrite state with the value it already has between draws. That doesn't change
+    // how anything is drawn, so it shouldn't split the current batch.
+    const bool changed = reinterpret_cast<const u32*>(&xfmem)[address] != value;
+
     switch (address)
     {
     case XFMEM_ERROR:
@@ -120,6 +124,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -133,6 +139,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -151,6 +159,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -163,6 +173,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -232,12 +244,19 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+    // Like LoadIndexedXF, only flush if the matrices actually change.
+    u32* const xf_mem_data = reinterpret_cast<u32*>(&xfmem) + xf_mem_base;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (xf_mem_data[i] != Common::swap32(data + i * sizeof(u32)))
+      {
+        XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+        for (u32 j = 0; j < xf_mem_transfer_size; j++)
+          xf_mem_data[j] = Common::swap32(data + j * sizeof(u32));
+        break;
+      }
     }
+    data += xf_mem_transfer_size * sizeof(u32);
   }
 
   // write to XF regs
@@ -0,0 +1,179 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "AudioCommon/Enums.h"
+#include "AudioCommon/Resampler.h"
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+
+using AudioCommon::Resampler;
+using AudioCommon::ResamplingQuality;
+
+namespace
+{
+constexpr double AMPLITUDE = 16000.0;
+
+// A sine in the first channel and silence in the second one.
+std::vector<s16> GenerateSine(u32 frames, double frequency, double sample_rate)
+{
+  std::vector<s16> samples(frames * 2);
+  for (u32 i = 0; i < frames; ++i)
+  {
+    const double t = MathUtil::TAU * frequency * i / sample_rate;
+    samples[i * 2] = static_cast<s16>(std::lround(AMPLITUDE * std::sin(t)));
+  }
+  return samples;
+}
+
+u32 GetStep(double input_rate, double output_rate)
+{
+  return static_cast<u32>(65536.0 * input_rate / output_rate);
+}
+
+std::vector<float> Resample(const Resampler& resampler, const std::vector<s16>& input, u32 step)
+{
+  std::vector<float> output(input.size() * 4);
+  u32 position = 0;
+  const u32 count = resampler.Process(input.data(), static_cast<u32>(input.size() / 2), &position,
+                                      step, output.data(), static_cast<u32>(output.size() / 2),
+                                      1.0f, 1.0f);
+  output.resize(count * 2);
+  return output;
+}
+
+// Ratio of the sine which should come out to everything else, in dB. The first and last frames
+// are skipped, since the filter reads the silence before the input there.
+double MeasureSNR(const Resampler& resampler, double frequency, double input_rate,
+                  double output_rate)
+{
+  const u32 step = GetStep(input_rate, output_rate);
+  const std::vector<float> output =
+      Resample(resampler, GenerateSine(8000, frequency, input_rate), step);
+
+  double signal = 0.0;
+  double noise = 0.0;
+  const size_t frames = output.size() / 2;
+  for (size_t n = 100; n + 100 < frames; ++n)
+  {
+    const double position = resampler.GetHistory() + static_cast<double>(step) * n / 65536.0;
+    const double expected = AMPLITUDE * std::sin(MathUtil::TAU * frequency * position / input_rate);
+    signal += expected * expected;
+    noise += (output[n * 2] - expected) * (output[n * 2] - expected);
+    noise += output[n * 2 + 1] * output[n * 2 + 1];
+  }
+  return 10.0 * std::log10(signal / noise);
+}
+
+// Level of what's left of a sine above the output Nyquist frequency, relative to the input, in dB.
+double MeasureAliasing(const Resampler& resampler, double frequency, double input_rate,
+                       double output_rate)
+{
+  const std::vector<float> output = Resample(
+      resampler, GenerateSine(8000, frequency, input_rate), GetStep(input_rate, output_rate));
+
+  double power = 0.0;
+  const size_t frames = output.size() / 2;
+  for (size_t n = 100; n + 100 < frames; ++n)
+    power += output[n * 2] * output[n * 2];
+  power /= frames - 200;
+  return 10.0 * std::log10(power / (AMPLITUDE * AMPLITUDE / 2));
+}
+}  // namespace
+
+TEST(Resampler, PreservesDC)
+{
+  for (const ResamplingQuality quality :
+       {ResamplingQuality::Linear, ResamplingQuality::Medium, ResamplingQuality::High})
+  {
+    Resampler resampler;
+    resampler.SetFilter(quality, 1.0f);
+
+    const std::vector<s16> input(2000, -12345);
+    for (const float sample : Resample(resampler, input, GetStep(32000, 48000)))
+      EXPECT_NEAR(sample, -12345.0f, 0.05f);
+  }
+}
+
+TEST(Resampler, Quality)
+{
+  Resampler linear;
+  Resampler medium;
+  Resampler high;
+  medium.SetFilter(ResamplingQuality::Medium, 1.0f);
+  high.SetFilter(ResamplingQuality::High, 1.0f);
+
+  // The DSP rate to a common output rate, with a tone in the middle of the passband.
+  const double linear_snr = MeasureSNR(linear, 5000, 32000, 48000);
+  const double medium_snr = MeasureSNR(medium, 5000, 32000, 48000);
+  const double high_snr = MeasureSNR(high, 5000, 32000, 48000);
+  EXPECT_GT(medium_snr, linear_snr + 10.0);
+  EXPECT_GT(high_snr, 55.0);
+
+  // Going down to 32 kHz, a 20 kHz tone has to be filtered out instead of aliasing to 12 kHz.
+  linear.SetFilter(ResamplingQuality::Linear, 32000.0f / 48000.0f);
+  high.SetFilter(ResamplingQuality::High, 32000.0f / 48000.0f);
+  EXPECT_GT(MeasureAliasing(linear, 20000, 48000, 32000), -20.0);
+  EXPECT_LT(MeasureAliasing(high, 20000, 48000, 32000), -55.0);
+}
+
+TEST(Resampler, StopsAtEndOfInput)
+{
+  Resampler resampler;
+  resampler.SetFilter(ResamplingQuality::High, 1.0f);
+
+  const std::vector<s16> input(Resampler::MAX_TAPS * 2 + 2);
+  std::vector<float> output(100);
+  u32 position = 0x8000;
+  // Exactly two windows fit: at frames 0 and 1.
+  EXPECT_EQ(resampler.Process(input.data(), Resampler::MAX_TAPS + 1, &position, 0x10000,
+                              output.data(), 50, 1.0f, 1.0f),
+            2u);
+  EXPECT_EQ(position, 0x28000u);
+}
+
+TEST(Resampler, Benchmark)
+{
+  // What the mixer does for each output buffer: four inputs added into the same output.
+  constexpr u32 NUM_INPUTS = 4;
+  constexpr u32 OUTPUT_FRAMES = 512;
+  constexpr int ITERATIONS = 2000;
+
+  const std::vector<s16> input = GenerateSine(OUTPUT_FRAMES, 1000, 32000);
+  std::vector<float> output(OUTPUT_FRAMES * 2);
+  const u32 step = GetStep(32000, 48000);
+
+  for (const ResamplingQuality quality :
+       {ResamplingQuality::Linear, ResamplingQuality::Medium, ResamplingQuality::High})
+  {
+    Resampler resampler;
+    resampler.SetFilter(quality, 1.0f);
+
+    u32 frames = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+      for (u32 j = 0; j < NUM_INPUTS; ++j)
+      {
+        u32 position = 0;
+        frames += resampler.Process(input.data(), OUTPUT_FRAMES, &position, step, output.data(),
+                                    OUTPUT_FRAMES, 1.0f, 1.0f);
+      }
+    }
+    const std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+    EXPECT_GT(frames, 0u);
+
+    const double ns_per_frame = time.count() / frames;
+    fmt::print("Resampler with {} taps: {:.2f} ns per output frame\n", resampler.GetTaps(),
+               ns_per_frame);
+    RecordProperty(fmt::format("ns_per_frame_{}_taps", resampler.GetTaps()),
+                   fmt::format("{:.2f}", ns_per_frame));
+  }
+}
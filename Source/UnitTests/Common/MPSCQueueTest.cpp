@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/EventCount.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32, 8> q;
+
+  EXPECT_TRUE(q.Empty());
+  u32 v;
+  EXPECT_FALSE(q.Pop(v));
+
+  for (u32 i = 0; i < 8; ++i)
+    EXPECT_TRUE(q.TryPush(i));
+  EXPECT_FALSE(q.TryPush(8u));
+  EXPECT_FALSE(q.Empty());
+
+  // Test the FIFO order, including after the positions wrap around the slots.
+  for (u32 round = 0; round < 3; ++round)
+  {
+    for (u32 i = 0; i < 8; ++i)
+    {
+      ASSERT_TRUE(q.Pop(v));
+      EXPECT_EQ(round * 8 + i, v);
+      EXPECT_TRUE(q.TryPush((round + 1) * 8 + i));
+    }
+  }
+  for (u32 i = 0; i < 8; ++i)
+    ASSERT_TRUE(q.Pop(v));
+  EXPECT_TRUE(q.Empty());
+}
+
+// Several producers hand values to a consumer that sleeps on an EventCount while the queue is
+// empty. Also reports the throughput, so that this doubles as a benchmark.
+TEST(MPSCQueue, MultiThreaded)
+{
+  static constexpr u32 NUM_PRODUCERS = 4;
+  static constexpr u32 NUM_VALUES = 100000;
+
+  Common::MPSCQueue<u32, 256> q;
+  Common::EventCount not_empty;
+  Common::EventCount not_full;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> producers;
+  for (u32 producer = 0; producer < NUM_PRODUCERS; ++producer)
+  {
+    producers.emplace_back([&, producer] {
+      for (u32 i = 0; i < NUM_VALUES; ++i)
+      {
+        const u32 value = producer << 24 | i;
+        while (true)
+        {
+          const Common::EventCount::Key key = not_full.PrepareWait();
+          if (q.TryPush(value))
+          {
+            not_full.CancelWait();
+            break;
+          }
+          not_full.Wait(key);
+        }
+        not_empty.NotifyAll();
+      }
+    });
+  }
+
+  // Values from each producer must arrive in the order they were pushed.
+  std::array<u32, NUM_PRODUCERS> next{};
+  for (u32 received = 0; received < NUM_PRODUCERS * NUM_VALUES; ++received)
+  {
+    u32 v;
+    while (true)
+    {
+      const Common::EventCount::Key key = not_empty.PrepareWait();
+      if (q.Pop(v))
+      {
+        not_empty.CancelWait();
+        break;
+      }
+      not_empty.Wait(key);
+    }
+    not_full.NotifyAll();
+
+    const u32 producer = v >> 24;
+    ASSERT_LT(producer, NUM_PRODUCERS);
+    EXPECT_EQ(next[producer]++, v & 0xffffff);
+  }
+
+  for (std::thread& producer : producers)
+    producer.join();
+
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  RecordProperty("values_per_second",
+                 static_cast<int>(NUM_PRODUCERS * NUM_VALUES / elapsed.count()));
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(EventCount, NotifyWithoutWaiters)
+{
+  Common::EventCount event_count;
+  event_count.NotifyAll();
+
+  // A notification after PrepareWait must end the wait, even if it happens before Wait.
+  const Common::EventCount::Key key = event_count.PrepareWait();
+  event_count.NotifyAll();
+  EXPECT_TRUE(event_count.WaitFor(key, std::chrono::seconds(10)));
+
+  const Common::EventCount::Key key2 = event_count.PrepareWait();
+  EXPECT_FALSE(event_count.WaitFor(key2, std::chrono::milliseconds(1)));
+}
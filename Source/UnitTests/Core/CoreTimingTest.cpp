@@ -5,7 +5,11 @@
 
 #include <array>
 #include <bitset>
+#include <chrono>
 #include <string>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
@@ -401,3 +405,92 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace ManyEventsTest
+{
+static u64 s_last_userdata = 0;
+static u64 s_events_run = 0;
+
+// userdata is (time << 24) | schedule order, so it must never go down between callbacks.
+static void OrderCallback(Core::System& system, u64 userdata, s64 lateness)
+{
+  EXPECT_LE(s_last_userdata, userdata);
+  EXPECT_EQ(static_cast<u64>(system.GetCoreTiming().GetTicks() - lateness), userdata >> 24);
+  s_last_userdata = userdata;
+  ++s_events_run;
+}
+}  // namespace ManyEventsTest
+
+// Schedules and cancels thousands of events per frame, like SI polling and audio DMA do, checks
+// that they still run in order and prints how long the scheduler took.
+TEST(CoreTiming, ManyEvents)
+{
+  using namespace ManyEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  constexpr u32 EVENT_TYPES = 64;
+  constexpr u32 FRAMES = 60;
+  constexpr u32 EVENTS_PER_FRAME = 4000;
+  constexpr s64 FRAME_LENGTH = 8100000;  // About 1/60 s at the GameCube CPU clock
+
+  std::vector<CoreTiming::EventType*> event_types;
+  for (u32 i = 0; i < EVENT_TYPES; ++i)
+    event_types.push_back(core_timing.RegisterEvent(fmt::format("event{}", i), OrderCallback));
+
+  // Don't let the throttle sleep.
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  s_last_userdata = 0;
+  s_events_run = 0;
+  u64 events_expected = 0;
+  u64 schedule_order = 0;
+  u32 random = 1;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (u32 frame = 0; frame < FRAMES; ++frame)
+  {
+    std::array<u32, EVENT_TYPES> scheduled_per_type{};
+    for (u32 i = 0; i < EVENTS_PER_FRAME; ++i)
+    {
+      random = random * 1103515245 + 12345;
+      const u32 type = (random >> 8) % EVENT_TYPES;
+      // Mostly short delays, with some events sharing the same time.
+      const s64 cycles = (random >> 16) % 4 == 0 ? 1000 : (random >> 12) % FRAME_LENGTH;
+      const u64 time = core_timing.GetTicks() + cycles;
+      core_timing.ScheduleEvent(cycles, event_types[type], (time << 24) | schedule_order++);
+      ++scheduled_per_type[type];
+    }
+
+    // Cancel a few event types again.
+    for (u32 type = frame % 8; type < EVENT_TYPES; type += 8)
+    {
+      core_timing.RemoveEvent(event_types[type]);
+      scheduled_per_type[type] = 0;
+    }
+    for (u32 count : scheduled_per_type)
+      events_expected += count;
+
+    const u64 frame_end = core_timing.GetTicks() + FRAME_LENGTH;
+    while (core_timing.GetTicks() < frame_end)
+    {
+      ppc_state.downcount = 0;
+      core_timing.Advance();
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(events_expected, s_events_run);
+
+  fmt::print("{} events in {} frames: {} us\n", s_events_run, FRAMES,
+             std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
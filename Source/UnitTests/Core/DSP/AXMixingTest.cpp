@@ -0,0 +1,169 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+namespace
+{
+// The scalar loops which AX used before the mixing functions were split out.
+void ReferenceMixAdd(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                     s16* dpop)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= *volume;
+    sample >>= 15;
+    sample = std::clamp((s32)sample, -32767, 32767);
+
+    out[i] += (s16)sample;
+    *volume += volume_delta;
+
+    *dpop = (s16)sample;
+  }
+}
+
+void ReferenceResample(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                       const s16* coeffs)
+{
+  s16 temp[4];
+  u32 idx = 0;
+  u32 read_samples_count = 4;
+  for (u32 i = 0; i < 4; ++i)
+    temp[idx++ & 3] = input[i];
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    while (curr_pos >= 0x10000)
+    {
+      temp[idx++ & 3] = input[read_samples_count++];
+      curr_pos -= 0x10000;
+    }
+
+    if (coeffs)
+    {
+      const s16* c = &coeffs[((curr_pos & 0xFFFF) >> 9) << 2];
+      s64 t0 = temp[idx++ & 3];
+      s64 t1 = temp[idx++ & 3];
+      s64 t2 = temp[idx++ & 3];
+      s64 t3 = temp[idx++ & 3];
+      output[i] = MathUtil::SaturatingCast<s16>((t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >>
+                                                15);
+    }
+    else if (u16 curr_frac = curr_pos & 0xFFFF)
+    {
+      u16 inv_curr_frac = -curr_frac;
+      s32 s0 = temp[idx++ & 3];
+      s32 s1 = temp[idx++ & 3];
+      output[i] = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
+      idx += 2;
+    }
+    else
+    {
+      output[i] = temp[idx++ & 3];
+      idx += 3;
+    }
+  }
+}
+
+// Random parameters like the ones found in PBs. Some samples use the extreme values, since those
+// are the ones which can overflow the intermediate results.
+class AXMixingTest : public testing::Test
+{
+protected:
+  s16 RandomSample()
+  {
+    const u32 kind = std::uniform_int_distribution<u32>(0, 15)(m_rng);
+    if (kind == 0)
+      return -32768;
+    if (kind == 1)
+      return 32767;
+    return static_cast<s16>(std::uniform_int_distribution<int>(-32768, 32767)(m_rng));
+  }
+
+  u32 RandomU32(u32 max) { return std::uniform_int_distribution<u32>(0, max)(m_rng); }
+
+  std::vector<s16> RandomSamples(size_t count)
+  {
+    std::vector<s16> samples(count);
+    std::ranges::generate(samples, [this] { return RandomSample(); });
+    return samples;
+  }
+
+  std::mt19937 m_rng{1234};
+};
+}  // namespace
+
+TEST_F(AXMixingTest, MixAdd)
+{
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    // AX GC mixes 32 samples and AX Wii mixes 96, or 6 or 18 for Wii Remotes.
+    const u32 count = RandomU32(100);
+    const std::vector<s16> input = RandomSamples(count);
+    const u16 start_volume = static_cast<u16>(RandomU32(0xFFFF));
+    const u16 volume_delta = iteration % 2 ? static_cast<u16>(RandomU32(0xFFFF)) : 0;
+
+    std::vector<int> expected(count);
+    std::ranges::generate(expected,
+                          [this] { return static_cast<int>(RandomU32(0x20000)) - 0x10000; });
+    std::vector<int> out = expected;
+    u16 expected_volume = start_volume;
+    u16 volume = start_volume;
+    s16 expected_dpop = 123;
+    s16 dpop = 123;
+
+    ReferenceMixAdd(expected.data(), input.data(), count, &expected_volume, volume_delta,
+                    &expected_dpop);
+    DSP::HLE::AXMixing::MixAdd(out.data(), input.data(), count, &volume, volume_delta, &dpop);
+
+    EXPECT_EQ(out, expected);
+    EXPECT_EQ(volume, expected_volume);
+    EXPECT_EQ(dpop, expected_dpop);
+  }
+}
+
+TEST_F(AXMixingTest, Resample)
+{
+  std::vector<s16> coeffs = RandomSamples(0x200);
+  // Every tap at its minimum makes the sum of products overflow 32 bits.
+  std::fill_n(coeffs.begin(), 4, -32768);
+
+  for (int iteration = 0; iteration < 4000; ++iteration)
+  {
+    const bool polyphase = iteration % 2;
+    const u32 count = 1 + RandomU32(99);
+    const u32 curr_pos = iteration % 8 < 2 ? 0 : RandomU32(0xFFFF);
+    // Mostly pitches around the output rate, sometimes exact multiples of it.
+    u32 ratio = RandomU32(0x40000);
+    if (iteration % 5 == 0)
+      ratio &= 0xFFFF0000;
+
+    const u32 input_count = DSP::HLE::AXMixing::GetResampleInputCount(count, curr_pos, ratio);
+    ASSERT_LE(input_count, DSP::HLE::AXMixing::MAX_RESAMPLE_INPUT);
+    std::vector<s16> input = RandomSamples(input_count + 4);
+    if (iteration % 16 == 1)
+      std::ranges::fill(input, -32768);
+
+    std::vector<s16> expected(count);
+    std::vector<s16> output(count);
+    const s16* c = polyphase ? coeffs.data() : nullptr;
+    ReferenceResample(input.data(), expected.data(), count, curr_pos, ratio, c);
+    if (polyphase)
+      DSP::HLE::AXMixing::ResamplePolyphase(input.data(), output.data(), count, curr_pos, ratio, c);
+    else
+      DSP::HLE::AXMixing::ResampleLinear(input.data(), output.data(), count, curr_pos, ratio);
+
+    EXPECT_EQ(output, expected) << "polyphase " << polyphase << " ratio " << ratio;
+  }
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -185,3 +187,79 @@ TEST(DSPAccelerator, CurrentAddressSkips)
   accelerator.TestRead();
   EXPECT_EQ(accelerator.GetCurrentAddress(), 0x00000013u);
 }
+
+// Accelerator over random memory which loops back to the start address like the AX UCode does.
+class LoopingTestAccelerator : public DSP::Accelerator
+{
+public:
+  LoopingTestAccelerator(const std::vector<u8>& memory, bool direct_access)
+      : m_memory(memory), m_direct_access(direct_access)
+  {
+  }
+
+protected:
+  void OnEndException() override
+  {
+    SetPredScale(0x15);
+    SetYn1(GetYn1());
+    SetYn2(GetYn2());
+  }
+  u8 ReadMemory(u32 address) override { return m_memory[address % m_memory.size()]; }
+  void WriteMemory(u32 address, u8 value) override {}
+  const u8* GetMemoryRange(u32 address, u32 size) override
+  {
+    if (!m_direct_access || address >= m_memory.size() || size > m_memory.size() - address)
+      return nullptr;
+    return &m_memory[address];
+  }
+
+private:
+  const std::vector<u8>& m_memory;
+  bool m_direct_access;
+};
+
+TEST(DSPAccelerator, BulkReads)
+{
+  std::mt19937 rng(1234);
+  std::vector<u8> memory(0x400);
+  for (u8& byte : memory)
+    byte = static_cast<u8>(rng());
+  std::array<s16, 16> coefs;
+  for (s16& coef : coefs)
+    coef = static_cast<s16>(rng());
+
+  for (int iteration = 0; iteration < 600; ++iteration)
+  {
+    const u16 format = std::array<u16, 3>{0x00, 0x0A, 0x19}[iteration % 3];
+    const bool direct_access = iteration % 2;
+    LoopingTestAccelerator expected(memory, direct_access);
+    LoopingTestAccelerator accelerator(memory, !direct_access);
+    const u32 start = rng() % 0x100;
+    const u32 end = start + 1 + rng() % 0x200;
+    // Also start past the end address sometimes, where reads wrap around.
+    const u32 current = iteration % 16 == 5 ? end + 1 : start + rng() % (end - start);
+    for (DSP::Accelerator* acc : {static_cast<DSP::Accelerator*>(&expected),
+                                  static_cast<DSP::Accelerator*>(&accelerator)})
+    {
+      acc->SetSampleFormat(format);
+      acc->SetStartAddress(start);
+      acc->SetEndAddress(end);
+      acc->SetCurrentAddress(current);
+      acc->SetPredScale(0x23);
+      acc->SetYn1(100);
+      acc->SetYn2(-100);
+    }
+
+    std::vector<s16> expected_samples(rng() % 0x300);
+    for (s16& sample : expected_samples)
+      sample = static_cast<s16>(expected.Read(coefs.data()));
+    std::vector<s16> samples(expected_samples.size());
+    accelerator.ReadSamples(coefs.data(), samples);
+
+    EXPECT_EQ(samples, expected_samples);
+    EXPECT_EQ(accelerator.GetCurrentAddress(), expected.GetCurrentAddress());
+    EXPECT_EQ(accelerator.GetYn1(), expected.GetYn1());
+    EXPECT_EQ(accelerator.GetYn2(), expected.GetYn2());
+    EXPECT_EQ(accelerator.GetPredScale(), expected.GetPredScale());
+  }
+}
@@ -0,0 +1,194 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
+
+namespace
+{
+// The scalar loops which the Zelda renderer used before the mixing functions were split out.
+void ReferenceApplyVolume(s16* buf, size_t count, u16 vol, u32 shift)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    s32 tmp = (u32)buf[i] * (u32)vol;
+    tmp >>= shift;
+    buf[i] = (s16)std::clamp(tmp, -0x8000, 0x7FFF);
+  }
+}
+
+void ReferenceAddWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  while (count--)
+  {
+    s32 vol_src = ((s32)*src++ * (s32)vol) >> 15;
+    *dst++ += std::clamp(vol_src, -0x8000, 0x7FFF);
+  }
+}
+
+s32 ReferenceAddWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    dst[i] += ((vol >> 16) * src[i]) >> 16;
+    vol += step;
+  }
+  return vol;
+}
+
+void ReferenceResample(const s16* src, s16* dst, size_t count, u32 pos, u32 ratio,
+                       const s16* resampling_coeffs)
+{
+  for (size_t j = 0; j < count; ++j)
+  {
+    u32 coeffs_idx = ((pos & 0xFFF) >> 6) * 4;
+    const s16* coeffs = &resampling_coeffs[coeffs_idx];
+    const s16* input = &src[pos >> 12];
+
+    s64 dst_sample_unclamped = 0;
+    for (size_t i = 0; i < 4; ++i)
+      dst_sample_unclamped += (s64)2 * coeffs[i] * input[i];
+    dst_sample_unclamped >>= 16;
+
+    dst[j] = (s16)std::clamp<s64>(dst_sample_unclamped, -0x8000, 0x7FFF);
+
+    pos += ratio;
+  }
+}
+
+void ReferenceFilter8(s16* buffer, size_t count, const s16* filter_coeffs)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    // The UCode's accumulator wraps around, the sum of 8 products can exceed 32 bits.
+    u32 sample = 0;
+    for (u16 j = 0; j < 8; ++j)
+      sample += (u32)((s32)buffer[i + j] * filter_coeffs[j]);
+    buffer[i] = std::clamp((s32)sample >> 15, -0x8000, 0x7FFF);
+  }
+}
+
+class ZeldaMixingTest : public testing::Test
+{
+protected:
+  s16 RandomSample()
+  {
+    const u32 kind = std::uniform_int_distribution<u32>(0, 15)(m_rng);
+    if (kind == 0)
+      return -32768;
+    if (kind == 1)
+      return 32767;
+    return static_cast<s16>(std::uniform_int_distribution<int>(-32768, 32767)(m_rng));
+  }
+
+  u32 RandomU32(u32 max) { return std::uniform_int_distribution<u32>(0, max)(m_rng); }
+
+  std::vector<s16> RandomSamples(size_t count)
+  {
+    std::vector<s16> samples(count);
+    std::ranges::generate(samples, [this] { return RandomSample(); });
+    return samples;
+  }
+
+  std::mt19937 m_rng{5678};
+};
+}  // namespace
+
+TEST_F(ZeldaMixingTest, Volume)
+{
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    // The renderer mixes 0x50 samples, or 0x28 for parts of the reverb.
+    const size_t count = RandomU32(0x58);
+    const u16 volume = static_cast<u16>(RandomU32(0xFFFF));
+    const std::vector<s16> src = RandomSamples(count);
+    std::vector<s16> expected = RandomSamples(count);
+    std::vector<s16> out = expected;
+
+    if (iteration % 2)
+    {
+      const u32 shift = iteration % 4 == 1 ? 15 : 12;
+      ReferenceApplyVolume(expected.data(), count, volume, shift);
+      DSP::HLE::ZeldaMixing::ApplyVolume(out.data(), count, volume, shift);
+    }
+    else
+    {
+      ReferenceAddWithVolume(expected.data(), src.data(), count, volume);
+      DSP::HLE::ZeldaMixing::AddWithVolume(out.data(), src.data(), count, volume);
+    }
+    EXPECT_EQ(out, expected);
+  }
+}
+
+TEST_F(ZeldaMixingTest, VolumeRamp)
+{
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const size_t count = RandomU32(0x58);
+    const s32 volume = static_cast<s32>(RandomU32(0xFFFF) << 16) >> 1;
+    // Like the deltas computed by AddVoice, which ramp between two 16 bit volumes.
+    const s32 step = count ? ((static_cast<s32>(RandomU32(0xFFFF)) - 0x8000) << 16) /
+                                 static_cast<s32>(count) :
+                             0;
+    const std::vector<s16> src = RandomSamples(count);
+    std::vector<s16> expected = RandomSamples(count);
+    std::vector<s16> out = expected;
+
+    const s32 expected_volume =
+        ReferenceAddWithVolumeRamp(expected.data(), src.data(), count, volume, step);
+    EXPECT_EQ(DSP::HLE::ZeldaMixing::AddWithVolumeRamp(out.data(), src.data(), count, volume, step),
+              expected_volume);
+    EXPECT_EQ(out, expected);
+  }
+}
+
+TEST_F(ZeldaMixingTest, Resample)
+{
+  std::vector<s16> coeffs = RandomSamples(0x100);
+  // Every tap at its minimum makes the sum of products overflow 32 bits.
+  std::fill_n(coeffs.begin(), 4, -32768);
+
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const size_t count = 1 + RandomU32(0x4F);
+    const u32 pos = RandomU32(0xFFF);
+    // Resampling ratios below 4:1, which are the ones that get interpolated.
+    const u32 ratio = RandomU32(0x3FFF);
+    std::vector<s16> input = RandomSamples(((pos + count * ratio) >> 12) + 4);
+    if (iteration % 16 == 1)
+      std::ranges::fill(input, -32768);
+
+    std::vector<s16> expected(count);
+    std::vector<s16> output(count);
+    ReferenceResample(input.data(), expected.data(), count, pos, ratio, coeffs.data());
+    DSP::HLE::ZeldaMixing::ResamplePolyphase(input.data(), output.data(), count, pos, ratio,
+                                             coeffs.data());
+    EXPECT_EQ(output, expected);
+  }
+}
+
+TEST_F(ZeldaMixingTest, Filter8)
+{
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const size_t count = RandomU32(0x50);
+    std::vector<s16> coeffs = RandomSamples(8);
+    std::vector<s16> expected = RandomSamples(count + 7);
+    if (iteration % 16 == 1)
+    {
+      std::ranges::fill(coeffs, -32768);
+      std::ranges::fill(expected, -32768);
+    }
+    std::vector<s16> buffer = expected;
+
+    ReferenceFilter8(expected.data(), count, coeffs.data());
+    DSP::HLE::ZeldaMixing::Filter8(buffer.data(), count, coeffs.data());
+    EXPECT_EQ(buffer, expected);
+  }
+}
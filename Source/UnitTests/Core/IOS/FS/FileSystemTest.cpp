@@ -12,6 +12,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/MemoryBackend/MemoryFS.h"
 #include "Core/IOS/IOS.h"
 #include "UICommon/UICommon.h"
 
@@ -416,6 +417,69 @@ TEST_F(FileSystemTest, MultipleHandles)
   EXPECT_EQ(TEST_DATA, read_buffer);
 }
 
+TEST_F(FileSystemTest, WriteBack)
+{
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/f", 0, modes), ResultCode::Success);
+
+  const std::vector<u8> TEST_DATA{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/f", Mode::ReadWrite);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write(TEST_DATA.data(), TEST_DATA.size()).Succeeded());
+    ASSERT_TRUE(file->Seek(2, SeekMode::Set).Succeeded());
+    ASSERT_TRUE(file->Write(TEST_DATA.data(), 3).Succeeded());
+
+    // The size is known before the data reaches the host file.
+    const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/f");
+    ASSERT_TRUE(metadata.Succeeded());
+    EXPECT_EQ(metadata->size, TEST_DATA.size());
+  }
+
+  // Reopening the file reads it from the host again, after it got written back on close.
+  const std::vector<u8> EXPECTED_DATA{{0, 1, 0, 1, 2, 5, 6, 7, 8, 9}};
+  std::vector<u8> read_buffer(EXPECTED_DATA.size());
+  const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/f", Mode::Read);
+  ASSERT_TRUE(file.Succeeded());
+  ASSERT_TRUE(file->Read(read_buffer.data(), read_buffer.size()).Succeeded());
+  EXPECT_EQ(EXPECTED_DATA, read_buffer);
+}
+
+TEST_F(FileSystemTest, MemoryFileSystem)
+{
+  const std::vector<u8> TEST_DATA{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/f", 0, modes), ResultCode::Success);
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/f", Mode::Write);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write(TEST_DATA.data(), TEST_DATA.size()).Succeeded());
+  }
+  m_fs->Flush();
+
+  MemoryFileSystem memory_fs{MakeFileSystem()};
+  {
+    // Files of the base file system can be read and modified.
+    const Result<FileHandle> file = memory_fs.OpenFile(Uid{0}, Gid{0}, "/tmp/f", Mode::ReadWrite);
+    ASSERT_TRUE(file.Succeeded());
+    std::vector<u8> read_buffer(TEST_DATA.size());
+    ASSERT_TRUE(file->Read(read_buffer.data(), read_buffer.size()).Succeeded());
+    EXPECT_EQ(TEST_DATA, read_buffer);
+    ASSERT_TRUE(file->Write(TEST_DATA.data(), 3).Succeeded());
+    EXPECT_EQ(file->GetStatus()->size, 13u);
+  }
+  EXPECT_EQ(memory_fs.CreateFile(Uid{0}, Gid{0}, "/tmp/g", 0, modes), ResultCode::Success);
+  EXPECT_EQ(memory_fs.Rename(Uid{0}, Gid{0}, "/tmp", "/tmp2"), ResultCode::Success);
+  EXPECT_EQ(memory_fs.GetMetadata(Uid{0}, Gid{0}, "/tmp2/f")->size, 13u);
+  EXPECT_TRUE(memory_fs.GetNandStats().Succeeded());
+
+  const std::vector<std::string> EXPECTED_PATHS{{"/tmp", "/tmp/f", "/tmp/g", "/tmp2"}};
+  EXPECT_EQ(memory_fs.GetModifiedPaths(), EXPECTED_PATHS);
+
+  // None of the changes reach the base file system.
+  EXPECT_EQ(m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/f")->size, TEST_DATA.size());
+  EXPECT_FALSE(m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/g").Succeeded());
+  EXPECT_FALSE(m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp2").Succeeded());
+}
+
 // ReadDirectory is used by official titles to determine whether a path is a file.
 // If it is not a file, ResultCode::Invalid must be returned.
 TEST_F(FileSystemTest, ReadDirectoryOnFile)
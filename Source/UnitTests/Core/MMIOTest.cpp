@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/GPFifo.h"
@@ -138,3 +139,41 @@ TEST_F(MappingTest, ReadWriteComplex)
   EXPECT_TRUE(read_called);
   EXPECT_TRUE(write_called);
 }
+
+TEST_F(MappingTest, AccessCounting)
+{
+  m_mapping->Register(0x0C002000, MMIO::Constant<u16>(0), MMIO::Nop<u16>());
+  m_mapping->Register(0x0C006400, MMIO::Constant<u32>(0), MMIO::Nop<u32>());
+  m_mapping->Register(0x0D006400, MMIO::Constant<u32>(0), MMIO::Nop<u32>());
+
+  // Nothing is counted until counting is enabled.
+  m_mapping->Read<u16>(*m_system, 0x0C002000);
+  EXPECT_TRUE(m_mapping->GetAccessCounts().empty());
+
+  m_mapping->SetAccessCountingEnabled(true);
+  for (u32 i = 0; i < 3; ++i)
+    m_mapping->Read<u16>(*m_system, 0x0C002000);
+  m_mapping->Write<u32>(*m_system, 0x0C006400, 0);
+  m_mapping->Write<u32>(*m_system, 0x0D006400, 0);
+  m_mapping->Write<u32>(*m_system, 0x0D806400, 0);
+
+  const std::vector<MMIO::Mapping::AccessCount> counts = m_mapping->GetAccessCounts();
+  ASSERT_EQ(3u, counts.size());
+
+  EXPECT_EQ(0x0C002000u, counts[0].address);
+  EXPECT_EQ(16u, counts[0].width);
+  EXPECT_FALSE(counts[0].is_write);
+  EXPECT_EQ(3u, counts[0].count);
+
+  // The Wii block and its mirror share their registers.
+  EXPECT_EQ(0x0D006400u, counts[1].address);
+  EXPECT_TRUE(counts[1].is_write);
+  EXPECT_EQ(2u, counts[1].count);
+
+  EXPECT_EQ(0x0C006400u, counts[2].address);
+  EXPECT_EQ(32u, counts[2].width);
+  EXPECT_EQ(1u, counts[2].count);
+
+  m_mapping->SetAccessCountingEnabled(false);
+  EXPECT_TRUE(m_mapping->GetAccessCounts().empty());
+}
@@ -0,0 +1,286 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+// Kernels run in real mode, right above the exception vectors.
+constexpr u32 CODE_ADDRESS = 0x00004000;
+constexpr u32 COPY_SOURCE_ADDRESS = 0x00100000;
+constexpr u32 COPY_DEST_ADDRESS = 0x00200000;
+constexpr u32 COPY_WORDS = 0x4000;
+constexpr u32 LOOP_ITERATIONS = 0x10000;
+
+// A few encoders for the instructions used by the kernels below.
+constexpr u32 D_Form(u32 opcode, u32 d, u32 a, s16 imm)
+{
+  return (opcode << 26) | (d << 21) | (a << 16) | static_cast<u16>(imm);
+}
+
+constexpr u32 X_Form(u32 opcode, u32 d, u32 a, u32 b, u32 xo)
+{
+  return (opcode << 26) | (d << 21) | (a << 16) | (b << 11) | (xo << 1);
+}
+
+constexpr u32 A_Form(u32 d, u32 a, u32 b, u32 c, u32 xo)
+{
+  return (4u << 26) | (d << 21) | (a << 16) | (b << 11) | (c << 6) | (xo << 1);
+}
+
+constexpr u32 ADDI(u32 d, u32 a, s16 imm)
+{
+  return D_Form(14, d, a, imm);
+}
+
+constexpr u32 ADDIS(u32 d, u32 a, s16 imm)
+{
+  return D_Form(15, d, a, imm);
+}
+
+constexpr u32 CMPWI(u32 a, s16 imm)
+{
+  return D_Form(11, 0, a, imm);
+}
+
+constexpr u32 LWZU(u32 d, u32 a, s16 offset)
+{
+  return D_Form(33, d, a, offset);
+}
+
+constexpr u32 STWU(u32 s, u32 a, s16 offset)
+{
+  return D_Form(37, s, a, offset);
+}
+
+constexpr u32 ADD(u32 d, u32 a, u32 b)
+{
+  return X_Form(31, d, a, b, 266);
+}
+
+constexpr u32 XOR(u32 a, u32 s, u32 b)
+{
+  return X_Form(31, s, a, b, 316);
+}
+
+constexpr u32 RLWINM(u32 a, u32 s, u32 sh, u32 mb, u32 me)
+{
+  return (21u << 26) | (s << 21) | (a << 16) | (sh << 11) | (mb << 6) | (me << 1);
+}
+
+constexpr u32 MTCTR(u32 s)
+{
+  return X_Form(31, s, 9, 0, 467);
+}
+
+constexpr u32 PS_ADD(u32 d, u32 a, u32 b)
+{
+  return A_Form(d, a, b, 0, 21);
+}
+
+constexpr u32 PS_MUL(u32 d, u32 a, u32 c)
+{
+  return A_Form(d, a, 0, c, 25);
+}
+
+constexpr u32 PS_MADD(u32 d, u32 a, u32 c, u32 b)
+{
+  return A_Form(d, a, b, c, 29);
+}
+
+// Branch offsets are in instructions, relative to the branch itself.
+constexpr u32 B(s32 offset)
+{
+  return (18u << 26) | (static_cast<u32>(offset * 4) & 0x03fffffc);
+}
+
+constexpr u32 BC(u32 bo, u32 bi, s32 offset)
+{
+  return (16u << 26) | (bo << 21) | (bi << 16) | (static_cast<u32>(offset * 4) & 0xfffc);
+}
+
+constexpr u32 BDNZ(s32 offset)
+{
+  return BC(16, 0, offset);
+}
+
+constexpr u32 BEQ(s32 offset)
+{
+  return BC(12, 2, offset);
+}
+
+struct Kernel
+{
+  const char* name;
+  // Must end with a branch to itself, which is where the run stops.
+  std::vector<u32> code;
+};
+
+const std::vector<Kernel> KERNELS = {
+    {"IntegerLoop",
+     {
+         ADDI(3, 0, 0),
+         ADDI(4, 0, 1),
+         ADDIS(6, 0, LOOP_ITERATIONS >> 16),
+         MTCTR(6),
+         ADD(3, 3, 4),
+         XOR(4, 4, 3),
+         RLWINM(4, 4, 1, 0, 31),
+         ADDI(4, 4, 7),
+         BDNZ(-4),
+         B(0),
+     }},
+    {"PairedSingle",
+     {
+         ADDIS(6, 0, LOOP_ITERATIONS >> 16),
+         MTCTR(6),
+         PS_MADD(1, 2, 3, 1),
+         PS_MUL(4, 2, 3),
+         PS_ADD(5, 5, 4),
+         BDNZ(-3),
+         B(0),
+     }},
+    {"Memcpy",
+     {
+         ADDIS(3, 0, COPY_SOURCE_ADDRESS >> 16),
+         ADDI(3, 3, -4),
+         ADDIS(4, 0, COPY_DEST_ADDRESS >> 16),
+         ADDI(4, 4, -4),
+         ADDI(6, 0, COPY_WORDS),
+         MTCTR(6),
+         LWZU(5, 3, 4),
+         STWU(5, 4, 4),
+         BDNZ(-2),
+         B(0),
+     }},
+    {"BranchHeavy",
+     {
+         ADDI(3, 0, 0),
+         ADDI(4, 0, 0),
+         ADDIS(6, 0, LOOP_ITERATIONS >> 16),
+         MTCTR(6),
+         // A tiny bytecode dispatcher that switches on the low bits of the loop counter.
+         RLWINM(5, 3, 0, 30, 31),
+         CMPWI(5, 0),
+         BEQ(5),
+         CMPWI(5, 1),
+         BEQ(5),
+         ADDI(4, 4, 3),
+         B(4),
+         ADDI(4, 4, 1),
+         B(2),
+         XOR(4, 4, 3),
+         ADDI(3, 3, 1),
+         BDNZ(-11),
+         B(0),
+     }},
+};
+
+// Runs small hand-assembled kernels through the interpreter and reports how fast they run. The
+// results are also recorded as test properties, so that the dolphin-bench target can write them
+// out as JSON for tracking over time.
+class CPUBenchmark : public testing::TestWithParam<Kernel>
+{
+protected:
+  CPUBenchmark()
+      : m_system(Core::System::GetInstance()), m_memory(m_system.GetMemory()),
+        m_ppc_state(m_system.GetPPCState()), m_interpreter(m_system.GetInterpreter())
+  {
+  }
+
+  void SetUp() override
+  {
+    m_memory.Init();
+    m_interpreter.Init();
+
+    m_ppc_state.msr.Hex = 0;
+    m_ppc_state.msr.FP = 1;
+    HID2(m_ppc_state).PSE = 1;
+
+    for (u32 i = 0; i < COPY_WORDS; ++i)
+      m_memory.Write_U32(i * 0x9E3779B9, COPY_SOURCE_ADDRESS + i * sizeof(u32));
+  }
+
+  void TearDown() override
+  {
+    HID2(m_ppc_state).PSE = 0;
+    m_ppc_state.msr.Hex = 0;
+    m_memory.Shutdown();
+  }
+
+  // Returns the number of guest instructions executed.
+  u64 RunKernel(const Kernel& kernel)
+  {
+    for (u32 i = 0; i < kernel.code.size(); ++i)
+      m_memory.Write_U32(kernel.code[i], CODE_ADDRESS + i * sizeof(u32));
+
+    m_ppc_state.ps[2].SetBoth(0.5, 0.25);
+    m_ppc_state.ps[3].SetBoth(1.0, 2.0);
+
+    const u32 end_address = CODE_ADDRESS + static_cast<u32>(kernel.code.size() - 1) * 4;
+    m_ppc_state.pc = CODE_ADDRESS;
+
+    u64 instructions = 0;
+    while (m_ppc_state.pc != end_address)
+    {
+      m_interpreter.SingleStepInner();
+      ++instructions;
+    }
+    return instructions;
+  }
+
+  Core::System& m_system;
+  Memory::MemoryManager& m_memory;
+  PowerPC::PowerPCState& m_ppc_state;
+  Interpreter& m_interpreter;
+};
+}  // namespace
+
+TEST_P(CPUBenchmark, Interpreter)
+{
+  constexpr u32 PASSES = 8;
+  const Kernel& kernel = GetParam();
+
+  // Warm up, and make sure the kernel does what it says on the tin.
+  const u64 instructions_per_pass = RunKernel(kernel);
+  if (std::string(kernel.name) == "Memcpy")
+  {
+    for (u32 i = 0; i < COPY_WORDS; i += 0x100)
+      EXPECT_EQ(m_memory.Read_U32(COPY_DEST_ADDRESS + i * 4), i * 0x9E3779B9);
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (u32 pass = 0; pass < PASSES; ++pass)
+    EXPECT_EQ(RunKernel(kernel), instructions_per_pass);
+  const std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+
+  const double instructions = static_cast<double>(instructions_per_pass) * PASSES;
+  const double ns_per_instruction = time.count() / instructions;
+  const double mips = 1000.0 / ns_per_instruction;
+
+  fmt::print("{:12} {:8.2f} MIPS, {:6.2f} ns/instruction\n", kernel.name, mips,
+             ns_per_instruction);
+
+  RecordProperty("kernel", kernel.name);
+  RecordProperty("cpu_core", m_interpreter.GetName());
+  RecordProperty("guest_instructions", fmt::to_string(instructions_per_pass * PASSES));
+  RecordProperty("mips", fmt::format("{:.2f}", mips));
+  RecordProperty("ns_per_instruction", fmt::format("{:.3f}", ns_per_instruction));
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, CPUBenchmark, testing::ValuesIn(KERNELS),
+                         [](const testing::TestParamInfo<Kernel>& info) {
+                           return std::string(info.param.name);
+                         });
@@ -0,0 +1,159 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <set>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+constexpr u32 PAGE_TABLE_ADDRESS = 0x00100000;  // 64 KiB, so HTABMASK is 0
+constexpr u32 PHYSICAL_BASE_PAGE = 0x200;
+constexpr u32 VSID = 0x123;
+constexpr u32 MAX_PAGES = 4096;
+
+class PageTableWalkTest : public testing::Test
+{
+protected:
+  PageTableWalkTest()
+      : m_system(Core::System::GetInstance()), m_memory(m_system.GetMemory()),
+        m_mmu(m_system.GetMMU()), m_ppc_state(m_system.GetPPCState())
+  {
+  }
+
+  void SetUp() override
+  {
+    m_memory.Init();
+    m_ppc_state.tlb = {};
+
+    for (u32 i = 0; i < 0x10000; i += sizeof(u32))
+      m_memory.Write_U32(0, PAGE_TABLE_ADDRESS + i);
+
+    // Maps effective page i of segment 0 to physical page PHYSICAL_BASE_PAGE + i, using the
+    // primary hash (VSID ^ page index) to pick the PTEG.
+    for (u32 page_index = 0; page_index < MAX_PAGES; ++page_index)
+    {
+      UPTE_Lo pte1;
+      pte1.V = 1;
+      pte1.VSID = VSID;
+      pte1.H = 0;
+      pte1.API = page_index >> 10;
+
+      UPTE_Hi pte2;
+      pte2.RPN = PHYSICAL_BASE_PAGE + page_index;
+      pte2.R = 1;
+      pte2.C = 1;
+      pte2.PP = 2;
+
+      u32 pte_address = PAGE_TABLE_ADDRESS + (((VSID ^ page_index) & 0x3ff) << 6);
+      while (m_memory.Read_U32(pte_address) != 0)
+        pte_address += 8;
+      m_memory.Write_U32(pte1.Hex, pte_address);
+      m_memory.Write_U32(pte2.Hex, pte_address + 4);
+
+      m_memory.Write_U32(page_index, (PHYSICAL_BASE_PAGE + page_index) << 12);
+    }
+
+    m_ppc_state.spr[SPR_SDR] = PAGE_TABLE_ADDRESS;
+    m_mmu.SDRUpdated();
+    m_ppc_state.SetSR(0, VSID);
+    m_ppc_state.msr.DR = 1;
+  }
+
+  void TearDown() override
+  {
+    m_ppc_state.msr.DR = 0;
+    m_ppc_state.SetSR(0, 0);
+    m_ppc_state.spr[SPR_SDR] = 0;
+    m_mmu.SDRUpdated();
+    m_ppc_state.tlb = {};
+    m_mmu.ResetTLBStats();
+    m_memory.Shutdown();
+  }
+
+  // Reads one word from each of the first page_count pages, pass_count times in a row.
+  std::chrono::nanoseconds ReadPages(u32 page_count, u32 pass_count)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (u32 pass = 0; pass < pass_count; ++pass)
+    {
+      for (u32 page_index = 0; page_index < page_count; ++page_index)
+        EXPECT_EQ(m_mmu.Read_U32(page_index << 12), page_index);
+    }
+    return std::chrono::steady_clock::now() - start;
+  }
+
+  void RunBenchmark(u32 page_count)
+  {
+    constexpr u32 PASSES = 16;
+
+    ReadPages(page_count, 1);
+    m_mmu.ResetTLBStats();
+
+    const auto time = ReadPages(page_count, PASSES);
+    const PowerPC::TLBStats stats = m_mmu.GetTLBStats();
+    const u64 accesses = u64(page_count) * PASSES;
+
+    EXPECT_EQ(stats.hits + stats.misses, accesses);
+    EXPECT_EQ(stats.page_table_walks, stats.misses);
+
+    fmt::print("{:5} pages: {:8.2f} ns/access, {} hits, {} misses\n", page_count,
+               double(time.count()) / accesses, stats.hits, stats.misses);
+
+    if (page_count <= PowerPC::TLB_SIZE)
+      EXPECT_EQ(stats.misses, 0u);
+  }
+
+  Core::System& m_system;
+  Memory::MemoryManager& m_memory;
+  PowerPC::MMU& m_mmu;
+  PowerPC::PowerPCState& m_ppc_state;
+};
+}  // namespace
+
+TEST(TLBEntry, ReplacesInvalidWaysFirst)
+{
+  PowerPC::TLBEntry entry;
+  std::set<u32> ways;
+  for (u32 i = 0; i < PowerPC::TLB_WAYS; ++i)
+  {
+    const u32 way = entry.GetReplacementWay();
+    ways.insert(way);
+    entry.tag[way] = i;
+    entry.Touch(way);
+  }
+  EXPECT_EQ(ways.size(), PowerPC::TLB_WAYS);
+}
+
+TEST(TLBEntry, NeverReplacesMostRecentlyUsedWay)
+{
+  PowerPC::TLBEntry entry;
+  entry.tag.fill(0);
+
+  for (u32 way = 0; way < PowerPC::TLB_WAYS; ++way)
+  {
+    entry.Touch(way);
+    EXPECT_NE(entry.GetReplacementWay(), way);
+  }
+
+  // After touching every way in order, the first one is the least recently used.
+  EXPECT_EQ(entry.GetReplacementWay(), 0u);
+}
+
+TEST_F(PageTableWalkTest, Benchmark)
+{
+  fmt::print("page table walk timing ({} TLB entries, {} ways):\n", PowerPC::TLB_SIZE,
+             PowerPC::TLB_WAYS);
+
+  for (u32 page_count : {64u, 1024u, MAX_PAGES})
+    RunBenchmark(page_count);
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+std::vector<u8> MakeState(size_t size, u8 seed)
+{
+  std::vector<u8> state(size);
+  for (size_t i = 0; i < size; i++)
+    state[i] = u8(i * 7);
+  // Only a small part of the state changes between snapshots, like in a real savestate.
+  for (size_t i = 0; i < size; i += 997)
+    state[i] = seed;
+  return state;
+}
+}  // namespace
+
+TEST(RewindBuffer, PopsStatesInReverseOrder)
+{
+  State::RewindBuffer buffer(64 * 1024 * 1024);
+
+  // The states grow and shrink, which the deltas must handle.
+  const std::vector<size_t> sizes = {100000, 100000, 120000, 90000, 90000};
+  for (size_t i = 0; i < sizes.size(); i++)
+    buffer.Push(MakeState(sizes[i], u8(i)));
+  EXPECT_EQ(buffer.GetStateCount(), sizes.size());
+
+  for (size_t i = sizes.size(); i-- > 0;)
+  {
+    std::vector<u8> state;
+    ASSERT_TRUE(buffer.Pop(&state));
+    EXPECT_EQ(state, MakeState(sizes[i], u8(i)));
+  }
+
+  std::vector<u8> state;
+  EXPECT_FALSE(buffer.Pop(&state));
+  EXPECT_EQ(buffer.GetStateCount(), 0u);
+}
+
+TEST(RewindBuffer, DropsOldestStatesWhenFull)
+{
+  constexpr size_t STATE_SIZE = 100000;
+  State::RewindBuffer buffer(STATE_SIZE + 20000);
+
+  for (u8 i = 0; i < 100; i++)
+    buffer.Push(MakeState(STATE_SIZE, i));
+  EXPECT_LE(buffer.GetMemoryUsage(), STATE_SIZE + 20000);
+  EXPECT_GT(buffer.GetStateCount(), 1u);
+  EXPECT_LT(buffer.GetStateCount(), 100u);
+
+  std::vector<u8> state;
+  ASSERT_TRUE(buffer.Pop(&state));
+  EXPECT_EQ(state, MakeState(STATE_SIZE, 99));
+  ASSERT_TRUE(buffer.Pop(&state));
+  EXPECT_EQ(state, MakeState(STATE_SIZE, 98));
+}
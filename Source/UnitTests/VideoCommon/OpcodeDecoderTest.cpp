@@ -0,0 +1,166 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+namespace
+{
+constexpr u32 VERTEX_SIZE = 24;
+
+struct CommandCounts
+{
+  u32 nop_bytes = 0;
+  u32 bp = 0;
+  u32 cp = 0;
+  u32 xf = 0;
+  u32 indexed_loads = 0;
+  u32 primitives = 0;
+  u32 vertices = 0;
+
+  bool operator==(const CommandCounts&) const = default;
+};
+
+class CountingCallback final : public OpcodeDecoder::Callback
+{
+public:
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data)) { counts.xf++; }
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value)) { counts.cp++; }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value)) { counts.bp++; }
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+  {
+    counts.indexed_loads++;
+  }
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices,
+                                          const u8* vertex_data))
+  {
+    counts.primitives++;
+    counts.vertices += num_vertices;
+  }
+  OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size)) {}
+  OPCODE_CALLBACK(void OnNop(u32 count)) { counts.nop_bytes += count; }
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data)) { unknown++; }
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size)) {}
+  OPCODE_CALLBACK(CPState& GetCPState()) { return m_cp_state; }
+  OPCODE_CALLBACK(u32 GetVertexSize(u8 vat)) { return VERTEX_SIZE; }
+
+  CommandCounts counts;
+  u32 unknown = 0;
+
+private:
+  CPState m_cp_state;
+};
+
+void PushU32(std::vector<u8>& fifo, u32 value)
+{
+  fifo.insert(fifo.end(), {u8(value >> 24), u8(value >> 16), u8(value >> 8), u8(value)});
+}
+
+// Builds a FIFO shaped like what games send: a few state changes and a small draw per object,
+// with the occasional run of NOP padding.
+std::vector<u8> GenerateFifo(u32 num_objects, CommandCounts* counts)
+{
+  std::vector<u8> fifo;
+  for (u32 i = 0; i < num_objects; i++)
+  {
+    fifo.push_back(u8(OpcodeDecoder::Opcode::GX_LOAD_CP_REG));
+    fifo.push_back(MATINDEX_A);
+    PushU32(fifo, i & 0x3f);
+    counts->cp++;
+
+    for (u32 j = 0; j < 3; j++)
+    {
+      fifo.push_back(u8(OpcodeDecoder::Opcode::GX_LOAD_BP_REG));
+      PushU32(fifo, (0x28 + j) << 24 | i);
+      counts->bp++;
+    }
+
+    // Four values starting at the first texture matrix.
+    fifo.push_back(u8(OpcodeDecoder::Opcode::GX_LOAD_XF_REG));
+    PushU32(fifo, 3 << 16 | 0x0078);
+    for (u32 j = 0; j < 4; j++)
+      PushU32(fifo, j);
+    counts->xf++;
+
+    fifo.push_back(u8(OpcodeDecoder::Opcode::GX_LOAD_INDX_A));
+    PushU32(fifo, i << 16 | 0xb000);
+    counts->indexed_loads++;
+
+    const u16 num_vertices = 3 + i % 30;
+    fifo.push_back(u8(OpcodeDecoder::Opcode::GX_PRIMITIVE_START) |
+                   u8(OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP)
+                       << OpcodeDecoder::GX_PRIMITIVE_SHIFT);
+    fifo.push_back(u8(num_vertices >> 8));
+    fifo.push_back(u8(num_vertices));
+    fifo.resize(fifo.size() + num_vertices * VERTEX_SIZE, 0x3f);
+    counts->primitives++;
+    counts->vertices += num_vertices;
+
+    if (i % 8 == 7)
+    {
+      const u32 padding = 32 - fifo.size() % 32 + (i % 16 == 15 ? 32 : 0);
+      fifo.resize(fifo.size() + padding, u8(OpcodeDecoder::Opcode::GX_NOP));
+      counts->nop_bytes += padding;
+    }
+  }
+  return fifo;
+}
+}  // namespace
+
+TEST(OpcodeDecoder, CountsNopRuns)
+{
+  // Cover runs ending at every position within and across the vector sizes.
+  for (u32 offset = 0; offset < 4; offset++)
+  {
+    for (u32 nops = 1; nops < 70; nops++)
+    {
+      std::vector<u8> fifo(offset + nops + 1, u8(OpcodeDecoder::Opcode::GX_NOP));
+      fifo.back() = u8(OpcodeDecoder::Opcode::GX_CMD_INVL_VC);
+
+      const u32 available = static_cast<u32>(fifo.size() - offset);
+      EXPECT_EQ(OpcodeDecoder::detail::CountNops(&fifo[offset], available), nops);
+      // A run of NOPs can reach the end of the data.
+      EXPECT_EQ(OpcodeDecoder::detail::CountNops(&fifo[offset], available - 1), nops);
+    }
+  }
+}
+
+TEST(OpcodeDecoder, DecodesMixedCommands)
+{
+  CommandCounts expected;
+  const std::vector<u8> fifo = GenerateFifo(100, &expected);
+
+  CountingCallback callback;
+  const u32 size = OpcodeDecoder::Run(fifo.data(), static_cast<u32>(fifo.size()), callback);
+
+  EXPECT_EQ(size, fifo.size());
+  EXPECT_EQ(callback.unknown, 0u);
+  EXPECT_EQ(callback.counts, expected);
+}
+
+TEST(OpcodeDecoder, Benchmark)
+{
+  constexpr int ITERATIONS = 200;
+
+  CommandCounts expected;
+  const std::vector<u8> fifo = GenerateFifo(20000, &expected);
+
+  CountingCallback callback;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i)
+    OpcodeDecoder::Run(fifo.data(), static_cast<u32>(fifo.size()), callback);
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(callback.counts.primitives, expected.primitives * ITERATIONS);
+
+  const double bytes_per_second = double(fifo.size()) * ITERATIONS / time.count();
+  fmt::print("Opcode decoder: {:.1f} MB/s\n", bytes_per_second / 1e6);
+  RecordProperty("mb_per_second", fmt::format("{:.1f}", bytes_per_second / 1e6));
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/StreamBufferBase.h"
+
+namespace
+{
+constexpr u32 BUFFER_SIZE = 1024;
+
+// Fence counters work like the Vulkan and D3D12 ones: the current counter belongs to the command
+// list being recorded, and Submit() hands it off to the "GPU".
+class TestStreamBuffer final : public StreamBufferBase
+{
+public:
+  explicit TestStreamBuffer(bool resizable)
+  {
+    m_resizable = resizable;
+    ResizeBuffer(BUFFER_SIZE);
+  }
+
+  void Submit() { m_current_fence++; }
+  void CompleteAll() { m_completed_fence = m_current_fence - 1; }
+
+  u32 num_waits = 0;
+
+protected:
+  u64 GetCurrentFenceCounter() const override { return m_current_fence; }
+  u64 GetCompletedFenceCounter() const override { return m_completed_fence; }
+  void WaitForFenceCounter(u64 fence_counter) override
+  {
+    ASSERT_LT(fence_counter, m_current_fence);
+    m_completed_fence = fence_counter;
+    num_waits++;
+  }
+
+  bool ResizeBuffer(u32 new_size) override
+  {
+    if (!m_memory.empty() && !m_resizable)
+      return false;
+    m_memory.resize(new_size);
+    SetBuffer(m_memory.data(), new_size);
+    return true;
+  }
+
+private:
+  std::vector<u8> m_memory;
+  u64 m_current_fence = 1;
+  u64 m_completed_fence = 0;
+  bool m_resizable = false;
+};
+}  // namespace
+
+TEST(StreamBuffer, ReusesSpaceOnceGPUIsDone)
+{
+  TestStreamBuffer buffer(false);
+
+  ASSERT_TRUE(buffer.ReserveMemory(600, 4));
+  EXPECT_EQ(buffer.GetCurrentOffset(), 0u);
+  buffer.CommitMemory(600);
+
+  // The first allocation is still in use by the command list being recorded.
+  EXPECT_FALSE(buffer.ReserveMemory(600, 4));
+
+  buffer.Submit();
+  buffer.CompleteAll();
+  ASSERT_TRUE(buffer.ReserveMemory(300, 4));
+  EXPECT_EQ(buffer.GetCurrentOffset(), 600u);
+  buffer.CommitMemory(300);
+  EXPECT_EQ(buffer.num_waits, 0u);
+}
+
+TEST(StreamBuffer, WaitsForSubmittedWork)
+{
+  TestStreamBuffer buffer(false);
+  const int stalls = g_stats.this_frame.num_stream_buffer_stalls;
+
+  ASSERT_TRUE(buffer.ReserveMemory(700, 4));
+  buffer.CommitMemory(700);
+  // Fences are associated with the written data on the next reservation.
+  ASSERT_TRUE(buffer.ReserveMemory(8, 4));
+  buffer.CommitMemory(8);
+  buffer.Submit();
+
+  // The start of the buffer is only in use by submitted work, so the allocator waits for it
+  // instead of failing.
+  ASSERT_TRUE(buffer.ReserveMemory(600, 4));
+  EXPECT_EQ(buffer.GetCurrentOffset(), 0u);
+  EXPECT_EQ(buffer.num_waits, 1u);
+  EXPECT_EQ(g_stats.this_frame.num_stream_buffer_stalls, stalls + 1);
+}
+
+TEST(StreamBuffer, GrowsInsteadOfWaiting)
+{
+  TestStreamBuffer buffer(true);
+  buffer.SetMaximumSize(BUFFER_SIZE * 2);
+
+  ASSERT_TRUE(buffer.ReserveMemory(600, 4));
+  buffer.CommitMemory(600);
+
+  ASSERT_TRUE(buffer.ReserveMemory(600, 4));
+  EXPECT_EQ(buffer.GetSize(), BUFFER_SIZE * 2);
+  EXPECT_EQ(buffer.GetCurrentOffset(), 0u);
+  buffer.CommitMemory(600);
+
+  // Can't grow any further, so once it's full again this has to go through the fences.
+  for (u32 offset : {600u, 1200u})
+  {
+    ASSERT_TRUE(buffer.ReserveMemory(600, 4));
+    EXPECT_EQ(buffer.GetCurrentOffset(), offset);
+    buffer.CommitMemory(600);
+  }
+  EXPECT_FALSE(buffer.ReserveMemory(600, 4));
+  EXPECT_EQ(buffer.GetSize(), BUFFER_SIZE * 2);
+  EXPECT_EQ(buffer.num_waits, 0u);
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr int WIDTH = 64;
+constexpr int HEIGHT = 64;
+
+constexpr TextureFormat FORMATS[] = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+class TextureDecoderTest : public testing::TestWithParam<TextureFormat>
+{
+protected:
+  void SetUp() override
+  {
+    std::mt19937 rng(static_cast<u32>(GetParam()));
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    m_src.resize(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, GetParam()));
+    for (u8& byte : m_src)
+      byte = static_cast<u8>(dist(rng));
+
+    m_tlut.resize(2 * 16384);
+    for (u8& byte : m_tlut)
+      byte = static_cast<u8>(dist(rng));
+  }
+
+  std::vector<u32> Decode(TLUTFormat tlutfmt) const
+  {
+    std::vector<u32> dst(WIDTH * HEIGHT);
+    TexDecoder_Decode(reinterpret_cast<u8*>(dst.data()), m_src.data(), WIDTH, HEIGHT, GetParam(),
+                      m_tlut.data(), tlutfmt);
+    return dst;
+  }
+
+  // Compares the block decoder against the per-texel decoder used by the software renderer.
+  void CheckAgainstTexelDecoder(TLUTFormat tlutfmt) const
+  {
+    const std::vector<u32> decoded = Decode(tlutfmt);
+    for (int t = 0; t < HEIGHT; ++t)
+    {
+      for (int s = 0; s < WIDTH; ++s)
+      {
+        u32 expected;
+        TexDecoder_DecodeTexel(reinterpret_cast<u8*>(&expected), m_src, s, t, WIDTH - 1,
+                               GetParam(), m_tlut, tlutfmt);
+        ASSERT_EQ(decoded[t * WIDTH + s], expected) << fmt::format("at ({}, {})", s, t);
+      }
+    }
+  }
+
+  std::vector<u8> m_src;
+  std::vector<u8> m_tlut;
+};
+}  // namespace
+
+TEST_P(TextureDecoderTest, MatchesTexelDecoder)
+{
+  for (TLUTFormat tlutfmt : {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3})
+  {
+    CheckAgainstTexelDecoder(tlutfmt);
+    if (!IsColorIndexed(GetParam()))
+      break;
+  }
+}
+
+#ifdef _M_X86_64
+// The x64 decoder picks its SIMD paths at runtime, so also check all the ones this machine can run.
+TEST_P(TextureDecoderTest, MatchesTexelDecoderWithoutAVX2)
+{
+  const CPUInfo saved_cpu_info = cpu_info;
+  cpu_info.bAVX2 = false;
+  CheckAgainstTexelDecoder(TLUTFormat::RGB565);
+  cpu_info.bSSSE3 = false;
+  CheckAgainstTexelDecoder(TLUTFormat::RGB565);
+  cpu_info = saved_cpu_info;
+}
+#endif
+
+TEST_P(TextureDecoderTest, Benchmark)
+{
+  constexpr int ITERATIONS = 2000;
+
+  std::vector<u32> dst(WIDTH * HEIGHT);
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    TexDecoder_Decode(reinterpret_cast<u8*>(dst.data()), m_src.data(), WIDTH, HEIGHT, GetParam(),
+                      m_tlut.data(), TLUTFormat::RGB565);
+  }
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+  const double texels_per_second = double(WIDTH) * HEIGHT * ITERATIONS / time.count();
+  fmt::print("{:n}: {:.1f} Mtexels/s\n", GetParam(), texels_per_second / 1e6);
+  RecordProperty("mtexels_per_second", fmt::format("{:.1f}", texels_per_second / 1e6));
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, TextureDecoderTest, testing::ValuesIn(FORMATS),
+                         [](const testing::TestParamInfo<TextureFormat>& info) {
+                           return fmt::format("{:n}", info.param);
+                         });
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <bit>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <tuple>
@@ -15,6 +16,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoader.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 
@@ -1065,6 +1067,43 @@ TEST_P(VertexLoaderSkippedTexCoordsTest, SkippedTextures)
   }
 }
 
+TEST_F(VertexLoaderTest, SpecializedSoftwareLoader)
+{
+  // Metroid Prime's most common format, which the software loader has a specialization for.
+  m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Index16;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Index16;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::N;
+  m_vtx_attr.g0.NormalFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::UShort;
+  m_vtx_attr.g0.Tex0Frac = 8;
+  CreateAndCheckSizes(3 * sizeof(u16), 8 * sizeof(float));
+
+  // Fill the vertices and arrays with small positive values, so that no float is a NaN and no
+  // index is the skip index.
+  for (size_t i = 0; i < 0x100000; i++)
+    input_memory[i] = static_cast<u8>((static_cast<u32>(i) * 0x9E3779B1u) >> 26);
+  VertexLoaderManager::cached_arraybases[CPArray::Position] = input_memory + 0x10000;
+  VertexLoaderManager::cached_arraybases[CPArray::Normal] = input_memory + 0x30000;
+  VertexLoaderManager::cached_arraybases[CPArray::TexCoord0] = input_memory + 0x50000;
+  g_main_cp_state.array_strides[CPArray::Position] = 3 * sizeof(float);
+  g_main_cp_state.array_strides[CPArray::Normal] = 3 * sizeof(s16);
+  g_main_cp_state.array_strides[CPArray::TexCoord0] = 2 * sizeof(u16);
+
+  // The loader from CreateVertexLoader is the JIT where there is one. Either way it has to match.
+  constexpr int count = 1000;
+  const size_t output_size = count * m_loader->m_native_vtx_decl.stride;
+  VertexLoader software_loader(m_vtx_desc, m_vtx_attr);
+  ASSERT_EQ(software_loader.m_native_vtx_decl.stride, m_loader->m_native_vtx_decl.stride);
+  EXPECT_EQ(count, m_loader->RunVertices(input_memory, output_memory, count));
+  EXPECT_EQ(count,
+            software_loader.RunVertices(input_memory, output_memory + output_size, count));
+  EXPECT_EQ(0, std::memcmp(output_memory, output_memory + output_size, output_size));
+}
+
 // For gtest, which doesn't know about our fmt::formatters by default
 static void PrintTo(const VertexComponentFormat& t, std::ostream* os)
 {